@@ -0,0 +1,470 @@
+
+#include "adcCapture.h"
+#include "isr.h"
+#include "scheduler.h"
+#include <stdio.h>
+#include <string.h>
+
+#define RESET 0
+#define ADC_CAPTURE_HZ_PER_KHZ 1000
+#define ADC_CAPTURE_MAGIC 0x4341544C       // "LTAC" in little-endian order.
+#define ADC_CAPTURE_CHUNK_MAGIC 0x4B43544C // "LTCK"
+#define ADC_CAPTURE_CRC_POLYNOMIAL 0xEDB88320 // CRC-32, reflected.
+#define ADC_CAPTURE_CRC_TABLE_SIZE 256
+#define ADC_CAPTURE_BYTES_PER_PAIR 3 // Two 12-bit samples.
+#define ADC_CAPTURE_NIBBLE_BITS 4
+#define ADC_CAPTURE_LOW_NIBBLE 0x0F
+#define ADC_CAPTURE_SAMPLES_PER_LOAD 4 // 48 of the 64 bits.
+
+// Field offsets in the file header.
+#define ADC_CAPTURE_HEADER_MAGIC 0
+#define ADC_CAPTURE_HEADER_VERSION 4
+#define ADC_CAPTURE_HEADER_HEADER_SIZE 6
+#define ADC_CAPTURE_HEADER_SAMPLE_RATE 8
+#define ADC_CAPTURE_HEADER_CHUNK_SAMPLES 12
+#define ADC_CAPTURE_HEADER_FREQUENCY 14
+#define ADC_CAPTURE_HEADER_START_TICK 16
+#define ADC_CAPTURE_HEADER_BITS 20
+#define ADC_CAPTURE_HEADER_CRC 28
+
+// Field offsets in a chunk header.
+#define ADC_CAPTURE_CHUNK_MAGIC_OFFSET 0
+#define ADC_CAPTURE_CHUNK_COUNT_OFFSET 4
+#define ADC_CAPTURE_CHUNK_FLAGS_OFFSET 6
+#define ADC_CAPTURE_CHUNK_FIRST_SAMPLE_OFFSET 8
+#define ADC_CAPTURE_CHUNK_TICK_OFFSET 16
+
+// What isr_function() knows about a chunk. The header bytes are only filled
+// in when the chunk is written.
+typedef struct {
+  uint64_t firstSample;
+  uint32_t tick;
+  uint16_t sampleCount;
+  uint16_t flags;
+} adcCapture_chunkInfo_t;
+
+// The ring. Chunks are filled by isr_function() and written by
+// adcCapture_poll(); each counter is only changed by one side, so no locking
+// is needed. A chunk's buffer holds its header, samples and CRC in order, so
+// that it is written as one block.
+static uint8_t chunks[ADC_CAPTURE_CHUNK_COUNT][ADC_CAPTURE_MAX_CHUNK_SIZE];
+static adcCapture_chunkInfo_t chunkInfo[ADC_CAPTURE_CHUNK_COUNT];
+static volatile uint32_t filledChunkCount;  // Changed by isr_function().
+static volatile uint32_t writtenChunkCount; // Changed by adcCapture_poll().
+
+// Recording state, changed by isr_function() while recording.
+static volatile bool recording;
+static uint16_t fillSampleCount; // Samples in the chunk being filled.
+static uint64_t sampleIndex;
+static bool droppedSinceLastChunk;
+static volatile uint64_t droppedSampleCount;
+
+// Writing state.
+static adcCapture_writer_t captureWriter;
+static uint32_t writeOffset; // Bytes of the current chunk already written.
+static uint32_t writeSize;   // Size of the current chunk, 0 before its header.
+static adcCapture_stats_t stats;
+
+static uint32_t crcTable[ADC_CAPTURE_CRC_TABLE_SIZE];
+static bool crcTableBuilt = false;
+
+/*********************** Encoding helpers ****************************/
+
+static void adcCapture_put16(uint8_t data[], uint16_t value) {
+  data[0] = value;
+  data[1] = value >> 8;
+}
+
+static void adcCapture_put32(uint8_t data[], uint32_t value) {
+  adcCapture_put16(data, value);
+  adcCapture_put16(data + 2, value >> 16);
+}
+
+static void adcCapture_put64(uint8_t data[], uint64_t value) {
+  adcCapture_put32(data, value);
+  adcCapture_put32(data + 4, value >> 32);
+}
+
+static uint16_t adcCapture_get16(const uint8_t data[]) {
+  return data[0] | (uint16_t)data[1] << 8;
+}
+
+static uint32_t adcCapture_get32(const uint8_t data[]) {
+  return adcCapture_get16(data) | (uint32_t)adcCapture_get16(data + 2) << 16;
+}
+
+static uint64_t adcCapture_get64(const uint8_t data[]) {
+  return adcCapture_get32(data) | (uint64_t)adcCapture_get32(data + 4) << 32;
+}
+
+// Updates a CRC-32 (as used by zlib) with a block of bytes. Start from 0.
+uint32_t adcCapture_crc32(uint32_t crc, const uint8_t data[], uint32_t length) {
+  if (!crcTableBuilt) {
+    for (uint32_t i = 0; i < ADC_CAPTURE_CRC_TABLE_SIZE; i++) {
+      uint32_t entry = i;
+      for (uint8_t bit = 0; bit < 8; bit++)
+        entry = (entry & 1) ? (entry >> 1) ^ ADC_CAPTURE_CRC_POLYNOMIAL
+                            : entry >> 1;
+      crcTable[i] = entry;
+    }
+    crcTableBuilt = true;
+  }
+  crc = ~crc;
+  for (uint32_t i = 0; i < length; i++)
+    crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+// Returns the size of a chunk, CRC included.
+uint32_t adcCapture_chunkSize(uint16_t sampleCount) {
+  return ADC_CAPTURE_CHUNK_HEADER_SIZE + ADC_CAPTURE_PACKED_SIZE(sampleCount) +
+         ADC_CAPTURE_CRC_SIZE;
+}
+
+// Decodes a file header. Returns false if it is not a valid header.
+bool adcCapture_readHeader(const uint8_t data[], adcCapture_header_t *header) {
+  if (adcCapture_get32(data + ADC_CAPTURE_HEADER_MAGIC) != ADC_CAPTURE_MAGIC ||
+      adcCapture_get16(data + ADC_CAPTURE_HEADER_HEADER_SIZE) !=
+          ADC_CAPTURE_HEADER_SIZE ||
+      adcCapture_get32(data + ADC_CAPTURE_HEADER_CRC) !=
+          adcCapture_crc32(RESET, data, ADC_CAPTURE_HEADER_CRC))
+    return false;
+  header->version = adcCapture_get16(data + ADC_CAPTURE_HEADER_VERSION);
+  header->sampleRateHz = adcCapture_get32(data + ADC_CAPTURE_HEADER_SAMPLE_RATE);
+  header->chunkSamples = adcCapture_get16(data + ADC_CAPTURE_HEADER_CHUNK_SAMPLES);
+  header->frequencySetting =
+      adcCapture_get16(data + ADC_CAPTURE_HEADER_FREQUENCY);
+  header->startTick = adcCapture_get32(data + ADC_CAPTURE_HEADER_START_TICK);
+  header->bitsPerSample = data[ADC_CAPTURE_HEADER_BITS];
+  return header->version == ADC_CAPTURE_VERSION &&
+         header->bitsPerSample == ADC_CAPTURE_BITS_PER_SAMPLE &&
+         header->chunkSamples > 0 && header->sampleRateHz > 0;
+}
+
+// Decodes a chunk header. Returns false if it is not a valid chunk header.
+bool adcCapture_readChunkHeader(const uint8_t data[],
+                                adcCapture_chunkHeader_t *header) {
+  if (adcCapture_get32(data + ADC_CAPTURE_CHUNK_MAGIC_OFFSET) !=
+      ADC_CAPTURE_CHUNK_MAGIC)
+    return false;
+  header->sampleCount = adcCapture_get16(data + ADC_CAPTURE_CHUNK_COUNT_OFFSET);
+  header->flags = adcCapture_get16(data + ADC_CAPTURE_CHUNK_FLAGS_OFFSET);
+  header->firstSample =
+      adcCapture_get64(data + ADC_CAPTURE_CHUNK_FIRST_SAMPLE_OFFSET);
+  header->tick = adcCapture_get32(data + ADC_CAPTURE_CHUNK_TICK_OFFSET);
+  return header->sampleCount > 0;
+}
+
+// Unpacks count samples.
+void adcCapture_unpack(const uint8_t packed[], uint16_t count,
+                       uint16_t samples[]) {
+  uint16_t i = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // The samples are a little-endian bit stream, so on a little-endian CPU one
+  // 64-bit load holds the next four. Stop while the load stays inside the
+  // packed samples.
+  uint32_t packedSize = ADC_CAPTURE_PACKED_SIZE(count);
+  for (; i + ADC_CAPTURE_SAMPLES_PER_LOAD <= count &&
+         (i / 2) * ADC_CAPTURE_BYTES_PER_PAIR + sizeof(uint64_t) <= packedSize;
+       i += ADC_CAPTURE_SAMPLES_PER_LOAD) {
+    uint64_t bits;
+    memcpy(&bits, packed + (i / 2) * ADC_CAPTURE_BYTES_PER_PAIR, sizeof(bits));
+    for (uint16_t j = 0; j < ADC_CAPTURE_SAMPLES_PER_LOAD; j++)
+      samples[i + j] =
+          (bits >> (j * ADC_CAPTURE_BITS_PER_SAMPLE)) & ADC_CAPTURE_SAMPLE_MASK;
+  }
+#endif
+  for (; i < count; i += 2) {
+    const uint8_t *pair = packed + (i / 2) * ADC_CAPTURE_BYTES_PER_PAIR;
+    samples[i] = pair[0] | (uint16_t)(pair[1] & ADC_CAPTURE_LOW_NIBBLE) << 8;
+    if (i + 1 < count)
+      samples[i + 1] = pair[1] >> ADC_CAPTURE_NIBBLE_BITS |
+                       (uint16_t)pair[2] << ADC_CAPTURE_NIBBLE_BITS;
+  }
+}
+
+/*********************** Recording ****************************/
+
+// Writes the file header and starts recording. Returns false if the writer
+// failed.
+bool adcCapture_start(uint16_t frequencySetting, adcCapture_writer_t writer) {
+  recording = false;
+  filledChunkCount = RESET;
+  writtenChunkCount = RESET;
+  fillSampleCount = RESET;
+  sampleIndex = RESET;
+  droppedSinceLastChunk = false;
+  droppedSampleCount = RESET;
+  writeOffset = RESET;
+  writeSize = RESET;
+  memset(&stats, RESET, sizeof(stats));
+  captureWriter = writer;
+
+  uint8_t header[ADC_CAPTURE_HEADER_SIZE] = {0};
+  adcCapture_put32(header + ADC_CAPTURE_HEADER_MAGIC, ADC_CAPTURE_MAGIC);
+  adcCapture_put16(header + ADC_CAPTURE_HEADER_VERSION, ADC_CAPTURE_VERSION);
+  adcCapture_put16(header + ADC_CAPTURE_HEADER_HEADER_SIZE,
+                   ADC_CAPTURE_HEADER_SIZE);
+  adcCapture_put32(header + ADC_CAPTURE_HEADER_SAMPLE_RATE,
+                   ISR_TICKS_PER_MS * ADC_CAPTURE_HZ_PER_KHZ);
+  adcCapture_put16(header + ADC_CAPTURE_HEADER_CHUNK_SAMPLES,
+                   ADC_CAPTURE_CHUNK_SAMPLES);
+  adcCapture_put16(header + ADC_CAPTURE_HEADER_FREQUENCY, frequencySetting);
+  adcCapture_put32(header + ADC_CAPTURE_HEADER_START_TICK,
+                   scheduler_getTickCount());
+  header[ADC_CAPTURE_HEADER_BITS] = ADC_CAPTURE_BITS_PER_SAMPLE;
+  adcCapture_put32(header + ADC_CAPTURE_HEADER_CRC,
+                   adcCapture_crc32(RESET, header, ADC_CAPTURE_HEADER_CRC));
+  if (!captureWriter(header, ADC_CAPTURE_HEADER_SIZE)) {
+    stats.writeFailed = true;
+    return false;
+  }
+  stats.byteCount = ADC_CAPTURE_HEADER_SIZE;
+  recording = true;
+  return true;
+}
+
+// Stops recording and closes the chunk being filled.
+void adcCapture_stop() {
+  // isr_function() interrupts the main loop, not the other way around, so it
+  // never sees the partial chunk once recording is false.
+  recording = false;
+  if (fillSampleCount) {
+    chunkInfo[filledChunkCount % ADC_CAPTURE_CHUNK_COUNT].sampleCount =
+        fillSampleCount;
+    fillSampleCount = RESET;
+    filledChunkCount++;
+  }
+}
+
+// Returns true while recording.
+bool adcCapture_recording() { return recording; }
+
+// Called by isr_function() with every ADC sample. Kept to a few loads and
+// stores; headers and CRCs are left to adcCapture_poll().
+void adcCapture_addSample(uint32_t adcData) {
+  if (!recording)
+    return;
+  uint32_t fillIndex = filledChunkCount % ADC_CAPTURE_CHUNK_COUNT;
+  if (fillSampleCount == 0) {
+    // Starting a chunk. If the writer has not freed one, drop the sample.
+    if (filledChunkCount - writtenChunkCount >= ADC_CAPTURE_CHUNK_COUNT) {
+      sampleIndex++;
+      droppedSampleCount++;
+      droppedSinceLastChunk = true;
+      return;
+    }
+    adcCapture_chunkInfo_t *info = &chunkInfo[fillIndex];
+    info->firstSample = sampleIndex;
+    info->tick = scheduler_getTickCount();
+    info->flags = droppedSinceLastChunk ? ADC_CAPTURE_FLAG_GAP : RESET;
+    droppedSinceLastChunk = false;
+  }
+  uint8_t *pair = chunks[fillIndex] + ADC_CAPTURE_CHUNK_HEADER_SIZE +
+                  (fillSampleCount / 2) * ADC_CAPTURE_BYTES_PER_PAIR;
+  uint16_t sample = adcData & ADC_CAPTURE_SAMPLE_MASK;
+  if (fillSampleCount & 1) {
+    pair[1] |= sample << ADC_CAPTURE_NIBBLE_BITS;
+    pair[2] = sample >> ADC_CAPTURE_NIBBLE_BITS;
+  } else {
+    pair[0] = sample;
+    pair[1] = sample >> 8;
+  }
+  sampleIndex++;
+  if (++fillSampleCount == ADC_CAPTURE_CHUNK_SAMPLES) {
+    chunkInfo[fillIndex].sampleCount = fillSampleCount;
+    fillSampleCount = RESET;
+    filledChunkCount++;
+  }
+}
+
+// Fills in the header and CRC of a filled chunk. Returns its size.
+static uint32_t adcCapture_sealChunk(uint32_t index) {
+  const adcCapture_chunkInfo_t *info = &chunkInfo[index];
+  uint8_t *chunk = chunks[index];
+  adcCapture_put32(chunk + ADC_CAPTURE_CHUNK_MAGIC_OFFSET,
+                   ADC_CAPTURE_CHUNK_MAGIC);
+  adcCapture_put16(chunk + ADC_CAPTURE_CHUNK_COUNT_OFFSET, info->sampleCount);
+  adcCapture_put16(chunk + ADC_CAPTURE_CHUNK_FLAGS_OFFSET, info->flags);
+  adcCapture_put64(chunk + ADC_CAPTURE_CHUNK_FIRST_SAMPLE_OFFSET,
+                   info->firstSample);
+  adcCapture_put32(chunk + ADC_CAPTURE_CHUNK_TICK_OFFSET, info->tick);
+  uint32_t crcOffset = adcCapture_chunkSize(info->sampleCount) -
+                       ADC_CAPTURE_CRC_SIZE;
+  adcCapture_put32(chunk + crcOffset,
+                   adcCapture_crc32(RESET, chunk, crcOffset));
+  return crcOffset + ADC_CAPTURE_CRC_SIZE;
+}
+
+// Writes out up to maxBytes of the chunks that are complete. Returns true
+// while there is anything left to write.
+bool adcCapture_poll(uint32_t maxBytes) {
+  while (maxBytes && writtenChunkCount != filledChunkCount) {
+    uint32_t index = writtenChunkCount % ADC_CAPTURE_CHUNK_COUNT;
+    if (writeSize == 0)
+      writeSize = adcCapture_sealChunk(index);
+    uint32_t length = writeSize - writeOffset;
+    if (length > maxBytes)
+      length = maxBytes;
+    if (!stats.writeFailed &&
+        !captureWriter(chunks[index] + writeOffset, length)) {
+      // Nowhere to put the rest, so stop and throw it away.
+      stats.writeFailed = true;
+      recording = false;
+    }
+    maxBytes -= length;
+    writeOffset += length;
+    if (!stats.writeFailed)
+      stats.byteCount += length;
+    if (writeOffset == writeSize) {
+      writeOffset = RESET;
+      writeSize = RESET;
+      writtenChunkCount++; // Hands the chunk back to isr_function().
+      if (!stats.writeFailed)
+        stats.chunkCount++;
+    }
+  }
+  return writtenChunkCount != filledChunkCount;
+}
+
+// Returns the capture statistics.
+adcCapture_stats_t adcCapture_getStats() {
+  adcCapture_stats_t current = stats;
+  current.sampleCount = sampleIndex;
+  current.droppedSampleCount = droppedSampleCount;
+  return current;
+}
+
+/*********************** Test ****************************/
+
+#define ADC_CAPTURE_TEST_SAMPLE_COUNT (ADC_CAPTURE_CHUNK_SAMPLES * 5 / 2)
+#define ADC_CAPTURE_TEST_CHUNK_COUNT 3 // Two full chunks and a half.
+#define ADC_CAPTURE_TEST_CAPTURE_SIZE                                          \
+  (ADC_CAPTURE_HEADER_SIZE +                                                   \
+   ADC_CAPTURE_TEST_CHUNK_COUNT * ADC_CAPTURE_MAX_CHUNK_SIZE)
+#define ADC_CAPTURE_TEST_POLL_BYTES 7 // Not a divisor of anything.
+#define ADC_CAPTURE_TEST_DROP_COUNT 10
+#define ADC_CAPTURE_TEST_FREQUENCY 6
+#define ADC_CAPTURE_TEST_UNLIMITED 0xFFFFFFFF
+
+// While adcCapture_runTest() runs, the capture is written here. Writes past
+// the end, or with no buffer, are only counted.
+static uint8_t *testCapture;
+static uint32_t testCaptureLength;
+
+static bool adcCapture_testWriter(const uint8_t data[], uint32_t length) {
+  if (testCapture && testCaptureLength + length <= ADC_CAPTURE_TEST_CAPTURE_SIZE)
+    memcpy(testCapture + testCaptureLength, data, length);
+  testCaptureLength += length;
+  return true;
+}
+
+// A sample pattern that exercises all 12 bits.
+static uint16_t adcCapture_testSample(uint32_t i) {
+  return (i * 2749 + (i >> 3)) & ADC_CAPTURE_SAMPLE_MASK;
+}
+
+// Checks the chunk at offset. The samples must follow the test pattern from
+// firstSample on.
+static bool adcCapture_testChunk(const uint8_t capture[], uint32_t offset,
+                                 uint64_t firstSample, uint16_t sampleCount,
+                                 uint16_t flags) {
+  adcCapture_chunkHeader_t header;
+  if (!adcCapture_readChunkHeader(capture + offset, &header) ||
+      header.firstSample != firstSample || header.sampleCount != sampleCount ||
+      header.flags != flags) {
+    printf("adcCapture_runTest: bad chunk header at byte %u.\n", offset);
+    return false;
+  }
+  uint32_t crcOffset = adcCapture_chunkSize(sampleCount) - ADC_CAPTURE_CRC_SIZE;
+  if (adcCapture_get32(capture + offset + crcOffset) !=
+      adcCapture_crc32(RESET, capture + offset, crcOffset)) {
+    printf("adcCapture_runTest: bad CRC in the chunk at byte %u.\n", offset);
+    return false;
+  }
+  static uint16_t samples[ADC_CAPTURE_CHUNK_SAMPLES];
+  adcCapture_unpack(capture + offset + ADC_CAPTURE_CHUNK_HEADER_SIZE,
+                    sampleCount, samples);
+  for (uint16_t i = 0; i < sampleCount; i++) {
+    if (samples[i] != adcCapture_testSample(firstSample + i)) {
+      printf("adcCapture_runTest: sample %u is %u, expected %u.\n",
+             (uint32_t)(firstSample + i), samples[i],
+             adcCapture_testSample(firstSample + i));
+      return false;
+    }
+  }
+  return true;
+}
+
+// Records samples through the ISR path and reads them back. Returns true if
+// it passes.
+bool adcCapture_runTest() {
+  printf("****************** adcCapture_runTest() ******************\n");
+  static uint8_t capture[ADC_CAPTURE_TEST_CAPTURE_SIZE];
+  bool success = true;
+
+  // Two and a half chunks, written a few bytes at a time.
+  testCapture = capture;
+  testCaptureLength = RESET;
+  adcCapture_start(ADC_CAPTURE_TEST_FREQUENCY, adcCapture_testWriter);
+  for (uint32_t i = 0; i < ADC_CAPTURE_TEST_SAMPLE_COUNT; i++) {
+    adcCapture_addSample(adcCapture_testSample(i));
+    adcCapture_poll(ADC_CAPTURE_TEST_POLL_BYTES);
+  }
+  adcCapture_stop();
+  while (adcCapture_poll(ADC_CAPTURE_TEST_POLL_BYTES))
+    ;
+  adcCapture_header_t header;
+  if (!adcCapture_readHeader(capture, &header) ||
+      header.frequencySetting != ADC_CAPTURE_TEST_FREQUENCY ||
+      header.sampleRateHz != ISR_TICKS_PER_MS * ADC_CAPTURE_HZ_PER_KHZ ||
+      header.chunkSamples != ADC_CAPTURE_CHUNK_SAMPLES) {
+    printf("adcCapture_runTest: bad file header.\n");
+    success = false;
+  }
+  uint32_t offset = ADC_CAPTURE_HEADER_SIZE;
+  for (uint32_t first = 0; success && first < ADC_CAPTURE_TEST_SAMPLE_COUNT;
+       first += ADC_CAPTURE_CHUNK_SAMPLES) {
+    uint16_t count = ADC_CAPTURE_TEST_SAMPLE_COUNT - first;
+    if (count > ADC_CAPTURE_CHUNK_SAMPLES)
+      count = ADC_CAPTURE_CHUNK_SAMPLES;
+    success &= adcCapture_testChunk(capture, offset, first, count, RESET);
+    offset += adcCapture_chunkSize(count);
+  }
+  if (success && offset != testCaptureLength) {
+    printf("adcCapture_runTest: %u bytes written, expected %u.\n",
+           testCaptureLength, offset);
+    success = false;
+  }
+
+  // Fill the ring without writing anything, then drop a few samples. The
+  // first chunk after the gap must say so.
+  testCapture = NULL;
+  adcCapture_start(ADC_CAPTURE_TEST_FREQUENCY, adcCapture_testWriter);
+  uint32_t ringSamples = ADC_CAPTURE_CHUNK_COUNT * ADC_CAPTURE_CHUNK_SAMPLES;
+  uint32_t i = 0;
+  for (; i < ringSamples + ADC_CAPTURE_TEST_DROP_COUNT; i++)
+    adcCapture_addSample(adcCapture_testSample(i));
+  adcCapture_poll(ADC_CAPTURE_TEST_UNLIMITED);
+  testCapture = capture;
+  testCaptureLength = RESET;
+  for (uint32_t n = 0; n < ADC_CAPTURE_CHUNK_SAMPLES; n++, i++)
+    adcCapture_addSample(adcCapture_testSample(i));
+  adcCapture_stop();
+  adcCapture_poll(ADC_CAPTURE_TEST_UNLIMITED);
+  adcCapture_stats_t stats = adcCapture_getStats();
+  if (stats.droppedSampleCount != ADC_CAPTURE_TEST_DROP_COUNT ||
+      stats.chunkCount != ADC_CAPTURE_CHUNK_COUNT + 1) {
+    printf("adcCapture_runTest: %u samples dropped and %u chunks written, "
+           "expected %u and %u.\n",
+           (uint32_t)stats.droppedSampleCount, stats.chunkCount,
+           ADC_CAPTURE_TEST_DROP_COUNT, ADC_CAPTURE_CHUNK_COUNT + 1);
+    success = false;
+  }
+  success &= adcCapture_testChunk(
+      capture, 0, ringSamples + ADC_CAPTURE_TEST_DROP_COUNT,
+      ADC_CAPTURE_CHUNK_SAMPLES, ADC_CAPTURE_FLAG_GAP);
+  testCapture = NULL;
+  printf("adcCapture_runTest: %s.\n", success ? "passed" : "failed");
+  return success;
+}
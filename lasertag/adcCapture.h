@@ -0,0 +1,138 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ADCCAPTURE_H_
+#define ADCCAPTURE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Records the raw ADC samples seen by isr_function() so that they can be
+// replayed on the host.
+//
+// isr_function() only packs each sample into a ring of chunk buffers. The main
+// loop (adcCapture_poll()) fills in the chunk headers and CRCs and hands whole
+// chunks to a writer, at whatever speed the writer can take them. If the ring
+// fills up, samples are dropped and the next chunk says so.
+//
+// Capture format, all fields little-endian:
+//   File header (ADC_CAPTURE_HEADER_SIZE bytes):
+//     magic "LTAC", version (2), header size (2), sample rate in Hz (4),
+//     samples per chunk (2), frequency setting (2), start tick (4),
+//     bits per sample (1), reserved (3), reserved (4), CRC-32 (4, over the
+//     bytes before it)
+//   Chunks, until the end of the capture:
+//     magic "LTCK", sample count (2), flags (2), index of the first sample
+//     since the start (8), tick of the first sample (4), samples packed 12
+//     bits each (two samples in three bytes, the first in the low bits), and a
+//     CRC-32 (4) over the chunk header and samples.
+// Ticks are scheduler_getTickCount() values. Sample indices count dropped
+// samples too, so a gap shows up as a jump. Only the last chunk may be short.
+
+#define ADC_CAPTURE_VERSION 1
+#define ADC_CAPTURE_HEADER_SIZE 32
+#define ADC_CAPTURE_CHUNK_HEADER_SIZE 20
+#define ADC_CAPTURE_CRC_SIZE 4
+#define ADC_CAPTURE_BITS_PER_SAMPLE 12
+#define ADC_CAPTURE_SAMPLE_MASK 0xFFF
+#define ADC_CAPTURE_CHUNK_SAMPLES 1024 // 10 ms at 100 kHz.
+// Bytes taken by count packed samples.
+#define ADC_CAPTURE_PACKED_SIZE(count) (((count)*3 + 1) / 2)
+#define ADC_CAPTURE_MAX_CHUNK_SIZE                                             \
+  (ADC_CAPTURE_CHUNK_HEADER_SIZE +                                             \
+   ADC_CAPTURE_PACKED_SIZE(ADC_CAPTURE_CHUNK_SAMPLES) + ADC_CAPTURE_CRC_SIZE)
+// Set in a chunk's flags if samples were dropped just before it.
+#define ADC_CAPTURE_FLAG_GAP 0x0001
+
+// Chunks buffered between isr_function() and the writer. The default holds
+// about 10 seconds at 100 kHz (1.6 MB), enough to record a whole shot
+// sequence over the console UART, which is much slower than the ADC. Can be
+// overridden from the build.
+#ifndef ADC_CAPTURE_CHUNK_COUNT
+#define ADC_CAPTURE_CHUNK_COUNT 1024
+#endif
+
+// Writes length bytes of capture to storage. Returns false if it failed, which
+// stops the capture.
+typedef bool (*adcCapture_writer_t)(const uint8_t data[], uint32_t length);
+
+// The file header, decoded.
+typedef struct {
+  uint16_t version;
+  uint32_t sampleRateHz;
+  uint16_t chunkSamples;
+  uint16_t frequencySetting;
+  uint32_t startTick;
+  uint8_t bitsPerSample;
+} adcCapture_header_t;
+
+// A chunk header, decoded.
+typedef struct {
+  uint16_t sampleCount;
+  uint16_t flags;
+  uint64_t firstSample;
+  uint32_t tick;
+} adcCapture_chunkHeader_t;
+
+// Capture statistics.
+typedef struct {
+  uint64_t sampleCount;        // Samples seen while recording.
+  uint64_t droppedSampleCount; // Of those, samples the ring had no room for.
+  uint32_t chunkCount;         // Chunks written.
+  uint64_t byteCount;          // Bytes written, header included.
+  bool writeFailed;
+} adcCapture_stats_t;
+
+// Writes the file header and starts recording. frequencySetting is stored in
+// the header so that a replay knows which frequency the gun ignored.
+// Returns false if the writer failed.
+bool adcCapture_start(uint16_t frequencySetting, adcCapture_writer_t writer);
+
+// Stops recording. Samples already recorded are still written by
+// adcCapture_poll().
+void adcCapture_stop();
+
+// Returns true while recording.
+bool adcCapture_recording();
+
+// Called by isr_function() with every ADC sample.
+void adcCapture_addSample(uint32_t adcData);
+
+// Writes out up to maxBytes of the chunks that are complete, so that a slow
+// writer can be fed a little at a time from the main loop. Returns true while
+// there is anything left to write.
+bool adcCapture_poll(uint32_t maxBytes);
+
+// Returns the capture statistics.
+adcCapture_stats_t adcCapture_getStats();
+
+// Helpers for reading captures.
+
+// Updates a CRC-32 (as used by zlib) with a block of bytes. Start from 0.
+uint32_t adcCapture_crc32(uint32_t crc, const uint8_t data[], uint32_t length);
+
+// Decodes a file header. Returns false if it is not a valid header.
+bool adcCapture_readHeader(const uint8_t data[], adcCapture_header_t *header);
+
+// Decodes a chunk header. Returns false if it is not a valid chunk header.
+bool adcCapture_readChunkHeader(const uint8_t data[],
+                                adcCapture_chunkHeader_t *header);
+
+// Returns the size of a chunk, CRC included.
+uint32_t adcCapture_chunkSize(uint16_t sampleCount);
+
+// Unpacks count samples.
+void adcCapture_unpack(const uint8_t packed[], uint16_t count,
+                       uint16_t samples[]);
+
+// Records samples through the ISR path and reads them back. Returns true if
+// it passes.
+bool adcCapture_runTest();
+
+#endif /* ADCCAPTURE_H_ */
@@ -0,0 +1,163 @@
+
+#include "adpcm.h"
+#include <math.h>
+#include <stdio.h>
+
+#define ADPCM_STEP_TABLE_SIZE 89
+#define ADPCM_MAX_STEP_INDEX (ADPCM_STEP_TABLE_SIZE - 1)
+#define ADPCM_SIGN_BIT 0x8
+#define ADPCM_NIBBLE_MASK 0xF
+#define ADPCM_NIBBLE_BITS 4
+#define ADPCM_SAMPLE_MAX INT16_MAX
+#define ADPCM_SAMPLE_MIN INT16_MIN
+
+// Standard IMA-ADPCM tables.
+static const int16_t adpcm_stepTable[ADPCM_STEP_TABLE_SIZE] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+static const int8_t adpcm_indexTable[ADPCM_NIBBLE_MASK + 1] = {
+    -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8};
+
+// Applies one 4-bit code to the codec state and returns the new sample.
+// Shared by the encoder and decoder so they can never disagree.
+static inline int16_t adpcm_applyCode(adpcm_state_t *state, uint8_t code) {
+  int32_t step = adpcm_stepTable[state->stepIndex];
+  int32_t difference = step >> 3;
+  if (code & 0x4)
+    difference += step;
+  if (code & 0x2)
+    difference += step >> 1;
+  if (code & 0x1)
+    difference += step >> 2;
+  int32_t predictor = (code & ADPCM_SIGN_BIT) ? state->predictor - difference
+                                              : state->predictor + difference;
+  if (predictor > ADPCM_SAMPLE_MAX)
+    predictor = ADPCM_SAMPLE_MAX;
+  else if (predictor < ADPCM_SAMPLE_MIN)
+    predictor = ADPCM_SAMPLE_MIN;
+  state->predictor = predictor;
+  int16_t stepIndex = state->stepIndex + adpcm_indexTable[code];
+  if (stepIndex < 0)
+    stepIndex = 0;
+  else if (stepIndex > ADPCM_MAX_STEP_INDEX)
+    stepIndex = ADPCM_MAX_STEP_INDEX;
+  state->stepIndex = stepIndex;
+  return (int16_t)predictor;
+}
+
+// Resets the codec state to the agreed starting point.
+void adpcm_initState(adpcm_state_t *state) {
+  state->predictor = 0;
+  state->stepIndex = 0;
+}
+
+// Points a decoder at the start of an asset.
+void adpcm_initDecoder(adpcm_decoder_t *decoder, const uint8_t *data,
+                       uint32_t sampleCount) {
+  decoder->data = data;
+  decoder->sampleCount = sampleCount;
+  decoder->sampleIndex = 0;
+  adpcm_initState(&decoder->state);
+}
+
+// Returns the number of samples not yet decoded.
+uint32_t adpcm_remainingSamples(const adpcm_decoder_t *decoder) {
+  return decoder->sampleCount - decoder->sampleIndex;
+}
+
+// Decodes up to maxCount samples into samples[].
+uint32_t adpcm_decodeBlock(adpcm_decoder_t *decoder, int16_t samples[],
+                           uint32_t maxCount) {
+  uint32_t count = adpcm_remainingSamples(decoder);
+  if (count > maxCount)
+    count = maxCount;
+  uint32_t sampleIndex = decoder->sampleIndex;
+  adpcm_state_t state = decoder->state; // Keep the state in registers.
+  for (uint32_t i = 0; i < count; i++, sampleIndex++) {
+    uint8_t byte = decoder->data[sampleIndex >> 1];
+    uint8_t code = (sampleIndex & 1) ? (byte >> ADPCM_NIBBLE_BITS)
+                                     : (byte & ADPCM_NIBBLE_MASK);
+    samples[i] = adpcm_applyCode(&state, code);
+  }
+  decoder->state = state;
+  decoder->sampleIndex = sampleIndex;
+  return count;
+}
+
+// Encodes sampleCount samples into data[].
+void adpcm_encode(const int16_t samples[], uint32_t sampleCount,
+                  uint8_t data[]) {
+  adpcm_state_t state;
+  adpcm_initState(&state);
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    // Quantize the difference from the prediction in units of the step size.
+    int32_t difference = samples[i] - state.predictor;
+    uint8_t code = 0;
+    if (difference < 0) {
+      code = ADPCM_SIGN_BIT;
+      difference = -difference;
+    }
+    int32_t step = adpcm_stepTable[state.stepIndex];
+    if (difference >= step) {
+      code |= 0x4;
+      difference -= step;
+    }
+    step >>= 1;
+    if (difference >= step) {
+      code |= 0x2;
+      difference -= step;
+    }
+    step >>= 1;
+    if (difference >= step)
+      code |= 0x1;
+    adpcm_applyCode(&state, code); // Track what the decoder will see.
+    if (i & 1)
+      data[i >> 1] |= code << ADPCM_NIBBLE_BITS;
+    else
+      data[i >> 1] = code;
+  }
+}
+
+// Round-trips a synthetic signal through the encoder and decoder and checks
+// the reconstruction error.
+#define ADPCM_TEST_SAMPLE_COUNT 4801 // Odd, to exercise the last half-byte.
+#define ADPCM_TEST_BLOCK_SIZE 37     // Odd, to exercise nibble alignment.
+#define ADPCM_TEST_AMPLITUDE 12000.0
+#define ADPCM_TEST_PERIOD 48.0        // 1 kHz at 48 kHz.
+#define ADPCM_TEST_MAX_RMS_ERROR 300.0 // About -40 dB below the signal.
+#define ADPCM_TEST_PI 3.14159265358979323846
+bool adpcm_runTest() {
+  printf("****************** adpcm_runTest() ******************\n");
+  static int16_t original[ADPCM_TEST_SAMPLE_COUNT];
+  static int16_t decoded[ADPCM_TEST_SAMPLE_COUNT];
+  static uint8_t encoded[ADPCM_BYTE_COUNT(ADPCM_TEST_SAMPLE_COUNT)];
+  for (uint32_t i = 0; i < ADPCM_TEST_SAMPLE_COUNT; i++)
+    original[i] = ADPCM_TEST_AMPLITUDE *
+                  sin(2.0 * ADPCM_TEST_PI * i / ADPCM_TEST_PERIOD);
+  adpcm_encode(original, ADPCM_TEST_SAMPLE_COUNT, encoded);
+  // Decode in odd-sized blocks, as sound_tick() would.
+  adpcm_decoder_t decoder;
+  adpcm_initDecoder(&decoder, encoded, ADPCM_TEST_SAMPLE_COUNT);
+  uint32_t decodedCount = 0;
+  while (adpcm_remainingSamples(&decoder))
+    decodedCount += adpcm_decodeBlock(&decoder, &decoded[decodedCount],
+                                      ADPCM_TEST_BLOCK_SIZE);
+  double squaredError = 0.0;
+  for (uint32_t i = 0; i < ADPCM_TEST_SAMPLE_COUNT; i++) {
+    double error = (double)decoded[i] - original[i];
+    squaredError += error * error;
+  }
+  double rmsError = sqrt(squaredError / ADPCM_TEST_SAMPLE_COUNT);
+  bool success = (decodedCount == ADPCM_TEST_SAMPLE_COUNT) &&
+                 (rmsError < ADPCM_TEST_MAX_RMS_ERROR);
+  printf("adpcm_runTest(): decoded %lu samples, rms error %.1f. %s\n",
+         (unsigned long)decodedCount, rmsError, success ? "passed" : "failed");
+  return success;
+}
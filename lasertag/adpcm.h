@@ -0,0 +1,70 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// IMA-ADPCM codec for the sound assets. Each 16-bit sample is stored as a
+// 4-bit code, two codes per byte with the earlier sample in the low nibble,
+// so assets are 1/4 the size of the raw sample arrays. The decoder is
+// streaming: it keeps its place in the asset and decodes in small batches so
+// sound_tick() can decompress directly into the I2S FIFO.
+//
+// Assets are generated on the host with wav2adpcm (see host/wav2adpcm.c),
+// which produces name.adpcm.c/name.adpcm.h containing:
+//   const uint8_t name_adpcm[];
+//   #define NAME_ADPCM_SAMPLE_RATE
+//   #define NAME_ADPCM_NUMBER_OF_SAMPLES
+
+// Bytes needed to hold sampleCount samples.
+#define ADPCM_BYTE_COUNT(sampleCount) (((sampleCount) + 1) / 2)
+
+// Encoder/decoder state. Encoder and decoder start from the same state and
+// evolve identically, which is what lets the decoder reconstruct the signal.
+typedef struct {
+  int32_t predictor;  // Last reconstructed sample.
+  int16_t stepIndex;  // Index into the step-size table.
+} adpcm_state_t;
+
+// Streaming decoder for one asset.
+typedef struct {
+  const uint8_t *data;  // Encoded asset.
+  uint32_t sampleCount; // Total samples in the asset.
+  uint32_t sampleIndex; // Next sample to be decoded.
+  adpcm_state_t state;  // Codec state.
+} adpcm_decoder_t;
+
+// Resets the codec state to the agreed starting point.
+void adpcm_initState(adpcm_state_t *state);
+
+// Points a decoder at the start of an asset.
+void adpcm_initDecoder(adpcm_decoder_t *decoder, const uint8_t *data,
+                       uint32_t sampleCount);
+
+// Returns the number of samples not yet decoded.
+uint32_t adpcm_remainingSamples(const adpcm_decoder_t *decoder);
+
+// Decodes up to maxCount samples into samples[]. Returns the number of
+// samples decoded, which is less than maxCount only at the end of the asset.
+uint32_t adpcm_decodeBlock(adpcm_decoder_t *decoder, int16_t samples[],
+                           uint32_t maxCount);
+
+// Encodes sampleCount samples into data[], which must hold
+// ADPCM_BYTE_COUNT(sampleCount) bytes. Used by the host converter and tests.
+void adpcm_encode(const int16_t samples[], uint32_t sampleCount,
+                  uint8_t data[]);
+
+// Round-trips a synthetic signal through the encoder and decoder and checks
+// the reconstruction error. Returns true if it passes.
+bool adpcm_runTest();
+
+#endif /* ADPCM_H_ */
@@ -10,6 +10,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef AUTORELOADTIMER_H_
 #define AUTORELOADTIMER_H_
 
+#include "isr.h"
 #include <stdbool.h>
 
 // The auto-reload timer is always looking at the remaining shot-count from the
@@ -17,8 +18,8 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // after the delay expires, it sets the remaining shots to a specific value.
 
 #ifndef AUTO_RELOAD_EXPIRE_VALUE
-// Default, Defined in terms of 100 kHz ticks.
-#define AUTO_RELOAD_EXPIRE_VALUE 300000
+// Default, 3 seconds.
+#define AUTO_RELOAD_EXPIRE_VALUE (3000 * ISR_TICKS_PER_MS)
 #endif
 
 #ifndef AUTO_RELOAD_SHOT_VALUE
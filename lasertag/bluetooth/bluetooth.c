@@ -5,28 +5,29 @@
  *      Author: hutch
  */
 
-// DONT COMPILE THiS AS IT IS ALREADY COMPILED INTO THE LASERTAG LIBRARY.
+// This file is compiled into the bluetooth test program. Because it is linked
+// directly, it takes precedence over the copy in the ZYBO libraries.
 
-#include "supportFiles/bluetooth.h"
+#include "bluetooth.h"
 #include <Xuartlite.h>
 #include <stdio.h>
+#include <string.h>
 #include <xparameters.h>
 
 static XUartLite bluetooth_uartInstance; // Handle to the bluetooth UART.
 static XUartLite_Config
     bluetooth_uartConfig; // Handle to the bluetooth UART config.
 
-// This implements a dedicated buffer for storing values from the ADC
-// until they are read and processed by detector().
-// adcBuffer_t is similar to a queue.
-#define BLUETOOTH_QUEUE_SIZE 1000
+// Ring buffers between the bluetooth UART and the rest of the program. The
+// size is a power of two so that the free-running indices only need a mask,
+// and they wrap cleanly at 65536. Data moves in contiguous segments, so a
+// block read or write touches the ring with at most two memcpy() calls.
+#define BLUETOOTH_QUEUE_MASK (BLUETOOTH_QUEUE_SIZE - 1)
 #define BLUETOOTH_UART_FIFO_SIZE 16
 typedef struct {
-  uint16_t indexIn;                   // New values go here.
-  uint16_t indexOut;                  // Pull old values from here.
+  uint16_t indexIn;  // Free-running, new values go at indexIn & mask.
+  uint16_t indexOut; // Free-running, old values come from indexOut & mask.
   uint8_t data[BLUETOOTH_QUEUE_SIZE]; // Store values here.
-  uint16_t elementCount; // Number of values contained in adcBuffer_t.
-  uint16_t size;         // queue can hold this many elements.
 } bluetooth_queue_t;
 
 static bluetooth_queue_t
@@ -36,82 +37,96 @@ static bluetooth_queue_t
                              // bluetooth UART go here.
 
 // Init the q.
-void bluetooth_queueInit(bluetooth_queue_t *q, uint16_t size) {
+void bluetooth_queueInit(bluetooth_queue_t *q) {
   q->indexIn = 0;
   q->indexOut = 0;
-  q->elementCount = 0;
-  q->size = size;
-}
-
-// Implemented as a fixed-size circular buffer.
-// indexIn always points to an empty location (by definition).
-// indexOut always points to the oldest element.
-// buffer is empty if indexIn == indexOut. Buffer is full if incremented indexIn
-// == indexOut
-void bluetooth_queuePush(bluetooth_queue_t *q, uint8_t data) {
-  if (q->elementCount <
-      q->size) // Increment the element count unless you are already full.
-    q->elementCount++;
-  q->data[q->indexIn] = data;              // write,
-  q->indexIn = (q->indexIn + 1) % q->size; // then increment.
-  if (q->indexIn ==
-      q->indexOut) { // If you are now pointing at the out pointer,
-    q->indexOut = (q->indexOut + 1) % q->size; // move the out pointer up.
-  }
-}
-
-// Removes a single item from the ADC buffer.
-// Does not signal an error if the ADC buffer is currently
-// empty. Simply returns a default value of 0 if the buffer is currently empty.
-uint8_t bluetooth_queuePop(bluetooth_queue_t *q) {
-  uint8_t returnValue = 0;
-  if (q->indexIn == q->indexOut) // Just return 0 if empty.
-    return 0;
-  else {
-    returnValue =
-        q->data[q->indexOut]; // Not empty, get the return value from buffer.
-    q->indexOut = (q->indexOut + 1) % q->size; // increment the out index.
-    q->elementCount--;                         // One less element.
-  }
-  return returnValue;
-}
-
-// Provides read access to all elements in the ADC buffer.
-// No error messages are provided. In cases of error, a 0 is returned.
-// index = 0 indexes the oldest data in the queue.
-uint32_t bluetooth_queueReadElementAt(bluetooth_queue_t *q, uint32_t index) {
-  // Just return 0 if there if the buffer is empty or not enough elements for
-  // the index.
-  if ((q->indexIn == q->indexOut) || (index + 1 > q->elementCount))
-    return 0;
-  // Otherwise, there are enough elements, just do modulo addressing.
-  return q->data[(q->indexOut + index) % q->size];
 }
 
 // Functional interface to access element count.
 uint16_t bluetooth_queueElementCount(bluetooth_queue_t *q) {
-  return q->elementCount;
+  return (uint16_t)(q->indexIn - q->indexOut);
+}
+
+// Returns the number of elements that can still be written.
+uint16_t bluetooth_queueFreeCount(bluetooth_queue_t *q) {
+  return BLUETOOTH_QUEUE_SIZE - bluetooth_queueElementCount(q);
 }
 
 // Check if the queue is empty.
 bool bluetooth_queueEmpty(bluetooth_queue_t *q) {
-  return (q->indexIn == q->indexOut);
+  return q->indexIn == q->indexOut;
 }
 
 // Check if the queue is full.
 bool bluetooth_queueFull(bluetooth_queue_t *q) {
-  return !(q->elementCount < q->size);
+  return bluetooth_queueElementCount(q) == BLUETOOTH_QUEUE_SIZE;
 }
 
-uint16_t bluetooth_queueSize(bluetooth_queue_t *q) { return q->size; }
+// Returns the oldest element and the number of elements that follow it
+// without wrapping around the end of the ring.
+static uint16_t bluetooth_queueReadSegment(bluetooth_queue_t *q,
+                                           uint8_t **segment) {
+  uint16_t offset = q->indexOut & BLUETOOTH_QUEUE_MASK;
+  uint16_t count = bluetooth_queueElementCount(q);
+  *segment = &q->data[offset];
+  return count < BLUETOOTH_QUEUE_SIZE - offset ? count
+                                               : BLUETOOTH_QUEUE_SIZE - offset;
+}
+
+// Returns the next free element and the number of free elements that follow
+// it without wrapping around the end of the ring.
+static uint16_t bluetooth_queueWriteSegment(bluetooth_queue_t *q,
+                                            uint8_t **segment) {
+  uint16_t offset = q->indexIn & BLUETOOTH_QUEUE_MASK;
+  uint16_t count = bluetooth_queueFreeCount(q);
+  *segment = &q->data[offset];
+  return count < BLUETOOTH_QUEUE_SIZE - offset ? count
+                                               : BLUETOOTH_QUEUE_SIZE - offset;
+}
+
+// Copies up to size bytes into the queue. Returns the number copied, which is
+// less than size if the queue fills up.
+uint16_t bluetooth_queueWriteBlock(bluetooth_queue_t *q, const uint8_t *data,
+                                   uint16_t size) {
+  uint16_t written = 0;
+  while (written < size) {
+    uint8_t *segment;
+    uint16_t count = bluetooth_queueWriteSegment(q, &segment);
+    if (count == 0)
+      break;
+    if (count > size - written)
+      count = size - written;
+    memcpy(segment, &data[written], count);
+    q->indexIn += count;
+    written += count;
+  }
+  return written;
+}
+
+// Copies up to maxSize of the oldest bytes out of the queue. Returns the number
+// copied.
+uint16_t bluetooth_queueReadBlock(bluetooth_queue_t *q, uint8_t *data,
+                                  uint16_t maxSize) {
+  uint16_t read = 0;
+  while (read < maxSize) {
+    uint8_t *segment;
+    uint16_t count = bluetooth_queueReadSegment(q, &segment);
+    if (count == 0)
+      break;
+    if (count > maxSize - read)
+      count = maxSize - read;
+    memcpy(&data[read], segment, count);
+    q->indexOut += count;
+    read += count;
+  }
+  return read;
+}
 
 // Used to initialize any bluetooth data structures.
 // Must be called before accessing any of the bluetooth_ routines.
 int bluetooth_init() {
-  bluetooth_queueInit(&bluetooth_receiveQueue,
-                      BLUETOOTH_QUEUE_SIZE); // init the receive q.
-  bluetooth_queueInit(&bluetooth_transmitQueue,
-                      BLUETOOTH_QUEUE_SIZE); // init the transmit q.
+  bluetooth_queueInit(&bluetooth_receiveQueue);  // init the receive q.
+  bluetooth_queueInit(&bluetooth_transmitQueue); // init the transmit q.
   // Init the bluetooth UART.
   int status =
       XUartLite_CfgInitialize(&bluetooth_uartInstance, &bluetooth_uartConfig,
@@ -144,28 +159,20 @@ uint16_t bluetooth_uartRead(uint8_t *data, uint16_t maxSize) {
 // the queue. Will only read upto maxSize characters. Returns the number of
 // characters read.
 uint16_t bluetooth_receiveQueueRead(uint8_t *data, uint16_t maxSize) {
-  uint16_t bytesRead = 0;
-  // Read the characters unless the receive queue empties.
-  for (uint16_t i = 0;
-       i < maxSize && !bluetooth_queueEmpty(&bluetooth_receiveQueue); i++) {
-    data[i] = bluetooth_queuePop(&bluetooth_receiveQueue);
-    bytesRead++;
-  }
-  return bytesRead; // Let the caller know how many bytes were read.
+  return bluetooth_queueReadBlock(&bluetooth_receiveQueue, data, maxSize);
 }
 
 // Writes characters to the bluetooth transmit queue. The characters from the
 // buffer need to be written from the queue to the bluetooth UART. Returns the
 // number of characters written.
 uint16_t bluetooth_transmitQueueWrite(uint8_t *data, uint16_t size) {
-  uint16_t bytesWritten = 0;
-  // Write the characters unless the transmit queue fills up.
-  for (uint16_t i = 0;
-       i < size && !bluetooth_queueFull(&bluetooth_transmitQueue); i++) {
-    bluetooth_queuePush(&bluetooth_transmitQueue, data[i]);
-    bytesWritten++;
-  }
-  return bytesWritten; // Let the caller know how many bytes were written.
+  return bluetooth_queueWriteBlock(&bluetooth_transmitQueue, data, size);
+}
+
+// Returns the number of characters that bluetooth_transmitQueueWrite() can
+// still accept.
+uint16_t bluetooth_transmitQueueFreeCount() {
+  return bluetooth_queueFreeCount(&bluetooth_transmitQueue);
 }
 
 // Polls the bluetooth for data.
@@ -173,48 +180,38 @@ uint16_t bluetooth_transmitQueueWrite(uint8_t *data, uint16_t size) {
 // Data in the transmit queue are sent to the bluetooth UART.
 // bluetooth UART only operates at 9600 BAUD, so don't call this more than about
 // every 5 ms or so. Presumed that this will be called in a timer ISR.
+// The UART is read straight into, and written straight out of, contiguous
+// segments of the queues, up to a FIFO's worth per call. Each direction takes
+// at most two UART calls, the second only when a segment wraps.
 void bluetooth_poll() {
-  // Read characters from the bluetooth UART and copy to the receive queue.
-  uint8_t readData[BLUETOOTH_UART_FIFO_SIZE];
-  // How much room is in the receive queue?
-  uint16_t receiveQueueSpace =
-      bluetooth_queueSize(&bluetooth_receiveQueue) -
-      bluetooth_queueElementCount(&bluetooth_receiveQueue);
-  // Requested number of bytes will be either all the chars in the UART FIFO, or
-  // the available space in the recieve queue.
-  uint16_t requestedReadCount = receiveQueueSpace > BLUETOOTH_UART_FIFO_SIZE
-                                    ? BLUETOOTH_UART_FIFO_SIZE
-                                    : receiveQueueSpace;
-  // Transfer whatever you read to the receive queue.
-  uint16_t bytesRead = bluetooth_uartRead(readData, requestedReadCount);
-  //    if (bytesRead != 0)
-  //        printf("received %d bytes.\n", bytesRead);
-  for (uint16_t i = 0; i < bytesRead; i++) {
-    bluetooth_queuePush(&bluetooth_receiveQueue, readData[i]);
+  // Read whatever is in the UART FIFO straight into the receive queue.
+  uint16_t room = BLUETOOTH_UART_FIFO_SIZE;
+  while (room) {
+    uint8_t *segment;
+    uint16_t count =
+        bluetooth_queueWriteSegment(&bluetooth_receiveQueue, &segment);
+    if (count > room)
+      count = room;
+    uint16_t bytesRead = count ? bluetooth_uartRead(segment, count) : 0;
+    bluetooth_receiveQueue.indexIn += bytesRead;
+    room -= bytesRead;
+    if (bytesRead < count || count == 0) // UART FIFO empty or queue full.
+      break;
   }
-  // Read chars from the transmit queue and send them to the bluetooth UART.
-  // Transmit characters one at a time so you won't have to put anything back
-  // into the transmit queue.
-  bool transmitOk =
-      true; // This will be set to false if unable to transmit a byte.
-  uint16_t bytesToTransmit =
-      bluetooth_queueElementCount(&bluetooth_transmitQueue);
-  // Loop will write bytes to the bluetooth UART until the UART is full or all
-  // characters are transmitted.
-  for (uint16_t i = 0; i < bytesToTransmit && transmitOk; i++) {
-    uint8_t transmitData[1]; // Only transmit one byte at a time.
-    transmitData[0] = bluetooth_queueReadElementAt(
-        &bluetooth_transmitQueue, i); // Read the byte to be transmitted.
-    uint8_t bytesWritten =
-        bluetooth_uartWrite(transmitData, 1); // Ask for it to be written.
-    if (bytesWritten == 1) { // Successful if one byte was written.
-      transmitOk = true;
-      bluetooth_queuePop(
-          &bluetooth_transmitQueue); // Successfully written so pop the data off
-                                     // the queue.
-    } else {                         // Not successful, so terminate.
-      transmitOk = false;
-    }
+  // Send as much of the transmit queue as the UART FIFO accepts. Bytes are
+  // only popped once the UART has taken them.
+  room = BLUETOOTH_UART_FIFO_SIZE;
+  while (room) {
+    uint8_t *segment;
+    uint16_t count =
+        bluetooth_queueReadSegment(&bluetooth_transmitQueue, &segment);
+    if (count > room)
+      count = room;
+    uint16_t bytesWritten = count ? bluetooth_uartWrite(segment, count) : 0;
+    bluetooth_transmitQueue.indexOut += bytesWritten;
+    room -= bytesWritten;
+    if (bytesWritten < count || count == 0) // UART FIFO full or queue empty.
+      break;
   }
 }
 
@@ -14,6 +14,9 @@
 #define BLUETOOTH_INIT_STATUS_FAIL 0
 #define BLUETOOTH_INIT_STATUS_OK 1
 
+// Size of the receive and transmit queues. Must be a power of two.
+#define BLUETOOTH_QUEUE_SIZE 1024
+
 // Used to initialize any bluetooth data structures.
 int bluetooth_init();
 
@@ -28,6 +31,10 @@ uint16_t bluetooth_receiveQueueRead(uint8_t *data, uint16_t maxSize);
 // number of characters written.
 uint16_t bluetooth_transmitQueueWrite(uint8_t *data, uint16_t size);
 
+// Returns the number of characters that bluetooth_transmitQueueWrite() can
+// still accept.
+uint16_t bluetooth_transmitQueueFreeCount();
+
 // Starts an interactive loop that queries the user for input, transmits that
 // input to the bluetooth UART and then prints the result. Useful for
 // configuring the bluetooth modem when in command mode. Terminates if the user
@@ -39,6 +46,7 @@ void bluetooth_interactiveLoop();
 // Data in the transmit queue are sent to the bluetooth UART.
 // bluetooth UART only operates at 9600 BAUD, so don't call this more than about
 // every 5 ms or so. Presumed that this will be called in a timer ISR.
+// Moves up to a UART FIFO's worth (16 bytes) in each direction per call.
 void bluetooth_poll();
 
 #endif /* BLUETOOTH_H_ */
@@ -2,16 +2,27 @@
 
 #include "detector.h"
 #include "filter.h"
+#include "filterCore.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
+#include "latencyScreen.h"
 #include "lockoutTimer.h"
+#include "overload.h"
+#include "stageProfiler.h"
 #include <stdio.h>
 
 #define ADC_SCALE_FACTOR 2047.5
+// Multiplying by this is much cheaper than dividing by ADC_SCALE_FACTOR.
+#define ADC_SCALE_RECIPROCAL (1.0 / ADC_SCALE_FACTOR)
 #define ADC_SCALE_HALF 2047
 #define ADC_SCALE_FULL 4095
-#define MEDIAN_INDEX 4
+// Index of the median of count power values sorted from highest to lowest
+// (4 for all ten channels).
+#define MEDIAN_INDEX(count) (((count)-1) / 2)
 #define SORTED_ARRAY_SIZE FILTER_FREQUENCY_COUNT
+// detector() takes the ADC values out of the ISR's buffer and scales them up
+// to this many at a time: enough for everything the buffer holds.
+#define ADC_INGEST_BLOCK_SIZE ISR_ADC_BUFFER_SIZE
 
 // debug stuff
 const static double POWER_TEST_NO_HIT_VALS[] = {
@@ -24,6 +35,19 @@ const static double POWER_TEST_HIT_VALS[] = {
 #define POWER_TEST_NO_HIT 2
 #define DEBUG_OFF 0
 
+// Ignored channels get this power in detectHit(), below any real power, so
+// that they sort last.
+#define IGNORED_CHANNEL_POWER -1.0
+#define CHANNEL_BIT(channel) (1 << (channel))
+#define ALL_CHANNELS_MASK (CHANNEL_BIT(FILTER_FREQUENCY_COUNT) - 1)
+
+// Lockout stops the channels and restarts them from silence this long before
+// it ends: a power window of outputs plus the time the IIR filters take to
+// settle, which is a few periods of their 50 Hz bandwidth.
+#define CHANNEL_IIR_SETTLE_MS 50
+#define CHANNEL_WARMUP_TICKS                                                   \
+  ((FILTER_POWER_WINDOW_MS + CHANNEL_IIR_SETTLE_MS) * ISR_TICKS_PER_MS)
+
 static bool ignoredFreq[FILTER_FREQUENCY_COUNT];
 static bool ignoreHits;
 static bool hitDetected;
@@ -31,16 +55,67 @@ static uint32_t hitCounts[FILTER_FREQUENCY_COUNT];
 static uint8_t lastHitFrequency;
 static uint8_t fudgeFactorIndex;
 
+// Channels whose IIR filter and power are never computed because nobody can
+// hit them, one bit per frequency number.
+static uint16_t ignoredChannelMask;
+static uint8_t ignoredChannelCount;
+// True while lockout has stopped the IIR filters.
+static bool channelsSuspended;
+// Channels whose power was not kept up to date while hits were ignored.
+static uint16_t stalePowerMask;
+// Decimated outputs waiting for filterBlock(), and the sample index that
+// completed each of them.
+static uint16_t pendingOutputCount;
+static detector_sampleIndex_t pendingSampleIndexes[FILTER_IIR_BLOCK_SIZE];
+
 static const uint16_t FUDGE_FACTORS[] = {1000, 20, 30};
 
+// Global index of the next ADC sample to be processed by detector().
+static detector_sampleIndex_t sampleIndex;
+// The sample that completed the decimated output detectHit() is looking at.
+static detector_sampleIndex_t decisionSampleIndex;
+static uint32_t lastDroppedSampleCount; // isr_getDroppedSampleCount() seen.
+
+// Single-producer/single-consumer ring of hit events. detectHit() is the only
+// writer of hitEventHead and the consumer is the only writer of hitEventTail,
+// so neither side needs to disable interrupts. Both indices run freely and are
+// masked on access; head - tail is the number of events in the ring.
+#define HIT_EVENT_RING_MASK (DETECTOR_HIT_EVENT_RING_SIZE - 1)
+static detector_hitEvent_t hitEventRing[DETECTOR_HIT_EVENT_RING_SIZE];
+static volatile uint32_t hitEventHead;
+static volatile uint32_t hitEventTail;
+static volatile uint32_t droppedHitEventCount;
+
+// Keeps the compiler (and the CPU) from reordering the event copy with the
+// index update that publishes or releases it.
+#define HIT_EVENT_MEMORY_BARRIER() __sync_synchronize()
+
+// Adds a hit event to the ring, or counts it as dropped if the ring is full.
+static void pushHitEvent(const detector_hitEvent_t *event) {
+  uint32_t head = hitEventHead;
+  if (head - hitEventTail >= DETECTOR_HIT_EVENT_RING_SIZE) {
+    droppedHitEventCount++; // The consumer has fallen behind.
+    return;
+  }
+  hitEventRing[head & HIT_EVENT_RING_MASK] = *event;
+  HIT_EVENT_MEMORY_BARRIER(); // Event must be complete before it is published.
+  hitEventHead = head + 1;
+}
+
 // Always have to init things.
 // bool array is indexed by frequency number, array location set for true to
 // ignore, false otherwise. This way you can ignore multiple frequencies.
 void detector_init(bool ignoredFrequencies[]) {
+  ignoredChannelMask = 0;
+  ignoredChannelCount = 0;
   // inits some arrays
   for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i) {
     // copies values from ignoredFrequencies
     ignoredFreq[i] = ignoredFrequencies[i];
+    if (ignoredFreq[i]) {
+      ignoredChannelMask |= CHANNEL_BIT(i);
+      ignoredChannelCount++;
+    }
     // sets all hitCounts to 0
     hitCounts[i] = 0;
   }
@@ -49,7 +124,16 @@ void detector_init(bool ignoredFrequencies[]) {
   ignoreHits = false;
   hitDetected = false;
   filter_init();
+  channelsSuspended = false;
+  stalePowerMask = 0;
+  pendingOutputCount = 0;
   lastHitFrequency = 0;
+  sampleIndex = 0;
+  decisionSampleIndex = 0;
+  lastDroppedSampleCount = isr_getDroppedSampleCount();
+  hitEventHead = 0;
+  hitEventTail = 0;
+  droppedHitEventCount = 0;
 }
 
 // runs detection algorithm.
@@ -58,6 +142,9 @@ void detectHit(uint8_t debugMode) {
   double powerValues[FILTER_FREQUENCY_COUNT];
 
   uint32_t maxPowerFreqNumber;
+  uint8_t activeChannelCount = FILTER_FREQUENCY_COUNT - ignoredChannelCount;
+  if (activeChannelCount == 0) // nobody can hit us
+    return;
 
   // if debugmode, use predefined values
   if (debugMode == POWER_TEST_HIT) {
@@ -73,17 +160,21 @@ void detectHit(uint8_t debugMode) {
   } else { // run power for non test array
     filter_getCurrentPowerValues(powerValues);
   }
+  // ignored channels go to the bottom, so the max and the median are taken
+  // over the channels that can be hit
+  for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i) {
+    if (ignoredChannelMask & CHANNEL_BIT(i))
+      powerValues[i] = IGNORED_CHANNEL_POWER;
+  }
   detector_sort(
       &maxPowerFreqNumber, powerValues,
       sortedPowerValues); // run power sort for the incoming adc values
 
-  // PROBLEM : if the max frequency is an ignored frequency, but there's another
-  // frequency that
-  // isn't ignored that's high enough, we would miss that.
   // if the max power value is greater than the median times the fudgeFactor,
   // then it's a hit
+  double medianPower = sortedPowerValues[MEDIAN_INDEX(activeChannelCount)];
   if (powerValues[maxPowerFreqNumber] >=
-      sortedPowerValues[MEDIAN_INDEX] * FUDGE_FACTORS[fudgeFactorIndex]) {
+      medianPower * FUDGE_FACTORS[fudgeFactorIndex]) {
     // it's a hit!!!
     lockoutTimer_start(); // start lockout
     hitLedTimer_start();  // start timer for led
@@ -91,6 +182,83 @@ void detectHit(uint8_t debugMode) {
     ++hitCounts[maxPowerFreqNumber];
     hitDetected = true;
     lastHitFrequency = maxPowerFreqNumber;
+    // Record the hit so that it survives until someone drains it.
+    detector_hitEvent_t event;
+    event.sampleIndex = decisionSampleIndex;
+    event.frequencyNumber = maxPowerFreqNumber;
+    event.peakPower = powerValues[maxPowerFreqNumber];
+    event.medianPower = medianPower;
+    double threshold = medianPower * FUDGE_FACTORS[fudgeFactorIndex];
+    // A zero threshold only happens with an all-zero median; report margin 1.
+    event.margin = (threshold > 0.0) ? event.peakPower / threshold : 1.0;
+    pushHitEvent(&event);
+  }
+}
+
+// Runs the IIR filters on the pending decimated outputs in one block, then
+// computes power and looks for a hit after each output in turn, as if it had
+// been filtered as it came. Skips whatever cannot affect a hit:
+// - Deep in lockout, no channel is run. They restart from silence
+//   CHANNEL_WARMUP_TICKS before lockout ends, by which time their power
+//   matches what it would have been had they run all along, to well within
+//   the margin a hit needs.
+// - While hits are ignored, the IIR filters run to keep their state but power
+//   is not updated. Once hits count again, the power of one channel per block
+//   is recomputed from its output queue, and hits are looked for once all of
+//   them have been.
+static void filterBlock() {
+  uint16_t count = pendingOutputCount;
+  pendingOutputCount = 0;
+  if (lockoutTimer_getRemainingTicks() > CHANNEL_WARMUP_TICKS) {
+    channelsSuspended = true;
+    return;
+  }
+  if (channelsSuspended) {
+    for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i)
+      filter_resetIirFilter(i);
+    channelsSuspended = false;
+    stalePowerMask = 0; // Power starts over along with the output queues.
+  }
+  uint16_t activeChannelMask = ALL_CHANNELS_MASK & ~ignoredChannelMask;
+  // runs iir filters for each channel
+  STAGE_PROFILER_BEGIN(stageProfiler_iirBank_e);
+  filter_iirFilterBlock(activeChannelMask, count);
+  STAGE_PROFILER_END(stageProfiler_iirBank_e);
+  if (ignoreHits) {
+    stalePowerMask = activeChannelMask;
+    return;
+  }
+  bool caughtUp = false; // Only one stale channel is recomputed per block.
+  for (uint16_t j = 0; j < count; ++j) {
+    // computes power for each channel
+    STAGE_PROFILER_BEGIN(stageProfiler_power_e);
+    for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i) {
+      if (!(activeChannelMask & CHANNEL_BIT(i)))
+        continue;
+      if (!(stalePowerMask & CHANNEL_BIT(i))) {
+        filter_computeBlockPower(i, j);
+      } else if (j + 1 == count && !caughtUp) {
+        // Only the whole output queue is left to compute it from.
+        filter_computePower(i, true, false);
+        stalePowerMask &= ~CHANNEL_BIT(i);
+        caughtUp = true;
+      }
+    }
+    STAGE_PROFILER_END(stageProfiler_power_e);
+
+    // if the lockout timer isn't running and every channel's power is
+    // current, run the hit detection algorithm
+    if (!stalePowerMask && !lockoutTimer_running()) {
+      decisionSampleIndex = pendingSampleIndexes[j];
+      STAGE_PROFILER_BEGIN(stageProfiler_decision_e);
+      detectHit(DEBUG_OFF); // find if a hit
+      STAGE_PROFILER_END(stageProfiler_decision_e);
+      // a hit starts the lockout, which stops the channels right away
+      if (lockoutTimer_getRemainingTicks() > CHANNEL_WARMUP_TICKS) {
+        channelsSuspended = true;
+        return;
+      }
+    }
   }
 }
 
@@ -105,53 +273,73 @@ void detectHit(uint8_t debugMode) {
 // if ignoreSelf == true, ignore hits that are detected on your frequency.
 // Your frequency is simply the frequency indicated by the slide switches
 void detector(bool interruptsCurrentlyEnabled) {
+  stageProfiler_cycles_t startCycles = stageProfiler_readCycleCounter();
   uint32_t elementCount = isr_adcBufferElementCount(); // add value to buffer
-
-  // runs filter elementCount times
-  for (uint32_t i = 0; i < elementCount; ++i) {
-
-    isr_AdcValue_t rawAdcValue; // holds ADC output
-
-    // gets ADC value and toggles interrupts off/on
+  uint32_t sampleCount = elementCount; // processed by this call
+  overload_update(elementCount); // Shed optional work if falling behind.
+  // Samples the ISR dropped are older than any still in the buffer. Count them
+  // so that hit timestamps stay on the ADC sample clock.
+  uint32_t droppedSampleCount = isr_getDroppedSampleCount();
+  sampleIndex += droppedSampleCount - lastDroppedSampleCount;
+  latencyScreen_record(latencyScreen_droppedSamples_e,
+                       droppedSampleCount - lastDroppedSampleCount,
+                       LATENCY_SCREEN_DROPPED_SAMPLE_LIMIT);
+  lastDroppedSampleCount = droppedSampleCount;
+  // the buffer holds one value less than its size
+  latencyScreen_record(latencyScreen_adcBacklog_e, elementCount,
+                       ISR_ADC_BUFFER_SIZE - 1);
+
+  // runs the filters on elementCount values, a block at a time
+  while (elementCount) {
+    isr_AdcValue_t rawAdcValues[ADC_INGEST_BLOCK_SIZE]; // holds ADC output
+    double scaledAdcValues[ADC_INGEST_BLOCK_SIZE];
+    uint32_t blockCount = elementCount < ADC_INGEST_BLOCK_SIZE
+                              ? elementCount
+                              : ADC_INGEST_BLOCK_SIZE;
+
+    STAGE_PROFILER_BEGIN(stageProfiler_adcDequeue_e);
+    // gets the ADC values and toggles interrupts off/on
     if (interruptsCurrentlyEnabled) {
-      interrupts_disableArmInts();                 // disable int
-      rawAdcValue = isr_removeDataFromAdcBuffer(); // get value
-      interrupts_enableArmInts();                  // re-enable int
-
+      interrupts_disableArmInts(); // disable int
+      blockCount = isr_removeDataBlockFromAdcBuffer(rawAdcValues, blockCount);
+      interrupts_enableArmInts(); // re-enable int
     }
-    // else it just gets the ADC value
+    // else it just gets the ADC values
     else {
-      rawAdcValue = isr_removeDataFromAdcBuffer(); // pop value from queue
+      blockCount = isr_removeDataBlockFromAdcBuffer(rawAdcValues, blockCount);
     }
-
-    // scales it from 0 to 4095 to -1.0 to 1.0
-    double scaledAdcValue =
-        detector_getScaledAdcValue(rawAdcValue); // scale value
-
-    filter_addNewInput(scaledAdcValue); // add value to queue
-    static uint8_t filterInputCount = 0;
-    ++filterInputCount;
-
-    // if we added 10 new values, time to filter! (thereby decimating it)
-    if (filterInputCount ==
-        filter_getDecimationValue()) { // if at decimation value roll over
-      filterInputCount = 0;
-      // runs firFilter
-      filter_firFilter();
-      // runs iir filters for each channel
-      for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i)
-        filter_iirFilter(i);
-      // computes power for each channel
-      for (uint8_t i = 0; i < FILTER_FREQUENCY_COUNT; ++i)
-        filter_computePower(i, false, false);
-
-      // if the lockout timer isn't running and we're not ignoring all hits,
-      // run the hit detection algorithm
-      if (!lockoutTimer_running() && !ignoreHits) {
-        detectHit(DEBUG_OFF); // find if a hit
+    // scales them from 0 to 4095 to -1.0 to 1.0
+    detector_scaleAdcValues(rawAdcValues, scaledAdcValues, blockCount);
+    STAGE_PROFILER_END(stageProfiler_adcDequeue_e);
+    if (blockCount == 0) // Nothing left after all.
+      break;
+    elementCount -= blockCount;
+
+    for (uint32_t i = 0; i < blockCount; ++i) {
+      filter_addNewInput(scaledAdcValues[i]); // add value to queue
+      ++sampleIndex; // Hits are stamped with the sample that completed them.
+      static uint8_t filterInputCount = 0;
+      ++filterInputCount;
+
+      // if we added 10 new values, time to filter! (thereby decimating it)
+      if (filterInputCount ==
+          filter_getDecimationValue()) { // if at decimation value roll over
+        filterInputCount = 0;
+        // runs firFilter
+        STAGE_PROFILER_BEGIN(stageProfiler_fir_e);
+        filter_firFilter();
+        STAGE_PROFILER_END(stageProfiler_fir_e);
+        // the IIR filters run once a block of outputs is ready
+        pendingSampleIndexes[pendingOutputCount++] = sampleIndex;
+        if (pendingOutputCount == FILTER_IIR_BLOCK_SIZE)
+          filterBlock();
       }
     }
   }
+  // keeping up means taking no longer than the samples took to arrive
+  latencyScreen_record(latencyScreen_detectorCall_e,
+                       stageProfiler_readCycleCounter() - startCycles,
+                       ISR_BUDGET_CYCLES * (sampleCount ? sampleCount : 1));
 }
 
 // Returns true if a hit was detected.
@@ -163,6 +351,38 @@ uint16_t detector_getFrequencyNumberOfLastHit() { return lastHitFrequency; }
 // Clear the detected hit once you have accounted for it.
 void detector_clearHit() { hitDetected = false; }
 
+// Removes the oldest hit event from the event ring and copies it into event.
+// Returns false (and leaves event untouched) if the ring is empty.
+bool detector_popHitEvent(detector_hitEvent_t *event) {
+  uint32_t tail = hitEventTail;
+  if (tail == hitEventHead) // Empty.
+    return false;
+  *event = hitEventRing[tail & HIT_EVENT_RING_MASK];
+  HIT_EVENT_MEMORY_BARRIER(); // Finish the copy before releasing the slot.
+  hitEventTail = tail + 1;
+  return true;
+}
+
+// Copies up to maxCount of the oldest hit events into events[], removing them
+// from the ring. Returns the number of events copied.
+uint16_t detector_drainHitEvents(detector_hitEvent_t events[],
+                                 uint16_t maxCount) {
+  uint16_t count = 0;
+  while (count < maxCount && detector_popHitEvent(&events[count]))
+    count++;
+  return count;
+}
+
+// Returns the number of hit events waiting in the ring.
+uint16_t detector_getHitEventCount() { return hitEventHead - hitEventTail; }
+
+// Returns the number of hit events that were discarded because the ring was
+// full when they were detected.
+uint32_t detector_getDroppedHitEventCount() { return droppedHitEventCount; }
+
+// Returns the global index of the next ADC sample that detector() will process.
+detector_sampleIndex_t detector_getSampleIndex() { return sampleIndex; }
+
 // Ignore all hits. Used to provide some limited invincibility in some game
 // modes. The detector will ignore all hits if the flag is true, otherwise will
 // respond to hits normally.
@@ -230,7 +450,14 @@ detector_status_t detector_sort(uint32_t *maxPowerFreqNo,
 
 // Encapsulate ADC scaling for easier testing.
 double detector_getScaledAdcValue(isr_AdcValue_t adcValue) {
-  return adcValue / ADC_SCALE_FACTOR - 1.0;
+  return adcValue * ADC_SCALE_RECIPROCAL - 1.0;
+}
+
+// Scales count ADC values at once (see filterCore.cpp).
+void detector_scaleAdcValues(const isr_AdcValue_t adcValues[],
+                             double scaledAdcValues[], uint32_t count) {
+  filterCore_scaleAdcValues(adcValues, scaledAdcValues, count,
+                            ADC_SCALE_RECIPROCAL);
 }
 
 /*******************************************************
@@ -238,6 +465,8 @@ double detector_getScaledAdcValue(isr_AdcValue_t adcValue) {
  ******************************************************/
 
 // Students implement this as part of Milestone 3, Task 3.
+#define HIT_EVENT_TEST_FUDGE_FACTOR_INDEX 1
+#define IGNORED_TEST_FREQUENCY 3 // Where POWER_TEST_HIT_VALS peaks.
 void detector_runTest() {
   printf("Running test with hit values\n");
   detectHit(POWER_TEST_HIT); // detect hit
@@ -261,6 +490,50 @@ void detector_runTest() {
     printf("Hit not detected!\n");
   }
   detector_clearHit(); // clear hit
+
+  printf("Running hit event ring test\n");
+  // The test hit values are only a hit with the smaller fudge factors.
+  detector_setFudgeFactorIndex(HIT_EVENT_TEST_FUDGE_FACTOR_INDEX);
+  detector_hitEvent_t event;
+  while (detector_popHitEvent(&event)) // Start with an empty ring.
+    ;
+  detectHit(POWER_TEST_HIT);
+  if (detector_popHitEvent(&event)) {
+    printf("Hit event: sample %llu, frequency %d, peak %f, median %f, "
+           "margin %f\n",
+           (unsigned long long)event.sampleIndex, event.frequencyNumber,
+           event.peakPower, event.medianPower, event.margin);
+  } else {
+    printf("Error: no hit event recorded!\n");
+  }
+  if (detector_getHitEventCount() != 0)
+    printf("Error: unexpected hit events in the ring!\n");
+  // Overfill the ring and make sure the extra hits are counted as dropped.
+  uint32_t droppedBefore = detector_getDroppedHitEventCount();
+  for (uint16_t i = 0; i < DETECTOR_HIT_EVENT_RING_SIZE + 1; i++)
+    detectHit(POWER_TEST_HIT);
+  if (detector_getDroppedHitEventCount() - droppedBefore != 1)
+    printf("Error: hit event ring did not count the dropped event!\n");
+  detector_hitEvent_t events[DETECTOR_HIT_EVENT_RING_SIZE];
+  uint16_t drained =
+      detector_drainHitEvents(events, DETECTOR_HIT_EVENT_RING_SIZE);
+  printf("Drained %d hit events (expected %d)\n", drained,
+         DETECTOR_HIT_EVENT_RING_SIZE);
+  detector_clearHit(); // clear hit
+
+  printf("Running test with the hit frequency ignored\n");
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  ignoredFrequencies[IGNORED_TEST_FREQUENCY] = true;
+  detector_init(ignoredFrequencies);
+  detector_setFudgeFactorIndex(HIT_EVENT_TEST_FUDGE_FACTOR_INDEX);
+  detectHit(POWER_TEST_HIT);
+  if (detector_hitDetected()) {
+    printf("Error: hit detected on an ignored frequency!\n");
+  } else {
+    printf("Hit not detected!\n");
+  }
+  ignoredFrequencies[IGNORED_TEST_FREQUENCY] = false;
+  detector_init(ignoredFrequencies);
 }
 
 // Returns 0 if passes, non-zero otherwise.
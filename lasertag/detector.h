@@ -30,6 +30,31 @@ typedef uint32_t detector_status_t;   // Used to return status from tests.
 
 typedef uint16_t detector_hitCount_t;
 
+// Global index of an ADC sample, counted from detector_init(). Samples that
+// the ISR dropped are counted too. 64 bits so that it does not wrap during a
+// game (32 bits wraps after ~12 hours at 100 kHz).
+typedef uint64_t detector_sampleIndex_t;
+
+// Number of hit events the detector can hold before the game loop (or the
+// telemetry) drains them. Must be a power of two.
+#define DETECTOR_HIT_EVENT_RING_SIZE 16
+
+// Everything known about a single hit at the moment it was detected.
+typedef struct {
+  // Global index of the ADC sample that completed the decimated output on
+  // which the hit was detected.
+  detector_sampleIndex_t sampleIndex;
+  // Frequency number that caused the hit.
+  uint16_t frequencyNumber;
+  // Power of the hitting channel.
+  double peakPower;
+  // Median power across all channels.
+  double medianPower;
+  // How far the peak was above the hit threshold (peak / (median * fudge
+  // factor)). Always >= 1.0 for a hit.
+  double margin;
+} detector_hitEvent_t;
+
 typedef detector_status_t (*sortTestFunctionPtr)(bool, uint32_t, uint32_t,
                                                  double[], double[], bool);
 
@@ -48,6 +73,9 @@ void detector_init(bool ignoredFrequencies[]);
 // 3. re-enable interrupts if interruptsNotEnabled was true.
 // if ignoreSelf == true, ignore hits that are detected on your frequency.
 // Your frequency is simply the frequency indicated by the slide switches
+// The IIR filters run on FILTER_IIR_BLOCK_SIZE decimated outputs at a time, so
+// a hit comes out of detector() up to that many outputs after the sample that
+// completed it (see detector_hitEvent_t).
 void detector(bool interruptsCurrentlyEnabled);
 
 // Returns true if a hit was detected.
@@ -59,6 +87,27 @@ uint16_t detector_getFrequencyNumberOfLastHit();
 // Clear the detected hit once you have accounted for it.
 void detector_clearHit();
 
+// Removes the oldest hit event from the event ring and copies it into event.
+// Returns false (and leaves event untouched) if the ring is empty.
+// Events are produced by detector() and may be consumed by the game loop or by
+// the telemetry, but only by one of them at a time.
+bool detector_popHitEvent(detector_hitEvent_t *event);
+
+// Copies up to maxCount of the oldest hit events into events[], removing them
+// from the ring. Returns the number of events copied.
+uint16_t detector_drainHitEvents(detector_hitEvent_t events[],
+                                 uint16_t maxCount);
+
+// Returns the number of hit events waiting in the ring.
+uint16_t detector_getHitEventCount();
+
+// Returns the number of hit events that were discarded because the ring was
+// full when they were detected.
+uint32_t detector_getDroppedHitEventCount();
+
+// Returns the global index of the next ADC sample that detector() will process.
+detector_sampleIndex_t detector_getSampleIndex();
+
 // Ignore all hits. Used to provide some limited invincibility in some game
 // modes. The detector will ignore all hits if the flag is true, otherwise will
 // respond to hits normally.
@@ -89,6 +138,11 @@ detector_status_t detector_sort(uint32_t *maxPowerFreqNo,
 // Encapsulate ADC scaling for easier testing.
 double detector_getScaledAdcValue(isr_AdcValue_t adcValue);
 
+// Scales count ADC values from 0..4095 to -1.0..1.0 at once, giving the same
+// values as detector_getScaledAdcValue().
+void detector_scaleAdcValues(const isr_AdcValue_t adcValues[],
+                             double scaledAdcValues[], uint32_t count);
+
 /*******************************************************
  ****************** Test Routines **********************
  ******************************************************/
@@ -0,0 +1,454 @@
+
+#include "displayBuffer.h"
+#include "display.h"
+#include <stdio.h>
+#include <string.h>
+
+#define RESET 0
+#define DECIMAL_BUFFER_SIZE 12 // Enough for any int32_t and the terminator.
+
+#ifdef DISPLAY_BUFFER_ENABLED
+
+// The ZYBO display package has no window writes, and the buffer without them
+// takes far more display calls than drawing directly.
+#if defined(__arm__) && !defined(DISPLAY_BUFFER_WINDOW_WRITE_ENABLED)
+#error "On the gun, the buffer needs DISPLAY_BUFFER_WINDOW_WRITE_ENABLED."
+#endif
+
+#define FONT_FIRST_CHAR ' '
+#define FONT_LAST_CHAR '~'
+#define FONT_GLYPH_WIDTH 5  // Columns per glyph, the 6th column is spacing.
+#define FONT_GLYPH_HEIGHT 8 // Bits per column, least significant at the top.
+#define CHAR_CELL_WIDTH 6
+#define CHAR_CELL_HEIGHT 8
+
+// 5x7 font, one byte per column, for the printable ASCII characters.
+static const uint8_t font[FONT_LAST_CHAR - FONT_FIRST_CHAR + 1]
+                         [FONT_GLYPH_WIDTH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, // ' ' !
+    {0x00, 0x07, 0x00, 0x07, 0x00}, {0x14, 0x7F, 0x14, 0x7F, 0x14}, // " #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62}, // $ %
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, // & '
+    {0x00, 0x1C, 0x22, 0x41, 0x00}, {0x00, 0x41, 0x22, 0x1C, 0x00}, // ( )
+    {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08}, // * +
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, // , -
+    {0x00, 0x60, 0x60, 0x00, 0x00}, {0x20, 0x10, 0x08, 0x04, 0x02}, // . /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00}, // 0 1
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, // 2 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10}, {0x27, 0x45, 0x45, 0x45, 0x39}, // 4 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03}, // 6 7
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, // 8 9
+    {0x00, 0x36, 0x36, 0x00, 0x00}, {0x00, 0x56, 0x36, 0x00, 0x00}, // : ;
+    {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14}, // < =
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, // > ?
+    {0x32, 0x49, 0x79, 0x41, 0x3E}, {0x7E, 0x11, 0x11, 0x11, 0x7E}, // @ A
+    {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22}, // B C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, // D E
+    {0x7F, 0x09, 0x09, 0x09, 0x01}, {0x3E, 0x41, 0x49, 0x49, 0x7A}, // F G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00}, // H I
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, // J K
+    {0x7F, 0x40, 0x40, 0x40, 0x40}, {0x7F, 0x02, 0x0C, 0x02, 0x7F}, // L M
+    {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E}, // N O
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, // P Q
+    {0x7F, 0x09, 0x19, 0x29, 0x46}, {0x46, 0x49, 0x49, 0x49, 0x31}, // R S
+    {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F}, // T U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, // V W
+    {0x63, 0x14, 0x08, 0x14, 0x63}, {0x07, 0x08, 0x70, 0x08, 0x07}, // X Y
+    {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00}, // Z [
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, // \ ]
+    {0x04, 0x02, 0x01, 0x02, 0x04}, {0x40, 0x40, 0x40, 0x40, 0x40}, // ^ _
+    {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78}, // ` a
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, // b c
+    {0x38, 0x44, 0x44, 0x48, 0x7F}, {0x38, 0x54, 0x54, 0x54, 0x18}, // d e
+    {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E}, // f g
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, // h i
+    {0x20, 0x40, 0x44, 0x3D, 0x00}, {0x7F, 0x10, 0x28, 0x44, 0x00}, // j k
+    {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78}, // l m
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, // n o
+    {0x7C, 0x14, 0x14, 0x14, 0x08}, {0x08, 0x14, 0x14, 0x18, 0x7C}, // p q
+    {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20}, // r s
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, // t u
+    {0x1C, 0x20, 0x40, 0x20, 0x1C}, {0x3C, 0x40, 0x30, 0x40, 0x3C}, // v w
+    {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C}, // x y
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, // z {
+    {0x00, 0x00, 0x7F, 0x00, 0x00}, {0x00, 0x41, 0x36, 0x08, 0x00}, // | }
+    {0x08, 0x04, 0x08, 0x10, 0x08}};                                 // ~
+
+static uint16_t pixels[DISPLAY_BUFFER_HEIGHT][DISPLAY_BUFFER_WIDTH];
+static bool dirtyTiles[DISPLAY_BUFFER_TILE_ROWS][DISPLAY_BUFFER_TILE_COLUMNS];
+static uint16_t dirtyTileCount;
+static uint32_t lastFlushCallCount;
+static uint32_t drawCallCount; // What drawing directly would have cost.
+#ifdef DISPLAY_BUFFER_WINDOW_WRITE_ENABLED
+// A run of tiles, copied row after row for a window write.
+static uint16_t windowPixels[DISPLAY_BUFFER_TILE_SIZE * DISPLAY_BUFFER_WIDTH];
+#endif
+
+// Text state, as in the display package.
+static int16_t cursorX;
+static int16_t cursorY;
+static uint16_t textColor = DISPLAY_WHITE;
+static uint8_t textSize = 1;
+
+// Marks every tile touched by the (already clipped) rectangle as dirty.
+static void markDirty(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+  for (int16_t ty = y0 / DISPLAY_BUFFER_TILE_SIZE;
+       ty <= (y1 - 1) / DISPLAY_BUFFER_TILE_SIZE; ty++)
+    for (int16_t tx = x0 / DISPLAY_BUFFER_TILE_SIZE;
+         tx <= (x1 - 1) / DISPLAY_BUFFER_TILE_SIZE; tx++)
+      if (!dirtyTiles[ty][tx]) {
+        dirtyTiles[ty][tx] = true;
+        dirtyTileCount++;
+      }
+}
+
+// Returns true if every pixel of a tile has the same color, and that color.
+static bool tileIsUniform(int16_t tx, int16_t ty, uint16_t *color) {
+  int16_t x0 = tx * DISPLAY_BUFFER_TILE_SIZE;
+  int16_t y0 = ty * DISPLAY_BUFFER_TILE_SIZE;
+  *color = pixels[y0][x0];
+  for (int16_t y = y0; y < y0 + DISPLAY_BUFFER_TILE_SIZE; y++)
+    for (int16_t x = x0; x < x0 + DISPLAY_BUFFER_TILE_SIZE; x++)
+      if (pixels[y][x] != *color)
+        return false;
+  return true;
+}
+
+#ifdef DISPLAY_BUFFER_WINDOW_WRITE_ENABLED
+// Sends tiles tx0 to tx1 - 1 of tile row ty as one window: the address window
+// is set once and all of its pixels go out in a single call.
+static void flushWindow(int16_t tx0, int16_t tx1, int16_t ty) {
+  int16_t x0 = tx0 * DISPLAY_BUFFER_TILE_SIZE;
+  int16_t y0 = ty * DISPLAY_BUFFER_TILE_SIZE;
+  int16_t width = (tx1 - tx0) * DISPLAY_BUFFER_TILE_SIZE;
+  uint32_t count = 0;
+  for (int16_t y = y0; y < y0 + DISPLAY_BUFFER_TILE_SIZE; y++) {
+    memcpy(&windowPixels[count], &pixels[y][x0], width * sizeof(uint16_t));
+    count += width;
+  }
+  display_setAddrWindow(x0, y0, width, DISPLAY_BUFFER_TILE_SIZE);
+  display_writePixels(windowPixels, count);
+  lastFlushCallCount += 2;
+}
+#else
+// Sends a mixed-color tile as one rectangle per run of same-colored pixels in
+// each row.
+static void flushMixedTile(int16_t tx, int16_t ty) {
+  int16_t x0 = tx * DISPLAY_BUFFER_TILE_SIZE;
+  int16_t y0 = ty * DISPLAY_BUFFER_TILE_SIZE;
+  for (int16_t y = y0; y < y0 + DISPLAY_BUFFER_TILE_SIZE; y++) {
+    int16_t runStart = x0;
+    for (int16_t x = x0 + 1; x <= x0 + DISPLAY_BUFFER_TILE_SIZE; x++) {
+      if (x == x0 + DISPLAY_BUFFER_TILE_SIZE ||
+          pixels[y][x] != pixels[y][runStart]) {
+        display_fillRect(runStart, y, x - runStart, 1, pixels[y][runStart]);
+        lastFlushCallCount++;
+        runStart = x;
+      }
+    }
+  }
+}
+#endif
+
+// Fills the part of the rectangle that is on the screen and marks its tiles
+// dirty.
+static void fillPixels(int16_t x, int16_t y, int16_t w, int16_t h,
+                       uint16_t color) {
+  int16_t x0 = (x < 0) ? 0 : x;
+  int16_t y0 = (y < 0) ? 0 : y;
+  int16_t x1 = (x + w > DISPLAY_BUFFER_WIDTH) ? DISPLAY_BUFFER_WIDTH : x + w;
+  int16_t y1 = (y + h > DISPLAY_BUFFER_HEIGHT) ? DISPLAY_BUFFER_HEIGHT : y + h;
+  if (x0 >= x1 || y0 >= y1) // Nothing left after clipping.
+    return;
+  for (int16_t row = y0; row < y1; row++)
+    for (int16_t column = x0; column < x1; column++)
+      pixels[row][column] = color;
+  markDirty(x0, y0, x1, y1);
+}
+
+// Draws one character at the cursor and advances it. Newlines move the cursor
+// to the start of the next line, and text wraps at the right edge.
+static void drawChar(char c) {
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += textSize * CHAR_CELL_HEIGHT;
+    return;
+  }
+  if (c == '\r')
+    return;
+  if (cursorX + textSize * CHAR_CELL_WIDTH > DISPLAY_BUFFER_WIDTH) {
+    cursorX = 0;
+    cursorY += textSize * CHAR_CELL_HEIGHT;
+  }
+  if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR)
+    c = '?'; // No glyph for it.
+  const uint8_t *glyph = font[c - FONT_FIRST_CHAR];
+  for (int16_t column = 0; column < FONT_GLYPH_WIDTH; column++)
+    for (int16_t row = 0; row < FONT_GLYPH_HEIGHT; row++)
+      if (glyph[column] & (1 << row)) // Transparent background.
+        fillPixels(cursorX + column * textSize, cursorY + row * textSize,
+                   textSize, textSize, textColor);
+  cursorX += textSize * CHAR_CELL_WIDTH;
+}
+#endif
+
+// Clears the buffer to black and marks the whole screen dirty.
+void displayBuffer_init() {
+#ifdef DISPLAY_BUFFER_ENABLED
+  dirtyTileCount = RESET;
+  for (int16_t ty = 0; ty < DISPLAY_BUFFER_TILE_ROWS; ty++)
+    for (int16_t tx = 0; tx < DISPLAY_BUFFER_TILE_COLUMNS; tx++)
+      dirtyTiles[ty][tx] = false;
+  lastFlushCallCount = RESET;
+  cursorX = RESET;
+  cursorY = RESET;
+  fillPixels(0, 0, DISPLAY_BUFFER_WIDTH, DISPLAY_BUFFER_HEIGHT, DISPLAY_BLACK);
+  drawCallCount = RESET;
+#endif
+}
+
+// Fills the whole screen with color.
+void displayBuffer_fillScreen(uint16_t color) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  displayBuffer_fillRect(0, 0, DISPLAY_BUFFER_WIDTH, DISPLAY_BUFFER_HEIGHT,
+                         color);
+#else
+  display_fillScreen(color);
+#endif
+}
+
+// Fills a rectangle with color. Parts outside the screen are clipped.
+void displayBuffer_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  drawCallCount++;
+  fillPixels(x, y, w, h, color);
+#else
+  display_fillRect(x, y, w, h, color);
+#endif
+}
+
+void displayBuffer_setCursor(int16_t x, int16_t y) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  cursorX = x;
+  cursorY = y;
+#else
+  display_setCursor(x, y);
+#endif
+}
+
+void displayBuffer_setTextColor(uint16_t color) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  textColor = color;
+#else
+  display_setTextColor(color);
+#endif
+}
+
+void displayBuffer_setTextSize(uint8_t size) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  textSize = (size > 0) ? size : 1;
+#else
+  display_setTextSize(size);
+#endif
+}
+
+// Draws one character at the cursor and advances it.
+void displayBuffer_printChar(char c) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  if (c != '\n' && c != '\r') // Only moving the cursor costs no call.
+    drawCallCount++;
+  drawChar(c);
+#else
+  display_printChar(c);
+#endif
+}
+
+void displayBuffer_print(const char *text) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  drawCallCount++;
+  while (*text)
+    drawChar(*text++);
+#else
+  display_print(text);
+#endif
+}
+
+void displayBuffer_println(const char *text) {
+  displayBuffer_print(text);
+  displayBuffer_printChar('\n');
+}
+
+void displayBuffer_printDecimalInt(int32_t value) {
+  char text[DECIMAL_BUFFER_SIZE];
+  snprintf(text, DECIMAL_BUFFER_SIZE, "%ld", (long)value);
+  displayBuffer_print(text);
+}
+
+void displayBuffer_printlnDecimalInt(int32_t value) {
+  displayBuffer_printDecimalInt(value);
+  displayBuffer_printChar('\n');
+}
+
+// Sends all dirty tiles to the display. Within each row of tiles, adjacent
+// dirty tiles of a single color go out as one rectangle. A mixed-color tile
+// goes out as a window together with the dirty tiles after it, or as one
+// rectangle per run of pixels without DISPLAY_BUFFER_WINDOW_WRITE_ENABLED.
+void displayBuffer_flush() {
+#ifdef DISPLAY_BUFFER_ENABLED
+  lastFlushCallCount = RESET;
+  for (int16_t ty = 0; ty < DISPLAY_BUFFER_TILE_ROWS; ty++) {
+    int16_t tx = 0;
+    while (tx < DISPLAY_BUFFER_TILE_COLUMNS) {
+      if (!dirtyTiles[ty][tx]) {
+        tx++;
+        continue;
+      }
+      uint16_t color;
+      if (!tileIsUniform(tx, ty, &color)) {
+#ifdef DISPLAY_BUFFER_WINDOW_WRITE_ENABLED
+        int16_t windowStart = tx;
+        do {
+          dirtyTiles[ty][tx++] = false;
+        } while (tx < DISPLAY_BUFFER_TILE_COLUMNS && dirtyTiles[ty][tx]);
+        flushWindow(windowStart, tx, ty);
+#else
+        flushMixedTile(tx, ty);
+        dirtyTiles[ty][tx++] = false;
+#endif
+        continue;
+      }
+      // Extend over the following dirty tiles of the same color.
+      int16_t runStart = tx;
+      uint16_t nextColor;
+      do {
+        dirtyTiles[ty][tx++] = false;
+      } while (tx < DISPLAY_BUFFER_TILE_COLUMNS && dirtyTiles[ty][tx] &&
+               tileIsUniform(tx, ty, &nextColor) && nextColor == color);
+      display_fillRect(runStart * DISPLAY_BUFFER_TILE_SIZE,
+                       ty * DISPLAY_BUFFER_TILE_SIZE,
+                       (tx - runStart) * DISPLAY_BUFFER_TILE_SIZE,
+                       DISPLAY_BUFFER_TILE_SIZE, color);
+      lastFlushCallCount++;
+    }
+  }
+  dirtyTileCount = RESET;
+#endif
+}
+
+// Returns the number of tiles that will be sent by the next flush.
+uint16_t displayBuffer_getDirtyTileCount() {
+#ifdef DISPLAY_BUFFER_ENABLED
+  return dirtyTileCount;
+#else
+  return 0;
+#endif
+}
+
+// Returns the number of display calls made by the last flush.
+uint32_t displayBuffer_getLastFlushCallCount() {
+#ifdef DISPLAY_BUFFER_ENABLED
+  return lastFlushCallCount;
+#else
+  return 0;
+#endif
+}
+
+// Returns the number of drawing calls made since displayBuffer_init().
+uint32_t displayBuffer_getDrawCallCount() {
+#ifdef DISPLAY_BUFFER_ENABLED
+  return drawCallCount;
+#else
+  return 0;
+#endif
+}
+
+// Returns the color of a pixel in the buffer.
+uint16_t displayBuffer_getPixel(int16_t x, int16_t y) {
+#ifdef DISPLAY_BUFFER_ENABLED
+  if (x < 0 || x >= DISPLAY_BUFFER_WIDTH || y < 0 || y >= DISPLAY_BUFFER_HEIGHT)
+    return 0;
+  return pixels[y][x];
+#else
+  return 0;
+#endif
+}
+
+// Checks drawing, clipping, text and dirty tracking with known values.
+#define TEST_COLOR DISPLAY_RED
+#define TEST_TEXT_COLOR DISPLAY_WHITE
+#define TEST_TEXT_SIZE 2
+bool displayBuffer_runTest() {
+  printf("****************** displayBuffer_runTest() ******************\n");
+#ifndef DISPLAY_BUFFER_ENABLED
+  printf("displayBuffer_runTest(): buffer not enabled, nothing to test.\n");
+  return true;
+#else
+  bool success = true;
+  displayBuffer_init();
+  if (displayBuffer_getDirtyTileCount() !=
+      DISPLAY_BUFFER_TILE_ROWS * DISPLAY_BUFFER_TILE_COLUMNS) {
+    printf("displayBuffer_runTest(): init should dirty every tile.\n");
+    success = false;
+  }
+  // A clear black screen goes out as one rectangle per row of tiles.
+  displayBuffer_flush();
+  if (displayBuffer_getLastFlushCallCount() != DISPLAY_BUFFER_TILE_ROWS ||
+      displayBuffer_getDirtyTileCount() != 0) {
+    printf("displayBuffer_runTest(): full-screen flush took %lu calls.\n",
+           (unsigned long)displayBuffer_getLastFlushCallCount());
+    success = false;
+  }
+  // A rectangle hanging off the top-left corner is clipped and dirties only
+  // the tiles it covers.
+  displayBuffer_fillRect(-5, -5, DISPLAY_BUFFER_TILE_SIZE + 10, 10,
+                         TEST_COLOR);
+  if (displayBuffer_getPixel(0, 0) != TEST_COLOR ||
+      displayBuffer_getPixel(DISPLAY_BUFFER_TILE_SIZE + 4, 4) != TEST_COLOR ||
+      displayBuffer_getPixel(DISPLAY_BUFFER_TILE_SIZE + 5, 4) != DISPLAY_BLACK ||
+      displayBuffer_getPixel(0, 5) != DISPLAY_BLACK ||
+      displayBuffer_getDirtyTileCount() != 2) {
+    printf("displayBuffer_runTest(): fillRect clipping or dirty tiles wrong.\n");
+    success = false;
+  }
+  displayBuffer_flush();
+  // Text: 'I' at size 2 has a solid vertical stroke in its middle column.
+  displayBuffer_setTextSize(TEST_TEXT_SIZE);
+  displayBuffer_setTextColor(TEST_TEXT_COLOR);
+  displayBuffer_setCursor(0, DISPLAY_BUFFER_TILE_SIZE);
+  displayBuffer_println("I");
+  if (displayBuffer_getPixel(2 * TEST_TEXT_SIZE,
+                             DISPLAY_BUFFER_TILE_SIZE + 3 * TEST_TEXT_SIZE) !=
+          TEST_TEXT_COLOR ||
+      displayBuffer_getPixel(0, DISPLAY_BUFFER_TILE_SIZE + 3 * TEST_TEXT_SIZE) !=
+          DISPLAY_BLACK) {
+    printf("displayBuffer_runTest(): text rendered incorrectly.\n");
+    success = false;
+  }
+  if (cursorX != 0 ||
+      cursorY != DISPLAY_BUFFER_TILE_SIZE + TEST_TEXT_SIZE * CHAR_CELL_HEIGHT) {
+    printf("displayBuffer_runTest(): println left the cursor at (%d, %d).\n",
+           cursorX, cursorY);
+    success = false;
+  }
+  // One fill and one print so far; the newline is free.
+  if (displayBuffer_getDrawCallCount() != 2) {
+    printf("displayBuffer_runTest(): counted %lu drawing calls, not 2.\n",
+           (unsigned long)displayBuffer_getDrawCallCount());
+    success = false;
+  }
+  displayBuffer_flush();
+#ifdef DISPLAY_BUFFER_WINDOW_WRITE_ENABLED
+  // The letter's tile goes out as one window: set it, then write it.
+  if (displayBuffer_getLastFlushCallCount() != 2) {
+    printf("displayBuffer_runTest(): window flush took %lu calls.\n",
+           (unsigned long)displayBuffer_getLastFlushCallCount());
+    success = false;
+  }
+#endif
+  displayBuffer_setTextSize(1);
+  printf(success ? "displayBuffer_runTest() passed.\n"
+                 : "displayBuffer_runTest() failed.\n");
+  return success;
+#endif
+}
@@ -0,0 +1,97 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYBUFFER_H_
+#define DISPLAYBUFFER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Optional off-screen framebuffer for the TFT. The histogram and the run-time
+// statistics screen draw through the displayBuffer functions below. With the
+// buffer enabled, drawing only touches memory and marks the 16x16 tiles it
+// covers as dirty; displayBuffer_flush() then sends the dirty tiles to the
+// display. Runs of same-colored tiles in a row go out as single rectangles.
+// Runs of mixed-color tiles go out as one window write each with
+// DISPLAY_BUFFER_WINDOW_WRITE_ENABLED. Without it they go out as one rectangle
+// per run of same-colored pixels in each pixel row, which takes far more calls
+// than drawing directly: about 510 instead of 14 per power histogram frame,
+// against 10 with window writes (host/histogramFrames). That fallback is only
+// for comparing on the host; building the buffer for the gun (__arm__)
+// without window writes is an error. With the buffer disabled, each function
+// draws straight to the display as before and displayBuffer_flush() does
+// nothing.
+//
+// Text is rendered with the same 5x7 font, 6x8 character cell and wrapping
+// as the display package.
+
+// Uncomment to render through the framebuffer (150 KB of RAM). Can also be
+// set from the build with -DDISPLAY_BUFFER_ENABLED.
+// #define DISPLAY_BUFFER_ENABLED
+
+// Uncomment to send mixed-color tiles with display_setAddrWindow() once per
+// run of tiles and all of its pixels in one display_writePixels() call. The
+// display package must provide that pair, like setAddrWindow() and
+// writePixels() in the Adafruit ILI9341 driver. The host stand-in has it; the
+// ZYBO display package does not yet, so the gun cannot use the buffer. Can
+// also be set from the build with -DDISPLAY_BUFFER_WINDOW_WRITE_ENABLED. Costs
+// a tile row of pixels (10 KB) for staging.
+// #define DISPLAY_BUFFER_WINDOW_WRITE_ENABLED
+
+#define DISPLAY_BUFFER_WIDTH 320
+#define DISPLAY_BUFFER_HEIGHT 240
+#define DISPLAY_BUFFER_TILE_SIZE 16 // Dirty tracking granularity in pixels.
+#define DISPLAY_BUFFER_TILE_COLUMNS                                            \
+  (DISPLAY_BUFFER_WIDTH / DISPLAY_BUFFER_TILE_SIZE)
+#define DISPLAY_BUFFER_TILE_ROWS                                               \
+  (DISPLAY_BUFFER_HEIGHT / DISPLAY_BUFFER_TILE_SIZE)
+
+// Clears the buffer to black and marks the whole screen dirty.
+void displayBuffer_init();
+
+// Fills the whole screen with color.
+void displayBuffer_fillScreen(uint16_t color);
+
+// Fills a rectangle with color. Parts outside the screen are clipped.
+void displayBuffer_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                            uint16_t color);
+
+// Text functions, with the same behavior as their display_ counterparts.
+void displayBuffer_setCursor(int16_t x, int16_t y);
+void displayBuffer_setTextColor(uint16_t color);
+void displayBuffer_setTextSize(uint8_t size);
+void displayBuffer_print(const char *text);
+void displayBuffer_println(const char *text);
+void displayBuffer_printChar(char c);
+void displayBuffer_printDecimalInt(int32_t value);
+void displayBuffer_printlnDecimalInt(int32_t value);
+
+// Sends all dirty tiles to the display.
+void displayBuffer_flush();
+
+// Returns the number of tiles that will be sent by the next flush.
+uint16_t displayBuffer_getDirtyTileCount();
+
+// Returns the number of display calls made by the last flush.
+uint32_t displayBuffer_getLastFlushCallCount();
+
+// Returns the number of drawing calls (fills and prints) made through
+// displayBuffer since displayBuffer_init(), which is the number of display
+// calls they would take without the buffer.
+uint32_t displayBuffer_getDrawCallCount();
+
+// Returns the color of a pixel in the buffer. Returns 0 if the buffer is not
+// enabled or the pixel is off the screen.
+uint16_t displayBuffer_getPixel(int16_t x, int16_t y);
+
+// Checks drawing, clipping, text and dirty tracking. Returns true if it
+// passes (or if the buffer is not enabled).
+bool displayBuffer_runTest();
+
+#endif /* DISPLAYBUFFER_H_ */
@@ -0,0 +1,148 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DSPCORE_HPP_
+#define DSPCORE_HPP_
+
+// Header-only C++ kernels for the receive chain. Tap counts, channel counts,
+// block sizes and the sample type are template parameters, so every loop has
+// a length known at compile time and each build configuration gets its own
+// unrolled kernels. filterCore.cpp instantiates them for the configuration in
+// filter.h and exports them to C.
+//
+// Sums are taken in the same order as in the queue-based code in filter.c, so
+// the results are the same to the last bit. That keeps the compiler from
+// reassociating them across SIMD lanes; the gain comes from fixed-length loops
+// over plain arrays instead of queue_readElementAt() calls.
+
+namespace dspCore {
+
+// Returns the smallest power of two that is at least n.
+constexpr unsigned ceilPowerOfTwo(unsigned n, unsigned power = 1) {
+  return power >= n ? power : ceilPowerOfTwo(n, 2 * power);
+}
+
+// The newest Capacity values pushed, always readable as one contiguous array.
+// Every value is written twice, ringSize apart, so the window never wraps.
+template <typename Sample, unsigned Capacity> class SlidingWindow {
+public:
+  static constexpr unsigned ringSize = ceilPowerOfTwo(Capacity);
+
+  // Fills the window with value.
+  void fill(Sample value) {
+    for (unsigned i = 0; i < 2 * ringSize; i++)
+      ring[i] = value;
+    next = 0;
+  }
+
+  void push(Sample value) {
+    ring[next] = value;
+    ring[next + ringSize] = value;
+    next = (next + 1) & (ringSize - 1);
+  }
+
+  // Returns the newest count values, oldest first. count <= Capacity.
+  const Sample *newest(unsigned count) const {
+    return &ring[next + ringSize - count];
+  }
+
+private:
+  Sample ring[2 * ringSize];
+  unsigned next; // Where the next value goes.
+};
+
+// Returns the output of a TapCount-tap FIR-filter whose inputs are stored in a
+// circular array of ringSize entries, the oldest at oldest: the layout of a
+// full queue_t. The newest input goes with coefficients[0].
+template <typename Sample, unsigned TapCount>
+inline Sample fir(const Sample ring[], unsigned ringSize, unsigned oldest,
+                  const Sample coefficients[]) {
+  unsigned newest = (oldest + TapCount - 1) % ringSize;
+  // From the newest input back to the start of the array, then from the end
+  // of the array back to the oldest.
+  unsigned firstCount = newest + 1 < TapCount ? newest + 1 : TapCount;
+  Sample y = 0;
+  for (unsigned i = 0; i < firstCount; i++)
+    y += ring[newest - i] * coefficients[i];
+  for (unsigned i = firstCount; i < TapCount; i++)
+    y += ring[newest + ringSize - i] * coefficients[i];
+  return y;
+}
+
+// Converts count ADC codes to samples centred on 0: adcValues[i] * scale - 1.
+template <typename Sample, typename AdcValue>
+inline void scaleAdcValues(const AdcValue adcValues[], Sample scaled[],
+                           unsigned count, Sample scale) {
+  for (unsigned i = 0; i < count; i++)
+    scaled[i] = adcValues[i] * scale - Sample(1);
+}
+
+// Returns sum plus the squares of count values, added oldest first.
+template <typename Sample>
+inline Sample sumOfSquares(const Sample values[], unsigned count, Sample sum) {
+  for (unsigned i = 0; i < count; i++)
+    sum += values[i] * values[i];
+  return sum;
+}
+
+// Runs Interleave IIR-filters side by side over count outputs, so that one
+// filter's arithmetic overlaps the others'. y[] holds the inputs, oldest
+// first, starting CoefficientCount - 1 inputs before the first output. Each
+// z[f] holds filter f's CoefficientCount - 1 previous outputs, oldest first,
+// and the new ones are appended to it.
+template <typename Sample, unsigned CoefficientCount, unsigned Interleave>
+inline void iirInterleaved(const Sample *const b[], const Sample *const a[],
+                           const Sample y[], Sample *const z[],
+                           unsigned count) {
+  const unsigned history = CoefficientCount - 1;
+  for (unsigned n = 0; n < count; n++) {
+    for (unsigned f = 0; f < Interleave; f++) {
+      Sample ySum = 0;
+      Sample zSum = 0;
+      for (unsigned i = 0; i < CoefficientCount; i++)
+        ySum += y[history + n - i] * b[f][i];
+      for (unsigned i = 0; i < history; i++)
+        zSum += z[f][history + n - 1 - i] * a[f][i + 1];
+      z[f][history + n] = ySum - zSum;
+    }
+  }
+}
+
+// Runs the IIR-filters in channelMask (bit i for channel i) over count
+// outputs, in pairs. b, a and z are indexed by channel, as in
+// iirInterleaved().
+template <typename Sample, unsigned ChannelCount, unsigned CoefficientCount,
+          unsigned BlockSize>
+void iirBank(unsigned channelMask, const Sample b[][CoefficientCount],
+             const Sample a[][CoefficientCount], const Sample y[],
+             Sample z[][CoefficientCount - 1 + BlockSize], unsigned count) {
+  static_assert(ChannelCount <= 8 * sizeof(channelMask), "too many channels");
+  const Sample *pairB[2];
+  const Sample *pairA[2];
+  Sample *pairZ[2];
+  unsigned pairCount = 0;
+  for (unsigned channel = 0; channel < ChannelCount; channel++) {
+    if (!(channelMask & (1u << channel)))
+      continue;
+    pairB[pairCount] = b[channel];
+    pairA[pairCount] = a[channel];
+    pairZ[pairCount] = z[channel];
+    if (++pairCount == 2) {
+      iirInterleaved<Sample, CoefficientCount, 2>(pairB, pairA, y, pairZ,
+                                                  count);
+      pairCount = 0;
+    }
+  }
+  if (pairCount)
+    iirInterleaved<Sample, CoefficientCount, 1>(pairB, pairA, y, pairZ, count);
+}
+
+} // namespace dspCore
+
+#endif /* DSPCORE_HPP_ */
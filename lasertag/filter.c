@@ -1,26 +1,21 @@
-
 #include "filter.h"
+#include "filterCore.h"
 #include "filterTest.h"
 #include "queue.h"
+#include <complex.h>
+#include <math.h>
 #include <stdint.h>
+#include <stdio.h>
 
 // DEFINE STATEMENTS
 // filter size of our Z queue for use in IIR filter
-#define FILTER_Z_QUEUE_SIZE 10
-// Our output queue needs to be long enough to support 200 ms of data
-#define FILTER_OUTPUT_QUEUE_SIZE 2000
+#define FILTER_Z_QUEUE_SIZE (FILTER_IIR_COEFFICIENT_COUNT - 1)
 // This is the size of the coefficients for the FIR filter
-#define FILTER_X_QUEUE_SIZE 81
+#define FILTER_X_QUEUE_SIZE FILTER_FIR_COEFFICIENT_COUNT
 // This is the size of the coefficients for the IIR filter
-#define FILTER_Y_QUEUE_SIZE 11
+#define FILTER_Y_QUEUE_SIZE FILTER_IIR_COEFFICIENT_COUNT
 // We will have 10 filters for our 10 player frequency
 #define FILTER_IIR_FILTER_COUNT 10
-// the number of coefficients for the IIR filter for good performance and low
-// computation time
-#define FILTER_IIR_COEFFICIENT_COUNT 11
-// the number of coefficients for the FIR filter for good performance and low
-// computation time
-#define FILTER_FIR_COEF_COUNT 81
 // Used when calculating the power in a computationally friendly manner
 #define FILTER_OLDEST_VALUE_INDEX 0
 // Constant to make sure that we don't iterate over or under the array length
@@ -28,7 +23,7 @@
 // For all of our counts and initializations that start at 0
 #define FILTER_INITIALIZATIONS 0
 // The decimation value for our filters
-#define FILTER_DECIMATION_VALUE 10
+#define FILTER_DECIMATION_VALUE FILTER_FIR_DECIMATION_FACTOR
 // Arbitrary name for x queue initialization
 #define FILTER_X_QUEUE_NAME "xQueue"
 // Arbitrary name for z queue initialization
@@ -37,6 +32,23 @@
 #define FILTER_Y_QUEUE_NAME "yQueue"
 // Arbitrary name for output queue initialization
 #define FILTER_OUTPUT_QUEUE_NAME "outputQueue"
+// Used to design the coefficients
+#define FILTER_HZ_PER_KHZ 1000.0
+#define FILTER_PI 3.14159265358979323846
+#define FILTER_HAMMING_ALPHA 0.54
+#define FILTER_HAMMING_BETA 0.46
+#if FILTER_IIR_BLOCK_SIZE < 1
+#error "FILTER_IIR_BLOCK_SIZE must be at least 1."
+#endif
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+// The CIC filter works on inputs in fixed point. Its registers are allowed to
+// wrap around: the output is still exact as long as it fits in 32 bits, which
+// leaves FILTER_CIC_STAGE_COUNT * log2(FILTER_CIC_DECIMATION_FACTOR) bits of
+// growth (13.3 at 200 kHz) on top of the 16-bit input.
+#define FILTER_CIC_INPUT_SCALE 32768.0
+// Integration steps used to design the compensating FIR-filter.
+#define FILTER_COMPENSATOR_DESIGN_STEPS 512
+#endif
 
 // END DEFINE STATEMENTS
 
@@ -55,151 +67,28 @@ static double prev_power[FILTER_IIR_FILTER_COUNT];
 // Keep track of the oldest value in each of our filters for power calculations
 static double oldest_value[FILTER_IIR_FILTER_COUNT];
 
-// These are the values that we calculated in matlab for our FIR filter
-const static double fir_coeffs[FILTER_FIR_COEF_COUNT] = {
-    6.0546138291252597e-04,  5.2507143315267811e-04,  3.8449091272701525e-04,
-    1.7398667197948182e-04,  -1.1360489934931548e-04, -4.7488111478632532e-04,
-    -8.8813878356223768e-04, -1.3082618178394971e-03, -1.6663618496969908e-03,
-    -1.8755700366336781e-03, -1.8432363328817916e-03, -1.4884258721727399e-03,
-    -7.6225514924622853e-04, 3.3245249132384837e-04,  1.7262548802593762e-03,
-    3.2768418720744217e-03,  4.7744814146589041e-03,  5.9606317814670249e-03,
-    6.5591485566565593e-03,  6.3172870282586493e-03,  5.0516421324586546e-03,
-    2.6926388909554420e-03,  -6.7950808883015244e-04, -4.8141100026888716e-03,
-    -9.2899200683230643e-03, -1.3538595939086505e-02, -1.6891587875325020e-02,
-    -1.8646984919441702e-02, -1.8149697899123560e-02, -1.4875876924586697e-02,
-    -8.5110608557150517e-03, 9.8848931927316319e-04,  1.3360421141947857e-02,
-    2.8033301291042201e-02,  4.4158668590312596e-02,  6.0676486642862550e-02,
-    7.6408062643700314e-02,  9.0166807112971648e-02,  1.0087463525509034e-01,
-    1.0767073207825099e-01,  1.1000000000000000e-01,  1.0767073207825099e-01,
-    1.0087463525509034e-01,  9.0166807112971648e-02,  7.6408062643700314e-02,
-    6.0676486642862550e-02,  4.4158668590312596e-02,  2.8033301291042201e-02,
-    1.3360421141947857e-02,  9.8848931927316319e-04,  -8.5110608557150517e-03,
-    -1.4875876924586697e-02, -1.8149697899123560e-02, -1.8646984919441702e-02,
-    -1.6891587875325020e-02, -1.3538595939086505e-02, -9.2899200683230643e-03,
-    -4.8141100026888716e-03, -6.7950808883015244e-04, 2.6926388909554420e-03,
-    5.0516421324586546e-03,  6.3172870282586493e-03,  6.5591485566565593e-03,
-    5.9606317814670249e-03,  4.7744814146589041e-03,  3.2768418720744217e-03,
-    1.7262548802593762e-03,  3.3245249132384837e-04,  -7.6225514924622853e-04,
-    -1.4884258721727399e-03, -1.8432363328817916e-03, -1.8755700366336781e-03,
-    -1.6663618496969908e-03, -1.3082618178394971e-03, -8.8813878356223768e-04,
-    -4.7488111478632532e-04, -1.1360489934931548e-04, 1.7398667197948182e-04,
-    3.8449091272701525e-04,  5.2507143315267811e-04,  6.0546138291252597e-04};
+// The outputs of the last filter_iirFilterBlock() call, and the outputQueue
+// values they pushed out, for filter_computeBlockPower().
+static double iirBlockOutputs[FILTER_IIR_FILTER_COUNT][FILTER_IIR_BLOCK_SIZE];
+static double iirBlockDroppedOutputs[FILTER_IIR_FILTER_COUNT]
+                                    [FILTER_IIR_BLOCK_SIZE];
+static uint16_t iirBlockCount;
 
-// the a coefficient values for all of our IIR filters
-const static double
-    irr_a_coeffs[FILTER_IIR_FILTER_COUNT][FILTER_IIR_COEFFICIENT_COUNT] = {
-        {1.0000000000000000e+00, -5.9637727070164015e+00,
-         1.9125339333078248e+01, -4.0341474540744180e+01,
-         6.1537466875368850e+01, -7.0019717951472217e+01,
-         6.0298814235238915e+01, -3.8733792862566332e+01,
-         1.7993533279581079e+01, -5.4979061224867740e+00,
-         9.0332828533799758e-01},
-        {1.0000000000000000e+00, -4.6377947119071443e+00,
-         1.3502215749461564e+01, -2.6155952405269733e+01,
-         3.8589668330738299e+01, -4.3038990303252561e+01,
-         3.7812927599537055e+01, -2.5113598088113726e+01,
-         1.2703182701888053e+01, -4.2755083391143351e+00,
-         9.0332828533799880e-01},
-        {1.0000000000000000e+00, -3.0591317915750942e+00,
-         8.6417489609637528e+00, -1.4278790253808847e+01,
-         2.1302268283304311e+01, -2.2193853972079239e+01,
-         2.0873499791105452e+01, -1.3709764520609403e+01,
-         8.1303553577931744e+00, -2.8201643879900549e+00,
-         9.0332828533800102e-01},
-        {1.0000000000000000e+00, -1.4071749185996736e+00,
-         5.6904141470697454e+00, -5.7374718273676182e+00,
-         1.1958028362868873e+01, -8.5435280598354311e+00,
-         1.1717345583835918e+01, -5.5088290876998371e+00,
-         5.3536787286077372e+00, -1.2972519209655511e+00,
-         9.0332828533799414e-01},
-        {1.0000000000000000e+00, 8.2010906117760229e-01, 5.1673756579268595e+00,
-         3.2580350909220881e+00, 1.0392903763919188e+01, 4.8101776408669004e+00,
-         1.0183724507092503e+01, 3.1282000712126705e+00, 4.8615933365571964e+00,
-         7.5604535083144797e-01, 9.0332828533799958e-01},
-        {1.0000000000000000e+00, 2.7080869856154504e+00, 7.8319071217995617e+00,
-         1.2201607990980730e+01, 1.8651500443681595e+01, 1.8758157568004517e+01,
-         1.8276088095998986e+01, 1.1715361303018874e+01, 7.3684394621253357e+00,
-         2.4965418284511847e+00, 9.0332828533800202e-01},
-        {1.0000000000000000e+00, 4.9479835250075892e+00, 1.4691607003177594e+01,
-         2.9082414772101039e+01, 4.3179839108869302e+01, 4.8440791644688836e+01,
-         4.2310703962394300e+01, 2.7923434247706403e+01, 1.3822186510470992e+01,
-         4.5614664160654277e+00, 9.0332828533799781e-01},
-        {1.0000000000000000e+00, 6.1701893352279908e+00, 2.0127225876810371e+01,
-         4.2974193398071797e+01, 6.5958045321253678e+01, 7.5230437667866909e+01,
-         6.4630411355740165e+01, 4.1261591079244354e+01, 1.8936128791950647e+01,
-         5.6881982915180664e+00, 9.0332828533800413e-01},
-        {1.0000000000000000e+00, 7.4092912870072363e+00, 2.6857944460290117e+01,
-         6.1578787811202197e+01, 9.8258255839887241e+01, 1.1359460153696290e+02,
-         9.6280452143026025e+01, 5.9124742025776357e+01, 2.5268527576524200e+01,
-         6.8305064480743090e+00, 9.0332828533800047e-01},
-        {1.0000000000000000e+00, 8.5743055776347727e+00, 3.4306584753117924e+01,
-         8.4035290411037209e+01, 1.3928510844056848e+02, 1.6305115418161668e+02,
-         1.3648147221895837e+02, 8.0686288623300101e+01, 3.2276361903872271e+01,
-         7.9045143816245140e+00, 9.0332828533800180e-01}};
+// The FIR and IIR coefficients. filter_init() designs them for the sample
+// rate and decimation factor in filter.h.
+static double fir_coeffs[FILTER_FIR_COEFFICIENT_COUNT];
+static double irr_a_coeffs[FILTER_IIR_FILTER_COUNT]
+                          [FILTER_IIR_COEFFICIENT_COUNT];
+static double irr_b_coeffs[FILTER_IIR_FILTER_COUNT]
+                          [FILTER_IIR_COEFFICIENT_COUNT];
 
-// the b coefficient values for all of our IIR filters
-const static double
-    irr_b_coeffs[FILTER_IIR_FILTER_COUNT][FILTER_IIR_COEFFICIENT_COUNT] = {
-        {9.0928629159885191e-10, -0.0000000000000000e+00,
-         -4.5464314579942598e-09, -0.0000000000000000e+00,
-         9.0928629159885195e-09, -0.0000000000000000e+00,
-         -9.0928629159885195e-09, -0.0000000000000000e+00,
-         4.5464314579942598e-09, -0.0000000000000000e+00,
-         -9.0928629159885191e-10},
-        {9.0928649199293571e-10, 0.0000000000000000e+00,
-         -4.5464324599646779e-09, 0.0000000000000000e+00,
-         9.0928649199293558e-09, 0.0000000000000000e+00,
-         -9.0928649199293558e-09, 0.0000000000000000e+00,
-         4.5464324599646779e-09, 0.0000000000000000e+00,
-         -9.0928649199293571e-10},
-        {9.0928661994924534e-10, 0.0000000000000000e+00,
-         -4.5464330997462265e-09, 0.0000000000000000e+00,
-         9.0928661994924530e-09, 0.0000000000000000e+00,
-         -9.0928661994924530e-09, 0.0000000000000000e+00,
-         4.5464330997462265e-09, 0.0000000000000000e+00,
-         -9.0928661994924534e-10},
-        {9.0928690782035330e-10, 0.0000000000000000e+00,
-         -4.5464345391017666e-09, 0.0000000000000000e+00,
-         9.0928690782035332e-09, 0.0000000000000000e+00,
-         -9.0928690782035332e-09, 0.0000000000000000e+00,
-         4.5464345391017666e-09, 0.0000000000000000e+00,
-         -9.0928690782035330e-10},
-        {9.0928656639158659e-10, 0.0000000000000000e+00,
-         -4.5464328319579332e-09, 0.0000000000000000e+00,
-         9.0928656639158664e-09, 0.0000000000000000e+00,
-         -9.0928656639158664e-09, 0.0000000000000000e+00,
-         4.5464328319579332e-09, 0.0000000000000000e+00,
-         -9.0928656639158659e-10},
-        {9.0928642816727856e-10, -0.0000000000000000e+00,
-         -4.5464321408363925e-09, -0.0000000000000000e+00,
-         9.0928642816727850e-09, -0.0000000000000000e+00,
-         -9.0928642816727850e-09, -0.0000000000000000e+00,
-         4.5464321408363925e-09, -0.0000000000000000e+00,
-         -9.0928642816727856e-10},
-        {9.0928384644659946e-10, -0.0000000000000000e+00,
-         -4.5464192322329978e-09, -0.0000000000000000e+00,
-         9.0928384644659957e-09, -0.0000000000000000e+00,
-         -9.0928384644659957e-09, -0.0000000000000000e+00,
-         4.5464192322329978e-09, -0.0000000000000000e+00,
-         -9.0928384644659946e-10},
-        {9.0929676163842145e-10, 0.0000000000000000e+00,
-         -4.5464838081921075e-09, 0.0000000000000000e+00,
-         9.0929676163842149e-09, 0.0000000000000000e+00,
-         -9.0929676163842149e-09, 0.0000000000000000e+00,
-         4.5464838081921075e-09, 0.0000000000000000e+00,
-         -9.0929676163842145e-10},
-        {9.0926065346813145e-10, 0.0000000000000000e+00,
-         -4.5463032673406567e-09, 0.0000000000000000e+00,
-         9.0926065346813134e-09, 0.0000000000000000e+00,
-         -9.0926065346813134e-09, 0.0000000000000000e+00,
-         4.5463032673406567e-09, 0.0000000000000000e+00,
-         -9.0926065346813145e-10},
-        {9.0907858587035803e-10, 0.0000000000000000e+00,
-         -4.5453929293517900e-09, 0.0000000000000000e+00,
-         9.0907858587035801e-09, 0.0000000000000000e+00,
-         -9.0907858587035801e-09, 0.0000000000000000e+00,
-         4.5453929293517900e-09, 0.0000000000000000e+00,
-         -9.0907858587035803e-10}};
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+// CIC filter state: the integrators run at the ADC rate, the combs remember
+// their previous input at the CIC output rate.
+static uint32_t cic_integrators[FILTER_CIC_STAGE_COUNT];
+static uint32_t cic_combs[FILTER_CIC_STAGE_COUNT];
+static uint16_t cic_inputCount;
+#endif
 
 // END THE VARIABLES
 
@@ -212,6 +101,14 @@ void initXQueue() {
     // actually put a zero in each location
     queue_overwritePush(&(xQueue), FILTER_INITIALIZATIONS);
   }
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+  // The CIC filter feeds the xQueue, so it starts over too.
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_CIC_STAGE_COUNT; i++) {
+    cic_integrators[i] = FILTER_INITIALIZATIONS;
+    cic_combs[i] = FILTER_INITIALIZATIONS;
+  }
+  cic_inputCount = FILTER_INITIALIZATIONS;
+#endif
 }
 // Initialize Y queue
 void initYQueue() {
@@ -236,6 +133,9 @@ void initOutputQueues() {
       // fill those spots with zeros
       queue_overwritePush(&(outputQueue[i]), FILTER_INITIALIZATIONS);
     }
+    // the power is computed incrementally, so it has to start from zero too
+    prev_power[i] = FILTER_INITIALIZATIONS;
+    oldest_value[i] = FILTER_INITIALIZATIONS;
   }
 }
 
@@ -253,8 +153,128 @@ void initZQueues() {
   }
 }
 
+// Returns the Hamming window for FIR coefficient i.
+static double filter_hammingWindow(int32_t i) {
+  return FILTER_HAMMING_ALPHA -
+         FILTER_HAMMING_BETA *
+             cos(2.0 * FILTER_PI * i /
+                 (FILTER_FIR_COEFFICIENT_COUNT - FILTER_AVOID_OFF_BY_ONE));
+}
+
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+// Returns the gain of the CIC filter at frequency (in Hz), normalized to 1 at
+// DC.
+static double filter_cicGain(double frequency) {
+  double x = FILTER_PI * frequency /
+             (FILTER_SAMPLE_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ);
+  if (x == FILTER_INITIALIZATIONS)
+    return 1.0;
+  return pow(fabs(sin(FILTER_CIC_DECIMATION_FACTOR * x) /
+                  (FILTER_CIC_DECIMATION_FACTOR * sin(x))),
+             FILTER_CIC_STAGE_COUNT);
+}
+
+// Designs the FIR-filter that follows the CIC filter: a lowpass at
+// FILTER_FIR_CUTOFF_FREQUENCY_IN_HZ whose passband rises by the inverse of the
+// CIC droop, with a Hamming window. There is no closed form, so the ideal
+// response is integrated numerically. The coefficients also undo the gain of
+// the CIC filter and its fixed-point input.
+static void filter_designFirCoefficients() {
+  double inputRate = FILTER_FIR_INPUT_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ;
+  double cutoff = FILTER_FIR_CUTOFF_FREQUENCY_IN_HZ / inputRate;
+  double step = cutoff / FILTER_COMPENSATOR_DESIGN_STEPS;
+  double cicGain = FILTER_CIC_INPUT_SCALE *
+                   pow(FILTER_CIC_DECIMATION_FACTOR, FILTER_CIC_STAGE_COUNT);
+  int32_t middle = (FILTER_FIR_COEFFICIENT_COUNT - FILTER_AVOID_OFF_BY_ONE) / 2;
+  for (int32_t i = FILTER_INITIALIZATIONS; i < FILTER_FIR_COEFFICIENT_COUNT;
+       i++) {
+    int32_t n = i - middle;
+    double ideal = FILTER_INITIALIZATIONS;
+    for (uint16_t k = FILTER_INITIALIZATIONS;
+         k < FILTER_COMPENSATOR_DESIGN_STEPS; k++) {
+      double frequency = (k + 0.5) * step; // Midpoint of each step.
+      ideal += cos(2.0 * FILTER_PI * frequency * n) /
+               filter_cicGain(frequency * inputRate);
+    }
+    fir_coeffs[i] = 2.0 * step * ideal * filter_hammingWindow(i) / cicGain;
+  }
+}
+#else
+// Designs the decimating FIR-filter: a sinc lowpass at
+// FILTER_FIR_CUTOFF_FREQUENCY_IN_HZ with a Hamming window.
+static void filter_designFirCoefficients() {
+  double cutoff = FILTER_FIR_CUTOFF_FREQUENCY_IN_HZ /
+                  (FILTER_SAMPLE_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ);
+  int32_t middle = (FILTER_FIR_COEFFICIENT_COUNT - FILTER_AVOID_OFF_BY_ONE) / 2;
+  for (int32_t i = FILTER_INITIALIZATIONS; i < FILTER_FIR_COEFFICIENT_COUNT;
+       i++) {
+    int32_t n = i - middle;
+    double sinc = (n == 0) ? 2.0 * cutoff
+                           : sin(2.0 * FILTER_PI * cutoff * n) / (FILTER_PI * n);
+    fir_coeffs[i] = sinc * filter_hammingWindow(i);
+  }
+}
+#endif
+
+// Designs one IIR filter: a Butterworth bandpass of FILTER_IIR_BANDWIDTH_IN_HZ
+// around the player frequency, mapped to the decimated rate with the bilinear
+// transform. The frequency is rounded to the nearest Hz, as it was for the
+// original MATLAB coefficients.
+static void filter_designIirCoefficients(uint16_t filterNumber) {
+  double sampleRate = FILTER_DECIMATED_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ;
+  double center = round(FILTER_SAMPLE_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ /
+                        filter_frequencyTickTable[filterNumber]);
+  // Prewarp the band edges so that they land in the right place after the
+  // bilinear transform.
+  double twoFs = 2.0 * sampleRate;
+  double low = twoFs * tan(FILTER_PI *
+                           (center - FILTER_IIR_BANDWIDTH_IN_HZ / 2.0) /
+                           sampleRate);
+  double high = twoFs * tan(FILTER_PI *
+                            (center + FILTER_IIR_BANDWIDTH_IN_HZ / 2.0) /
+                            sampleRate);
+  double bandwidth = high - low;
+  double centerSquared = low * high;
+  // Each pole of the analog lowpass prototype becomes two bandpass poles,
+  // which the bilinear transform maps into the z-plane.
+  double complex poles[FILTER_Z_QUEUE_SIZE];
+  double complex gain = pow(bandwidth * twoFs, FILTER_IIR_ORDER);
+  for (uint16_t k = FILTER_INITIALIZATIONS; k < FILTER_IIR_ORDER; k++) {
+    double complex prototype =
+        cexp(I * FILTER_PI * (2 * k + FILTER_IIR_ORDER + 1) /
+             (2 * FILTER_IIR_ORDER));
+    double complex half = prototype * bandwidth / 2.0;
+    double complex root = csqrt(half * half - centerSquared);
+    double complex analog[] = {half + root, half - root};
+    for (uint16_t j = FILTER_INITIALIZATIONS; j < 2; j++) {
+      gain /= twoFs - analog[j];
+      poles[2 * k + j] = (twoFs + analog[j]) / (twoFs - analog[j]);
+    }
+  }
+  // Multiply out the poles to get the A coefficients.
+  double complex a[FILTER_IIR_COEFFICIENT_COUNT] = {1.0};
+  for (uint16_t k = FILTER_INITIALIZATIONS; k < FILTER_Z_QUEUE_SIZE; k++)
+    for (uint16_t j = k + 1; j > FILTER_INITIALIZATIONS; j--)
+      a[j] -= poles[k] * a[j - 1];
+  // The zeros are at z = 1 and z = -1, so B is gain * (1 - z^-2)^order.
+  double binomial = 1.0;
+  for (uint16_t j = FILTER_INITIALIZATIONS; j < FILTER_IIR_COEFFICIENT_COUNT;
+       j++) {
+    irr_a_coeffs[filterNumber][j] = creal(a[j]);
+    irr_b_coeffs[filterNumber][j] = FILTER_INITIALIZATIONS;
+  }
+  for (uint16_t j = FILTER_INITIALIZATIONS; j <= FILTER_IIR_ORDER; j++) {
+    irr_b_coeffs[filterNumber][2 * j] = creal(gain) * binomial;
+    binomial *= -(double)(FILTER_IIR_ORDER - j) / (j + 1);
+  }
+}
+
 // Must call this prior to using any filter functions.
 void filter_init() {
+  // Design the coefficients for the sample rate in filter.h.
+  filter_designFirCoefficients();
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_IIR_FILTER_COUNT; i++)
+    filter_designIirCoefficients(i);
   // Init queues and fill them with 0s.
   initXQueue();       // Call queue_init() on xQueue and fill it with zeros.
   initYQueue();       // Call queue_init() on yQueue and fill it with zeros.
@@ -262,12 +282,31 @@ void filter_init() {
                       // queue with zeros.
   initOutputQueues(); // Call queue_init() all of the outputQueues and fill each
                       // outputQueue with zeros.
+  filterCore_init();  // Zero the FIR outputs kept for block filtering.
 }
 
 // Use this to copy an input into the input queue of the FIR-filter (xQueue).
 void filter_addNewInput(double x) {
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+  // Integrate every input, then comb and push every
+  // FILTER_CIC_DECIMATION_FACTOR inputs. Unsigned arithmetic wraps around
+  // without overflowing.
+  uint32_t value = (uint32_t)(int32_t)(x * FILTER_CIC_INPUT_SCALE);
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_CIC_STAGE_COUNT; i++)
+    value = cic_integrators[i] += value;
+  if (++cic_inputCount < FILTER_CIC_DECIMATION_FACTOR)
+    return;
+  cic_inputCount = FILTER_INITIALIZATIONS;
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_CIC_STAGE_COUNT; i++) {
+    uint32_t previous = cic_combs[i];
+    cic_combs[i] = value;
+    value -= previous;
+  }
+  queue_overwritePush(&xQueue, (int32_t)value);
+#else
   // adds new input to the queues
   queue_overwritePush(&xQueue, x);
+#endif
 }
 
 // Fills a queue with the given fillValue. For example,
@@ -285,16 +324,9 @@ void filter_fillQueue(queue_t *q, double fillValue) {
 // Invokes the FIR-filter. Input is contents of xQueue.
 // Output is returned and is also pushed on to yQueue.
 double filter_firFilter() {
-  // make the value that we will push onto the y queue and return
-  double y = FILTER_INITIALIZATIONS;
-  // cycle through all iterations of the x queue
-  for (uint32_t i = FILTER_INITIALIZATIONS; i < FILTER_FIR_COEF_COUNT; i++) {
-    // perform all the multiplications and sums needed to do perform the
-    // convolution
-    y += queue_readElementAt(&xQueue, FILTER_FIR_COEF_COUNT -
-                                          FILTER_AVOID_OFF_BY_ONE - i) *
-         fir_coeffs[i]; // iteratively adds the (b * input) products.
-  }
+  // convolve the x queue with the coefficients (see filterCore.cpp), which
+  // also keeps the output for filter_iirFilterBlock()
+  double y = filterCore_firFilter(&xQueue, fir_coeffs);
   // push that on the y queue
   queue_overwritePush(&yQueue, y);
   // and the return the value we just pushed on
@@ -337,6 +369,47 @@ double filter_iirFilter(uint16_t filterNumber) {
   return output;
 }
 
+// Runs the IIR filters in channelMask on the newest count FIR outputs, two at
+// a time (see filterCore.cpp).
+void filter_iirFilterBlock(uint16_t channelMask, uint16_t count) {
+  // Each filter's previous outputs, oldest first, followed by the new ones.
+  double z[FILTER_IIR_FILTER_COUNT][FILTER_CORE_IIR_STATE_SIZE];
+  for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT; f++) {
+    if (!(channelMask & (1 << f)))
+      continue;
+    for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_Z_QUEUE_SIZE; i++)
+      z[f][i] = queue_readElementAt(&(zQueue[f]), i);
+  }
+  filterCore_iirFilterBlock(
+      channelMask, (const double(*)[FILTER_IIR_COEFFICIENT_COUNT])irr_b_coeffs,
+      (const double(*)[FILTER_IIR_COEFFICIENT_COUNT])irr_a_coeffs, z, count);
+  for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT; f++) {
+    if (!(channelMask & (1 << f)))
+      continue;
+    // keep what the outputs push out of the output queue for the power
+    for (uint16_t n = FILTER_INITIALIZATIONS; n < count; n++)
+      iirBlockDroppedOutputs[f][n] = queue_readElementAt(&outputQueue[f], n);
+    for (uint16_t n = FILTER_INITIALIZATIONS; n < count; n++) {
+      double output = z[f][FILTER_Z_QUEUE_SIZE + n];
+      queue_overwritePush(&(zQueue[f]), output);
+      queue_overwritePush(&outputQueue[f], output);
+      iirBlockOutputs[f][n] = output;
+    }
+  }
+  iirBlockCount = count;
+}
+
+// Clears the state of IIR filter [filterNumber] and its power, as
+// filter_init() does, so that the filter can restart from silence.
+void filter_resetIirFilter(uint16_t filterNumber) {
+  // zero the filter's own outputs, which it feeds back
+  filter_fillQueue(&(zQueue[filterNumber]), FILTER_INITIALIZATIONS);
+  // and the outputs the power is computed over, along with the power itself
+  filter_fillQueue(&(outputQueue[filterNumber]), FILTER_INITIALIZATIONS);
+  prev_power[filterNumber] = FILTER_INITIALIZATIONS;
+  oldest_value[filterNumber] = FILTER_INITIALIZATIONS;
+}
+
 // Use this to compute the power for values contained in an outputQueue.
 // If force == true, then recompute power by using all values in the
 // outputQueue. This option is necessary so that you can correctly compute power
@@ -357,15 +430,9 @@ double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
   // decide to compute the power values from scratch or use previously computed
   // values
   if (forceComputeFromScratch) {
-    // computing from scratch, cycle through all of the output queue
-    for (uint32_t i = FILTER_INITIALIZATIONS; i < FILTER_OUTPUT_QUEUE_SIZE;
-         i++) {
-      // create a value to save another function call in squaring the values for
-      // the power
-      double value = queue_readElementAt(&(outputQueue[filterNumber]), i);
-      // add up the summed and squared values for the power
-      power += value * value;
-    }
+    // computing from scratch, add up the squares of the whole output queue
+    // (see filterCore.cpp)
+    power = filterCore_sumOfSquares(&(outputQueue[filterNumber]));
     // save the found power as the prev_power, which will also double as the
     // current power
     prev_power[filterNumber] = power;
@@ -393,6 +460,24 @@ double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
   return power;
 }
 
+// Incrementally computes the power after output [outputIndex] of the last
+// filter_iirFilterBlock() call, as filter_computePower() would have.
+double filter_computeBlockPower(uint16_t filterNumber, uint16_t outputIndex) {
+  double newest_value = iirBlockOutputs[filterNumber][outputIndex];
+  double power = prev_power[filterNumber] -
+                 (oldest_value[filterNumber] * oldest_value[filterNumber]) +
+                 (newest_value * newest_value);
+  prev_power[filterNumber] = power;
+  // the next output to go pushed out the next value the block kept, and the
+  // last one left the oldest value in the queue
+  oldest_value[filterNumber] =
+      (outputIndex + FILTER_AVOID_OFF_BY_ONE < iirBlockCount)
+          ? iirBlockDroppedOutputs[filterNumber][outputIndex + 1]
+          : queue_readElementAt(&(outputQueue[filterNumber]),
+                                FILTER_OLDEST_VALUE_INDEX);
+  return power;
+}
+
 // Returns the most recent output power value for the IIR filter.
 double filter_getCurrentPowerValue(uint16_t filterNumber) {
   // returns the current power value is just the last one that we found for that
@@ -446,7 +531,7 @@ const double *filter_getFirCoefficientArray() {
 // Returns the number of FIR coefficients.
 uint32_t filter_getFirCoefficientCount() {
   // return the constant for the FIR
-  return FILTER_FIR_COEF_COUNT;
+  return FILTER_FIR_COEFFICIENT_COUNT;
 }
 // Returns the array of coefficients for a particular filter number.
 const double *filter_getIirACoefficientArray(uint16_t filterNumber) {
@@ -490,3 +575,336 @@ queue_t *filter_getZQueue(uint16_t filterNumber) {
 queue_t *filter_getIirOutputQueue(uint16_t filterNumber) {
   return &outputQueue[filterNumber];
 }
+
+/*********************************************************************************************************
+****************************************** Coefficient Test
+******************************************
+**********************************************************************************************************/
+
+#define FILTER_TEST_MATLAB_TOLERANCE 1.0E-9 // Relative to each coefficient.
+// MATLAB's B coefficients carry up to 0.02% of rounding error in their gain.
+#define FILTER_TEST_MATLAB_B_TOLERANCE 1.0E-3
+#define FILTER_TEST_MAX_CENTER_GAIN_ERROR 1.0E-3
+#define FILTER_TEST_MAX_NEIGHBOR_GAIN 1.0E-2
+#define FILTER_TEST_MIN_FIR_PASSBAND_GAIN 0.9
+#define FILTER_TEST_MAX_FIR_PASSBAND_GAIN 1.1
+#define FILTER_TEST_BLOCK_OUTPUT_COUNT 200
+#define FILTER_TEST_BLOCK_IGNORED_FILTER 3 // Leaves an odd number to pair.
+
+#if FILTER_SAMPLE_FREQUENCY_IN_KHZ == 100 && FILTER_FIR_DECIMATION_FACTOR == 10
+// The coefficients originally calculated in MATLAB for 100 kHz, decimated by
+// 10. filter_runTest() checks the designed ones against them.
+#ifndef FILTER_MULTISTAGE_DECIMATION_ENABLED
+#define FILTER_TEST_MATLAB_FIR_COEFFICIENT_COUNT 81
+static const double
+    filter_testMatlabFirCoefficients[FILTER_TEST_MATLAB_FIR_COEFFICIENT_COUNT] = {
+    6.0546138291252597e-04,  5.2507143315267811e-04,  3.8449091272701525e-04,
+    1.7398667197948182e-04,  -1.1360489934931548e-04, -4.7488111478632532e-04,
+    -8.8813878356223768e-04, -1.3082618178394971e-03, -1.6663618496969908e-03,
+    -1.8755700366336781e-03, -1.8432363328817916e-03, -1.4884258721727399e-03,
+    -7.6225514924622853e-04, 3.3245249132384837e-04,  1.7262548802593762e-03,
+    3.2768418720744217e-03,  4.7744814146589041e-03,  5.9606317814670249e-03,
+    6.5591485566565593e-03,  6.3172870282586493e-03,  5.0516421324586546e-03,
+    2.6926388909554420e-03,  -6.7950808883015244e-04, -4.8141100026888716e-03,
+    -9.2899200683230643e-03, -1.3538595939086505e-02, -1.6891587875325020e-02,
+    -1.8646984919441702e-02, -1.8149697899123560e-02, -1.4875876924586697e-02,
+    -8.5110608557150517e-03, 9.8848931927316319e-04,  1.3360421141947857e-02,
+    2.8033301291042201e-02,  4.4158668590312596e-02,  6.0676486642862550e-02,
+    7.6408062643700314e-02,  9.0166807112971648e-02,  1.0087463525509034e-01,
+    1.0767073207825099e-01,  1.1000000000000000e-01,  1.0767073207825099e-01,
+    1.0087463525509034e-01,  9.0166807112971648e-02,  7.6408062643700314e-02,
+    6.0676486642862550e-02,  4.4158668590312596e-02,  2.8033301291042201e-02,
+    1.3360421141947857e-02,  9.8848931927316319e-04,  -8.5110608557150517e-03,
+    -1.4875876924586697e-02, -1.8149697899123560e-02, -1.8646984919441702e-02,
+    -1.6891587875325020e-02, -1.3538595939086505e-02, -9.2899200683230643e-03,
+    -4.8141100026888716e-03, -6.7950808883015244e-04, 2.6926388909554420e-03,
+    5.0516421324586546e-03,  6.3172870282586493e-03,  6.5591485566565593e-03,
+    5.9606317814670249e-03,  4.7744814146589041e-03,  3.2768418720744217e-03,
+    1.7262548802593762e-03,  3.3245249132384837e-04,  -7.6225514924622853e-04,
+    -1.4884258721727399e-03, -1.8432363328817916e-03, -1.8755700366336781e-03,
+    -1.6663618496969908e-03, -1.3082618178394971e-03, -8.8813878356223768e-04,
+    -4.7488111478632532e-04, -1.1360489934931548e-04, 1.7398667197948182e-04,
+    3.8449091272701525e-04,  5.2507143315267811e-04,  6.0546138291252597e-04};
+#endif
+
+static const double
+    filter_testMatlabIirACoefficients[FILTER_IIR_FILTER_COUNT]
+                                     [FILTER_IIR_COEFFICIENT_COUNT] = {
+        {1.0000000000000000e+00, -5.9637727070164015e+00,
+         1.9125339333078248e+01, -4.0341474540744180e+01,
+         6.1537466875368850e+01, -7.0019717951472217e+01,
+         6.0298814235238915e+01, -3.8733792862566332e+01,
+         1.7993533279581079e+01, -5.4979061224867740e+00,
+         9.0332828533799758e-01},
+        {1.0000000000000000e+00, -4.6377947119071443e+00,
+         1.3502215749461564e+01, -2.6155952405269733e+01,
+         3.8589668330738299e+01, -4.3038990303252561e+01,
+         3.7812927599537055e+01, -2.5113598088113726e+01,
+         1.2703182701888053e+01, -4.2755083391143351e+00,
+         9.0332828533799880e-01},
+        {1.0000000000000000e+00, -3.0591317915750942e+00,
+         8.6417489609637528e+00, -1.4278790253808847e+01,
+         2.1302268283304311e+01, -2.2193853972079239e+01,
+         2.0873499791105452e+01, -1.3709764520609403e+01,
+         8.1303553577931744e+00, -2.8201643879900549e+00,
+         9.0332828533800102e-01},
+        {1.0000000000000000e+00, -1.4071749185996736e+00,
+         5.6904141470697454e+00, -5.7374718273676182e+00,
+         1.1958028362868873e+01, -8.5435280598354311e+00,
+         1.1717345583835918e+01, -5.5088290876998371e+00,
+         5.3536787286077372e+00, -1.2972519209655511e+00,
+         9.0332828533799414e-01},
+        {1.0000000000000000e+00, 8.2010906117760229e-01, 5.1673756579268595e+00,
+         3.2580350909220881e+00, 1.0392903763919188e+01, 4.8101776408669004e+00,
+         1.0183724507092503e+01, 3.1282000712126705e+00, 4.8615933365571964e+00,
+         7.5604535083144797e-01, 9.0332828533799958e-01},
+        {1.0000000000000000e+00, 2.7080869856154504e+00, 7.8319071217995617e+00,
+         1.2201607990980730e+01, 1.8651500443681595e+01, 1.8758157568004517e+01,
+         1.8276088095998986e+01, 1.1715361303018874e+01, 7.3684394621253357e+00,
+         2.4965418284511847e+00, 9.0332828533800202e-01},
+        {1.0000000000000000e+00, 4.9479835250075892e+00, 1.4691607003177594e+01,
+         2.9082414772101039e+01, 4.3179839108869302e+01, 4.8440791644688836e+01,
+         4.2310703962394300e+01, 2.7923434247706403e+01, 1.3822186510470992e+01,
+         4.5614664160654277e+00, 9.0332828533799781e-01},
+        {1.0000000000000000e+00, 6.1701893352279908e+00, 2.0127225876810371e+01,
+         4.2974193398071797e+01, 6.5958045321253678e+01, 7.5230437667866909e+01,
+         6.4630411355740165e+01, 4.1261591079244354e+01, 1.8936128791950647e+01,
+         5.6881982915180664e+00, 9.0332828533800413e-01},
+        {1.0000000000000000e+00, 7.4092912870072363e+00, 2.6857944460290117e+01,
+         6.1578787811202197e+01, 9.8258255839887241e+01, 1.1359460153696290e+02,
+         9.6280452143026025e+01, 5.9124742025776357e+01, 2.5268527576524200e+01,
+         6.8305064480743090e+00, 9.0332828533800047e-01},
+        {1.0000000000000000e+00, 8.5743055776347727e+00, 3.4306584753117924e+01,
+         8.4035290411037209e+01, 1.3928510844056848e+02, 1.6305115418161668e+02,
+         1.3648147221895837e+02, 8.0686288623300101e+01, 3.2276361903872271e+01,
+         7.9045143816245140e+00, 9.0332828533800180e-01}};
+
+static const double
+    filter_testMatlabIirBCoefficients[FILTER_IIR_FILTER_COUNT]
+                                     [FILTER_IIR_COEFFICIENT_COUNT] = {
+        {9.0928629159885191e-10, -0.0000000000000000e+00,
+         -4.5464314579942598e-09, -0.0000000000000000e+00,
+         9.0928629159885195e-09, -0.0000000000000000e+00,
+         -9.0928629159885195e-09, -0.0000000000000000e+00,
+         4.5464314579942598e-09, -0.0000000000000000e+00,
+         -9.0928629159885191e-10},
+        {9.0928649199293571e-10, 0.0000000000000000e+00,
+         -4.5464324599646779e-09, 0.0000000000000000e+00,
+         9.0928649199293558e-09, 0.0000000000000000e+00,
+         -9.0928649199293558e-09, 0.0000000000000000e+00,
+         4.5464324599646779e-09, 0.0000000000000000e+00,
+         -9.0928649199293571e-10},
+        {9.0928661994924534e-10, 0.0000000000000000e+00,
+         -4.5464330997462265e-09, 0.0000000000000000e+00,
+         9.0928661994924530e-09, 0.0000000000000000e+00,
+         -9.0928661994924530e-09, 0.0000000000000000e+00,
+         4.5464330997462265e-09, 0.0000000000000000e+00,
+         -9.0928661994924534e-10},
+        {9.0928690782035330e-10, 0.0000000000000000e+00,
+         -4.5464345391017666e-09, 0.0000000000000000e+00,
+         9.0928690782035332e-09, 0.0000000000000000e+00,
+         -9.0928690782035332e-09, 0.0000000000000000e+00,
+         4.5464345391017666e-09, 0.0000000000000000e+00,
+         -9.0928690782035330e-10},
+        {9.0928656639158659e-10, 0.0000000000000000e+00,
+         -4.5464328319579332e-09, 0.0000000000000000e+00,
+         9.0928656639158664e-09, 0.0000000000000000e+00,
+         -9.0928656639158664e-09, 0.0000000000000000e+00,
+         4.5464328319579332e-09, 0.0000000000000000e+00,
+         -9.0928656639158659e-10},
+        {9.0928642816727856e-10, -0.0000000000000000e+00,
+         -4.5464321408363925e-09, -0.0000000000000000e+00,
+         9.0928642816727850e-09, -0.0000000000000000e+00,
+         -9.0928642816727850e-09, -0.0000000000000000e+00,
+         4.5464321408363925e-09, -0.0000000000000000e+00,
+         -9.0928642816727856e-10},
+        {9.0928384644659946e-10, -0.0000000000000000e+00,
+         -4.5464192322329978e-09, -0.0000000000000000e+00,
+         9.0928384644659957e-09, -0.0000000000000000e+00,
+         -9.0928384644659957e-09, -0.0000000000000000e+00,
+         4.5464192322329978e-09, -0.0000000000000000e+00,
+         -9.0928384644659946e-10},
+        {9.0929676163842145e-10, 0.0000000000000000e+00,
+         -4.5464838081921075e-09, 0.0000000000000000e+00,
+         9.0929676163842149e-09, 0.0000000000000000e+00,
+         -9.0929676163842149e-09, 0.0000000000000000e+00,
+         4.5464838081921075e-09, 0.0000000000000000e+00,
+         -9.0929676163842145e-10},
+        {9.0926065346813145e-10, 0.0000000000000000e+00,
+         -4.5463032673406567e-09, 0.0000000000000000e+00,
+         9.0926065346813134e-09, 0.0000000000000000e+00,
+         -9.0926065346813134e-09, 0.0000000000000000e+00,
+         4.5463032673406567e-09, 0.0000000000000000e+00,
+         -9.0926065346813145e-10},
+        {9.0907858587035803e-10, 0.0000000000000000e+00,
+         -4.5453929293517900e-09, 0.0000000000000000e+00,
+         9.0907858587035801e-09, 0.0000000000000000e+00,
+         -9.0907858587035801e-09, 0.0000000000000000e+00,
+         4.5453929293517900e-09, 0.0000000000000000e+00,
+         -9.0907858587035803e-10}};
+
+// Returns true if every designed coefficient matches the MATLAB one. The
+// compensating FIR-filter behind the CIC filter has no MATLAB counterpart.
+static bool filter_testMatchesMatlab() {
+  double worst = FILTER_INITIALIZATIONS;
+  double worstB = FILTER_INITIALIZATIONS;
+#ifndef FILTER_MULTISTAGE_DECIMATION_ENABLED
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_FIR_COEFFICIENT_COUNT;
+       i++)
+    worst = fmax(worst, fabs(fir_coeffs[i] -
+                             filter_testMatlabFirCoefficients[i]) /
+                            fabs(filter_testMatlabFirCoefficients[i]));
+#endif
+  for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT; f++)
+    for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_IIR_COEFFICIENT_COUNT;
+         i++) {
+      worst = fmax(worst, fabs(irr_a_coeffs[f][i] -
+                               filter_testMatlabIirACoefficients[f][i]) /
+                              fabs(filter_testMatlabIirACoefficients[f][i]));
+      // B is zero at odd indices, where it is compared against its first
+      // value instead.
+      worstB = fmax(worstB,
+                    fabs(irr_b_coeffs[f][i] -
+                         filter_testMatlabIirBCoefficients[f][i]) /
+                        fmax(fabs(filter_testMatlabIirBCoefficients[f][i]),
+                             fabs(filter_testMatlabIirBCoefficients[f][0])));
+    }
+  printf("filter_runTest(): largest difference from the MATLAB coefficients "
+         "is %.2g (%.2g for IIR B).\n",
+         worst, worstB);
+  return worst < FILTER_TEST_MATLAB_TOLERANCE &&
+         worstB < FILTER_TEST_MATLAB_B_TOLERANCE;
+}
+#endif
+
+// Evaluates the gain of a filter with numerator b and denominator a at
+// frequency (in Hz) for the given sample rate. a may be NULL for an FIR.
+static double filter_testGain(const double b[], const double a[],
+                              uint16_t count, double frequency,
+                              double sampleRate) {
+  double complex z = cexp(-I * 2.0 * FILTER_PI * frequency / sampleRate);
+  double complex numerator = FILTER_INITIALIZATIONS;
+  double complex denominator = FILTER_INITIALIZATIONS;
+  double complex zPower = 1.0;
+  for (uint16_t i = FILTER_INITIALIZATIONS; i < count; i++) {
+    numerator += b[i] * zPower;
+    denominator += (a ? a[i] : (i == 0)) * zPower;
+    zPower *= z;
+  }
+  return cabs(numerator / denominator);
+}
+
+// Evaluates the gain of everything ahead of the IIR filters at frequency (in
+// Hz): the FIR-filter, behind the CIC filter if there is one.
+static double filter_testFrontEndGain(double frequency) {
+  double firGain = filter_testGain(
+      fir_coeffs, NULL, FILTER_FIR_COEFFICIENT_COUNT, frequency,
+      FILTER_FIR_INPUT_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ);
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+  firGain *= filter_cicGain(frequency) * FILTER_CIC_INPUT_SCALE *
+             pow(FILTER_CIC_DECIMATION_FACTOR, FILTER_CIC_STAGE_COUNT);
+#endif
+  return firGain;
+}
+
+static uint32_t filter_testRandomState;
+
+// Small LCG so that the test is repeatable. Returns -0.5 to 0.5.
+static double filter_testNoise() {
+  filter_testRandomState = filter_testRandomState * 1664525 + 1013904223;
+  return (double)(filter_testRandomState >> 8) / (1 << 24) - 0.5;
+}
+
+// Filters the same noise with filter_iirFilter() and filter_computePower(),
+// one output at a time, then with filter_iirFilterBlock() and
+// filter_computeBlockPower() in blocks of every size. Returns true if every
+// power value is the same.
+static bool filter_testIirBlock() {
+  static double
+      powers[FILTER_TEST_BLOCK_OUTPUT_COUNT][FILTER_IIR_FILTER_COUNT];
+  uint16_t channelMask =
+      ((1 << FILTER_IIR_FILTER_COUNT) - 1) &
+      ~(1 << FILTER_TEST_BLOCK_IGNORED_FILTER);
+  uint32_t mismatchCount = FILTER_INITIALIZATIONS;
+  for (uint16_t pass = FILTER_INITIALIZATIONS; pass < 2; pass++) {
+    filter_init();
+    filter_testRandomState = 1;
+    uint16_t blockSize = 1;
+    uint16_t pendingCount = FILTER_INITIALIZATIONS;
+    for (uint16_t n = FILTER_INITIALIZATIONS;
+         n < FILTER_TEST_BLOCK_OUTPUT_COUNT; n++) {
+      for (uint16_t i = FILTER_INITIALIZATIONS; i < FILTER_DECIMATION_VALUE;
+           i++)
+        filter_addNewInput(filter_testNoise());
+      filter_firFilter();
+      if (pass == 0) {
+        for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT;
+             f++) {
+          filter_iirFilter(f);
+          powers[n][f] = filter_computePower(f, false, false);
+        }
+        continue;
+      }
+      if (++pendingCount < blockSize)
+        continue;
+      filter_iirFilterBlock(channelMask, pendingCount);
+      for (uint16_t j = FILTER_INITIALIZATIONS; j < pendingCount; j++)
+        for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT;
+             f++)
+          if ((channelMask & (1 << f)) &&
+              filter_computeBlockPower(f, j) !=
+                  powers[n + 1 - pendingCount + j][f])
+            mismatchCount++;
+      pendingCount = FILTER_INITIALIZATIONS;
+      blockSize = blockSize % FILTER_IIR_BLOCK_SIZE + 1;
+    }
+  }
+  filter_init();
+  printf("filter_runTest(): %u block IIR power values differ.\n",
+         mismatchCount);
+  return mismatchCount == 0;
+}
+
+// Checks the designed coefficients. At 100 kHz they must match the original
+// MATLAB ones. At any rate, each IIR filter must pass its own player frequency
+// and reject its neighbors, and the FIR-filter must pass all of them. Block
+// filtering must also give the same power as filtering one output at a time.
+// Returns true if it passes.
+bool filter_runTest() {
+  printf("****************** filter_runTest() ******************\n");
+  filter_init();
+  bool success = true;
+#if FILTER_SAMPLE_FREQUENCY_IN_KHZ == 100 && FILTER_FIR_DECIMATION_FACTOR == 10
+  success &= filter_testMatchesMatlab();
+#endif
+  double sampleRate = FILTER_SAMPLE_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ;
+  double decimatedRate = FILTER_DECIMATED_FREQUENCY_IN_KHZ * FILTER_HZ_PER_KHZ;
+  for (uint16_t f = FILTER_INITIALIZATIONS; f < FILTER_IIR_FILTER_COUNT; f++) {
+    double frequency = sampleRate / filter_frequencyTickTable[f];
+    double firGain = filter_testFrontEndGain(frequency);
+    if (firGain < FILTER_TEST_MIN_FIR_PASSBAND_GAIN ||
+        firGain > FILTER_TEST_MAX_FIR_PASSBAND_GAIN) {
+      printf("filter_runTest(): FIR gain %f at %.0f Hz.\n", firGain, frequency);
+      success = false;
+    }
+    for (uint16_t g = FILTER_INITIALIZATIONS; g < FILTER_IIR_FILTER_COUNT; g++) {
+      double gain = filter_testGain(
+          irr_b_coeffs[f], irr_a_coeffs[f], FILTER_IIR_COEFFICIENT_COUNT,
+          sampleRate / filter_frequencyTickTable[g], decimatedRate);
+      bool passes = (f == g)
+                        ? fabs(gain - 1.0) < FILTER_TEST_MAX_CENTER_GAIN_ERROR
+                        : gain < FILTER_TEST_MAX_NEIGHBOR_GAIN;
+      if (!passes) {
+        printf("filter_runTest(): IIR filter %d has gain %f at the frequency "
+               "of filter %d.\n",
+               f, gain, g);
+        success = false;
+      }
+    }
+  }
+  success &= filter_testIirBlock();
+  printf("filter_runTest() at %d kHz, decimated by %d: %s.\n",
+         FILTER_SAMPLE_FREQUENCY_IN_KHZ, FILTER_FIR_DECIMATION_FACTOR,
+         success ? "passed" : "failed");
+  return success;
+}
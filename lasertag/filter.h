@@ -13,37 +13,127 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "queue.h"
 #include <stdint.h>
 
-#define FILTER_SAMPLE_FREQUENCY_IN_KHZ 100
 #define FILTER_FREQUENCY_COUNT 10
-#define FILTER_FIR_DECIMATION_FACTOR                                           \
-  10 // FIR-filter needs this many new inputs to compute a new output.
+
+// The receive chain is parameterized by the ADC rate and the FIR decimation
+// factor. Both can be overridden from the build, e.g.
+// -DFILTER_SAMPLE_FREQUENCY_IN_KHZ=50 for a battery-powered gun or 200 for a
+// referee receiver. The ISR samples the ADC, so it runs at the same rate.
+// Queue lengths are derived from these, and filter_init() designs the FIR and
+// IIR coefficients for them.
+#ifndef FILTER_SAMPLE_FREQUENCY_IN_KHZ
+#define FILTER_SAMPLE_FREQUENCY_IN_KHZ 100
+#endif
+#ifndef FILTER_FIR_DECIMATION_FACTOR
+// FIR-filter needs this many new inputs to compute a new output. By default
+// the IIR filters always run at 10 kHz.
+#define FILTER_FIR_DECIMATION_FACTOR (FILTER_SAMPLE_FREQUENCY_IN_KHZ / 10)
+#endif
+#define FILTER_DECIMATED_FREQUENCY_IN_KHZ                                      \
+  (FILTER_SAMPLE_FREQUENCY_IN_KHZ / FILTER_FIR_DECIMATION_FACTOR)
+
+// The player frequencies are defined in ticks of a 100 kHz clock, so the rate
+// must be a multiple of 50 kHz for them to stay exact.
+#if FILTER_SAMPLE_FREQUENCY_IN_KHZ < 50 ||                                     \
+    FILTER_SAMPLE_FREQUENCY_IN_KHZ > 200 || FILTER_SAMPLE_FREQUENCY_IN_KHZ % 50
+#error "FILTER_SAMPLE_FREQUENCY_IN_KHZ must be 50, 100, 150 or 200."
+#endif
+// The highest player frequency is 4.2 kHz and the FIR passes up to 5.5 kHz,
+// so the IIR filters need at least 10 kHz.
+#if FILTER_SAMPLE_FREQUENCY_IN_KHZ % FILTER_FIR_DECIMATION_FACTOR ||           \
+    FILTER_DECIMATED_FREQUENCY_IN_KHZ < 10 ||                                  \
+    FILTER_DECIMATED_FREQUENCY_IN_KHZ > 20
+#error "FILTER_FIR_DECIMATION_FACTOR must leave an integer 10-20 kHz rate."
+#endif
+
+// Power is computed over the length of a shot.
+#define FILTER_POWER_WINDOW_MS 200
 #define FILTER_INPUT_PULSE_WIDTH                                               \
-  2000 // This is the width of the pulse you are looking for, in terms of
-       // decimated sample count.
+  (FILTER_POWER_WINDOW_MS *                                                    \
+   FILTER_DECIMATED_FREQUENCY_IN_KHZ) // This is the width of the pulse you
+                                      // are looking for, in terms of
+                                      // decimated sample count.
+#define FILTER_OUTPUT_QUEUE_SIZE FILTER_INPUT_PULSE_WIDTH
+
+// Uncomment to decimate in two stages. A CIC filter, which only adds and
+// subtracts, does most of the decimation at the ADC rate; the FIR-filter then
+// runs at the CIC output rate, compensating the CIC droop and decimating by
+// the remaining FILTER_COMPENSATOR_DECIMATION_FACTOR. Can also be set from the
+// build with -DFILTER_MULTISTAGE_DECIMATION_ENABLED.
+// #define FILTER_MULTISTAGE_DECIMATION_ENABLED
+
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+#define FILTER_CIC_STAGE_COUNT 4
+#define FILTER_COMPENSATOR_DECIMATION_FACTOR 2
+#if FILTER_FIR_DECIMATION_FACTOR % FILTER_COMPENSATOR_DECIMATION_FACTOR
+#error "FILTER_MULTISTAGE_DECIMATION_ENABLED needs an even decimation factor."
+#endif
+#define FILTER_CIC_DECIMATION_FACTOR                                           \
+  (FILTER_FIR_DECIMATION_FACTOR / FILTER_COMPENSATOR_DECIMATION_FACTOR)
+#define FILTER_FIR_INPUT_FREQUENCY_IN_KHZ                                      \
+  (FILTER_SAMPLE_FREQUENCY_IN_KHZ / FILTER_CIC_DECIMATION_FACTOR)
+#else
+#define FILTER_FIR_INPUT_FREQUENCY_IN_KHZ FILTER_SAMPLE_FREQUENCY_IN_KHZ
+#endif
+
+// The FIR-filter spans 0.8 ms whatever its input rate, so that its transition
+// band stays the same width in Hz (81 taps at 100 kHz, 17 taps behind the CIC).
+#define FILTER_FIR_COEFFICIENT_COUNT                                           \
+  (8 * FILTER_FIR_INPUT_FREQUENCY_IN_KHZ / 10 + 1)
+#define FILTER_FIR_CUTOFF_FREQUENCY_IN_HZ 5500
+
+// Each IIR filter is a Butterworth bandpass of this order (10 poles) and this
+// bandwidth, centered on a player frequency.
+#define FILTER_IIR_ORDER 5
+#define FILTER_IIR_COEFFICIENT_COUNT (2 * FILTER_IIR_ORDER + 1)
+#define FILTER_IIR_BANDWIDTH_IN_HZ 50
+
+// detector() runs the IIR filters on this many decimated outputs at a time
+// with filter_iirFilterBlock(), then computes power and looks for a hit after
+// each of them in turn, so a hit is found up to this many outputs late. Set it
+// to 1 to filter each output as it comes.
+#ifndef FILTER_IIR_BLOCK_SIZE
+#define FILTER_IIR_BLOCK_SIZE 8
+#endif
+
+// Converts a count of 100 kHz ticks to ticks of the ADC sample clock.
+#define FILTER_TICKS_FROM_100_KHZ(ticks)                                       \
+  ((ticks)*FILTER_SAMPLE_FREQUENCY_IN_KHZ / 100)
+
 // These are the tick counts that are used to generate the user frequencies.
 // Not used in filter.h but are used to TEST the filter code.
 // Placed here for general access as they are essentially constant throughout
 // the code. The transmitter will also use these.
 static const uint16_t filter_frequencyTickTable[FILTER_FREQUENCY_COUNT] = {
-    68, 58, 50, 44, 38, 34, 30, 28, 26, 24};
+    FILTER_TICKS_FROM_100_KHZ(68), FILTER_TICKS_FROM_100_KHZ(58),
+    FILTER_TICKS_FROM_100_KHZ(50), FILTER_TICKS_FROM_100_KHZ(44),
+    FILTER_TICKS_FROM_100_KHZ(38), FILTER_TICKS_FROM_100_KHZ(34),
+    FILTER_TICKS_FROM_100_KHZ(30), FILTER_TICKS_FROM_100_KHZ(28),
+    FILTER_TICKS_FROM_100_KHZ(26), FILTER_TICKS_FROM_100_KHZ(24)};
 
 // Filtering routines for the laser-tag project.
 // Filtering is performed by a two-stage filter, as described below.
 
 // 1. First filter is a decimating FIR filter with a configurable number of taps
-// and decimation factor.
+// and decimation factor. With FILTER_MULTISTAGE_DECIMATION_ENABLED, a CIC
+// filter in filter_addNewInput() does most of the decimation ahead of it.
 // 2. The output from the decimating FIR filter is passed through a bank of 10
-// IIR filters. The characteristics of the IIR filter are fixed.
+// IIR filters. The characteristics of the IIR filter are fixed, but their
+// coefficients depend on the decimated rate.
 
 /*********************************************************************************************************
 ****************************************** Main Filter Functions
 ******************************************
 **********************************************************************************************************/
 
-// Must call this prior to using any filter functions.
+// Must call this prior to using any filter functions. Designs the coefficients
+// for FILTER_SAMPLE_FREQUENCY_IN_KHZ and FILTER_FIR_DECIMATION_FACTOR.
 void filter_init();
 
 // Use this to copy an input into the input queue of the FIR-filter (xQueue).
+// With FILTER_MULTISTAGE_DECIMATION_ENABLED, the input goes through the CIC
+// filter instead, which pushes one output every FILTER_CIC_DECIMATION_FACTOR
+// inputs.
 void filter_addNewInput(double x);
 
 // Fills a queue with the given fillValue. For example,
@@ -60,6 +150,20 @@ double filter_firFilter();
 // Output is returned and is also pushed onto zQueue[filterNumber].
 double filter_iirFilter(uint16_t filterNumber);
 
+// Runs the IIR filters whose bits are set in channelMask (bit i for filter i)
+// on the newest count outputs of the FIR-filter, count being at most
+// FILTER_IIR_BLOCK_SIZE. Same outputs as count calls to filter_iirFilter()
+// after each FIR output, and they are pushed onto the same queues, but each
+// filter's coefficients and state are loaded once per block rather than once
+// per output, and filters are run in pairs so that one's arithmetic overlaps
+// the other's.
+void filter_iirFilterBlock(uint16_t channelMask, uint16_t count);
+
+// Clears the state of IIR filter [filterNumber] and its power, as
+// filter_init() does, so that the filter can restart from silence after it
+// has not been run for a while.
+void filter_resetIirFilter(uint16_t filterNumber);
+
 // Use this to compute the power for values contained in an outputQueue.
 // If force == true, then recompute power by using all values in the
 // outputQueue. This option is necessary so that you can correctly compute power
@@ -76,6 +180,13 @@ double filter_iirFilter(uint16_t filterNumber);
 double filter_computePower(uint16_t filterNumber, bool forceComputeFromScratch,
                            bool debugPrint);
 
+// Incrementally computes the power of filter [filterNumber] after output
+// [outputIndex] of the last filter_iirFilterBlock() call, as
+// filter_computePower() would have right after that output. Must be called for
+// outputs 0, 1, ... in order, and for all of them, for the power to stay
+// correct; forcing a computation from scratch after the last one also does.
+double filter_computeBlockPower(uint16_t filterNumber, uint16_t outputIndex);
+
 // Returns the last-computed output power value for the IIR filter
 // [filterNumber].
 double filter_getCurrentPowerValue(uint16_t filterNumber);
@@ -139,6 +250,9 @@ queue_t *filter_getZQueue(uint16_t filterNumber);
 // Returns the address of the IIR output-queue for a specific filter-number.
 queue_t *filter_getIirOutputQueue(uint16_t filterNumber);
 
-// void filter_runTest();
+// Checks the designed coefficients against the original MATLAB ones (at
+// 100 kHz) and checks the filter gains at the player frequencies. Returns
+// true if it passes.
+bool filter_runTest();
 
 #endif /* FILTER_H_ */
\ No newline at end of file
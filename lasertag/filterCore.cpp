@@ -0,0 +1,81 @@
+
+#include "filterCore.h"
+#include "dspCore.hpp"
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+#include "dspDispatch.h"
+#endif
+
+// The FIR outputs the IIR-filters read, FILTER_CORE_IIR_STATE_SIZE of them
+// always contiguous.
+static dspCore::SlidingWindow<double, FILTER_CORE_IIR_STATE_SIZE> firOutputs;
+
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+// Looked up once by filterCore_init().
+static const dspDispatch_kernels_t *kernels = &dspDispatch_scalarKernels;
+#endif
+
+// Clears the FIR outputs kept for filterCore_iirFilterBlock().
+void filterCore_init() {
+  firOutputs.fill(0.0);
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+  kernels = dspDispatch_getKernels();
+#endif
+}
+
+// Returns the FIR output for the inputs in xQueue and keeps it.
+double filterCore_firFilter(const queue_t *xQueue,
+                            const double coefficients[]) {
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+  double y = kernels->firFilter(xQueue->data, xQueue->size, xQueue->indexOut,
+                                coefficients);
+#else
+  double y = dspCore::fir<double, FILTER_FIR_COEFFICIENT_COUNT>(
+      xQueue->data, xQueue->size, xQueue->indexOut, coefficients);
+#endif
+  firOutputs.push(y);
+  return y;
+}
+
+// Runs the IIR-filters in channelMask on the newest count FIR outputs.
+void filterCore_iirFilterBlock(uint16_t channelMask,
+                               const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                               const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                               double z[][FILTER_CORE_IIR_STATE_SIZE],
+                               uint16_t count) {
+  const double *y = firOutputs.newest(FILTER_CORE_IIR_HISTORY_SIZE + count);
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+  kernels->iirFilterBank(channelMask, b, a, y, z, count);
+#else
+  dspCore::iirBank<double, FILTER_FREQUENCY_COUNT,
+                   FILTER_IIR_COEFFICIENT_COUNT, FILTER_IIR_BLOCK_SIZE>(
+      channelMask, b, a, y, z, count);
+#endif
+}
+
+// Sets scaled[i] to adcValues[i] * scale - 1.0 for count values.
+void filterCore_scaleAdcValues(const isr_AdcValue_t adcValues[],
+                               double scaled[], uint32_t count, double scale) {
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+  kernels->scaleAdcValues(adcValues, scaled, count, scale);
+#else
+  dspCore::scaleAdcValues(adcValues, scaled, count, scale);
+#endif
+}
+
+// Returns the sum of the squares of the values in queue, oldest first.
+double filterCore_sumOfSquares(const queue_t *queue) {
+  // From the oldest value to the end of the array, then from its start.
+  unsigned firstCount = queue->size - queue->indexOut;
+  if (firstCount > queue->elementCount)
+    firstCount = queue->elementCount;
+  unsigned secondCount = queue->elementCount - firstCount;
+#ifdef FILTER_CORE_DISPATCH_ENABLED
+  double sum =
+      kernels->sumOfSquares(queue->data + queue->indexOut, firstCount, 0.0);
+  return kernels->sumOfSquares(queue->data, secondCount, sum);
+#else
+  double sum = dspCore::sumOfSquares(queue->data + queue->indexOut, firstCount,
+                                     0.0);
+  return dspCore::sumOfSquares(queue->data, secondCount, sum);
+#endif
+}
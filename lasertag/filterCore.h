@@ -0,0 +1,65 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERCORE_H_
+#define FILTERCORE_H_
+
+#include "filter.h"
+#include "isr.h"
+#include "queue.h"
+#include <stdint.h>
+
+// The kernels behind filter.c, instantiated from the templates in dspCore.hpp
+// for the configuration in filter.h. Only filter.c calls these; everything
+// else keeps using the filter.h API.
+//
+// The host build defines FILTER_CORE_DISPATCH_ENABLED, and then these call the
+// kernels host/dspDispatch.h picks for the CPU instead of the templates.
+
+// The previous outputs an IIR-filter needs, followed by room for a block of
+// new ones.
+#define FILTER_CORE_IIR_HISTORY_SIZE (FILTER_IIR_COEFFICIENT_COUNT - 1)
+#define FILTER_CORE_IIR_STATE_SIZE                                             \
+  (FILTER_CORE_IIR_HISTORY_SIZE + FILTER_IIR_BLOCK_SIZE)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Clears the FIR outputs kept for filterCore_iirFilterBlock().
+void filterCore_init();
+
+// Returns the FIR output for the inputs in xQueue, which must be full, and
+// keeps it for filterCore_iirFilterBlock(). Reads the queue's storage
+// directly, in the layout described in queue.h.
+double filterCore_firFilter(const queue_t *xQueue, const double coefficients[]);
+
+// Runs the IIR-filters in channelMask (bit i for filter i) on the newest count
+// FIR outputs, count being at most FILTER_IIR_BLOCK_SIZE. z[i] holds filter
+// i's FILTER_CORE_IIR_HISTORY_SIZE previous outputs, oldest first; the count
+// new ones are written after them.
+void filterCore_iirFilterBlock(uint16_t channelMask,
+                               const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                               const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                               double z[][FILTER_CORE_IIR_STATE_SIZE],
+                               uint16_t count);
+
+// Sets scaled[i] to adcValues[i] * scale - 1.0 for count values.
+void filterCore_scaleAdcValues(const isr_AdcValue_t adcValues[],
+                               double scaled[], uint32_t count, double scale);
+
+// Returns the sum of the squares of the values in queue, oldest first. Reads
+// the queue's storage directly, like filterCore_firFilter().
+double filterCore_sumOfSquares(const queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FILTERCORE_H_ */
@@ -613,7 +613,8 @@ bool filterTest_runFirAlignmentTest(bool printMessageFlag) {
   }
   bool success = true;                           // Be optimistic.
   filterTest_fillQueue(filter_getXQueue(), 0.0); // zero-out the xQueue.
-  filter_addNewInput(1.0); // Place a single 1.0 in the xQueue.
+  queue_overwritePush(filter_getXQueue(),
+                      1.0); // Place a single 1.0 in the xQueue.
   for (uint32_t i = 0; i < filter_getFirCoefficientCount();
        i++) { // Push the single 1.0 through the queue.
     double firValue = filter_firFilter(); // Run the FIR filter.
@@ -629,7 +630,8 @@ bool filterTest_runFirAlignmentTest(bool printMessageFlag) {
              "not match test-data(%20.24le).\n",
              firValue, firGoldenOutput);
     }
-    filter_addNewInput(
+    queue_overwritePush(
+        filter_getXQueue(),
         0.0); // Shift the 1.0 value over one position in the queue.
   }
   // Print informational messages.
@@ -659,7 +661,8 @@ bool filterTest_runFirArithmeticTest(bool printMessageFlag) {
   for (uint32_t i = 0; i < filter_getFirCoefficientCount();
        i++) { // Loop enough times to go through the coefficients.
     double newTestInput = 1.0;            // Only value in the xQueue is 1.0.
-    filter_addNewInput(newTestInput);     // Add a 1.0 in the xQueue.
+    queue_overwritePush(filter_getXQueue(),
+                        newTestInput);    // Add a 1.0 in the xQueue.
     double firValue = filter_firFilter(); // Run the FIR filter.
     firGoldenOutput +=
         newTestInput *
@@ -859,7 +862,7 @@ double filterTest_computeGoldenPowerValue(queue_t *q) {
 #define TEST_PASS_EPSILON 10E-11 // Should be in this range.
 #define TEST_INCREMENTAL_LOOP_COUNT                                            \
   3000 // Loop over the incremental test this many times.
-#define OUTPUT_QUEUE_SIZE 2000
+#define OUTPUT_QUEUE_SIZE FILTER_OUTPUT_QUEUE_SIZE
 bool filterTest_runPowerTest() {
   bool firstComputeStatus = true; // Be optimistic.
   filter_init();
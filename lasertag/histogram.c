@@ -9,6 +9,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include "histogram.h"
 #include "display.h"
+#include "displayBuffer.h"
 #include "filter.h"
 #include "utils.h"
 #include <stdbool.h>
@@ -25,17 +26,22 @@ static uint16_t topLabelMaxWidthInChars; // How many chars will be printed.
 static histogram_data_t
     currentBarData[HISTOGRAM_MAX_BAR_COUNT]; // Current histogram data.
 static histogram_data_t
-    previousBarData[HISTOGRAM_MAX_BAR_COUNT]; // Keep the old stuff around so
-                                              // you can erase things properly.
+    drawnBarData[HISTOGRAM_MAX_BAR_COUNT]; // Height that is on the display, so
+                                           // only the difference is drawn.
 static char
     topLabel[HISTOGRAM_MAX_BAR_COUNT]
             [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Labels at top of
                                                           // histogram bars.
-static char
-    oldTopLabel[HISTOGRAM_MAX_BAR_COUNT]
-               [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Old label so you
-                                                             // only update as
-                                                             // necessary.
+// Labels that are on the display.
+static char drawnTopLabel[HISTOGRAM_MAX_BAR_COUNT]
+                         [HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS];
+
+// The plot functions keep the value each top label was formatted from, so
+// the snprintf() is skipped when the value has not changed.
+static double labelPowerValues[FILTER_FREQUENCY_COUNT];
+static bool labelPowerValueValid[FILTER_FREQUENCY_COUNT];
+static uint16_t labelHitCounts[FILTER_FREQUENCY_COUNT];
+static bool labelHitCountValid[FILTER_FREQUENCY_COUNT];
 
 #define ONE_HALF(x) ((x) / 2) // Integer divide by 2.
 
@@ -79,15 +85,16 @@ void histogram_drawBottomLabels() {
   uint16_t labelOffset =
       ONE_HALF(histogram_barWidth -
                (DISPLAY_CHAR_WIDTH *
-                HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE));      // Center the label.
-  display_setTextSize(HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE); // Set the text-size.
-  for (int i = 0; i < histogram_barCount; i++) {         //
-    display_setCursor(
+                HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE)); // Center the label.
+  // Set the text-size.
+  displayBuffer_setTextSize(HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE);
+  for (int i = 0; i < histogram_barCount; i++) {
+    displayBuffer_setCursor(
         i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) + labelOffset,
         display_height() -
             (DISPLAY_CHAR_HEIGHT * HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE));
-    display_setTextColor(histogram_barColors[i]);
-    display_print(histogram_label[i]);
+    displayBuffer_setTextColor(histogram_barColors[i]);
+    displayBuffer_print(histogram_label[i]);
   }
 }
 
@@ -99,7 +106,8 @@ void histogram_init(uint16_t barCount) {
            histogram_barCount, HISTOGRAM_MAX_BAR_COUNT);
     exit(0);
   }
-  display_init(); // Init the display package.
+  display_init();       // Init the display package.
+  displayBuffer_init(); // Drawing goes through the buffer if it is enabled.
   histogram_barWidth =
       (display_width() / histogram_barCount) - HISTOGRAM_BAR_X_GAP;
   topLabelMaxWidthInChars =
@@ -115,9 +123,13 @@ void histogram_init(uint16_t barCount) {
           : HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS - 1;
   for (int i = 0; i < histogram_barCount; i++) {
     currentBarData[i] = 0;
-    previousBarData[i] = 0;
-    topLabel[i][0] = 0;    // Start out with empty strings.
-    oldTopLabel[i][0] = 0; // Start out with empty strings.
+    drawnBarData[i] = 0;
+    topLabel[i][0] = 0;      // Start out with empty strings.
+    drawnTopLabel[i][0] = 0; // Start out with empty strings.
+  }
+  for (int i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    labelPowerValueValid[i] = false; // Format every label the first time.
+    labelHitCountValid[i] = false;
   }
   for (int i = 0; i < HISTOGRAM_MAX_BAR_COUNT; i++) {
     strncpy(histogram_label[i], histogram_defaultLabel[i],
@@ -125,19 +137,22 @@ void histogram_init(uint16_t barCount) {
     histogram_barColors[i] = histogram_defaultBarColors[i];
     histogram_barTopLabelColors[i] = histogram_defaultBarTopLabelColors[i];
   }
-  display_fillScreen(DISPLAY_BLACK);
+  displayBuffer_fillScreen(DISPLAY_BLACK);
   histogram_drawBottomLabels();
+  displayBuffer_flush();
   initFlag = true;
 }
 
 // Simply erases all of the pixels in the label area under the histogram bars
 // and redraws the labels.
 void histogram_redrawBottomLabels() {
-  display_fillRect(0,
-                   display_height() -
-                       (DISPLAY_CHAR_HEIGHT * HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE),
-                   display_width(), display_height(), DISPLAY_BLACK);
+  displayBuffer_fillRect(
+      0,
+      display_height() -
+          (DISPLAY_CHAR_HEIGHT * HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE),
+      display_width(), display_height(), DISPLAY_BLACK);
   histogram_drawBottomLabels();
+  displayBuffer_flush();
 }
 
 // This function only updates the data for the histogram.
@@ -166,29 +181,15 @@ bool histogram_setBarData(histogram_index_t barIndex, histogram_data_t data,
            data, HISTOGRAM_MAX_BAR_DATA_IN_PIXELS - 1, barIndex);
     return false;
   }
-  // If it has changed, update the data in the array but don't render anything
-  // on the display.
-  if (data !=
-      currentBarData[barIndex]) { // Only modify the data if it has changed.
-    previousBarData[barIndex] =
-        currentBarData[barIndex]; // Save the old data so you render things
-                                  // properly.
-    // Copy the old string so that you can render things properly.
-    currentBarData[barIndex] = data; // Store the data because it changed.
-  }
-  // If the label has changed, move the previous data to old, new data to
-  // current. Labels are handled separately from data because the label may
-  // change even if the underlying bar data does not. This allows the top label
-  // to change and to be redrawn even if the bars stay the same height.
+  // Update the data in the array but don't render anything on the display.
+  // histogram_updateDisplay() compares it with what was last drawn.
+  currentBarData[barIndex] = data;
+  // Labels are handled separately from data because the label may change even
+  // if the underlying bar data does not. This allows the top label to change
+  // and to be redrawn even if the bars stay the same height.
   if (strncmp(barTopLabel, topLabel[barIndex],
               HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
     // If you get here, the new label is different from the last one.
-    strncpy(oldTopLabel[barIndex], topLabel[barIndex],
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the current label to become the new old label.
-    strncpy(topLabel[barIndex], barTopLabel,
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the new label to become the current label.
     uint16_t barTopLabelLength =
         strlen(barTopLabel); // Get the length of the label.
     // Only copy as many characters as will fit in the available screen space.
@@ -204,39 +205,55 @@ bool histogram_setBarData(histogram_index_t barIndex, histogram_data_t data,
 }
 
 // Internal helper function.
-// Erases the old text (using a fillRect because it is small and fast) to erase
-// the old label, if required. Finds the position for the label, just above the
-// top of the bar.
+// Erases the label drawn above a bar of the given height. Uses a fillRect
+// because the rect is small and should be faster than hitting individual label
+// pixels.
+static void histogram_eraseTopLabel(uint16_t barIndex, histogram_data_t data) {
+  displayBuffer_fillRect(barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
+                         display_height() - data - HISTOGRAM_BAR_Y_GAP -
+                             DISPLAY_CHAR_HEIGHT - 1,
+                         histogram_barWidth, DISPLAY_CHAR_HEIGHT,
+                         DISPLAY_BLACK);
+}
+
+// Internal helper function.
+// Erases the old text to erase the old label, if required. Finds the position
+// for the label, just above the top of the bar.
 void histogram_drawTopLabel(uint16_t barIndex, histogram_data_t data,
                             const char topLabel[], bool eraseOldLabel) {
-  if (eraseOldLabel) {
-    // Erase with a fillRect because the rect is small and should be faster than
-    // hitting individual label pixels.
-    display_fillRect(barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                     display_height() - data - HISTOGRAM_BAR_Y_GAP -
-                         DISPLAY_CHAR_HEIGHT - 1,
-                     histogram_barWidth, DISPLAY_CHAR_HEIGHT, DISPLAY_BLACK);
-  }
+  if (eraseOldLabel)
+    histogram_eraseTopLabel(barIndex, data);
   uint16_t topLabelXOffset = ONE_HALF(
       histogram_barWidth -
       (strlen(topLabel) *
        DISPLAY_CHAR_WIDTH)); // This helps to center the label over the bar.
-  display_setCursor(
+  displayBuffer_setCursor(
       barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) +
           topLabelXOffset, // This is the location of the top label.
       display_height() - data - HISTOGRAM_BAR_Y_GAP - DISPLAY_CHAR_HEIGHT - 1);
-  display_setTextSize(TOP_LABEL_TEXT_SIZE); // Use tiny text to pack more
-                                            // characters into the label.
-  display_setTextColor(
+  displayBuffer_setTextSize(TOP_LABEL_TEXT_SIZE); // Use tiny text to pack more
+                                                  // characters into the label.
+  displayBuffer_setTextColor(
       histogram_barTopLabelColors[barIndex]); // Set the color of the label.
-  display_print(topLabel);                    // Draw the label.
+  displayBuffer_print(topLabel);              // Draw the label.
+}
+
+// Internal helper function.
+// Returns the top row of a bar of the given height. A bar covers the rows from
+// here down to, but not including, the row just above the bottom labels.
+static int16_t histogram_barTopRow(histogram_data_t data) {
+  if (data == 0) // An empty bar covers no rows.
+    return display_height() - HISTOGRAM_BAR_Y_GAP - 1;
+  return display_height() - HISTOGRAM_BAR_Y_GAP - data;
 }
 
 // This updates the display.
-// It loops across all bars, checking:
-// If the height of the bar has changed, redraw both the bar and the top label.
+// Only what differs from the last update is drawn. For each bar:
+// If the height of the bar has changed, erase the old top label, then fill
+// just the rows between the old and new bar tops: in the bar color if it grew,
+// in black if it shrank. Then draw the top label at its new position.
 // If the height of the bar has not changed, but the top label has changed,
-// update the label.
+// redraw the label in place.
 void histogram_updateDisplay() {
   if (!initFlag) {
     printf("Error! histogram_displayUpdate(): must call histogram_init() "
@@ -244,44 +261,40 @@ void histogram_updateDisplay() {
     return;
   }
   for (int i = 0; i < histogram_barCount; i++) {
-    histogram_data_t oldData = previousBarData[i]; // Get the previous data.
-    histogram_data_t data = currentBarData[i];     // Get the current bar data.
-    if (oldData !=
-        data) { // If the are not equal, redraw the bar and the top-label.
-      // Erase the old bar and extend the erase rectangle to include the
-      // top-label so that everything is erased at once. Also, redraw the top
-      // label.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - oldData - HISTOGRAM_BAR_Y_GAP -
-                           DISPLAY_CHAR_HEIGHT - 1,
-                       histogram_barWidth, oldData + DISPLAY_CHAR_HEIGHT + 1,
-                       DISPLAY_BLACK);
-      // Draw the new bar.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - data - HISTOGRAM_BAR_Y_GAP,
-                       histogram_barWidth, data - 1, histogram_barColors[i]);
-      if (data != 0) { // Only draw the top label if the bar-data != 0.
+    histogram_data_t drawnData = drawnBarData[i]; // What is on the display.
+    histogram_data_t data = currentBarData[i];    // Get the current bar data.
+    bool labelChanged = strncmp(topLabel[i], drawnTopLabel[i],
+                                HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
+    if (drawnData != data) {
+      uint16_t x = i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP);
+      if (drawnData != 0) // The label moves with the top of the bar.
+        histogram_eraseTopLabel(i, drawnData);
+      int16_t drawnTop = histogram_barTopRow(drawnData);
+      int16_t top = histogram_barTopRow(data);
+      if (data > drawnData) // Grow: draw only the new part of the bar.
+        displayBuffer_fillRect(x, top, histogram_barWidth, drawnTop - top,
+                               histogram_barColors[i]);
+      else // Shrink: erase only the part of the bar that went away.
+        displayBuffer_fillRect(x, drawnTop, histogram_barWidth, top - drawnTop,
+                               DISPLAY_BLACK);
+      if (data != 0) // Only draw the top label if the bar-data != 0.
         histogram_drawTopLabel(i, data, topLabel[i],
-                               false); // false means that the old label does
-                                       // not need to be erased.
-        previousBarData[i] = currentBarData[i]; // Old data and new data are the
-                                                // same after the update.
-        // Old label and new label are the same after the update.
-        strncpy(oldTopLabel[i], topLabel[i],
-                HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-      }
-    } else if ((data != 0) &&
-               strncmp(topLabel[i], oldTopLabel[i],
-                       HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
+                               false); // Already erased above.
+      drawnBarData[i] = data;
+    } else if ((data != 0) && labelChanged) {
       histogram_drawTopLabel(
           i, data, topLabel[i],
           true); // True means that the old label needs to be erased.
-      // After the update, copy the label to old data so that it won't reupdate
-      // until the next change.
-      strncpy(oldTopLabel[i], topLabel[i],
-              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
+    } else {
+      continue; // Nothing changed, nothing to draw.
     }
+    // After the update, copy the label so that it won't redraw until the next
+    // change.
+    if (labelChanged)
+      strncpy(drawnTopLabel[i], topLabel[i],
+              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
   }
+  displayBuffer_flush(); // Send everything that changed at once.
 }
 
 // Set the bar-color for each bar. This overwrites the defaults. Call
@@ -382,12 +395,21 @@ void histogram_plotUserFrequencyPower(double powerValues[]) {
     // You can have a dynamic label at the top of the bar.
     char label[HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Get a buffer for
                                                             // the label.
-    // Create the label, based upon the actual power value.
-    if (snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%0.0e",
-                 powerValues[i]) == -1)
-      printf("Error: snprintf encountered an error during conversion.\n");
-    // Pull out the 'e' from the exponent to make better use of your characters.
-    trimLabel(label);
+    if (labelPowerValueValid[i] && powerValues[i] == labelPowerValues[i]) {
+      // Same value as last time, so the label is too. Skip the formatting.
+      snprintf(label, sizeof(label), "%s", topLabel[i]);
+    } else {
+      // Create the label, based upon the actual power value.
+      if (snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%0.0e",
+                   powerValues[i]) == -1)
+        printf("Error: snprintf encountered an error during conversion.\n");
+      // Pull out the 'e' from the exponent to make better use of your
+      // characters.
+      trimLabel(label);
+      labelPowerValues[i] = powerValues[i];
+      labelPowerValueValid[i] = true;
+      labelHitCountValid[i] = false; // The label no longer shows a count.
+    }
     // Have the bar value and the label, send the data to the histogram.
     if (!histogram_setBarData(i, histogramBarValue, label)) {
       // If returns false, histogram_setBarData() is not happy. Print out some
@@ -435,14 +457,22 @@ void histogram_plotUserHits(uint16_t hitCounts[]) {
        i++) { // Iterate through the results for each channel.
     char label[HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS]; // Get a buffer for
                                                             // the label.
-    // Create the label, based upon the actual power value.
-    if (snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%d",
-                 hitCounts[i]) == -1)
-      printf("Error: snprintf encountered an error during conversion.\n");
+    if (labelHitCountValid[i] && hitCounts[i] == labelHitCounts[i]) {
+      // Same count as last time, so the label is too. Skip the formatting.
+      snprintf(label, sizeof(label), "%s", topLabel[i]);
+    } else {
+      // Create the label, based upon the actual hit count.
+      if (snprintf(label, HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS, "%d",
+                   hitCounts[i]) == -1)
+        printf("Error: snprintf encountered an error during conversion.\n");
+      labelHitCounts[i] = hitCounts[i];
+      labelHitCountValid[i] = true;
+      labelPowerValueValid[i] = false; // The label no longer shows a power.
+    }
     histogram_setBarData(
         i, normalizedHitValues[i] * HISTOGRAM_MAX_BAR_DATA_IN_PIXELS, label);
-    histogram_updateDisplay(); // Redraw the histogram.
   }
+  histogram_updateDisplay(); // Redraw the histogram once for all bars.
 }
 
 // Normalizes the values in the array argument.
@@ -8,7 +8,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
-#define COUNT_MAX 50000
+#define COUNT_MAX HIT_LED_TIMER_EXPIRE_VALUE
 #define LED_ON 1
 #define LED_OFF 0
 #define LED_PIN_NUM 11
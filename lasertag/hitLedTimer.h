@@ -10,14 +10,15 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef HITLEDTIMER_H_
 #define HITLEDTIMER_H_
 
+#include "isr.h"
 #include <stdbool.h>
 
 // The lockoutTimer is active for 1/2 second once it is started.
 // It is used to lock-out the detector once a hit has been detected.
 // This ensure that only one hit is detected per 1/2-second interval.
 
-#define HIT_LED_TIMER_EXPIRE_VALUE 50000 // Defined in terms of 100 kHz ticks.
-#define HIT_LED_TIMER_OUTPUT_PIN 11      // JF-3
+#define HIT_LED_TIMER_EXPIRE_VALUE (500 * ISR_TICKS_PER_MS) // 1/2 second.
+#define HIT_LED_TIMER_OUTPUT_PIN 11                         // JF-3
 
 // Calling this starts the timer.
 void hitLedTimer_start();
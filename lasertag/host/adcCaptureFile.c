@@ -0,0 +1,146 @@
+// Memory-mapped reader for ADC captures. See adcCaptureFile.h.
+
+#include "adcCaptureFile.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ADC_CAPTURE_FILE_MAGIC "LTAC"
+#define ADC_CAPTURE_FILE_CHUNK_MAGIC "LTCK"
+#define ADC_CAPTURE_FILE_MAGIC_SIZE 4
+
+// Returns the offset of the next occurrence of magic at or after offset, or
+// size if there is none.
+static size_t adcCaptureFile_find(const uint8_t data[], size_t size,
+                                  size_t offset, const char *magic) {
+  while (offset + ADC_CAPTURE_FILE_MAGIC_SIZE <= size) {
+    const uint8_t *next = memchr(data + offset, magic[0],
+                                 size - offset - ADC_CAPTURE_FILE_MAGIC_SIZE + 1);
+    if (next == NULL)
+      break;
+    offset = next - data;
+    if (!memcmp(next, magic, ADC_CAPTURE_FILE_MAGIC_SIZE))
+      return offset;
+    offset++;
+  }
+  return size;
+}
+
+// Maps a capture and reads its header. Prints the reason and returns false if
+// it is not a capture.
+bool adcCaptureFile_open(const char *fileName, adcCaptureFile_t *file) {
+  memset(file, 0, sizeof(*file));
+  int fd = open(fileName, O_RDONLY);
+  if (fd < 0) {
+    perror(fileName);
+    return false;
+  }
+  struct stat status;
+  if (fstat(fd, &status) < 0 || status.st_size == 0) {
+    fprintf(stderr, "%s: empty or unreadable.\n", fileName);
+    close(fd);
+    return false;
+  }
+  void *data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // The mapping keeps the file open.
+  if (data == MAP_FAILED) {
+    perror(fileName);
+    return false;
+  }
+  // Chunks are read once, front to back.
+  madvise(data, status.st_size, MADV_SEQUENTIAL);
+  file->data = data;
+  file->size = status.st_size;
+  // Skip any console text before the header.
+  for (size_t offset = 0;
+       (offset = adcCaptureFile_find(file->data, file->size, offset,
+                                     ADC_CAPTURE_FILE_MAGIC)) < file->size;
+       offset++) {
+    if (offset + ADC_CAPTURE_HEADER_SIZE <= file->size &&
+        adcCapture_readHeader(file->data + offset, &file->header)) {
+      file->headerOffset = offset;
+      return true;
+    }
+  }
+  fprintf(stderr, "%s: no capture header found.\n", fileName);
+  adcCaptureFile_close(file);
+  return false;
+}
+
+// Unmaps a capture.
+void adcCaptureFile_close(adcCaptureFile_t *file) {
+  if (file->data)
+    munmap((void *)file->data, file->size);
+  file->data = NULL;
+  file->size = 0;
+}
+
+// Sets a cursor to the first chunk.
+void adcCaptureFile_rewind(const adcCaptureFile_t *file,
+                           adcCaptureFile_cursor_t *cursor) {
+  cursor->offset = file->headerOffset + ADC_CAPTURE_HEADER_SIZE;
+  cursor->skippedByteCount = 0;
+}
+
+// Moves a cursor to a byte offset in the file.
+void adcCaptureFile_seek(const adcCaptureFile_t *file,
+                         adcCaptureFile_cursor_t *cursor, size_t offset) {
+  adcCaptureFile_rewind(file, cursor);
+  if (offset > cursor->offset)
+    cursor->offset = offset < file->size ? offset : file->size;
+}
+
+// Drops the pages before offset from this process.
+void adcCaptureFile_release(const adcCaptureFile_t *file, size_t offset) {
+  size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t length = offset / pageSize * pageSize;
+  if (length)
+    madvise((void *)file->data, length, MADV_DONTNEED);
+}
+
+// Finds the next chunk. Returns false at the end of the capture.
+bool adcCaptureFile_nextChunk(const adcCaptureFile_t *file,
+                              adcCaptureFile_cursor_t *cursor,
+                              adcCaptureFile_chunk_t *chunk) {
+  while (cursor->offset < file->size) {
+    size_t offset = adcCaptureFile_find(file->data, file->size, cursor->offset,
+                                        ADC_CAPTURE_FILE_CHUNK_MAGIC);
+    cursor->skippedByteCount += offset - cursor->offset;
+    cursor->offset = offset;
+    if (offset + ADC_CAPTURE_CHUNK_HEADER_SIZE > file->size)
+      break;
+    const uint8_t *start = file->data + offset;
+    uint32_t size = 0;
+    if (adcCapture_readChunkHeader(start, &chunk->header) &&
+        chunk->header.sampleCount <= file->header.chunkSamples)
+      size = adcCapture_chunkSize(chunk->header.sampleCount);
+    if (size == 0 || offset + size > file->size) {
+      // Not a chunk after all.
+      cursor->offset++;
+      cursor->skippedByteCount++;
+      continue;
+    }
+    uint32_t crcOffset = size - ADC_CAPTURE_CRC_SIZE;
+    const uint8_t *crc = start + crcOffset;
+    chunk->crcValid =
+        adcCapture_crc32(0, start, crcOffset) ==
+        (crc[0] | (uint32_t)crc[1] << 8 | (uint32_t)crc[2] << 16 |
+         (uint32_t)crc[3] << 24);
+    chunk->packedSamples = start + ADC_CAPTURE_CHUNK_HEADER_SIZE;
+    // A bad CRC may mean a bad sample count, so do not trust the size.
+    cursor->offset += chunk->crcValid ? size : ADC_CAPTURE_FILE_MAGIC_SIZE;
+    return true;
+  }
+  cursor->skippedByteCount += file->size - cursor->offset;
+  cursor->offset = file->size;
+  return false;
+}
+
+// Unpacks a chunk's samples.
+void adcCaptureFile_unpack(const adcCaptureFile_chunk_t *chunk,
+                           uint16_t samples[]) {
+  adcCapture_unpack(chunk->packedSamples, chunk->header.sampleCount, samples);
+}
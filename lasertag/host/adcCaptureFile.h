@@ -0,0 +1,70 @@
+// Reads ADC captures written by adcCapture.c (see adcCapture.h for the
+// format). The file is memory-mapped and chunks are decoded in place, so even
+// long captures open instantly.
+//
+// Captures taken from the console may have text before the header and after
+// the last chunk; it is skipped. So is anything between chunks that does not
+// look like a chunk, after a corrupted chunk for instance.
+
+#ifndef ADCCAPTUREFILE_H_
+#define ADCCAPTUREFILE_H_
+
+#include "adcCapture.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// An open capture.
+typedef struct {
+  const uint8_t *data; // The whole file.
+  size_t size;
+  adcCapture_header_t header;
+  size_t headerOffset; // Bytes before the header.
+} adcCaptureFile_t;
+
+// A position in a capture, for adcCaptureFile_nextChunk().
+typedef struct {
+  size_t offset;
+  size_t skippedByteCount; // Bytes passed over that were not chunks.
+} adcCaptureFile_cursor_t;
+
+// One chunk, pointing into the file.
+typedef struct {
+  adcCapture_chunkHeader_t header;
+  const uint8_t *packedSamples;
+  bool crcValid; // If false, the samples cannot be trusted.
+} adcCaptureFile_chunk_t;
+
+// Maps a capture and reads its header. Prints the reason and returns false if
+// it is not a capture.
+bool adcCaptureFile_open(const char *fileName, adcCaptureFile_t *file);
+
+// Unmaps a capture.
+void adcCaptureFile_close(adcCaptureFile_t *file);
+
+// Sets a cursor to the first chunk.
+void adcCaptureFile_rewind(const adcCaptureFile_t *file,
+                           adcCaptureFile_cursor_t *cursor);
+
+// Moves a cursor to a byte offset in the file. adcCaptureFile_nextChunk()
+// then finds the first chunk at or after it.
+void adcCaptureFile_seek(const adcCaptureFile_t *file,
+                         adcCaptureFile_cursor_t *cursor, size_t offset);
+
+// Tells the kernel the file before offset will not be read again, so that
+// long replays do not keep gigabytes of it mapped in.
+void adcCaptureFile_release(const adcCaptureFile_t *file, size_t offset);
+
+// Finds the next chunk. Returns false at the end of the capture. A chunk with
+// a bad CRC is returned once, with crcValid false, and the search for the
+// next chunk starts just after its magic number.
+bool adcCaptureFile_nextChunk(const adcCaptureFile_t *file,
+                              adcCaptureFile_cursor_t *cursor,
+                              adcCaptureFile_chunk_t *chunk);
+
+// Unpacks a chunk's samples into samples[], which must hold
+// header.chunkSamples values.
+void adcCaptureFile_unpack(const adcCaptureFile_chunk_t *chunk,
+                           uint16_t samples[]);
+
+#endif /* ADCCAPTUREFILE_H_ */
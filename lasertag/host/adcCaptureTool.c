@@ -0,0 +1,296 @@
+// Records ADC captures through the gun's capture path and reads them back.
+//
+// Usage: adcCaptureTool record file [--seconds s] [--seed n] [--frequency f]
+//                                   [--shot-period-ms p] [--skip-every n]
+//                                   [--console] [--corrupt]
+//        adcCaptureTool info file
+//        adcCaptureTool check file [--seconds s] [--seed n]
+//                                  [--shot-period-ms p] [--skip-every n]
+//                                  [--expect-bad-chunks n]
+//
+// record plays a synthetic signal (noise, with a 200 ms shot every 750 ms or
+// --shot-period-ms, cycling through the player frequencies, and leaving out
+// every --skip-every'th shot if given) through isr_function() while
+// adcCapture.c records it into file, the way runningModes_recordAdcCapture()
+// does on the gun. It reports what recording adds to isr_function(), and what
+// adcCapture_poll() costs in the main loop. --console surrounds the capture
+// with the text the gun prints, and --corrupt flips a bit in the third chunk.
+//
+// info prints the header and a summary of the chunks. check does the same and
+// also regenerates the signal from --seconds, --seed, --shot-period-ms and
+// --skip-every and fails unless every sample in a chunk with a good CRC
+// matches it, and exactly --expect-bad-chunks chunks (0 by default) are bad.
+
+#include "adcCapture.h"
+#include "adcCaptureFile.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ADC_CAPTURE_TOOL_DEFAULT_SECONDS 5
+#define ADC_CAPTURE_TOOL_DEFAULT_SEED 1
+#define ADC_CAPTURE_TOOL_DEFAULT_FREQUENCY 0
+#define ADC_CAPTURE_TOOL_MS_PER_SECOND 1000
+// Longer than a shot and the lockout after it, so every shot is detected and
+// the lockout has always expired before the next one.
+#define ADC_CAPTURE_TOOL_DEFAULT_SHOT_PERIOD_MS 750
+#define ADC_CAPTURE_TOOL_SHOT_MS 200
+#define ADC_CAPTURE_TOOL_ADC_MIDSCALE 2048
+#define ADC_CAPTURE_TOOL_SHOT_AMPLITUDE 300 // In ADC counts.
+#define ADC_CAPTURE_TOOL_NOISE_AMPLITUDE 40
+#define ADC_CAPTURE_TOOL_CORRUPT_CHUNK 2
+#define ADC_CAPTURE_TOOL_CORRUPT_BYTE 100 // Into the chunk.
+#define ADC_CAPTURE_TOOL_UNLIMITED 0xFFFFFFFF
+
+static FILE *captureFile;
+
+// Writes capture bytes to captureFile.
+static bool adcCaptureTool_write(const uint8_t data[], uint32_t length) {
+  return fwrite(data, 1, length, captureFile) == length;
+}
+
+// xorshift32, so that signals are repeatable across hosts.
+static uint32_t adcCaptureTool_random(uint32_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+// Returns the synthetic signal, sampleCount samples long, with a shot every
+// shotPeriodMs but every skipEvery'th (none if 0). Free it when done.
+static uint16_t *adcCaptureTool_signal(uint32_t sampleCount, uint32_t seed,
+                                       uint32_t shotPeriodMs,
+                                       uint32_t skipEvery) {
+  uint16_t *signal = malloc(sampleCount * sizeof(uint16_t));
+  uint32_t state = seed ? seed : 1;
+  uint32_t shotPeriod = shotPeriodMs * ISR_TICKS_PER_MS;
+  uint32_t shotLength = ADC_CAPTURE_TOOL_SHOT_MS * ISR_TICKS_PER_MS;
+  for (uint32_t tick = 0; tick < sampleCount; tick++) {
+    int32_t value =
+        ADC_CAPTURE_TOOL_ADC_MIDSCALE +
+        (int32_t)(adcCaptureTool_random(&state) %
+                  (2 * ADC_CAPTURE_TOOL_NOISE_AMPLITUDE + 1)) -
+        ADC_CAPTURE_TOOL_NOISE_AMPLITUDE;
+    uint32_t shot = tick / shotPeriod;
+    if (tick % shotPeriod < shotLength &&
+        !(skipEvery && shot % skipEvery == skipEvery - 1)) {
+      uint32_t period =
+          filter_frequencyTickTable[shot % FILTER_FREQUENCY_COUNT];
+      value += (tick % period < period / 2) ? ADC_CAPTURE_TOOL_SHOT_AMPLITUDE
+                                            : -ADC_CAPTURE_TOOL_SHOT_AMPLITUDE;
+    }
+    signal[tick] = value;
+  }
+  return signal;
+}
+
+// Feeds the signal through isr_function(), emptying the ADC buffer as
+// detector() would. If recording, the capture is written once per chunk.
+// Returns the nanoseconds spent in isr_function(), and adds the nanoseconds
+// spent writing to *pollNs.
+static uint64_t adcCaptureTool_play(const uint16_t signal[],
+                                    uint32_t sampleCount, uint64_t *pollNs) {
+  uint64_t isrNs = 0;
+  for (uint32_t start = 0; start < sampleCount;
+       start += ADC_CAPTURE_CHUNK_SAMPLES) {
+    uint32_t end = start + ADC_CAPTURE_CHUNK_SAMPLES;
+    if (end > sampleCount)
+      end = sampleCount;
+    uint64_t begin = hostBoard_getTimeInNs();
+    for (uint32_t tick = start; tick < end; tick++) {
+      hostBoard_setAdcData(signal[tick]);
+      isr_function();
+      if (isr_adcBufferElementCount() == ISR_ADC_BUFFER_SIZE - 1)
+        while (isr_adcBufferElementCount())
+          isr_removeDataFromAdcBuffer();
+    }
+    uint64_t middle = hostBoard_getTimeInNs();
+    isrNs += middle - begin;
+    if (adcCapture_recording()) {
+      adcCapture_poll(ADC_CAPTURE_TOOL_UNLIMITED);
+      *pollNs += hostBoard_getTimeInNs() - middle;
+    }
+  }
+  return isrNs;
+}
+
+static int adcCaptureTool_record(const char *fileName, uint32_t seconds,
+                                 uint32_t seed, uint32_t shotPeriodMs,
+                                 uint32_t skipEvery, uint16_t frequency,
+                                 bool console, bool corrupt) {
+  uint32_t sampleCount =
+      seconds * ADC_CAPTURE_TOOL_MS_PER_SECOND * ISR_TICKS_PER_MS;
+  uint16_t *signal =
+      adcCaptureTool_signal(sampleCount, seed, shotPeriodMs, skipEvery);
+  captureFile = fopen(fileName, "w+b");
+  if (captureFile == NULL) {
+    perror(fileName);
+    return EXIT_FAILURE;
+  }
+  isr_init();
+  uint64_t pollNs = 0;
+  uint64_t idleNs = adcCaptureTool_play(signal, sampleCount, &pollNs);
+
+  isr_init();
+  if (console)
+    fprintf(captureFile, "Recording ADC capture on frequency %d.\n",
+            frequency);
+  long captureStart = ftell(captureFile);
+  if (!adcCapture_start(frequency, adcCaptureTool_write)) {
+    perror(fileName);
+    return EXIT_FAILURE;
+  }
+  uint64_t recordingNs = adcCaptureTool_play(signal, sampleCount, &pollNs);
+  adcCapture_stop();
+  uint64_t begin = hostBoard_getTimeInNs();
+  while (adcCapture_poll(ADC_CAPTURE_TOOL_UNLIMITED))
+    ;
+  pollNs += hostBoard_getTimeInNs() - begin;
+  adcCapture_stats_t stats = adcCapture_getStats();
+  if (console)
+    fprintf(captureFile, "\nADC capture: %llu samples, %llu dropped.\n",
+            (unsigned long long)stats.sampleCount,
+            (unsigned long long)stats.droppedSampleCount);
+  if (corrupt) {
+    long offset = captureStart + ADC_CAPTURE_HEADER_SIZE +
+                  ADC_CAPTURE_TOOL_CORRUPT_CHUNK *
+                      adcCapture_chunkSize(ADC_CAPTURE_CHUNK_SAMPLES) +
+                  ADC_CAPTURE_TOOL_CORRUPT_BYTE;
+    fseek(captureFile, offset, SEEK_SET);
+    int byte = fgetc(captureFile);
+    fseek(captureFile, offset, SEEK_SET);
+    fputc(byte ^ 0x10, captureFile);
+  }
+  bool success = fclose(captureFile) == 0 && !stats.writeFailed &&
+                 stats.droppedSampleCount == 0;
+  free(signal);
+  printf("adcCaptureTool: recorded %llu samples in %u chunks, %llu bytes "
+         "(%.2f bits per sample).\n",
+         (unsigned long long)stats.sampleCount, stats.chunkCount,
+         (unsigned long long)stats.byteCount,
+         8.0 * stats.byteCount / stats.sampleCount);
+  printf("adcCaptureTool: isr_function() took %.1f ns per sample recording, "
+         "%.1f ns not recording; writing took %.1f ns per sample.\n",
+         (double)recordingNs / sampleCount, (double)idleNs / sampleCount,
+         (double)pollNs / sampleCount);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Prints a summary of a capture. With a signal, also compares the samples.
+static int adcCaptureTool_read(const char *fileName, const uint16_t signal[],
+                               uint32_t sampleCount,
+                               uint32_t expectedBadChunks) {
+  adcCaptureFile_t file;
+  if (!adcCaptureFile_open(fileName, &file))
+    return EXIT_FAILURE;
+  const adcCapture_header_t *header = &file.header;
+  printf("adcCaptureTool: version %d, %u Hz, frequency %d, %d samples per "
+         "chunk, started at tick %u.\n",
+         header->version, header->sampleRateHz, header->frequencySetting,
+         header->chunkSamples, header->startTick);
+  uint16_t *samples = malloc(header->chunkSamples * sizeof(uint16_t));
+  adcCaptureFile_cursor_t cursor;
+  adcCaptureFile_rewind(&file, &cursor);
+  adcCaptureFile_chunk_t chunk;
+  uint32_t chunkCount = 0, badChunkCount = 0, gapCount = 0;
+  uint64_t recordedSampleCount = 0, nextSample = 0, mismatchCount = 0;
+  while (adcCaptureFile_nextChunk(&file, &cursor, &chunk)) {
+    chunkCount++;
+    if (!chunk.crcValid) {
+      badChunkCount++;
+      continue;
+    }
+    if (chunk.header.firstSample != nextSample)
+      gapCount++;
+    nextSample = chunk.header.firstSample + chunk.header.sampleCount;
+    recordedSampleCount += chunk.header.sampleCount;
+    if (signal == NULL)
+      continue;
+    adcCaptureFile_unpack(&chunk, samples);
+    for (uint16_t i = 0; i < chunk.header.sampleCount; i++) {
+      uint64_t index = chunk.header.firstSample + i;
+      if (index >= sampleCount || samples[i] != signal[index])
+        mismatchCount++;
+    }
+  }
+  free(samples);
+  printf("adcCaptureTool: %u chunks (%u bad), %llu samples (%.3f s), %u gaps, "
+         "%zu bytes skipped.\n",
+         chunkCount, badChunkCount, (unsigned long long)recordedSampleCount,
+         (double)recordedSampleCount / header->sampleRateHz, gapCount,
+         cursor.skippedByteCount);
+  adcCaptureFile_close(&file);
+  if (signal == NULL)
+    return EXIT_SUCCESS;
+  // A bad chunk makes a gap in the good ones.
+  bool success = mismatchCount == 0 && badChunkCount == expectedBadChunks &&
+                 gapCount == expectedBadChunks && nextSample == sampleCount &&
+                 header->sampleRateHz ==
+                     ISR_TICKS_PER_MS * ADC_CAPTURE_TOOL_MS_PER_SECOND;
+  if (mismatchCount)
+    printf("adcCaptureTool: %llu samples differ from the signal.\n",
+           (unsigned long long)mismatchCount);
+  printf("adcCaptureTool: %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t seconds = ADC_CAPTURE_TOOL_DEFAULT_SECONDS;
+  uint32_t seed = ADC_CAPTURE_TOOL_DEFAULT_SEED;
+  uint16_t frequency = ADC_CAPTURE_TOOL_DEFAULT_FREQUENCY;
+  uint32_t shotPeriodMs = ADC_CAPTURE_TOOL_DEFAULT_SHOT_PERIOD_MS;
+  uint32_t skipEvery = 0;
+  uint32_t expectedBadChunks = 0;
+  bool console = false;
+  bool corrupt = false;
+  bool usage = argc < 3;
+  for (int i = 3; i < argc && !usage; i++) {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc)
+      seconds = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+      seed = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--frequency") && i + 1 < argc)
+      frequency = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--shot-period-ms") && i + 1 < argc)
+      shotPeriodMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--skip-every") && i + 1 < argc)
+      skipEvery = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--expect-bad-chunks") && i + 1 < argc)
+      expectedBadChunks = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--console"))
+      console = true;
+    else if (!strcmp(argv[i], "--corrupt"))
+      corrupt = true;
+    else
+      usage = true;
+  }
+  if (!usage && !strcmp(argv[1], "record"))
+    return adcCaptureTool_record(argv[2], seconds, seed, shotPeriodMs,
+                                 skipEvery, frequency, console, corrupt);
+  if (!usage && !strcmp(argv[1], "info"))
+    return adcCaptureTool_read(argv[2], NULL, 0, 0);
+  if (!usage && !strcmp(argv[1], "check")) {
+    uint32_t sampleCount =
+        seconds * ADC_CAPTURE_TOOL_MS_PER_SECOND * ISR_TICKS_PER_MS;
+    uint16_t *signal =
+        adcCaptureTool_signal(sampleCount, seed, shotPeriodMs, skipEvery);
+    int result =
+        adcCaptureTool_read(argv[2], signal, sampleCount, expectedBadChunks);
+    free(signal);
+    return result;
+  }
+  fprintf(stderr,
+          "usage: %s record file [--seconds s] [--seed n] [--frequency f] "
+          "[--shot-period-ms p] [--skip-every n] [--console] [--corrupt]\n"
+          "       %s info file\n"
+          "       %s check file [--seconds s] [--seed n] "
+          "[--shot-period-ms p] [--skip-every n] [--expect-bad-chunks n]\n",
+          argv[0], argv[0], argv[0]);
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,236 @@
+// Host micro-benchmarks for the queue, filter and detector kernels.
+// Each kernel is warmed up, then timed over several repetitions. Results are
+// written as JSON so that runs from different commits can be diffed.
+//
+// Usage: lasertagBenchmark [--quick] [--output file.json]
+
+#include "detector.h"
+#include "dspDispatch.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include "queue.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCHMARK_WARM_UP_REPETITIONS 3
+#define BENCHMARK_REPETITIONS 15
+#define BENCHMARK_QUICK_REPETITIONS 3
+#define BENCHMARK_MAX_REPETITIONS BENCHMARK_REPETITIONS
+#define BENCHMARK_QUEUE_SIZE 2000
+#define BENCHMARK_DETECTOR_SAMPLES 1000
+// detector() is fed this many samples at a time, well below the ISR buffer
+// size so nothing is overwritten.
+#define BENCHMARK_DETECTOR_CHUNK FILTER_FIR_DECIMATION_FACTOR
+#define BENCHMARK_ADC_MAX 4095
+#define BENCHMARK_ALL_CHANNELS ((1 << FILTER_FREQUENCY_COUNT) - 1)
+#define INTERRUPTS_CURRENTLY_DISABLED false
+
+// Keeps the compiler from optimizing the kernels away.
+static volatile double benchmarkSink;
+
+// A kernel runs its operation iterationCount times.
+typedef void (*benchmark_kernel_t)(uint32_t iterationCount);
+
+typedef struct {
+  const char *name;          // Name used in the JSON output.
+  benchmark_kernel_t kernel; // Runs the operation.
+  uint32_t iterationCount;   // Operations timed per repetition.
+  const char *unit;          // What one operation is.
+} benchmark_t;
+
+static queue_t benchmarkQueue;
+static uint32_t randomState = 1;
+
+// Small LCG so that runs are repeatable across hosts.
+static uint32_t benchmarkRandom() {
+  randomState = randomState * 1664525 + 1013904223;
+  return randomState >> 8;
+}
+
+/*********************** kernels *************************************/
+
+static void queuePushKernel(uint32_t iterationCount) {
+  for (uint32_t i = 0; i < iterationCount; i++)
+    queue_overwritePush(&benchmarkQueue, (double)i);
+}
+
+static void queueReadKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    sum += queue_readElementAt(&benchmarkQueue, i % BENCHMARK_QUEUE_SIZE);
+  benchmarkSink = sum;
+}
+
+static void firKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    sum += filter_firFilter();
+  benchmarkSink = sum;
+}
+
+static void iirChannelKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    sum += filter_iirFilter(0);
+  benchmarkSink = sum;
+}
+
+static void iirBankKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      sum += filter_iirFilter(j);
+  benchmarkSink = sum;
+}
+
+// Runs every channel on FILTER_IIR_BLOCK_SIZE outputs per call, as detector()
+// does, so the time per decimated output compares with iirBankKernel().
+static void iirBlockKernel(uint32_t iterationCount) {
+  for (uint32_t i = 0; i < iterationCount; i += FILTER_IIR_BLOCK_SIZE)
+    filter_iirFilterBlock(BENCHMARK_ALL_CHANNELS, FILTER_IIR_BLOCK_SIZE);
+  benchmarkSink = queue_readElementAt(filter_getIirOutputQueue(0), 0);
+}
+
+static void powerKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      sum += filter_computePower(j, false, false);
+  benchmarkSink = sum;
+}
+
+// Scales the same ADC values one at a time, then a buffer's worth at a time.
+static void scaleKernel(uint32_t iterationCount) {
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i++)
+    sum += detector_getScaledAdcValue(i & BENCHMARK_ADC_MAX);
+  benchmarkSink = sum;
+}
+
+static void scaleBlockKernel(uint32_t iterationCount) {
+  isr_AdcValue_t adcValues[ISR_ADC_BUFFER_SIZE];
+  double scaled[ISR_ADC_BUFFER_SIZE];
+  double sum = 0.0;
+  for (uint32_t i = 0; i < iterationCount; i += ISR_ADC_BUFFER_SIZE) {
+    for (uint32_t j = 0; j < ISR_ADC_BUFFER_SIZE; j++)
+      adcValues[j] = (i + j) & BENCHMARK_ADC_MAX;
+    detector_scaleAdcValues(adcValues, scaled, ISR_ADC_BUFFER_SIZE);
+    sum += scaled[0];
+  }
+  benchmarkSink = sum;
+}
+
+static void sortKernel(uint32_t iterationCount) {
+  double unsortedValues[FILTER_FREQUENCY_COUNT];
+  double sortedValues[FILTER_FREQUENCY_COUNT];
+  uint32_t maxPowerFreqNo = 0;
+  for (uint32_t i = 0; i < iterationCount; i++) {
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      unsortedValues[j] = (double)((i * 7 + j * 13) % 17);
+    detector_sort(&maxPowerFreqNo, unsortedValues, sortedValues);
+  }
+  benchmarkSink = maxPowerFreqNo + sortedValues[0];
+}
+
+// Feeds BENCHMARK_DETECTOR_SAMPLES noise samples through detector() per
+// iteration. Noise keeps the decision stage running (no hits, no lockout).
+static void detectorKernel(uint32_t iterationCount) {
+  for (uint32_t i = 0; i < iterationCount; i++) {
+    for (uint32_t j = 0; j < BENCHMARK_DETECTOR_SAMPLES;
+         j += BENCHMARK_DETECTOR_CHUNK) {
+      for (uint32_t k = 0; k < BENCHMARK_DETECTOR_CHUNK; k++)
+        isr_addDataToAdcBuffer(benchmarkRandom() % (BENCHMARK_ADC_MAX + 1));
+      detector(INTERRUPTS_CURRENTLY_DISABLED);
+    }
+  }
+}
+
+static const benchmark_t benchmarks[] = {
+    {"queue_overwritePush", queuePushKernel, 100000, "push"},
+    {"queue_readElementAt", queueReadKernel, 100000, "read"},
+    {"filter_firFilter", firKernel, 20000, "decimated output"},
+    {"filter_iirFilter", iirChannelKernel, 20000, "channel output"},
+    {"filter_iirBank", iirBankKernel, 2000, "decimated output"},
+    {"filter_iirFilterBlock", iirBlockKernel, 2000, "decimated output"},
+    {"filter_computePower", powerKernel, 20000, "decimated output"},
+    {"detector_getScaledAdcValue", scaleKernel, 100000, "sample"},
+    {"detector_scaleAdcValues", scaleBlockKernel, 100000, "sample"},
+    {"detector_sort", sortKernel, 100000, "sort"},
+    {"detector", detectorKernel, 20, "1k samples"},
+};
+#define BENCHMARK_COUNT (sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+/*********************** harness *************************************/
+
+static int compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Resets all state the kernels touch so each benchmark starts the same way.
+static void resetKernelState() {
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  isr_init();
+  detector_init(ignoredFrequencies);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    filter_computePower(i, true, false);
+  randomState = 1;
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t repetitions = BENCHMARK_REPETITIONS;
+  const char *outputFileName = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--quick")) {
+      repetitions = BENCHMARK_QUICK_REPETITIONS;
+    } else if (!strcmp(argv[i], "--output") && i + 1 < argc) {
+      outputFileName = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--quick] [--output file.json]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  FILE *out = outputFileName ? fopen(outputFileName, "w") : stdout;
+  if (out == NULL) {
+    perror(outputFileName);
+    return EXIT_FAILURE;
+  }
+
+  queue_init(&benchmarkQueue, BENCHMARK_QUEUE_SIZE, "benchmarkQueue");
+  queuePushKernel(BENCHMARK_QUEUE_SIZE); // Reads need a full queue.
+
+  fprintf(out, "{\n  \"benchmark\": \"lasertag\",\n");
+  fprintf(out, "  \"dspKernels\": \"%s\",\n", dspDispatch_getKernels()->name);
+  fprintf(out, "  \"repetitions\": %u,\n  \"results\": [\n", repetitions);
+  for (uint32_t b = 0; b < BENCHMARK_COUNT; b++) {
+    const benchmark_t *benchmark = &benchmarks[b];
+    double nsPerOp[BENCHMARK_MAX_REPETITIONS];
+    resetKernelState();
+    for (uint32_t i = 0; i < BENCHMARK_WARM_UP_REPETITIONS; i++)
+      benchmark->kernel(benchmark->iterationCount);
+    double sum = 0.0;
+    for (uint32_t i = 0; i < repetitions; i++) {
+      uint64_t start = hostBoard_getTimeInNs();
+      benchmark->kernel(benchmark->iterationCount);
+      uint64_t elapsed = hostBoard_getTimeInNs() - start;
+      nsPerOp[i] = (double)elapsed / benchmark->iterationCount;
+      sum += nsPerOp[i];
+    }
+    qsort(nsPerOp, repetitions, sizeof(double), compareDoubles);
+    fprintf(out,
+            "    {\"name\": \"%s\", \"unit\": \"ns per %s\", "
+            "\"min\": %.2f, \"median\": %.2f, \"mean\": %.2f, \"max\": %.2f}%s\n",
+            benchmark->name, benchmark->unit, nsPerOp[0],
+            nsPerOp[repetitions / 2], sum / repetitions,
+            nsPerOp[repetitions - 1], (b + 1 < BENCHMARK_COUNT) ? "," : "");
+  }
+  fprintf(out, "  ]\n}\n");
+  queue_garbageCollect(&benchmarkQueue);
+  if (out != stdout)
+    fclose(out);
+  return EXIT_SUCCESS;
+}
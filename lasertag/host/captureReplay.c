@@ -0,0 +1,765 @@
+// Replays ADC captures (see adcCapture.h) through isr_function() and
+// detector(), for soak testing the detector on hours of recorded data.
+//
+// Usage: captureReplay file [--jobs n] [--warmup-ms m] [--ignore-own-frequency]
+//                      [--output file] [--compare-serial] [--min-hits n]
+//                      [--decode-only]
+//
+// The capture is memory-mapped (adcCaptureFile.c) and each chunk is unpacked
+// straight from the mapping into a block that is fed to the ISR one sample at
+// a time, the way the ADC would. Gaps in the capture (dropped samples, bad
+// chunks) are filled by holding the last sample.
+//
+// With --jobs, the capture is split into spans, one per worker process (the
+// lasertag modules keep their state in globals). Spans start on a chunk at
+// evenly spaced points in the file. Each worker starts --warmup-ms (1000 by
+// default) before its span, on a block boundary, so that its filters,
+// power window and lockout have settled the way a serial replay's would by the
+// time the span starts, and reports only the hits inside its span. It then
+// carries on CAPTURE_REPLAY_OVERLAP_MS into the next span, to check the next
+// worker's hits there.
+//
+// The filters settle in the warm-up, but the lockout may not: when shots come
+// closer together than a shot and the lockout after it, each hit's lockout
+// runs into the next shot, so when that shot is detected depends on the hits
+// before it. The next worker has caught up once it shares a hit with the
+// worker before it (or neither finds any), and its hits are used from there.
+// Until then the worker before's are, and if its overlap ends first, the
+// snapshot it left at the end of its span (a forked copy, waiting) carries on
+// until it does share one, into the spans after if need be. If the two
+// disagree after a shared hit, the filters had not settled and the replay
+// fails. --compare-serial also replays the whole capture in one worker and
+// fails unless both find the same hits.
+//
+// --decode-only only unpacks the samples, to measure the reader on its own.
+
+#include "adcCapture.h"
+#include "adcCaptureFile.h"
+#include "detector.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include "lockoutTimer.h"
+#include <math.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define CAPTURE_REPLAY_MAX_JOBS 64
+#define CAPTURE_REPLAY_DEFAULT_WARMUP_MS 1000
+// Each worker replays this far into the next span, to check that the next
+// worker has settled by then.
+#define CAPTURE_REPLAY_OVERLAP_MS 2000
+// The detector filters this many samples' worth of decimated outputs at once.
+#define CAPTURE_REPLAY_BLOCK_SAMPLES                                           \
+  (FILTER_FIR_DECIMATION_FACTOR * FILTER_IIR_BLOCK_SIZE)
+#define CAPTURE_REPLAY_HZ_PER_KHZ 1000
+#define CAPTURE_REPLAY_NS_PER_SECOND 1.0E9
+#define CAPTURE_REPLAY_BYTES_PER_MB 1.0E6
+// Pages behind the replay are released every this many bytes.
+#define CAPTURE_REPLAY_RELEASE_BYTES (64 * 1024 * 1024)
+// Hits in the two replays may differ in power by this fraction: the power is
+// kept as a running sum, so its rounding depends on where the replay began.
+#define CAPTURE_REPLAY_MAX_POWER_DIFFERENCE 1.0E-6
+#define CAPTURE_REPLAY_NO_SAMPLE UINT64_MAX
+// Two replays shared a hit but disagreed after it.
+#define CAPTURE_REPLAY_UNSETTLED (CAPTURE_REPLAY_NO_SAMPLE - 1)
+#define INTERRUPTS_CURRENTLY_DISABLED false
+
+// Where a worker's span starts: the first good chunk at or after an evenly
+// spaced point in the file.
+typedef struct {
+  uint64_t sample; // CAPTURE_REPLAY_NO_SAMPLE past the last chunk.
+  size_t offset;
+} captureReplay_spanStart_t;
+
+// The samples a worker feeds, [feedFrom, feedTo), and reports hits for,
+// [reportFrom, reportTo). Past reportTo it keeps going into the next span for
+// CAPTURE_REPLAY_OVERLAP_MS, to check that the two agree. A repair reports
+// every hit from reportFrom until CAPTURE_REPLAY_OVERLAP_MS after it shares
+// one with a worker.
+typedef struct {
+  uint64_t feedFrom;
+  uint64_t reportFrom;
+  uint64_t reportTo;
+  uint64_t feedTo;
+  bool repair;
+} captureReplay_span_t;
+
+// What a worker reports, in shared memory.
+typedef struct {
+  uint64_t sampleCount;     // Samples fed, warm-up and overlap included.
+  uint64_t spanSampleCount; // Samples fed in the span.
+  uint64_t checksum;      // Sum of the samples, for --decode-only.
+  uint32_t hitCount;      // In the span.
+  uint32_t overlapHitCount; // Past the span, stored after the others.
+  uint64_t overlapEnd;      // Overlap hits are before this sample.
+  uint32_t droppedHitCount; // Hits that did not fit in the shared memory.
+  uint32_t gapCount;
+  uint64_t caughtUp; // The hit a repair shares with a worker.
+} captureReplay_result_t;
+
+// Hits a replay found, in order. It ran up to end.
+typedef struct {
+  const detector_hitEvent_t *hits;
+  uint32_t count;
+  uint64_t end;
+} captureReplay_hitList_t;
+
+static struct {
+  const char *fileName;
+  uint16_t jobCount;
+  uint32_t warmupMs;
+  bool ignoreOwnFrequency;
+  const char *outputFileName;
+  bool compareSerial;
+  uint32_t minHitCount;
+  bool decodeOnly;
+} settings = {.warmupMs = CAPTURE_REPLAY_DEFAULT_WARMUP_MS};
+
+static adcCaptureFile_t file;
+static uint32_t hitCapacity; // Per worker.
+// The spans of the last replay, and what their workers found.
+static uint16_t spanCount;
+static captureReplay_span_t spans[CAPTURE_REPLAY_MAX_JOBS];
+static captureReplay_result_t **spanResults;
+static detector_hitEvent_t **spanHits;
+// Each worker but the last leaves a snapshot at the end of its span, which
+// waits on its end of snapshotChannels[job] (the second) for a byte to repair
+// the spans after it, and sends one back when done.
+static int snapshotChannels[CAPTURE_REPLAY_MAX_JOBS][2];
+// Where a repair reports, shared.
+static captureReplay_result_t *repairResult;
+static detector_hitEvent_t *repairHits;
+static uint32_t repairCapacity;
+
+// Returns shared memory the workers can write to, zeroed.
+static void *captureReplay_share(size_t size) {
+  void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    perror("mmap");
+    exit(EXIT_FAILURE);
+  }
+  return memory;
+}
+
+// Returns the first good chunk at or after offset.
+static captureReplay_spanStart_t captureReplay_findChunk(size_t offset) {
+  adcCaptureFile_cursor_t cursor;
+  adcCaptureFile_chunk_t chunk;
+  adcCaptureFile_seek(&file, &cursor, offset);
+  captureReplay_spanStart_t start = {CAPTURE_REPLAY_NO_SAMPLE, file.size};
+  size_t chunkOffset;
+  do {
+    if (!adcCaptureFile_nextChunk(&file, &cursor, &chunk))
+      return start;
+    chunkOffset = chunk.packedSamples - ADC_CAPTURE_CHUNK_HEADER_SIZE -
+                  file.data;
+  } while (!chunk.crcValid);
+  start.sample = chunk.header.firstSample;
+  start.offset = chunkOffset;
+  return start;
+}
+
+// Returns where span job of jobCount starts.
+static captureReplay_spanStart_t captureReplay_spanStart(uint16_t job,
+                                                         uint16_t jobCount) {
+  size_t first = file.headerOffset + ADC_CAPTURE_HEADER_SIZE;
+  return captureReplay_findChunk(first +
+                                 (file.size - first) * job / jobCount);
+}
+
+// Returns a good chunk at or before sample, or the first one.
+static captureReplay_spanStart_t
+captureReplay_findSample(captureReplay_spanStart_t after, uint64_t sample) {
+  size_t first = file.headerOffset + ADC_CAPTURE_HEADER_SIZE;
+  size_t backoff = adcCapture_chunkSize(file.header.chunkSamples) *
+                   ((after.sample - sample) / file.header.chunkSamples + 1);
+  while (true) {
+    size_t offset = after.offset > first + backoff ? after.offset - backoff
+                                                   : first;
+    captureReplay_spanStart_t start = captureReplay_findChunk(offset);
+    if (start.sample <= sample || offset == first)
+      return start;
+    backoff *= 2; // Gaps or bad chunks on the way; look further back.
+  }
+}
+
+// Returns true if two hits are the same, apart from their power.
+static bool captureReplay_sameHit(const detector_hitEvent_t *a,
+                                  const detector_hitEvent_t *b) {
+  return a->sampleIndex == b->sampleIndex &&
+         a->frequencyNumber == b->frequencyNumber;
+}
+
+// Returns true if the worker whose span hit is in found it too.
+static bool captureReplay_workerFound(const detector_hitEvent_t *hit) {
+  uint16_t job = spanCount - 1;
+  while (job > 0 && hit->sampleIndex < spans[job].reportFrom)
+    job--;
+  const detector_hitEvent_t *found = spanHits[job];
+  uint32_t low = 0, high = spanResults[job]->hitCount;
+  while (low < high) {
+    uint32_t middle = low + (high - low) / 2;
+    if (found[middle].sampleIndex < hit->sampleIndex)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  return low < spanResults[job]->hitCount &&
+         captureReplay_sameHit(&found[low], hit);
+}
+
+// Feeds one sample to the ISR, and runs the detector once per decimated
+// output. Hits in the span or the overlap after it are stored in hits[].
+static void captureReplay_feed(uint16_t sample, captureReplay_span_t *span,
+                               captureReplay_result_t *result,
+                               detector_hitEvent_t hits[]) {
+  hostBoard_setAdcData(sample);
+  isr_function();
+  uint64_t index = span->feedFrom + result->sampleCount++;
+  if (index >= span->reportFrom && index < span->reportTo)
+    result->spanSampleCount++;
+  if (result->sampleCount % FILTER_FIR_DECIMATION_FACTOR)
+    return;
+  detector(INTERRUPTS_CURRENTLY_DISABLED);
+  detector_hitEvent_t event;
+  while (detector_popHitEvent(&event)) {
+    detector_clearHit();
+    event.sampleIndex += span->feedFrom; // Capture sample numbers.
+    if (event.sampleIndex < span->reportFrom ||
+        event.sampleIndex >= result->overlapEnd)
+      continue;
+    uint32_t count = result->hitCount + result->overlapHitCount;
+    if (count >= hitCapacity)
+      result->droppedHitCount++;
+    else if (event.sampleIndex < span->reportTo)
+      hits[result->hitCount++] = event; // Always before any overlap hits.
+    else {
+      hits[count] = event;
+      result->overlapHitCount++;
+    }
+    // A repair has caught up; go on a little longer to check it.
+    if (span->repair && result->caughtUp == CAPTURE_REPLAY_NO_SAMPLE &&
+        captureReplay_workerFound(&event)) {
+      result->caughtUp = event.sampleIndex;
+      span->feedTo =
+          event.sampleIndex + CAPTURE_REPLAY_OVERLAP_MS * ISR_TICKS_PER_MS;
+      result->overlapEnd = span->feedTo - 2 * CAPTURE_REPLAY_BLOCK_SAMPLES;
+    }
+  }
+}
+
+// Leaves a snapshot of this worker at the end of its span, waiting on its end
+// of channel. Returns in the worker, and in the snapshot if it is to repair
+// the spans after, with span, result and hits switched over to the repair.
+static void captureReplay_snapshot(int channel, captureReplay_span_t *span,
+                                   captureReplay_result_t **result,
+                                   detector_hitEvent_t **hits) {
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    _exit(EXIT_FAILURE);
+  }
+  if (pid > 0) {
+    close(channel);
+    return;
+  }
+  char command;
+  if (read(channel, &command, sizeof(command)) != sizeof(command))
+    _exit(EXIT_SUCCESS); // Not needed.
+  span->reportFrom = span->reportTo;
+  span->reportTo = CAPTURE_REPLAY_NO_SAMPLE;
+  span->feedTo = CAPTURE_REPLAY_NO_SAMPLE;
+  span->repair = true;
+  repairResult->sampleCount = (*result)->sampleCount;
+  repairResult->overlapEnd = CAPTURE_REPLAY_NO_SAMPLE;
+  repairResult->caughtUp = CAPTURE_REPLAY_NO_SAMPLE;
+  *result = repairResult;
+  *hits = repairHits;
+  hitCapacity = repairCapacity;
+}
+
+// Replays a span, reading on from the chunk at start. If snapshotChannel is
+// not -1, leaves a snapshot at the end of the span.
+static void captureReplay_run(captureReplay_spanStart_t start,
+                              captureReplay_span_t span,
+                              captureReplay_result_t *result,
+                              detector_hitEvent_t hits[], int snapshotChannel) {
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  if (settings.ignoreOwnFrequency &&
+      file.header.frequencySetting < FILTER_FREQUENCY_COUNT)
+    ignoredFrequencies[file.header.frequencySetting] = true;
+  isr_init();
+  detector_init(ignoredFrequencies);
+  uint64_t nextSample = span.feedFrom;
+  // The last few samples may not have been filtered yet.
+  result->overlapEnd = span.feedTo;
+  if (span.feedTo != CAPTURE_REPLAY_NO_SAMPLE && span.feedTo > span.reportTo)
+    result->overlapEnd = span.feedTo - 2 * CAPTURE_REPLAY_BLOCK_SAMPLES;
+  uint16_t lastSample = 0;
+  bool started = false;
+
+  uint16_t *samples = malloc(file.header.chunkSamples * sizeof(uint16_t));
+  adcCaptureFile_cursor_t cursor;
+  adcCaptureFile_seek(&file, &cursor, start.offset);
+  size_t releasedOffset = start.offset;
+  adcCaptureFile_chunk_t chunk;
+  while (nextSample < span.feedTo &&
+         adcCaptureFile_nextChunk(&file, &cursor, &chunk)) {
+    if (!chunk.crcValid)
+      continue;
+    uint64_t chunkEnd = chunk.header.firstSample + chunk.header.sampleCount;
+    if (chunkEnd <= nextSample)
+      continue;
+    adcCaptureFile_unpack(&chunk, samples);
+    if (!started) {
+      lastSample = samples[0];
+      started = true;
+    }
+    if (chunk.header.firstSample > nextSample)
+      result->gapCount++;
+    if (settings.decodeOnly) {
+      for (uint16_t i = 0; i < chunk.header.sampleCount; i++)
+        result->checksum += samples[i];
+      result->sampleCount += chunk.header.sampleCount;
+      result->spanSampleCount += chunk.header.sampleCount;
+      nextSample = chunkEnd;
+    } else {
+      // Hold the last sample over a gap. The span ends on a chunk.
+      for (; nextSample < chunkEnd && nextSample < span.feedTo; nextSample++) {
+        if (nextSample == span.reportTo && snapshotChannel != -1)
+          captureReplay_snapshot(snapshotChannel, &span, &result, &hits);
+        captureReplay_feed(nextSample < chunk.header.firstSample
+                               ? lastSample
+                               : samples[nextSample - chunk.header.firstSample],
+                           &span, result, hits);
+      }
+      lastSample = samples[chunk.header.sampleCount - 1];
+    }
+    if (cursor.offset - releasedOffset >= CAPTURE_REPLAY_RELEASE_BYTES) {
+      adcCaptureFile_release(&file, cursor.offset);
+      releasedOffset = cursor.offset;
+    }
+  }
+  free(samples);
+  char done = true;
+  if (span.repair && write(snapshotChannel, &done, sizeof(done)) < 0)
+    perror("write");
+}
+
+// Returns the span of job, which starts at starts[job].
+static captureReplay_span_t
+captureReplay_span(const captureReplay_spanStart_t starts[], uint16_t job) {
+  captureReplay_span_t span = {starts[job].sample, starts[job].sample,
+                               starts[job + 1].sample, starts[job + 1].sample,
+                               false};
+  if (settings.decodeOnly)
+    return span;
+  uint64_t warmup = (uint64_t)settings.warmupMs * ISR_TICKS_PER_MS;
+  if (span.feedTo != CAPTURE_REPLAY_NO_SAMPLE)
+    span.feedTo += CAPTURE_REPLAY_OVERLAP_MS * ISR_TICKS_PER_MS;
+  if (job == 0)
+    return span;
+  // Warm up on a block boundary of the whole capture, as in a serial replay.
+  span.feedFrom = span.reportFrom - starts[0].sample > warmup
+                      ? span.reportFrom - warmup
+                      : starts[0].sample;
+  span.feedFrom += (CAPTURE_REPLAY_BLOCK_SAMPLES -
+                    (span.feedFrom - starts[0].sample) %
+                        CAPTURE_REPLAY_BLOCK_SAMPLES) %
+                   CAPTURE_REPLAY_BLOCK_SAMPLES;
+  return span;
+}
+
+// Replays the capture in jobCount workers. Returns false if a worker failed.
+static bool captureReplay_replay(uint16_t jobCount,
+                                 captureReplay_result_t *results[],
+                                 detector_hitEvent_t *hits[]) {
+  captureReplay_spanStart_t starts[CAPTURE_REPLAY_MAX_JOBS + 1];
+  for (uint16_t job = 0; job < jobCount; job++)
+    starts[job] = captureReplay_spanStart(job, jobCount);
+  starts[jobCount].sample = CAPTURE_REPLAY_NO_SAMPLE;
+  spanCount = jobCount;
+  spanResults = results;
+  spanHits = hits;
+  bool snapshots = jobCount > 1 && !settings.decodeOnly;
+  for (uint16_t job = 0; job < jobCount; job++) {
+    spans[job] = captureReplay_span(starts, job);
+    if (snapshots && job + 1 < jobCount &&
+        socketpair(AF_UNIX, SOCK_STREAM, 0, snapshotChannels[job]) < 0) {
+      perror("socketpair");
+      return false;
+    }
+  }
+  fflush(stdout); // Or the workers flush it again.
+  for (uint16_t job = 0; job < jobCount; job++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return false;
+    }
+    if (pid == 0) {
+      // Only the snapshot of this worker keeps a channel.
+      for (uint16_t i = 0; snapshots && i + 1 < jobCount; i++) {
+        close(snapshotChannels[i][0]);
+        if (i != job)
+          close(snapshotChannels[i][1]);
+      }
+      const captureReplay_span_t *span = &spans[job];
+      if (span->reportFrom < span->reportTo)
+        captureReplay_run(span->feedFrom < span->reportFrom
+                              ? captureReplay_findSample(starts[job],
+                                                         span->feedFrom)
+                              : starts[job],
+                          *span, results[job], hits[job],
+                          snapshots && job + 1 < jobCount
+                              ? snapshotChannels[job][1]
+                              : -1);
+      _exit(EXIT_SUCCESS);
+    }
+  }
+  for (uint16_t job = 0; snapshots && job + 1 < jobCount; job++)
+    close(snapshotChannels[job][1]);
+  bool success = true;
+  int status;
+  while (wait(&status) > 0)
+    success &= WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+  return success;
+}
+
+// Lets the snapshots of the last replay go.
+static void captureReplay_releaseSnapshots() {
+  if (spanCount < 2 || settings.decodeOnly)
+    return;
+  for (uint16_t job = 0; job + 1 < spanCount; job++)
+    close(snapshotChannels[job][0]);
+}
+
+// Sums up a replay and writes its joined hits to out, if not NULL. Returns
+// the number of hits.
+static uint32_t captureReplay_report(const char *name, uint16_t jobCount,
+                                     captureReplay_result_t *results[],
+                                     const detector_hitEvent_t hits[],
+                                     uint32_t hitCount, double seconds,
+                                     FILE *out) {
+  uint64_t sampleCount = 0, spanSampleCount = 0, checksum = 0;
+  uint32_t droppedHitCount = 0, gapCount = 0;
+  for (uint16_t job = 0; job < jobCount; job++) {
+    sampleCount += results[job]->sampleCount;
+    spanSampleCount += results[job]->spanSampleCount;
+    checksum += results[job]->checksum;
+    droppedHitCount += results[job]->droppedHitCount;
+    gapCount += results[job]->gapCount;
+  }
+  for (uint32_t i = 0; out && i < hitCount; i++)
+    fprintf(out, "hit %u: sample %llu (%.3f s), frequency %d, margin %.3f\n",
+            i, (unsigned long long)hits[i].sampleIndex,
+            (double)hits[i].sampleIndex / file.header.sampleRateHz,
+            hits[i].frequencyNumber, hits[i].margin);
+  double captureSeconds = (double)spanSampleCount / file.header.sampleRateHz;
+  printf("captureReplay: %s, %u jobs: %.1f s of capture (%llu samples fed) in "
+         "%.2f s, %.0fx real time, %.0f MB/s",
+         name, jobCount, captureSeconds, (unsigned long long)sampleCount,
+         seconds, captureSeconds / seconds,
+         file.size / CAPTURE_REPLAY_BYTES_PER_MB / seconds);
+  if (settings.decodeOnly)
+    printf(", checksum %llu.\n", (unsigned long long)checksum);
+  else
+    printf(", %u hits, %u gaps.\n", hitCount, gapCount);
+  if (droppedHitCount)
+    printf("captureReplay: %u hits did not fit.\n", droppedHitCount);
+  return droppedHitCount ? 0 : hitCount;
+}
+
+// Returns true if two replays found the same hits.
+static bool captureReplay_same(const detector_hitEvent_t hits[],
+                               uint32_t hitCount,
+                               const detector_hitEvent_t serialHits[],
+                               uint32_t serialHitCount) {
+  bool same = true;
+  for (uint32_t n = 0; n < hitCount; n++) {
+    const detector_hitEvent_t *hit = &hits[n];
+    const detector_hitEvent_t *serial = &serialHits[n];
+    if (n >= serialHitCount || !captureReplay_sameHit(hit, serial) ||
+        fabs(hit->peakPower - serial->peakPower) >
+            CAPTURE_REPLAY_MAX_POWER_DIFFERENCE * serial->peakPower) {
+      printf("captureReplay: hit %u at sample %llu on frequency %d differs "
+             "from the serial replay.\n",
+             n, (unsigned long long)hit->sampleIndex, hit->frequencyNumber);
+      same = false;
+    }
+  }
+  if (hitCount != serialHitCount) {
+    printf("captureReplay: %u hits, %u in the serial replay.\n", hitCount,
+           serialHitCount);
+    same = false;
+  }
+  return same;
+}
+
+// Returns the first hit in span job that trusted, which matches a serial
+// replay from the start of the span, shares with the span's worker, or the
+// start of the span if neither found any while both ran. Returns
+// CAPTURE_REPLAY_NO_SAMPLE if the worker has not caught up, and
+// CAPTURE_REPLAY_UNSETTLED if the two disagree after the shared hit.
+static uint64_t captureReplay_catchUp(const captureReplay_hitList_t *trusted,
+                                      uint16_t job) {
+  const captureReplay_span_t *span = &spans[job];
+  const captureReplay_result_t *result = spanResults[job];
+  const detector_hitEvent_t *hits = spanHits[job];
+  uint32_t count = result->hitCount + result->overlapHitCount;
+  uint64_t end =
+      trusted->end < result->overlapEnd ? trusted->end : result->overlapEnd;
+  uint32_t t = 0, w = 0;
+  while (t < trusted->count && trusted->hits[t].sampleIndex < span->reportFrom)
+    t++;
+  if ((t == trusted->count || trusted->hits[t].sampleIndex >= end) &&
+      (count == 0 || hits[0].sampleIndex >= end))
+    return span->reportFrom;
+  // Look for the shared hit among the worker's span hits.
+  while (t < trusted->count && w < result->hitCount &&
+         trusted->hits[t].sampleIndex < end &&
+         !captureReplay_sameHit(&trusted->hits[t], &hits[w])) {
+    if (trusted->hits[t].sampleIndex < hits[w].sampleIndex)
+      t++;
+    else if (hits[w].sampleIndex < trusted->hits[t].sampleIndex)
+      w++;
+    else {
+      t++;
+      w++;
+    }
+  }
+  if (t == trusted->count || w == result->hitCount ||
+      trusted->hits[t].sampleIndex >= end)
+    return CAPTURE_REPLAY_NO_SAMPLE;
+  uint64_t caughtUp = trusted->hits[t].sampleIndex;
+  for (;; t++, w++) {
+    bool trustedHit = t < trusted->count && trusted->hits[t].sampleIndex < end;
+    bool workerHit = w < count && hits[w].sampleIndex < end;
+    if (!trustedHit && !workerHit)
+      return caughtUp;
+    if (trustedHit != workerHit ||
+        !captureReplay_sameHit(&trusted->hits[t], &hits[w]))
+      return CAPTURE_REPLAY_UNSETTLED;
+  }
+}
+
+// Has the snapshot worker job left at the end of its span repair the spans
+// after it, from that of worker next on. Returns false if it failed.
+static bool captureReplay_repair(uint16_t job, uint16_t next) {
+  memset(repairResult, 0, sizeof(captureReplay_result_t));
+  char command = true, done = false;
+  if (write(snapshotChannels[job][0], &command, sizeof(command)) !=
+          sizeof(command) ||
+      read(snapshotChannels[job][0], &done, sizeof(done)) != sizeof(done) ||
+      !done) {
+    printf("captureReplay: the snapshot of worker %u failed.\n", job);
+    return false;
+  }
+  // The repair is worker job carrying on past its span.
+  spanResults[job]->sampleCount += repairResult->spanSampleCount;
+  spanResults[job]->droppedHitCount += repairResult->droppedHitCount;
+  printf("captureReplay: worker %u had not caught up with the lockout; worker "
+         "%u carried on for %.1f s",
+         next, job,
+         (double)repairResult->spanSampleCount / file.header.sampleRateHz);
+  if (repairResult->caughtUp == CAPTURE_REPLAY_NO_SAMPLE)
+    printf(", to the end.\n");
+  else
+    printf(" until a shared hit at sample %llu.\n",
+           (unsigned long long)repairResult->caughtUp);
+  return true;
+}
+
+// Adds the hits in [from, to) to joined[]. Returns the new count.
+static uint32_t captureReplay_append(detector_hitEvent_t joined[],
+                                     uint32_t count, uint32_t capacity,
+                                     const detector_hitEvent_t hits[],
+                                     uint32_t hitCount, uint64_t from,
+                                     uint64_t to) {
+  for (uint32_t i = 0; i < hitCount && hits[i].sampleIndex < to; i++)
+    if (hits[i].sampleIndex >= from && count < capacity)
+      joined[count++] = hits[i];
+  return count;
+}
+
+// Joins the hits of the last replay's workers into joined[], repairing the
+// spans of workers that had not caught up. Returns false if one had not
+// settled or a repair failed.
+static bool captureReplay_join(detector_hitEvent_t joined[],
+                               uint32_t capacity, uint32_t *joinedCount) {
+  uint32_t count = 0;
+  captureReplay_hitList_t trusted = {NULL, 0, 0};
+  uint16_t trustedJob = 0; // Whose snapshot carries trusted on.
+  bool repaired = false;
+  for (uint16_t job = 0; job < spanCount; job++) {
+    const captureReplay_span_t *span = &spans[job];
+    if (span->reportFrom >= span->reportTo)
+      continue;
+    uint64_t caughtUp = span->reportFrom;
+    if (job > 0) {
+      caughtUp = captureReplay_catchUp(&trusted, job);
+      if (caughtUp == CAPTURE_REPLAY_NO_SAMPLE && !repaired) {
+        if (!captureReplay_repair(trustedJob, job))
+          return false;
+        trusted = (captureReplay_hitList_t){repairHits, repairResult->hitCount,
+                                            repairResult->overlapEnd};
+        repaired = true;
+        caughtUp = captureReplay_catchUp(&trusted, job);
+      }
+      if (caughtUp == CAPTURE_REPLAY_UNSETTLED) {
+        printf("captureReplay: worker %u shares a hit with the replay before "
+               "it but not the hits after; try a longer --warmup-ms.\n",
+               job);
+        return false;
+      }
+    }
+    count = captureReplay_append(joined, count, capacity, trusted.hits,
+                                 trusted.count, span->reportFrom,
+                                 caughtUp < span->reportTo ? caughtUp
+                                                           : span->reportTo);
+    if (caughtUp == CAPTURE_REPLAY_NO_SAMPLE)
+      continue; // The repair goes on into the next span.
+    const captureReplay_result_t *result = spanResults[job];
+    count = captureReplay_append(joined, count, capacity, spanHits[job],
+                                 result->hitCount, caughtUp, span->reportTo);
+    trusted = (captureReplay_hitList_t){spanHits[job] + result->hitCount,
+                                        result->overlapHitCount,
+                                        result->overlapEnd};
+    trustedJob = job;
+    repaired = false;
+  }
+  *joinedCount = count;
+  return true;
+}
+
+// Parses the command line into settings. Returns false if it is unusable.
+static bool captureReplay_parse(int argc, char *argv[]) {
+  if (argc < 2)
+    return false;
+  settings.fileName = argv[1];
+  for (int i = 2; i < argc; i++) {
+    if (!strcmp(argv[i], "--jobs") && i + 1 < argc)
+      settings.jobCount = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--warmup-ms") && i + 1 < argc)
+      settings.warmupMs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--ignore-own-frequency"))
+      settings.ignoreOwnFrequency = true;
+    else if (!strcmp(argv[i], "--output") && i + 1 < argc)
+      settings.outputFileName = argv[++i];
+    else if (!strcmp(argv[i], "--compare-serial"))
+      settings.compareSerial = true;
+    else if (!strcmp(argv[i], "--min-hits") && i + 1 < argc)
+      settings.minHitCount = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "--decode-only"))
+      settings.decodeOnly = true;
+    else
+      return false;
+  }
+  if (settings.jobCount == 0)
+    settings.jobCount = sysconf(_SC_NPROCESSORS_ONLN);
+  return settings.jobCount > 0 && settings.jobCount <= CAPTURE_REPLAY_MAX_JOBS;
+}
+
+int main(int argc, char *argv[]) {
+  if (!captureReplay_parse(argc, argv)) {
+    fprintf(stderr,
+            "usage: %s file [--jobs n] [--warmup-ms m] "
+            "[--ignore-own-frequency] [--output file] [--compare-serial] "
+            "[--min-hits n] [--decode-only]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (!adcCaptureFile_open(settings.fileName, &file))
+    return EXIT_FAILURE;
+  if (file.header.sampleRateHz !=
+      ISR_TICKS_PER_MS * CAPTURE_REPLAY_HZ_PER_KHZ)
+    printf("captureReplay: warning, the capture is at %u Hz, the filters are "
+           "designed for %d kHz.\n",
+           file.header.sampleRateHz, FILTER_SAMPLE_FREQUENCY_IN_KHZ);
+  // The lockout allows at most one hit per LOCKOUT_TIMER_EXPIRE_VALUE
+  // samples. A worker's span is a share of the file, give or take a chunk,
+  // plus the overlap.
+  uint64_t maxSampleCount = file.size * 8 / ADC_CAPTURE_BITS_PER_SAMPLE;
+  hitCapacity = (maxSampleCount / settings.jobCount +
+                 2 * file.header.chunkSamples +
+                 CAPTURE_REPLAY_OVERLAP_MS * ISR_TICKS_PER_MS) /
+                    LOCKOUT_TIMER_EXPIRE_VALUE +
+                3;
+  uint32_t serialCapacity = maxSampleCount / LOCKOUT_TIMER_EXPIRE_VALUE + 2;
+
+  captureReplay_result_t *results[CAPTURE_REPLAY_MAX_JOBS];
+  detector_hitEvent_t *hits[CAPTURE_REPLAY_MAX_JOBS];
+  for (uint16_t job = 0; job < settings.jobCount; job++) {
+    results[job] = captureReplay_share(sizeof(captureReplay_result_t));
+    hits[job] = captureReplay_share(hitCapacity * sizeof(detector_hitEvent_t));
+  }
+  // A repair can carry on to the end of the capture.
+  repairCapacity = serialCapacity;
+  repairResult = captureReplay_share(sizeof(captureReplay_result_t));
+  repairHits =
+      captureReplay_share(repairCapacity * sizeof(detector_hitEvent_t));
+  detector_hitEvent_t *joined =
+      malloc(serialCapacity * sizeof(detector_hitEvent_t));
+  signal(SIGPIPE, SIG_IGN); // A snapshot that died fails its repair instead.
+  FILE *out = NULL;
+  if (settings.outputFileName && !(out = fopen(settings.outputFileName, "w"))) {
+    perror(settings.outputFileName);
+    return EXIT_FAILURE;
+  }
+
+  bool success = true;
+  captureReplay_result_t *serialResult[1];
+  detector_hitEvent_t *serialHits[1];
+  uint32_t serialHitCount = 0;
+  if (settings.compareSerial) {
+    uint32_t parallelCapacity = hitCapacity;
+    hitCapacity = serialCapacity;
+    serialResult[0] = captureReplay_share(sizeof(captureReplay_result_t));
+    serialHits[0] =
+        captureReplay_share(hitCapacity * sizeof(detector_hitEvent_t));
+    uint64_t begin = hostBoard_getTimeInNs();
+    success &= captureReplay_replay(1, serialResult, serialHits);
+    serialHitCount = captureReplay_report(
+        "serial", 1, serialResult, serialHits[0], serialResult[0]->hitCount,
+        (hostBoard_getTimeInNs() - begin) / CAPTURE_REPLAY_NS_PER_SECOND, NULL);
+    hitCapacity = parallelCapacity;
+  }
+  uint64_t begin = hostBoard_getTimeInNs();
+  bool replayed = captureReplay_replay(settings.jobCount, results, hits);
+  uint32_t hitCount = 0;
+  if (replayed && !settings.decodeOnly)
+    success &= captureReplay_join(joined, serialCapacity, &hitCount);
+  success &= replayed;
+  captureReplay_releaseSnapshots();
+  hitCount = captureReplay_report(
+      "parallel", settings.jobCount, results, joined, hitCount,
+      (hostBoard_getTimeInNs() - begin) / CAPTURE_REPLAY_NS_PER_SECOND, out);
+  if (out)
+    fclose(out);
+  if (settings.compareSerial) {
+    if (settings.decodeOnly) {
+      uint64_t checksum = 0;
+      for (uint16_t job = 0; job < settings.jobCount; job++)
+        checksum += results[job]->checksum;
+      success &= checksum == serialResult[0]->checksum;
+    } else {
+      success &= captureReplay_same(joined, hitCount, serialHits[0],
+                                    serialHitCount);
+    }
+  }
+  success &= settings.decodeOnly || hitCount >= settings.minHitCount;
+  free(joined);
+  adcCaptureFile_close(&file);
+  printf("captureReplay: %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
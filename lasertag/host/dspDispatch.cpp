@@ -0,0 +1,260 @@
+// The scalar kernels, the choice of kernels for the CPU, and the test that
+// checks the others against the scalar ones. See dspDispatch.h.
+
+#include "dspDispatch.h"
+#include "dspCore.hpp"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************** scalar kernels ******************************/
+
+static double scalarFirFilter(const double ring[], uint32_t ringSize,
+                              uint32_t oldest, const double coefficients[]) {
+  return dspCore::fir<double, FILTER_FIR_COEFFICIENT_COUNT>(
+      ring, ringSize, oldest, coefficients);
+}
+
+static void scalarIirFilterBank(uint16_t channelMask,
+                                const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                                const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                                const double y[],
+                                double z[][FILTER_CORE_IIR_STATE_SIZE],
+                                uint16_t count) {
+  dspCore::iirBank<double, FILTER_FREQUENCY_COUNT,
+                   FILTER_IIR_COEFFICIENT_COUNT, FILTER_IIR_BLOCK_SIZE>(
+      channelMask, b, a, y, z, count);
+}
+
+static double scalarSumOfSquares(const double values[], uint32_t count,
+                                 double sum) {
+  return dspCore::sumOfSquares(values, count, sum);
+}
+
+static void scalarScaleAdcValues(const isr_AdcValue_t adcValues[],
+                                 double scaled[], uint32_t count,
+                                 double scale) {
+  dspCore::scaleAdcValues(adcValues, scaled, count, scale);
+}
+
+const dspDispatch_kernels_t dspDispatch_scalarKernels = {
+    "scalar", scalarFirFilter, scalarIirFilterBank, scalarSumOfSquares,
+    scalarScaleAdcValues};
+
+/*********************** selection ***********************************/
+
+// The variants built for this architecture, best first.
+static const dspDispatch_kernels_t *const variants[] = {
+#if defined(__x86_64__)
+    &dspDispatch_avx2Kernels,
+    &dspDispatch_sse2Kernels,
+#elif defined(__aarch64__)
+    &dspDispatch_neonKernels,
+#endif
+    &dspDispatch_scalarKernels,
+};
+#define DSP_DISPATCH_VARIANT_COUNT (sizeof(variants) / sizeof(variants[0]))
+
+// Returns true if this CPU can run kernels. SSE2 and NEON are part of x86-64
+// and 64-bit ARM, so only AVX2 has to be asked for.
+bool dspDispatch_isSupported(const dspDispatch_kernels_t *kernels) {
+#if defined(__x86_64__)
+  if (kernels == &dspDispatch_avx2Kernels) {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+  }
+#endif
+  return true;
+}
+
+// Returns the kernels the environment names, or else the best supported ones.
+static const dspDispatch_kernels_t *dspDispatch_selectKernels() {
+  const char *name = getenv(DSP_DISPATCH_ENVIRONMENT_VARIABLE);
+  const dspDispatch_kernels_t *best = NULL;
+  for (uint32_t i = 0; i < DSP_DISPATCH_VARIANT_COUNT; i++) {
+    if (!dspDispatch_isSupported(variants[i]))
+      continue;
+    if (best == NULL)
+      best = variants[i];
+    if (name && !strcmp(name, variants[i]->name))
+      return variants[i];
+  }
+  if (name && *name)
+    fprintf(stderr, "%s=%s is not available on this CPU, using %s.\n",
+            DSP_DISPATCH_ENVIRONMENT_VARIABLE, name, best->name);
+  return best;
+}
+
+// Returns the kernels to use, chosen on the first call.
+const dspDispatch_kernels_t *dspDispatch_getKernels() {
+  static const dspDispatch_kernels_t *kernels = dspDispatch_selectKernels();
+  return kernels;
+}
+
+/*********************** test ****************************************/
+
+// Results may differ from the scalar ones by this much, relative to the
+// larger of 1 and the scalar result.
+#define DSP_DISPATCH_TEST_TOLERANCE 1e-12
+
+// Long enough for every path through the vector loops and their tails.
+#define DSP_DISPATCH_TEST_MAX_COUNT 67
+#define DSP_DISPATCH_TEST_RING_SIZE (FILTER_FIR_COEFFICIENT_COUNT + 1)
+#define DSP_DISPATCH_TEST_ADC_MAX 4095
+#define DSP_DISPATCH_TEST_ADC_SCALE (1.0 / 2047.5)
+// Stable enough that the IIR outputs stay near 1 over a block.
+#define DSP_DISPATCH_TEST_IIR_A_SCALE 0.2
+
+static const uint16_t dspDispatch_testMasks[] = {
+    (1 << FILTER_FREQUENCY_COUNT) - 1, 0x1, 0x3, 0x7, 0x155, 0x2aa, 0x3f0, 0};
+#define DSP_DISPATCH_TEST_MASK_COUNT                                           \
+  (sizeof(dspDispatch_testMasks) / sizeof(dspDispatch_testMasks[0]))
+
+static uint32_t dspDispatch_testState;
+
+// Returns a pseudo-random value in [-1, 1).
+static double dspDispatch_testRandom() {
+  dspDispatch_testState = dspDispatch_testState * 1664525 + 1013904223;
+  return (int32_t)dspDispatch_testState / 2147483648.0;
+}
+
+// Returns how far value is from reference, relative to the larger of 1 and
+// reference.
+static double dspDispatch_testError(double value, double reference) {
+  double scale = fabs(reference) > 1.0 ? fabs(reference) : 1.0;
+  return fabs(value - reference) / scale;
+}
+
+// Returns the largest error of kernels->firFilter() over every position of
+// the oldest input in the ring.
+static double dspDispatch_testFir(const dspDispatch_kernels_t *kernels) {
+  double ring[DSP_DISPATCH_TEST_RING_SIZE];
+  double coefficients[FILTER_FIR_COEFFICIENT_COUNT];
+  for (uint32_t i = 0; i < DSP_DISPATCH_TEST_RING_SIZE; i++)
+    ring[i] = dspDispatch_testRandom();
+  for (uint32_t i = 0; i < FILTER_FIR_COEFFICIENT_COUNT; i++)
+    coefficients[i] = dspDispatch_testRandom();
+  double maxError = 0.0;
+  for (uint32_t oldest = 0; oldest < DSP_DISPATCH_TEST_RING_SIZE; oldest++) {
+    double error = dspDispatch_testError(
+        kernels->firFilter(ring, DSP_DISPATCH_TEST_RING_SIZE, oldest,
+                           coefficients),
+        scalarFirFilter(ring, DSP_DISPATCH_TEST_RING_SIZE, oldest,
+                        coefficients));
+    maxError = error > maxError ? error : maxError;
+  }
+  return maxError;
+}
+
+// Returns the largest error of kernels->iirFilterBank() over each test mask
+// and block length. Channels outside the mask must be left alone.
+static double dspDispatch_testIir(const dspDispatch_kernels_t *kernels) {
+  static double b[FILTER_FREQUENCY_COUNT][FILTER_IIR_COEFFICIENT_COUNT];
+  static double a[FILTER_FREQUENCY_COUNT][FILTER_IIR_COEFFICIENT_COUNT];
+  static double y[FILTER_CORE_IIR_STATE_SIZE];
+  static double history[FILTER_FREQUENCY_COUNT][FILTER_CORE_IIR_STATE_SIZE];
+  static double z[FILTER_FREQUENCY_COUNT][FILTER_CORE_IIR_STATE_SIZE];
+  static double zReference[FILTER_FREQUENCY_COUNT][FILTER_CORE_IIR_STATE_SIZE];
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++) {
+    for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++) {
+      b[channel][i] = dspDispatch_testRandom();
+      a[channel][i] = DSP_DISPATCH_TEST_IIR_A_SCALE * dspDispatch_testRandom();
+    }
+    for (uint16_t i = 0; i < FILTER_CORE_IIR_STATE_SIZE; i++)
+      history[channel][i] = dspDispatch_testRandom();
+  }
+  for (uint16_t i = 0; i < FILTER_CORE_IIR_STATE_SIZE; i++)
+    y[i] = dspDispatch_testRandom();
+  double maxError = 0.0;
+  for (uint32_t m = 0; m < DSP_DISPATCH_TEST_MASK_COUNT; m++) {
+    for (uint16_t count = 1; count <= FILTER_IIR_BLOCK_SIZE; count++) {
+      memcpy(z, history, sizeof(z));
+      memcpy(zReference, history, sizeof(zReference));
+      kernels->iirFilterBank(dspDispatch_testMasks[m], b, a, y, z, count);
+      scalarIirFilterBank(dspDispatch_testMasks[m], b, a, y, zReference,
+                          count);
+      for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++)
+        for (uint16_t i = 0; i < FILTER_CORE_IIR_STATE_SIZE; i++) {
+          double error =
+              dspDispatch_testError(z[channel][i], zReference[channel][i]);
+          maxError = error > maxError ? error : maxError;
+        }
+    }
+  }
+  return maxError;
+}
+
+// Returns the largest error of kernels->sumOfSquares() over each count, with
+// the values starting on and off a vector boundary.
+static double dspDispatch_testPower(const dspDispatch_kernels_t *kernels) {
+  double values[DSP_DISPATCH_TEST_MAX_COUNT + 1];
+  for (uint32_t i = 0; i <= DSP_DISPATCH_TEST_MAX_COUNT; i++)
+    values[i] = dspDispatch_testRandom();
+  double maxError = 0.0;
+  for (uint32_t offset = 0; offset <= 1; offset++)
+    for (uint32_t count = 0; count + offset <= DSP_DISPATCH_TEST_MAX_COUNT;
+         count++) {
+      double sum = dspDispatch_testRandom();
+      double error = dspDispatch_testError(
+          kernels->sumOfSquares(values + offset, count, sum),
+          scalarSumOfSquares(values + offset, count, sum));
+      maxError = error > maxError ? error : maxError;
+    }
+  return maxError;
+}
+
+// Returns the largest error of kernels->scaleAdcValues() over each count, with
+// the values starting on and off a vector boundary.
+static double dspDispatch_testScaling(const dspDispatch_kernels_t *kernels) {
+  isr_AdcValue_t adcValues[DSP_DISPATCH_TEST_MAX_COUNT + 1];
+  double scaled[DSP_DISPATCH_TEST_MAX_COUNT + 1];
+  double reference[DSP_DISPATCH_TEST_MAX_COUNT + 1];
+  adcValues[0] = 0;
+  adcValues[1] = DSP_DISPATCH_TEST_ADC_MAX;
+  for (uint32_t i = 2; i <= DSP_DISPATCH_TEST_MAX_COUNT; i++)
+    adcValues[i] = (dspDispatch_testRandom() + 1.0) / 2.0 *
+                   (DSP_DISPATCH_TEST_ADC_MAX + 1);
+  double maxError = 0.0;
+  for (uint32_t offset = 0; offset <= 1; offset++)
+    for (uint32_t count = 0; count + offset <= DSP_DISPATCH_TEST_MAX_COUNT;
+         count++) {
+      kernels->scaleAdcValues(adcValues + offset, scaled, count,
+                              DSP_DISPATCH_TEST_ADC_SCALE);
+      scalarScaleAdcValues(adcValues + offset, reference, count,
+                           DSP_DISPATCH_TEST_ADC_SCALE);
+      for (uint32_t i = 0; i < count; i++) {
+        double error = dspDispatch_testError(scaled[i], reference[i]);
+        maxError = error > maxError ? error : maxError;
+      }
+    }
+  return maxError;
+}
+
+// Checks each variant this CPU supports against the scalar kernels.
+bool dspDispatch_runTest() {
+  printf("****************** dspDispatch_runTest() ******************\n");
+  printf("Using the %s kernels.\n", dspDispatch_getKernels()->name);
+  bool success = true;
+  for (uint32_t v = 0; v < DSP_DISPATCH_VARIANT_COUNT; v++) {
+    const dspDispatch_kernels_t *kernels = variants[v];
+    if (!dspDispatch_isSupported(kernels)) {
+      printf("%s: not supported on this CPU.\n", kernels->name);
+      continue;
+    }
+    dspDispatch_testState = 1;
+    double errors[] = {dspDispatch_testFir(kernels),
+                       dspDispatch_testIir(kernels),
+                       dspDispatch_testPower(kernels),
+                       dspDispatch_testScaling(kernels)};
+    bool passed = true;
+    for (uint32_t i = 0; i < sizeof(errors) / sizeof(errors[0]); i++)
+      passed &= errors[i] <= DSP_DISPATCH_TEST_TOLERANCE;
+    printf("%s: largest relative error FIR %g, IIR %g, power %g, "
+           "scaling %g: %s\n",
+           kernels->name, errors[0], errors[1], errors[2], errors[3],
+           passed ? "passed" : "FAILED");
+    success &= passed;
+  }
+  return success;
+}
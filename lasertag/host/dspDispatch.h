@@ -0,0 +1,80 @@
+// DSP kernels chosen at run time for the CPU the host tools run on. The host
+// build defines FILTER_CORE_DISPATCH_ENABLED, so filterCore.cpp calls the FIR,
+// IIR-bank, power and ADC-scaling kernels through the table
+// dspDispatch_getKernels() returns: one binary uses AVX2 where the CPU has it
+// and SSE2 elsewhere on x86-64, and NEON on 64-bit ARM. The scalar kernels
+// are the dspCore.hpp templates the firmware runs, and are always available.
+//
+// Set LASERTAG_DSP_KERNELS to scalar, sse2, avx2 or neon to choose the kernels
+// instead, e.g. to compare results or timings:
+//
+//   LASERTAG_DSP_KERNELS=scalar build/lasertagBenchmark
+//
+// The IIR and ADC-scaling kernels vectorize across channels and samples and
+// keep the scalar order of operations. The FIR and power kernels split their
+// sums across lanes, which rounds differently, so their results differ from
+// the scalar ones in the last bits. dspDispatch_runTest() checks every
+// variant the CPU can run against the scalar kernels.
+
+#ifndef DSPDISPATCH_H_
+#define DSPDISPATCH_H_
+
+#include "filterCore.h"
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Names the kernels to use instead of the best ones for the CPU.
+#define DSP_DISPATCH_ENVIRONMENT_VARIABLE "LASERTAG_DSP_KERNELS"
+
+// One implementation of each kernel.
+typedef struct {
+  const char *name;
+  // Returns the output of the FIR-filter whose inputs are in a circular array
+  // of ringSize entries, the oldest at oldest, as dspCore::fir() does.
+  double (*firFilter)(const double ring[], uint32_t ringSize, uint32_t oldest,
+                      const double coefficients[]);
+  // Runs the IIR-filters in channelMask over count outputs, as
+  // dspCore::iirBank() does.
+  void (*iirFilterBank)(uint16_t channelMask,
+                        const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                        const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                        const double y[],
+                        double z[][FILTER_CORE_IIR_STATE_SIZE], uint16_t count);
+  // Returns sum plus the squares of count values.
+  double (*sumOfSquares)(const double values[], uint32_t count, double sum);
+  // Sets scaled[i] to adcValues[i] * scale - 1.0, as
+  // dspCore::scaleAdcValues() does. The ADC values are 12 bits.
+  void (*scaleAdcValues)(const isr_AdcValue_t adcValues[], double scaled[],
+                         uint32_t count, double scale);
+} dspDispatch_kernels_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The variants. Only call one that dspDispatch_isSupported() accepts.
+extern const dspDispatch_kernels_t dspDispatch_scalarKernels;
+#if defined(__x86_64__)
+extern const dspDispatch_kernels_t dspDispatch_sse2Kernels;
+extern const dspDispatch_kernels_t dspDispatch_avx2Kernels;
+#elif defined(__aarch64__)
+extern const dspDispatch_kernels_t dspDispatch_neonKernels;
+#endif
+
+// Returns true if this CPU can run kernels.
+bool dspDispatch_isSupported(const dspDispatch_kernels_t *kernels);
+
+// Returns the kernels to use: the ones DSP_DISPATCH_ENVIRONMENT_VARIABLE
+// names, or else the best ones this CPU supports. They are chosen on the
+// first call.
+const dspDispatch_kernels_t *dspDispatch_getKernels();
+
+// Checks each variant this CPU supports against the scalar kernels.
+bool dspDispatch_runTest();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DSPDISPATCH_H_ */
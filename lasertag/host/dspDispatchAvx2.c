@@ -0,0 +1,148 @@
+// AVX2 kernels, four doubles per vector. This file is built with -mavx2, so
+// nothing in it may run before dspDispatch_isSupported() has checked the CPU.
+// See dspDispatch.h.
+
+#include "dspDispatch.h"
+
+#if defined(__x86_64__)
+#ifndef __AVX2__
+#error "dspDispatchAvx2.c must be built with -mavx2."
+#endif
+#include <immintrin.h>
+
+#define DSP_DISPATCH_AVX2_LANES 4
+// _mm256_permute4x64_pd() control that reverses the lanes.
+#define DSP_DISPATCH_AVX2_REVERSE 0x1b
+
+static double horizontalSum(__m256d sum) {
+  __m128d pair =
+      _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+// Returns the sum of *(last - i) * coefficients[i] for i up to count.
+static double reversedDotProduct(const double last[],
+                                 const double coefficients[], uint32_t count) {
+  __m256d sum = _mm256_setzero_pd();
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_AVX2_LANES <= count; i += DSP_DISPATCH_AVX2_LANES) {
+    __m256d x =
+        _mm256_permute4x64_pd(_mm256_loadu_pd(last - i - 3),
+                              DSP_DISPATCH_AVX2_REVERSE);
+    sum = _mm256_add_pd(sum,
+                        _mm256_mul_pd(x, _mm256_loadu_pd(coefficients + i)));
+  }
+  double y = horizontalSum(sum);
+  for (; i < count; i++)
+    y += *(last - i) * coefficients[i];
+  return y;
+}
+
+static double firFilter(const double ring[], uint32_t ringSize,
+                        uint32_t oldest, const double coefficients[]) {
+  uint32_t newest = (oldest + FILTER_FIR_COEFFICIENT_COUNT - 1) % ringSize;
+  uint32_t firstCount = newest + 1 < FILTER_FIR_COEFFICIENT_COUNT
+                            ? newest + 1
+                            : FILTER_FIR_COEFFICIENT_COUNT;
+  // From the newest input back to the start of the array, then from the end
+  // of the array back to the oldest.
+  return reversedDotProduct(ring + newest, coefficients, firstCount) +
+         reversedDotProduct(ring + newest + ringSize - firstCount,
+                            coefficients + firstCount,
+                            FILTER_FIR_COEFFICIENT_COUNT - firstCount);
+}
+
+// Runs up to four channels in the lanes of one vector. Lanes past
+// channelCount repeat the last channel and are not stored.
+static void iirFilterLanes(const uint16_t channels[], uint16_t channelCount,
+                           const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double y[],
+                           double z[][FILTER_CORE_IIR_STATE_SIZE],
+                           uint16_t count) {
+  uint16_t c[DSP_DISPATCH_AVX2_LANES];
+  for (uint16_t lane = 0; lane < DSP_DISPATCH_AVX2_LANES; lane++)
+    c[lane] = channels[lane < channelCount ? lane : channelCount - 1];
+  __m256d laneB[FILTER_IIR_COEFFICIENT_COUNT];
+  __m256d laneA[FILTER_IIR_COEFFICIENT_COUNT];
+  __m256d laneZ[FILTER_CORE_IIR_STATE_SIZE];
+  for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++) {
+    laneB[i] = _mm256_set_pd(b[c[3]][i], b[c[2]][i], b[c[1]][i], b[c[0]][i]);
+    laneA[i] = _mm256_set_pd(a[c[3]][i], a[c[2]][i], a[c[1]][i], a[c[0]][i]);
+  }
+  for (uint16_t i = 0; i < FILTER_CORE_IIR_HISTORY_SIZE; i++)
+    laneZ[i] = _mm256_set_pd(z[c[3]][i], z[c[2]][i], z[c[1]][i], z[c[0]][i]);
+  // The same sums as dspCore::iirInterleaved(), in the same order.
+  const uint16_t history = FILTER_CORE_IIR_HISTORY_SIZE;
+  for (uint16_t n = 0; n < count; n++) {
+    __m256d ySum = _mm256_setzero_pd();
+    __m256d zSum = _mm256_setzero_pd();
+    for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++)
+      ySum = _mm256_add_pd(
+          ySum, _mm256_mul_pd(_mm256_set1_pd(y[history + n - i]), laneB[i]));
+    for (uint16_t i = 0; i < history; i++)
+      zSum = _mm256_add_pd(
+          zSum, _mm256_mul_pd(laneZ[history + n - 1 - i], laneA[i + 1]));
+    laneZ[history + n] = _mm256_sub_pd(ySum, zSum);
+  }
+  for (uint16_t n = 0; n < count; n++) {
+    double outputs[DSP_DISPATCH_AVX2_LANES];
+    _mm256_storeu_pd(outputs, laneZ[history + n]);
+    for (uint16_t lane = 0; lane < channelCount; lane++)
+      z[c[lane]][history + n] = outputs[lane];
+  }
+}
+
+static void iirFilterBank(uint16_t channelMask,
+                          const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double y[],
+                          double z[][FILTER_CORE_IIR_STATE_SIZE],
+                          uint16_t count) {
+  uint16_t channels[FILTER_FREQUENCY_COUNT];
+  uint16_t channelCount = 0;
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++)
+    if (channelMask & (1u << channel))
+      channels[channelCount++] = channel;
+  for (uint16_t first = 0; first < channelCount;
+       first += DSP_DISPATCH_AVX2_LANES) {
+    uint16_t laneCount = channelCount - first < DSP_DISPATCH_AVX2_LANES
+                             ? channelCount - first
+                             : DSP_DISPATCH_AVX2_LANES;
+    iirFilterLanes(channels + first, laneCount, b, a, y, z, count);
+  }
+}
+
+static double sumOfSquares(const double values[], uint32_t count, double sum) {
+  __m256d squares = _mm256_setzero_pd();
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_AVX2_LANES <= count; i += DSP_DISPATCH_AVX2_LANES) {
+    __m256d x = _mm256_loadu_pd(values + i);
+    squares = _mm256_add_pd(squares, _mm256_mul_pd(x, x));
+  }
+  sum += horizontalSum(squares);
+  for (; i < count; i++)
+    sum += values[i] * values[i];
+  return sum;
+}
+
+static void scaleAdcValues(const isr_AdcValue_t adcValues[], double scaled[],
+                           uint32_t count, double scale) {
+  __m256d factor = _mm256_set1_pd(scale);
+  __m256d one = _mm256_set1_pd(1.0);
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_AVX2_LANES <= count; i += DSP_DISPATCH_AVX2_LANES) {
+    // 12-bit values convert the same signed or unsigned.
+    __m256d x = _mm256_cvtepi32_pd(
+        _mm_loadu_si128((const __m128i *)(adcValues + i)));
+    _mm256_storeu_pd(scaled + i,
+                     _mm256_sub_pd(_mm256_mul_pd(x, factor), one));
+  }
+  for (; i < count; i++)
+    scaled[i] = adcValues[i] * scale - 1.0;
+}
+
+const dspDispatch_kernels_t dspDispatch_avx2Kernels = {
+    "avx2", firFilter, iirFilterBank, sumOfSquares, scaleAdcValues};
+
+#endif
@@ -0,0 +1,130 @@
+// NEON kernels, two doubles per vector. Advanced SIMD is part of 64-bit ARM,
+// so these run on any aarch64 CPU. See dspDispatch.h.
+
+#include "dspDispatch.h"
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+
+#define DSP_DISPATCH_NEON_LANES 2
+
+// Returns the sum of *(last - i) * coefficients[i] for i up to count.
+static double reversedDotProduct(const double last[],
+                                 const double coefficients[], uint32_t count) {
+  float64x2_t sum = vdupq_n_f64(0.0);
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_NEON_LANES <= count; i += DSP_DISPATCH_NEON_LANES) {
+    float64x2_t x = vld1q_f64(last - i - 1);
+    x = vextq_f64(x, x, 1); // Newest first.
+    sum = vaddq_f64(sum, vmulq_f64(x, vld1q_f64(coefficients + i)));
+  }
+  double y = vaddvq_f64(sum);
+  for (; i < count; i++)
+    y += *(last - i) * coefficients[i];
+  return y;
+}
+
+static double firFilter(const double ring[], uint32_t ringSize,
+                        uint32_t oldest, const double coefficients[]) {
+  uint32_t newest = (oldest + FILTER_FIR_COEFFICIENT_COUNT - 1) % ringSize;
+  uint32_t firstCount = newest + 1 < FILTER_FIR_COEFFICIENT_COUNT
+                            ? newest + 1
+                            : FILTER_FIR_COEFFICIENT_COUNT;
+  // From the newest input back to the start of the array, then from the end
+  // of the array back to the oldest.
+  return reversedDotProduct(ring + newest, coefficients, firstCount) +
+         reversedDotProduct(ring + newest + ringSize - firstCount,
+                            coefficients + firstCount,
+                            FILTER_FIR_COEFFICIENT_COUNT - firstCount);
+}
+
+// Runs up to two channels in the lanes of one vector. Lanes past
+// channelCount repeat the last channel and are not stored.
+static void iirFilterLanes(const uint16_t channels[], uint16_t channelCount,
+                           const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double y[],
+                           double z[][FILTER_CORE_IIR_STATE_SIZE],
+                           uint16_t count) {
+  uint16_t c[DSP_DISPATCH_NEON_LANES];
+  for (uint16_t lane = 0; lane < DSP_DISPATCH_NEON_LANES; lane++)
+    c[lane] = channels[lane < channelCount ? lane : channelCount - 1];
+  float64x2_t laneB[FILTER_IIR_COEFFICIENT_COUNT];
+  float64x2_t laneA[FILTER_IIR_COEFFICIENT_COUNT];
+  float64x2_t laneZ[FILTER_CORE_IIR_STATE_SIZE];
+  for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++) {
+    laneB[i] = vcombine_f64(vdup_n_f64(b[c[0]][i]), vdup_n_f64(b[c[1]][i]));
+    laneA[i] = vcombine_f64(vdup_n_f64(a[c[0]][i]), vdup_n_f64(a[c[1]][i]));
+  }
+  for (uint16_t i = 0; i < FILTER_CORE_IIR_HISTORY_SIZE; i++)
+    laneZ[i] = vcombine_f64(vdup_n_f64(z[c[0]][i]), vdup_n_f64(z[c[1]][i]));
+  // The same sums as dspCore::iirInterleaved(), in the same order.
+  const uint16_t history = FILTER_CORE_IIR_HISTORY_SIZE;
+  for (uint16_t n = 0; n < count; n++) {
+    float64x2_t ySum = vdupq_n_f64(0.0);
+    float64x2_t zSum = vdupq_n_f64(0.0);
+    for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++)
+      ySum = vaddq_f64(ySum, vmulq_n_f64(laneB[i], y[history + n - i]));
+    for (uint16_t i = 0; i < history; i++)
+      zSum = vaddq_f64(zSum,
+                       vmulq_f64(laneZ[history + n - 1 - i], laneA[i + 1]));
+    laneZ[history + n] = vsubq_f64(ySum, zSum);
+  }
+  for (uint16_t n = 0; n < count; n++) {
+    double outputs[DSP_DISPATCH_NEON_LANES];
+    vst1q_f64(outputs, laneZ[history + n]);
+    for (uint16_t lane = 0; lane < channelCount; lane++)
+      z[c[lane]][history + n] = outputs[lane];
+  }
+}
+
+static void iirFilterBank(uint16_t channelMask,
+                          const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double y[],
+                          double z[][FILTER_CORE_IIR_STATE_SIZE],
+                          uint16_t count) {
+  uint16_t channels[FILTER_FREQUENCY_COUNT];
+  uint16_t channelCount = 0;
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++)
+    if (channelMask & (1u << channel))
+      channels[channelCount++] = channel;
+  for (uint16_t first = 0; first < channelCount;
+       first += DSP_DISPATCH_NEON_LANES) {
+    uint16_t laneCount = channelCount - first < DSP_DISPATCH_NEON_LANES
+                             ? channelCount - first
+                             : DSP_DISPATCH_NEON_LANES;
+    iirFilterLanes(channels + first, laneCount, b, a, y, z, count);
+  }
+}
+
+static double sumOfSquares(const double values[], uint32_t count, double sum) {
+  float64x2_t squares = vdupq_n_f64(0.0);
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_NEON_LANES <= count; i += DSP_DISPATCH_NEON_LANES) {
+    float64x2_t x = vld1q_f64(values + i);
+    squares = vaddq_f64(squares, vmulq_f64(x, x));
+  }
+  sum += vaddvq_f64(squares);
+  for (; i < count; i++)
+    sum += values[i] * values[i];
+  return sum;
+}
+
+static void scaleAdcValues(const isr_AdcValue_t adcValues[], double scaled[],
+                           uint32_t count, double scale) {
+  float64x2_t factor = vdupq_n_f64(scale);
+  float64x2_t one = vdupq_n_f64(1.0);
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_NEON_LANES <= count; i += DSP_DISPATCH_NEON_LANES) {
+    float64x2_t x = vcvtq_f64_u64(vmovl_u32(vld1_u32(adcValues + i)));
+    vst1q_f64(scaled + i, vsubq_f64(vmulq_f64(x, factor), one));
+  }
+  for (; i < count; i++)
+    scaled[i] = adcValues[i] * scale - 1.0;
+}
+
+const dspDispatch_kernels_t dspDispatch_neonKernels = {
+    "neon", firFilter, iirFilterBank, sumOfSquares, scaleAdcValues};
+
+#endif
@@ -0,0 +1,137 @@
+// SSE2 kernels, two doubles per vector. SSE2 is part of x86-64, so these run
+// on any 64-bit x86 CPU. See dspDispatch.h.
+
+#include "dspDispatch.h"
+
+#if defined(__x86_64__)
+#include <emmintrin.h>
+
+#define DSP_DISPATCH_SSE2_LANES 2
+
+static double horizontalSum(__m128d sum) {
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+// Returns the sum of *(last - i) * coefficients[i] for i up to count.
+static double reversedDotProduct(const double last[],
+                                 const double coefficients[], uint32_t count) {
+  __m128d sum = _mm_setzero_pd();
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_SSE2_LANES <= count; i += DSP_DISPATCH_SSE2_LANES) {
+    __m128d x = _mm_loadu_pd(last - i - 1);
+    x = _mm_shuffle_pd(x, x, 1); // Newest first.
+    sum = _mm_add_pd(sum, _mm_mul_pd(x, _mm_loadu_pd(coefficients + i)));
+  }
+  double y = horizontalSum(sum);
+  for (; i < count; i++)
+    y += *(last - i) * coefficients[i];
+  return y;
+}
+
+static double firFilter(const double ring[], uint32_t ringSize,
+                        uint32_t oldest, const double coefficients[]) {
+  uint32_t newest = (oldest + FILTER_FIR_COEFFICIENT_COUNT - 1) % ringSize;
+  uint32_t firstCount = newest + 1 < FILTER_FIR_COEFFICIENT_COUNT
+                            ? newest + 1
+                            : FILTER_FIR_COEFFICIENT_COUNT;
+  // From the newest input back to the start of the array, then from the end
+  // of the array back to the oldest.
+  return reversedDotProduct(ring + newest, coefficients, firstCount) +
+         reversedDotProduct(ring + newest + ringSize - firstCount,
+                            coefficients + firstCount,
+                            FILTER_FIR_COEFFICIENT_COUNT - firstCount);
+}
+
+// Runs up to two channels in the lanes of one vector. Lanes past
+// channelCount repeat the last channel and are not stored.
+static void iirFilterLanes(const uint16_t channels[], uint16_t channelCount,
+                           const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                           const double y[],
+                           double z[][FILTER_CORE_IIR_STATE_SIZE],
+                           uint16_t count) {
+  uint16_t c[DSP_DISPATCH_SSE2_LANES];
+  for (uint16_t lane = 0; lane < DSP_DISPATCH_SSE2_LANES; lane++)
+    c[lane] = channels[lane < channelCount ? lane : channelCount - 1];
+  __m128d laneB[FILTER_IIR_COEFFICIENT_COUNT];
+  __m128d laneA[FILTER_IIR_COEFFICIENT_COUNT];
+  __m128d laneZ[FILTER_CORE_IIR_STATE_SIZE];
+  for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++) {
+    laneB[i] = _mm_set_pd(b[c[1]][i], b[c[0]][i]);
+    laneA[i] = _mm_set_pd(a[c[1]][i], a[c[0]][i]);
+  }
+  for (uint16_t i = 0; i < FILTER_CORE_IIR_HISTORY_SIZE; i++)
+    laneZ[i] = _mm_set_pd(z[c[1]][i], z[c[0]][i]);
+  // The same sums as dspCore::iirInterleaved(), in the same order.
+  const uint16_t history = FILTER_CORE_IIR_HISTORY_SIZE;
+  for (uint16_t n = 0; n < count; n++) {
+    __m128d ySum = _mm_setzero_pd();
+    __m128d zSum = _mm_setzero_pd();
+    for (uint16_t i = 0; i < FILTER_IIR_COEFFICIENT_COUNT; i++)
+      ySum = _mm_add_pd(ySum,
+                        _mm_mul_pd(_mm_set1_pd(y[history + n - i]), laneB[i]));
+    for (uint16_t i = 0; i < history; i++)
+      zSum = _mm_add_pd(zSum,
+                        _mm_mul_pd(laneZ[history + n - 1 - i], laneA[i + 1]));
+    laneZ[history + n] = _mm_sub_pd(ySum, zSum);
+  }
+  for (uint16_t n = 0; n < count; n++) {
+    double outputs[DSP_DISPATCH_SSE2_LANES];
+    _mm_storeu_pd(outputs, laneZ[history + n]);
+    for (uint16_t lane = 0; lane < channelCount; lane++)
+      z[c[lane]][history + n] = outputs[lane];
+  }
+}
+
+static void iirFilterBank(uint16_t channelMask,
+                          const double b[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double a[][FILTER_IIR_COEFFICIENT_COUNT],
+                          const double y[],
+                          double z[][FILTER_CORE_IIR_STATE_SIZE],
+                          uint16_t count) {
+  uint16_t channels[FILTER_FREQUENCY_COUNT];
+  uint16_t channelCount = 0;
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++)
+    if (channelMask & (1u << channel))
+      channels[channelCount++] = channel;
+  for (uint16_t first = 0; first < channelCount;
+       first += DSP_DISPATCH_SSE2_LANES) {
+    uint16_t laneCount = channelCount - first < DSP_DISPATCH_SSE2_LANES
+                             ? channelCount - first
+                             : DSP_DISPATCH_SSE2_LANES;
+    iirFilterLanes(channels + first, laneCount, b, a, y, z, count);
+  }
+}
+
+static double sumOfSquares(const double values[], uint32_t count, double sum) {
+  __m128d squares = _mm_setzero_pd();
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_SSE2_LANES <= count; i += DSP_DISPATCH_SSE2_LANES) {
+    __m128d x = _mm_loadu_pd(values + i);
+    squares = _mm_add_pd(squares, _mm_mul_pd(x, x));
+  }
+  sum += horizontalSum(squares);
+  for (; i < count; i++)
+    sum += values[i] * values[i];
+  return sum;
+}
+
+static void scaleAdcValues(const isr_AdcValue_t adcValues[], double scaled[],
+                           uint32_t count, double scale) {
+  __m128d factor = _mm_set1_pd(scale);
+  __m128d one = _mm_set1_pd(1.0);
+  uint32_t i = 0;
+  for (; i + DSP_DISPATCH_SSE2_LANES <= count; i += DSP_DISPATCH_SSE2_LANES) {
+    // 12-bit values convert the same signed or unsigned.
+    __m128d x =
+        _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i *)(adcValues + i)));
+    _mm_storeu_pd(scaled + i, _mm_sub_pd(_mm_mul_pd(x, factor), one));
+  }
+  for (; i < count; i++)
+    scaled[i] = adcValues[i] * scale - 1.0;
+}
+
+const dspDispatch_kernels_t dspDispatch_sse2Kernels = {
+    "sse2", firFilter, iirFilterBank, sumOfSquares, scaleAdcValues};
+
+#endif
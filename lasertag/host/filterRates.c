@@ -0,0 +1,203 @@
+// Plays the same shots through isr_function() and detector() at the ADC rate
+// this copy was built for (see FILTER_SAMPLE_FREQUENCY_IN_KHZ in filter.h) and
+// reports where and when each one was detected, and how far its channel stood
+// out from the others. CMake builds one copy per rate; the 100 kHz results are
+// the reference the others are compared with.
+//
+// Usage: filterRates [--output file] [--compare file]
+//
+// The designed filter coefficients are checked first with filter_runTest().
+// Each shot is a 200 ms square wave at one player frequency in light noise,
+// followed by enough quiet for the lockout to expire. With --compare, each
+// shot must be detected on the same frequency as in the reference, within
+// FILTER_RATES_MAX_LATENCY_DIFFERENCE_MS, with a selectivity within
+// FILTER_RATES_MAX_SELECTIVITY_DIFFERENCE_DB, and nothing else may be
+// detected.
+
+#include "detector.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FILTER_RATES_QUIET_BEFORE_MS 300
+#define FILTER_RATES_SHOT_MS 200
+#define FILTER_RATES_QUIET_AFTER_MS 700 // Longer than the lockout.
+#define FILTER_RATES_ADC_MIDSCALE 2048
+#define FILTER_RATES_SHOT_AMPLITUDE 300 // In ADC counts.
+#define FILTER_RATES_NOISE_AMPLITUDE 40
+// The noise changes at 50 kHz, the lowest rate, so that every rate sees the
+// same input.
+#define FILTER_RATES_NOISE_TICKS (FILTER_SAMPLE_FREQUENCY_IN_KHZ / 50)
+#define FILTER_RATES_MAX_LATENCY_DIFFERENCE_MS 1.0
+#define FILTER_RATES_MAX_SELECTIVITY_DIFFERENCE_DB 0.5
+#define FILTER_RATES_NO_HIT -1
+#define INTERRUPTS_CURRENTLY_DISABLED false
+
+// What the detector made of one shot.
+typedef struct {
+  int32_t frequencyNumber; // FILTER_RATES_NO_HIT if it was missed.
+  double latencyMs;        // From the start of the shot to the hit.
+  // Power of the shot's channel over the strongest other channel at the end
+  // of the shot, in dB.
+  double selectivityDb;
+  uint32_t extraHitCount; // Hits other than the first.
+} filterRates_result_t;
+
+static uint32_t randomState = 1;
+
+// Small LCG so that runs are repeatable across hosts.
+static int32_t filterRates_noise() {
+  randomState = randomState * 1664525 + 1013904223;
+  return (int32_t)(randomState >> 16) % (2 * FILTER_RATES_NOISE_AMPLITUDE + 1) -
+         FILTER_RATES_NOISE_AMPLITUDE;
+}
+
+// Runs the ISR and the detector for durationMs. If frequencyNumber is a valid
+// frequency, the ADC sees a square wave at that player frequency, split into
+// halves the way the transmitter does it.
+static void filterRates_play(uint32_t durationMs, int32_t frequencyNumber) {
+  uint32_t period = (frequencyNumber == FILTER_RATES_NO_HIT)
+                        ? 0
+                        : filter_frequencyTickTable[frequencyNumber];
+  static int32_t noise = 0;
+  for (uint32_t tick = 0; tick < durationMs * ISR_TICKS_PER_MS; tick++) {
+    if (tick % FILTER_RATES_NOISE_TICKS == 0)
+      noise = filterRates_noise();
+    int32_t value = FILTER_RATES_ADC_MIDSCALE + noise;
+    if (period)
+      value += (tick % period < period / 2) ? FILTER_RATES_SHOT_AMPLITUDE
+                                            : -FILTER_RATES_SHOT_AMPLITUDE;
+    hostBoard_setAdcData(value);
+    isr_function();
+    // A main loop pass for every decimated output keeps the buffer short.
+    if (tick % FILTER_FIR_DECIMATION_FACTOR == FILTER_FIR_DECIMATION_FACTOR - 1)
+      detector(INTERRUPTS_CURRENTLY_DISABLED);
+  }
+}
+
+// Plays one shot per player frequency and records what was detected.
+static void filterRates_run(filterRates_result_t results[]) {
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  isr_init();
+  detector_init(ignoredFrequencies);
+  for (int32_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    filterRates_play(FILTER_RATES_QUIET_BEFORE_MS, FILTER_RATES_NO_HIT);
+    detector_sampleIndex_t shotStart = detector_getSampleIndex();
+    filterRates_play(FILTER_RATES_SHOT_MS, f);
+    filterRates_result_t *result = &results[f];
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    filter_getCurrentPowerValues(powerValues);
+    double strongestOther = 0.0;
+    for (int32_t g = 0; g < FILTER_FREQUENCY_COUNT; g++)
+      if (g != f)
+        strongestOther = fmax(strongestOther, powerValues[g]);
+    result->selectivityDb = 10.0 * log10(powerValues[f] / strongestOther);
+    filterRates_play(FILTER_RATES_QUIET_AFTER_MS, FILTER_RATES_NO_HIT);
+    result->frequencyNumber = FILTER_RATES_NO_HIT;
+    result->latencyMs = 0.0;
+    result->extraHitCount = 0;
+    detector_hitEvent_t event;
+    while (detector_popHitEvent(&event)) {
+      if (result->frequencyNumber != FILTER_RATES_NO_HIT) {
+        result->extraHitCount++;
+        continue;
+      }
+      result->frequencyNumber = event.frequencyNumber;
+      result->latencyMs =
+          (double)(event.sampleIndex - shotStart) / ISR_TICKS_PER_MS;
+    }
+    detector_clearHit();
+  }
+}
+
+// Reads results written by --output. Returns false if the file is unusable.
+static bool filterRates_read(const char *fileName,
+                             filterRates_result_t results[]) {
+  FILE *file = fopen(fileName, "r");
+  if (file == NULL) {
+    perror(fileName);
+    return false;
+  }
+  char line[128];
+  uint16_t count = 0;
+  while (fgets(line, sizeof(line), file) && count < FILTER_FREQUENCY_COUNT) {
+    int shot;
+    filterRates_result_t *result = &results[count];
+    if (sscanf(line,
+               "shot %d: frequency %d at %lf ms, selectivity %lf dB, %u extra",
+               &shot, &result->frequencyNumber, &result->latencyMs,
+               &result->selectivityDb, &result->extraHitCount) == 5)
+      count++;
+  }
+  fclose(file);
+  return count == FILTER_FREQUENCY_COUNT;
+}
+
+// Returns true if a shot was detected the same way as in the reference.
+static bool filterRates_matches(const filterRates_result_t *result,
+                                const filterRates_result_t *reference) {
+  if (result->frequencyNumber != reference->frequencyNumber ||
+      result->extraHitCount != reference->extraHitCount)
+    return false;
+  if (fabs(result->selectivityDb - reference->selectivityDb) >
+      FILTER_RATES_MAX_SELECTIVITY_DIFFERENCE_DB)
+    return false;
+  return result->frequencyNumber == FILTER_RATES_NO_HIT ||
+         fabs(result->latencyMs - reference->latencyMs) <=
+             FILTER_RATES_MAX_LATENCY_DIFFERENCE_MS;
+}
+
+int main(int argc, char *argv[]) {
+  const char *outputFileName = NULL;
+  const char *referenceFileName = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--output") && i + 1 < argc) {
+      outputFileName = argv[++i];
+    } else if (!strcmp(argv[i], "--compare") && i + 1 < argc) {
+      referenceFileName = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--output file] [--compare file]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  filterRates_result_t results[FILTER_FREQUENCY_COUNT];
+  filterRates_result_t reference[FILTER_FREQUENCY_COUNT];
+  if (referenceFileName && !filterRates_read(referenceFileName, reference))
+    return EXIT_FAILURE;
+  bool success = filter_runTest();
+  filterRates_run(results);
+
+  FILE *out = outputFileName ? fopen(outputFileName, "w") : stdout;
+  if (out == NULL) {
+    perror(outputFileName);
+    return EXIT_FAILURE;
+  }
+  printf("filterRates: %d kHz, decimated by %d, %d FIR taps\n",
+         FILTER_SAMPLE_FREQUENCY_IN_KHZ, FILTER_FIR_DECIMATION_FACTOR,
+         filter_getFirCoefficientCount());
+  for (uint16_t f = 0; f < FILTER_FREQUENCY_COUNT; f++) {
+    fprintf(out,
+            "shot %d: frequency %d at %.1f ms, selectivity %.2f dB, %u extra\n",
+            f, results[f].frequencyNumber, results[f].latencyMs,
+            results[f].selectivityDb, results[f].extraHitCount);
+    // Every shot must at least be detected on its own frequency.
+    success &= results[f].frequencyNumber == f;
+    if (referenceFileName && !filterRates_matches(&results[f], &reference[f])) {
+      printf("filterRates: shot %d differs from the reference (frequency %d "
+             "at %.1f ms, selectivity %.2f dB, %u extra).\n",
+             f, reference[f].frequencyNumber, reference[f].latencyMs,
+             reference[f].selectivityDb, reference[f].extraHitCount);
+      success = false;
+    }
+  }
+  if (out != stdout)
+    fclose(out);
+  printf("filterRates: %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
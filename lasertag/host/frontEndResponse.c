@@ -0,0 +1,162 @@
+// Sweeps the front end of the receive chain (everything ahead of the IIR
+// filters) with the square waves filterTest_runSquareWaveFirPowerTest() uses:
+// the ten player frequencies, then out-of-band frequencies up to the Nyquist
+// rate. Each is fed through filter_addNewInput() and the decimating
+// filter_firFilter() for one pulse width, and the mean output power is
+// reported in dB (a full-scale square wave is 0 dB). CMake builds one copy
+// with the single FIR-filter and one with FILTER_MULTISTAGE_DECIMATION_ENABLED;
+// the single FIR-filter is the reference.
+//
+// Usage: frontEndResponse [--output file] [--compare file]
+//
+// With --compare, the player frequencies must be within
+// FRONT_END_MAX_PASSBAND_DIFFERENCE_DB of the reference, and out-of-band
+// frequencies that land between the player frequencies after decimation may
+// leak at most FRONT_END_MAX_STOPBAND_EXCESS_DB more than the reference.
+
+#include "filter.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FRONT_END_OUT_OF_BAND_COUNT 11
+#define FRONT_END_TEST_COUNT (FILTER_FREQUENCY_COUNT + FRONT_END_OUT_OF_BAND_COUNT)
+#define FRONT_END_PULSE_WIDTH_MS 200
+#define FRONT_END_MAX_PASSBAND_DIFFERENCE_DB 0.5
+#define FRONT_END_MAX_STOPBAND_EXCESS_DB 3.0
+// The highest player frequency. Anything that aliases to below this after
+// decimation competes with a player.
+#define FRONT_END_MAX_PLAYER_FREQUENCY_IN_HZ 4200.0
+#define FRONT_END_HZ_PER_KHZ 1000.0
+#define FRONT_END_MIN_POWER 1.0E-30 // Keeps the logarithm finite.
+
+// The same out-of-band periods as filterTest.c, in ticks of a 100 kHz clock.
+static const uint16_t frontEndResponse_outOfBandTicks
+    [FRONT_END_OUT_OF_BAND_COUNT] = {22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2};
+
+// Returns the period of test i in ticks of the ADC clock.
+static uint16_t frontEndResponse_period(uint16_t i) {
+  return i < FILTER_FREQUENCY_COUNT
+             ? filter_frequencyTickTable[i]
+             : FILTER_TICKS_FROM_100_KHZ(
+                   frontEndResponse_outOfBandTicks[i - FILTER_FREQUENCY_COUNT]);
+}
+
+// Returns true if test i is out of band and lands among the player
+// frequencies after decimation.
+static bool frontEndResponse_aliasesIntoBand(uint16_t i) {
+  if (i < FILTER_FREQUENCY_COUNT)
+    return false;
+  double rate = FILTER_SAMPLE_FREQUENCY_IN_KHZ * FRONT_END_HZ_PER_KHZ;
+  double decimatedRate = FILTER_DECIMATED_FREQUENCY_IN_KHZ * FRONT_END_HZ_PER_KHZ;
+  double alias = fmod(rate / frontEndResponse_period(i), decimatedRate);
+  alias = fmin(alias, decimatedRate - alias);
+  return alias <= FRONT_END_MAX_PLAYER_FREQUENCY_IN_HZ;
+}
+
+// Returns the mean power, in dB, of the decimated output for a square wave of
+// the given period.
+static double frontEndResponse_measure(uint16_t period) {
+  filter_init();
+  double power = 0.0;
+  uint32_t outputCount = 0;
+  uint32_t tickCount = FRONT_END_PULSE_WIDTH_MS * FILTER_SAMPLE_FREQUENCY_IN_KHZ;
+  for (uint32_t tick = 0; tick < tickCount; tick++) {
+    filter_addNewInput((tick % period < period / 2) ? 1.0 : -1.0);
+    if (tick % FILTER_FIR_DECIMATION_FACTOR == FILTER_FIR_DECIMATION_FACTOR - 1) {
+      double y = filter_firFilter();
+      power += y * y;
+      outputCount++;
+    }
+  }
+  return 10.0 * log10(fmax(power / outputCount, FRONT_END_MIN_POWER));
+}
+
+// Reads responses written by --output. Returns false if the file is unusable.
+static bool frontEndResponse_read(const char *fileName, double responses[]) {
+  FILE *file = fopen(fileName, "r");
+  if (file == NULL) {
+    perror(fileName);
+    return false;
+  }
+  char line[128];
+  uint16_t count = 0;
+  while (fgets(line, sizeof(line), file) && count < FRONT_END_TEST_COUNT) {
+    int test;
+    double frequency;
+    if (sscanf(line, "test %d: %lf Hz, %lf dB", &test, &frequency,
+               &responses[count]) == 3)
+      count++;
+  }
+  fclose(file);
+  return count == FRONT_END_TEST_COUNT;
+}
+
+int main(int argc, char *argv[]) {
+  const char *outputFileName = NULL;
+  const char *referenceFileName = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--output") && i + 1 < argc) {
+      outputFileName = argv[++i];
+    } else if (!strcmp(argv[i], "--compare") && i + 1 < argc) {
+      referenceFileName = argv[++i];
+    } else {
+      fprintf(stderr, "usage: %s [--output file] [--compare file]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  double reference[FRONT_END_TEST_COUNT];
+  if (referenceFileName && !frontEndResponse_read(referenceFileName, reference))
+    return EXIT_FAILURE;
+  FILE *out = outputFileName ? fopen(outputFileName, "w") : stdout;
+  if (out == NULL) {
+    perror(outputFileName);
+    return EXIT_FAILURE;
+  }
+
+  // Multiplies per ADC sample: the FIR-filter runs once per decimated output.
+  // The CIC filter only adds.
+  filter_init();
+  printf("frontEndResponse: %d kHz, decimated by %d, %.1f multiplies per ADC "
+         "sample",
+         FILTER_SAMPLE_FREQUENCY_IN_KHZ, FILTER_FIR_DECIMATION_FACTOR,
+         (double)filter_getFirCoefficientCount() / FILTER_FIR_DECIMATION_FACTOR);
+#ifdef FILTER_MULTISTAGE_DECIMATION_ENABLED
+  printf(" (%d-stage CIC decimating by %d, %d-tap FIR decimating by %d)",
+         FILTER_CIC_STAGE_COUNT, FILTER_CIC_DECIMATION_FACTOR,
+         filter_getFirCoefficientCount(), FILTER_COMPENSATOR_DECIMATION_FACTOR);
+#else
+  printf(" (%d-tap FIR)", filter_getFirCoefficientCount());
+#endif
+  printf("\n");
+
+  bool success = true;
+  for (uint16_t i = 0; i < FRONT_END_TEST_COUNT; i++) {
+    uint16_t period = frontEndResponse_period(i);
+    double frequency =
+        FILTER_SAMPLE_FREQUENCY_IN_KHZ * FRONT_END_HZ_PER_KHZ / period;
+    double response = frontEndResponse_measure(period);
+    fprintf(out, "test %d: %.0f Hz, %.2f dB\n", i, frequency, response);
+    if (!referenceFileName)
+      continue;
+    bool matches = true;
+    if (i < FILTER_FREQUENCY_COUNT)
+      matches = fabs(response - reference[i]) <=
+                FRONT_END_MAX_PASSBAND_DIFFERENCE_DB;
+    else if (frontEndResponse_aliasesIntoBand(i))
+      matches = response <= reference[i] + FRONT_END_MAX_STOPBAND_EXCESS_DB;
+    if (!matches) {
+      printf("frontEndResponse: %.0f Hz is at %.2f dB, %.2f dB in the "
+             "reference.\n",
+             frequency, response, reference[i]);
+      success = false;
+    }
+  }
+  if (out != stdout)
+    fclose(out);
+  printf("frontEndResponse: %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
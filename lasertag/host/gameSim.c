@@ -0,0 +1,490 @@
+// Plays a game between virtual players on the host. Each player is a gun with
+// its own trigger.c, transmitter.c and detector.c. The lasertag modules keep
+// their state in globals, so every player runs in a worker process of its own;
+// --jobs of them run at a time, one per core by default.
+//
+// Usage: gameSim [--players n] [--seconds s] [--jobs n] [--seed n]
+//                [--attenuation-db d] [--spread-db d] [--stray-db d]
+//                [--ambient counts] [--noise counts]
+//                [--multipath-us t] [--multipath-db d]
+//                [--min-accuracy fraction] [--max-false-positives n] [--quiet]
+//
+// The game runs in two phases:
+// 1. Transmit: every player pulls its trigger at random times, aimed at a
+//    random other player. trigger_tick() and transmitter_tick() run for the
+//    whole game and the transmitter pin is recorded in shared memory.
+// 2. Receive: every player's ADC sees the other players' recorded pins through
+//    the optical channel model, and isr_function() and detector() run on it.
+//
+// Channel model, per sample:
+//   adc = ambient + noise + sum over shooters of pin * path * (1 + echo)
+// where path is GAME_SIM_FULL_SCALE_COUNTS attenuated by --attenuation-db plus
+// a fixed random amount up to --spread-db for each pair of players, and by
+// another --stray-db when the shooter is aiming elsewhere. The echo is the same
+// pin --multipath-us earlier, --multipath-db down. Noise is uniform within
+// +-noise counts.
+//
+// A shot aimed at a player counts as a hit if that player detects the
+// shooter's frequency while the shot is still in the power window, that is by
+// FILTER_POWER_WINDOW_MS after it ends. Any other detection is a false
+// positive. Shots that start while their target is locked out after a hit are
+// not expected to be detected and are counted separately. Like runningModes.c,
+// each player ignores its own frequency, so shots between players that share a
+// frequency (more than FILTER_FREQUENCY_COUNT players) are not scored. Exits
+// non-zero if the accuracy or false positives are out of the given bounds.
+
+#include "detector.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include "lockoutTimer.h"
+#include "mio.h"
+#include "transmitter.h"
+#include "trigger.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define GAME_SIM_MAX_PLAYERS 64
+#define GAME_SIM_DEFAULT_PLAYERS FILTER_FREQUENCY_COUNT
+#define GAME_SIM_DEFAULT_SECONDS 10
+#define GAME_SIM_MS_PER_SECOND 1000
+#define GAME_SIM_US_PER_MS 1000
+#define GAME_SIM_NS_PER_SECOND 1.0E9
+// Triggers are pulled at least this far apart, so that every pull fires, and
+// on average every GAME_SIM_MEAN_SHOT_INTERVAL_MS.
+#define GAME_SIM_MIN_SHOT_INTERVAL_MS 400
+#define GAME_SIM_MEAN_SHOT_INTERVAL_MS 2000
+#define GAME_SIM_TRIGGER_PRESS_MS 50
+#define GAME_SIM_TRIGGER_MIO_PIN 10 // As in trigger.c.
+#define GAME_SIM_MAX_HIT_EVENTS 64 // Taken from the detector at a time.
+// ADC counts added by an unattenuated beam.
+#define GAME_SIM_FULL_SCALE_COUNTS 1000.0
+#define GAME_SIM_ADC_MAX 4095
+#define GAME_SIM_BITS_PER_WORD 64
+#define GAME_SIM_NOT_FIRED UINT32_MAX
+#define INTERRUPTS_CURRENTLY_DISABLED false
+
+// Game and channel settings, from the command line.
+typedef struct {
+  uint16_t playerCount;
+  uint32_t seconds;
+  uint16_t jobCount;
+  uint32_t seed;
+  double attenuationDb;
+  double spreadDb;
+  double strayDb;
+  double ambientCounts;
+  double noiseCounts;
+  double multipathUs;
+  double multipathDb;
+  double minAccuracy;
+  int32_t maxFalsePositives; // Negative for no limit.
+  bool quiet;
+} gameSim_settings_t;
+
+// One trigger pull.
+typedef struct {
+  uint32_t pressTick;
+  int16_t target;
+  uint32_t startTick; // When the transmitter started, or GAME_SIM_NOT_FIRED.
+  bool hit;
+} gameSim_shot_t;
+
+// What one player's detector made of the game.
+typedef struct {
+  uint32_t aimedAtCount;   // Scored shots aimed at this player.
+  uint32_t hitCount;       // Of those, the ones it detected.
+  uint32_t lockedOutCount; // Not scored: they came in during the lockout.
+  uint32_t falsePositiveCount;
+  uint64_t detectNs; // Wall time of the receive phase.
+} gameSim_result_t;
+
+static gameSim_settings_t settings = {
+    .playerCount = GAME_SIM_DEFAULT_PLAYERS,
+    .seconds = GAME_SIM_DEFAULT_SECONDS,
+    .jobCount = 0, // One per core.
+    .seed = 1,
+    .attenuationDb = 6.0,
+    .spreadDb = 6.0,
+    .strayDb = 40.0,
+    .ambientCounts = 500.0,
+    .noiseCounts = 40.0,
+    .multipathUs = 150.0,
+    .multipathDb = 10.0,
+    .minAccuracy = 0.0,
+    .maxFalsePositives = -1,
+    .quiet = false};
+
+// Shared with the workers. Each player's pin recording, shot start ticks and
+// result are only written by the worker that runs that player; the hit flag of
+// a shot only by the worker that runs its target.
+static uint32_t tickCount;
+static uint32_t maxShotCount;
+static uint32_t waveformWordCount;
+static uint16_t *shotCounts;
+static gameSim_shot_t *shots;
+static uint64_t *waveforms;
+static gameSim_result_t *results;
+// Amplitude of the path from shooter to receiver, in ADC counts.
+static double pathCounts[GAME_SIM_MAX_PLAYERS][GAME_SIM_MAX_PLAYERS];
+
+// xorshift32, so that games are repeatable across hosts. The low bits of an
+// LCG repeat too quickly for noise: they would show up as tones in the
+// filters. state must not be 0.
+static uint32_t gameSim_random(uint32_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+  return *state;
+}
+
+// Returns a random number in [0, 1).
+static double gameSim_randomFraction(uint32_t *state) {
+  return gameSim_random(state) / 4294967296.0;
+}
+
+// Returns the frequency a player transmits on and ignores.
+static uint16_t gameSim_frequency(uint16_t player) {
+  return player % FILTER_FREQUENCY_COUNT;
+}
+
+static gameSim_shot_t *gameSim_shot(uint16_t player, uint32_t index) {
+  return &shots[player * maxShotCount + index];
+}
+
+static bool gameSim_pin(uint16_t player, uint32_t tick) {
+  const uint64_t *waveform = &waveforms[player * waveformWordCount];
+  return (waveform[tick / GAME_SIM_BITS_PER_WORD] >>
+          (tick % GAME_SIM_BITS_PER_WORD)) &
+         1;
+}
+
+// Returns shared memory the workers can write to, zeroed.
+static void *gameSim_share(size_t size) {
+  void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    perror("mmap");
+    exit(EXIT_FAILURE);
+  }
+  return memory;
+}
+
+// Picks when every player pulls its trigger and who it aims at, and the
+// attenuation of every path.
+static void gameSim_plan() {
+  uint32_t state = settings.seed;
+  uint32_t minInterval = GAME_SIM_MIN_SHOT_INTERVAL_MS * ISR_TICKS_PER_MS;
+  uint32_t extraInterval =
+      2 * (GAME_SIM_MEAN_SHOT_INTERVAL_MS - GAME_SIM_MIN_SHOT_INTERVAL_MS) *
+      ISR_TICKS_PER_MS;
+  for (uint16_t p = 0; p < settings.playerCount; p++) {
+    uint32_t tick = gameSim_random(&state) % extraInterval;
+    shotCounts[p] = 0;
+    while (tick < tickCount && shotCounts[p] < maxShotCount) {
+      gameSim_shot_t *shot = gameSim_shot(p, shotCounts[p]++);
+      shot->pressTick = tick;
+      shot->target = (p + 1 + gameSim_random(&state) %
+                                  (settings.playerCount - 1)) %
+                     settings.playerCount;
+      shot->startTick = GAME_SIM_NOT_FIRED;
+      tick += minInterval + gameSim_random(&state) % extraInterval;
+    }
+    for (uint16_t r = 0; r < settings.playerCount; r++) {
+      double db = settings.attenuationDb +
+                  settings.spreadDb * gameSim_randomFraction(&state);
+      pathCounts[p][r] = GAME_SIM_FULL_SCALE_COUNTS * pow(10.0, -db / 20.0);
+    }
+  }
+}
+
+// Runs one gun's trigger and transmitter for the whole game and records the
+// transmitter pin.
+static void gameSim_transmit(uint16_t player) {
+  uint64_t *waveform = &waveforms[player * waveformWordCount];
+  mio_writePin(GAME_SIM_TRIGGER_MIO_PIN, 0); // Released, so it is not ignored.
+  trigger_init();
+  transmitter_init();
+  transmitter_setFrequencyNumber(gameSim_frequency(player));
+  trigger_enable();
+  uint32_t next = 0; // The next shot to be pressed.
+  uint32_t firing = 0; // The next shot to start.
+  bool wasRunning = false;
+  for (uint32_t tick = 0; tick < tickCount; tick++) {
+    if (next < shotCounts[player] &&
+        tick >= gameSim_shot(player, next)->pressTick)
+      next++;
+    bool pressed =
+        next > 0 && tick < gameSim_shot(player, next - 1)->pressTick +
+                               GAME_SIM_TRIGGER_PRESS_MS * ISR_TICKS_PER_MS;
+    mio_writePin(GAME_SIM_TRIGGER_MIO_PIN, pressed);
+    trigger_tick();
+    transmitter_tick();
+    bool running = transmitter_running();
+    if (running && !wasRunning && firing < next)
+      gameSim_shot(player, firing++)->startTick = tick;
+    wasRunning = running;
+    if (hostBoard_getPinValue(TRANSMITTER_OUTPUT_PIN))
+      waveform[tick / GAME_SIM_BITS_PER_WORD] |= 1ULL
+                                                  << (tick %
+                                                      GAME_SIM_BITS_PER_WORD);
+  }
+}
+
+// Scores one detection against the shots aimed at the receiver. Returns true
+// if it hit one that had not been hit yet.
+static bool gameSim_score(uint16_t receiver, const detector_hitEvent_t *event) {
+  uint32_t window =
+      TRANSMITTER_PULSE_WIDTH + FILTER_POWER_WINDOW_MS * ISR_TICKS_PER_MS;
+  for (uint16_t s = 0; s < settings.playerCount; s++) {
+    // The receiver's own frequency is ignored, so it never counts as a hit.
+    if (gameSim_frequency(s) != event->frequencyNumber ||
+        gameSim_frequency(s) == gameSim_frequency(receiver))
+      continue;
+    for (uint32_t i = 0; i < shotCounts[s]; i++) {
+      gameSim_shot_t *shot = gameSim_shot(s, i);
+      if (shot->target == receiver && !shot->hit &&
+          shot->startTick != GAME_SIM_NOT_FIRED &&
+          event->sampleIndex >= shot->startTick &&
+          event->sampleIndex <= shot->startTick + window) {
+        shot->hit = true;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Runs one player's receiver for the whole game.
+static void gameSim_receive(uint16_t receiver) {
+  gameSim_result_t *result = &results[receiver];
+  uint64_t startNs = hostBoard_getTimeInNs();
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  ignoredFrequencies[gameSim_frequency(receiver)] = true;
+  isr_init();
+  detector_init(ignoredFrequencies);
+  uint32_t state = settings.seed + (receiver + 1) * 2654435761u;
+  uint32_t echoTicks = settings.multipathUs * ISR_TICKS_PER_MS /
+                       GAME_SIM_US_PER_MS;
+  double echoGain = pow(10.0, -settings.multipathDb / 20.0);
+  double strayGain = pow(10.0, -settings.strayDb / 20.0);
+  uint32_t current[GAME_SIM_MAX_PLAYERS] = {0}; // Latest shot of each shooter.
+  // Each hit locks the detector out, so there is at most one per lockout.
+  uint32_t *hitTicks =
+      malloc((tickCount / LOCKOUT_TIMER_EXPIRE_VALUE + 1) * sizeof(*hitTicks));
+  uint32_t hitTickCount = 0;
+  for (uint32_t tick = 0; tick < tickCount; tick++) {
+    double light = settings.ambientCounts;
+    for (uint16_t s = 0; s < settings.playerCount; s++) {
+      if (s == receiver)
+        continue;
+      while (current[s] + 1 < shotCounts[s] &&
+             gameSim_shot(s, current[s] + 1)->startTick <= tick)
+        current[s]++;
+      double path = pathCounts[s][receiver];
+      if (!shotCounts[s] || gameSim_shot(s, current[s])->target != receiver)
+        path *= strayGain;
+      double level = gameSim_pin(s, tick);
+      if (tick >= echoTicks)
+        level += echoGain * gameSim_pin(s, tick - echoTicks);
+      light += path * level;
+    }
+    light += (2.0 * gameSim_randomFraction(&state) - 1.0) *
+             settings.noiseCounts;
+    hostBoard_setAdcData(fmin(fmax(light, 0), GAME_SIM_ADC_MAX));
+    isr_function();
+    if (tick % FILTER_FIR_DECIMATION_FACTOR != FILTER_FIR_DECIMATION_FACTOR - 1)
+      continue;
+    detector(INTERRUPTS_CURRENTLY_DISABLED);
+    if (!detector_hitDetected())
+      continue;
+    detector_hitEvent_t events[GAME_SIM_MAX_HIT_EVENTS];
+    uint16_t count = detector_drainHitEvents(events, GAME_SIM_MAX_HIT_EVENTS);
+    for (uint16_t i = 0; i < count; i++) {
+      hitTicks[hitTickCount++] = events[i].sampleIndex;
+      if (gameSim_score(receiver, &events[i]))
+        result->hitCount++;
+      else
+        result->falsePositiveCount++;
+    }
+    detector_clearHit();
+  }
+  // Sort the shots this player could have detected from those that came in
+  // while it was locked out.
+  for (uint16_t s = 0; s < settings.playerCount; s++) {
+    if (gameSim_frequency(s) == gameSim_frequency(receiver))
+      continue;
+    for (uint32_t i = 0; i < shotCounts[s]; i++) {
+      gameSim_shot_t *shot = gameSim_shot(s, i);
+      if (shot->target != receiver || shot->startTick == GAME_SIM_NOT_FIRED)
+        continue;
+      bool lockedOut = false;
+      for (uint32_t h = 0; h < hitTickCount && !shot->hit; h++)
+        lockedOut |= shot->startTick >= hitTicks[h] &&
+                     shot->startTick < hitTicks[h] + LOCKOUT_TIMER_EXPIRE_VALUE;
+      if (lockedOut)
+        result->lockedOutCount++;
+      else
+        result->aimedAtCount++;
+    }
+  }
+  free(hitTicks);
+  result->detectNs = hostBoard_getTimeInNs() - startNs;
+}
+
+// Runs work() for every player, spread over settings.jobCount worker
+// processes. Returns false if any worker failed.
+static bool gameSim_runWorkers(void (*work)(uint16_t player)) {
+  fflush(stdout); // Or the workers flush it again.
+  for (uint16_t job = 0; job < settings.jobCount; job++) {
+    pid_t pid = fork();
+    if (pid < 0) {
+      perror("fork");
+      return false;
+    }
+    if (pid == 0) {
+      for (uint16_t p = job; p < settings.playerCount; p += settings.jobCount)
+        work(p);
+      _exit(EXIT_SUCCESS);
+    }
+  }
+  bool success = true;
+  int status;
+  while (wait(&status) > 0)
+    success &= WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS;
+  return success;
+}
+
+// Parses the command line into settings. Returns false if it is unusable.
+static bool gameSim_parse(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    const char *option = argv[i];
+    if (!strcmp(option, "--quiet")) {
+      settings.quiet = true;
+      continue;
+    }
+    if (i + 1 == argc)
+      return false;
+    const char *value = argv[++i];
+    if (!strcmp(option, "--players"))
+      settings.playerCount = atoi(value);
+    else if (!strcmp(option, "--seconds"))
+      settings.seconds = atoi(value);
+    else if (!strcmp(option, "--jobs"))
+      settings.jobCount = atoi(value);
+    else if (!strcmp(option, "--seed"))
+      settings.seed = strtoul(value, NULL, 0);
+    else if (!strcmp(option, "--attenuation-db"))
+      settings.attenuationDb = atof(value);
+    else if (!strcmp(option, "--spread-db"))
+      settings.spreadDb = atof(value);
+    else if (!strcmp(option, "--stray-db"))
+      settings.strayDb = atof(value);
+    else if (!strcmp(option, "--ambient"))
+      settings.ambientCounts = atof(value);
+    else if (!strcmp(option, "--noise"))
+      settings.noiseCounts = atof(value);
+    else if (!strcmp(option, "--multipath-us"))
+      settings.multipathUs = atof(value);
+    else if (!strcmp(option, "--multipath-db"))
+      settings.multipathDb = atof(value);
+    else if (!strcmp(option, "--min-accuracy"))
+      settings.minAccuracy = atof(value);
+    else if (!strcmp(option, "--max-false-positives"))
+      settings.maxFalsePositives = atoi(value);
+    else
+      return false;
+  }
+  if (settings.jobCount == 0)
+    settings.jobCount = sysconf(_SC_NPROCESSORS_ONLN);
+  return settings.playerCount >= 2 &&
+         settings.playerCount <= GAME_SIM_MAX_PLAYERS && settings.seconds > 0 &&
+         settings.jobCount > 0;
+}
+
+int main(int argc, char *argv[]) {
+  if (!gameSim_parse(argc, argv)) {
+    fprintf(stderr,
+            "usage: %s [--players 2-%d] [--seconds s] [--jobs n] [--seed n]\n"
+            "  [--attenuation-db d] [--spread-db d] [--stray-db d]\n"
+            "  [--ambient counts] [--noise counts]\n"
+            "  [--multipath-us t] [--multipath-db d]\n"
+            "  [--min-accuracy fraction] [--max-false-positives n] [--quiet]\n",
+            argv[0], GAME_SIM_MAX_PLAYERS);
+    return EXIT_FAILURE;
+  }
+  tickCount = settings.seconds * GAME_SIM_MS_PER_SECOND * ISR_TICKS_PER_MS;
+  maxShotCount =
+      settings.seconds * GAME_SIM_MS_PER_SECOND / GAME_SIM_MIN_SHOT_INTERVAL_MS +
+      1;
+  waveformWordCount = tickCount / GAME_SIM_BITS_PER_WORD + 1;
+  shotCounts = gameSim_share(settings.playerCount * sizeof(*shotCounts));
+  shots = gameSim_share(settings.playerCount * maxShotCount * sizeof(*shots));
+  waveforms = gameSim_share(settings.playerCount * waveformWordCount *
+                            sizeof(*waveforms));
+  results = gameSim_share(settings.playerCount * sizeof(*results));
+  gameSim_plan();
+
+  printf("gameSim: %d players, %u s at %d kHz, %d jobs.\n",
+         settings.playerCount, settings.seconds, FILTER_SAMPLE_FREQUENCY_IN_KHZ,
+         settings.jobCount);
+  uint64_t startNs = hostBoard_getTimeInNs();
+  if (!gameSim_runWorkers(gameSim_transmit)) {
+    printf("gameSim: a transmit worker failed.\n");
+    return EXIT_FAILURE;
+  }
+  uint64_t receiveNs = hostBoard_getTimeInNs();
+  if (!gameSim_runWorkers(gameSim_receive)) {
+    printf("gameSim: a receive worker failed.\n");
+    return EXIT_FAILURE;
+  }
+  uint64_t endNs = hostBoard_getTimeInNs();
+
+  uint32_t aimedAt = 0, hits = 0, lockedOut = 0, falsePositives = 0;
+  uint32_t unfired = 0;
+  uint64_t detectNs = 0;
+  for (uint16_t p = 0; p < settings.playerCount; p++) {
+    gameSim_result_t *result = &results[p];
+    uint32_t landed = 0; // Shots p fired that hit.
+    for (uint32_t i = 0; i < shotCounts[p]; i++) {
+      landed += gameSim_shot(p, i)->hit;
+      unfired += gameSim_shot(p, i)->startTick == GAME_SIM_NOT_FIRED;
+    }
+    aimedAt += result->aimedAtCount;
+    hits += result->hitCount;
+    lockedOut += result->lockedOutCount;
+    falsePositives += result->falsePositiveCount;
+    detectNs += result->detectNs;
+    if (!settings.quiet)
+      printf("player %2d (frequency %d): fired %u (%u hit), detected %u of %u "
+             "aimed at it (%u more locked out), %u false, %.1fx real time.\n",
+             p, gameSim_frequency(p), shotCounts[p], landed, result->hitCount,
+             result->aimedAtCount, result->lockedOutCount,
+             result->falsePositiveCount,
+             settings.seconds * GAME_SIM_NS_PER_SECOND / result->detectNs);
+  }
+  double accuracy = aimedAt ? (double)hits / aimedAt : 1.0;
+  double samples = (double)tickCount * settings.playerCount;
+  printf("gameSim: accuracy %.1f%% (%u of %u, %u more locked out), %u false "
+         "positives, %u shots not fired.\n",
+         100.0 * accuracy, hits, aimedAt, lockedOut, falsePositives, unfired);
+  printf("gameSim: transmit %.2f s, receive %.2f s wall, %.1fx real time per "
+         "player, %.1f Msamples/s in all.\n",
+         (receiveNs - startNs) / GAME_SIM_NS_PER_SECOND,
+         (endNs - receiveNs) / GAME_SIM_NS_PER_SECOND,
+         samples / tickCount * settings.seconds * GAME_SIM_NS_PER_SECOND /
+             detectNs,
+         samples / ((endNs - receiveNs) / GAME_SIM_NS_PER_SECOND) / 1.0E6);
+  bool success = accuracy >= settings.minAccuracy &&
+                 (settings.maxFalsePositives < 0 ||
+                  falsePositives <= (uint32_t)settings.maxFalsePositives);
+  printf("gameSim: %s.\n", success ? "passed" : "failed");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
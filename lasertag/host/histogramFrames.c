@@ -0,0 +1,104 @@
+// Renders the power histogram for a series of synthetic power values through
+// the display buffer and saves each flushed frame as a PPM image. Prints the
+// number of display calls each frame needed, and the number of drawing calls
+// the histogram made, which is what it would take without the buffer. With --latency, renders the
+// latency screen (latencyScreen.h) instead, for synthetic latencies that turn
+// from healthy to overloaded and back.
+//
+// Usage: histogramFrames [outputDirectory] [--frames N] [--latency]
+
+#include "displayBuffer.h"
+#include "filter.h"
+#include "histogram.h"
+#include "hostBoard.h"
+#include "latencyScreen.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HISTOGRAM_FRAMES_DEFAULT_FRAME_COUNT 30
+#define HISTOGRAM_FRAMES_MAX_FILE_NAME 512
+#define HISTOGRAM_FRAMES_NOISE_POWER 1.0e3
+#define HISTOGRAM_FRAMES_SIGNAL_POWER 5.0e5
+#define HISTOGRAM_FRAMES_PER_SHOT 10 // A shot lands on a new channel this often.
+// Latency frames: this many of each metric per frame, against this limit.
+#define HISTOGRAM_FRAMES_LATENCY_RECORDS 1000
+#define HISTOGRAM_FRAMES_LATENCY_LIMIT 1000
+#define HISTOGRAM_FRAMES_HEALTHY_LOAD 0.4 // Largest fraction of the limit.
+#define HISTOGRAM_FRAMES_OVERLOAD_LOAD 1.5
+
+static uint32_t randomState = 1;
+
+// Small LCG so that the frames are the same on every host.
+static double randomFraction() {
+  randomState = randomState * 1664525 + 1013904223;
+  return (double)(randomState >> 8) / (1 << 24);
+}
+
+// Plots power frame number frame: background noise on every channel, plus a
+// strong signal on one channel that decays and then moves to the next channel.
+static void plotPowerFrame(uint32_t frame) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  uint16_t shotChannel =
+      (frame / HISTOGRAM_FRAMES_PER_SHOT) % FILTER_FREQUENCY_COUNT;
+  double decay = 1.0 - (double)(frame % HISTOGRAM_FRAMES_PER_SHOT) /
+                           HISTOGRAM_FRAMES_PER_SHOT;
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = HISTOGRAM_FRAMES_NOISE_POWER * (1.0 + randomFraction());
+  powerValues[shotChannel] += HISTOGRAM_FRAMES_SIGNAL_POWER * decay;
+  histogram_plotUserFrequencyPower(powerValues);
+}
+
+// Plots latency frame number frame: every metric well within its limit, or
+// partly over it for every other HISTOGRAM_FRAMES_PER_SHOT frames.
+static void plotLatencyFrame(uint32_t frame) {
+  bool overloaded = (frame / HISTOGRAM_FRAMES_PER_SHOT) % 2;
+  double load = overloaded ? HISTOGRAM_FRAMES_OVERLOAD_LOAD
+                            : HISTOGRAM_FRAMES_HEALTHY_LOAD;
+  for (uint32_t i = 0; i < HISTOGRAM_FRAMES_LATENCY_RECORDS; i++)
+    for (uint16_t metric = 0; metric < latencyScreen_metricCount_e; metric++) {
+      uint32_t value = randomFraction() * randomFraction() * load *
+                       HISTOGRAM_FRAMES_LATENCY_LIMIT;
+      latencyScreen_record(metric, value, HISTOGRAM_FRAMES_LATENCY_LIMIT);
+    }
+  latencyScreen_update();
+}
+
+int main(int argc, char *argv[]) {
+  const char *directory = ".";
+  uint32_t frameCount = HISTOGRAM_FRAMES_DEFAULT_FRAME_COUNT;
+  bool latency = false;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+      frameCount = strtoul(argv[++i], NULL, 10);
+    else if (!strcmp(argv[i], "--latency"))
+      latency = true;
+    else
+      directory = argv[i];
+  }
+  if (latency) {
+    latencyScreen_init();
+    latencyScreen_show();
+  } else
+    histogram_init(FILTER_FREQUENCY_COUNT);
+  for (uint32_t frame = 0; frame < frameCount; frame++) {
+    uint32_t callsBefore = hostBoard_getDisplayCallCount();
+    uint32_t drawCallsBefore = displayBuffer_getDrawCallCount();
+    if (latency)
+      plotLatencyFrame(frame);
+    else
+      plotPowerFrame(frame);
+    char fileName[HISTOGRAM_FRAMES_MAX_FILE_NAME];
+    snprintf(fileName, sizeof(fileName), "%s/frame%03u.ppm", directory, frame);
+    if (!hostBoard_writePanelPpm(fileName)) {
+      perror(fileName);
+      return EXIT_FAILURE;
+    }
+    printf("%s: %u display calls, %u without the buffer\n", fileName,
+           hostBoard_getDisplayCallCount() - callsBefore,
+           displayBuffer_getDrawCallCount() - drawCallsBefore);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,387 @@
+// Host stand-ins for the ZYBO support package so that the lasertag sources can
+// be compiled and exercised on a workstation. Hardware that has no host
+// equivalent (interrupt masking, LEDs, the audio CODEC) is a no-op. The
+// display draws into a simulated panel, and the UART Lite and the audio I2S
+// controller into simulated FIFOs.
+
+#include "hostBoard.h"
+#include "buttons.h"
+#include "display.h"
+#include "interrupts.h"
+#include "intervalTimer.h"
+#include "leds.h"
+#include "mio.h"
+#include "sound.h"
+#include "switches.h"
+#include "timer_ps.h"
+#include "Xuartlite.h"
+#include "utils.h"
+#include "xiicps.h"
+#include "xparameters.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define HOST_BOARD_MIO_PIN_COUNT 64
+#define HOST_BOARD_INTERVAL_TIMER_COUNT 3
+#define NS_PER_SECOND 1000000000ULL
+#define NS_PER_MS 1000000ULL
+#define PPM_MAX_COLOR_VALUE 255
+#define HOST_BOARD_UART_FIFO_SIZE 16
+#define HOST_BOARD_I2S_FIFO_SIZE 32 // Words, a left and a right per sample.
+#define HOST_BOARD_I2S_TX_FIFO_FULL 0b0010
+#define HOST_BOARD_I2S_TX_FIFO_RESET 0b010
+
+static uint32_t adcData;
+static int32_t switchSetting;
+static uint32_t isrInvocationCount;
+static uint8_t pinValues[HOST_BOARD_MIO_PIN_COUNT];
+static uint16_t panel[DISPLAY_HEIGHT][DISPLAY_WIDTH]; // Simulated TFT.
+static uint32_t displayCallCount;
+// Address window for display_writePixels().
+static struct {
+  uint16_t x, y, w, h;
+  uint32_t next; // Index of the next pixel in the window.
+} displayWindow;
+static void (*interruptHandler)(); // Run by wfi().
+
+// Simulated UART Lite FIFOs.
+typedef struct {
+  uint8_t data[HOST_BOARD_UART_FIFO_SIZE];
+  uint16_t count;
+} hostUartFifo_t;
+static hostUartFifo_t uartTransmitFifo;
+static hostUartFifo_t uartReceiveFifo;
+static uint32_t uartCallCount;
+
+// Simulated audio I2S transmit FIFO.
+static uint16_t i2sFifoCount; // Words waiting in the FIFO.
+
+// Each interval timer accumulates time between start and stop.
+typedef struct {
+  bool running;
+  uint64_t startTimeInNs;
+  uint64_t totalTimeInNs;
+} hostIntervalTimer_t;
+static hostIntervalTimer_t intervalTimers[HOST_BOARD_INTERVAL_TIMER_COUNT];
+
+/*********************** Host controls *******************************/
+
+void hostBoard_setAdcData(uint32_t value) { adcData = value; }
+
+void hostBoard_setSwitches(int32_t switches) { switchSetting = switches; }
+
+uint8_t hostBoard_getPinValue(uint8_t pinNumber) {
+  return pinValues[pinNumber % HOST_BOARD_MIO_PIN_COUNT];
+}
+
+void hostBoard_countIsrInvocation() { isrInvocationCount++; }
+
+uint64_t hostBoard_getTimeInNs() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * NS_PER_SECOND + now.tv_nsec;
+}
+
+void hostBoard_setInterruptHandler(void (*handler)()) {
+  interruptHandler = handler;
+}
+
+void hostBoard_waitForInterrupt() {
+  if (interruptHandler != NULL)
+    interruptHandler();
+}
+
+uint16_t hostBoard_getPanelPixel(int16_t x, int16_t y) { return panel[y][x]; }
+
+uint32_t hostBoard_getDisplayCallCount() { return displayCallCount; }
+
+// Appends up to size bytes to a FIFO. Returns the number that fit.
+static uint16_t uartFifoPush(hostUartFifo_t *fifo, const uint8_t *data,
+                             uint16_t size) {
+  uint16_t count = HOST_BOARD_UART_FIFO_SIZE - fifo->count;
+  if (count > size)
+    count = size;
+  memcpy(&fifo->data[fifo->count], data, count);
+  fifo->count += count;
+  return count;
+}
+
+// Removes up to maxSize bytes from the front of a FIFO.
+static uint16_t uartFifoPop(hostUartFifo_t *fifo, uint8_t *data,
+                            uint16_t maxSize) {
+  uint16_t count = fifo->count < maxSize ? fifo->count : maxSize;
+  memcpy(data, fifo->data, count);
+  memmove(fifo->data, &fifo->data[count], fifo->count - count);
+  fifo->count -= count;
+  return count;
+}
+
+uint16_t hostBoard_uartTransmit(uint8_t *data, uint16_t maxSize) {
+  return uartFifoPop(&uartTransmitFifo, data, maxSize);
+}
+
+uint16_t hostBoard_uartReceive(const uint8_t *data, uint16_t size) {
+  return uartFifoPush(&uartReceiveFifo, data, size);
+}
+
+uint16_t hostBoard_uartLoopback(uint16_t maxBytes) {
+  uint16_t room = HOST_BOARD_UART_FIFO_SIZE - uartReceiveFifo.count;
+  uint8_t line[HOST_BOARD_UART_FIFO_SIZE];
+  uint16_t count =
+      uartFifoPop(&uartTransmitFifo, line, maxBytes < room ? maxBytes : room);
+  return uartFifoPush(&uartReceiveFifo, line, count);
+}
+
+uint32_t hostBoard_getUartCallCount() { return uartCallCount; }
+
+// Expands the RGB565 panel to 8 bits per channel and writes a binary PPM.
+bool hostBoard_writePanelPpm(const char *fileName) {
+  FILE *file = fopen(fileName, "wb");
+  if (file == NULL)
+    return false;
+  fprintf(file, "P6\n%d %d\n%d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT,
+          PPM_MAX_COLOR_VALUE);
+  for (int16_t y = 0; y < DISPLAY_HEIGHT; y++)
+    for (int16_t x = 0; x < DISPLAY_WIDTH; x++) {
+      uint16_t color = panel[y][x];
+      uint8_t rgb[3] = {((color >> 11) & 0x1F) * PPM_MAX_COLOR_VALUE / 0x1F,
+                        ((color >> 5) & 0x3F) * PPM_MAX_COLOR_VALUE / 0x3F,
+                        (color & 0x1F) * PPM_MAX_COLOR_VALUE / 0x1F};
+      fwrite(rgb, sizeof(rgb), 1, file);
+    }
+  return fclose(file) == 0;
+}
+
+/*********************** display *************************************/
+
+void display_init() {}
+int16_t display_width() { return DISPLAY_WIDTH; }
+int16_t display_height() { return DISPLAY_HEIGHT; }
+void display_fillScreen(uint16_t color) {
+  display_fillRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, color);
+}
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  displayCallCount++;
+  for (int16_t row = y; row < y + h; row++)
+    for (int16_t column = x; column < x + w; column++)
+      if (row >= 0 && row < DISPLAY_HEIGHT && column >= 0 &&
+          column < DISPLAY_WIDTH)
+        panel[row][column] = color;
+}
+
+// Pixels written after display_setAddrWindow() fill the window left to right
+// and top to bottom, wrapping back to its top-left corner when it is full.
+void display_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  displayCallCount++;
+  displayWindow.x = x;
+  displayWindow.y = y;
+  displayWindow.w = w;
+  displayWindow.h = h;
+  displayWindow.next = 0;
+}
+void display_writePixels(const uint16_t *colors, uint32_t count) {
+  displayCallCount++;
+  uint32_t size = (uint32_t)displayWindow.w * displayWindow.h;
+  for (uint32_t i = 0; i < count && size; i++) {
+    uint16_t x = displayWindow.x + displayWindow.next % displayWindow.w;
+    uint16_t y = displayWindow.y + displayWindow.next / displayWindow.w;
+    if (x < DISPLAY_WIDTH && y < DISPLAY_HEIGHT)
+      panel[y][x] = colors[i];
+    displayWindow.next = (displayWindow.next + 1) % size;
+  }
+}
+
+/*********************** interrupts **********************************/
+
+int32_t interrupts_initAll(bool printFailedStatusFlag) {
+  (void)printFailedStatusFlag;
+  return 1;
+}
+void interrupts_setPrivateTimerLoadValue(uint32_t loadValue) {
+  (void)loadValue;
+}
+void interrupts_enableTimerGlobalInts() {}
+void interrupts_startArmPrivateTimer() {}
+void interrupts_enableArmInts() {}
+void interrupts_disableArmInts() {}
+uint32_t interrupts_getAdcData() { return adcData; }
+uint32_t interrupts_isrInvocationCount() { return isrInvocationCount; }
+int32_t interrupts_getAdcInputMode() { return INTERRUPTS_ADC_UNIPOLAR_MODE; }
+
+/*********************** buttons, switches, leds, mio ***************/
+
+int32_t buttons_init() { return 1; }
+int32_t buttons_read() { return 0; }
+int32_t switches_init() { return 1; }
+int32_t switches_read() { return switchSetting; }
+int32_t leds_init(bool printFailedStatusFlag) {
+  (void)printFailedStatusFlag;
+  return 1;
+}
+void leds_write(int32_t value) { (void)value; }
+int32_t mio_init(bool printFailedStatusFlag) {
+  (void)printFailedStatusFlag;
+  return 1;
+}
+void mio_setPinAsInput(uint8_t pinNumber) { (void)pinNumber; }
+void mio_setPinAsOutput(uint8_t pinNumber) { (void)pinNumber; }
+int32_t mio_readPin(uint8_t pinNumber) { return hostBoard_getPinValue(pinNumber); }
+void mio_writePin(uint8_t pinNumber, uint8_t value) {
+  pinValues[pinNumber % HOST_BOARD_MIO_PIN_COUNT] = value;
+}
+
+/*********************** utils ***************************************/
+
+void utils_msDelay(uint32_t msDelay) {
+  struct timespec delay = {msDelay / 1000, (msDelay % 1000) * NS_PER_MS};
+  nanosleep(&delay, NULL);
+}
+
+/*********************** global timer ********************************/
+
+void XTime_GetTime(XTime *Xtime_Global) {
+  *Xtime_Global = hostBoard_getTimeInNs();
+}
+
+/*********************** intervalTimer *******************************/
+
+intervalTimer_status_t intervalTimer_initAll() {
+  for (uint32_t i = 0; i < HOST_BOARD_INTERVAL_TIMER_COUNT; i++)
+    intervalTimer_reset(i);
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+intervalTimer_status_t intervalTimer_reset(uint32_t timerNumber) {
+  if (timerNumber >= HOST_BOARD_INTERVAL_TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  intervalTimers[timerNumber].running = false;
+  intervalTimers[timerNumber].totalTimeInNs = 0;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+intervalTimer_status_t intervalTimer_start(uint32_t timerNumber) {
+  if (timerNumber >= HOST_BOARD_INTERVAL_TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  intervalTimers[timerNumber].running = true;
+  intervalTimers[timerNumber].startTimeInNs = hostBoard_getTimeInNs();
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+intervalTimer_status_t intervalTimer_stop(uint32_t timerNumber) {
+  if (timerNumber >= HOST_BOARD_INTERVAL_TIMER_COUNT ||
+      !intervalTimers[timerNumber].running)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  intervalTimers[timerNumber].running = false;
+  intervalTimers[timerNumber].totalTimeInNs +=
+      hostBoard_getTimeInNs() - intervalTimers[timerNumber].startTimeInNs;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
+  if (timerNumber >= HOST_BOARD_INTERVAL_TIMER_COUNT)
+    return 0.0;
+  uint64_t totalTimeInNs = intervalTimers[timerNumber].totalTimeInNs;
+  if (intervalTimers[timerNumber].running) // Include the running interval.
+    totalTimeInNs +=
+        hostBoard_getTimeInNs() - intervalTimers[timerNumber].startTimeInNs;
+  return (double)totalTimeInNs / NS_PER_SECOND;
+}
+
+/*********************** UART Lite ***********************************/
+
+int XUartLite_CfgInitialize(XUartLite *InstancePtr, XUartLite_Config *Config,
+                            UINTPTR EffectiveAddr) {
+  InstancePtr->RegBaseAddress = Config->RegBaseAddress = EffectiveAddr;
+  uartTransmitFifo.count = 0;
+  uartReceiveFifo.count = 0;
+  return XST_SUCCESS;
+}
+
+// Polled send: takes as many bytes as fit in the transmit FIFO.
+unsigned int XUartLite_Send(XUartLite *InstancePtr, u8 *DataBufferPtr,
+                            unsigned int NumBytes) {
+  (void)InstancePtr;
+  uartCallCount++;
+  return uartFifoPush(&uartTransmitFifo, DataBufferPtr, NumBytes);
+}
+
+// Polled receive: returns what is waiting in the receive FIFO.
+unsigned int XUartLite_Recv(XUartLite *InstancePtr, u8 *DataBufferPtr,
+                            unsigned int NumBytes) {
+  (void)InstancePtr;
+  uartCallCount++;
+  return uartFifoPop(&uartReceiveFifo, DataBufferPtr, NumBytes);
+}
+
+/*********************** audio CODEC and I2S *************************/
+
+// Host builds have no audio CODEC: setting it up over IIC always succeeds.
+static XIicPs_Config iicConfig;
+
+XIicPs_Config *XIicPs_LookupConfig(u16 DeviceId) {
+  iicConfig.DeviceId = DeviceId;
+  return &iicConfig;
+}
+int XIicPs_CfgInitialize(XIicPs *InstancePtr, XIicPs_Config *ConfigPtr,
+                         u32 EffectiveAddr) {
+  InstancePtr->Config = *ConfigPtr;
+  InstancePtr->Config.BaseAddress = EffectiveAddr;
+  return XST_SUCCESS;
+}
+int XIicPs_SelfTest(XIicPs *InstancePtr) {
+  (void)InstancePtr;
+  return XST_SUCCESS;
+}
+int XIicPs_SetSClk(XIicPs *InstancePtr, u32 FsclHz) {
+  (void)InstancePtr;
+  (void)FsclHz;
+  return XST_SUCCESS;
+}
+int XIicPs_MasterSendPolled(XIicPs *InstancePtr, u8 *MsgPtr, int ByteCount,
+                            u16 SlaveAddr) {
+  (void)InstancePtr;
+  (void)MsgPtr;
+  (void)ByteCount;
+  (void)SlaveAddr;
+  return XST_SUCCESS;
+}
+int XIicPs_BusIsBusy(XIicPs *InstancePtr) {
+  (void)InstancePtr;
+  return false;
+}
+int TimerInitialize(u16 TimerDeviceId) {
+  (void)TimerDeviceId;
+  return XST_SUCCESS;
+}
+void TimerDelay(u32 uSDelay) { (void)uSDelay; }
+
+// The I2S transmit FIFO reports full once HOST_BOARD_I2S_FIFO_SIZE words are
+// in it. The CODEC is taken to play them all out before the FIFO is polled
+// again, so sound_pump() sends at most one FIFO's worth per call, as on the
+// board when it is called often enough.
+u32 Xil_In32(UINTPTR Addr) {
+  if (Addr != XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR + I2S_FIFO_STS_REG)
+    return 0;
+  if (i2sFifoCount < HOST_BOARD_I2S_FIFO_SIZE)
+    return 0;
+  i2sFifoCount = 0;
+  return HOST_BOARD_I2S_TX_FIFO_FULL;
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value) {
+  switch (Addr - XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR) {
+  case I2S_RESET_REG:
+    if (Value & HOST_BOARD_I2S_TX_FIFO_RESET)
+      i2sFifoCount = 0;
+    break;
+  case I2S_TX_FIFO_REG:
+    if (i2sFifoCount < HOST_BOARD_I2S_FIFO_SIZE)
+      i2sFifoCount++;
+    break;
+  }
+}
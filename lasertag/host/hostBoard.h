@@ -0,0 +1,60 @@
+// Host builds replace the ZYBO support package (interrupts, mio, buttons,
+// switches, leds, utils, intervalTimer, display, UART Lite, global timer, wfi,
+// audio CODEC and I2S) with the stand-ins in hostBoard.c.
+// The functions below let host tools drive and observe those stand-ins.
+
+#ifndef HOSTBOARD_H_
+#define HOSTBOARD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Sets the value returned by interrupts_getAdcData().
+void hostBoard_setAdcData(uint32_t adcData);
+
+// Sets the value returned by switches_read().
+void hostBoard_setSwitches(int32_t switches);
+
+// Returns the last value written to an MIO pin with mio_writePin().
+uint8_t hostBoard_getPinValue(uint8_t pinNumber);
+
+// Counts one timer interrupt, as reported by interrupts_isrInvocationCount().
+void hostBoard_countIsrInvocation();
+
+// Returns the host monotonic clock in nanoseconds.
+uint64_t hostBoard_getTimeInNs();
+
+// Sets the function wfi() runs in place of sleeping until the next interrupt,
+// e.g. one that sets the ADC data and calls isr_function(). With no handler,
+// wfi() returns at once.
+void hostBoard_setInterruptHandler(void (*handler)());
+
+// Runs the interrupt handler, as wfi() does on the host.
+void hostBoard_waitForInterrupt();
+
+// Returns the color of a pixel on the simulated display panel.
+uint16_t hostBoard_getPanelPixel(int16_t x, int16_t y);
+
+// Returns the number of drawing calls made to the display so far.
+uint32_t hostBoard_getDisplayCallCount();
+
+// Saves the simulated display panel as a PPM image. Returns false on failure.
+bool hostBoard_writePanelPpm(const char *fileName);
+
+// Takes up to maxSize bytes out of the simulated UART transmit FIFO, as the
+// line would send them. Returns the number of bytes taken.
+uint16_t hostBoard_uartTransmit(uint8_t *data, uint16_t maxSize);
+
+// Puts up to size bytes into the simulated UART receive FIFO, as if they
+// arrived on the line. Returns the number of bytes that fit.
+uint16_t hostBoard_uartReceive(const uint8_t *data, uint16_t size);
+
+// Loops the simulated UART back on itself: moves up to maxBytes from the
+// transmit FIFO to the receive FIFO, as a line would in the time it takes to
+// send maxBytes. Returns the number of bytes moved.
+uint16_t hostBoard_uartLoopback(uint16_t maxBytes);
+
+// Returns the number of XUartLite_Send() and XUartLite_Recv() calls so far.
+uint32_t hostBoard_getUartCallCount();
+
+#endif /* HOSTBOARD_H_ */
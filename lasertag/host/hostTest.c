@@ -0,0 +1,151 @@
+// Runs the lasertag self-tests that do not need the ZYBO board.
+// Returns non-zero if any of them fails.
+
+#include "adcCapture.h"
+#include "adpcm.h"
+#include "bluetooth.h"
+#include "detector.h"
+#include "displayBuffer.h"
+#include "dspDispatch.h"
+#include "filter.h"
+#include "histogram.h"
+#include "hostBoard.h"
+#include "isr.h"
+#include "latencyScreen.h"
+#include "overload.h"
+#include "queue.h"
+#include "scheduler.h"
+#include "sound.h"
+#include "stageProfiler.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HOST_TEST_HISTOGRAM_FRAMES 20
+#define HOST_TEST_HISTOGRAM_MAX_POWER 1.0e6
+
+// Draws a series of histograms and checks after each flush that the simulated
+// panel shows exactly what is in the display buffer.
+static bool histogramPanelMatchesBuffer() {
+  histogram_init(FILTER_FREQUENCY_COUNT);
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  for (uint32_t frame = 0; frame < HOST_TEST_HISTOGRAM_FRAMES; frame++) {
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      powerValues[i] =
+          HOST_TEST_HISTOGRAM_MAX_POWER * ((frame * 7 + i * 3) % 11) / 10;
+    histogram_plotUserFrequencyPower(powerValues);
+    for (int16_t y = 0; y < DISPLAY_BUFFER_HEIGHT; y++)
+      for (int16_t x = 0; x < DISPLAY_BUFFER_WIDTH; x++)
+        if (hostBoard_getPanelPixel(x, y) != displayBuffer_getPixel(x, y)) {
+          printf("histogram frame %u: panel differs at (%d, %d).\n", frame, x,
+                 y);
+          return false;
+        }
+  }
+  printf("histogram: panel matches the buffer for %u frames.\n",
+         HOST_TEST_HISTOGRAM_FRAMES);
+  return true;
+}
+
+#define HOST_TEST_ADC_ROUNDS 50
+#define HOST_TEST_ADC_MAX 4095
+
+// Pops and scales ADC values a block at a time, with the buffer wrapping at
+// different points, and checks that they come out as they went in and scaled
+// exactly as detector_getScaledAdcValue() scales them.
+static bool adcBlockIngestMatchesSingleValues() {
+  isr_init();
+  uint32_t nextIn = 0, nextOut = 0;
+  for (uint32_t round = 0; round < HOST_TEST_ADC_ROUNDS; round++) {
+    uint32_t pushCount = 1 + round % (ISR_ADC_BUFFER_SIZE - 1);
+    for (uint32_t i = 0; i < pushCount; i++, nextIn++)
+      isr_addDataToAdcBuffer((nextIn * 37) & HOST_TEST_ADC_MAX);
+    isr_AdcValue_t adcValues[ISR_ADC_BUFFER_SIZE];
+    double scaled[ISR_ADC_BUFFER_SIZE];
+    uint32_t count =
+        isr_removeDataBlockFromAdcBuffer(adcValues, ISR_ADC_BUFFER_SIZE);
+    detector_scaleAdcValues(adcValues, scaled, count);
+    for (uint32_t i = 0; i < count; i++, nextOut++) {
+      isr_AdcValue_t expected = (nextOut * 37) & HOST_TEST_ADC_MAX;
+      if (adcValues[i] != expected ||
+          scaled[i] != detector_getScaledAdcValue(expected)) {
+        printf("ADC ingest: value %u came out as %u (%f).\n", nextOut,
+               adcValues[i], scaled[i]);
+        return false;
+      }
+    }
+  }
+  bool success = nextOut == nextIn && isr_adcBufferElementCount() == 0;
+  printf("ADC ingest: %u values popped and scaled in blocks. %s\n", nextOut,
+         success ? "passed" : "failed");
+  return success;
+}
+
+#define HOST_TEST_BLUETOOTH_BYTE_COUNT 5000 // Wraps the queues a few times.
+#define HOST_TEST_BLUETOOTH_CHUNK 37       // Odd, to move the wrap point.
+#define HOST_TEST_BLUETOOTH_UART_FIFO_SIZE 16
+
+// Streams bytes through the bluetooth queues and the simulated UART in both
+// directions and checks that they arrive in order, a FIFO at a time.
+static bool bluetoothQueuesPassData() {
+  bluetooth_init();
+  uint32_t sent = 0, transmitted = 0, received = 0, polls = 0;
+  uint32_t uartCallsBefore = hostBoard_getUartCallCount();
+  while (transmitted < HOST_TEST_BLUETOOTH_BYTE_COUNT) {
+    uint8_t chunk[HOST_TEST_BLUETOOTH_CHUNK];
+    uint16_t chunkSize = 0;
+    while (chunkSize < HOST_TEST_BLUETOOTH_CHUNK &&
+           sent + chunkSize < HOST_TEST_BLUETOOTH_BYTE_COUNT) {
+      chunk[chunkSize] = (uint8_t)(sent + chunkSize);
+      chunkSize++;
+    }
+    sent += bluetooth_transmitQueueWrite(chunk, chunkSize);
+    bluetooth_poll();
+    polls++;
+    // The line sends the transmit FIFO and loops it back into the receiver.
+    uint8_t line[HOST_TEST_BLUETOOTH_UART_FIFO_SIZE];
+    uint16_t lineCount = hostBoard_uartTransmit(line, sizeof(line));
+    transmitted += lineCount;
+    hostBoard_uartReceive(line, lineCount);
+    uint8_t incoming[HOST_TEST_BLUETOOTH_CHUNK];
+    uint16_t incomingCount =
+        bluetooth_receiveQueueRead(incoming, sizeof(incoming));
+    for (uint16_t i = 0; i < incomingCount; i++, received++)
+      if (incoming[i] != (uint8_t)received) {
+        printf("bluetooth: byte %u came back as %u.\n", received, incoming[i]);
+        return false;
+      }
+  }
+  bluetooth_poll(); // Move the last loop-back into the receive queue.
+  uint8_t incoming[HOST_TEST_BLUETOOTH_CHUNK];
+  received += bluetooth_receiveQueueRead(incoming, sizeof(incoming));
+  uint32_t uartCalls = hostBoard_getUartCallCount() - uartCallsBefore;
+  // Each direction needs at most two UART calls per poll.
+  bool success = received == HOST_TEST_BLUETOOTH_BYTE_COUNT &&
+                 uartCalls <= 4 * (polls + 1);
+  printf("bluetooth: %u bytes looped back in %u polls, %u UART calls. %s\n",
+         received, polls, uartCalls, success ? "passed" : "failed");
+  return success;
+}
+
+int main() {
+  bool success = true;
+  success &= queue_runTest();
+  success &= filter_runTest();
+  success &= dspDispatch_runTest();
+  success &= adcBlockIngestMatchesSingleValues();
+  success &= stageProfiler_runTest();
+  success &= adpcm_runTest();
+  success &= sound_runTest();
+  success &= displayBuffer_runTest();
+  success &= histogramPanelMatchesBuffer();
+  success &= scheduler_runTest();
+  success &= overload_runTest();
+  success &= latencyScreen_runTest();
+  success &= bluetoothQueuesPassData();
+  success &= telemetry_runTest();
+  success &= adcCapture_runTest();
+  detector_runTest(); // Only prints its results.
+  printf(success ? "All host tests passed.\n" : "Host tests FAILED.\n");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
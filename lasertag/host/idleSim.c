@@ -0,0 +1,224 @@
+// Compares the main loop that spins on detector() with the one that sleeps in
+// idle_waitForBatch() (see idle.h) on the same shots, and reports what the
+// batches save. The wfi() stand-in delivers the next timer interrupt: it sets
+// the ADC data and calls isr_function(), so the batched loop wakes once per
+// sample and runs detector() once per IDLE_BATCH_SIZE samples. The spinning
+// loop runs detector() after every sample, as the firmware did when it kept up.
+//
+// Usage: idleSim [--shots n] [--quiet]
+//
+// Each shot is a 200 ms square wave at the next player frequency in light
+// noise, followed by enough quiet for the lockout to expire. Both loops must
+// report the same hits, on the same samples, and the batched loop must wake
+// IDLE_BATCH_SIZE times per batch. Exits non-zero otherwise.
+//
+// The main-loop time is the host time spent outside the simulated ISR, per
+// second of samples: the duty cycle the loop would have on a CPU as fast as
+// the host. On the board, idle_getDutyCycle() measures it directly.
+
+#include "detector.h"
+#include "filter.h"
+#include "hostBoard.h"
+#include "idle.h"
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IDLE_SIM_DEFAULT_SHOTS 10
+#define IDLE_SIM_QUIET_BEFORE_MS 300
+#define IDLE_SIM_SHOT_MS 200
+#define IDLE_SIM_QUIET_AFTER_MS 700 // Longer than the lockout.
+#define IDLE_SIM_SHOT_TICKS                                                    \
+  ((IDLE_SIM_QUIET_BEFORE_MS + IDLE_SIM_SHOT_MS + IDLE_SIM_QUIET_AFTER_MS) *  \
+   ISR_TICKS_PER_MS)
+#define IDLE_SIM_ADC_MIDSCALE 2048
+#define IDLE_SIM_SHOT_AMPLITUDE 300 // In ADC counts.
+#define IDLE_SIM_NOISE_AMPLITUDE 40
+#define IDLE_SIM_MAX_HITS 1024
+#define IDLE_SIM_NS_PER_SECOND 1.0E9
+#define IDLE_SIM_PERCENT 100.0
+#define INTERRUPTS_CURRENTLY_ENABLED true
+
+// What one main loop made of the shots.
+typedef struct {
+  const char *name;
+  uint32_t detectorCallCount;
+  uint32_t hitCount;
+  detector_hitEvent_t hits[IDLE_SIM_MAX_HITS];
+  double mainLoopSeconds; // Host time outside the simulated ISR.
+  idle_stats_t idleStats; // Batched loop only.
+} idleSim_result_t;
+
+static uint32_t shotCount = IDLE_SIM_DEFAULT_SHOTS;
+static bool quiet = false;
+static uint32_t tick;      // Samples delivered so far.
+static uint32_t tickCount; // Samples in the run.
+static uint32_t randomState;
+
+// Small LCG so that runs are repeatable across hosts.
+static int32_t idleSim_noise() {
+  randomState = randomState * 1664525 + 1013904223;
+  return (int32_t)(randomState >> 16) % (2 * IDLE_SIM_NOISE_AMPLITUDE + 1) -
+         IDLE_SIM_NOISE_AMPLITUDE;
+}
+
+// The timer interrupt: puts the next sample on the ADC and runs the ISR.
+static void idleSim_interrupt() {
+  uint32_t shotTick = tick % IDLE_SIM_SHOT_TICKS;
+  uint32_t period =
+      filter_frequencyTickTable[tick / IDLE_SIM_SHOT_TICKS %
+                                FILTER_FREQUENCY_COUNT];
+  int32_t value = IDLE_SIM_ADC_MIDSCALE + idleSim_noise();
+  if (shotTick >= IDLE_SIM_QUIET_BEFORE_MS * ISR_TICKS_PER_MS &&
+      shotTick < (IDLE_SIM_QUIET_BEFORE_MS + IDLE_SIM_SHOT_MS) *
+                     ISR_TICKS_PER_MS)
+    value += (shotTick % period < period / 2) ? IDLE_SIM_SHOT_AMPLITUDE
+                                              : -IDLE_SIM_SHOT_AMPLITUDE;
+  hostBoard_setAdcData(value);
+  isr_function();
+  tick++;
+}
+
+// Starts a run from the first sample.
+static void idleSim_start(idleSim_result_t *result, const char *name) {
+  bool ignoredFrequencies[FILTER_FREQUENCY_COUNT] = {false};
+  memset(result, 0, sizeof(*result));
+  result->name = name;
+  tick = 0;
+  randomState = 1;
+  isr_init();
+  detector_init(ignoredFrequencies);
+}
+
+// Runs detector() and keeps the hits it reports.
+static void idleSim_detect(idleSim_result_t *result) {
+  detector(INTERRUPTS_CURRENTLY_ENABLED);
+  result->detectorCallCount++;
+  detector_hitEvent_t event;
+  while (detector_popHitEvent(&event)) {
+    if (result->hitCount < IDLE_SIM_MAX_HITS)
+      result->hits[result->hitCount] = event;
+    result->hitCount++;
+  }
+  detector_clearHit();
+}
+
+// One detector() call per sample, timed without the ISR.
+static void idleSim_runSpinning(idleSim_result_t *result) {
+  idleSim_start(result, "spinning");
+  uint64_t mainLoopNs = 0;
+  while (tick < tickCount) {
+    idleSim_interrupt();
+    uint64_t startNs = hostBoard_getTimeInNs();
+    idleSim_detect(result);
+    mainLoopNs += hostBoard_getTimeInNs() - startNs;
+  }
+  result->mainLoopSeconds = mainLoopNs / IDLE_SIM_NS_PER_SECOND;
+}
+
+// The firmware loop: sleep until a batch is in, then run detector() on it.
+static void idleSim_runBatched(idleSim_result_t *result) {
+  idleSim_start(result, "batched");
+  hostBoard_setInterruptHandler(idleSim_interrupt);
+  idle_init();
+  while (tick + IDLE_BATCH_SIZE <= tickCount) {
+    idle_waitForBatch();
+    idleSim_detect(result);
+  }
+  hostBoard_setInterruptHandler(NULL);
+  result->idleStats = idle_getStats();
+  // The simulated ISR runs inside wfi(), so it counts as sleep.
+  result->mainLoopSeconds =
+      result->idleStats.elapsedSeconds - result->idleStats.sleepSeconds;
+}
+
+static void idleSim_print(const idleSim_result_t *result) {
+  double sampleSeconds = tickCount / (ISR_TICKS_PER_MS * 1000.0);
+  printf("%-9s %10lu %5lu %9.2f %10.2f%%\n", result->name,
+         (unsigned long)result->detectorCallCount,
+         (unsigned long)result->hitCount,
+         result->mainLoopSeconds * 1000.0 / sampleSeconds,
+         result->mainLoopSeconds / sampleSeconds * IDLE_SIM_PERCENT);
+}
+
+// Returns true if both loops reported the same hits.
+static bool idleSim_sameHits(const idleSim_result_t *spinning,
+                             const idleSim_result_t *batched) {
+  if (spinning->hitCount != batched->hitCount) {
+    printf("The loops reported %lu and %lu hits.\n",
+           (unsigned long)spinning->hitCount, (unsigned long)batched->hitCount);
+    return false;
+  }
+  uint32_t count = spinning->hitCount < IDLE_SIM_MAX_HITS ? spinning->hitCount
+                                                          : IDLE_SIM_MAX_HITS;
+  for (uint32_t i = 0; i < count; i++)
+    if (spinning->hits[i].frequencyNumber != batched->hits[i].frequencyNumber ||
+        spinning->hits[i].sampleIndex != batched->hits[i].sampleIndex) {
+      printf("Hit %lu differs: frequency %u at sample %llu, then %u at %llu.\n",
+             (unsigned long)i, spinning->hits[i].frequencyNumber,
+             (unsigned long long)spinning->hits[i].sampleIndex,
+             batched->hits[i].frequencyNumber,
+             (unsigned long long)batched->hits[i].sampleIndex);
+      return false;
+    }
+  return true;
+}
+
+// Returns true if every batch took IDLE_BATCH_SIZE interrupts.
+static bool idleSim_checkBatches(const idleSim_result_t *batched) {
+  const idle_stats_t *stats = &batched->idleStats;
+  uint32_t expected = tickCount / IDLE_BATCH_SIZE;
+  if (stats->batchCount != expected ||
+      stats->wakeUpCount != expected * IDLE_BATCH_SIZE) {
+    printf("Expected %lu batches of %u wake-ups, got %lu batches and %lu "
+           "wake-ups.\n",
+           (unsigned long)expected, IDLE_BATCH_SIZE,
+           (unsigned long)stats->batchCount,
+           (unsigned long)stats->wakeUpCount);
+    return false;
+  }
+  return true;
+}
+
+static void idleSim_usage() {
+  fprintf(stderr, "Usage: idleSim [--shots n] [--quiet]\n");
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--shots") && i + 1 < argc)
+      shotCount = strtoul(argv[++i], NULL, 0);
+    else if (!strcmp(argv[i], "--quiet"))
+      quiet = true;
+    else
+      idleSim_usage();
+  }
+  if (shotCount == 0)
+    idleSim_usage();
+  tickCount = shotCount * IDLE_SIM_SHOT_TICKS;
+
+  // Both are large, so keep them off the stack.
+  static idleSim_result_t spinning, batched;
+  idleSim_runSpinning(&spinning);
+  idleSim_runBatched(&batched);
+
+  if (!quiet) {
+    printf("%lu shots, %lu samples, batches of %u samples.\n",
+           (unsigned long)shotCount, (unsigned long)tickCount,
+           IDLE_BATCH_SIZE);
+    printf("%-9s %10s %5s %9s %11s\n", "loop", "detector()", "hits",
+           "ms per s", "duty cycle");
+    idleSim_print(&spinning);
+    idleSim_print(&batched);
+    printf("Batched main loop takes %.2f of the spinning loop's time.\n",
+           batched.mainLoopSeconds / spinning.mainLoopSeconds);
+  }
+  bool passed = idleSim_sameHits(&spinning, &batched) &&
+                idleSim_checkBatches(&batched);
+  printf("idleSim %s.\n", passed ? "passed" : "failed");
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,26 @@
+// Host stand-in for the Xilinx UART Lite driver used by bluetooth.c. The UART
+// is simulated in hostBoard.c with 16-byte transmit and receive FIFOs, as on
+// the ZYBO. Only the polled functions used by bluetooth.c are provided.
+
+#ifndef XUARTLITE_H_
+#define XUARTLITE_H_
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+typedef struct {
+  UINTPTR RegBaseAddress;
+} XUartLite_Config;
+
+typedef struct {
+  UINTPTR RegBaseAddress;
+} XUartLite;
+
+int XUartLite_CfgInitialize(XUartLite *InstancePtr, XUartLite_Config *Config,
+                            UINTPTR EffectiveAddr);
+unsigned int XUartLite_Send(XUartLite *InstancePtr, u8 *DataBufferPtr,
+                            unsigned int NumBytes);
+unsigned int XUartLite_Recv(XUartLite *InstancePtr, u8 *DataBufferPtr,
+                            unsigned int NumBytes);
+
+#endif /* XUARTLITE_H_ */
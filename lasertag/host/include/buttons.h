@@ -0,0 +1,16 @@
+// Host stand-in for the ZYBO buttons package. No button is ever pressed.
+
+#ifndef BUTTONS_H_
+#define BUTTONS_H_
+
+#include <stdint.h>
+
+#define BUTTONS_BTN0_MASK 0x1
+#define BUTTONS_BTN1_MASK 0x2
+#define BUTTONS_BTN2_MASK 0x4
+#define BUTTONS_BTN3_MASK 0x8
+
+int32_t buttons_init();
+int32_t buttons_read();
+
+#endif /* BUTTONS_H_ */
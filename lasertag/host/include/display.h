@@ -0,0 +1,37 @@
+// Host stand-in for the ZYBO display package. Drawing goes into a simulated
+// panel that host tools can inspect or save (see hostBoard.h).
+
+#ifndef DISPLAY_H_
+#define DISPLAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DISPLAY_WIDTH 320
+#define DISPLAY_HEIGHT 240
+#define DISPLAY_CHAR_WIDTH 6
+#define DISPLAY_CHAR_HEIGHT 8
+
+// RGB565 colors.
+#define DISPLAY_BLACK 0x0000
+#define DISPLAY_BLUE 0x001F
+#define DISPLAY_RED 0xF800
+#define DISPLAY_GREEN 0x07E0
+#define DISPLAY_CYAN 0x07FF
+#define DISPLAY_MAGENTA 0xF81F
+#define DISPLAY_YELLOW 0xFFE0
+#define DISPLAY_WHITE 0xFFFF
+
+void display_init();
+int16_t display_width();
+int16_t display_height();
+void display_fillScreen(uint16_t color);
+void display_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color);
+
+// Window writes, for DISPLAY_BUFFER_WINDOW_WRITE_ENABLED: sets the window
+// once, then fills it with count pixels, row after row.
+void display_setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void display_writePixels(const uint16_t *colors, uint32_t count);
+
+#endif /* DISPLAY_H_ */
@@ -0,0 +1,23 @@
+// Host stand-in for the ZYBO interrupts package. Only the functions used by
+// the lasertag sources are provided. See hostBoard.c.
+
+#ifndef INTERRUPTS_H_
+#define INTERRUPTS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define INTERRUPTS_ADC_UNIPOLAR_MODE 0
+#define INTERRUPTS_ADC_BIPOLAR_MODE 1
+
+int32_t interrupts_initAll(bool printFailedStatusFlag);
+void interrupts_setPrivateTimerLoadValue(uint32_t loadValue);
+void interrupts_enableTimerGlobalInts();
+void interrupts_startArmPrivateTimer();
+void interrupts_enableArmInts();
+void interrupts_disableArmInts();
+uint32_t interrupts_getAdcData();
+uint32_t interrupts_isrInvocationCount();
+int32_t interrupts_getAdcInputMode();
+
+#endif /* INTERRUPTS_H_ */
@@ -0,0 +1,23 @@
+// Host stand-in for the ZYBO interval-timer package, backed by the host
+// monotonic clock.
+
+#ifndef INTERVALTIMER_H_
+#define INTERVALTIMER_H_
+
+#include <stdint.h>
+
+#define INTERVAL_TIMER_TIMER_0 0
+#define INTERVAL_TIMER_TIMER_1 1
+#define INTERVAL_TIMER_TIMER_2 2
+
+typedef uint32_t intervalTimer_status_t;
+#define INTERVAL_TIMER_STATUS_OK 1
+#define INTERVAL_TIMER_STATUS_FAIL 0
+
+intervalTimer_status_t intervalTimer_initAll();
+intervalTimer_status_t intervalTimer_reset(uint32_t timerNumber);
+intervalTimer_status_t intervalTimer_start(uint32_t timerNumber);
+intervalTimer_status_t intervalTimer_stop(uint32_t timerNumber);
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber);
+
+#endif /* INTERVALTIMER_H_ */
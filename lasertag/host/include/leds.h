@@ -0,0 +1,12 @@
+// Host stand-in for the ZYBO LED package.
+
+#ifndef LEDS_H_
+#define LEDS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int32_t leds_init(bool printFailedStatusFlag);
+void leds_write(int32_t value);
+
+#endif /* LEDS_H_ */
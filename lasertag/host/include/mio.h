@@ -0,0 +1,16 @@
+// Host stand-in for the ZYBO MIO package. Pin writes are remembered so that
+// host tools can observe them (e.g., the transmitter output).
+
+#ifndef MIO_H_
+#define MIO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int32_t mio_init(bool printFailedStatusFlag);
+void mio_setPinAsInput(uint8_t pinNumber);
+void mio_setPinAsOutput(uint8_t pinNumber);
+int32_t mio_readPin(uint8_t pinNumber);
+void mio_writePin(uint8_t pinNumber, uint8_t value);
+
+#endif /* MIO_H_ */
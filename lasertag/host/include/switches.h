@@ -0,0 +1,11 @@
+// Host stand-in for the ZYBO slide-switches package.
+
+#ifndef SWITCHES_H_
+#define SWITCHES_H_
+
+#include <stdint.h>
+
+int32_t switches_init();
+int32_t switches_read();
+
+#endif /* SWITCHES_H_ */
@@ -0,0 +1,10 @@
+// Host stand-in for the ZYBO utils package.
+
+#ifndef UTILS_H_
+#define UTILS_H_
+
+#include <stdint.h>
+
+void utils_msDelay(uint32_t msDelay);
+
+#endif /* UTILS_H_ */
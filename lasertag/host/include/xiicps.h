@@ -0,0 +1,30 @@
+// Host stand-in for the Xilinx PS IIC driver that sound.c uses to set up the
+// audio CODEC. There is no CODEC on the host: every transfer succeeds and the
+// bus is never busy. See hostBoard.c.
+
+#ifndef XIICPS_H_
+#define XIICPS_H_
+
+#include "xil_io.h"
+#include "xil_types.h"
+#include "xstatus.h"
+
+typedef struct {
+  u16 DeviceId;
+  u32 BaseAddress;
+} XIicPs_Config;
+
+typedef struct {
+  XIicPs_Config Config;
+} XIicPs;
+
+XIicPs_Config *XIicPs_LookupConfig(u16 DeviceId);
+int XIicPs_CfgInitialize(XIicPs *InstancePtr, XIicPs_Config *ConfigPtr,
+                         u32 EffectiveAddr);
+int XIicPs_SelfTest(XIicPs *InstancePtr);
+int XIicPs_SetSClk(XIicPs *InstancePtr, u32 FsclHz);
+int XIicPs_MasterSendPolled(XIicPs *InstancePtr, u8 *MsgPtr, int ByteCount,
+                            u16 SlaveAddr);
+int XIicPs_BusIsBusy(XIicPs *InstancePtr);
+
+#endif /* XIICPS_H_ */
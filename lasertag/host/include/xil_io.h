@@ -0,0 +1,12 @@
+// Host stand-in for the Xilinx register access functions. Only the registers
+// of the audio I2S controller used by sound.c are simulated; see hostBoard.c.
+
+#ifndef XIL_IO_H_
+#define XIL_IO_H_
+
+#include "xil_types.h"
+
+u32 Xil_In32(UINTPTR Addr);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+
+#endif /* XIL_IO_H_ */
@@ -0,0 +1,10 @@
+// Host stand-in for the Xilinx lightweight printf.
+
+#ifndef XIL_PRINTF_H_
+#define XIL_PRINTF_H_
+
+#include <stdio.h>
+
+#define xil_printf printf
+
+#endif /* XIL_PRINTF_H_ */
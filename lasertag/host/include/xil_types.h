@@ -0,0 +1,13 @@
+// Host stand-in for the Xilinx basic types used by the lasertag sources.
+
+#ifndef XIL_TYPES_H_
+#define XIL_TYPES_H_
+
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uintptr_t UINTPTR;
+
+#endif /* XIL_TYPES_H_ */
@@ -0,0 +1,13 @@
+// Host stand-in for the generated xparameters.h. Only the addresses used by
+// sources built on the host are provided, and the device IDs of the drivers
+// they open. The addresses are never dereferenced.
+
+#ifndef XPARAMETERS_H_
+#define XPARAMETERS_H_
+
+#define XPAR_BLUETOOTH_UARTLITE_0_BASEADDR 0x42C00000
+#define XPAR_AXI_I2S_ADI_1_S_AXI_BASEADDR 0x43C10000
+#define XPAR_XIICPS_0_DEVICE_ID 0
+#define XPAR_SCUTIMER_DEVICE_ID 0
+
+#endif /* XPARAMETERS_H_ */
@@ -0,0 +1,12 @@
+// Host stand-in for the Xilinx ARM instruction wrappers. Only wfi() is
+// provided: it runs the handler set with hostBoard_setInterruptHandler(), as
+// if a timer interrupt had woken the CPU. See hostBoard.c.
+
+#ifndef XPSEUDO_ASM_H_
+#define XPSEUDO_ASM_H_
+
+void hostBoard_waitForInterrupt();
+
+#define wfi() hostBoard_waitForInterrupt()
+
+#endif /* XPSEUDO_ASM_H_ */
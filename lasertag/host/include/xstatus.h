@@ -0,0 +1,9 @@
+// Host stand-in for the Xilinx driver status codes.
+
+#ifndef XSTATUS_H_
+#define XSTATUS_H_
+
+#define XST_SUCCESS 0L
+#define XST_FAILURE 1L
+
+#endif /* XSTATUS_H_ */
@@ -0,0 +1,15 @@
+// Host stand-in for the Xilinx global timer driver. The time comes from the
+// host monotonic clock, in nanoseconds. See hostBoard.c.
+
+#ifndef XTIME_L_H_
+#define XTIME_L_H_
+
+#include <stdint.h>
+
+#define COUNTS_PER_SECOND 1000000000ULL
+
+typedef uint64_t XTime;
+
+void XTime_GetTime(XTime *Xtime_Global);
+
+#endif /* XTIME_L_H_ */
@@ -0,0 +1,104 @@
+// Host build of the queue package (on the ZYBO it comes from the queue
+// library). Standard circular queue that leaves one location empty so that
+// full and empty are easy to tell apart.
+
+#include "queue.h"
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Allocates the data array (one extra location for the empty slot) and
+// initializes the rest of the queue.
+void queue_init(queue_t *q, queue_size_t size, const char *name) {
+  q->underflowFlag = false;
+  q->overflowFlag = false;
+  q->indexIn = 0;
+  q->indexOut = 0;
+  q->elementCount = 0;
+  q->size = size + 1; // Add one location for the empty slot.
+  q->data = (queue_data_t *)malloc(q->size * sizeof(queue_data_t));
+  if (q->data == NULL) {
+    printf("Error!!!: queue_init() failed to allocate %lu elements.\n",
+           (unsigned long)size);
+    assert(false);
+  }
+  strncpy(q->name, name, QUEUE_MAX_NAME_SIZE - 1);
+  q->name[QUEUE_MAX_NAME_SIZE - 1] = 0;
+}
+
+// Get the user-assigned name for the queue.
+const char *queue_name(queue_t *q) { return q->name; }
+
+// Tell the user size in terms of usable locations.
+queue_size_t queue_size(queue_t *q) { return q->size - 1; }
+
+// Returns true if the queue is full.
+bool queue_full(queue_t *q) { return q->elementCount == q->size - 1; }
+
+// Returns true if the queue is empty.
+bool queue_empty(queue_t *q) { return q->elementCount == 0; }
+
+// Pushes a new element unless the queue is full.
+void queue_push(queue_t *q, queue_data_t value) {
+  if (queue_full(q)) {
+    q->overflowFlag = true;
+    printf("queue_push(): %s is full.\n", q->name);
+    return;
+  }
+  q->underflowFlag = false;
+  q->data[q->indexIn] = value;
+  q->indexIn = (q->indexIn + 1) % q->size;
+  q->elementCount++;
+}
+
+// Removes and returns the oldest element unless the queue is empty.
+queue_data_t queue_pop(queue_t *q) {
+  if (queue_empty(q)) {
+    q->underflowFlag = true;
+    printf("queue_pop(): %s is empty.\n", q->name);
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  q->overflowFlag = false;
+  queue_data_t value = q->data[q->indexOut];
+  q->indexOut = (q->indexOut + 1) % q->size;
+  q->elementCount--;
+  return value;
+}
+
+// If the queue is full, pop and then push. Otherwise just push.
+void queue_overwritePush(queue_t *q, queue_data_t value) {
+  if (queue_full(q))
+    queue_pop(q);
+  queue_push(q, value);
+}
+
+// Random-access read, index 0 is the oldest element.
+queue_data_t queue_readElementAt(queue_t *q, queue_index_t index) {
+  if (index >= q->elementCount) {
+    printf("queue_readElementAt(): index %lu out of range for %s.\n",
+           (unsigned long)index, q->name);
+    return QUEUE_RETURN_ERROR_VALUE;
+  }
+  return q->data[(q->indexOut + index) % q->size];
+}
+
+// Returns a count of the elements currently contained in the queue.
+queue_size_t queue_elementCount(queue_t *q) { return q->elementCount; }
+
+// Returns true if an underflow has occurred.
+bool queue_underflow(queue_t *q) { return q->underflowFlag; }
+
+// Returns true if an overflow has occurred.
+bool queue_overflow(queue_t *q) { return q->overflowFlag; }
+
+// Frees the storage that was malloc'd in queue_init().
+void queue_garbageCollect(queue_t *q) { free(q->data); }
+
+// Prints the contents of the queue, oldest element first.
+void queue_print(queue_t *q) {
+  printf("%s:", q->name);
+  for (queue_index_t i = 0; i < q->elementCount; i++)
+    printf(" %lf", queue_readElementAt(q, i));
+  printf("\n");
+}
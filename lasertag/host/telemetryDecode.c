@@ -0,0 +1,185 @@
+// Decodes a lasertag telemetry stream and prints one JSON object per record.
+//
+// Usage: telemetryDecode [file]
+//        telemetryDecode --loopback [seconds] [--quiet]
+//
+// With a file (or stdin) the bytes are taken as captured from the bluetooth
+// link. With --loopback a synthetic game is sent through telemetry.c,
+// bluetooth.c and the simulated UART, looped back over a 9600 baud line and
+// decoded. A summary goes to stderr; the exit status is non-zero if any frame
+// was dropped or corrupted.
+
+#include "bluetooth.h"
+#include "hostBoard.h"
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TELEMETRY_DECODE_DEFAULT_SECONDS 10
+#define TELEMETRY_DECODE_BAUD_RATE 9600
+#define TELEMETRY_DECODE_BITS_PER_BYTE 10 // Start, 8 data and stop bits.
+#define TELEMETRY_DECODE_POLL_PERIOD_MS 5
+#define TELEMETRY_DECODE_POWER_PERIOD_MS 100
+#define TELEMETRY_DECODE_STATUS_PERIOD_MS 500
+#define TELEMETRY_DECODE_HIT_PERIOD_MS 700
+#define TELEMETRY_DECODE_SAMPLES_PER_MS 100
+#define TELEMETRY_DECODE_MS_PER_SECOND 1000
+#define TELEMETRY_DECODE_READ_SIZE 64
+
+static bool quiet = false;
+static uint32_t recordCount = 0;
+
+// Prints a record as a single line of JSON.
+static void printRecord(const telemetry_record_t *record) {
+  recordCount++;
+  if (quiet)
+    return;
+  printf("{\"sequence\": %u, ", record->sequence);
+  switch (record->type) {
+  case telemetry_hit_e:
+    printf("\"type\": \"hit\", \"sampleIndex\": %llu, \"frequency\": %u, "
+           "\"peakPower\": %.4g, \"medianPower\": %.4g, \"margin\": %.3g}\n",
+           (unsigned long long)record->data.hit.sampleIndex,
+           record->data.hit.frequencyNumber, record->data.hit.peakPower,
+           record->data.hit.medianPower, record->data.hit.margin);
+    break;
+  case telemetry_powerKey_e:
+  case telemetry_powerDelta_e:
+    printf("\"type\": \"power\", \"values\": [");
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      printf("%s%.4g", i ? ", " : "", record->data.powerValues[i]);
+    printf("]}\n");
+    break;
+  case telemetry_status_e:
+    printf("\"type\": \"status\", \"remainingShots\": %u, \"lives\": %u, "
+           "\"droppedSamples\": %u, \"overloadEpisodes\": %u, "
+           "\"isrOverruns\": %u, \"droppedHitEvents\": %u, "
+           "\"droppedFrames\": %u}\n",
+           record->data.status.remainingShots, record->data.status.lives,
+           record->data.status.droppedSamples,
+           record->data.status.overloadEpisodes,
+           record->data.status.isrOverruns,
+           record->data.status.droppedHitEvents,
+           record->data.status.droppedFrames);
+    break;
+  }
+}
+
+// Decodes a captured stream.
+static void decodeFile(FILE *file, telemetry_decoder_t *decoder) {
+  int byte;
+  telemetry_record_t record;
+  while ((byte = fgetc(file)) != EOF)
+    if (telemetry_decodeByte(decoder, byte, &record))
+      printRecord(&record);
+}
+
+// Drains the bluetooth receive queue into the decoder.
+static void decodeReceived(telemetry_decoder_t *decoder) {
+  uint8_t data[TELEMETRY_DECODE_READ_SIZE];
+  uint16_t count;
+  telemetry_record_t record;
+  while ((count = bluetooth_receiveQueueRead(data, sizeof(data))))
+    for (uint16_t i = 0; i < count; i++)
+      if (telemetry_decodeByte(decoder, data[i], &record))
+        printRecord(&record);
+}
+
+// Advances the link by a millisecond. The line carries 9600 baud worth of
+// bytes, and the bluetooth driver is polled every few milliseconds.
+static void stepLink(uint32_t ms, telemetry_decoder_t *decoder) {
+  static uint32_t lineBits = 0;
+  lineBits += TELEMETRY_DECODE_BAUD_RATE / TELEMETRY_DECODE_MS_PER_SECOND;
+  if (ms % TELEMETRY_DECODE_POLL_PERIOD_MS)
+    return;
+  bluetooth_poll();
+  lineBits -= hostBoard_uartLoopback(lineBits / TELEMETRY_DECODE_BITS_PER_BYTE) *
+              TELEMETRY_DECODE_BITS_PER_BYTE;
+  decodeReceived(decoder);
+}
+
+// Plays a synthetic game through the loopback link. Returns the number of
+// records sent.
+static uint32_t runLoopback(uint32_t seconds, telemetry_decoder_t *decoder) {
+  bluetooth_init();
+  telemetry_init();
+  uint32_t sent = 0;
+  uint8_t lives = 3;
+  telemetry_setLives(lives);
+  for (uint32_t ms = 1; ms <= seconds * TELEMETRY_DECODE_MS_PER_SECOND; ms++) {
+    if (ms % TELEMETRY_DECODE_POWER_PERIOD_MS == 0) {
+      double powerValues[FILTER_FREQUENCY_COUNT];
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+        powerValues[i] = 1000.0 * (i + 1) + (ms % 977) * (i + 3);
+      sent += telemetry_sendPowerSnapshot(powerValues);
+    }
+    if (ms % TELEMETRY_DECODE_HIT_PERIOD_MS == 0) {
+      detector_hitEvent_t hit = {
+          .sampleIndex = (uint64_t)ms * TELEMETRY_DECODE_SAMPLES_PER_MS,
+          .frequencyNumber = ms / TELEMETRY_DECODE_HIT_PERIOD_MS %
+                             FILTER_FREQUENCY_COUNT,
+          .peakPower = 2.0e5,
+          .medianPower = 800.0,
+          .margin = 12.5};
+      sent += telemetry_sendHitEvent(&hit);
+    }
+    if (ms % TELEMETRY_DECODE_STATUS_PERIOD_MS == 0) {
+      telemetry_status_t status = {
+          .remainingShots = 10 - ms / TELEMETRY_DECODE_STATUS_PERIOD_MS % 10,
+          .lives = lives,
+          .droppedFrames = telemetry_getDroppedFrameCount()};
+      sent += telemetry_sendStatus(&status);
+    }
+    stepLink(ms, decoder);
+  }
+  // Give the line a second to drain.
+  for (uint32_t ms = 1; ms <= TELEMETRY_DECODE_MS_PER_SECOND; ms++)
+    stepLink(ms, decoder);
+  return sent;
+}
+
+int main(int argc, char *argv[]) {
+  bool loopback = false;
+  uint32_t seconds = TELEMETRY_DECODE_DEFAULT_SECONDS;
+  const char *fileName = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--loopback")) {
+      loopback = true;
+      if (i + 1 < argc && argv[i + 1][0] != '-')
+        seconds = strtoul(argv[++i], NULL, 10);
+    } else if (!strcmp(argv[i], "--quiet")) {
+      quiet = true;
+    } else {
+      fileName = argv[i];
+    }
+  }
+  telemetry_decoder_t decoder;
+  telemetry_initDecoder(&decoder);
+  uint32_t sent = 0;
+  if (loopback) {
+    sent = runLoopback(seconds, &decoder);
+  } else {
+    FILE *file = fileName ? fopen(fileName, "rb") : stdin;
+    if (file == NULL) {
+      perror(fileName);
+      return EXIT_FAILURE;
+    }
+    decodeFile(file, &decoder);
+    if (fileName)
+      fclose(file);
+  }
+  fprintf(stderr,
+          "telemetryDecode: %u records from %u frames, %u CRC errors, %u lost "
+          "frames",
+          recordCount, decoder.frameCount, decoder.crcErrorCount,
+          decoder.lostFrameCount);
+  if (loopback)
+    fprintf(stderr, ", %u sent, %u dropped by the sender",
+            sent, telemetry_getDroppedFrameCount());
+  fprintf(stderr, ".\n");
+  bool success = decoder.crcErrorCount == 0 && decoder.lostFrameCount == 0 &&
+                 (!loopback || (recordCount == sent &&
+                                telemetry_getDroppedFrameCount() == 0));
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
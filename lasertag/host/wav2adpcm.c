@@ -0,0 +1,238 @@
+// Converts a sound to an IMA-ADPCM asset for sound.c. Replaces wav2c.
+//
+// Usage: wav2adpcm input [outputDirectory] [--rate sampleRate]
+//
+// input is either a PCM .wav file (8 or 16 bits, stereo is mixed to mono) or
+// a .wav.c array previously generated by wav2c. For .wav.c input the sample
+// rate is not recorded in the file and defaults to 48000 (--rate overrides).
+// Writes name.adpcm.c and name.adpcm.h, where name is the input file name
+// without .wav/.wav.c.
+
+#include "adpcm.h"
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WAV2ADPCM_DEFAULT_SAMPLE_RATE 48000
+#define WAV2ADPCM_BYTES_PER_LINE 16
+#define WAV2ADPCM_MAX_NAME 256
+#define WAV2ADPCM_OFFSET_BINARY_ZERO 32768 // wav2c wrote unsigned samples.
+#define WAV2ADPCM_8_BIT_ZERO 128
+
+typedef struct {
+  int16_t *samples;
+  uint32_t sampleCount;
+  uint32_t sampleRate;
+} sound_t;
+
+// Reads a whole file into memory. Returns NULL on failure.
+static uint8_t *readFile(const char *fileName, long *size) {
+  FILE *file = fopen(fileName, "rb");
+  if (file == NULL)
+    return NULL;
+  fseek(file, 0, SEEK_END);
+  *size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *contents = malloc(*size + 1);
+  if (contents && fread(contents, 1, *size, file) != (size_t)*size) {
+    free(contents);
+    contents = NULL;
+  }
+  if (contents)
+    contents[*size] = 0; // Lets the .wav.c parser treat it as a string.
+  fclose(file);
+  return contents;
+}
+
+static uint32_t readLe32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t readLe16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+// Parses a RIFF/WAVE PCM file.
+static bool parseWav(const uint8_t *contents, long size, sound_t *sound) {
+  if (size < 12 || memcmp(contents, "RIFF", 4) || memcmp(contents + 8, "WAVE", 4))
+    return false;
+  uint16_t channels = 0, bitsPerSample = 0;
+  const uint8_t *data = NULL;
+  uint32_t dataSize = 0;
+  for (long offset = 12; offset + 8 <= size;) {
+    uint32_t chunkSize = readLe32(contents + offset + 4);
+    const uint8_t *chunk = contents + offset + 8;
+    if (!memcmp(contents + offset, "fmt ", 4) && chunkSize >= 16) {
+      if (readLe16(chunk) != 1) { // Only uncompressed PCM.
+        fprintf(stderr, "wav2adpcm: only PCM .wav files are supported.\n");
+        return false;
+      }
+      channels = readLe16(chunk + 2);
+      sound->sampleRate = readLe32(chunk + 4);
+      bitsPerSample = readLe16(chunk + 14);
+    } else if (!memcmp(contents + offset, "data", 4)) {
+      data = chunk;
+      dataSize = (offset + 8 + chunkSize <= size) ? chunkSize : size - offset - 8;
+    }
+    offset += 8 + chunkSize + (chunkSize & 1); // Chunks are word aligned.
+  }
+  if (data == NULL || channels == 0 ||
+      (bitsPerSample != 8 && bitsPerSample != 16)) {
+    fprintf(stderr, "wav2adpcm: unsupported .wav layout.\n");
+    return false;
+  }
+  uint32_t bytesPerFrame = channels * bitsPerSample / 8;
+  sound->sampleCount = dataSize / bytesPerFrame;
+  sound->samples = malloc(sound->sampleCount * sizeof(int16_t));
+  for (uint32_t i = 0; i < sound->sampleCount; i++) {
+    int32_t sum = 0; // Mix all channels down to mono.
+    for (uint16_t c = 0; c < channels; c++) {
+      const uint8_t *p = data + i * bytesPerFrame + c * bitsPerSample / 8;
+      sum += (bitsPerSample == 8) ? (p[0] - WAV2ADPCM_8_BIT_ZERO) << 8
+                                  : (int16_t)readLe16(p);
+    }
+    sound->samples[i] = sum / channels;
+  }
+  return true;
+}
+
+// Parses an array generated by wav2c: "uint16_t name[N] = { v, v, ... };".
+static bool parseWav2c(const char *contents, sound_t *sound) {
+  const char *brace = strchr(contents, '{');
+  if (brace == NULL)
+    return false;
+  // wav2c wrote 16-bit samples as offset binary in uint16_t arrays.
+  bool offsetBinary = strstr(contents, "uint16_t") != NULL &&
+                      strstr(contents, "uint16_t") < brace;
+  uint32_t capacity = 1024;
+  sound->samples = malloc(capacity * sizeof(int16_t));
+  sound->sampleCount = 0;
+  const char *p = brace + 1;
+  while (*p && *p != '}') {
+    if (isdigit((unsigned char)*p) || *p == '-') {
+      char *end;
+      long value = strtol(p, &end, 10);
+      if (offsetBinary)
+        value -= WAV2ADPCM_OFFSET_BINARY_ZERO;
+      if (sound->sampleCount == capacity) {
+        capacity *= 2;
+        sound->samples = realloc(sound->samples, capacity * sizeof(int16_t));
+      }
+      sound->samples[sound->sampleCount++] = (int16_t)value;
+      p = end;
+    } else {
+      p++;
+    }
+  }
+  return sound->sampleCount > 0;
+}
+
+// Strips directories and the .wav/.wav.c suffix to get the asset name.
+static void assetName(const char *inputFileName, char name[]) {
+  const char *base = strrchr(inputFileName, '/');
+  base = base ? base + 1 : inputFileName;
+  strncpy(name, base, WAV2ADPCM_MAX_NAME - 1);
+  name[WAV2ADPCM_MAX_NAME - 1] = 0;
+  char *suffix = strstr(name, ".wav");
+  if (suffix)
+    *suffix = 0;
+}
+
+// Writes name.adpcm.c and name.adpcm.h.
+static bool writeAsset(const char *directory, const char *name,
+                       const char *inputFileName, const sound_t *sound) {
+  uint32_t byteCount = ADPCM_BYTE_COUNT(sound->sampleCount);
+  uint8_t *encoded = calloc(byteCount, 1);
+  adpcm_encode(sound->samples, sound->sampleCount, encoded);
+  char upperName[WAV2ADPCM_MAX_NAME];
+  for (uint32_t i = 0; i <= strlen(name); i++)
+    upperName[i] = isalnum((unsigned char)name[i]) ? toupper(name[i])
+                                                   : (name[i] ? '_' : 0);
+  const char *base = strrchr(inputFileName, '/');
+  base = base ? base + 1 : inputFileName;
+  char fileName[2 * WAV2ADPCM_MAX_NAME];
+
+  snprintf(fileName, sizeof(fileName), "%s/%s.adpcm.c", directory, name);
+  FILE *file = fopen(fileName, "w");
+  if (file == NULL) {
+    perror(fileName);
+    free(encoded);
+    return false;
+  }
+  fprintf(file,
+          "// This file was generated by executing this statement: wav2adpcm "
+          "%s\n\n#include <stdint.h>\n\nconst uint8_t %s_adpcm[%u] = {\n",
+          base, name, byteCount);
+  for (uint32_t i = 0; i < byteCount; i++) {
+    bool endOfLine = (i % WAV2ADPCM_BYTES_PER_LINE ==
+                      WAV2ADPCM_BYTES_PER_LINE - 1) ||
+                     (i == byteCount - 1);
+    fprintf(file, "0x%02x%s%s", encoded[i], (i == byteCount - 1) ? "" : ",",
+            endOfLine ? "\n" : " ");
+  }
+  fprintf(file, "};\n");
+  fclose(file);
+  free(encoded);
+
+  snprintf(fileName, sizeof(fileName), "%s/%s.adpcm.h", directory, name);
+  file = fopen(fileName, "w");
+  if (file == NULL) {
+    perror(fileName);
+    return false;
+  }
+  fprintf(file,
+          "// This file was generated by executing this statement: wav2adpcm "
+          "%s\n#include <stdint.h>\nextern const uint8_t %s_adpcm[];\n"
+          "#define %s_ADPCM_SAMPLE_RATE %u\n"
+          "#define %s_ADPCM_NUMBER_OF_SAMPLES %u\n",
+          base, name, upperName, sound->sampleRate, upperName,
+          sound->sampleCount);
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  const char *inputFileName = NULL;
+  const char *directory = ".";
+  uint32_t rateOverride = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--rate") && i + 1 < argc)
+      rateOverride = strtoul(argv[++i], NULL, 10);
+    else if (inputFileName == NULL)
+      inputFileName = argv[i];
+    else
+      directory = argv[i];
+  }
+  if (inputFileName == NULL) {
+    fprintf(stderr,
+            "usage: %s input.wav|input.wav.c [outputDirectory] [--rate N]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+  long size;
+  uint8_t *contents = readFile(inputFileName, &size);
+  if (contents == NULL) {
+    perror(inputFileName);
+    return EXIT_FAILURE;
+  }
+  sound_t sound = {NULL, 0, WAV2ADPCM_DEFAULT_SAMPLE_RATE};
+  bool parsed = parseWav(contents, size, &sound) ||
+                parseWav2c((const char *)contents, &sound);
+  free(contents);
+  if (!parsed) {
+    fprintf(stderr, "wav2adpcm: %s is neither a PCM .wav nor a wav2c array.\n",
+            inputFileName);
+    return EXIT_FAILURE;
+  }
+  if (rateOverride)
+    sound.sampleRate = rateOverride;
+  char name[WAV2ADPCM_MAX_NAME];
+  assetName(inputFileName, name);
+  bool written = writeAsset(directory, name, inputFileName, &sound);
+  printf("wav2adpcm: %s -> %s.adpcm.c (%u samples at %u Hz, %u bytes)\n",
+         inputFileName, name, sound.sampleCount, sound.sampleRate,
+         ADPCM_BYTE_COUNT(sound.sampleCount));
+  free(sound.samples);
+  return written ? EXIT_SUCCESS : EXIT_FAILURE;
+}
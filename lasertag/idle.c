@@ -0,0 +1,79 @@
+
+#include "idle.h"
+#include "interrupts.h"
+#include "isr.h"
+#include "xpseudo_asm.h"
+#include "xtime_l.h"
+#include <stdio.h>
+
+#define RESET 0
+#define PERCENT 100.0
+
+#if IDLE_BATCH_SIZE < 1 || IDLE_BATCH_SIZE >= ISR_ADC_BUFFER_SIZE
+#error "IDLE_BATCH_SIZE must fit in the ADC buffer."
+#endif
+
+static uint32_t batchCount;
+static uint32_t wakeUpCount;
+static XTime startTime;
+static XTime sleepTime; // Total time spent in WFI.
+
+// Clears the statistics.
+void idle_init() {
+  batchCount = RESET;
+  wakeUpCount = RESET;
+  sleepTime = RESET;
+  XTime_GetTime(&startTime);
+}
+
+// Sleeps until the ADC buffer holds a batch of samples.
+void idle_waitForBatch() {
+#ifndef IDLE_SLEEP_DISABLED
+  // Interrupts are masked from the check to the WFI, so one that comes in
+  // between stays pending and ends the WFI at once instead of being slept
+  // through. WFI wakes on a pending interrupt even while it is masked.
+  interrupts_disableArmInts();
+  while (isr_adcBufferElementCount() < IDLE_BATCH_SIZE) {
+    XTime sleepStart, sleepEnd;
+    XTime_GetTime(&sleepStart);
+    wfi();
+    XTime_GetTime(&sleepEnd);
+    sleepTime += sleepEnd - sleepStart;
+    wakeUpCount++;
+    interrupts_enableArmInts(); // isr_function() runs here.
+    interrupts_disableArmInts();
+  }
+  interrupts_enableArmInts();
+#endif
+  batchCount++;
+}
+
+// Returns the statistics.
+idle_stats_t idle_getStats() {
+  XTime now;
+  XTime_GetTime(&now);
+  idle_stats_t stats;
+  stats.batchCount = batchCount;
+  stats.wakeUpCount = wakeUpCount;
+  stats.elapsedSeconds = (double)(now - startTime) / COUNTS_PER_SECOND;
+  stats.sleepSeconds = (double)sleepTime / COUNTS_PER_SECOND;
+  return stats;
+}
+
+// Returns the fraction of the time the CPU was awake.
+double idle_getDutyCycle() {
+  idle_stats_t stats = idle_getStats();
+  if (stats.elapsedSeconds <= 0)
+    return 1.0;
+  return 1.0 - stats.sleepSeconds / stats.elapsedSeconds;
+}
+
+// Prints the statistics to the console.
+void idle_printReport() {
+  idle_stats_t stats = idle_getStats();
+  printf("Idle: CPU awake %.1f%% of %.2f s, %lu batches of %u samples, "
+         "%.1f wake-ups per batch.\n",
+         idle_getDutyCycle() * PERCENT, stats.elapsedSeconds,
+         (unsigned long)stats.batchCount, IDLE_BATCH_SIZE,
+         stats.batchCount ? (double)stats.wakeUpCount / stats.batchCount : 0.0);
+}
@@ -0,0 +1,60 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef IDLE_H_
+#define IDLE_H_
+
+#include "filter.h"
+#include <stdint.h>
+
+// Lets the main loops sleep while the ADC buffer fills, instead of spinning
+// on detector(). idle_waitForBatch() stops the CPU with WFI until the timer
+// interrupt has put IDLE_BATCH_SIZE samples in the ADC buffer, waking only to
+// let isr_function() run. detector() then processes the batch in one go.
+//
+// idle also measures the duty cycle: the fraction of the time the CPU was not
+// stopped in idle_waitForBatch(), isr_function() included. The time comes
+// from the Zynq global timer, which keeps counting while the CPU sleeps.
+
+// Uncomment to keep the main loops spinning on detector() as before. Can also
+// be set from the build with -DIDLE_SLEEP_DISABLED.
+// #define IDLE_SLEEP_DISABLED
+
+// Samples per batch: one decimated output's worth, so every pass through the
+// main loop runs the FIR-filter once. It must leave room in the ADC buffer
+// (ISR_ADC_BUFFER_SIZE - 1 samples) for the time detector() takes.
+#ifndef IDLE_BATCH_SIZE
+#define IDLE_BATCH_SIZE FILTER_FIR_DECIMATION_FACTOR
+#endif
+
+// Statistics since idle_init().
+typedef struct {
+  uint32_t batchCount;   // Calls to idle_waitForBatch().
+  uint32_t wakeUpCount;  // Times the CPU woke from WFI.
+  double elapsedSeconds; // Time since idle_init().
+  double sleepSeconds;   // Of that, time spent in WFI.
+} idle_stats_t;
+
+// Clears the statistics. Call it when the measured interval starts.
+void idle_init();
+
+// Sleeps until the ADC buffer holds at least IDLE_BATCH_SIZE samples. Returns
+// at once if it already does. Must be called with interrupts enabled.
+void idle_waitForBatch();
+
+// Returns the statistics.
+idle_stats_t idle_getStats();
+
+// Returns the fraction of the time since idle_init() that the CPU was awake.
+double idle_getDutyCycle();
+
+// Prints the statistics to the console.
+void idle_printReport();
+
+#endif /* IDLE_H_ */
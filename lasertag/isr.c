@@ -2,16 +2,26 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include "adcCapture.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
+#include "isr.h"
+#include "latencyScreen.h"
 #include "lockoutTimer.h"
+#include "scheduler.h"
+#include "sound.h"
+#include "stageProfiler.h"
 #include "transmitter.h"
 #include "trigger.h"
 
-#define ADC_BUFFER_SIZE 20 // 100000
+#define ADC_BUFFER_SIZE ISR_ADC_BUFFER_SIZE
 #define RESET_VALUE 0
 #define INCRAMENT 1
 
+// The private timer runs at half the CPU clock.
+#define ISR_TIMER_LOAD_VALUE                                                   \
+  (ISR_CPU_CLOCK_HZ / 2 / ISR_INVOCATIONS_PER_SECOND - 1)
+
 // This implements a dedicated circular buffer for storing values
 // from the ADC until they are read and processed by detector().
 // adcBuffer_t is similar to a queue.
@@ -25,6 +35,19 @@ typedef struct {
 // This is the instantiation of adcBuffer.
 volatile static adcBuffer_t adcBuffer;
 
+// Number of isr_function() invocations that ran over ISR_BUDGET_CYCLES, and
+// the longest one seen.
+static volatile uint32_t budgetOverrunCount;
+static volatile uint32_t maxCycles;
+
+// Samples dropped because the main loop fell behind. Consecutive drops are
+// grouped into one event; the most recent events are kept in a ring.
+#define SAMPLE_LOSS_EVENT_MASK (ISR_SAMPLE_LOSS_EVENT_COUNT - 1)
+static volatile uint32_t droppedSampleCount;
+static volatile uint32_t sampleLossEventCount;
+static uint32_t lastSampleLossTick;
+static isr_sampleLossEvent_t sampleLossEvents[ISR_SAMPLE_LOSS_EVENT_COUNT];
+
 // Init adcBuffer.
 void adcBufferInit() {
   // loop through adcBuffer.data and set all values to 0
@@ -39,6 +62,10 @@ void adcBufferInit() {
 // Init everything in isr.
 void isr_init() {
   adcBufferInit(); // Init the local adcBuffer.
+  budgetOverrunCount = RESET_VALUE;
+  maxCycles = RESET_VALUE;
+  droppedSampleCount = RESET_VALUE;
+  sampleLossEventCount = RESET_VALUE;
                    // Call state machine init functions
   lockoutTimer_init();
   trigger_init();
@@ -46,6 +73,29 @@ void isr_init() {
   hitLedTimer_init();
 }
 
+// Sets the private timer to interrupt at the ADC rate.
+void isr_setSampleRate() {
+  interrupts_setPrivateTimerLoadValue(ISR_TIMER_LOAD_VALUE);
+}
+
+// Counts a dropped sample, extending the current loss event if the previous
+// sample was dropped too.
+static void recordSampleLoss() {
+  uint32_t now = scheduler_getTickCount();
+  droppedSampleCount++;
+  if (sampleLossEventCount && now - lastSampleLossTick <= 1) {
+    sampleLossEvents[(sampleLossEventCount - 1) & SAMPLE_LOSS_EVENT_MASK]
+        .sampleCount++;
+  } else {
+    isr_sampleLossEvent_t *event =
+        &sampleLossEvents[sampleLossEventCount & SAMPLE_LOSS_EVENT_MASK];
+    event->tick = now;
+    event->sampleCount = 1;
+    sampleLossEventCount++;
+  }
+  lastSampleLossTick = now;
+}
+
 // Implemented as a fixed-size circular buffer.
 // indexIn always points to an empty location (by definition).
 // indexOut always points to the oldest element.
@@ -65,6 +115,7 @@ void isr_addDataToAdcBuffer(uint32_t adcData) {
     adcBuffer.indexOut =
         (adcBuffer.indexOut + 1) %
         ADC_BUFFER_SIZE; // move the out pointer up (essentially a pop).
+    recordSampleLoss(); // The oldest sample was just overwritten.
   }
 }
 
@@ -86,18 +137,84 @@ uint32_t isr_removeDataFromAdcBuffer() {
   return returnValue;
 }
 
+// Removes up to maxCount of the oldest values from the ADC buffer at once, so
+// that interrupts are only disabled once for the lot.
+uint32_t isr_removeDataBlockFromAdcBuffer(isr_AdcValue_t values[],
+                                          uint32_t maxCount) {
+  uint32_t count =
+      adcBuffer.elementCount < maxCount ? adcBuffer.elementCount : maxCount;
+  uint32_t indexOut = adcBuffer.indexOut;
+  for (uint32_t i = 0; i < count; i++) {
+    values[i] = adcBuffer.data[indexOut];
+    indexOut = (indexOut + 1) % ADC_BUFFER_SIZE;
+  }
+  adcBuffer.indexOut = indexOut;
+  adcBuffer.elementCount -= count;
+  return count;
+}
+
 // Functional interface to access element count.
 uint32_t isr_adcBufferElementCount() { return adcBuffer.elementCount; }
 
+// Returns the number of isr_function() invocations that exceeded the budget.
+uint32_t isr_getBudgetOverrunCount() { return budgetOverrunCount; }
+
+// Returns the most cycles any isr_function() invocation has taken.
+uint32_t isr_getMaxCycles() { return maxCycles; }
+
+// Returns the number of ADC samples dropped because the buffer was full.
+uint32_t isr_getDroppedSampleCount() { return droppedSampleCount; }
+
+// Returns the number of sample-loss events.
+uint32_t isr_getSampleLossEventCount() { return sampleLossEventCount; }
+
+// Copies the most recent sample-loss events, oldest first.
+uint16_t isr_getSampleLossEvents(isr_sampleLossEvent_t events[],
+                                 uint16_t maxCount) {
+  uint32_t count = sampleLossEventCount;
+  if (count > ISR_SAMPLE_LOSS_EVENT_COUNT)
+    count = ISR_SAMPLE_LOSS_EVENT_COUNT;
+  if (count > maxCount)
+    count = maxCount;
+  uint32_t first = sampleLossEventCount - count;
+  for (uint32_t i = 0; i < count; i++)
+    events[i] = sampleLossEvents[(first + i) & SAMPLE_LOSS_EVENT_MASK];
+  return count;
+}
+
 // This function is invoked by the timer interrupt at 100 kHz.
 void isr_function() {
+  stageProfiler_cycles_t startCycles = stageProfiler_readCycleCounter();
+  STAGE_PROFILER_BEGIN(stageProfiler_isrTotal_e);
   // Put latest ADC value in adcBuffer
+  STAGE_PROFILER_BEGIN(stageProfiler_isrAdc_e);
   uint32_t adcData = interrupts_getAdcData();
   isr_addDataToAdcBuffer(adcData);
+  adcCapture_addSample(adcData); // Returns at once unless recording.
+  STAGE_PROFILER_END(stageProfiler_isrAdc_e);
+  scheduler_tick(); // Wall clock for the main-loop tasks.
   // Call state machine tick functions
+  STAGE_PROFILER_BEGIN(stageProfiler_isrLockoutTimer_e);
   lockoutTimer_tick();
+  STAGE_PROFILER_END(stageProfiler_isrLockoutTimer_e);
+  STAGE_PROFILER_BEGIN(stageProfiler_isrTrigger_e);
   trigger_tick();
+  STAGE_PROFILER_END(stageProfiler_isrTrigger_e);
+  STAGE_PROFILER_BEGIN(stageProfiler_isrTransmitter_e);
   transmitter_tick();
+  STAGE_PROFILER_END(stageProfiler_isrTransmitter_e);
+  STAGE_PROFILER_BEGIN(stageProfiler_isrHitLedTimer_e);
   hitLedTimer_tick();
+  STAGE_PROFILER_END(stageProfiler_isrHitLedTimer_e);
+  STAGE_PROFILER_BEGIN(stageProfiler_isrSound_e);
   sound_tick();
+  STAGE_PROFILER_END(stageProfiler_isrSound_e);
+  STAGE_PROFILER_END(stageProfiler_isrTotal_e);
+  // Long ticks delay the next ADC sample, so keep track of them.
+  stageProfiler_cycles_t cycles = stageProfiler_readCycleCounter() - startCycles;
+  if (cycles > maxCycles)
+    maxCycles = cycles;
+  if (cycles > ISR_BUDGET_CYCLES)
+    budgetOverrunCount++;
+  latencyScreen_record(latencyScreen_isrTick_e, cycles, ISR_BUDGET_CYCLES);
 }
@@ -9,8 +9,28 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #ifndef ISR_H_
 #define ISR_H_
+#include "filter.h"
 #include <stdint.h>
 
+// Capacity of the ADC buffer: two decimated outputs' worth of samples (20 at
+// 100 kHz). Once it is full, the oldest value is dropped.
+#define ISR_ADC_BUFFER_SIZE (2 * FILTER_FIR_DECIMATION_FACTOR)
+
+// The ISR samples the ADC, so it runs at the ADC rate. Tick counts are written
+// in milliseconds with this.
+#define ISR_TICKS_PER_MS FILTER_SAMPLE_FREQUENCY_IN_KHZ
+
+// isr_function() runs once per ADC sample, every 1/ISR_TICKS_PER_MS ms, so it
+// must finish in less than that. The budget is expressed in cycles of the
+// 650 MHz CPU clock, the rate of stageProfiler_readCycleCounter().
+#define ISR_CPU_CLOCK_HZ 650000000
+#define ISR_MS_PER_SECOND 1000
+#define ISR_INVOCATIONS_PER_SECOND (ISR_TICKS_PER_MS * ISR_MS_PER_SECOND)
+#define ISR_BUDGET_CYCLES (ISR_CPU_CLOCK_HZ / ISR_INVOCATIONS_PER_SECOND)
+
+// Number of the most recent sample-loss events that are kept.
+#define ISR_SAMPLE_LOSS_EVENT_COUNT 16
+
 typedef uint32_t
     isr_AdcValue_t; // Used to represent ADC values in the ADC buffer.
 
@@ -19,10 +39,21 @@ typedef uint32_t
 // Converter (ADC) is implemented in isr.c Values are added to this buffer by
 // the code in isr.c. Values are removed from this queue by code in detector.c
 
+// A run of consecutive ADC samples dropped because the ADC buffer was full.
+typedef struct {
+  uint32_t tick;        // scheduler_getTickCount() when the first was dropped.
+  uint32_t sampleCount; // Number of samples dropped in the run.
+} isr_sampleLossEvent_t;
+
 // Performs inits for anything in isr.c
 void isr_init();
 
-// This function is invoked by the timer interrupt at 100 kHz.
+// Sets the private timer to interrupt at the ADC rate. The interrupts package
+// starts it at 100 kHz, so call this after interrupts_initAll().
+void isr_setSampleRate();
+
+// This function is invoked by the timer interrupt at the ADC rate (100 kHz by
+// default).
 void isr_function();
 
 // This adds data to the ADC queue. Data are removed from this queue and used by
@@ -32,7 +63,33 @@ void isr_addDataToAdcBuffer(uint32_t adcData);
 // This removes a value from the ADC buffer.
 uint32_t isr_removeDataFromAdcBuffer();
 
+// Removes up to maxCount of the oldest values from the ADC buffer into
+// values[], oldest first. Returns the number removed.
+uint32_t isr_removeDataBlockFromAdcBuffer(isr_AdcValue_t values[],
+                                          uint32_t maxCount);
+
 // This returns the number of values in the ADC buffer.
 uint32_t isr_adcBufferElementCount();
 
+// Returns the number of isr_function() invocations that took longer than
+// ISR_BUDGET_CYCLES, the time between timer interrupts. Reset by isr_init().
+uint32_t isr_getBudgetOverrunCount();
+
+// Returns the most CPU cycles any isr_function() invocation has taken.
+uint32_t isr_getMaxCycles();
+
+// Returns the number of ADC samples dropped because the ADC buffer was full.
+// Reset by isr_init().
+uint32_t isr_getDroppedSampleCount();
+
+// Returns the number of sample-loss events since isr_init().
+uint32_t isr_getSampleLossEventCount();
+
+// Copies up to maxCount of the most recent sample-loss events into events[],
+// oldest first, and returns how many were copied. Only the last
+// ISR_SAMPLE_LOSS_EVENT_COUNT events are kept. Call with interrupts disabled
+// to be sure an event is not being updated while it is copied.
+uint16_t isr_getSampleLossEvents(isr_sampleLossEvent_t events[],
+                                 uint16_t maxCount);
+
 #endif /* ISR_H_ */
@@ -0,0 +1,175 @@
+
+#include "latencyScreen.h"
+#include "display.h"
+#include "histogram.h"
+#include <stdio.h>
+
+#define RESET 0
+#define LAST_BUCKET (LATENCY_SCREEN_BUCKET_COUNT - 1)
+#define OVER_LIMIT_COLOR DISPLAY_RED
+// A bucket with any counts stays visible, however small its share.
+#define MIN_BAR_HEIGHT 2
+#define PERCENT 100
+#define MAX_PERCENT_LABEL 99 // Top labels fit two characters.
+#define LABEL_SIZE 4
+
+// Counts since latencyScreen_init(). The ISR writes its own metric.
+static volatile uint32_t counts[latencyScreen_metricCount_e]
+                               [LATENCY_SCREEN_BUCKET_COUNT];
+// counts[] as of the last update, and the decayed distribution on the screen.
+static uint32_t foldedCounts[latencyScreen_metricCount_e]
+                            [LATENCY_SCREEN_BUCKET_COUNT];
+static uint32_t shownCounts[latencyScreen_metricCount_e]
+                           [LATENCY_SCREEN_BUCKET_COUNT];
+
+static const char *metricNames[latencyScreen_metricCount_e] = {
+    "ISR tick", "detector call", "ADC backlog", "dropped samples"};
+static const char *metricLabels[latencyScreen_metricCount_e] = {"I", "D", "B",
+                                                                "L"};
+static const uint16_t metricColors[latencyScreen_metricCount_e] = {
+    DISPLAY_CYAN, DISPLAY_GREEN, DISPLAY_YELLOW, DISPLAY_MAGENTA};
+
+// Returns the bucket for value: LAST_BUCKET at or over limit, and one lower
+// for each halving below it.
+static uint16_t bucketIndex(uint32_t value, uint32_t limit) {
+  if (value >= limit)
+    return LAST_BUCKET;
+  uint16_t bucket = LAST_BUCKET - 1;
+  while (bucket > 0 && ((uint64_t)value << (LAST_BUCKET - bucket)) < limit)
+    bucket--;
+  return bucket;
+}
+
+// Returns the height of a bar with count of the total counts of its metric.
+static uint16_t barHeight(uint32_t count, uint32_t total) {
+  if (count == 0)
+    return 0;
+  uint16_t height =
+      (uint64_t)count * HISTOGRAM_MAX_BAR_DATA_IN_PIXELS / total;
+  return height < MIN_BAR_HEIGHT ? MIN_BAR_HEIGHT : height;
+}
+
+// Clears all counts.
+void latencyScreen_init() {
+  for (uint16_t metric = 0; metric < latencyScreen_metricCount_e; metric++)
+    for (uint16_t bucket = 0; bucket < LATENCY_SCREEN_BUCKET_COUNT; bucket++) {
+      counts[metric][bucket] = RESET;
+      foldedCounts[metric][bucket] = RESET;
+      shownCounts[metric][bucket] = RESET;
+    }
+}
+
+// Counts value against limit.
+void latencyScreen_record(latencyScreen_metric_t metric, uint32_t value,
+                          uint32_t limit) {
+  counts[metric][bucketIndex(value, limit)]++;
+}
+
+// Sets up the histogram and starts a new distribution.
+void latencyScreen_show() {
+  histogram_init(LATENCY_SCREEN_BAR_COUNT);
+  for (uint16_t metric = 0; metric < latencyScreen_metricCount_e; metric++)
+    for (uint16_t bucket = 0; bucket < LATENCY_SCREEN_BUCKET_COUNT; bucket++) {
+      uint16_t bar = metric * LATENCY_SCREEN_BUCKET_COUNT + bucket;
+      histogram_setBarColor(bar, bucket == LAST_BUCKET ? OVER_LIMIT_COLOR
+                                                       : metricColors[metric]);
+      histogram_setBarLabel(bar, metricLabels[metric]);
+      // Only what happens from now on is shown.
+      foldedCounts[metric][bucket] = counts[metric][bucket];
+      shownCounts[metric][bucket] = RESET;
+    }
+  histogram_redrawBottomLabels();
+}
+
+// Folds in the new counts, halving the old ones, and draws the bars.
+void latencyScreen_update() {
+  for (uint16_t metric = 0; metric < latencyScreen_metricCount_e; metric++) {
+    uint32_t total = 0;
+    for (uint16_t bucket = 0; bucket < LATENCY_SCREEN_BUCKET_COUNT; bucket++) {
+      uint32_t count = counts[metric][bucket];
+      shownCounts[metric][bucket] =
+          shownCounts[metric][bucket] / 2 +
+          (count - foldedCounts[metric][bucket]);
+      foldedCounts[metric][bucket] = count;
+      total += shownCounts[metric][bucket];
+    }
+    for (uint16_t bucket = 0; bucket < LATENCY_SCREEN_BUCKET_COUNT; bucket++) {
+      uint32_t count = shownCounts[metric][bucket];
+      char label[LABEL_SIZE] = "";
+      if (count) {
+        uint32_t percent = (uint64_t)count * PERCENT / total;
+        if (percent == 0)
+          snprintf(label, LABEL_SIZE, "<1");
+        else
+          snprintf(label, LABEL_SIZE, "%lu",
+                   (unsigned long)(percent < MAX_PERCENT_LABEL
+                                       ? percent
+                                       : MAX_PERCENT_LABEL));
+      }
+      histogram_setBarData(metric * LATENCY_SCREEN_BUCKET_COUNT + bucket,
+                           barHeight(count, total), label);
+    }
+  }
+  histogram_updateDisplay();
+}
+
+// Prints the counts since latencyScreen_init().
+void latencyScreen_printReport() {
+  printf("Latency counts by fraction of the limit:\n");
+  printf("%-16s %10s %10s %10s %10s %10s %10s\n", "", "<1/16", "<1/8",
+         "<1/4", "<1/2", "<1", ">=1");
+  for (uint16_t metric = 0; metric < latencyScreen_metricCount_e; metric++) {
+    printf("%-16s", metricNames[metric]);
+    for (uint16_t bucket = 0; bucket < LATENCY_SCREEN_BUCKET_COUNT; bucket++)
+      printf(" %10lu", (unsigned long)counts[metric][bucket]);
+    printf("\n");
+  }
+}
+
+#define TEST_LIMIT 16
+#define TEST_VALUE_COUNT 10
+#define TEST_IN_BUDGET_COUNT 90
+#define TEST_OVER_BUDGET_COUNT 10
+
+// Checks the bucketing and the distribution with known values.
+bool latencyScreen_runTest() {
+  bool success = true;
+  printf("****************** latencyScreen_runTest() ******************\n");
+  const uint32_t values[TEST_VALUE_COUNT] = {0, 1, 2, 3, 4, 7, 8, 15, 16, 100};
+  const uint16_t buckets[TEST_VALUE_COUNT] = {0, 1, 2, 2, 3, 3, 4, 4, 5, 5};
+  for (uint16_t i = 0; i < TEST_VALUE_COUNT; i++)
+    if (bucketIndex(values[i], TEST_LIMIT) != buckets[i]) {
+      printf("latencyScreen_runTest(): %lu went in bucket %u, not %u.\n",
+             (unsigned long)values[i], bucketIndex(values[i], TEST_LIMIT),
+             buckets[i]);
+      success = false;
+    }
+  // 10% of the ISR ticks over budget, then nothing new: the share stays the
+  // same while the counts halve.
+  latencyScreen_init();
+  latencyScreen_show();
+  for (uint16_t i = 0; i < TEST_IN_BUDGET_COUNT; i++)
+    latencyScreen_record(latencyScreen_isrTick_e, 0, TEST_LIMIT);
+  for (uint16_t i = 0; i < TEST_OVER_BUDGET_COUNT; i++)
+    latencyScreen_record(latencyScreen_isrTick_e, TEST_LIMIT, TEST_LIMIT);
+  latencyScreen_update();
+  latencyScreen_update();
+  if (shownCounts[latencyScreen_isrTick_e][0] != TEST_IN_BUDGET_COUNT / 2 ||
+      shownCounts[latencyScreen_isrTick_e][LAST_BUCKET] !=
+          TEST_OVER_BUDGET_COUNT / 2) {
+    printf("latencyScreen_runTest(): wrong distribution.\n");
+    success = false;
+  }
+  // A 10% share is a tenth of the full height; a tiny one is still visible.
+  uint32_t total = TEST_IN_BUDGET_COUNT + TEST_OVER_BUDGET_COUNT;
+  if (barHeight(TEST_OVER_BUDGET_COUNT, total) !=
+          HISTOGRAM_MAX_BAR_DATA_IN_PIXELS * TEST_OVER_BUDGET_COUNT / total ||
+      barHeight(1, PERCENT * PERCENT) != MIN_BAR_HEIGHT) {
+    printf("latencyScreen_runTest(): wrong bar heights.\n");
+    success = false;
+  }
+  latencyScreen_printReport();
+  latencyScreen_init();
+  printf("latencyScreen_runTest() %s.\n", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,73 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef LATENCYSCREEN_H_
+#define LATENCYSCREEN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A diagnostic screen that draws live latency distributions with the
+// histogram, so that an overloaded gun can be spotted on its own TFT. Each
+// metric is counted into LATENCY_SCREEN_BUCKET_COUNT buckets against a limit:
+//
+//   bucket  0        1           2          3          4          5
+//   value   < 1/16   < 1/8       < 1/4      < 1/2      < limit    >= limit
+//
+// The last bucket of each metric is drawn in red: the ISR or the detector ran
+// over its budget, the ADC buffer was full, or a run of samples was lost. The
+// bars are the share of each bucket, labelled with its percentage (99 means
+// 99% or more), and the bottom labels name the metrics: I(SR), D(etector),
+// B(acklog) and L(ost). The screen folds in the new counts on each update and
+// halves the older ones, so it follows the last second or so.
+//
+// Recording only increments a counter, so it is cheap enough for the ISR.
+// Drawing is not cheap: an update redraws most of the histogram and can keep
+// the main loop away from detector() for longer than the ADC buffer lasts, so
+// the screen adds to the load it shows. Schedule it as sheddable work.
+
+// Samples dropped between detector() calls are counted against this limit.
+#define LATENCY_SCREEN_DROPPED_SAMPLE_LIMIT 16
+#define LATENCY_SCREEN_BUCKET_COUNT 6
+
+// Metrics on the screen, left to right.
+typedef enum {
+  latencyScreen_isrTick_e,        // isr_function() cycles, ISR_BUDGET_CYCLES.
+  latencyScreen_detectorCall_e,   // detector() cycles, its samples' ticks.
+  latencyScreen_adcBacklog_e,     // ADC buffer samples, its capacity.
+  latencyScreen_droppedSamples_e, // Samples lost before a detector() call.
+  latencyScreen_metricCount_e     // Number of metrics, keep this last.
+} latencyScreen_metric_t;
+
+#define LATENCY_SCREEN_BAR_COUNT                                               \
+  (latencyScreen_metricCount_e * LATENCY_SCREEN_BUCKET_COUNT)
+
+// Clears all counts.
+void latencyScreen_init();
+
+// Counts value against limit. Each metric must only be recorded from one
+// context (either the ISR or the main loop).
+void latencyScreen_record(latencyScreen_metric_t metric, uint32_t value,
+                          uint32_t limit);
+
+// Sets up the histogram for the screen and starts a new distribution. Call
+// histogram_init() to go back to another plot.
+void latencyScreen_show();
+
+// Folds the counts since the last update into the distribution and draws it.
+void latencyScreen_update();
+
+// Prints the counts since latencyScreen_init() to the console.
+void latencyScreen_printReport();
+
+// Checks the bucketing and the distribution with known values. Returns true
+// if it passes.
+bool latencyScreen_runTest();
+
+#endif /* LATENCYSCREEN_H_ */
@@ -5,12 +5,12 @@
 #include <stdint.h>
 #include <stdio.h>
 
-#define COUNT_MAX 50000
+#define COUNT_MAX LOCKOUT_TIMER_EXPIRE_VALUE
 #define INTERVAL_COUNT_NUM 2
 
 volatile static bool timer_on;
 static bool timer_check;
-static uint32_t count_val;
+volatile static uint32_t count_val;
 
 // Calling this starts the timer.
 void lockoutTimer_start() { timer_on = true; }
@@ -24,6 +24,16 @@ bool lockoutTimer_running() {
     return false;
 }
 
+// Returns the number of ticks until the timer expires, or 0 if it is not
+// running.
+uint32_t lockoutTimer_getRemainingTicks() {
+  // Read the count first: the tick that turns the timer off also clears it,
+  // and a cleared count with the timer still on would read as a full lockout.
+  // count_val stays at 0 until the first tick after the timer is started.
+  uint32_t count = count_val;
+  return timer_on ? COUNT_MAX - count : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // States for the trigger state machine.
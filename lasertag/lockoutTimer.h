@@ -9,9 +9,11 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #ifndef LOCKOUTTIMER_H_
 #define LOCKOUTTIMER_H_
+#include "isr.h"
 #include <stdbool.h>
+#include <stdint.h>
 
-#define LOCKOUT_TIMER_EXPIRE_VALUE 50000 // Defined in terms of 100 kHz ticks.
+#define LOCKOUT_TIMER_EXPIRE_VALUE (500 * ISR_TICKS_PER_MS) // 1/2 second.
 
 // Calling this starts the timer.
 void lockoutTimer_start();
@@ -22,6 +24,10 @@ void lockoutTimer_init();
 // Returns true if the timer is running.
 bool lockoutTimer_running();
 
+// Returns the number of ticks until the timer expires, or 0 if it is not
+// running.
+uint32_t lockoutTimer_getRemainingTicks();
+
 // Standard tick function.
 void lockoutTimer_tick();
 
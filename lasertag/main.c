@@ -19,6 +19,9 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Uncomment to run two-player mode, Milestone 5
 // #define RUNNING_MODE_M5
 
+// Uncomment to record raw ADC samples to the console (see adcCapture.h)
+// #define RUNNING_MODE_ADC_CAPTURE
+
 // The following line enables the main() contained in laserTagMain.c
 // Leave this line uncommented unless you want to run some other special test
 // main().
@@ -29,17 +32,25 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include <assert.h>
 #include <stdio.h>
 
+#include "adcCapture.h"
+#include "adpcm.h"
 #include "buttons.h"
 #include "detector.h"
+#include "displayBuffer.h"
 #include "filter.h"
 #include "filterTest.h"
 #include "hitLedTimer.h"
 #include "interrupts.h"
 #include "isr.h"
+#include "latencyScreen.h"
 #include "lockoutTimer.h"
+#include "overload.h"
 #include "runningModes.h"
+#include "scheduler.h"
 #include "sound.h"
+#include "stageProfiler.h"
 #include "switches.h"
+#include "telemetry.h"
 #include "transmitter.h"
 #include "trigger.h"
 
@@ -56,6 +67,15 @@ int main() {
   detector_runTest(); // M3 T3
   // sound_runTest(); // M4
   // isr_test();
+  // stageProfiler_runTest();
+  // adpcm_runTest();
+  // displayBuffer_runTest();
+  // filter_runTest();
+  // scheduler_runTest();
+  // overload_runTest();
+  // latencyScreen_runTest();
+  // telemetry_runTest();
+  // adcCapture_runTest();
 #endif
 
 #ifdef RUNNING_MODE_M3_T2
@@ -64,6 +84,7 @@ int main() {
   isr_init();
 
   interrupts_initAll(true);           // main interrupt init function.
+  isr_setSampleRate();                // interrupt at the ADC rate.
   interrupts_enableTimerGlobalInts(); // enable global interrupts.
   interrupts_startArmPrivateTimer();  // start the main timer.
   interrupts_enableArmInts(); // now the ARM processor can see interrupts.
@@ -97,6 +118,10 @@ int main() {
   runningModes_twoTeams();
 #endif
 
+#ifdef RUNNING_MODE_ADC_CAPTURE
+  runningModes_recordAdcCapture();
+#endif
+
   return 0;
 }
 
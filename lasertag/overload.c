@@ -0,0 +1,154 @@
+
+#include "overload.h"
+#include "isr.h"
+#include "scheduler.h"
+#include <stdio.h>
+
+#define RESET 0
+#define OVERLOAD_HOLD_TICKS (OVERLOAD_HOLD_MS * SCHEDULER_TICKS_PER_MS)
+
+static bool overload_initFlag = false;
+static bool active;
+static uint32_t enterThreshold;
+static uint32_t exitThreshold;
+static uint32_t lastDroppedSampleCount;
+static uint32_t lastPressureTick; // Last time the backlog was too high.
+static uint32_t activeSinceTick;
+static uint32_t activeTickCount; // Completed overload episodes only.
+static uint32_t episodeCount;
+static uint32_t maxBacklog;
+
+// Sets the thresholds and clears all statistics.
+void overload_init(uint32_t enterBacklog, uint32_t exitBacklog) {
+  enterThreshold = enterBacklog;
+  exitThreshold = exitBacklog;
+  active = false;
+  lastDroppedSampleCount = isr_getDroppedSampleCount();
+  activeTickCount = RESET;
+  episodeCount = RESET;
+  maxBacklog = RESET;
+  overload_initFlag = true;
+}
+
+// Enters or leaves overload based on the backlog and on sample loss.
+void overload_update(uint32_t backlog) {
+  if (!overload_initFlag)
+    return;
+  uint32_t now = scheduler_getTickCount();
+  uint32_t droppedSampleCount = isr_getDroppedSampleCount();
+  bool pressure = backlog > enterThreshold ||
+                  droppedSampleCount != lastDroppedSampleCount;
+  lastDroppedSampleCount = droppedSampleCount;
+  if (backlog > maxBacklog)
+    maxBacklog = backlog;
+  if (pressure) {
+    lastPressureTick = now;
+    if (!active) {
+      active = true;
+      activeSinceTick = now;
+      episodeCount++;
+    }
+  } else if (active && backlog <= exitThreshold &&
+             now - lastPressureTick >= OVERLOAD_HOLD_TICKS) {
+    active = false;
+    activeTickCount += now - activeSinceTick;
+  }
+}
+
+// Returns true while optional work should be shed.
+bool overload_isActive() { return active; }
+
+// Returns the number of times overload was entered.
+uint32_t overload_getEpisodeCount() { return episodeCount; }
+
+// Returns the time spent overloaded, including the current episode.
+uint32_t overload_getActiveTickCount() {
+  return active ? activeTickCount + scheduler_getTickCount() - activeSinceTick
+                : activeTickCount;
+}
+
+// Returns the largest backlog seen.
+uint32_t overload_getMaxBacklog() { return maxBacklog; }
+
+// Prints overload statistics and the most recent sample-loss events.
+void overload_printReport() {
+  printf("Overload episodes: %lu, %.1f ms in total, max ADC backlog %lu.\n",
+         (unsigned long)episodeCount,
+         (double)overload_getActiveTickCount() / SCHEDULER_TICKS_PER_MS,
+         (unsigned long)maxBacklog);
+  printf("Dropped ADC samples: %lu in %lu events.\n",
+         (unsigned long)isr_getDroppedSampleCount(),
+         (unsigned long)isr_getSampleLossEventCount());
+  isr_sampleLossEvent_t events[ISR_SAMPLE_LOSS_EVENT_COUNT];
+  uint16_t count = isr_getSampleLossEvents(events, ISR_SAMPLE_LOSS_EVENT_COUNT);
+  for (uint16_t i = 0; i < count; i++)
+    printf("  at %10.2f ms: %lu samples dropped\n",
+           (double)events[i].tick / SCHEDULER_TICKS_PER_MS,
+           (unsigned long)events[i].sampleCount);
+}
+
+#define OVERLOAD_TEST_ENTER_BACKLOG 15
+#define OVERLOAD_TEST_EXIT_BACKLOG 5
+#define OVERLOAD_TEST_LOSS_RUN 3 // Samples dropped in the loss test.
+
+// Advances the scheduler clock by ticks.
+static void testAdvance(uint32_t ticks) {
+  for (uint32_t i = 0; i < ticks; i++)
+    scheduler_tick();
+}
+
+// Checks entry on backlog and on sample loss, hold time and exit.
+bool overload_runTest() {
+  printf("****************** overload_runTest() ******************\n");
+  bool success = true;
+  isr_init();
+  overload_init(OVERLOAD_TEST_ENTER_BACKLOG, OVERLOAD_TEST_EXIT_BACKLOG);
+  overload_update(OVERLOAD_TEST_ENTER_BACKLOG);
+  if (overload_isActive()) {
+    printf("overload_runTest(): entered at the threshold.\n");
+    success = false;
+  }
+  overload_update(OVERLOAD_TEST_ENTER_BACKLOG + 1);
+  // Caught up, but still inside the hold time.
+  testAdvance(OVERLOAD_HOLD_TICKS - 1);
+  overload_update(RESET);
+  if (!overload_isActive()) {
+    printf("overload_runTest(): left before the hold time.\n");
+    success = false;
+  }
+  // Past the hold time, but the backlog is not yet down to the exit level.
+  testAdvance(1);
+  overload_update(OVERLOAD_TEST_EXIT_BACKLOG + 1);
+  if (!overload_isActive()) {
+    printf("overload_runTest(): left above the exit threshold.\n");
+    success = false;
+  }
+  overload_update(OVERLOAD_TEST_EXIT_BACKLOG);
+  if (overload_isActive() ||
+      overload_getActiveTickCount() != OVERLOAD_HOLD_TICKS) {
+    printf("overload_runTest(): did not leave after %lu ticks.\n",
+           (unsigned long)overload_getActiveTickCount());
+    success = false;
+  }
+  // Overfill the ADC buffer: a dropped sample enters overload even if the
+  // backlog reported is low, and the drops are recorded as one event.
+  for (uint32_t i = 0; i < ISR_ADC_BUFFER_SIZE - 1 + OVERLOAD_TEST_LOSS_RUN;
+       i++) {
+    isr_addDataToAdcBuffer(RESET);
+    scheduler_tick();
+  }
+  overload_update(RESET);
+  isr_sampleLossEvent_t event;
+  if (!overload_isActive() || overload_getEpisodeCount() != 2 ||
+      isr_getDroppedSampleCount() != OVERLOAD_TEST_LOSS_RUN ||
+      isr_getSampleLossEvents(&event, 1) != 1 ||
+      event.sampleCount != OVERLOAD_TEST_LOSS_RUN) {
+    printf("overload_runTest(): sample loss was not handled.\n");
+    success = false;
+  }
+  overload_printReport();
+  isr_init();
+  overload_init(OVERLOAD_TEST_ENTER_BACKLOG, OVERLOAD_TEST_EXIT_BACKLOG);
+  printf("overload_runTest() %s.\n", success ? "passed" : "failed");
+  return success;
+}
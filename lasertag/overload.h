@@ -0,0 +1,54 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef OVERLOAD_H_
+#define OVERLOAD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Overload management. detector() reports the ADC backlog on every call. When
+// the backlog rises above the enter threshold, or the ISR has dropped a
+// sample, the system is overloaded and optional work is shed until the
+// detector catches up:
+// - scheduler tasks added as sheddable (the histogram) skip their runs,
+// - sound_pump() sends one mix batch per call instead of filling the FIFO.
+// Overload ends once the backlog is at or below the exit threshold and has
+// stayed clear of the enter threshold for OVERLOAD_HOLD_MS.
+
+#define OVERLOAD_HOLD_MS 100
+
+// Must be called before overload_update() does anything. Clears all
+// statistics.
+void overload_init(uint32_t enterBacklog, uint32_t exitBacklog);
+
+// Called by detector() with the number of samples waiting in the ADC buffer.
+void overload_update(uint32_t backlog);
+
+// Returns true while optional work should be shed.
+bool overload_isActive();
+
+// Returns the number of times overload was entered.
+uint32_t overload_getEpisodeCount();
+
+// Returns the total time spent overloaded, in ISR ticks (see ISR_TICKS_PER_MS).
+uint32_t overload_getActiveTickCount();
+
+// Returns the largest backlog passed to overload_update().
+uint32_t overload_getMaxBacklog();
+
+// Prints overload statistics and the most recent sample-loss events to the
+// console.
+void overload_printReport();
+
+// Checks entry on backlog and on sample loss, hold time and exit. Must be
+// run with interrupts off. Returns true if it passes.
+bool overload_runTest();
+
+#endif /* OVERLOAD_H_ */
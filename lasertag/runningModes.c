@@ -8,25 +8,33 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 */
 
 #include "runningModes.h"
+#include "adcCapture.h"
 #include "buttons.h"
 #include "detector.h"
 #include "display.h"
+#include "displayBuffer.h"
 #include "filter.h"
 #include "histogram.h"
 #include "hitLedTimer.h"
+#include "idle.h"
 #include "interrupts.h"
 #include "intervalTimer.h"
 #include "isr.h"
+#include "latencyScreen.h"
 #include "ledTimer.h"
 #include "leds.h"
 #include "lockoutTimer.h"
 #include "mio.h"
+#include "overload.h"
 #include "queue.h"
+#include "scheduler.h"
 #include "sound.h"
+#include "stageProfiler.h"
 #include "switches.h"
 #include "transmitter.h"
 #include "trigger.h"
 #include "utils.h"
+#include "xil_printf.h"
 #include "xparameters.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -55,8 +63,35 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define MAIN_CUMULATIVE_TIMER                                                  \
   INTERVAL_TIMER_TIMER_2 // Used to compute cumulative run-time in main.
 
-#define SYSTEM_TICKS_PER_HISTOGRAM_UPDATE                                      \
-  30000 // Update the histogram about 3 times per second.
+// Periods and budgets of the main-loop tasks (see scheduler.h). A task that
+// runs over its budget is scheduled less often.
+#define RUNNING_MODE_POWER_PLOT_PERIOD_MS 333 // About 3 updates per second.
+#define RUNNING_MODE_POWER_PLOT_BUDGET_MS 30
+#define RUNNING_MODE_HIT_PLOT_PERIOD_MS 100 // Hits show up within 0.1 s.
+#define RUNNING_MODE_HIT_PLOT_BUDGET_MS 30
+#define RUNNING_MODE_INPUT_PERIOD_MS 50 // Fast enough to catch a button press.
+#define RUNNING_MODE_INPUT_BUDGET_MS 1
+// Redrawing the latency screen is itself main-loop load: it can take longer
+// than the ADC buffer lasts, so some of the dropped samples it shows are its
+// own. It is shed in an overload like the other plots; the counts are kept and
+// show up in the first update after it.
+#define RUNNING_MODE_LATENCY_PLOT_PERIOD_MS 500
+#define RUNNING_MODE_LATENCY_PLOT_BUDGET_MS 30
+// Main-loop tasks wait while the ADC buffer is more than half full.
+#define RUNNING_MODE_DETECTOR_PRIORITY_BACKLOG (ISR_ADC_BUFFER_SIZE / 2)
+// Optional work is shed from three-quarters full until back to one quarter.
+#define RUNNING_MODE_OVERLOAD_ENTER_BACKLOG (ISR_ADC_BUFFER_SIZE * 3 / 4)
+#define RUNNING_MODE_OVERLOAD_EXIT_BACKLOG (ISR_ADC_BUFFER_SIZE / 4)
+#define RUNNING_MODE_SHEDDABLE true
+#define RUNNING_MODE_NOT_SHEDDABLE false
+
+// runningModes_recordAdcCapture() records this long, well inside the capture
+// ring (see adcCapture.h), so the console UART falling behind costs no samples.
+#define RUNNING_MODE_CAPTURE_MS 5000
+// Bytes handed to the UART per main-loop pass while recording: one FIFO's
+// worth, so the ADC buffer is emptied often.
+#define RUNNING_MODE_CAPTURE_WRITE_BYTES 64
+#define RUNNING_MODE_CAPTURE_DRAIN_BYTES ADC_CAPTURE_MAX_CHUNK_SIZE
 
 #define RUNNING_MODE_WARNING_TEXT_SIZE 2 // Upsize the text for visibility.
 #define RUNNING_MODE_WARNING_TEXT_COLOR DISPLAY_RED // Red for more visibility.
@@ -65,8 +100,16 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define RUNNING_MODE_SCREEN_X_ORIGIN 0 // Origin for reporting text.
 #define RUNNING_MODE_SCREEN_Y_ORIGIN 0 // Origin for reporting text.
 
-// Detector should be invoked this often for good performance.
+// Detector should be invoked this often for good performance. When the main
+// loop sleeps between batches it runs once per IDLE_BATCH_SIZE samples, so
+// half that rate is enough.
+#ifdef IDLE_SLEEP_DISABLED
 #define SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND 30000
+#else
+#define SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND                              \
+  (FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000 / IDLE_BATCH_SIZE / 2)
+#endif
+#define PERCENT 100.0 // Converts fractions to percentages.
 // ADC queue should have no more than this number of unprocessed elements for
 // good performance.
 #define SUGGESTED_REMAINING_ELEMENT_COUNT 500
@@ -78,6 +121,18 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // Keep track of detector invocations.
 static uint32_t detectorInvocationCount = 0;
 
+// Set by runningModes_pollInputs() when btn3 is pressed.
+static bool exitRequested = false;
+
+// Set by the shooter loop when a hit arrives, cleared once it is plotted.
+static bool hitCountsChanged = false;
+
+// btn1 toggles the latency screen (see latencyScreen.h). The request is set by
+// runningModes_pollInputs() and carried out by runningModes_plotLatencyTask().
+static bool latencyScreenRequested = false;
+static bool latencyScreenShown = false;
+static bool latencyButtonPressed = false;
+
 // This array is indexed by frequency number. If array-element[freq_no] == true,
 // the frequency is ignored, e.g., no hit will ever occur at that frequency.
 // static bool ignoredFrequenciesArray[FILTER_FREQUENCY_COUNT] =
@@ -94,81 +149,107 @@ static uint32_t detectorInvocationCount = 0;
 void runningModes_printRunTimeStatistics() {
   char sprintfBuffer[MAX_BUFFER_SIZE]; // Generic message buffer.
   // Setup the screen.
-  display_setTextSize(RUNNING_MODE_NORMAL_TEXT_SIZE);
-  display_setTextColor(RUNNING_MODE_NORMAL_TEXT_COLOR);
-  display_setCursor(RUNNING_MODE_SCREEN_X_ORIGIN, RUNNING_MODE_SCREEN_Y_ORIGIN);
-  display_fillScreen(DISPLAY_BLACK);
+  displayBuffer_setTextSize(RUNNING_MODE_NORMAL_TEXT_SIZE);
+  displayBuffer_setTextColor(RUNNING_MODE_NORMAL_TEXT_COLOR);
+  displayBuffer_setCursor(RUNNING_MODE_SCREEN_X_ORIGIN,
+                          RUNNING_MODE_SCREEN_Y_ORIGIN);
+  displayBuffer_fillScreen(DISPLAY_BLACK);
   if (interrupts_getAdcInputMode() == INTERRUPTS_ADC_UNIPOLAR_MODE) {
-    display_println("ADC mode: unipolar.\n\r");
+    displayBuffer_println("ADC mode: unipolar.\n\r");
   } else if (interrupts_getAdcInputMode() == INTERRUPTS_ADC_BIPOLAR_MODE) {
-    display_println("ADC mode: bipolar.\n\r");
+    displayBuffer_println("ADC mode: bipolar.\n\r");
   }
   // Print out the number of unprocessed elements in ADC queue.
-  display_print("Unprocessed elements in ADC queue:");
+  displayBuffer_print("Unprocessed elements in ADC queue:");
   uint32_t remainingElementCount = isr_adcBufferElementCount();
-  display_printlnDecimalInt(remainingElementCount);
-  display_printChar('\n');
+  displayBuffer_printlnDecimalInt(remainingElementCount);
+  displayBuffer_printChar('\n');
   double runningSeconds, isrRunningSeconds, mainLoopRunningSeconds;
   runningSeconds = intervalTimer_getTotalDurationInSeconds(TOTAL_RUNTIME_TIMER);
   // Print out total running time in seconds.
-  display_print("Measured run time in seconds: ");
+  displayBuffer_print("Measured run time in seconds: ");
   sprintf(sprintfBuffer, "%5.2f", runningSeconds);
-  display_print(sprintfBuffer);
-  display_printChar('\n');
-  display_printChar('\n');
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_printChar('\n');
+  displayBuffer_printChar('\n');
   isrRunningSeconds =
       intervalTimer_getTotalDurationInSeconds(ISR_CUMULATIVE_TIMER);
   // Print out cumulative time spent in timer ISR.
-  display_print("Cumulative run time in timerIsr: ");
+  displayBuffer_print("Cumulative run time in timerIsr: ");
   sprintf(sprintfBuffer, "%5.2f", isrRunningSeconds);
-  display_print(sprintfBuffer);
-  display_print(" (");
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_print(" (");
   sprintf(sprintfBuffer, "%5.2f", isrRunningSeconds / runningSeconds * 100);
-  display_print(sprintfBuffer);
-  display_println("%)");
-  display_printChar('\n');
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_println("%)");
+  displayBuffer_printChar('\n');
   mainLoopRunningSeconds =
       intervalTimer_getTotalDurationInSeconds(MAIN_CUMULATIVE_TIMER);
   // Print out cumulative spent in detector.
-  display_print("Cumulative run-time in detector: ");
+  displayBuffer_print("Cumulative run-time in detector: ");
   sprintf(sprintfBuffer, "%5.2f", mainLoopRunningSeconds / runningSeconds);
-  display_print(" (");
-  display_print(sprintfBuffer);
-  display_println("%)");
-  display_printChar('\n');
+  displayBuffer_print(" (");
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_println("%)");
+  displayBuffer_printChar('\n');
   uint32_t interruptCount = interrupts_isrInvocationCount();
   // Print out total interrupt count.
-  display_print("Total interrupts:            ");
-  display_printlnDecimalInt(interruptCount);
-  display_printChar('\n');
-  display_print("Detector invocation count: ");
+  displayBuffer_print("Total interrupts:            ");
+  displayBuffer_printlnDecimalInt(interruptCount);
+  displayBuffer_printChar('\n');
+  // Print out how many ISR invocations ran past the next timer tick.
+  displayBuffer_print("ISR invocations over budget: ");
+  displayBuffer_printlnDecimalInt(isr_getBudgetOverrunCount());
+  displayBuffer_printChar('\n');
+  // Print out how many ADC samples were lost and how often work was shed.
+  displayBuffer_print("Dropped ADC samples:         ");
+  displayBuffer_printlnDecimalInt(isr_getDroppedSampleCount());
+  displayBuffer_print("Overload episodes:           ");
+  displayBuffer_printlnDecimalInt(overload_getEpisodeCount());
+  displayBuffer_printChar('\n');
+  // Print out the fraction of the time the CPU was not asleep.
+  displayBuffer_print("CPU duty cycle:              ");
+  sprintf(sprintfBuffer, "%5.2f", idle_getDutyCycle() * PERCENT);
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_println("%");
+  displayBuffer_printChar('\n');
+  displayBuffer_print("Detector invocation count: ");
   // Print out detector invocations per second.
-  display_printlnDecimalInt(detectorInvocationCount);
-  display_printChar('\n');
-  display_print("Detector invocations per second: ");
+  displayBuffer_printlnDecimalInt(detectorInvocationCount);
+  displayBuffer_printChar('\n');
+  displayBuffer_print("Detector invocations per second: ");
   sprintf(sprintfBuffer, "%5.2f", detectorInvocationCount / runningSeconds);
-  display_print(sprintfBuffer);
-  display_printChar('\n');
-  display_printChar('\n');
+  displayBuffer_print(sprintfBuffer);
+  displayBuffer_printChar('\n');
+  displayBuffer_printChar('\n');
   // If the detector invocation rate is too low, inform the user.
   if (detectorInvocationCount / runningSeconds <
       SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND) {
-    display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
-    display_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
-    display_print("Detector should be called at least ");
-    display_printDecimalInt(SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND);
-    display_println(" times per second.");
-    display_printChar('\n');
+    displayBuffer_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
+    displayBuffer_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
+    displayBuffer_print("Detector should be called at least ");
+    displayBuffer_printDecimalInt(SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND);
+    displayBuffer_println(" times per second.");
+    displayBuffer_printChar('\n');
   }
   // If the unprocessed element count is too high, inform the user.
   if (remainingElementCount >= SUGGESTED_REMAINING_ELEMENT_COUNT) {
-    display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
-    display_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
-    display_println("ADC queue should contain ");
-    display_print("less than ");
-    display_printDecimalInt(SUGGESTED_REMAINING_ELEMENT_COUNT);
-    display_println(" elements.");
+    displayBuffer_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
+    displayBuffer_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
+    displayBuffer_println("ADC queue should contain ");
+    displayBuffer_print("less than ");
+    displayBuffer_printDecimalInt(SUGGESTED_REMAINING_ELEMENT_COUNT);
+    displayBuffer_println(" elements.");
   }
+  displayBuffer_flush(); // Send the whole screen at once.
+  scheduler_printReport(); // Task timing goes to the console.
+  overload_printReport();  // So do the sample-loss timestamps.
+  idle_printReport();      // And the time spent asleep.
+  latencyScreen_printReport();
+#ifdef STAGE_PROFILER_ENABLED
+  // The per-stage breakdown does not fit on the TFT, send it to the console.
+  stageProfiler_printReport();
+#endif
 }
 
 // Group all of the inits together to reduce visual clutter.
@@ -186,6 +267,13 @@ void runningModes_initAll() {
   trigger_init();
   lockoutTimer_init();
   sound_init();
+  stageProfiler_init();
+  scheduler_init(RUNNING_MODE_DETECTOR_PRIORITY_BACKLOG);
+  overload_init(RUNNING_MODE_OVERLOAD_ENTER_BACKLOG,
+                RUNNING_MODE_OVERLOAD_EXIT_BACKLOG);
+  latencyScreen_init();
+  latencyScreenRequested = false;
+  latencyScreenShown = false;
 }
 
 // Returns the current switch-setting
@@ -198,6 +286,57 @@ uint16_t runningModes_getFrequencySetting() {
     return switchSetting;
 }
 
+// Sets the transmitter frequency from the switches, checks btn3 and toggles
+// the latency screen when btn1 is pressed.
+void runningModes_pollInputs() {
+  transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
+  int32_t buttons = buttons_read();
+  exitRequested = buttons & BUTTONS_BTN3_MASK;
+  bool latencyButton = buttons & BUTTONS_BTN1_MASK;
+  if (latencyButton && !latencyButtonPressed)
+    latencyScreenRequested = !latencyScreenRequested;
+  latencyButtonPressed = latencyButton;
+}
+
+// Returns true if btn3 was pressed at the last poll.
+bool runningModes_exitRequested() { return exitRequested; }
+
+// Scheduler task: switches the TFT to or from the latency screen when btn1 was
+// pressed, and updates the screen while it is shown.
+void runningModes_plotLatencyTask() {
+  if (latencyScreenRequested != latencyScreenShown) {
+    latencyScreenShown = latencyScreenRequested;
+    if (latencyScreenShown)
+      latencyScreen_show();
+    else {
+      histogram_init(HISTOGRAM_BAR_COUNT); // Back to the mode's own plot.
+      hitCountsChanged = true;
+    }
+  }
+  if (latencyScreenShown)
+    latencyScreen_update();
+}
+
+// Scheduler task: plots the current power values on the TFT.
+static void runningModes_plotPowerTask() {
+  if (latencyScreenShown) // The latency screen has the TFT.
+    return;
+  double powerValues[FILTER_FREQUENCY_COUNT]; // Copy the current power
+                                              // values to here.
+  filter_getCurrentPowerValues(powerValues);
+  histogram_plotUserFrequencyPower(powerValues);
+}
+
+// Scheduler task: plots the hit counts on the TFT if they have changed.
+static void runningModes_plotHitsTask() {
+  if (!hitCountsChanged || latencyScreenShown)
+    return;
+  hitCountsChanged = false;
+  detector_hitCount_t hitCounts[DETECTOR_HIT_ARRAY_SIZE];
+  detector_getHitCounts(hitCounts);
+  histogram_plotUserHits(hitCounts);
+}
+
 // This mode runs continuously until btn3 is pressed.
 // When btn3 is pressed, it exits and prints performance information to the TFT.
 // During operation, it continuously displays that received power on each
@@ -218,18 +357,33 @@ void runningModes_continuous() {
   // = true.
   interrupts_initAll(true); // Init all interrupts (but does not enable the
                             // interrupts at the devices).
+  isr_setSampleRate();      // Interrupt at the ADC rate in filter.h.
 
   interrupts_enableTimerGlobalInts(); // Allows the timer to generate
                                       // interrupts.
   interrupts_startArmPrivateTimer();  // Start the private ARM timer running.
-  uint16_t histogramSystemTicks =
-      0; // Only update the histogram display every so many ticks.
+  // The histogram and the switches are handled on wall-clock periods.
+  scheduler_addTask("inputs", runningModes_pollInputs,
+                    RUNNING_MODE_INPUT_PERIOD_MS, RUNNING_MODE_INPUT_BUDGET_MS,
+                    RUNNING_MODE_NOT_SHEDDABLE);
+  scheduler_addTask("powerPlot", runningModes_plotPowerTask,
+                    RUNNING_MODE_POWER_PLOT_PERIOD_MS,
+                    RUNNING_MODE_POWER_PLOT_BUDGET_MS, RUNNING_MODE_SHEDDABLE);
+  scheduler_addTask("latencyPlot", runningModes_plotLatencyTask,
+                    RUNNING_MODE_LATENCY_PLOT_PERIOD_MS,
+                    RUNNING_MODE_LATENCY_PLOT_BUDGET_MS,
+                    RUNNING_MODE_SHEDDABLE);
+  runningModes_pollInputs(); // Start on the right frequency.
   intervalTimer_reset(
       ISR_CUMULATIVE_TIMER); // Used to measure ISR execution time.
   intervalTimer_reset(
       TOTAL_RUNTIME_TIMER); // Used to measure total program execution time.
   intervalTimer_reset(
       MAIN_CUMULATIVE_TIMER); // Used to measure main-loop execution time.
+  // The ARM does not see interrupts yet, so the ISR cannot race the reset.
+  stageProfiler_reset(); // Per-stage statistics cover the same interval.
+  idle_init();           // So does the duty cycle.
+  latencyScreen_init();  // And the latency counts.
   intervalTimer_start(
       TOTAL_RUNTIME_TIMER);            // Start measuring total execution time.
   transmitter_setContinuousMode(true); // Run the transmitter continuously.
@@ -237,28 +391,16 @@ void runningModes_continuous() {
                                // this.
   transmitter_run();           // Start the transmitter.
   detectorInvocationCount = 0; // Keep track of detector invocations.
-  while (!(buttons_read() &
-           BUTTONS_BTN3_MASK)) { // Run until you detect btn3 pressed.
-    transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
+  while (!runningModes_exitRequested()) { // Run until btn3 is pressed.
+    idle_waitForBatch(); // Sleep until the ISR has a batch of samples.
     detectorInvocationCount++; // Used for run-time statistics.
-    histogramSystemTicks++;    // Keep track of ticks so you know when to update
-                               // the histogram.
     // Run filters, compute power, etc.
     intervalTimer_start(MAIN_CUMULATIVE_TIMER); // Measure run-time when you are
                                                 // doing something.
     detector(INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
     intervalTimer_stop(MAIN_CUMULATIVE_TIMER);
-    // If enough ticks have transpired, update the histogram.
-    if (histogramSystemTicks >= SYSTEM_TICKS_PER_HISTOGRAM_UPDATE) {
-      double powerValues[FILTER_FREQUENCY_COUNT]; // Copy the current power
-                                                  // values to here.
-      filter_getCurrentPowerValues(
-          powerValues); // Copy the current power values.
-      histogram_plotUserFrequencyPower(
-          powerValues); // Plot the power values on the TFT.
-      histogramSystemTicks =
-          0; // Reset the tick count and wait for the next update time.
-    }
+    sound_pump(); // Refill the audio FIFO if the ISR asked for it.
+    scheduler_run(); // Histogram and switches, once the detector caught up.
   }
   interrupts_disableArmInts();           // Stop interrupts.
   runningModes_printRunTimeStatistics(); // Print the run-time statistics.
@@ -280,43 +422,54 @@ void runningModes_shooter() {
   trigger_enable();         // Makes the trigger state machine responsive to the
                             // trigger.
   interrupts_initAll(true); // Inits all interrupts but does not enable them.
+  isr_setSampleRate();      // Interrupt at the ADC rate in filter.h.
   interrupts_enableTimerGlobalInts(); // Allows the timer to generate
                                       // interrupts.
   interrupts_startArmPrivateTimer();  // Start the private ARM timer running.
-  uint16_t histogramSystemTicks =
-      0; // Only update the histogram display every so many ticks.
+  // Hits are plotted at a limited rate, however fast they arrive.
+  scheduler_addTask("inputs", runningModes_pollInputs,
+                    RUNNING_MODE_INPUT_PERIOD_MS, RUNNING_MODE_INPUT_BUDGET_MS,
+                    RUNNING_MODE_NOT_SHEDDABLE);
+  scheduler_addTask("hitPlot", runningModes_plotHitsTask,
+                    RUNNING_MODE_HIT_PLOT_PERIOD_MS,
+                    RUNNING_MODE_HIT_PLOT_BUDGET_MS, RUNNING_MODE_SHEDDABLE);
+  scheduler_addTask("latencyPlot", runningModes_plotLatencyTask,
+                    RUNNING_MODE_LATENCY_PLOT_PERIOD_MS,
+                    RUNNING_MODE_LATENCY_PLOT_BUDGET_MS,
+                    RUNNING_MODE_SHEDDABLE);
+  runningModes_pollInputs(); // Start on the right frequency.
+  hitCountsChanged = false;
   intervalTimer_reset(
       ISR_CUMULATIVE_TIMER); // Used to measure ISR execution time.
   intervalTimer_reset(
       TOTAL_RUNTIME_TIMER); // Used to measure total program execution time.
   intervalTimer_reset(
       MAIN_CUMULATIVE_TIMER); // Used to measure main-loop execution time.
+  // The ARM does not see interrupts yet, so the ISR cannot race the reset.
+  stageProfiler_reset(); // Per-stage statistics cover the same interval.
+  idle_init();           // So does the duty cycle.
+  latencyScreen_init();  // And the latency counts.
   intervalTimer_start(
       TOTAL_RUNTIME_TIMER);   // Start measuring total execution time.
   interrupts_enableArmInts(); // The ARM will start seeing interrupts after
                               // this.
   lockoutTimer_start(); // Ignore erroneous hits at startup (when all power
                         // values are essentially 0).
-  while ((!(buttons_read() & BUTTONS_BTN3_MASK)) &&
+  while (!runningModes_exitRequested() &&
          hitCount < MAX_HIT_COUNT) { // Run until you detect btn3 pressed.
-    transmitter_setFrequencyNumber(
-        runningModes_getFrequencySetting());    // Read the switches and switch
-                                                // frequency as required.
+    idle_waitForBatch(); // Sleep until the ISR has a batch of samples.
     intervalTimer_start(MAIN_CUMULATIVE_TIMER); // Measure run-time when you are
                                                 // doing something.
-    histogramSystemTicks++; // Keep track of ticks so you know when to update
-                            // the histogram.
     // Run filters, compute power, run hit-detection.
     detectorInvocationCount++;              // Used for run-time statistics.
     detector(INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
+    sound_pump(); // Refill the audio FIFO if the ISR asked for it.
     if (detector_hitDetected()) {           // Hit detected
       hitCount++;                           // increment the hit count.
       detector_clearHit();                  // Clear the hit.
-      detector_hitCount_t
-          hitCounts[DETECTOR_HIT_ARRAY_SIZE]; // Store the hit-counts here.
-      detector_getHitCounts(hitCounts);       // Get the current hit counts.
-      histogram_plotUserHits(hitCounts);      // Plot the hit counts on the TFT.
+      hitCountsChanged = true; // Plotted by runningModes_plotHitsTask().
     }
+    scheduler_run(); // Hit plot and switches, once the detector caught up.
     intervalTimer_stop(
         MAIN_CUMULATIVE_TIMER); // All done with actual processing.
   }
@@ -346,3 +499,64 @@ void runningModes_dumpRawAdcValues() {
     printf("raw ADC value: %d\n", signExtendedValue);
   }
 }
+
+// Writes capture bytes to the console. They go straight to the UART: stdout
+// would send a '\r' ahead of every 0x0A byte and break the chunk's CRC.
+static bool runningModes_writeCapture(const uint8_t data[], uint32_t length) {
+  for (uint32_t i = 0; i < length; i++)
+    outbyte(data[i]);
+  return true;
+}
+
+// Records the raw ADC samples for RUNNING_MODE_CAPTURE_MS, or until btn3 is
+// pressed, and streams them to the console in the format in adcCapture.h.
+// The trigger and transmitter still work, so shots can be recorded, but the
+// detector does not run: the console blocks for longer than the ADC buffer
+// lasts. Replay the capture on the host to see what the detector makes of it.
+void runningModes_recordAdcCapture() {
+  runningModes_initAll();
+  trigger_enable();
+  interrupts_initAll(true);
+  isr_setSampleRate();
+  interrupts_enableTimerGlobalInts();
+  interrupts_startArmPrivateTimer();
+  scheduler_addTask("inputs", runningModes_pollInputs,
+                    RUNNING_MODE_INPUT_PERIOD_MS, RUNNING_MODE_INPUT_BUDGET_MS,
+                    RUNNING_MODE_NOT_SHEDDABLE);
+  runningModes_pollInputs();
+  // Text before the header is skipped by the host reader.
+  printf("Recording ADC capture on frequency %d.\n",
+         runningModes_getFrequencySetting());
+  fflush(stdout);
+  if (!adcCapture_start(runningModes_getFrequencySetting(),
+                        runningModes_writeCapture)) {
+    printf("ADC capture could not be written.\n");
+    return;
+  }
+  interrupts_enableArmInts();
+  uint32_t startTick = scheduler_getTickCount();
+  while (!runningModes_exitRequested() && adcCapture_recording() &&
+         scheduler_getTickCount() - startTick <
+             RUNNING_MODE_CAPTURE_MS * ISR_TICKS_PER_MS) {
+    // Nobody reads the ADC buffer, so empty it to keep it from counting
+    // dropped samples.
+    interrupts_disableArmInts();
+    while (isr_adcBufferElementCount())
+      isr_removeDataFromAdcBuffer();
+    interrupts_enableArmInts();
+    adcCapture_poll(RUNNING_MODE_CAPTURE_WRITE_BYTES);
+    scheduler_run();
+  }
+  interrupts_disableArmInts();
+  adcCapture_stop();
+  while (adcCapture_poll(RUNNING_MODE_CAPTURE_DRAIN_BYTES))
+    ;
+  fflush(stdout);
+  adcCapture_stats_t stats = adcCapture_getStats();
+  printf("\nADC capture: %llu samples, %llu dropped, %lu chunks, %llu "
+         "bytes%s.\n",
+         (unsigned long long)stats.sampleCount,
+         (unsigned long long)stats.droppedSampleCount,
+         (unsigned long)stats.chunkCount, (unsigned long long)stats.byteCount,
+         stats.writeFailed ? ", write failed" : "");
+}
@@ -19,6 +19,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define LIVES 3
 #define HITS_PER_LIFE 5
 
+#include <stdbool.h>
 #include <stdint.h>
 
 // Prints out various run-time statistics on the TFT display.
@@ -65,7 +66,23 @@ void runningModes_testShootAllChannels();
 // Returns the current switch-setting
 uint16_t runningModes_getFrequencySetting();
 
+// Scheduler task for the game modes. Sets the transmitter frequency from the
+// slide switches, checks btn3 and uses btn1 to toggle the latency screen.
+void runningModes_pollInputs();
+
+// Scheduler task for the game modes. Shows or hides the latency screen (see
+// latencyScreen.h) as btn1 asks, and updates it while it is shown.
+void runningModes_plotLatencyTask();
+
+// Returns true if btn3 was pressed at the last runningModes_pollInputs().
+bool runningModes_exitRequested();
+
 // A simple test mode that continuously prints out raw ADC values.
 void runningModes_dumpRawAdcValues();
 
+// Records the raw ADC samples seen by the ISR for a few seconds and streams
+// them to the console as a capture (see adcCapture.h). Stops early if btn3 is
+// pressed.
+void runningModes_recordAdcCapture();
+
 #endif /* RUNNINGMODES_H_ */
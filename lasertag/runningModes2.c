@@ -8,6 +8,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 */
 
 #include "interrupts.h"
+#include "bluetooth/bluetooth.h"
 #include "runningModes.h"
 #include "buttons.h"
 #include "detector.h"
@@ -15,15 +16,19 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "filter.h"
 #include "histogram.h"
 #include "hitLedTimer.h"
+#include "idle.h"
 #include "intervalTimer.h"
 #include "isr.h"
+#include "latencyScreen.h"
 #include "ledTimer.h"
 #include "leds.h"
 #include "lockoutTimer.h"
 #include "mio.h"
 #include "queue.h"
+#include "scheduler.h"
 #include "sound.h"
 #include "switches.h"
+#include "telemetry.h"
 #include "transmitter.h"
 #include "trigger.h"
 #include "utils.h"
@@ -37,6 +42,20 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define INTERRUPTS_CURRENTLY_ENABLED true
 #define INTERRUPTS_CURRENTLY_DISABLE false
 
+// Feedback sounds are layered over whatever is already playing, so they are
+// mixed in at half gain to leave headroom.
+#define FEEDBACK_SOUND_GAIN (SOUND_GAIN_UNITY / 2)
+
+#define TWO_TEAMS_INPUT_PERIOD_MS 50 // how often the switches are read
+#define TWO_TEAMS_INPUT_BUDGET_MS 1
+#define TWO_TEAMS_LATENCY_PLOT_PERIOD_MS 500 // btn1 shows the latency screen
+#define TWO_TEAMS_LATENCY_PLOT_BUDGET_MS 30
+#define TWO_TEAMS_BLUETOOTH_PERIOD_MS 5 // keeps the UART FIFO topped up
+#define TWO_TEAMS_BLUETOOTH_BUDGET_MS 1
+#define TWO_TEAMS_TELEMETRY_POWER_PERIOD_MS 100
+#define TWO_TEAMS_TELEMETRY_STATUS_PERIOD_MS 500
+#define TWO_TEAMS_TELEMETRY_BUDGET_MS 1
+
 
 //#define IGNORE_OWN_FREQUENCY
 
@@ -69,8 +88,32 @@ void runningModes_twoTeams() {
   trigger_enable(); // enable the trigger
 
   interrupts_initAll(true); // init all interrupts
+  isr_setSampleRate(); // interrupt at the ADC rate in filter.h
   interrupts_enableTimerGlobalInts(); // timer generates interrupts
   interrupts_startArmPrivateTimer(); // private time start
+  scheduler_addTask("inputs", runningModes_pollInputs, TWO_TEAMS_INPUT_PERIOD_MS,
+                    TWO_TEAMS_INPUT_BUDGET_MS,
+                    false); // read the switches every so often, even in overload
+  scheduler_addTask("latencyPlot", runningModes_plotLatencyTask,
+                    TWO_TEAMS_LATENCY_PLOT_PERIOD_MS,
+                    TWO_TEAMS_LATENCY_PLOT_BUDGET_MS,
+                    true); // its redraw adds load, so shed it in overload
+  runningModes_pollInputs(); // start on the right frequency
+#ifdef TELEMETRY_ENABLED
+  bluetooth_init(); // stream the game to a phone or laptop
+  telemetry_init();
+  telemetry_setLives(lives);
+  scheduler_addTask("bluetooth", bluetooth_poll, TWO_TEAMS_BLUETOOTH_PERIOD_MS,
+                    TWO_TEAMS_BLUETOOTH_BUDGET_MS, false);
+  scheduler_addTask("telemetryPower", telemetry_powerTask,
+                    TWO_TEAMS_TELEMETRY_POWER_PERIOD_MS,
+                    TWO_TEAMS_TELEMETRY_BUDGET_MS, true);
+  scheduler_addTask("telemetryStatus", telemetry_statusTask,
+                    TWO_TEAMS_TELEMETRY_STATUS_PERIOD_MS,
+                    TWO_TEAMS_TELEMETRY_BUDGET_MS, true);
+#endif
+  idle_init(); // measure the duty cycle over the game
+  latencyScreen_init(); // and the latencies
   interrupts_enableArmInts(); // ARM will now see interrupts
 
   lockoutTimer_start(); //start to miss all the shots from before the start of the game
@@ -80,17 +123,30 @@ void runningModes_twoTeams() {
 
   // Implement game loop...
   while (lives > 0 ) {
-    transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
+    idle_waitForBatch(); // sleep until the ISR has a batch of samples
     detector(INTERRUPTS_CURRENTLY_ENABLED);
-    if (detector_hitDetected()){
-      detector_clearHit();
+    sound_pump(); // Refill the audio FIFO if the ISR asked for it.
+    scheduler_run(); // switches, once the detector has caught up
+    // Drain the hit event ring so that hits arriving between passes of this
+    // loop are not lost.
+    detector_hitEvent_t hitEvent;
+    while (lives > 0 && detector_popHitEvent(&hitEvent)){
       hitCount++;
+#ifdef TELEMETRY_ENABLED
+      telemetry_sendHitEvent(&hitEvent);
+#endif
       if (hitCount == HITS_PER_LIFE){
         hitCount = RESET;
         --lives;
-        // play lost life sound
+#ifdef TELEMETRY_ENABLED
+        telemetry_setLives(lives);
+#endif
+        sound_playSoundWithGain(sound_loseLife_e, FEEDBACK_SOUND_GAIN); // play lost life sound
+      } else {
+        sound_playSoundWithGain(sound_hit_e, FEEDBACK_SOUND_GAIN);
       }
     }
+    detector_clearHit();
   }
   interrupts_disableArmInts(); // Done with game loop, disable the interrupts.
   //hitLedTimer_turnLedOff();    // Save power :-)
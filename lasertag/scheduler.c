@@ -0,0 +1,262 @@
+
+#include "scheduler.h"
+#include "isr.h"
+#include "overload.h"
+#include <stdio.h>
+
+#define RESET 0
+
+typedef struct {
+  scheduler_taskFunction_t function;
+  uint32_t periodTicks;
+  uint32_t budgetTicks;
+  uint32_t nextRunTick; // Clock value at which the task is next due.
+  bool sheddable;       // Skipped during overload.
+  scheduler_taskStatistics_t statistics;
+} scheduler_task_t;
+
+static scheduler_task_t tasks[SCHEDULER_MAX_TASK_COUNT];
+static uint8_t taskCount;
+static uint32_t backlogThreshold;
+static uint32_t deferralCount;
+static volatile uint32_t tickCount;
+
+// True if clock value a is at or after b. Works across the 12-hour wrap of
+// the 32-bit tick count.
+static inline bool isAtOrAfter(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) >= 0;
+}
+
+// Removes all tasks and clears all statistics.
+void scheduler_init(uint32_t threshold) {
+  taskCount = RESET;
+  deferralCount = RESET;
+  backlogThreshold = threshold;
+}
+
+// Adds a task. The first run is one period from now.
+scheduler_taskId_t scheduler_addTask(const char *name,
+                                     scheduler_taskFunction_t function,
+                                     uint32_t periodMs, uint32_t budgetMs,
+                                     bool sheddable) {
+  if (taskCount == SCHEDULER_MAX_TASK_COUNT)
+    return SCHEDULER_INVALID_TASK_ID;
+  scheduler_task_t *task = &tasks[taskCount];
+  task->function = function;
+  task->periodTicks = periodMs * SCHEDULER_TICKS_PER_MS;
+  task->budgetTicks = budgetMs * SCHEDULER_TICKS_PER_MS;
+  task->nextRunTick = tickCount + task->periodTicks;
+  task->sheddable = sheddable;
+  task->statistics.name = name;
+  task->statistics.runCount = RESET;
+  task->statistics.overrunCount = RESET;
+  task->statistics.skipCount = RESET;
+  task->statistics.shedCount = RESET;
+  task->statistics.maxTicks = RESET;
+  return taskCount++;
+}
+
+// Advances the scheduler clock by one ISR tick.
+void scheduler_tick() { tickCount++; }
+
+// Returns the scheduler clock.
+uint32_t scheduler_getTickCount() { return tickCount; }
+
+// Skips the due run of a task and schedules its next period after now.
+static void shedTask(scheduler_task_t *task, uint32_t now) {
+  task->statistics.shedCount++;
+  task->nextRunTick += ((now - task->nextRunTick) / task->periodTicks + 1) *
+                       task->periodTicks;
+}
+
+// Runs the most overdue task if the ADC backlog allows it.
+bool scheduler_run() {
+  uint32_t now = tickCount;
+  bool overloaded = overload_isActive();
+  scheduler_task_t *due = NULL;
+  for (uint8_t i = 0; i < taskCount; i++) {
+    if (!isAtOrAfter(now, tasks[i].nextRunTick))
+      continue;
+    if (overloaded && tasks[i].sheddable)
+      shedTask(&tasks[i], now);
+    else if (due == NULL ||
+             !isAtOrAfter(tasks[i].nextRunTick, due->nextRunTick))
+      due = &tasks[i];
+  }
+  if (due == NULL)
+    return false;
+  // The detector comes first. The task stays due and runs once it catches up.
+  if (isr_adcBufferElementCount() > backlogThreshold) {
+    deferralCount++;
+    return false;
+  }
+  due->function();
+  uint32_t end = tickCount;
+  uint32_t elapsed = end - now;
+  scheduler_taskStatistics_t *statistics = &due->statistics;
+  statistics->runCount++;
+  if (elapsed > statistics->maxTicks)
+    statistics->maxTicks = elapsed;
+  if (due->budgetTicks && elapsed > due->budgetTicks) {
+    // Stretch the interval so the task keeps to budget/period of the CPU.
+    statistics->overrunCount++;
+    due->nextRunTick =
+        now + (uint64_t)elapsed * due->periodTicks / due->budgetTicks;
+    return true;
+  }
+  due->nextRunTick += due->periodTicks;
+  // Drop missed periods rather than running the task back to back.
+  if (isAtOrAfter(end, due->nextRunTick)) {
+    uint32_t missed = (end - due->nextRunTick) / due->periodTicks + 1;
+    statistics->skipCount += missed;
+    due->nextRunTick += missed * due->periodTicks;
+  }
+  return true;
+}
+
+// Returns the number of times a due task was held back by the ADC backlog.
+uint32_t scheduler_getDeferralCount() { return deferralCount; }
+
+// Copies the statistics of a task.
+void scheduler_getTaskStatistics(scheduler_taskId_t id,
+                                 scheduler_taskStatistics_t *statistics) {
+  *statistics = tasks[id].statistics;
+}
+
+// Prints the statistics of every task to the console.
+void scheduler_printReport() {
+  printf("%-12s %10s %10s %10s %10s %12s\n", "task", "runs", "overruns",
+         "skipped", "shed", "max (us)");
+  for (uint8_t i = 0; i < taskCount; i++) {
+    scheduler_taskStatistics_t *statistics = &tasks[i].statistics;
+    printf("%-12s %10lu %10lu %10lu %10lu %12lu\n", statistics->name,
+           (unsigned long)statistics->runCount,
+           (unsigned long)statistics->overrunCount,
+           (unsigned long)statistics->skipCount,
+           (unsigned long)statistics->shedCount,
+           (unsigned long)statistics->maxTicks * 1000 / SCHEDULER_TICKS_PER_MS);
+  }
+  printf("Task runs deferred for the detector: %lu\n",
+         (unsigned long)deferralCount);
+}
+
+#define SCHEDULER_TEST_BACKLOG_THRESHOLD 4
+#define SCHEDULER_TEST_FAST_PERIOD_MS 10
+#define SCHEDULER_TEST_SLOW_PERIOD_MS 25
+#define SCHEDULER_TEST_BUDGET_MS 1
+#define SCHEDULER_TEST_DURATION_MS 100
+#define SCHEDULER_TEST_CALL_INTERVAL_TICKS 7 // Main loop pass, in ticks.
+#define SCHEDULER_TEST_OVERRUN_MS 3 // How long the slow task takes.
+static uint32_t testFastRuns;
+static uint32_t testSlowRuns;
+static uint32_t testSlowTicks; // How long the slow task pretends to take.
+
+static void testFastTask() { testFastRuns++; }
+
+static void testSlowTask() {
+  testSlowRuns++;
+  for (uint32_t i = 0; i < testSlowTicks; i++)
+    scheduler_tick();
+}
+
+// Advances the clock by ms, calling scheduler_run() every few ticks as the
+// main loop would.
+static void testAdvance(uint32_t ms, uint32_t callIntervalTicks) {
+  uint32_t end = tickCount + ms * SCHEDULER_TICKS_PER_MS;
+  while (isAtOrAfter(end, tickCount + 1)) {
+    for (uint32_t i = 0; i < callIntervalTicks; i++)
+      scheduler_tick();
+    while (scheduler_run())
+      ;
+  }
+}
+
+// Checks periods, backlog priority and budgets.
+bool scheduler_runTest() {
+  printf("****************** scheduler_runTest() ******************\n");
+  bool success = true;
+  while (isr_adcBufferElementCount())
+    isr_removeDataFromAdcBuffer();
+  // Run rates follow the clock, not how often scheduler_run() is called.
+  const uint32_t callIntervals[] = {1, SCHEDULER_TEST_CALL_INTERVAL_TICKS};
+  for (uint16_t i = 0; i < sizeof(callIntervals) / sizeof(callIntervals[0]);
+       i++) {
+    uint32_t callInterval = callIntervals[i];
+    scheduler_init(SCHEDULER_TEST_BACKLOG_THRESHOLD);
+    testFastRuns = testSlowRuns = testSlowTicks = RESET;
+    scheduler_addTask("fast", testFastTask, SCHEDULER_TEST_FAST_PERIOD_MS,
+                      SCHEDULER_TEST_BUDGET_MS, false);
+    scheduler_addTask("slow", testSlowTask, SCHEDULER_TEST_SLOW_PERIOD_MS,
+                      SCHEDULER_TEST_BUDGET_MS, false);
+    testAdvance(SCHEDULER_TEST_DURATION_MS, callInterval);
+    if (testFastRuns !=
+            SCHEDULER_TEST_DURATION_MS / SCHEDULER_TEST_FAST_PERIOD_MS ||
+        testSlowRuns !=
+            SCHEDULER_TEST_DURATION_MS / SCHEDULER_TEST_SLOW_PERIOD_MS) {
+      printf("scheduler_runTest(): %lu fast and %lu slow runs in %d ms with a "
+             "call every %lu ticks.\n",
+             (unsigned long)testFastRuns, (unsigned long)testSlowRuns,
+             SCHEDULER_TEST_DURATION_MS, (unsigned long)callInterval);
+      success = false;
+    }
+  }
+  // Nothing runs while the backlog is high, and missed periods are dropped.
+  for (uint32_t i = 0; i <= SCHEDULER_TEST_BACKLOG_THRESHOLD; i++)
+    isr_addDataToAdcBuffer(RESET);
+  uint32_t fastRunsBefore = testFastRuns;
+  testAdvance(SCHEDULER_TEST_DURATION_MS, 1);
+  if (testFastRuns != fastRunsBefore || scheduler_getDeferralCount() == 0) {
+    printf("scheduler_runTest(): a task ran over the ADC backlog.\n");
+    success = false;
+  }
+  while (isr_adcBufferElementCount())
+    isr_removeDataFromAdcBuffer();
+  while (scheduler_run())
+    ;
+  scheduler_taskStatistics_t statistics;
+  scheduler_getTaskStatistics(0, &statistics);
+  if (testFastRuns != fastRunsBefore + 1 || statistics.skipCount == 0) {
+    printf("scheduler_runTest(): missed periods were not dropped.\n");
+    success = false;
+  }
+  // A task that overruns its budget is pushed back in proportion.
+  testSlowTicks = SCHEDULER_TEST_OVERRUN_MS * SCHEDULER_TICKS_PER_MS;
+  uint32_t slowRunsBefore = testSlowRuns;
+  testAdvance(SCHEDULER_TEST_DURATION_MS, 1);
+  scheduler_getTaskStatistics(1, &statistics);
+  uint32_t expectedRuns = SCHEDULER_TEST_DURATION_MS /
+                          (SCHEDULER_TEST_SLOW_PERIOD_MS *
+                           SCHEDULER_TEST_OVERRUN_MS / SCHEDULER_TEST_BUDGET_MS);
+  if (statistics.overrunCount == 0 ||
+      testSlowRuns - slowRunsBefore > expectedRuns + 1) {
+    printf("scheduler_runTest(): %lu runs of an overrunning task, expected "
+           "about %lu.\n",
+           (unsigned long)(testSlowRuns - slowRunsBefore),
+           (unsigned long)expectedRuns);
+    success = false;
+  }
+  scheduler_printReport();
+  // Sheddable tasks skip their runs during overload, the others still run.
+  scheduler_init(SCHEDULER_TEST_BACKLOG_THRESHOLD);
+  testFastRuns = testSlowRuns = testSlowTicks = RESET;
+  scheduler_addTask("fast", testFastTask, SCHEDULER_TEST_FAST_PERIOD_MS,
+                    SCHEDULER_TEST_BUDGET_MS, false);
+  scheduler_addTask("sheddable", testSlowTask, SCHEDULER_TEST_SLOW_PERIOD_MS,
+                    SCHEDULER_TEST_BUDGET_MS, true);
+  overload_init(SCHEDULER_TEST_BACKLOG_THRESHOLD, RESET);
+  overload_update(SCHEDULER_TEST_BACKLOG_THRESHOLD + 1);
+  testAdvance(SCHEDULER_TEST_DURATION_MS, 1);
+  overload_init(SCHEDULER_TEST_BACKLOG_THRESHOLD, RESET); // Leave overload.
+  scheduler_getTaskStatistics(1, &statistics);
+  if (testFastRuns !=
+          SCHEDULER_TEST_DURATION_MS / SCHEDULER_TEST_FAST_PERIOD_MS ||
+      testSlowRuns != 0 ||
+      statistics.shedCount !=
+          SCHEDULER_TEST_DURATION_MS / SCHEDULER_TEST_SLOW_PERIOD_MS) {
+    printf("scheduler_runTest(): %lu sheddable runs during overload.\n",
+           (unsigned long)testSlowRuns);
+    success = false;
+  }
+  printf("scheduler_runTest() %s.\n", success ? "passed" : "failed");
+  return success;
+}
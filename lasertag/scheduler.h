@@ -0,0 +1,86 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Cooperative scheduler for the main loop. Work that is not part of detection
+// (UI refresh, telemetry, housekeeping) is registered as a task with a period
+// and a budget in milliseconds of wall-clock time. The clock is
+// scheduler_tick(), called from isr_function() for every ADC sample, so how
+// often a task runs does not depend on how often detector() runs.
+//
+// scheduler_run() is called once per pass of the main loop, after detector().
+// It runs at most one due task per call, and none at all while the ADC backlog
+// is above the threshold given to scheduler_init(), so detector() always
+// catches up first. A task that runs longer than its budget is pushed back so
+// that it still only gets budget/period of the CPU. Sheddable tasks skip their
+// runs altogether while overload_isActive().
+
+#define SCHEDULER_MAX_TASK_COUNT 8
+#define SCHEDULER_TICKS_PER_MS ISR_TICKS_PER_MS
+#define SCHEDULER_INVALID_TASK_ID UINT8_MAX
+
+typedef void (*scheduler_taskFunction_t)();
+typedef uint8_t scheduler_taskId_t;
+
+// Statistics kept for each task.
+typedef struct {
+  const char *name;
+  uint32_t runCount;     // Number of times the task ran.
+  uint32_t overrunCount; // Runs that took longer than the budget.
+  uint32_t skipCount;    // Periods dropped because the task fell behind.
+  uint32_t shedCount;    // Runs skipped because of overload.
+  uint32_t maxTicks;     // Longest run, in ISR ticks.
+} scheduler_taskStatistics_t;
+
+// Removes all tasks and clears all statistics. Tasks are held back while
+// isr_adcBufferElementCount() is above backlogThreshold.
+void scheduler_init(uint32_t backlogThreshold);
+
+// Adds a task that runs every periodMs and is expected to finish within
+// budgetMs. The first run is one period from now. A sheddable task is skipped
+// during overload. Returns SCHEDULER_INVALID_TASK_ID if there is no room for
+// another task.
+scheduler_taskId_t scheduler_addTask(const char *name,
+                                     scheduler_taskFunction_t function,
+                                     uint32_t periodMs, uint32_t budgetMs,
+                                     bool sheddable);
+
+// Advances the scheduler clock by one ISR tick, 1/SCHEDULER_TICKS_PER_MS ms.
+// Called from isr_function().
+void scheduler_tick();
+
+// Returns the scheduler clock in ISR ticks.
+uint32_t scheduler_getTickCount();
+
+// Runs the most overdue task, if any task is due and the ADC backlog allows
+// it. Returns true if a task ran.
+bool scheduler_run();
+
+// Returns the number of scheduler_run() calls that held back a due task
+// because of the ADC backlog.
+uint32_t scheduler_getDeferralCount();
+
+// Copies the statistics of a task.
+void scheduler_getTaskStatistics(scheduler_taskId_t id,
+                                 scheduler_taskStatistics_t *statistics);
+
+// Prints the statistics of every task to the console.
+void scheduler_printReport();
+
+// Checks periods, backlog priority and budgets by driving scheduler_tick()
+// directly. Must be run with interrupts off. Returns true if it passes.
+bool scheduler_runTest();
+
+#endif /* SCHEDULER_H_ */
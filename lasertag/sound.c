@@ -9,14 +9,17 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include "sound.h"
 #include "interrupts.h" // Just for sound_runTest().
-#include "sounds/bcfire01_48k.wav.h"
-#include "sounds/gameBoyStartup.wav.h"
-#include "sounds/gameOver48k.wav.h"
-#include "sounds/gunEmpty48k.wav.h"
-#include "sounds/ouch48k.wav.h"
-#include "sounds/pacmanDeath.wav.h"
-#include "sounds/powerUp48k.wav.h"
-#include "sounds/screamAndDie48k.wav.h"
+#include "overload.h"
+#include "stageProfiler.h"
+#include "adpcm.h"
+#include "sounds/bcfire01_48k.adpcm.h"
+#include "sounds/gameBoyStartup.adpcm.h"
+#include "sounds/gameOver48k.adpcm.h"
+#include "sounds/gunEmpty48k.adpcm.h"
+#include "sounds/ouch48k.adpcm.h"
+#include "sounds/pacmanDeath.adpcm.h"
+#include "sounds/powerUp48k.adpcm.h"
+#include "sounds/screamAndDie48k.adpcm.h"
 #include "timer_ps.h"
 #include "xiicps.h"
 #include "xil_printf.h"
@@ -39,9 +42,19 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #define SOUND_MULTIPLIER INT16_MAX / 3 // Primitive volume control.
 
-#define ONE_SECOND_OF_SOUND_ARRAY_SIZE                                         \
+#define ONE_SECOND_OF_SOUND_SAMPLE_COUNT                                       \
   48000 // The sample rate is 48k so that is 1 second's worth.
-uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
+
+// Number of sounds that can play at the same time.
+#define SOUND_VOICE_COUNT 4
+// Voices are mixed this many samples at a time into a small staging buffer
+// that sound_pump() drains into the FIFO.
+#define SOUND_MIX_BATCH_SIZE 16
+// The decoder produces signed samples; the FIFO expects the offset-binary
+// values the old uncompressed arrays contained.
+#define SOUND_OFFSET_BINARY_ZERO 32768
+#define SOUND_GAIN_SHIFT 15 // Voice gains are Q15.
+#define SOUND_NO_SOUND_SELECTED 0
 
 // Declared below the sound state-machine code.
 int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
@@ -53,19 +66,49 @@ int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
 static bool sound_initFlag = false;
 
 // True if a sound should be played, false otherwise.
-// Note that the state-machine sets this back to false once it has completed
-// playing a sound.
+// Note that the state-machine sets this back to false once every voice has
+// completed playing its sound.
 static volatile bool sound_playSoundFlag = false;
 
-// Keep track of the base pointer to the sound array with current sample-rate
-// and sample count.
-static uint16_t *sound_array; // Base pointer to the sound array.
+// Keep track of the ADPCM data for the sound selected by sound_setSound() with
+// its sample count. Silence has no data, it only takes up time.
+static const uint8_t *sound_data; // Base pointer to the encoded sound.
 
 // static uint32_t sound_sampleRate;  // Sample rate for this sound.
 static uint32_t sound_sampleCount; // Number of samples in this sound.
 
+// One stream in the mixer.
+typedef struct {
+  volatile bool active;    // True while the voice is playing.
+  adpcm_decoder_t decoder; // Streaming decoder for the voice's sound.
+  sound_gain_t gain;       // Applied to each sample before it is mixed.
+} sound_voice_t;
+
+static sound_voice_t sound_voices[SOUND_VOICE_COUNT];
+
+// Mixed samples, already scaled by the volume, waiting to go into the FIFO.
+// Only sound_pump() touches these.
+static uint32_t sound_stagingBuffer[SOUND_MIX_BATCH_SIZE];
+static uint32_t sound_stagingCount; // Valid samples in the staging buffer.
+static uint32_t sound_stagingIndex; // Next sample to send.
+
+// The FIFO is refilled outside the ISR: sound_tick() sets this flag and
+// sound_pump(), called from the main loop, does the work.
+static volatile bool sound_pumpRequestFlag = false;
+// Set by sound_pump() once it has sent everything the voices had to mix.
+static volatile bool sound_pumpDrainedFlag = false;
+
 // Keep track of the current volume setting.
 static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
+// Every volume is 2^n - 1, so scaling by it is (sample << n) - sample.
+static uint16_t sound_currentVolumeShift;
+#define SOUND_IS_SHIFT_VOLUME(volume) (((volume) & ((volume) + 1)) == 0)
+#if !SOUND_IS_SHIFT_VOLUME(SOUND_VOLUME_0) ||                                  \
+    !SOUND_IS_SHIFT_VOLUME(SOUND_VOLUME_1) ||                                  \
+    !SOUND_IS_SHIFT_VOLUME(SOUND_VOLUME_2) ||                                  \
+    !SOUND_IS_SHIFT_VOLUME(SOUND_VOLUME_3)
+#error "Every SOUND_VOLUME_n must be 2^n - 1 to be applied as a shift."
+#endif
 
 // Sound state-machine states.
 typedef enum {
@@ -99,16 +142,16 @@ void sound_sendDataToBothChannels(uint32_t sampleValue) {
 }
 
 // Used to set the volume. Use one of the provided values.
-void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
+void sound_setVolume(sound_volume_t volume) {
+  sound_currentVolume = volume;
+  sound_currentVolumeShift = __builtin_ctz((uint32_t)volume + 1);
+}
 
 // Must be called before using the sound state machine.
 sound_status_t sound_init() {
   // Setup the audio CODEC.
   AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
   sound_initFlag = true;
-  // Initialize the silence array.
-  for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
-    soundOfSilence[i] = NO_SOUND;
   sound_setVolume(sound_minimumVolume_e); // Init the volume level.
   return SOUND_STATUS_OK;
 }
@@ -145,9 +188,64 @@ static sound_st_t currentState = sound_init_st;
   }
 } */
 
+// Returns true if any voice is still playing.
+static bool sound_anyVoiceActive() {
+  for (uint16_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    if (sound_voices[v].active)
+      return true;
+  return false;
+}
+
+// Mixes the next batch of samples from every active voice into the staging
+// buffer, saturating the sum. Voices that run out are released. Returns the
+// number of samples, 0 once every voice has finished.
+static uint32_t sound_mixNextBatch() {
+  int32_t mix[SOUND_MIX_BATCH_SIZE] = {0};
+  int16_t decoded[SOUND_MIX_BATCH_SIZE];
+  uint32_t count = 0; // Longest contribution from any voice.
+  for (uint16_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    sound_voice_t *voice = &sound_voices[v];
+    if (!voice->active)
+      continue;
+    uint32_t voiceCount;
+    if (voice->decoder.data == NULL) { // Silence only advances the position.
+      voiceCount = adpcm_remainingSamples(&voice->decoder);
+      if (voiceCount > SOUND_MIX_BATCH_SIZE)
+        voiceCount = SOUND_MIX_BATCH_SIZE;
+      voice->decoder.sampleIndex += voiceCount;
+    } else {
+      voiceCount =
+          adpcm_decodeBlock(&voice->decoder, decoded, SOUND_MIX_BATCH_SIZE);
+      int32_t gain = voice->gain;
+      for (uint32_t i = 0; i < voiceCount; i++)
+        mix[i] += (decoded[i] * gain) >> SOUND_GAIN_SHIFT;
+    }
+    if (voiceCount > count)
+      count = voiceCount;
+    if (adpcm_remainingSamples(&voice->decoder) == 0)
+      voice->active = false;
+  }
+  for (uint32_t i = 0; i < count; i++) {
+    int32_t sample = mix[i];
+    if (sample > INT16_MAX)
+      sample = INT16_MAX;
+    else if (sample < INT16_MIN)
+      sample = INT16_MIN;
+    sound_stagingBuffer[i] = sample + SOUND_OFFSET_BINARY_ZERO;
+  }
+  // Scale the whole batch by the volume in one pass. No multiplies, and a
+  // loop the compiler can vectorize.
+  uint16_t shift = sound_currentVolumeShift;
+  for (uint32_t i = 0; i < count; i++)
+    sound_stagingBuffer[i] = (sound_stagingBuffer[i] << shift) -
+                             sound_stagingBuffer[i]; // Scale by volume.
+  sound_stagingCount = count;
+  sound_stagingIndex = 0;
+  return count;
+}
+
 void sound_tick() {
   //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -169,104 +267,158 @@ void sound_tick() {
     break;
   case sound_wait_st:
     if (sound_playSoundFlag) {
-      arrayIndex = 0;
       currentState = sound_play_st;
       sound_resetTxFifo();  // Reset the TX FIFO.
       sound_enableTxFifo(); // Enable the TX FIFO, disable mute.
     }
     break;
   case sound_play_st:
-    // Each time you enter this state, add as many samples as will fit in the
-    // FIFO.
-    if (sound_array == NULL) {
-      printf("ERROR, sound_tick: sound array has not been set.\n");
-      return;
-    }
-    // This while-loop continues to load sound-data into the FIFOs until it is
-    // full or the sound data are exhausted.
-    while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
-             0b0010)) { // while room in FIFO.
-      uint32_t sampleValue =
-          sound_array[arrayIndex] * sound_currentVolume; // Scale by volume.
-      sound_sendDataToBothChannels(
-          sampleValue); // Send the sound data to the left and right channels.
-      arrayIndex++;     // Go to next sample.
-      if (arrayIndex == sound_sampleCount) { // All done?
-        sound_playSoundFlag = false;         // Yes.
-        sound_disableTxFifo();               // Disable the TX FIFO.
-        currentState = sound_wait_st;        // Go back to the wait state.
-      }
+    // Refilling the FIFO takes too long for the ISR, so just ask sound_pump()
+    // to do it. Once it has sent everything and no voice is left, stop.
+    if (sound_pumpDrainedFlag && !sound_anyVoiceActive()) {
+      sound_playSoundFlag = false;  // All done.
+      sound_disableTxFifo();        // Disable the TX FIFO.
+      currentState = sound_wait_st; // Go back to the wait state.
+    } else {
+      sound_pumpRequestFlag = true;
     }
     break;
   }
 }
 
+// Refills the I2S FIFO when sound_tick() has asked for it. Call this from the
+// main loop, often enough that the FIFO does not run dry. Staged samples are
+// already scaled, so each one is just copied out; a new batch is mixed
+// whenever the staging buffer empties.
+void sound_pump() {
+  if (!sound_pumpRequestFlag)
+    return;
+  sound_pumpRequestFlag = false;
+  STAGE_PROFILER_BEGIN(stageProfiler_soundPump_e);
+  // This while-loop continues to load sound-data into the FIFO until it is
+  // full or every voice is exhausted.
+  // During overload only one batch is sent per call, the rest is left for
+  // later passes of the main loop.
+  uint32_t sendLimit = overload_isActive() ? SOUND_MIX_BATCH_SIZE : UINT32_MAX;
+  while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
+           0b0010)) { // while room in FIFO.
+    if (sendLimit-- == 0) {
+      sound_pumpRequestFlag = true; // Come back for the rest.
+      break;
+    }
+    if (sound_stagingIndex == sound_stagingCount && !sound_mixNextBatch()) {
+      sound_pumpDrainedFlag = true; // sound_tick() will stop the FIFO.
+      break;
+    }
+    sound_pumpDrainedFlag = false;
+    sound_sendDataToBothChannels(
+        sound_stagingBuffer[sound_stagingIndex++]); // Send to both channels.
+  }
+  STAGE_PROFILER_END(stageProfiler_soundPump_e);
+}
+
 // Returns true if the sound state machine is not back in its initial state.
 bool sound_isBusy() {
   return (sound_playSoundFlag); // Busy if NOT in the wait state.
 }
 
-// Stops the sound and resets the state-machine to the wait state.
+// Stops every voice and resets the state-machine to the wait state.
 void sound_stopSound() {
+  for (uint16_t v = 0; v < SOUND_VOICE_COUNT; v++)
+    sound_voices[v].active = false;
+  sound_stagingCount = 0; // Drop whatever was mixed but not yet sent.
+  sound_stagingIndex = 0;
   sound_playSoundFlag = false; // disable the state-machine.
   currentState =
       sound_wait_st; // Force the state-machine back to the wait state.
 }
 
 // Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Sounds that are already playing keep playing; the next sound_startSound()
+// mixes this one in with them.
 void sound_setSound(sound_sounds_t sound) {
-  if (sound_isBusy()) { // You are currently playing some sound.
-    sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
-  }
-  sound_array =
-      NULL; // Set the pointer to NULL so you can detect it never being set.
+  sound_data = NULL;
+  sound_sampleCount =
+      SOUND_NO_SOUND_SELECTED; // So you can detect it never being set.
   switch (sound) {
   case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
+    sound_data = gameBoyStartup_adpcm; // Set the array holding the data.
     sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+        GAMEBOYSTARTUP_ADPCM_NUMBER_OF_SAMPLES; // Size of the array.
     break;
   case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
+    sound_data = bcfire01_48k_adpcm; // Set the array holding the data.
     sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
+        BCFIRE01_48K_ADPCM_NUMBER_OF_SAMPLES; // Size of the array.
     break;
   case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
+    sound_data = ouch48k_adpcm; // You get the idea...
+    sound_sampleCount = OUCH48K_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
+    sound_data = gunEmpty48k_adpcm;
+    sound_sampleCount = GUNEMPTY48K_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
+    sound_data = powerUp48k_adpcm;
+    sound_sampleCount = POWERUP48K_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
+    sound_data = screamAndDie48k_adpcm;
+    sound_sampleCount = SCREAMANDDIE48K_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
+    sound_data = pacmanDeath_adpcm;
+    sound_sampleCount = PACMANDEATH_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
+    sound_data = gameOver48k_adpcm;
+    sound_sampleCount = GAMEOVER48K_ADPCM_NUMBER_OF_SAMPLES;
     break;
   case sound_oneSecondSilence_e:
-    sound_array = soundOfSilence;
-    sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
+    sound_sampleCount = ONE_SECOND_OF_SOUND_SAMPLE_COUNT; // No data needed.
     break;
   default:
     printf("sound_setSound(): bogus sound value(%d)\n", sound);
   }
 }
 
+// Returns a voice for a new sound: a free one if there is one, otherwise the
+// one closest to finishing.
+static sound_voice_t *sound_claimVoice() {
+  sound_voice_t *claimed = &sound_voices[0];
+  for (uint16_t v = 0; v < SOUND_VOICE_COUNT; v++) {
+    sound_voice_t *voice = &sound_voices[v];
+    if (!voice->active)
+      return voice;
+    if (adpcm_remainingSamples(&voice->decoder) <
+        adpcm_remainingSamples(&claimed->decoder))
+      claimed = voice;
+  }
+  return claimed;
+}
+
+// Starts the selected sound on a voice at the given gain.
+void sound_startSoundWithGain(sound_gain_t gain) {
+  if (sound_sampleCount == SOUND_NO_SOUND_SELECTED) {
+    printf("ERROR, sound_startSound: sound array has not been set.\n");
+    return;
+  }
+  // Only sound_pump() mixes voices, and it runs in the main loop like this, so
+  // a voice can be set up in place, even one that is being taken over. The
+  // ISR only checks whether any voice is active and whether sound_pump() has
+  // drained them. Clear that first: a voice never drops to inactive here, and
+  // sound_tick() cannot stop the FIFO on a stale drained flag meanwhile.
+  sound_pumpDrainedFlag = false;
+  sound_voice_t *voice = sound_claimVoice();
+  adpcm_initDecoder(&voice->decoder, sound_data, sound_sampleCount);
+  voice->gain = gain;
+  voice->active = true;
+  sound_playSoundFlag = true;
+}
+
 // Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+void sound_startSound() { sound_startSoundWithGain(SOUND_GAIN_UNITY); }
 
 // Returns true if the sound has been played. State machine will have returned
 // to its initial state.
@@ -278,19 +430,110 @@ void sound_playSound(sound_sounds_t sound) {
   sound_startSound();    // Start playing the sound.
 }
 
-// Plays several sounds.
+// Same as sound_playSound() but at the given gain.
+void sound_playSoundWithGain(sound_sounds_t sound, sound_gain_t gain) {
+  sound_setSound(sound);
+  sound_startSoundWithGain(gain);
+}
+
+#define SOUND_TEST_BATCH_COUNT 8 // Mix batches checked by sound_testMixer().
+#define SOUND_TEST_SECOND_VOICE_BATCH 2 // When the second sound joins in.
+#define SOUND_TEST_GAIN (SOUND_GAIN_UNITY / 2)
+
+// Decodes the next batch of a sound on its own and adds it to mix at gain,
+// the way sound_mixNextBatch() adds a voice.
+static void sound_testAddVoice(adpcm_decoder_t *decoder, int32_t mix[]) {
+  int16_t decoded[SOUND_MIX_BATCH_SIZE];
+  uint32_t count = adpcm_decodeBlock(decoder, decoded, SOUND_MIX_BATCH_SIZE);
+  for (uint32_t i = 0; i < count; i++)
+    mix[i] += (decoded[i] * SOUND_TEST_GAIN) >> SOUND_GAIN_SHIFT;
+}
+
+// Plays gunFire_e and, a few batches later, hit_e on top of it, and checks
+// each mixed sample against the two sounds decoded separately: the saturated
+// sum, in offset binary, times the volume. Returns true if they all match.
+static bool sound_testMixer() {
+  bool success = true;
+  adpcm_decoder_t gunFire, hit;
+  adpcm_initDecoder(&gunFire, bcfire01_48k_adpcm,
+                    BCFIRE01_48K_ADPCM_NUMBER_OF_SAMPLES);
+  adpcm_initDecoder(&hit, ouch48k_adpcm, OUCH48K_ADPCM_NUMBER_OF_SAMPLES);
+  sound_stopSound();
+  sound_setVolume(sound_mediumLowVolume_e);
+  sound_playSoundWithGain(sound_gunFire_e, SOUND_TEST_GAIN);
+  for (uint16_t batch = 0; batch < SOUND_TEST_BATCH_COUNT; batch++) {
+    int32_t mix[SOUND_MIX_BATCH_SIZE] = {0};
+    sound_testAddVoice(&gunFire, mix);
+    if (batch == SOUND_TEST_SECOND_VOICE_BATCH)
+      sound_playSoundWithGain(sound_hit_e, SOUND_TEST_GAIN);
+    if (batch >= SOUND_TEST_SECOND_VOICE_BATCH)
+      sound_testAddVoice(&hit, mix);
+    if (sound_mixNextBatch() != SOUND_MIX_BATCH_SIZE) {
+      printf("sound_runTest(): batch %u is short.\n", batch);
+      success = false;
+      break;
+    }
+    for (uint32_t i = 0; i < SOUND_MIX_BATCH_SIZE; i++) {
+      int32_t sample = mix[i];
+      if (sample > INT16_MAX)
+        sample = INT16_MAX;
+      else if (sample < INT16_MIN)
+        sample = INT16_MIN;
+      uint32_t expected =
+          (uint32_t)(sample + SOUND_OFFSET_BINARY_ZERO) * sound_currentVolume;
+      if (sound_stagingBuffer[i] != expected) {
+        printf("sound_runTest(): sample %lu of batch %u is %lu, not %lu.\n",
+               (unsigned long)i, batch, (unsigned long)sound_stagingBuffer[i],
+               (unsigned long)expected);
+        success = false;
+        break;
+      }
+    }
+  }
+  sound_stopSound();
+  return success;
+}
+
+#define SOUND_TEST_VOLUME_COUNT 4
+#define SOUND_TEST_MAX_STAGED_SAMPLE UINT16_MAX
+
+// Checks that the shift gives the same result as multiplying by each volume,
+// up to the largest offset-binary sample. Returns true if it does.
+static bool sound_testVolumeShift() {
+  const sound_volume_t volumes[SOUND_TEST_VOLUME_COUNT] = {
+      sound_minimumVolume_e, sound_mediumLowVolume_e, sound_mediumHighVolume_e,
+      sound_maximumVolume_e};
+  bool success = true;
+  for (uint16_t v = 0; v < SOUND_TEST_VOLUME_COUNT; v++) {
+    sound_setVolume(volumes[v]);
+    uint32_t sample = SOUND_TEST_MAX_STAGED_SAMPLE;
+    if ((sample << sound_currentVolumeShift) - sample !=
+        sample * (uint32_t)volumes[v]) {
+      printf("sound_runTest(): volume %u is not applied by a shift of %u.\n",
+             volumes[v], sound_currentVolumeShift);
+      success = false;
+    }
+  }
+  return success;
+}
+
+// Checks the mixer, then plays several sounds.
 // To invoke, just place this in your main.
 // Completely stand alone, doesn't require interrupts, etc.
-void sound_runTest() {
+bool sound_runTest() {
   printf("****************** sound_runTest() ******************\n");
 
   sound_init();
+  bool success = sound_testVolumeShift();
+  success &= sound_testMixer();
+  sound_setVolume(sound_minimumVolume_e);
   sound_tick();
   sound_setSound(sound_gunClick_e);
   printf("playing gunClick_e\n");
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_pump();
     if (!sound_isBusy())
       break;
   }
@@ -299,6 +542,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_pump();
     if (!sound_isBusy())
       break;
   }
@@ -307,6 +551,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_pump();
     if (!sound_isBusy())
       break;
   }
@@ -315,6 +560,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_pump();
     if (!sound_isBusy())
       break;
   }
@@ -323,10 +569,21 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_pump();
     if (!sound_isBusy())
       break;
   }
-  printf("done.\n");
+  printf("playing gunFire_e and hit_e together\n");
+  sound_playSoundWithGain(sound_gunFire_e, SOUND_GAIN_UNITY / 2);
+  sound_playSoundWithGain(sound_hit_e, SOUND_GAIN_UNITY / 2);
+  while (1) {
+    sound_tick();
+    sound_pump();
+    if (!sound_isBusy())
+      break;
+  }
+  printf("sound_runTest() %s.\n", success ? "passed" : "failed");
+  return success;
 }
 
 /**********************************************************************************
@@ -391,7 +648,7 @@ int AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData) {
   // while (XIicPs_BusIsBusy(IIcPtr)) {
   //   /* NOP */
   // }
-  // return XST_SUCCESS;
+  return XST_SUCCESS;
 }
 
 /***  AudioInitialize(u16 timerID,  u16 iicID, u32 i2sAddr)
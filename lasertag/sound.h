@@ -29,7 +29,7 @@ typedef uint32_t sound_status_t;
 #define IIC_SLAVE_ADDR 0b0011010
 #define IIC_SCLK_RATE 100000
 
-// Sound levels.
+// Sound levels. Each is 2^n - 1 so that sound.c can scale with a shift.
 #define SOUND_VOLUME_3 (INT16_MAX) // Max volume
 #define SOUND_VOLUME_2 (INT16_MAX / 8)
 #define SOUND_VOLUME_1 (INT16_MAX / 32)
@@ -37,6 +37,10 @@ typedef uint32_t sound_status_t;
 
 #define NO_SOUND 0 // A zero generates no sound.
 
+// Per-sound gain in Q15 fixed point, used when several sounds are mixed.
+typedef uint16_t sound_gain_t;
+#define SOUND_GAIN_UNITY (1 << 15) // Play the sound as recorded.
+
 // sound-specific defines.
 typedef enum {
   sound_gameStart_e,       // Play a sound when the game starts.
@@ -62,9 +66,14 @@ typedef enum {
 // Must be called before using the sound state machine.
 sound_status_t sound_init();
 
-// Standard tick function.
+// Standard tick function. Called from the ISR; it only asks sound_pump() to
+// refill the FIFO.
 void sound_tick();
 
+// Refills the I2S FIFO if sound_tick() asked for it. Call from the main loop.
+// Sends a single mix batch per call while overload_isActive().
+void sound_pump();
+
 // Returns true if the sound state machine is not back in its initial state.
 bool sound_isBusy();
 
@@ -77,10 +86,14 @@ sound_status_t sound_setSampleRate(uint32_t sampleRate);
 // Used to set the volume. Use one of the provided values.
 void sound_setVolume(sound_volume_t);
 
-// Tell the state machine to start playing the sound.
+// Tell the state machine to start playing the sound. Up to 4 sounds play at
+// once, mixed together; sounds already playing are not interrupted.
 void sound_startSound();
 
-// Tell the state machine to stop playing the sound.
+// Same as sound_startSound() but at the given gain.
+void sound_startSoundWithGain(sound_gain_t gain);
+
+// Tell the state machine to stop playing all sounds.
 void sound_stopSound();
 
 // Returns true if the sound has been played. State machine will have returned
@@ -90,10 +103,15 @@ bool sound_isSoundComplete();
 // Sets the sound and starts playing it immediately.
 void sound_playSound(sound_sounds_t sound);
 
+// Same as sound_playSound() but at the given gain, e.g. to keep feedback
+// sounds layered over other sounds from saturating.
+void sound_playSoundWithGain(sound_sounds_t sound, sound_gain_t gain);
+
 // Plays 1 second of silence.
 void sound_playOneSecondSilence();
 
-// Used to test sounds.
-void sound_runTest();
+// Checks the mixer against the sounds decoded on their own, then plays
+// several sounds. Returns true if the mixer check passes.
+bool sound_runTest();
 
 #endif /* SOUND_H_ */
\ No newline at end of file
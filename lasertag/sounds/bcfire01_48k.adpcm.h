@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm bcfire01_48k.wav.c
+#include <stdint.h>
+extern const uint8_t bcfire01_48k_adpcm[];
+#define BCFIRE01_48K_ADPCM_SAMPLE_RATE 48000
+#define BCFIRE01_48K_ADPCM_NUMBER_OF_SAMPLES 53638
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm gameBoyStartup.wav.c
+#include <stdint.h>
+extern const uint8_t gameBoyStartup_adpcm[];
+#define GAMEBOYSTARTUP_ADPCM_SAMPLE_RATE 48000
+#define GAMEBOYSTARTUP_ADPCM_NUMBER_OF_SAMPLES 105488
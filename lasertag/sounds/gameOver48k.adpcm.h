@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm gameOver48k.wav.c
+#include <stdint.h>
+extern const uint8_t gameOver48k_adpcm[];
+#define GAMEOVER48K_ADPCM_SAMPLE_RATE 48000
+#define GAMEOVER48K_ADPCM_NUMBER_OF_SAMPLES 156595
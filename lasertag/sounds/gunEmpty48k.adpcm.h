@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm gunEmpty48k.wav.c
+#include <stdint.h>
+extern const uint8_t gunEmpty48k_adpcm[];
+#define GUNEMPTY48K_ADPCM_SAMPLE_RATE 48000
+#define GUNEMPTY48K_ADPCM_NUMBER_OF_SAMPLES 15456
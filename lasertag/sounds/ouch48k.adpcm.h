@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm ouch48k.wav.c
+#include <stdint.h>
+extern const uint8_t ouch48k_adpcm[];
+#define OUCH48K_ADPCM_SAMPLE_RATE 48000
+#define OUCH48K_ADPCM_NUMBER_OF_SAMPLES 23467
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm pacmanDeath.wav.c
+#include <stdint.h>
+extern const uint8_t pacmanDeath_adpcm[];
+#define PACMANDEATH_ADPCM_SAMPLE_RATE 48000
+#define PACMANDEATH_ADPCM_NUMBER_OF_SAMPLES 82712
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm pacman_beginning_48k.wav.c
+#include <stdint.h>
+extern const uint8_t pacman_beginning_48k_adpcm[];
+#define PACMAN_BEGINNING_48K_ADPCM_SAMPLE_RATE 48000
+#define PACMAN_BEGINNING_48K_ADPCM_NUMBER_OF_SAMPLES 202405
@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm powerUp48k.wav.c
+#include <stdint.h>
+extern const uint8_t powerUp48k_adpcm[];
+#define POWERUP48K_ADPCM_SAMPLE_RATE 48000
+#define POWERUP48K_ADPCM_NUMBER_OF_SAMPLES 60480
@@ -0,0 +1,2699 @@
+// This file was generated by executing this statement: wav2adpcm screamAndDie48k.wav.c
+
+#include <stdint.h>
+
+const uint8_t screamAndDie48k_adpcm[43079] = {
+0xff, 0xff, 0x90, 0x00, 0x08, 0x88, 0x00, 0x88, 0x18, 0x80, 0x8b, 0x77, 0x13, 0xa8, 0x40, 0x25,
+0xa0, 0x28, 0x35, 0x91, 0x88, 0x01, 0x99, 0x22, 0xfb, 0x9f, 0x01, 0x88, 0x18, 0x88, 0x29, 0x91,
+0xdf, 0x88, 0x81, 0x08, 0x90, 0x10, 0xd8, 0xae, 0x20, 0xb0, 0x9e, 0x80, 0xda, 0x09, 0x81, 0x88,
+0x01, 0xa9, 0x62, 0x15, 0x98, 0x00, 0x80, 0x08, 0x91, 0x0a, 0x67, 0x01, 0x89, 0x01, 0x89, 0x10,
+0xa8, 0x68, 0x25, 0x91, 0x08, 0x73, 0x24, 0x80, 0x00, 0x89, 0x21, 0xea, 0x8b, 0x35, 0xa0, 0x18,
+0x91, 0x1a, 0x82, 0x8b, 0x25, 0xde, 0x1a, 0xc8, 0x0b, 0x34, 0xa0, 0x18, 0xfa, 0x9d, 0x00, 0xaa,
+0x0a, 0x00, 0x88, 0x80, 0x00, 0x98, 0x20, 0xf2, 0xbd, 0x09, 0x00, 0x08, 0x89, 0x74, 0x13, 0x99,
+0x10, 0x88, 0x08, 0x00, 0x88, 0x18, 0x80, 0x8b, 0x77, 0x17, 0x8a, 0x41, 0x02, 0x80, 0x90, 0x38,
+0x26, 0x00, 0x53, 0x82, 0x89, 0x11, 0xa9, 0x11, 0xa0, 0x39, 0xa1, 0x3b, 0xb6, 0xff, 0x1a, 0x81,
+0x0a, 0x44, 0x81, 0x41, 0x82, 0xbe, 0xaa, 0xab, 0x08, 0xfa, 0x9c, 0x81, 0xba, 0x1a, 0x80, 0x08,
+0x00, 0x89, 0x01, 0x3a, 0x77, 0xa2, 0x3a, 0x15, 0xb9, 0x89, 0xd9, 0x8a, 0xb0, 0xad, 0x11, 0xa0,
+0x49, 0x25, 0x91, 0x09, 0x44, 0x34, 0x01, 0x89, 0x41, 0x15, 0xa9, 0x41, 0x13, 0x28, 0x44, 0x80,
+0x88, 0x00, 0x80, 0x89, 0x73, 0x06, 0x88, 0x80, 0x28, 0x45, 0xa0, 0x29, 0x92, 0xdf, 0xaa, 0xa9,
+0x89, 0x98, 0xcc, 0x8a, 0x00, 0x88, 0x28, 0xb1, 0xaf, 0x41, 0x82, 0x89, 0x00, 0x50, 0x33, 0x99,
+0x08, 0xfe, 0x8a, 0x91, 0xab, 0x08, 0xda, 0x39, 0x26, 0x81, 0x08, 0x00, 0x54, 0x02, 0x08, 0x24,
+0x80, 0x09, 0x34, 0x02, 0x8a, 0x61, 0x34, 0x12, 0x88, 0x08, 0x00, 0x89, 0x20, 0xa8, 0x39, 0xb3,
+0x0f, 0x56, 0x02, 0x00, 0xe9, 0xaf, 0x8a, 0x80, 0xc9, 0x9a, 0x88, 0xc9, 0x89, 0xb0, 0xcd, 0x89,
+0x00, 0x88, 0x10, 0x54, 0x14, 0x90, 0x00, 0x80, 0xca, 0xae, 0x0a, 0xa0, 0xbd, 0x0a, 0x63, 0x02,
+0x08, 0x43, 0x91, 0x50, 0x24, 0x88, 0x72, 0x12, 0x89, 0x28, 0x52, 0x24, 0x90, 0x9b, 0x08, 0x91,
+0xbb, 0x8b, 0x00, 0x62, 0x33, 0x09, 0x57, 0x82, 0xba, 0xab, 0xcb, 0xbb, 0xbc, 0x1a, 0xc0, 0xbe,
+0x08, 0x98, 0x20, 0xc8, 0x9c, 0x80, 0xbd, 0x51, 0x23, 0x41, 0x12, 0xac, 0x0a, 0xa8, 0xbc, 0xcc,
+0x9a, 0x90, 0x10, 0x34, 0x00, 0x53, 0x02, 0x40, 0x14, 0x08, 0x46, 0x02, 0x88, 0x00, 0x75, 0x34,
+0x80, 0x99, 0x09, 0x00, 0xc9, 0xad, 0x08, 0x22, 0x22, 0x98, 0x18, 0x25, 0xd8, 0xcc, 0xaa, 0x08,
+0xa8, 0x9b, 0x11, 0xc8, 0xac, 0x01, 0xec, 0x8a, 0x90, 0xba, 0x30, 0x26, 0x32, 0x12, 0xb9, 0xcd,
+0x8a, 0x90, 0xbc, 0x18, 0x80, 0x62, 0x15, 0x21, 0x34, 0x81, 0x38, 0x34, 0x43, 0x13, 0x18, 0x67,
+0x13, 0xa8, 0x09, 0x62, 0x02, 0xda, 0xbb, 0x08, 0x80, 0x88, 0x10, 0x32, 0x92, 0xfb, 0xbc, 0x9c,
+0x8a, 0xba, 0xac, 0x89, 0x09, 0x11, 0xc9, 0x9b, 0xa9, 0xbc, 0x9b, 0x20, 0x45, 0x22, 0x80, 0xbb,
+0x75, 0x06, 0x99, 0x88, 0xa9, 0x0a, 0x02, 0x8b, 0x66, 0x23, 0x80, 0x20, 0x43, 0x36, 0x35, 0x12,
+0x21, 0x12, 0x9a, 0x0a, 0xb8, 0xad, 0xbc, 0xbd, 0x89, 0xda, 0xac, 0x89, 0x88, 0x10, 0xa0, 0xab,
+0x40, 0x13, 0xda, 0xad, 0x09, 0xc9, 0xae, 0xaa, 0xdb, 0x29, 0x22, 0x88, 0x32, 0x82, 0x48, 0x35,
+0x22, 0x63, 0x01, 0x80, 0x80, 0x08, 0x54, 0x13, 0x81, 0x41, 0x34, 0x13, 0x45, 0x35, 0x32, 0x82,
+0xca, 0x38, 0x03, 0xab, 0x80, 0xee, 0x89, 0xb0, 0xbe, 0x99, 0xa9, 0x9a, 0xba, 0x9b, 0x80, 0x08,
+0x81, 0xec, 0xba, 0xbc, 0x09, 0xc8, 0x8c, 0x00, 0x08, 0x35, 0xa1, 0x19, 0xa3, 0x0b, 0x47, 0x80,
+0x32, 0x43, 0x74, 0x12, 0x18, 0x44, 0x33, 0x42, 0x12, 0x42, 0x25, 0x81, 0x88, 0xfb, 0x9b, 0x31,
+0x02, 0xb9, 0xaa, 0x10, 0xf8, 0xbe, 0x9a, 0x88, 0x9a, 0xba, 0xbc, 0x09, 0xa0, 0xab, 0xda, 0xbe,
+0x18, 0x80, 0x08, 0x91, 0x28, 0x67, 0x81, 0x00, 0x98, 0x8a, 0x90, 0xab, 0x65, 0x02, 0x20, 0x34,
+0x53, 0x45, 0x22, 0x42, 0x33, 0x01, 0x90, 0xca, 0x89, 0xa9, 0xaa, 0xa9, 0xcb, 0x09, 0x00, 0xd8,
+0xcf, 0xab, 0x89, 0xa9, 0x9a, 0xba, 0xbb, 0x81, 0xfd, 0xae, 0xa9, 0xa9, 0x08, 0x98, 0x89, 0x54,
+0x24, 0x80, 0x09, 0x12, 0x81, 0x08, 0x88, 0x21, 0x35, 0x62, 0x46, 0x24, 0x22, 0x34, 0x24, 0x13,
+0x98, 0x99, 0x99, 0xa9, 0x9a, 0xab, 0x40, 0x03, 0xfa, 0xec, 0xbb, 0x8a, 0x90, 0xbc, 0xac, 0x89,
+0x10, 0xc8, 0xcd, 0xaa, 0x98, 0x99, 0xca, 0x9b, 0x54, 0x02, 0x10, 0x12, 0x31, 0x25, 0xc9, 0x0b,
+0x34, 0x11, 0x21, 0x63, 0x46, 0x33, 0x32, 0x25, 0x13, 0x81, 0xbb, 0x8a, 0x08, 0x08, 0xba, 0x9c,
+0x41, 0xb0, 0xcf, 0xbb, 0xac, 0xa9, 0xeb, 0xbb, 0x19, 0x01, 0xb8, 0xcd, 0xac, 0x88, 0xb0, 0xcc,
+0x8a, 0x21, 0x33, 0x23, 0x32, 0x35, 0x12, 0x88, 0x08, 0x64, 0x34, 0x21, 0x66, 0x33, 0x23, 0x24,
+0x02, 0x90, 0xb9, 0xab, 0xa8, 0xcd, 0x19, 0x33, 0x12, 0xa1, 0xcf, 0x8a, 0xa9, 0xbc, 0xac, 0xaa,
+0x18, 0x80, 0xca, 0xbe, 0x8a, 0xb9, 0xce, 0xaa, 0x08, 0x08, 0x21, 0x33, 0x34, 0x43, 0x81, 0xaa,
+0x28, 0x55, 0x25, 0x20, 0x64, 0x24, 0x22, 0x12, 0x80, 0x08, 0xb8, 0xbc, 0xcb, 0x0a, 0x33, 0xa8,
+0x2a, 0x83, 0xdb, 0xa9, 0xcf, 0x8b, 0x99, 0xbb, 0x09, 0xa8, 0xba, 0xeb, 0xbc, 0xcb, 0xbb, 0xdb,
+0xab, 0x19, 0x34, 0x25, 0x12, 0x20, 0x33, 0xb0, 0x1a, 0x77, 0x22, 0x44, 0x35, 0x22, 0x11, 0x80,
+0x08, 0x80, 0xdc, 0xbb, 0x88, 0x99, 0x99, 0x99, 0x08, 0x91, 0xec, 0xab, 0x88, 0x80, 0x00, 0xd9,
+0xad, 0x08, 0xb8, 0xdf, 0xab, 0x99, 0xaa, 0x09, 0x81, 0x48, 0x37, 0x80, 0x20, 0x03, 0x28, 0x46,
+0x13, 0x53, 0x34, 0x32, 0x33, 0x81, 0x88, 0x01, 0xf9, 0xad, 0x8a, 0xba, 0xab, 0x00, 0x80, 0xa9,
+0xab, 0x09, 0xc0, 0xad, 0x29, 0x53, 0x81, 0xdb, 0x89, 0xda, 0xbd, 0xab, 0xcc, 0xab, 0x99, 0x18,
+0x43, 0x34, 0x35, 0x21, 0x52, 0x33, 0x34, 0x43, 0x33, 0x34, 0x12, 0x98, 0xba, 0xcd, 0xbb, 0xab,
+0xac, 0xbb, 0x9a, 0x00, 0x88, 0x10, 0x8a, 0x73, 0x82, 0x19, 0xb0, 0x8f, 0x63, 0xc8, 0x0b, 0x01,
+0x18, 0xa3, 0xff, 0x0a, 0x81, 0x99, 0x01, 0x08, 0x54, 0x22, 0x31, 0x04, 0x08, 0x34, 0x92, 0x08,
+0xa8, 0x8a, 0xa0, 0xff, 0x9a, 0xbb, 0x8a, 0xb8, 0xbf, 0x18, 0x10, 0x10, 0x82, 0xa9, 0x89, 0x30,
+0x57, 0x23, 0x63, 0x45, 0x12, 0x01, 0x11, 0x32, 0x13, 0xba, 0xbc, 0xdb, 0xac, 0xcb, 0xab, 0xba,
+0xcc, 0xaa, 0xca, 0x9c, 0x18, 0x10, 0x21, 0x12, 0x31, 0x24, 0xb8, 0x0a, 0x90, 0xbf, 0x99, 0xb9,
+0x09, 0x32, 0x42, 0x44, 0x64, 0x46, 0x34, 0x25, 0x13, 0x11, 0x31, 0x02, 0x98, 0x98, 0xdb, 0xdc,
+0xcb, 0xbc, 0xbb, 0xcb, 0xaa, 0xaa, 0x9a, 0x32, 0x23, 0x53, 0x34, 0x43, 0x14, 0x80, 0x89, 0xb9,
+0xac, 0xab, 0xac, 0x89, 0xb9, 0x2a, 0x46, 0x55, 0x44, 0x22, 0x32, 0x33, 0x11, 0x88, 0xa8, 0xdb,
+0xcb, 0xcc, 0xac, 0xaa, 0xba, 0x9b, 0x89, 0x99, 0x42, 0x22, 0x51, 0x24, 0x22, 0x33, 0x83, 0xbb,
+0xdc, 0xcb, 0xbc, 0xbd, 0x9a, 0x99, 0x20, 0x24, 0x53, 0x35, 0x43, 0x44, 0x23, 0x22, 0x01, 0xa8,
+0xa9, 0xdc, 0xac, 0xab, 0xbb, 0xac, 0x9a, 0x99, 0x11, 0x33, 0x43, 0x44, 0x33, 0x12, 0x12, 0x91,
+0xa9, 0xc9, 0xcf, 0xab, 0xcc, 0xac, 0x89, 0x80, 0x21, 0x44, 0x43, 0x44, 0x22, 0x32, 0x32, 0x12,
+0x81, 0xca, 0xcd, 0xab, 0xca, 0xcc, 0xaa, 0x99, 0xa8, 0x9a, 0x09, 0x32, 0x53, 0x34, 0x42, 0x44,
+0x12, 0x80, 0x00, 0x00, 0x43, 0x83, 0x18, 0x13, 0x00, 0x43, 0xd0, 0x0b, 0x24, 0xda, 0xbc, 0xcc,
+0xab, 0xba, 0xbe, 0xba, 0xcb, 0x9a, 0x80, 0x09, 0x44, 0x23, 0x44, 0x22, 0x90, 0x89, 0x08, 0x11,
+0x98, 0xfb, 0xad, 0x28, 0x46, 0x44, 0x33, 0x23, 0x33, 0x13, 0x21, 0x43, 0x02, 0xfa, 0xdc, 0xbb,
+0xbc, 0xbd, 0xba, 0xab, 0x8a, 0x10, 0x12, 0x53, 0x53, 0x43, 0x33, 0x13, 0x01, 0x80, 0xa8, 0xab,
+0xbb, 0xec, 0xcb, 0xab, 0x09, 0x73, 0x34, 0x33, 0x35, 0x24, 0x22, 0x12, 0xa8, 0xcb, 0xcc, 0xcc,
+0xbb, 0xac, 0xab, 0x9a, 0x8a, 0x10, 0x32, 0x45, 0x43, 0x43, 0x43, 0x12, 0x00, 0xa8, 0xcb, 0xbb,
+0xdb, 0xcb, 0x9a, 0x88, 0x10, 0x20, 0x63, 0x54, 0x44, 0x23, 0x12, 0x11, 0x90, 0xdb, 0xcb, 0xaa,
+0xcc, 0xbb, 0xba, 0x9a, 0x08, 0x10, 0x43, 0x34, 0x53, 0x24, 0x12, 0x22, 0x12, 0x90, 0xda, 0xbc,
+0xbb, 0xcc, 0xbb, 0x89, 0x20, 0x53, 0x43, 0x43, 0x34, 0x34, 0x32, 0x12, 0x00, 0xca, 0xce, 0xbb,
+0xac, 0xab, 0xca, 0xab, 0x08, 0x10, 0x22, 0x33, 0x44, 0x34, 0x33, 0x43, 0x22, 0x01, 0x88, 0x30,
+0x35, 0x21, 0x12, 0x88, 0x61, 0x23, 0x98, 0xba, 0x8a, 0x82, 0xff, 0xcf, 0xa9, 0xba, 0xbb, 0xbb,
+0x09, 0x20, 0x31, 0x36, 0x35, 0x43, 0x13, 0x11, 0x11, 0x80, 0xaa, 0xbc, 0x19, 0x01, 0x62, 0x45,
+0x12, 0x31, 0x24, 0x81, 0x30, 0x55, 0x03, 0xd9, 0xbc, 0xaa, 0xcc, 0xcd, 0xbb, 0xaa, 0x8a, 0x18,
+0x11, 0x44, 0x34, 0x33, 0x43, 0x22, 0x22, 0x80, 0x99, 0x8a, 0x88, 0xca, 0xbc, 0x99, 0x20, 0x46,
+0x02, 0x41, 0x45, 0x23, 0x23, 0x80, 0xcb, 0xcd, 0xbd, 0xbc, 0xac, 0xab, 0x9a, 0x08, 0x22, 0x34,
+0x53, 0x33, 0x34, 0x23, 0x32, 0x22, 0x82, 0xa9, 0xc9, 0xdb, 0xbc, 0xcb, 0xbb, 0x8a, 0x53, 0x35,
+0x34, 0x45, 0x23, 0x12, 0x98, 0xeb, 0xcb, 0xdb, 0xbb, 0xbb, 0x99, 0x89, 0x10, 0x32, 0x53, 0x34,
+0x33, 0x43, 0x34, 0x23, 0x21, 0x11, 0xa0, 0xba, 0xcc, 0xce, 0xab, 0xab, 0x8b, 0x42, 0x53, 0x54,
+0x33, 0x33, 0x12, 0xa0, 0xdc, 0xbd, 0xbc, 0xbb, 0x9a, 0x99, 0x00, 0x11, 0x33, 0x35, 0x33, 0x24,
+0x23, 0x32, 0x34, 0x44, 0x11, 0x80, 0x98, 0xeb, 0xac, 0x99, 0x8a, 0x20, 0x53, 0x53, 0x35, 0x34,
+0x01, 0xb9, 0xcd, 0xcc, 0xbb, 0xac, 0xaa, 0x89, 0x00, 0x21, 0x43, 0x43, 0x33, 0x24, 0x23, 0x32,
+0x22, 0x12, 0x11, 0x00, 0x98, 0xcd, 0xbc, 0xab, 0x89, 0x00, 0x30, 0x77, 0x43, 0x43, 0x23, 0x90,
+0xeb, 0xcc, 0xac, 0xcb, 0xaa, 0x99, 0x08, 0x20, 0x33, 0x44, 0x32, 0x33, 0x33, 0x13, 0x32, 0x22,
+0x32, 0x23, 0xc8, 0xcc, 0xcb, 0xbc, 0xab, 0x89, 0x20, 0x54, 0x55, 0x34, 0x12, 0x88, 0xca, 0xdd,
+0xcb, 0xba, 0xaa, 0x99, 0x88, 0x21, 0x43, 0x34, 0x24, 0x23, 0x22, 0x23, 0x22, 0x12, 0x12, 0x33,
+0x92, 0xdc, 0xcc, 0xbb, 0x9a, 0x98, 0x28, 0x55, 0x34, 0x24, 0x22, 0xa1, 0xdd, 0xbd, 0xdb, 0xaa,
+0xaa, 0x99, 0x08, 0x21, 0x43, 0x43, 0x33, 0x43, 0x24, 0x12, 0x22, 0x32, 0x12, 0x12, 0x01, 0xca,
+0xbd, 0xbc, 0xac, 0x08, 0x21, 0x53, 0x35, 0x33, 0x23, 0xb0, 0xdf, 0xcc, 0xcb, 0xab, 0x9b, 0x99,
+0x10, 0x21, 0x43, 0x33, 0x25, 0x33, 0x32, 0x23, 0x22, 0x52, 0x34, 0x22, 0x00, 0xb8, 0xbc, 0x9b,
+0x88, 0x20, 0x63, 0x53, 0x34, 0x12, 0x98, 0xfa, 0xde, 0xdb, 0xba, 0xaa, 0x99, 0x08, 0x21, 0x32,
+0x63, 0x33, 0x24, 0x22, 0x10, 0x12, 0x02, 0x12, 0x21, 0x22, 0x90, 0x99, 0x20, 0x22, 0x01, 0x18,
+0x76, 0x45, 0x44, 0x01, 0xd9, 0xeb, 0xdb, 0xcb, 0xba, 0xaa, 0x8a, 0x00, 0x32, 0x44, 0x33, 0x25,
+0x22, 0x22, 0x12, 0x21, 0x01, 0x10, 0x11, 0x90, 0x88, 0xa0, 0x9a, 0x22, 0xc0, 0x3a, 0x77, 0x37,
+0x02, 0xa0, 0xbc, 0xce, 0xcc, 0xaa, 0xab, 0x99, 0x88, 0x20, 0x43, 0x24, 0x24, 0x23, 0x23, 0x33,
+0x22, 0x01, 0x00, 0x11, 0x11, 0x81, 0xc9, 0x8a, 0x12, 0x11, 0x63, 0x55, 0x36, 0x12, 0x90, 0xfb,
+0xdc, 0xcb, 0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x32, 0x36, 0x34, 0x33, 0x33, 0x23, 0x23, 0x22, 0x22,
+0x01, 0x00, 0xa8, 0xcc, 0xac, 0x9a, 0x20, 0x46, 0x43, 0x44, 0x24, 0x81, 0xb8, 0xde, 0xbc, 0xbc,
+0xbb, 0xab, 0x8a, 0x10, 0x21, 0x34, 0x35, 0x33, 0x34, 0x22, 0x32, 0x33, 0x32, 0x23, 0x11, 0x80,
+0xea, 0xbb, 0x99, 0x80, 0x20, 0x66, 0x43, 0x23, 0x12, 0xc9, 0xde, 0xcc, 0xac, 0xab, 0x9a, 0x99,
+0x88, 0x21, 0x34, 0x43, 0x33, 0x33, 0x43, 0x23, 0x22, 0x43, 0x33, 0x33, 0x21, 0x80, 0x89, 0x30,
+0x83, 0x09, 0x66, 0x34, 0x24, 0x91, 0xdd, 0xcd, 0xcc, 0xbb, 0xbb, 0xaa, 0x9a, 0x88, 0x32, 0x36,
+0x34, 0x32, 0x33, 0x23, 0x23, 0x23, 0x22, 0x33, 0x01, 0x08, 0x01, 0x48, 0x47, 0x01, 0x21, 0x46,
+0x43, 0x12, 0xa0, 0xec, 0xeb, 0xdb, 0xba, 0xba, 0x9a, 0x9a, 0x18, 0x31, 0x44, 0x33, 0x43, 0x33,
+0x24, 0x12, 0x11, 0x11, 0x22, 0x11, 0x80, 0x99, 0x8a, 0x42, 0x44, 0x53, 0x35, 0x24, 0x02, 0x90,
+0xdd, 0xbe, 0xbd, 0xbb, 0xba, 0xaa, 0x8a, 0x08, 0x43, 0x44, 0x32, 0x24, 0x23, 0x23, 0x11, 0x11,
+0x21, 0x22, 0x01, 0x00, 0x00, 0x31, 0x43, 0x44, 0x55, 0x34, 0x33, 0x02, 0xc9, 0xcf, 0xcd, 0xbb,
+0xbb, 0xab, 0x9b, 0x8a, 0x11, 0x44, 0x43, 0x33, 0x43, 0x32, 0x22, 0x13, 0x12, 0x21, 0x31, 0x02,
+0x80, 0x10, 0x12, 0x44, 0x35, 0x45, 0x33, 0x23, 0x02, 0xfb, 0xdf, 0xcb, 0xab, 0xbb, 0xab, 0xaa,
+0x09, 0x31, 0x35, 0x34, 0x43, 0x23, 0x33, 0x33, 0x22, 0x11, 0x22, 0x81, 0x88, 0x00, 0x12, 0x43,
+0x56, 0x24, 0x22, 0x35, 0x02, 0xba, 0xee, 0xcc, 0xbb, 0xbc, 0xaa, 0xaa, 0xa9, 0x19, 0x42, 0x34,
+0x43, 0x43, 0x33, 0x33, 0x12, 0x22, 0x22, 0x13, 0xa0, 0xbb, 0x1b, 0x55, 0x33, 0x43, 0x33, 0x34,
+0x22, 0xb9, 0xef, 0xcd, 0xcb, 0xab, 0xbb, 0xba, 0x9a, 0x8a, 0x30, 0x44, 0x43, 0x34, 0x33, 0x34,
+0x33, 0x22, 0x21, 0x12, 0x01, 0x91, 0xba, 0x1a, 0x63, 0x63, 0x43, 0x12, 0x21, 0x01, 0xfb, 0xbf,
+0xcc, 0xba, 0xbb, 0xbb, 0xbb, 0x8a, 0x18, 0x42, 0x34, 0x35, 0x43, 0x43, 0x33, 0x22, 0x32, 0x22,
+0x11, 0x01, 0x98, 0x8a, 0x31, 0x36, 0x24, 0x11, 0x21, 0x01, 0xfc, 0xce, 0xbc, 0xad, 0xab, 0xba,
+0xba, 0xaa, 0x09, 0x21, 0x35, 0x43, 0x53, 0x43, 0x23, 0x32, 0x32, 0x33, 0x43, 0x12, 0xa9, 0x10,
+0x24, 0x21, 0x23, 0x90, 0x18, 0x04, 0xfc, 0xdd, 0xdc, 0xab, 0xba, 0xba, 0xaa, 0x9a, 0x98, 0x20,
+0x53, 0x33, 0x34, 0x35, 0x25, 0x23, 0x22, 0x43, 0x33, 0x12, 0x80, 0x18, 0x33, 0x12, 0x32, 0x02,
+0xaa, 0x99, 0xfd, 0xef, 0xcb, 0xbb, 0xbb, 0xbb, 0xac, 0x99, 0x88, 0x20, 0x53, 0x32, 0x43, 0x43,
+0x43, 0x33, 0x33, 0x35, 0x33, 0x32, 0x12, 0x42, 0x24, 0x21, 0x13, 0xc0, 0x8b, 0x88, 0xed, 0xdc,
+0xbc, 0xbc, 0xba, 0xbb, 0xab, 0x9a, 0x88, 0x10, 0x44, 0x34, 0x22, 0x33, 0x34, 0x44, 0x33, 0x33,
+0x44, 0x23, 0x22, 0x32, 0x44, 0x32, 0x02, 0xb8, 0xbb, 0xa9, 0xff, 0xcc, 0xba, 0xba, 0xbb, 0xac,
+0x9a, 0x88, 0x08, 0x10, 0x42, 0x53, 0x22, 0x33, 0x34, 0x33, 0x43, 0x43, 0x43, 0x53, 0x32, 0x32,
+0x33, 0x34, 0x33, 0x91, 0x9b, 0xb9, 0xff, 0xae, 0xac, 0xaa, 0xaa, 0xab, 0x8a, 0x88, 0x00, 0x28,
+0x44, 0x24, 0x21, 0x33, 0x33, 0x33, 0x34, 0x45, 0x22, 0x22, 0x33, 0x53, 0x35, 0x33, 0x11, 0x80,
+0x88, 0xfa, 0xdd, 0xcb, 0xbb, 0xbb, 0xcb, 0x9b, 0x09, 0x08, 0x00, 0x22, 0x53, 0x33, 0x24, 0x33,
+0x22, 0x32, 0x44, 0x44, 0x22, 0x32, 0x45, 0x23, 0x43, 0x12, 0x88, 0x09, 0xa8, 0xed, 0xdb, 0xbc,
+0xcb, 0x9a, 0xaa, 0x9a, 0x89, 0x00, 0x10, 0x42, 0x23, 0x53, 0x23, 0x22, 0x33, 0x12, 0x52, 0x44,
+0x33, 0x34, 0x42, 0x45, 0x23, 0x13, 0x01, 0x00, 0xb9, 0xdf, 0xcc, 0xbb, 0xaa, 0xba, 0xbb, 0xab,
+0x10, 0x12, 0x32, 0x35, 0x21, 0x43, 0x24, 0x22, 0x34, 0x22, 0x41, 0x23, 0x01, 0x73, 0x34, 0x44,
+0x22, 0x00, 0x11, 0x80, 0xb9, 0xde, 0xbe, 0xcb, 0xbb, 0x9a, 0x99, 0x89, 0x10, 0x20, 0x35, 0x23,
+0x21, 0x33, 0x11, 0x11, 0x53, 0x34, 0x44, 0x33, 0x12, 0x20, 0x46, 0x24, 0x23, 0x80, 0xa9, 0x80,
+0xfa, 0xbe, 0xcb, 0xcb, 0xac, 0x99, 0x9a, 0x08, 0x10, 0x32, 0x34, 0x43, 0x33, 0x13, 0x22, 0x13,
+0x90, 0x28, 0x65, 0x34, 0x22, 0x33, 0x43, 0x53, 0x02, 0xca, 0x9b, 0xb8, 0xef, 0xab, 0xba, 0xbc,
+0x9a, 0x89, 0x98, 0x10, 0x32, 0x54, 0x33, 0x32, 0x23, 0x22, 0x01, 0x80, 0x20, 0x36, 0x14, 0x32,
+0x46, 0x34, 0x43, 0x13, 0xb0, 0x8a, 0xa8, 0xff, 0xac, 0xab, 0x9b, 0x9a, 0xa9, 0x09, 0x20, 0x44,
+0x23, 0x22, 0x42, 0x33, 0x23, 0x22, 0x23, 0x81, 0x28, 0x24, 0x98, 0x71, 0x27, 0x43, 0x23, 0x12,
+0x08, 0x98, 0xfc, 0xbe, 0xbb, 0xcc, 0xaa, 0x99, 0x98, 0x00, 0x32, 0x43, 0x43, 0x32, 0x33, 0x32,
+0x13, 0x21, 0x43, 0x34, 0x43, 0x13, 0xa8, 0x48, 0x36, 0x23, 0x03, 0xdb, 0xaa, 0xd9, 0xcd, 0xbc,
+0xbd, 0xad, 0x9a, 0x08, 0x80, 0x11, 0x43, 0x33, 0x25, 0x12, 0x32, 0x23, 0x80, 0x88, 0x08, 0x52,
+0x34, 0x21, 0x53, 0x32, 0x24, 0x02, 0x90, 0xd9, 0xbd, 0xbd, 0xcd, 0xcb, 0xcb, 0x9a, 0x8a, 0x99,
+0x10, 0x32, 0x34, 0x54, 0x23, 0x33, 0x33, 0x12, 0x00, 0x89, 0x18, 0x44, 0x32, 0x21, 0x34, 0x45,
+0x32, 0x81, 0xca, 0xbc, 0xdc, 0xcc, 0xbc, 0xbb, 0xbb, 0xab, 0x99, 0x09, 0x43, 0x35, 0x43, 0x24,
+0x43, 0x32, 0x12, 0x00, 0x08, 0x20, 0x32, 0x25, 0x80, 0x18, 0x11, 0x73, 0x26, 0x91, 0xb9, 0xdb,
+0xbc, 0xcc, 0xcc, 0xbb, 0xba, 0x89, 0x08, 0x28, 0x43, 0x24, 0x53, 0x32, 0x32, 0x33, 0x22, 0x22,
+0x11, 0x89, 0x41, 0x34, 0x43, 0x33, 0x33, 0x45, 0x02, 0x99, 0xb8, 0xff, 0xbc, 0xbc, 0xbc, 0xaa,
+0xaa, 0x99, 0x08, 0x22, 0x43, 0x35, 0x34, 0x23, 0x43, 0x22, 0x22, 0x11, 0x00, 0x41, 0x23, 0x41,
+0x33, 0x81, 0x73, 0x13, 0x89, 0xa8, 0xff, 0xbb, 0xcb, 0xdb, 0xab, 0xaa, 0x9a, 0x08, 0x21, 0x42,
+0x44, 0x24, 0x22, 0x21, 0x21, 0x32, 0x23, 0x11, 0x10, 0x32, 0x44, 0x24, 0x12, 0x41, 0x34, 0x90,
+0x88, 0xe9, 0xce, 0xcc, 0xcb, 0xba, 0xbb, 0xbb, 0xa9, 0x18, 0x43, 0x53, 0x34, 0x22, 0x22, 0x32,
+0x43, 0x32, 0x42, 0x23, 0x11, 0x43, 0x33, 0x63, 0x02, 0x98, 0x01, 0x98, 0xb8, 0xef, 0xbd, 0xbc,
+0xcb, 0xbb, 0xbc, 0x99, 0x09, 0x31, 0x34, 0x43, 0x34, 0x33, 0x32, 0x32, 0x22, 0x02, 0x10, 0x00,
+0x52, 0x25, 0x22, 0x34, 0x13, 0x53, 0x03, 0xa9, 0xc9, 0xcf, 0xad, 0xbc, 0xbc, 0xcb, 0xaa, 0x89,
+0x10, 0x22, 0x33, 0x44, 0x34, 0x22, 0x32, 0x12, 0x11, 0x22, 0x22, 0x33, 0x53, 0x33, 0x02, 0x18,
+0x56, 0x24, 0x81, 0xa8, 0xba, 0xcd, 0xdd, 0xcc, 0xcb, 0xaa, 0x99, 0x98, 0x08, 0x21, 0x44, 0x33,
+0x33, 0x33, 0x23, 0x33, 0x11, 0x52, 0x43, 0x32, 0x43, 0x22, 0x31, 0x34, 0x12, 0xa1, 0xde, 0xbb,
+0xdc, 0xbb, 0xeb, 0xdb, 0xab, 0x9a, 0x99, 0x08, 0x21, 0x23, 0x34, 0x45, 0x23, 0x33, 0x23, 0x32,
+0x33, 0x34, 0x22, 0x33, 0x03, 0x18, 0x46, 0x91, 0x9a, 0xca, 0xcc, 0xca, 0xcd, 0xbc, 0xdb, 0xab,
+0xaa, 0xaa, 0x19, 0x31, 0x73, 0x24, 0x22, 0x22, 0x12, 0x21, 0x12, 0x21, 0x32, 0x44, 0x12, 0x21,
+0x33, 0x01, 0x32, 0xf8, 0xbf, 0x99, 0x98, 0x98, 0xcb, 0xdd, 0xbb, 0xac, 0xba, 0xab, 0x20, 0x12,
+0x01, 0x41, 0x45, 0x23, 0x02, 0xa8, 0x9b, 0x31, 0x13, 0x64, 0x46, 0x34, 0x33, 0x44, 0x33, 0x00,
+0x88, 0xa9, 0xdb, 0xcd, 0xbd, 0xac, 0xab, 0xa9, 0x88, 0x08, 0x01, 0x11, 0x31, 0x35, 0x24, 0x22,
+0x22, 0x11, 0x43, 0x44, 0x42, 0x43, 0x13, 0x98, 0x09, 0x42, 0x82, 0xa9, 0xb9, 0xbb, 0xb9, 0xff,
+0xad, 0xab, 0xba, 0xcb, 0x9a, 0x20, 0x02, 0x10, 0x53, 0x13, 0x00, 0x90, 0x99, 0x20, 0x53, 0x34,
+0x11, 0x73, 0x36, 0x34, 0x34, 0x23, 0x12, 0x22, 0x80, 0x99, 0xee, 0xbc, 0xcc, 0xbb, 0xab, 0xaa,
+0x88, 0x01, 0x11, 0x32, 0x23, 0x63, 0x34, 0x33, 0x33, 0x24, 0x22, 0x42, 0x32, 0x43, 0x81, 0xbc,
+0xbc, 0xac, 0x30, 0x14, 0x18, 0x33, 0x03, 0xb8, 0xff, 0xad, 0xaa, 0xaa, 0x98, 0x08, 0x20, 0x11,
+0x20, 0x82, 0xcc, 0x8a, 0xa9, 0x0a, 0x52, 0x53, 0x55, 0x53, 0x43, 0x23, 0x12, 0x01, 0x08, 0x22,
+0x02, 0xdc, 0xbd, 0xcc, 0xac, 0xab, 0xaa, 0x9a, 0x00, 0x88, 0x20, 0x34, 0x32, 0x53, 0x02, 0x00,
+0x31, 0x34, 0x63, 0x33, 0x43, 0x43, 0x82, 0xa9, 0x89, 0x00, 0x43, 0x14, 0x90, 0x98, 0xdb, 0xcd,
+0xcd, 0xac, 0xbb, 0xab, 0x08, 0x80, 0x52, 0x13, 0x90, 0x00, 0xa9, 0xab, 0xa9, 0x29, 0x64, 0x65,
+0x34, 0x22, 0x43, 0x24, 0x11, 0x01, 0x00, 0x98, 0xdb, 0xcb, 0xcc, 0xbc, 0xba, 0xac, 0x9a, 0x98,
+0x88, 0x10, 0x21, 0x33, 0x43, 0x45, 0x23, 0x12, 0x88, 0x10, 0x43, 0x22, 0x00, 0x88, 0x30, 0x24,
+0x32, 0x47, 0x45, 0x33, 0x33, 0x02, 0xa8, 0xfb, 0xec, 0xcb, 0xaa, 0xaa, 0x9a, 0x89, 0x18, 0x02,
+0x88, 0x9a, 0xaa, 0x20, 0x33, 0x74, 0x44, 0x34, 0x44, 0x24, 0x23, 0x22, 0x32, 0x81, 0xca, 0x99,
+0x08, 0xd9, 0xce, 0xbd, 0xba, 0x9a, 0xab, 0x9a, 0x99, 0x08, 0x44, 0x43, 0x32, 0x33, 0x22, 0x12,
+0x21, 0x43, 0x33, 0x63, 0x12, 0x09, 0x22, 0xe8, 0xac, 0x10, 0x53, 0x45, 0x23, 0x01, 0xa9, 0xca,
+0xeb, 0xcd, 0xac, 0xaa, 0x88, 0x08, 0x00, 0x20, 0x43, 0x01, 0x80, 0x80, 0x80, 0x32, 0x45, 0x42,
+0x53, 0x44, 0x32, 0x23, 0x12, 0x22, 0x13, 0xb9, 0xaa, 0xfc, 0xbd, 0xcc, 0xca, 0xaa, 0xa9, 0xba,
+0xaa, 0x10, 0x23, 0x53, 0x33, 0x34, 0x43, 0x22, 0x52, 0x34, 0x12, 0x90, 0x88, 0xa9, 0x99, 0x88,
+0x89, 0x89, 0x29, 0x55, 0x53, 0x36, 0x04, 0xa9, 0xca, 0xcc, 0xbb, 0xbd, 0xaa, 0x89, 0x99, 0x89,
+0x89, 0x31, 0x25, 0x81, 0x20, 0x43, 0x45, 0x36, 0x22, 0x33, 0x36, 0x12, 0x81, 0x90, 0xbc, 0x9c,
+0xa8, 0xcb, 0xab, 0x99, 0xaa, 0xdc, 0xab, 0xba, 0xbb, 0x8b, 0x08, 0x51, 0x36, 0x33, 0x43, 0x34,
+0x81, 0x08, 0x90, 0xa9, 0x88, 0xeb, 0xab, 0x20, 0x82, 0xcb, 0x71, 0x57, 0x13, 0x11, 0x21, 0x22,
+0x12, 0xba, 0xcd, 0xdc, 0xbb, 0xbc, 0xac, 0xaa, 0x98, 0x89, 0x88, 0x21, 0x44, 0x53, 0x34, 0x34,
+0x33, 0x23, 0x11, 0x18, 0x11, 0x02, 0xda, 0xbc, 0x9b, 0x21, 0x82, 0xca, 0xdc, 0xcc, 0xcb, 0xbb,
+0xab, 0x99, 0xbb, 0x9b, 0x42, 0x33, 0x11, 0x32, 0x23, 0x41, 0x47, 0x33, 0x46, 0x34, 0x33, 0x44,
+0x22, 0x00, 0x99, 0xbb, 0xbb, 0xcd, 0xbb, 0xac, 0xaa, 0xba, 0xbe, 0x9b, 0xa9, 0x99, 0x88, 0x01,
+0x11, 0x31, 0x43, 0x54, 0x44, 0x23, 0x01, 0x20, 0x55, 0x43, 0x22, 0x11, 0x99, 0x30, 0x25, 0x10,
+0x01, 0x98, 0x99, 0xfa, 0xbf, 0xbc, 0xbb, 0xac, 0xab, 0x9a, 0x18, 0x10, 0x22, 0x23, 0x33, 0x82,
+0xbc, 0x29, 0x35, 0x43, 0x54, 0x54, 0x34, 0x33, 0x44, 0x33, 0x14, 0x01, 0x90, 0xb9, 0xdb, 0xdd,
+0xbc, 0xbb, 0x9b, 0xaa, 0x9a, 0x18, 0x23, 0x22, 0x33, 0x34, 0x33, 0x02, 0x80, 0x20, 0x63, 0x34,
+0x45, 0x32, 0x43, 0x35, 0x23, 0x43, 0x33, 0x22, 0x81, 0xca, 0x9a, 0xfa, 0xde, 0xcb, 0xbb, 0xba,
+0xaa, 0x99, 0x88, 0x20, 0x44, 0x23, 0x32, 0x44, 0x22, 0x22, 0x32, 0x44, 0x44, 0x33, 0x12, 0x01,
+0x01, 0xa8, 0xcb, 0xeb, 0xcb, 0xbb, 0xbc, 0xbb, 0xaa, 0xcc, 0xaa, 0xba, 0x0a, 0x01, 0x88, 0x58,
+0x46, 0x33, 0x34, 0x14, 0x11, 0x10, 0x01, 0x99, 0xa9, 0xaa, 0x28, 0x67, 0x23, 0x90, 0xbb, 0x9a,
+0x08, 0xb8, 0xcf, 0xaa, 0x9a, 0x88, 0xb8, 0xbd, 0xaa, 0xab, 0x19, 0xb0, 0x8d, 0x73, 0x35, 0x22,
+0x24, 0x34, 0x34, 0x13, 0x98, 0xaa, 0x99, 0x99, 0xdb, 0xbf, 0x9c, 0x88, 0x98, 0x08, 0x01, 0x28,
+0x37, 0x03, 0xaa, 0x10, 0x33, 0xc0, 0xde, 0xbc, 0xaa, 0x0a, 0x10, 0x22, 0x33, 0x11, 0x71, 0x44,
+0x33, 0x34, 0x11, 0x88, 0x99, 0x19, 0x01, 0xa9, 0xbb, 0xbf, 0xac, 0xba, 0xba, 0x98, 0xcb, 0xdb,
+0xcc, 0xbb, 0xba, 0xaa, 0x08, 0xa8, 0xce, 0x09, 0x63, 0x35, 0x25, 0x23, 0x44, 0x33, 0x33, 0x13,
+0xa9, 0x99, 0xb9, 0xcf, 0xcb, 0xac, 0xaa, 0x98, 0x08, 0x90, 0x9a, 0xaa, 0xac, 0x08, 0x12, 0x00,
+0x11, 0x31, 0x46, 0x43, 0x53, 0x33, 0x91, 0xcc, 0xbc, 0x18, 0x44, 0x44, 0x34, 0x34, 0x43, 0x32,
+0x23, 0xb0, 0xdd, 0xcc, 0xcb, 0xab, 0xaa, 0x8a, 0x10, 0x00, 0x80, 0x89, 0x18, 0x52, 0x43, 0x32,
+0x42, 0x36, 0x35, 0x23, 0x02, 0x98, 0x9a, 0x99, 0x99, 0x89, 0x01, 0x20, 0x47, 0x91, 0xdd, 0xdb,
+0xbb, 0xbb, 0xab, 0x09, 0x11, 0x32, 0x43, 0x21, 0x22, 0x10, 0x31, 0x34, 0x53, 0x35, 0x35, 0x24,
+0x21, 0x34, 0x82, 0xdb, 0xbb, 0x0a, 0x32, 0xd8, 0x8b, 0x80, 0xb9, 0xdd, 0xcd, 0xaa, 0x98, 0xab,
+0x89, 0x99, 0x30, 0x55, 0x43, 0x33, 0x23, 0x24, 0x23, 0x32, 0x02, 0xa9, 0xbb, 0xbd, 0xad, 0x99,
+0xa8, 0xde, 0xaa, 0x99, 0x08, 0x21, 0x80, 0x30, 0x47, 0x43, 0x23, 0x80, 0xb8, 0xcb, 0xbc, 0xba,
+0x99, 0x00, 0x11, 0x43, 0x23, 0xa8, 0xaa, 0x99, 0xcb, 0xcf, 0xac, 0x9a, 0x20, 0x55, 0x33, 0x43,
+0x22, 0x21, 0x44, 0x32, 0x42, 0x12, 0xa9, 0xcd, 0xcc, 0xcb, 0xcb, 0xaa, 0xca, 0x9b, 0x18, 0x22,
+0x44, 0x24, 0x13, 0x12, 0x32, 0x43, 0x22, 0x81, 0x89, 0x22, 0x12, 0xa9, 0xfd, 0xac, 0xba, 0xcb,
+0x99, 0x00, 0x31, 0x03, 0xc9, 0xbc, 0xbc, 0x18, 0x10, 0x00, 0x00, 0x72, 0x45, 0x32, 0x23, 0x90,
+0x99, 0xa8, 0x8a, 0xa0, 0xaf, 0x29, 0x32, 0x24, 0x02, 0x52, 0x22, 0x63, 0x45, 0x01, 0x98, 0xca,
+0xcd, 0xcb, 0xbc, 0xbb, 0xac, 0x89, 0x88, 0x41, 0x34, 0x32, 0x12, 0x88, 0x61, 0x44, 0x43, 0x12,
+0x22, 0x32, 0x44, 0x23, 0x81, 0x88, 0xeb, 0xbd, 0xca, 0xbc, 0xac, 0xba, 0xaa, 0xba, 0xbb, 0x9a,
+0x29, 0x46, 0x12, 0x42, 0x44, 0x23, 0x34, 0x33, 0x33, 0x22, 0x02, 0xba, 0x8a, 0xb8, 0xce, 0xab,
+0x89, 0x10, 0x91, 0xdb, 0xcc, 0xa9, 0xc9, 0xcd, 0xbb, 0xbb, 0x8b, 0x89, 0x8a, 0x20, 0x43, 0x34,
+0x44, 0x33, 0x25, 0x11, 0x44, 0x34, 0x32, 0x21, 0x00, 0x53, 0x34, 0x12, 0x11, 0x81, 0xba, 0xde,
+0xcc, 0xcb, 0xbc, 0xac, 0xab, 0xaa, 0x08, 0x11, 0x11, 0x32, 0x36, 0x25, 0x12, 0x12, 0x33, 0x44,
+0x12, 0x01, 0x01, 0x88, 0x01, 0x08, 0x51, 0x13, 0xba, 0x8c, 0x28, 0x35, 0xa1, 0xdf, 0xcc, 0xcb,
+0xac, 0x9a, 0xaa, 0x9a, 0x09, 0x20, 0x44, 0x34, 0x33, 0x32, 0x11, 0x32, 0x45, 0x34, 0x34, 0x12,
+0x22, 0x81, 0x99, 0xa8, 0xeb, 0xbc, 0xca, 0xbc, 0x9b, 0x98, 0xdb, 0xbc, 0xcc, 0x9a, 0x99, 0x88,
+0x10, 0x32, 0x46, 0x24, 0x33, 0x23, 0x22, 0x22, 0x80, 0xbb, 0x39, 0x47, 0x33, 0x03, 0xcc, 0x1a,
+0x12, 0xa8, 0xdc, 0xbc, 0x8a, 0x98, 0xca, 0xbb, 0x9b, 0xdb, 0xbc, 0xaa, 0x8a, 0x63, 0x24, 0x32,
+0x25, 0x22, 0x44, 0x22, 0x11, 0x02, 0x98, 0xa9, 0xae, 0x0a, 0x08, 0x89, 0xda, 0xbe, 0x9b, 0x21,
+0x81, 0x10, 0x13, 0x98, 0x72, 0x26, 0x90, 0xaa, 0xcd, 0x9b, 0xba, 0xac, 0x89, 0x42, 0x34, 0x11,
+0x42, 0x45, 0x12, 0x23, 0x12, 0x11, 0xa8, 0xad, 0x00, 0xe9, 0xcb, 0xba, 0x9d, 0x18, 0x88, 0x0a,
+0x21, 0x21, 0x13, 0xa9, 0x18, 0xa0, 0xdf, 0xcb, 0x9b, 0x00, 0xa8, 0x9b, 0x72, 0x45, 0x32, 0x32,
+0x33, 0x55, 0x43, 0x23, 0x01, 0xa9, 0xba, 0xeb, 0xdb, 0xcb, 0xaa, 0xab, 0xab, 0x9b, 0x99, 0x88,
+0xca, 0x9c, 0x11, 0x22, 0x65, 0x43, 0x44, 0x23, 0x12, 0x21, 0x11, 0x00, 0xaa, 0xab, 0xaa, 0xa9,
+0xec, 0x8b, 0x73, 0x13, 0x81, 0xb9, 0x9a, 0x01, 0xfc, 0xbc, 0xac, 0x9a, 0xaa, 0x9a, 0x88, 0x98,
+0x18, 0xb8, 0x9d, 0x30, 0x35, 0x47, 0x34, 0x23, 0x32, 0x34, 0x44, 0x43, 0x33, 0x01, 0x98, 0x89,
+0x88, 0xfd, 0xbd, 0xcb, 0xba, 0xab, 0xaa, 0x09, 0x00, 0x98, 0x8a, 0x21, 0x44, 0x35, 0x34, 0x43,
+0x43, 0x43, 0x34, 0x22, 0x11, 0x91, 0xaa, 0x89, 0xb9, 0xbd, 0x9a, 0x9a, 0xda, 0xdf, 0xcb, 0xab,
+0x99, 0x88, 0x89, 0x20, 0x43, 0x43, 0x33, 0x13, 0x31, 0x33, 0x12, 0x52, 0x45, 0x22, 0x12, 0x90,
+0xeb, 0xaa, 0xcb, 0xbb, 0xab, 0x38, 0x57, 0x22, 0x22, 0x24, 0xa0, 0xeb, 0xcb, 0xbc, 0xbb, 0x9a,
+0x18, 0x11, 0x21, 0x22, 0x45, 0x33, 0x01, 0x88, 0x90, 0x19, 0x65, 0x34, 0x33, 0x23, 0x00, 0x80,
+0xb9, 0xdd, 0xbc, 0xac, 0x89, 0x90, 0x98, 0xaa, 0xcb, 0x99, 0x99, 0xaa, 0x0a, 0x55, 0x34, 0x33,
+0x44, 0x34, 0x12, 0x99, 0xaa, 0xbb, 0xa9, 0xde, 0xab, 0x89, 0x10, 0x10, 0x31, 0x56, 0x43, 0x43,
+0x43, 0x11, 0x11, 0x91, 0xdc, 0xbc, 0xbc, 0xdb, 0xbb, 0x9a, 0x18, 0x42, 0x13, 0x12, 0x32, 0x34,
+0x13, 0x99, 0x18, 0x22, 0x44, 0x34, 0x22, 0x41, 0x33, 0x81, 0x89, 0xb8, 0xdf, 0xaa, 0x89, 0x89,
+0xc9, 0xde, 0xbb, 0xab, 0xaa, 0xaa, 0x18, 0x73, 0x44, 0x22, 0x22, 0x43, 0x22, 0x01, 0xa8, 0xba,
+0x1a, 0x22, 0x13, 0xb0, 0xbe, 0x99, 0xcb, 0x9c, 0x99, 0x88, 0x02, 0xeb, 0xdc, 0xcc, 0x9b, 0xaa,
+0xbb, 0x08, 0x21, 0x63, 0x34, 0x32, 0x43, 0x34, 0x23, 0x42, 0x55, 0x33, 0x33, 0x13, 0xa8, 0x0a,
+0xb0, 0xff, 0xbb, 0xab, 0xba, 0xba, 0xcc, 0xab, 0x99, 0x99, 0xaa, 0x08, 0x63, 0x43, 0x53, 0x34,
+0x35, 0x33, 0x23, 0x32, 0x43, 0x02, 0xca, 0xcd, 0xab, 0x9a, 0xba, 0x9b, 0x41, 0x12, 0x10, 0x80,
+0xb9, 0xdc, 0xcc, 0x9a, 0x18, 0x12, 0xb8, 0xad, 0x19, 0xa8, 0xbb, 0xcb, 0xbc, 0x2b, 0x57, 0x32,
+0x44, 0x34, 0x24, 0x33, 0x53, 0x23, 0x82, 0x99, 0xcb, 0xdb, 0xdb, 0xcb, 0xbc, 0xba, 0xab, 0x99,
+0x80, 0x80, 0x18, 0x43, 0x33, 0x43, 0x36, 0x24, 0x21, 0x34, 0x22, 0x01, 0x80, 0x08, 0x32, 0x24,
+0x34, 0x43, 0x22, 0x11, 0xa8, 0xec, 0xcd, 0xcd, 0xcb, 0xab, 0xaa, 0x98, 0x99, 0x88, 0x32, 0x35,
+0x33, 0x32, 0x44, 0x23, 0x31, 0x33, 0x45, 0x34, 0x13, 0x11, 0x00, 0x31, 0x05, 0xc9, 0xbb, 0xcc,
+0xab, 0xc9, 0xbe, 0xcb, 0xaa, 0xaa, 0xba, 0x9b, 0x18, 0x31, 0x35, 0x32, 0x46, 0x32, 0x34, 0x33,
+0x12, 0x00, 0x99, 0x41, 0x23, 0x22, 0x12, 0x80, 0xeb, 0xbc, 0x99, 0xb9, 0x19, 0xd8, 0xac, 0x88,
+0xd9, 0xdc, 0xdc, 0xbb, 0xaa, 0x8a, 0x08, 0x10, 0x53, 0x45, 0x22, 0x22, 0x22, 0x11, 0x01, 0xa8,
+0xab, 0xca, 0xbc, 0x40, 0x36, 0x33, 0x32, 0x34, 0x55, 0x43, 0x12, 0x01, 0xb9, 0xcf, 0xcb, 0xba,
+0xbc, 0xcb, 0xab, 0x89, 0x10, 0x22, 0x21, 0x53, 0x35, 0x33, 0x22, 0x33, 0x35, 0x12, 0x21, 0x81,
+0x88, 0x88, 0xcb, 0x0a, 0x33, 0x46, 0x33, 0x22, 0x11, 0xc9, 0xdc, 0xcf, 0xbd, 0xba, 0xbb, 0xac,
+0x09, 0x20, 0x31, 0x43, 0x23, 0x22, 0x34, 0x22, 0x44, 0x43, 0x53, 0x33, 0x22, 0x34, 0x23, 0x01,
+0xb9, 0xcd, 0xbb, 0xbc, 0xad, 0xaa, 0xba, 0xdb, 0xbc, 0xbc, 0xa9, 0x9a, 0x89, 0x31, 0x44, 0x43,
+0x43, 0x33, 0x35, 0x23, 0x00, 0x01, 0x11, 0x01, 0xa8, 0x9b, 0x52, 0x33, 0x22, 0xa0, 0x49, 0x37,
+0x81, 0x18, 0xd0, 0xbc, 0xfb, 0xbe, 0xbd, 0xba, 0x9a, 0x99, 0x89, 0x10, 0x53, 0x44, 0x33, 0x33,
+0x34, 0x22, 0x11, 0x21, 0x01, 0xab, 0x19, 0x88, 0x73, 0x37, 0x80, 0x08, 0x88, 0xba, 0xcc, 0xbc,
+0xcc, 0xcc, 0x9a, 0xaa, 0x8a, 0x09, 0x89, 0x28, 0x32, 0x53, 0x44, 0x34, 0x34, 0x24, 0x11, 0x12,
+0x21, 0x22, 0x90, 0xac, 0x8a, 0x9a, 0x09, 0x11, 0xf9, 0xcf, 0x99, 0x00, 0x81, 0xd9, 0xcc, 0x9a,
+0xa9, 0x89, 0x99, 0x18, 0x53, 0x43, 0x35, 0x23, 0x21, 0x43, 0x13, 0x90, 0xcb, 0xbc, 0xcb, 0x0a,
+0x01, 0xa9, 0x1a, 0x35, 0x43, 0x55, 0x22, 0x22, 0x24, 0x88, 0xba, 0xdc, 0xac, 0xdc, 0xab, 0xa9,
+0xaa, 0x9a, 0x21, 0x53, 0x34, 0x32, 0x34, 0x33, 0x23, 0x01, 0x89, 0xeb, 0xbb, 0x19, 0x11, 0x12,
+0x20, 0x65, 0x12, 0x20, 0x63, 0x33, 0xa1, 0xce, 0xac, 0xdb, 0xbc, 0xaa, 0x9a, 0x08, 0x11, 0x43,
+0x34, 0x53, 0x32, 0x22, 0x33, 0x02, 0x00, 0x12, 0x98, 0x9a, 0x89, 0xca, 0xcd, 0xac, 0xba, 0xab,
+0x09, 0xa9, 0x9b, 0xfa, 0xdf, 0xaa, 0xba, 0xaa, 0x88, 0x30, 0x56, 0x33, 0x53, 0x43, 0x33, 0x33,
+0x33, 0x02, 0xc9, 0xcd, 0xbb, 0xac, 0xbb, 0xbb, 0xaa, 0x98, 0xb9, 0x9b, 0x30, 0x23, 0x42, 0x34,
+0x43, 0x13, 0x20, 0x66, 0x23, 0x81, 0x90, 0xaa, 0x40, 0x35, 0x13, 0x22, 0x33, 0x02, 0x62, 0x24,
+0xe9, 0xbc, 0xac, 0x8a, 0x00, 0xca, 0xcc, 0xab, 0x8a, 0x98, 0x00, 0x10, 0x10, 0x34, 0xc8, 0xac,
+0x19, 0x53, 0x45, 0x43, 0x34, 0x33, 0x53, 0x24, 0x22, 0x22, 0x80, 0x08, 0xc9, 0xde, 0xbc, 0xcb,
+0xbb, 0xcb, 0xaa, 0x88, 0x20, 0x11, 0x32, 0x44, 0x22, 0x33, 0x25, 0x02, 0x08, 0x52, 0x35, 0x11,
+0x11, 0x21, 0x11, 0xc9, 0xbd, 0x0a, 0x43, 0x82, 0xba, 0x89, 0xb9, 0xbe, 0xdc, 0xcd, 0xbb, 0xbb,
+0x9b, 0x11, 0x42, 0x34, 0x22, 0x42, 0x23, 0x01, 0x88, 0xaa, 0x18, 0x34, 0x36, 0x34, 0x55, 0x43,
+0x22, 0x24, 0x90, 0xaa, 0xbb, 0xcc, 0xdb, 0xbd, 0xbb, 0xba, 0xaa, 0x89, 0x89, 0x21, 0x33, 0x53,
+0x54, 0x43, 0x24, 0x23, 0x01, 0x00, 0x88, 0x80, 0x08, 0x90, 0xbc, 0x09, 0xa9, 0x8b, 0xa0, 0xbe,
+0x48, 0x24, 0x43, 0x23, 0xfa, 0xac, 0x9a, 0xcb, 0xbc, 0xcb, 0xab, 0x08, 0x31, 0x35, 0x23, 0x22,
+0x01, 0xcb, 0xac, 0x09, 0x52, 0x44, 0x33, 0x24, 0x32, 0x45, 0x44, 0x23, 0x01, 0x00, 0x98, 0xbb,
+0xde, 0xbd, 0xab, 0xdb, 0xaa, 0x8a, 0x89, 0x00, 0x10, 0x53, 0x33, 0x33, 0x24, 0x10, 0x35, 0x14,
+0x21, 0x90, 0x09, 0x62, 0x22, 0x80, 0xb9, 0xab, 0xa9, 0xdb, 0xac, 0x08, 0x11, 0x52, 0x25, 0xa0,
+0x8a, 0xb0, 0xdf, 0xcb, 0xcb, 0xab, 0x9a, 0x09, 0x21, 0x42, 0x23, 0x80, 0x28, 0x24, 0xa8, 0x60,
+0x47, 0x34, 0x33, 0x23, 0x43, 0x34, 0x03, 0xb8, 0xdc, 0xcb, 0xba, 0xdb, 0xba, 0xcb, 0xbb, 0x88,
+0x99, 0x0a, 0x00, 0x20, 0x45, 0x34, 0x43, 0x22, 0x33, 0x24, 0x32, 0x24, 0x80, 0x98, 0x99, 0x21,
+0xa2, 0x8c, 0x81, 0xcd, 0x29, 0x34, 0x53, 0x23, 0xa0, 0xde, 0xcd, 0xba, 0xcb, 0xab, 0x99, 0x89,
+0x18, 0x31, 0x44, 0x33, 0x32, 0x11, 0x00, 0x21, 0x65, 0x44, 0x24, 0x33, 0x34, 0x23, 0x21, 0x10,
+0xa8, 0xdd, 0xcc, 0xdb, 0xaa, 0xba, 0xbb, 0xbb, 0xba, 0x09, 0x00, 0x41, 0x54, 0x33, 0x45, 0x33,
+0x32, 0x12, 0x00, 0x11, 0x80, 0x98, 0x90, 0xcb, 0x8a, 0x00, 0x99, 0xdb, 0xcd, 0xbc, 0x9a, 0xa9,
+0x8a, 0x88, 0xa9, 0x99, 0xcb, 0xac, 0xce, 0xac, 0x18, 0x52, 0x34, 0x23, 0x22, 0x43, 0x24, 0x80,
+0x88, 0x98, 0xdb, 0xab, 0x08, 0x01, 0x40, 0x67, 0x12, 0x20, 0x22, 0x91, 0xca, 0xdb, 0xcc, 0xbc,
+0xbb, 0xcb, 0xaa, 0x09, 0x11, 0x22, 0x35, 0x36, 0x34, 0x32, 0x22, 0x32, 0x23, 0x13, 0x00, 0xdb,
+0xbd, 0xac, 0xbc, 0xcb, 0xbc, 0x9a, 0x89, 0x20, 0x44, 0x23, 0x01, 0x80, 0xaa, 0x9b, 0x00, 0xb8,
+0x8a, 0x62, 0x44, 0x45, 0x24, 0x22, 0x00, 0x21, 0x03, 0xea, 0xcd, 0xaa, 0x9a, 0x88, 0xa9, 0xa9,
+0x89, 0x42, 0x35, 0x33, 0x21, 0x23, 0x22, 0x90, 0xeb, 0xbc, 0xcc, 0xdc, 0xab, 0x09, 0x12, 0x98,
+0x31, 0x12, 0x41, 0x36, 0x54, 0x45, 0x23, 0x12, 0x80, 0x99, 0x00, 0xa8, 0xdd, 0xbd, 0xcb, 0x9a,
+0x89, 0x99, 0x98, 0x80, 0x90, 0xba, 0x9b, 0x72, 0x36, 0x24, 0x11, 0x21, 0x43, 0x22, 0x01, 0xfb,
+0xbb, 0xaa, 0x99, 0x32, 0x56, 0x44, 0x32, 0x22, 0x02, 0x98, 0xcb, 0xce, 0xbc, 0xcb, 0x9a, 0x99,
+0x08, 0x00, 0x98, 0x98, 0x98, 0x20, 0x44, 0x46, 0x44, 0x23, 0x23, 0x24, 0x22, 0x11, 0xa8, 0xcb,
+0xdb, 0xba, 0xa9, 0xbb, 0xbb, 0xdb, 0xbc, 0xbb, 0xbc, 0x8a, 0x08, 0x08, 0x21, 0x34, 0x45, 0x33,
+0x32, 0x63, 0x23, 0x23, 0x12, 0xa9, 0x19, 0x44, 0x13, 0x11, 0x11, 0x53, 0x45, 0x33, 0x01, 0x91,
+0xee, 0xcc, 0xdb, 0xbb, 0xab, 0x89, 0x10, 0x01, 0x32, 0x35, 0x22, 0x22, 0x81, 0x10, 0x22, 0x18,
+0x62, 0x45, 0x54, 0x22, 0x80, 0x11, 0x23, 0x12, 0xb8, 0xce, 0x9b, 0xa9, 0xdb, 0xcd, 0xac, 0xaa,
+0xba, 0x09, 0x00, 0x11, 0x45, 0x22, 0x31, 0x34, 0x33, 0x33, 0x22, 0x21, 0x42, 0x33, 0x92, 0xaa,
+0xca, 0xbd, 0xbd, 0x9b, 0x21, 0xa1, 0xbc, 0x8a, 0x98, 0xcb, 0xdf, 0xbd, 0xaa, 0x89, 0x99, 0x28,
+0x45, 0x34, 0x43, 0x21, 0x10, 0x08, 0x01, 0xa0, 0xba, 0xb9, 0xcc, 0xdb, 0xbc, 0x19, 0x23, 0x01,
+0x30, 0x57, 0x44, 0x24, 0x12, 0x11, 0x90, 0xdc, 0xcb, 0xcb, 0xcb, 0x9a, 0x8a, 0x18, 0x10, 0x21,
+0x11, 0x44, 0x44, 0x22, 0x21, 0x01, 0x00, 0x81, 0xa8, 0x88, 0x10, 0x80, 0x08, 0x10, 0x31, 0x67,
+0x13, 0x22, 0x14, 0xc9, 0xcd, 0xcd, 0xbc, 0xab, 0xab, 0x8a, 0x08, 0x21, 0x53, 0x34, 0x43, 0x43,
+0x23, 0x31, 0x23, 0x02, 0x11, 0x88, 0x10, 0x03, 0xdc, 0xdc, 0xbc, 0x8a, 0x08, 0x00, 0x98, 0xbb,
+0xcd, 0xcd, 0xaa, 0xb9, 0x89, 0x10, 0x08, 0x73, 0x43, 0x53, 0x35, 0x34, 0x22, 0x80, 0xa9, 0xaa,
+0xcb, 0xac, 0xcb, 0xbc, 0x89, 0x98, 0x09, 0x43, 0x12, 0x21, 0x82, 0x89, 0x90, 0xbc, 0x0a, 0x10,
+0x41, 0x83, 0xcf, 0x89, 0x21, 0x33, 0x12, 0xc9, 0x9b, 0x74, 0x77, 0x23, 0x01, 0x00, 0xa9, 0x9b,
+0x88, 0xeb, 0xac, 0xbb, 0x9a, 0x88, 0x89, 0x98, 0xb9, 0xbb, 0xdf, 0xac, 0x08, 0x22, 0x54, 0x33,
+0x53, 0x35, 0x33, 0x43, 0x24, 0x02, 0x80, 0xdb, 0xbb, 0xcc, 0xcc, 0xba, 0xab, 0x9a, 0x88, 0x08,
+0x08, 0x20, 0x44, 0x43, 0x33, 0x25, 0x23, 0x33, 0x34, 0x23, 0x12, 0x01, 0xa8, 0xdc, 0xab, 0xaa,
+0xbb, 0xaa, 0xb9, 0xad, 0x08, 0xa8, 0xdf, 0xcc, 0xbb, 0xab, 0x99, 0x08, 0x31, 0x56, 0x43, 0x23,
+0x12, 0x81, 0xa9, 0xa9, 0x09, 0x44, 0x33, 0x44, 0x43, 0x43, 0x11, 0x98, 0xdb, 0xbc, 0xcb, 0xcb,
+0xbb, 0xcb, 0x9a, 0x89, 0xaa, 0x08, 0x10, 0x44, 0x43, 0x43, 0x35, 0x34, 0x33, 0x33, 0x13, 0xa8,
+0xcb, 0xcc, 0xbb, 0xb9, 0xcb, 0x8b, 0x89, 0x09, 0x00, 0x00, 0x64, 0x35, 0x24, 0x02, 0xa9, 0xbb,
+0xbd, 0xbc, 0xba, 0x9a, 0x99, 0x89, 0x73, 0x33, 0x43, 0x02, 0x98, 0x88, 0xdc, 0x8b, 0x00, 0x10,
+0x54, 0x44, 0x34, 0x33, 0x22, 0x11, 0x10, 0x82, 0xed, 0xbb, 0xdb, 0xbc, 0xab, 0xcc, 0xab, 0x98,
+0x00, 0x31, 0x24, 0x34, 0x34, 0x33, 0x35, 0x24, 0x02, 0x80, 0xb9, 0xa9, 0x99, 0xbb, 0xbc, 0xcb,
+0xcc, 0xcb, 0xcb, 0x0a, 0x63, 0x34, 0x33, 0x80, 0x9a, 0x10, 0x80, 0xaa, 0xce, 0x9c, 0x99, 0x00,
+0x31, 0x33, 0x02, 0x01, 0xfa, 0xbe, 0x89, 0x00, 0x00, 0x90, 0x19, 0x47, 0x33, 0x44, 0x33, 0x33,
+0x23, 0x90, 0xaa, 0xcb, 0xdd, 0xcc, 0xbd, 0xaa, 0x89, 0x99, 0x08, 0x90, 0x10, 0x55, 0x33, 0x35,
+0x33, 0x21, 0x01, 0x98, 0x00, 0xb8, 0xbc, 0xda, 0xac, 0x09, 0x11, 0x20, 0x31, 0x34, 0x93, 0xff,
+0xba, 0xaa, 0xba, 0x99, 0xaa, 0x9b, 0x88, 0x8a, 0x72, 0x37, 0x53, 0x32, 0x23, 0x42, 0x43, 0x43,
+0x02, 0xb9, 0xcc, 0xcc, 0xaa, 0xaa, 0xab, 0x89, 0x89, 0x99, 0x9a, 0x19, 0x22, 0x32, 0x64, 0x24,
+0x22, 0x42, 0x11, 0x31, 0x26, 0x11, 0x02, 0xd9, 0xac, 0xa9, 0x0a, 0x35, 0x22, 0x63, 0x23, 0x00,
+0x32, 0x91, 0xce, 0xbe, 0xad, 0xab, 0x98, 0x88, 0x80, 0x01, 0x81, 0xaa, 0xbb, 0x9a, 0x75, 0x35,
+0x24, 0x33, 0x35, 0x34, 0x43, 0x12, 0x98, 0xdb, 0xcc, 0xbb, 0xbb, 0xcb, 0xba, 0x9a, 0x99, 0x10,
+0x22, 0x34, 0x34, 0x44, 0x43, 0x33, 0x12, 0x22, 0x01, 0x99, 0x99, 0xda, 0x9b, 0x91, 0xed, 0x9b,
+0x98, 0x8a, 0x73, 0x24, 0x22, 0x02, 0xa9, 0xab, 0xcb, 0xcd, 0xcd, 0xbb, 0x89, 0x10, 0x32, 0x24,
+0x43, 0x43, 0x22, 0x11, 0x02, 0x01, 0x10, 0x82, 0xba, 0x99, 0x80, 0x42, 0xa2, 0xff, 0xba, 0xca,
+0x9b, 0x18, 0x98, 0xcb, 0xac, 0x99, 0x89, 0x21, 0x02, 0x41, 0x45, 0x23, 0x63, 0x44, 0x33, 0x22,
+0x22, 0x12, 0x01, 0xa8, 0xdf, 0xab, 0xcb, 0xcb, 0x99, 0x98, 0xab, 0xbb, 0x19, 0x44, 0x02, 0x32,
+0x23, 0x11, 0x35, 0x92, 0x0a, 0x32, 0x54, 0x34, 0x02, 0x41, 0x34, 0x33, 0x14, 0xa0, 0x9a, 0xd9,
+0xcf, 0xab, 0xcb, 0xba, 0xbb, 0xcb, 0xa9, 0x08, 0x21, 0x55, 0x36, 0x23, 0x32, 0x32, 0x11, 0x13,
+0xd9, 0xbb, 0xbc, 0xad, 0xab, 0xab, 0x09, 0xa9, 0xaa, 0xab, 0x40, 0x26, 0x53, 0x37, 0x23, 0x21,
+0x01, 0x99, 0xa9, 0xeb, 0xaa, 0xa9, 0x8a, 0x22, 0x00, 0x53, 0xb0, 0xbf, 0xcc, 0xbd, 0x9a, 0x18,
+0x42, 0x33, 0x01, 0x42, 0x35, 0x12, 0x00, 0xb8, 0xcd, 0xaa, 0xa9, 0x20, 0x25, 0x31, 0x47, 0x33,
+0x23, 0x11, 0x90, 0xa8, 0xed, 0xbc, 0xac, 0xaa, 0xa9, 0x9a, 0x09, 0x98, 0x9a, 0xaa, 0xac, 0x28,
+0x42, 0x66, 0x34, 0x32, 0x43, 0x24, 0x43, 0x24, 0x12, 0x80, 0xb9, 0xdb, 0xba, 0xac, 0xcb, 0xcc,
+0xac, 0xab, 0x99, 0x88, 0x98, 0x88, 0x10, 0x53, 0x34, 0x44, 0x43, 0x33, 0x24, 0x22, 0x01, 0x81,
+0x88, 0xa9, 0xbd, 0xcc, 0xbb, 0x09, 0x11, 0x52, 0x23, 0x98, 0x88, 0xc9, 0xdc, 0xdc, 0xac, 0x8a,
+0x98, 0x00, 0x80, 0x18, 0x44, 0x22, 0x00, 0x08, 0x52, 0x32, 0x54, 0x44, 0x43, 0x22, 0x01, 0x10,
+0x00, 0xb9, 0xce, 0xbc, 0xbb, 0xbc, 0xcb, 0xaa, 0x9a, 0x99, 0x08, 0x11, 0x32, 0x34, 0x45, 0x44,
+0x33, 0x33, 0x33, 0x33, 0x14, 0x81, 0x98, 0xcc, 0x8a, 0x88, 0xc9, 0xdc, 0xcd, 0xaa, 0x9a, 0x9a,
+0x08, 0x42, 0x44, 0x22, 0x21, 0x02, 0x11, 0xb8, 0xcc, 0x99, 0xa9, 0x89, 0x21, 0x73, 0x34, 0x80,
+0x98, 0xb9, 0xbb, 0xba, 0xba, 0x9a, 0x09, 0x75, 0x33, 0x43, 0x12, 0xa8, 0x8a, 0x40, 0x57, 0x03,
+0xba, 0xaa, 0xaa, 0x9a, 0xfc, 0xbc, 0xaa, 0x88, 0x20, 0x11, 0x11, 0x21, 0x43, 0x33, 0x55, 0x34,
+0x12, 0x11, 0xa1, 0xab, 0x38, 0x32, 0x21, 0xc9, 0x9d, 0x98, 0xbb, 0x2a, 0x22, 0xb8, 0xff, 0xdf,
+0xaa, 0x89, 0x00, 0x81, 0xa9, 0x8a, 0x52, 0x45, 0x22, 0x11, 0x32, 0x21, 0x52, 0x13, 0x98, 0x31,
+0x02, 0xcb, 0xbc, 0xbd, 0xac, 0x9a, 0xba, 0xbc, 0x99, 0xa8, 0xcb, 0xcb, 0xdb, 0xba, 0xba, 0x40,
+0x47, 0x11, 0x30, 0x35, 0x23, 0x21, 0x22, 0x12, 0x90, 0x88, 0x18, 0x41, 0x13, 0xfc, 0x9a, 0xa8,
+0xad, 0x09, 0xc9, 0xbc, 0xaa, 0xba, 0xcd, 0xac, 0x08, 0x80, 0xaa, 0x9b, 0x40, 0x36, 0x23, 0x80,
+0x09, 0x33, 0x02, 0x72, 0x46, 0x43, 0x44, 0x53, 0x42, 0x22, 0x02, 0xc8, 0xcc, 0xcb, 0xbc, 0xab,
+0xbb, 0x8a, 0x10, 0x00, 0x81, 0x99, 0x38, 0x35, 0x54, 0x45, 0x12, 0x12, 0x32, 0x42, 0x12, 0x90,
+0xbb, 0xbc, 0xab, 0xaa, 0xbc, 0xaa, 0x88, 0x31, 0xb1, 0xcf, 0xbb, 0xdc, 0xac, 0x9a, 0x00, 0x33,
+0x23, 0x12, 0x21, 0x53, 0x34, 0x24, 0x22, 0x43, 0x44, 0x23, 0x43, 0x02, 0x00, 0xb8, 0xed, 0xcb,
+0xaa, 0xab, 0xbb, 0xaa, 0xbc, 0xac, 0x8a, 0x08, 0x31, 0x44, 0x44, 0x34, 0x34, 0x33, 0x33, 0x82,
+0xaa, 0xba, 0xac, 0xa9, 0xcb, 0xcb, 0xba, 0x0a, 0x90, 0xdb, 0xca, 0xab, 0x51, 0x23, 0x80, 0x08,
+0x10, 0x13, 0xfb, 0x9c, 0xb9, 0x9c, 0x52, 0x44, 0x44, 0x42, 0x22, 0x22, 0x11, 0xc8, 0xbd, 0xba,
+0xbb, 0xab, 0xbd, 0xac, 0x89, 0x28, 0x54, 0x12, 0x53, 0x82, 0x99, 0xb9, 0xcc, 0x99, 0xb9, 0xac,
+0x89, 0x31, 0x45, 0x11, 0x11, 0x34, 0x55, 0x44, 0x33, 0x32, 0x12, 0x99, 0xcb, 0xdc, 0xbc, 0xbc,
+0xbb, 0xcb, 0x99, 0x08, 0x20, 0x33, 0x23, 0x11, 0x22, 0x52, 0x44, 0x34, 0x43, 0x33, 0x12, 0x01,
+0x99, 0x89, 0xc9, 0xcf, 0xab, 0x08, 0x43, 0x43, 0x12, 0x90, 0xb9, 0xdc, 0xcc, 0xac, 0xab, 0x99,
+0x10, 0x11, 0x32, 0x45, 0x33, 0x01, 0x98, 0xba, 0xbc, 0x8a, 0x42, 0x35, 0x25, 0x22, 0x10, 0x63,
+0x23, 0x33, 0x24, 0x00, 0x22, 0xf8, 0xbc, 0xcc, 0xbd, 0xaa, 0xcb, 0xab, 0x08, 0x18, 0x32, 0x23,
+0x34, 0x45, 0x32, 0x23, 0x32, 0x25, 0x11, 0x44, 0x12, 0x88, 0x90, 0xbd, 0xba, 0xcd, 0xac, 0xba,
+0xab, 0x18, 0x02, 0x43, 0x82, 0x09, 0x22, 0x90, 0xaa, 0xbc, 0x71, 0x45, 0x22, 0x22, 0x11, 0x80,
+0xa9, 0xec, 0xac, 0xab, 0xbb, 0x8b, 0x41, 0x44, 0x34, 0x34, 0x32, 0x23, 0x81, 0xb9, 0xcc, 0xca,
+0xca, 0xcb, 0xbb, 0xab, 0x09, 0x80, 0x18, 0x41, 0x53, 0x33, 0x43, 0x42, 0x12, 0x10, 0x11, 0x90,
+0xcb, 0xbe, 0xac, 0x99, 0x98, 0x29, 0x64, 0x44, 0x43, 0x24, 0x43, 0x12, 0xb9, 0xdb, 0xdb, 0xbc,
+0xbb, 0xbb, 0x9a, 0x10, 0x21, 0x25, 0x12, 0x00, 0xa8, 0xab, 0x19, 0x74, 0x44, 0x43, 0x33, 0x43,
+0x33, 0x23, 0x80, 0xa8, 0xca, 0xdc, 0xcb, 0xcb, 0xab, 0xab, 0xcb, 0xcc, 0xba, 0x99, 0x00, 0x21,
+0x22, 0x64, 0x35, 0x32, 0x22, 0x02, 0x31, 0x24, 0x02, 0x80, 0x99, 0x89, 0x98, 0xcc, 0xcd, 0x9b,
+0x99, 0xbb, 0x09, 0xa0, 0xaa, 0xfa, 0xbe, 0x99, 0xca, 0xaa, 0x09, 0x73, 0x35, 0x33, 0x32, 0x22,
+0x12, 0x01, 0xdb, 0xcd, 0xab, 0x9b, 0x9a, 0xa8, 0x0a, 0x73, 0x12, 0x42, 0x33, 0x45, 0x25, 0x02,
+0x80, 0xa0, 0xcb, 0xcc, 0xbc, 0xba, 0xbb, 0xbb, 0x99, 0x21, 0x33, 0x35, 0x25, 0x32, 0x35, 0x12,
+0x12, 0x02, 0x08, 0x22, 0x11, 0x02, 0xa9, 0x88, 0xfe, 0x8a, 0x12, 0x00, 0x12, 0xfc, 0xbb, 0xdb,
+0xbd, 0xaa, 0xba, 0x0a, 0x11, 0x31, 0x47, 0x22, 0x43, 0x33, 0x31, 0x23, 0x81, 0x28, 0x01, 0x9a,
+0xa0, 0xee, 0xaa, 0xaa, 0xac, 0xa9, 0xcc, 0x8a, 0x80, 0x99, 0x99, 0xdd, 0xab, 0x89, 0x08, 0x31,
+0x34, 0x64, 0x45, 0x33, 0x34, 0x24, 0x33, 0x13, 0xb0, 0xdc, 0xcc, 0xbb, 0xab, 0xac, 0x9a, 0xa8,
+0x88, 0x00, 0x32, 0x26, 0x12, 0x21, 0x33, 0x34, 0x02, 0xba, 0x0a, 0x42, 0x33, 0x01, 0x18, 0x77,
+0x25, 0x21, 0x23, 0x23, 0x23, 0xc1, 0xcf, 0xbc, 0xbc, 0xcb, 0xba, 0x9a, 0x08, 0x11, 0x23, 0x12,
+0x53, 0x34, 0x34, 0x44, 0x22, 0x23, 0x02, 0x12, 0x91, 0xdb, 0xca, 0xbb, 0x9a, 0x80, 0x08, 0x33,
+0x25, 0x82, 0xda, 0xde, 0xcc, 0xac, 0xbb, 0x99, 0x20, 0x32, 0x34, 0x34, 0x22, 0x12, 0x21, 0x43,
+0x44, 0x42, 0x32, 0x12, 0x32, 0x25, 0x90, 0xba, 0xce, 0xcc, 0xbb, 0xac, 0xa9, 0xab, 0x99, 0x99,
+0x18, 0x11, 0x11, 0x31, 0x74, 0x44, 0x34, 0x33, 0x34, 0x33, 0x12, 0x98, 0xba, 0xbc, 0xcc, 0xbc,
+0xbc, 0xaa, 0xaa, 0xba, 0xab, 0x9a, 0x71, 0x35, 0x32, 0x44, 0x12, 0x00, 0x80, 0xba, 0xbb, 0xbd,
+0xaa, 0x99, 0x09, 0x23, 0x23, 0x34, 0x13, 0x53, 0x93, 0xed, 0xba, 0xa9, 0x89, 0x10, 0x53, 0x35,
+0x43, 0x43, 0x33, 0x13, 0xa8, 0xaa, 0x98, 0xeb, 0xdd, 0xbd, 0xaa, 0x9a, 0xa9, 0x88, 0x08, 0x31,
+0x35, 0x33, 0x43, 0x34, 0x22, 0x44, 0x12, 0x20, 0x12, 0x90, 0x20, 0xa0, 0x9d, 0xca, 0xae, 0x20,
+0x91, 0xaa, 0xea, 0xbd, 0x99, 0xeb, 0x9a, 0x90, 0x89, 0x01, 0x09, 0x64, 0x23, 0x53, 0x33, 0x32,
+0x14, 0xa8, 0xab, 0xca, 0xaa, 0xec, 0xbb, 0x88, 0x88, 0x52, 0x12, 0x41, 0x45, 0x44, 0x33, 0x81,
+0xa9, 0xc9, 0xcc, 0xcb, 0xad, 0x9b, 0x89, 0x08, 0x01, 0x11, 0x31, 0x45, 0x33, 0x33, 0x32, 0x11,
+0x00, 0x98, 0x09, 0x53, 0x22, 0x33, 0x83, 0xdc, 0x9c, 0x89, 0xb9, 0xcc, 0xcb, 0xbe, 0xba, 0xcd,
+0xbc, 0xa9, 0x99, 0x10, 0x33, 0x65, 0x34, 0x43, 0x43, 0x13, 0x21, 0x01, 0x88, 0xa9, 0xbf, 0xac,
+0xba, 0xbb, 0xba, 0xbc, 0x99, 0x99, 0x88, 0x12, 0x20, 0x44, 0x32, 0x43, 0x12, 0x52, 0x34, 0x34,
+0x44, 0x43, 0x24, 0x12, 0x11, 0x10, 0x21, 0xb0, 0xff, 0xba, 0xcb, 0xca, 0xaa, 0xab, 0x8a, 0x88,
+0x00, 0x11, 0x42, 0x35, 0x43, 0x33, 0x33, 0x53, 0x44, 0x43, 0x12, 0x11, 0x01, 0x80, 0xba, 0xad,
+0xbc, 0xad, 0x9a, 0xcb, 0xaa, 0xca, 0xad, 0x99, 0xba, 0x9b, 0x00, 0x51, 0x35, 0x43, 0x53, 0x13,
+0x12, 0x01, 0xa9, 0x9a, 0x18, 0x43, 0x32, 0x43, 0x23, 0x20, 0x25, 0xa0, 0xab, 0xed, 0xcd, 0xaa,
+0xba, 0x9b, 0xaa, 0xbd, 0x9a, 0xa9, 0x20, 0x33, 0x63, 0x44, 0x43, 0x35, 0x33, 0x22, 0x81, 0x98,
+0x99, 0xeb, 0xaa, 0xaa, 0x89, 0x91, 0xeb, 0x9a, 0x08, 0x20, 0x44, 0x33, 0x22, 0xb8, 0xbf, 0xcc,
+0xab, 0x9a, 0x99, 0x89, 0x21, 0x43, 0x45, 0x14, 0x12, 0x11, 0x80, 0x90, 0xce, 0x9c, 0x00, 0x11,
+0x63, 0x34, 0x42, 0x22, 0x22, 0x12, 0x90, 0xdc, 0xbd, 0xcc, 0xaa, 0xbb, 0xbb, 0x8a, 0x88, 0x31,
+0x34, 0x43, 0x45, 0x24, 0x22, 0x21, 0x21, 0x12, 0x81, 0x9a, 0x98, 0xb9, 0xbd, 0xdd, 0xab, 0x99,
+0xca, 0x09, 0x21, 0x42, 0x25, 0xa9, 0x8a, 0xb9, 0x9d, 0x01, 0xcb, 0x9b, 0x41, 0x46, 0x23, 0x22,
+0x13, 0x90, 0x89, 0xfb, 0xbb, 0xba, 0xbe, 0x9b, 0x00, 0x31, 0x63, 0x34, 0x35, 0x22, 0x31, 0x22,
+0x81, 0xab, 0xda, 0xde, 0xcb, 0xbb, 0xac, 0x99, 0x88, 0x21, 0x32, 0x46, 0x34, 0x32, 0x23, 0x12,
+0x98, 0xa8, 0xba, 0xcc, 0xdb, 0x99, 0x9a, 0x99, 0x98, 0x1a, 0x55, 0x12, 0x80, 0x80, 0xb9, 0x9b,
+0x08, 0xfc, 0xbe, 0xaa, 0xaa, 0x9a, 0x80, 0x38, 0x57, 0x45, 0x53, 0x33, 0x33, 0x01, 0xc9, 0xbc,
+0xac, 0xbb, 0xba, 0xaa, 0x9a, 0x88, 0xa8, 0xbc, 0xab, 0x88, 0x10, 0x73, 0x54, 0x43, 0x33, 0x34,
+0x32, 0x23, 0x90, 0xcd, 0xab, 0x9a, 0x88, 0x21, 0x23, 0x24, 0x02, 0xdb, 0xbc, 0xbc, 0xbb, 0xad,
+0xbb, 0x8a, 0x88, 0x18, 0x21, 0x80, 0x31, 0x24, 0x10, 0x14, 0xa0, 0x58, 0x77, 0x34, 0x33, 0x22,
+0x33, 0x43, 0x43, 0x13, 0xa8, 0xbc, 0xce, 0xcc, 0xbb, 0xac, 0xab, 0xaa, 0x09, 0x20, 0x32, 0x23,
+0x22, 0x32, 0x45, 0x35, 0x34, 0x43, 0x22, 0x22, 0x81, 0xaa, 0xbb, 0xbf, 0x0a, 0x11, 0x21, 0x34,
+0x43, 0x25, 0x92, 0xba, 0xcd, 0xcd, 0xcb, 0xcb, 0x9a, 0x98, 0x00, 0x10, 0x21, 0x24, 0x12, 0x12,
+0x11, 0x44, 0x45, 0x34, 0x24, 0x22, 0x32, 0x33, 0x22, 0xa8, 0xcd, 0xcb, 0xbd, 0xbc, 0xcb, 0xaa,
+0xab, 0xac, 0x99, 0x88, 0x00, 0x43, 0x53, 0x34, 0x34, 0x33, 0x34, 0x22, 0x11, 0x00, 0x88, 0x99,
+0xbb, 0xbc, 0xba, 0xdb, 0xaa, 0x8a, 0x00, 0xc9, 0xbd, 0xab, 0xbc, 0xdb, 0xcc, 0x9b, 0x99, 0xbb,
+0x09, 0x53, 0x45, 0x53, 0x33, 0x35, 0x24, 0x02, 0x00, 0x88, 0xb9, 0xbd, 0xcb, 0xdb, 0xcb, 0xab,
+0x9a, 0x08, 0x11, 0x52, 0x44, 0x43, 0x33, 0x13, 0x12, 0x11, 0xa8, 0xba, 0xce, 0xbd, 0xbb, 0xcb,
+0xaa, 0x89, 0x10, 0x24, 0x23, 0x32, 0x53, 0x54, 0x23, 0x22, 0x12, 0x90, 0xcb, 0xab, 0xaa, 0xca,
+0xdb, 0xab, 0x19, 0x12, 0xb8, 0xae, 0x9a, 0xbb, 0x9c, 0x30, 0x35, 0x22, 0x10, 0x32, 0x56, 0x34,
+0x24, 0x22, 0x80, 0x80, 0xb9, 0xbc, 0xcc, 0xbc, 0x98, 0x98, 0x30, 0x13, 0x99, 0xd9, 0xad, 0x30,
+0x84, 0xaa, 0x98, 0xa9, 0xfa, 0xce, 0x8a, 0x31, 0x43, 0x02, 0x99, 0x10, 0x00, 0x21, 0x31, 0x77,
+0x45, 0x43, 0x22, 0x88, 0x99, 0xa9, 0xa9, 0xec, 0xac, 0xaa, 0xba, 0xab, 0xba, 0x8c, 0x08, 0x9a,
+0x09, 0x10, 0x52, 0x45, 0x44, 0x35, 0x33, 0x23, 0x21, 0x42, 0x02, 0x01, 0x00, 0x01, 0xb0, 0xdf,
+0xdb, 0xdb, 0xab, 0xbb, 0xbc, 0xaa, 0x8a, 0x21, 0x34, 0x33, 0x34, 0x13, 0x22, 0x35, 0x44, 0x43,
+0x22, 0x32, 0x43, 0x33, 0x91, 0xcc, 0xbb, 0xab, 0xbd, 0xcc, 0xbb, 0xbb, 0xac, 0x9a, 0xba, 0xab,
+0x19, 0x00, 0x72, 0x36, 0x24, 0x33, 0x33, 0x43, 0x33, 0x80, 0xa8, 0xdb, 0x9b, 0x98, 0xbc, 0x9b,
+0x99, 0x8a, 0x80, 0x89, 0x40, 0x45, 0x02, 0xda, 0xcb, 0xab, 0xcc, 0xcc, 0xaa, 0x08, 0x41, 0x34,
+0x21, 0x42, 0x33, 0x42, 0x25, 0x21, 0x11, 0xca, 0xab, 0xca, 0xab, 0xbb, 0x9d, 0x62, 0x24, 0x12,
+0xa8, 0x9a, 0x01, 0xed, 0xbc, 0xbb, 0x8a, 0x88, 0x99, 0x18, 0x22, 0x75, 0x34, 0x32, 0x43, 0x32,
+0x32, 0x13, 0x80, 0x11, 0xe9, 0xdc, 0xbc, 0xbb, 0xcb, 0xba, 0xa9, 0x88, 0x11, 0x33, 0x44, 0x02,
+0x9a, 0x20, 0x33, 0x44, 0x33, 0x52, 0x43, 0x12, 0x22, 0x90, 0x28, 0x26, 0x31, 0x37, 0x03, 0x99,
+0xec, 0xac, 0xbc, 0xcb, 0x8a, 0x9a, 0x8a, 0x10, 0x21, 0x44, 0x23, 0x44, 0x02, 0x80, 0x88, 0xba,
+0xba, 0x9a, 0x64, 0x33, 0x22, 0x80, 0x29, 0x67, 0x32, 0x34, 0x43, 0x12, 0x98, 0xcc, 0xcd, 0xdb,
+0xba, 0xaa, 0x9a, 0x88, 0x00, 0x22, 0x24, 0x22, 0x43, 0x32, 0x63, 0x43, 0x33, 0x23, 0x32, 0x43,
+0x33, 0x81, 0xda, 0xcd, 0xbc, 0xad, 0xaa, 0x98, 0x88, 0x98, 0x99, 0x18, 0x12, 0x00, 0x80, 0x9a,
+0x74, 0x44, 0x33, 0x33, 0x11, 0x31, 0x81, 0xdc, 0xcc, 0xcb, 0xaa, 0x09, 0x31, 0x44, 0x33, 0x42,
+0x23, 0x33, 0x25, 0x91, 0xbb, 0xdc, 0xdb, 0xba, 0xcb, 0xab, 0x9b, 0x8a, 0x00, 0x08, 0x34, 0x35,
+0x35, 0x12, 0x30, 0x23, 0x00, 0x43, 0x91, 0x89, 0x88, 0x30, 0x37, 0x81, 0x21, 0x23, 0x31, 0x13,
+0x10, 0x14, 0xfa, 0xdb, 0xdf, 0xcc, 0xbb, 0xaa, 0x8a, 0x09, 0x00, 0x32, 0x34, 0x32, 0x33, 0x35,
+0x63, 0x44, 0x02, 0x11, 0x33, 0x35, 0x34, 0x81, 0x99, 0xb9, 0xbe, 0xaa, 0xcc, 0xbb, 0xcb, 0xbc,
+0xaa, 0xaa, 0x8a, 0xa9, 0x89, 0x31, 0x53, 0x46, 0x34, 0x24, 0x23, 0x22, 0x23, 0x02, 0x98, 0x08,
+0xba, 0x9d, 0x88, 0xca, 0xbb, 0xcc, 0x0a, 0x22, 0x01, 0x44, 0x03, 0xba, 0xee, 0xbc, 0xbb, 0xba,
+0xab, 0xa9, 0x89, 0x62, 0x43, 0x31, 0x33, 0x23, 0x11, 0x90, 0xab, 0x73, 0x37, 0x42, 0x34, 0x43,
+0x43, 0x23, 0x01, 0x98, 0xcb, 0xdd, 0xcb, 0xcb, 0xbb, 0xbb, 0xba, 0x9a, 0x88, 0x09, 0x21, 0x53,
+0x55, 0x43, 0x43, 0x32, 0x32, 0x12, 0x11, 0x11, 0x00, 0x99, 0xcc, 0xac, 0xbb, 0xbe, 0xba, 0xbb,
+0x8a, 0x88, 0x08, 0x21, 0x98, 0x8a, 0xa8, 0xaa, 0x31, 0x67, 0x32, 0x43, 0x34, 0x33, 0x24, 0x91,
+0xaa, 0xbb, 0xcd, 0xdd, 0xab, 0xa9, 0xba, 0x38, 0x36, 0x42, 0x35, 0x24, 0x43, 0x33, 0x10, 0x08,
+0xb8, 0xcd, 0xbd, 0xbd, 0x9b, 0xaa, 0xaa, 0x89, 0x10, 0x22, 0x43, 0x34, 0x44, 0x43, 0x12, 0x00,
+0x01, 0x99, 0x19, 0x01, 0x00, 0x41, 0x44, 0x23, 0x11, 0x22, 0x02, 0x98, 0xfb, 0xdf, 0xba, 0xcc,
+0xbb, 0xaa, 0xac, 0x8a, 0x10, 0x31, 0x46, 0x32, 0x53, 0x43, 0x12, 0x23, 0x23, 0x80, 0x88, 0x98,
+0xdc, 0xcc, 0xba, 0xab, 0xa9, 0xbc, 0x9b, 0x08, 0x20, 0x12, 0x89, 0x41, 0x92, 0xa9, 0xa9, 0x2b,
+0x77, 0x22, 0x34, 0x22, 0x53, 0x36, 0x22, 0x53, 0x22, 0x81, 0xca, 0xdc, 0xbb, 0xad, 0xaa, 0xab,
+0x9a, 0x98, 0x08, 0x21, 0x00, 0x41, 0x33, 0x42, 0x35, 0x42, 0x54, 0x33, 0x53, 0x23, 0x99, 0x0a,
+0xa9, 0xcc, 0xba, 0xab, 0x20, 0x45, 0x23, 0x00, 0x89, 0xda, 0xce, 0xcc, 0xba, 0x9a, 0x88, 0x10,
+0x32, 0x53, 0x24, 0x80, 0x10, 0x01, 0x89, 0x44, 0x35, 0x35, 0x23, 0x32, 0x12, 0x88, 0x98, 0xdc,
+0xbb, 0xdb, 0xbc, 0xba, 0xdb, 0xac, 0xac, 0x9b, 0x88, 0x10, 0x33, 0x33, 0x43, 0x53, 0x44, 0x43,
+0x22, 0x32, 0x22, 0x12, 0x88, 0x11, 0x91, 0xbc, 0xcd, 0x9a, 0x18, 0x99, 0x89, 0xd9, 0xcd, 0xba,
+0xcc, 0xbc, 0xbe, 0x9b, 0x89, 0x10, 0x34, 0x43, 0x44, 0x22, 0x11, 0x88, 0x8a, 0x20, 0x53, 0x54,
+0x23, 0x22, 0x33, 0x12, 0x90, 0xec, 0xbd, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xab, 0x9b, 0x21, 0x11,
+0x40, 0x47, 0x33, 0x45, 0x33, 0x53, 0x22, 0x01, 0x88, 0x88, 0x99, 0xeb, 0xbb, 0xab, 0x9b, 0xa9,
+0xcc, 0x9a, 0xa9, 0x9a, 0x20, 0x63, 0x44, 0x02, 0x11, 0x01, 0x98, 0xba, 0xbb, 0x28, 0x25, 0x12,
+0x33, 0x81, 0x99, 0xb9, 0xef, 0xbb, 0xdb, 0xbe, 0x89, 0x32, 0x43, 0x45, 0x33, 0x43, 0x43, 0x22,
+0x81, 0xb8, 0xcb, 0xdb, 0xcd, 0xbb, 0xba, 0xca, 0xab, 0x8a, 0x08, 0x43, 0x35, 0x43, 0x44, 0x33,
+0x22, 0x11, 0x01, 0x80, 0xc9, 0xbb, 0xbc, 0xba, 0xcb, 0xcd, 0xaa, 0x9a, 0x9a, 0x40, 0x34, 0x34,
+0x43, 0x12, 0x90, 0xa9, 0xac, 0x99, 0xa9, 0x89, 0x88, 0x20, 0x47, 0x33, 0x13, 0xc9, 0xbb, 0x9a,
+0x9a, 0xba, 0xdf, 0x8a, 0x00, 0x88, 0x09, 0x51, 0x37, 0x34, 0x12, 0x22, 0x34, 0x82, 0xcc, 0xbc,
+0xbc, 0xcb, 0xbb, 0x9c, 0x9a, 0x18, 0x11, 0x53, 0x44, 0x43, 0x43, 0x22, 0x22, 0x11, 0xa0, 0xca,
+0xac, 0x89, 0xb9, 0xbb, 0xcc, 0xab, 0x18, 0x22, 0x11, 0xd9, 0xcd, 0xcb, 0x9c, 0x99, 0xa8, 0xab,
+0x19, 0x53, 0x12, 0x32, 0x46, 0x44, 0x63, 0x44, 0x43, 0x24, 0x12, 0x90, 0xcb, 0xcc, 0xbb, 0xbc,
+0xac, 0xaa, 0x99, 0x08, 0x00, 0x21, 0x12, 0x33, 0x36, 0x45, 0x43, 0x23, 0x22, 0x11, 0x22, 0x02,
+0xa8, 0xec, 0xcc, 0xaa, 0xaa, 0x09, 0x00, 0x80, 0x21, 0x21, 0x00, 0xea, 0xcd, 0xab, 0xaa, 0x08,
+0x21, 0x43, 0x35, 0x12, 0x01, 0x80, 0xa9, 0x28, 0x74, 0x44, 0x34, 0x33, 0x24, 0x00, 0xa9, 0xcc,
+0xbb, 0xbc, 0xbc, 0xcb, 0xac, 0x9a, 0x88, 0x89, 0x20, 0x32, 0x44, 0x34, 0x34, 0x24, 0x23, 0x33,
+0x02, 0x08, 0xa9, 0xbb, 0xca, 0xbf, 0x9b, 0xa8, 0xbd, 0xba, 0xab, 0x30, 0x36, 0x34, 0x33, 0x13,
+0x80, 0xba, 0xcc, 0xcd, 0xbb, 0xaa, 0x8a, 0x42, 0x32, 0x44, 0x14, 0x22, 0x33, 0x33, 0x13, 0xeb,
+0xbc, 0xcb, 0x9c, 0x09, 0x11, 0x43, 0x01, 0x99, 0x32, 0x24, 0x01, 0xa8, 0xdd, 0xac, 0xac, 0xbc,
+0xab, 0x8a, 0x20, 0x45, 0x24, 0x23, 0x34, 0x25, 0x22, 0x00, 0x80, 0x99, 0x88, 0xda, 0xbd, 0xbb,
+0xbc, 0xbb, 0x99, 0x89, 0x88, 0x30, 0x45, 0x12, 0x32, 0x15, 0xea, 0xac, 0x99, 0x88, 0x08, 0x10,
+0x53, 0x43, 0x54, 0x43, 0x33, 0x33, 0x53, 0x23, 0x82, 0xc9, 0xce, 0xbb, 0xca, 0xcc, 0xaa, 0x9a,
+0x08, 0x01, 0x11, 0x11, 0x11, 0x21, 0x42, 0x81, 0x88, 0x74, 0x33, 0x34, 0x36, 0x34, 0x23, 0x80,
+0x08, 0x81, 0x88, 0xda, 0xbe, 0xcb, 0xca, 0xbb, 0xcb, 0xab, 0xab, 0x9b, 0x10, 0x80, 0x62, 0x45,
+0x33, 0x34, 0x22, 0x32, 0x91, 0xaa, 0x89, 0x08, 0x32, 0x91, 0x59, 0x25, 0xc9, 0x19, 0x13, 0x52,
+0x04, 0xea, 0xab, 0xdb, 0xbc, 0xbb, 0xbd, 0xaa, 0xaa, 0x0a, 0x42, 0x63, 0x43, 0x22, 0x32, 0x23,
+0x41, 0x32, 0x10, 0x21, 0x02, 0x08, 0xa0, 0xcf, 0xab, 0xba, 0x9b, 0x10, 0x32, 0x13, 0xa9, 0x31,
+0xfb, 0xff, 0xab, 0xbb, 0xab, 0xaa, 0x09, 0x44, 0x33, 0x44, 0x22, 0x81, 0xa8, 0x8a, 0x51, 0x36,
+0x24, 0x21, 0x45, 0x33, 0x33, 0x81, 0xdb, 0xbc, 0xdb, 0xca, 0xcb, 0xbb, 0xaa, 0x9a, 0x88, 0x80,
+0x21, 0x22, 0x63, 0x44, 0x34, 0x25, 0x13, 0x23, 0x01, 0x89, 0x99, 0xba, 0xaa, 0xbb, 0x9c, 0xba,
+0xac, 0x99, 0xbc, 0x19, 0x93, 0xce, 0x99, 0x99, 0x8a, 0xd9, 0xcc, 0x99, 0xa8, 0x29, 0x36, 0x34,
+0x45, 0x12, 0x21, 0x22, 0x11, 0x00, 0xec, 0xac, 0xcb, 0xbb, 0x9a, 0x88, 0x21, 0x32, 0x67, 0x34,
+0x23, 0x24, 0x01, 0x00, 0x90, 0xca, 0xdc, 0xcc, 0xab, 0xba, 0xab, 0x9a, 0x88, 0x22, 0x33, 0x45,
+0x33, 0x34, 0x24, 0x00, 0x42, 0x23, 0x31, 0x32, 0x22, 0x04, 0xb8, 0xaa, 0xdb, 0x9a, 0x99, 0xcb,
+0xba, 0xdf, 0xbb, 0xcd, 0xbc, 0xa9, 0xaa, 0x8b, 0x89, 0x20, 0x55, 0x32, 0x43, 0x34, 0x53, 0x22,
+0x02, 0x12, 0x21, 0x22, 0x81, 0x99, 0xdb, 0xcc, 0xaa, 0xcc, 0xbb, 0xcb, 0xbb, 0xa9, 0xcb, 0x9a,
+0xca, 0xaa, 0x88, 0x20, 0x47, 0x32, 0x44, 0x43, 0x43, 0x23, 0x22, 0x21, 0x00, 0x00, 0xc8, 0xbc,
+0xec, 0xcb, 0xa9, 0xba, 0x9b, 0x89, 0x19, 0x32, 0x33, 0x26, 0x91, 0x18, 0x01, 0xca, 0x89, 0x21,
+0x45, 0x22, 0x34, 0x23, 0x22, 0x22, 0x30, 0x47, 0x22, 0x52, 0x82, 0xeb, 0xac, 0xba, 0xcc, 0xca,
+0xaa, 0x8a, 0x01, 0x98, 0x40, 0x36, 0x53, 0x33, 0x81, 0x89, 0xb8, 0xbe, 0x9a, 0xaa, 0xa9, 0xba,
+0x9b, 0x31, 0x24, 0x44, 0x57, 0x34, 0x35, 0x24, 0x12, 0x88, 0xca, 0xad, 0xcb, 0xcb, 0x9a, 0xa9,
+0x9a, 0x88, 0x08, 0x11, 0x80, 0x20, 0x44, 0x54, 0x43, 0x23, 0x34, 0x34, 0x23, 0x12, 0x01, 0xa0,
+0xdb, 0xba, 0xdc, 0xbb, 0xbc, 0xac, 0x9a, 0xba, 0xab, 0xac, 0x0a, 0x11, 0x31, 0x47, 0x23, 0x33,
+0x24, 0x10, 0x21, 0x10, 0x21, 0x21, 0x32, 0x82, 0xaa, 0x89, 0x72, 0x45, 0x32, 0x33, 0x01, 0x20,
+0xf9, 0xbf, 0xcb, 0xec, 0xba, 0xbb, 0xaa, 0x09, 0x20, 0x53, 0x33, 0x35, 0x23, 0x10, 0x22, 0x23,
+0x45, 0x33, 0x23, 0x32, 0x53, 0x22, 0x98, 0xeb, 0xcd, 0xba, 0xbb, 0xbb, 0xcb, 0xbb, 0xac, 0xab,
+0xaa, 0x99, 0x08, 0x42, 0x46, 0x34, 0x44, 0x43, 0x22, 0x23, 0x01, 0x08, 0x98, 0xca, 0xaa, 0xcb,
+0xac, 0x88, 0xb9, 0xac, 0x08, 0x08, 0x08, 0x90, 0x09, 0x01, 0xfb, 0xbf, 0xcb, 0xaa, 0x08, 0x10,
+0x53, 0x34, 0x53, 0x33, 0x32, 0x11, 0x01, 0xa8, 0xde, 0xba, 0x99, 0x9a, 0x89, 0x0a, 0x73, 0x24,
+0x54, 0x34, 0x23, 0x12, 0xb0, 0xcb, 0xdb, 0xbd, 0xbc, 0xbb, 0x9b, 0xaa, 0x09, 0x11, 0x32, 0x46,
+0x24, 0x22, 0x23, 0x12, 0x00, 0x00, 0x42, 0x25, 0x12, 0x02, 0xa8, 0xbb, 0xbb, 0x38, 0x46, 0x22,
+0x02, 0xdb, 0xcb, 0xcd, 0xbe, 0xbc, 0xab, 0xaa, 0x99, 0x18, 0x21, 0x53, 0x53, 0x43, 0x24, 0x23,
+0x32, 0x12, 0x20, 0x32, 0x32, 0x13, 0xb9, 0xbc, 0xed, 0xbb, 0xba, 0xdb, 0xba, 0xbb, 0x0a, 0x90,
+0xdb, 0xcb, 0xbd, 0xab, 0xaa, 0x18, 0x56, 0x53, 0x33, 0x33, 0x34, 0x23, 0x01, 0x01, 0xb9, 0xcb,
+0xdb, 0xbd, 0xba, 0xcb, 0xab, 0x9a, 0x09, 0x30, 0x53, 0x44, 0x24, 0x33, 0x02, 0x89, 0xa8, 0xdb,
+0xaa, 0xaa, 0x1a, 0x13, 0xba, 0x38, 0x47, 0x33, 0xd8, 0xac, 0xaa, 0xbb, 0x99, 0xbc, 0x1b, 0x12,
+0x99, 0x72, 0x56, 0x35, 0x33, 0x33, 0x11, 0x88, 0x98, 0xdd, 0xbc, 0xcc, 0xbb, 0xbb, 0xab, 0x20,
+0x12, 0x32, 0x44, 0x44, 0x44, 0x22, 0x22, 0x01, 0x01, 0x88, 0xa9, 0x9a, 0xbc, 0xbc, 0xcb, 0xac,
+0x88, 0xa9, 0x8a, 0xa9, 0xbf, 0xac, 0xbc, 0xac, 0x99, 0x09, 0x52, 0x35, 0x32, 0x32, 0x54, 0x44,
+0x43, 0x13, 0x12, 0x22, 0x02, 0xb8, 0xcf, 0xbc, 0xbc, 0xbb, 0xba, 0xba, 0x9a, 0x09, 0x20, 0x24,
+0x22, 0x44, 0x43, 0x32, 0x63, 0x33, 0x24, 0x22, 0x32, 0x11, 0xa8, 0xde, 0xcb, 0x9a, 0x89, 0x20,
+0x42, 0x34, 0x33, 0x10, 0xb8, 0xde, 0xbd, 0xbc, 0xab, 0x89, 0x00, 0x22, 0x43, 0x43, 0x12, 0x80,
+0x80, 0x00, 0x42, 0x56, 0x33, 0x24, 0x33, 0x23, 0x12, 0xb0, 0xcd, 0xcc, 0xcb, 0xab, 0xcb, 0xba,
+0xba, 0x9b, 0x88, 0x99, 0x28, 0x34, 0x44, 0x35, 0x43, 0x53, 0x33, 0x33, 0x14, 0x11, 0x01, 0xa9,
+0xba, 0xcc, 0xba, 0xdd, 0xac, 0xaa, 0xaa, 0x8a, 0xa8, 0x18, 0x36, 0x24, 0x33, 0x81, 0x88, 0x90,
+0xbb, 0xaa, 0x9a, 0x41, 0x45, 0x24, 0x12, 0x42, 0x34, 0x13, 0x98, 0x89, 0xa8, 0xcd, 0xbb, 0xcc,
+0xab, 0xaa, 0xcb, 0xbb, 0xbb, 0x08, 0xda, 0x0b, 0x33, 0x63, 0x46, 0x12, 0x10, 0x01, 0x08, 0x53,
+0x22, 0x63, 0x34, 0x33, 0x12, 0x90, 0xa9, 0xeb, 0xdc, 0xbc, 0xcb, 0xcb, 0x9a, 0x9a, 0x8a, 0x10,
+0x43, 0x45, 0x33, 0x23, 0x23, 0x42, 0x22, 0x88, 0x08, 0x90, 0xab, 0xcc, 0xdc, 0xbc, 0xaa, 0xca,
+0xac, 0x08, 0x33, 0x47, 0x33, 0x24, 0x21, 0x00, 0xa8, 0xdb, 0xcb, 0xab, 0xaa, 0x88, 0x09, 0x98,
+0xda, 0x99, 0x89, 0x00, 0x90, 0x58, 0x47, 0x21, 0x52, 0x13, 0x10, 0x01, 0xd9, 0xba, 0xcc, 0xab,
+0x21, 0x43, 0x44, 0x24, 0x12, 0x10, 0x21, 0x91, 0xdc, 0xbc, 0xbc, 0xaa, 0xba, 0xaa, 0xab, 0xba,
+0xaa, 0xcb, 0x8a, 0x20, 0x64, 0x56, 0x34, 0x22, 0x22, 0x22, 0x42, 0x44, 0x13, 0x88, 0xba, 0xcd,
+0xbb, 0xbc, 0xbc, 0xbb, 0x9c, 0x99, 0x89, 0x18, 0x21, 0x34, 0x34, 0x44, 0x22, 0x12, 0x20, 0x22,
+0x22, 0x00, 0x11, 0x12, 0x80, 0x9a, 0x30, 0x82, 0x70, 0x67, 0x01, 0x89, 0xba, 0xbd, 0xcc, 0xbe,
+0xbb, 0xab, 0x89, 0x08, 0x20, 0x52, 0x44, 0x43, 0x32, 0x32, 0x33, 0x33, 0x01, 0xa9, 0xa9, 0x88,
+0x80, 0xe9, 0xdb, 0xbb, 0xab, 0xcb, 0xac, 0x9a, 0xda, 0xbc, 0xbb, 0xcd, 0xab, 0x9b, 0x32, 0x35,
+0x53, 0x34, 0x34, 0x34, 0x23, 0x22, 0x32, 0x22, 0x12, 0xa9, 0xdd, 0xdb, 0xcc, 0xab, 0xbb, 0xbb,
+0x9a, 0xa9, 0x9a, 0x89, 0x73, 0x34, 0x12, 0x34, 0x03, 0x09, 0x22, 0x31, 0x47, 0x13, 0x21, 0x33,
+0x43, 0x13, 0xcc, 0x99, 0xea, 0xac, 0xcb, 0xcc, 0x99, 0x99, 0x99, 0x88, 0x20, 0x33, 0x53, 0x45,
+0x23, 0x43, 0x32, 0x01, 0x80, 0x99, 0xc9, 0xcc, 0xbb, 0xfb, 0xab, 0xa9, 0xbb, 0x0b, 0x52, 0x54,
+0x34, 0x25, 0x23, 0x11, 0x98, 0xb9, 0xbd, 0xbc, 0xbb, 0x99, 0x80, 0x00, 0x01, 0x11, 0x01, 0x98,
+0xab, 0xbc, 0x9a, 0x31, 0x45, 0x44, 0x14, 0x00, 0xa8, 0xca, 0xbb, 0xcc, 0x0a, 0x53, 0x75, 0x54,
+0x33, 0x12, 0x01, 0xa8, 0xca, 0xbe, 0xcc, 0xaa, 0x99, 0x99, 0x88, 0x18, 0x00, 0x01, 0x00, 0x10,
+0x54, 0x44, 0x44, 0x22, 0x23, 0x22, 0x11, 0x11, 0x80, 0x99, 0xdb, 0xcc, 0xac, 0x9a, 0xcb, 0xbd,
+0xbb, 0xaa, 0x8a, 0x99, 0x89, 0x28, 0x53, 0x44, 0x43, 0x32, 0x32, 0x52, 0x34, 0x11, 0x31, 0x35,
+0x33, 0x02, 0xb8, 0xcb, 0xca, 0xdb, 0xbc, 0xcc, 0xba, 0xaa, 0x9a, 0xa9, 0xdb, 0x9a, 0x18, 0x42,
+0x35, 0x33, 0x54, 0x33, 0x31, 0x22, 0x02, 0x10, 0xa0, 0xcd, 0xbc, 0x9a, 0x88, 0x98, 0xbc, 0xac,
+0x48, 0x44, 0x23, 0x01, 0x00, 0x32, 0xa0, 0xcb, 0xdd, 0xbc, 0xab, 0xaa, 0xa9, 0x8a, 0x42, 0x25,
+0x11, 0x23, 0x23, 0x34, 0xb8, 0x8c, 0x42, 0x42, 0x46, 0x24, 0x22, 0x11, 0x31, 0x03, 0xda, 0xdb,
+0xcd, 0xac, 0xba, 0xba, 0xba, 0xaa, 0x19, 0x32, 0x23, 0x45, 0x43, 0x34, 0x44, 0x32, 0x22, 0x13,
+0x81, 0xa9, 0xaa, 0xba, 0xbd, 0xbb, 0xce, 0x9a, 0x89, 0x08, 0x22, 0xa8, 0x9a, 0x00, 0x98, 0xfa,
+0xcf, 0xba, 0x89, 0x88, 0x08, 0x63, 0x24, 0x63, 0x53, 0x22, 0x11, 0x11, 0x10, 0xa8, 0xca, 0xdb,
+0xcc, 0xab, 0xdb, 0xaa, 0x89, 0x08, 0x42, 0x33, 0x44, 0x22, 0x33, 0x02, 0x98, 0xba, 0xad, 0x89,
+0x98, 0xaa, 0xbc, 0x18, 0xc8, 0xad, 0x20, 0x44, 0x45, 0x34, 0x12, 0x01, 0x98, 0xca, 0xbc, 0xca,
+0xdb, 0x9a, 0x08, 0x21, 0x32, 0x52, 0x44, 0x11, 0x81, 0xc9, 0xbd, 0xbb, 0xbc, 0xab, 0xaa, 0x9a,
+0x89, 0x28, 0x63, 0x42, 0x56, 0x45, 0x43, 0x33, 0x23, 0x01, 0xb9, 0xdc, 0xcc, 0xba, 0xab, 0xaa,
+0x9a, 0x99, 0x09, 0x00, 0x00, 0x41, 0x34, 0x45, 0x43, 0x22, 0x33, 0x24, 0x12, 0x02, 0xb9, 0xeb,
+0xbb, 0xaa, 0xaa, 0x18, 0x34, 0x11, 0x31, 0x43, 0x02, 0xfa, 0xce, 0xbc, 0xaa, 0x9a, 0x99, 0x10,
+0x22, 0x33, 0x02, 0x08, 0x80, 0x60, 0x47, 0x34, 0x43, 0x33, 0x11, 0x10, 0x80, 0xb8, 0xdb, 0xbd,
+0xcb, 0xab, 0xaa, 0xbc, 0xab, 0xaa, 0xaa, 0x80, 0x10, 0x64, 0x23, 0x33, 0x44, 0x42, 0x43, 0x22,
+0x11, 0x10, 0xa8, 0xbb, 0xdd, 0xcd, 0xab, 0x99, 0x89, 0x40, 0x44, 0x24, 0x22, 0x43, 0x13, 0x01,
+0xb9, 0xbe, 0xbc, 0xcb, 0xab, 0xba, 0xaa, 0x08, 0x00, 0x43, 0x32, 0x42, 0x25, 0x12, 0x11, 0x01,
+0x73, 0x34, 0x22, 0x00, 0x00, 0x10, 0x12, 0x12, 0xa0, 0xfc, 0xcb, 0xaa, 0xba, 0xcc, 0xbd, 0xbc,
+0xba, 0xaa, 0x89, 0x00, 0x41, 0x35, 0x44, 0x33, 0x33, 0x53, 0x22, 0x11, 0x81, 0x88, 0x00, 0x08,
+0x12, 0xa9, 0x89, 0xed, 0xab, 0xa8, 0xca, 0xdc, 0xce, 0xaa, 0xba, 0xaa, 0xca, 0x9a, 0x20, 0x31,
+0x37, 0x34, 0x53, 0x24, 0x23, 0x24, 0x22, 0x11, 0x90, 0xaa, 0xec, 0xbc, 0x9a, 0xca, 0x99, 0x98,
+0x9a, 0x00, 0x80, 0xaa, 0xbc, 0x8b, 0x10, 0x00, 0x00, 0x21, 0x77, 0x34, 0x24, 0x23, 0x53, 0x53,
+0x12, 0x21, 0x22, 0x00, 0xca, 0xde, 0xcb, 0xbb, 0xbb, 0xba, 0xab, 0x19, 0x43, 0x33, 0x45, 0x43,
+0x23, 0x22, 0x81, 0x89, 0x98, 0xb9, 0xac, 0xcb, 0xad, 0x99, 0xb9, 0xcd, 0xbc, 0x8a, 0x54, 0x45,
+0x44, 0x33, 0x23, 0x91, 0xba, 0xbe, 0xbc, 0xbb, 0xbb, 0xaa, 0x89, 0x10, 0x21, 0x80, 0x21, 0x43,
+0x63, 0x34, 0x34, 0x43, 0x23, 0x12, 0x12, 0xa0, 0xfb, 0xdb, 0xbb, 0xaa, 0x18, 0x44, 0x33, 0x34,
+0x22, 0x12, 0xb8, 0xdf, 0xcb, 0xab, 0xaa, 0x89, 0x09, 0x11, 0x22, 0x01, 0x09, 0x10, 0x21, 0x77,
+0x34, 0x34, 0x24, 0x11, 0x10, 0x00, 0xa8, 0xcb, 0xbd, 0xcb, 0xbb, 0xbb, 0xbc, 0xaa, 0xaa, 0x8a,
+0x10, 0x10, 0x56, 0x33, 0x32, 0x35, 0x43, 0x32, 0x12, 0x01, 0x10, 0x90, 0xfb, 0xbb, 0xba, 0xcd,
+0xab, 0xab, 0x8a, 0x31, 0x45, 0x34, 0x33, 0x23, 0x80, 0xab, 0xcb, 0xbd, 0xab, 0xcb, 0xac, 0x8a,
+0x08, 0x32, 0x43, 0x32, 0x43, 0x35, 0x34, 0x82, 0xaa, 0x8a, 0x98, 0x38, 0x57, 0x32, 0x21, 0x13,
+0xb0, 0xdd, 0xba, 0xba, 0xcc, 0xcb, 0xac, 0x99, 0x9a, 0x9a, 0x9a, 0x40, 0x36, 0x44, 0x23, 0x43,
+0x33, 0x22, 0x32, 0x23, 0xc8, 0xcb, 0xcb, 0xaa, 0xaa, 0xdb, 0xbb, 0x9b, 0xb8, 0xcc, 0x9a, 0xaa,
+0x1a, 0x34, 0xd8, 0xae, 0x9a, 0x89, 0x20, 0x56, 0x33, 0x33, 0x34, 0x43, 0x34, 0x34, 0x12, 0x81,
+0xa8, 0xdb, 0xcd, 0xdb, 0xbb, 0xab, 0xaa, 0x09, 0x10, 0x40, 0x35, 0x23, 0x22, 0x90, 0x9a, 0x80,
+0xeb, 0x09, 0x31, 0x53, 0x02, 0xbb, 0x19, 0x01, 0x42, 0x03, 0x59, 0x67, 0x32, 0x32, 0x81, 0x89,
+0x80, 0xed, 0xac, 0xab, 0x89, 0x80, 0xa9, 0x18, 0x21, 0x81, 0xb9, 0x9c, 0xb9, 0xbe, 0xac, 0xbb,
+0x48, 0x24, 0x22, 0x23, 0x90, 0x61, 0x56, 0x45, 0x34, 0x33, 0x23, 0x01, 0x98, 0xdb, 0xcc, 0xcc,
+0xbb, 0xcb, 0xab, 0x9a, 0x88, 0x21, 0x12, 0x32, 0x33, 0x53, 0x44, 0x43, 0x43, 0x22, 0x22, 0x32,
+0x43, 0x33, 0x81, 0xca, 0xcd, 0xbb, 0xbd, 0xbb, 0xaa, 0xcb, 0x9a, 0x10, 0x80, 0xab, 0xa9, 0xba,
+0x60, 0x33, 0x53, 0x37, 0x33, 0x45, 0x12, 0x10, 0x01, 0xa8, 0xaa, 0xdc, 0xaa, 0xda, 0xab, 0xa9,
+0xbb, 0x09, 0x01, 0x72, 0x26, 0x12, 0x32, 0x02, 0x10, 0x91, 0xab, 0x18, 0xc8, 0xeb, 0xcd, 0x9b,
+0x08, 0x00, 0x08, 0x99, 0x89, 0x01, 0x99, 0x20, 0x36, 0x46, 0x43, 0x22, 0x33, 0x22, 0x53, 0x02,
+0xb9, 0xcc, 0xcc, 0xcb, 0xca, 0xba, 0xab, 0x8b, 0x31, 0x12, 0x31, 0x34, 0x63, 0x45, 0x32, 0x22,
+0x12, 0x10, 0x90, 0xcc, 0xac, 0xaa, 0x89, 0x98, 0x9a, 0x32, 0x90, 0x1a, 0x82, 0xdd, 0x99, 0xec,
+0x9c, 0x89, 0xb9, 0x9a, 0x99, 0x31, 0x14, 0x50, 0x57, 0x33, 0x34, 0x23, 0x32, 0x24, 0x01, 0xca,
+0xcd, 0xac, 0xbb, 0x9a, 0x99, 0xaa, 0x99, 0x20, 0x43, 0x12, 0x00, 0x01, 0x90, 0x9b, 0x31, 0x53,
+0x55, 0x22, 0x98, 0x88, 0xa9, 0xcc, 0xcd, 0x8b, 0x30, 0x56, 0x45, 0x43, 0x42, 0x11, 0x88, 0xa9,
+0xcb, 0xbb, 0xba, 0xcb, 0xbb, 0xbb, 0xcd, 0x9a, 0xa9, 0xbb, 0x9b, 0xbc, 0x0b, 0x31, 0x55, 0x55,
+0x22, 0x33, 0x25, 0x43, 0x53, 0x33, 0x32, 0x01, 0x99, 0xcb, 0xce, 0xdb, 0xbb, 0xbb, 0xbb, 0xa9,
+0x99, 0x18, 0x21, 0x33, 0x36, 0x24, 0x44, 0x32, 0x32, 0x33, 0x33, 0x24, 0x11, 0x82, 0xcc, 0xac,
+0xdb, 0xcb, 0xaa, 0x99, 0x10, 0x22, 0x44, 0x33, 0x01, 0xb8, 0xde, 0xbb, 0xba, 0x9a, 0x08, 0x21,
+0x44, 0x22, 0x11, 0x91, 0xbc, 0x89, 0xa8, 0x71, 0x47, 0x23, 0x23, 0x12, 0x21, 0x21, 0x90, 0xdb,
+0xbd, 0xbd, 0xcb, 0xcb, 0xaa, 0x99, 0xa9, 0x89, 0x10, 0x22, 0x34, 0x43, 0x54, 0x44, 0x32, 0x32,
+0x23, 0x11, 0x81, 0xca, 0xbc, 0xab, 0xa9, 0xdb, 0xcb, 0xbc, 0xac, 0x9a, 0xa9, 0x89, 0x00, 0x62,
+0x44, 0x32, 0x22, 0x22, 0x11, 0x90, 0x99, 0xcc, 0x9b, 0x18, 0x32, 0x36, 0x33, 0x33, 0xb8, 0x9c,
+0xc8, 0xaf, 0x18, 0xb9, 0x9d, 0x08, 0x89, 0x10, 0xd9, 0xab, 0x41, 0x44, 0x01, 0x00, 0x23, 0xb8,
+0xbb, 0xec, 0xab, 0xc9, 0xce, 0x8a, 0x99, 0x08, 0x73, 0x34, 0x36, 0x33, 0x24, 0x22, 0x02, 0xc8,
+0xcc, 0xbb, 0xbc, 0xa9, 0xaa, 0xab, 0xa9, 0x9c, 0x19, 0x88, 0x20, 0x33, 0x63, 0x34, 0x33, 0x45,
+0x13, 0x22, 0x80, 0xba, 0xbb, 0x9b, 0x74, 0x24, 0x33, 0x25, 0x43, 0x43, 0x11, 0xa9, 0xde, 0xcb,
+0xba, 0xcb, 0xaa, 0x9a, 0x09, 0x00, 0x00, 0x21, 0x21, 0x45, 0x22, 0x32, 0x34, 0x43, 0x45, 0x22,
+0x33, 0x23, 0x42, 0x43, 0x22, 0x80, 0xca, 0xbc, 0xbc, 0xdd, 0xbc, 0xad, 0xaa, 0xaa, 0x88, 0x00,
+0x21, 0x43, 0x12, 0x22, 0x22, 0x53, 0x45, 0x32, 0x42, 0x33, 0x33, 0x33, 0x12, 0xa9, 0xcc, 0xba,
+0xdb, 0xcc, 0xab, 0xbc, 0xbb, 0xba, 0xbc, 0xbb, 0xba, 0x89, 0x00, 0x52, 0x57, 0x33, 0x33, 0x24,
+0x12, 0x12, 0x98, 0x9a, 0xa9, 0xab, 0xdb, 0xbd, 0x8a, 0x11, 0x81, 0xca, 0x8a, 0x64, 0x34, 0x24,
+0x12, 0xa9, 0xbc, 0xcc, 0xcb, 0xab, 0xaa, 0x8a, 0x08, 0x31, 0x24, 0x44, 0x24, 0x13, 0x00, 0xb9,
+0xac, 0x88, 0x73, 0x25, 0x01, 0x22, 0x11, 0x72, 0x14, 0x98, 0x9a, 0xda, 0xbb, 0xcb, 0xcd, 0xaa,
+0x99, 0x88, 0x00, 0x10, 0x21, 0x44, 0x34, 0x34, 0x53, 0x22, 0x12, 0x02, 0xa8, 0xab, 0xcb, 0xbd,
+0x89, 0x98, 0xbb, 0xab, 0x19, 0x44, 0x82, 0x89, 0xb8, 0xae, 0x21, 0xd0, 0xbc, 0xca, 0xbd, 0x9a,
+0x89, 0x52, 0x44, 0x43, 0x44, 0x23, 0x23, 0x11, 0x11, 0xa8, 0xcc, 0xdb, 0xcc, 0xaa, 0xaa, 0xaa,
+0x89, 0x88, 0x20, 0x33, 0x32, 0x36, 0x23, 0x32, 0x13, 0x80, 0x51, 0x35, 0x03, 0x98, 0x99, 0xeb,
+0x1a, 0x22, 0x80, 0x64, 0x23, 0x32, 0x83, 0xee, 0xbc, 0xcb, 0x9a, 0x99, 0x99, 0x10, 0x44, 0x33,
+0x43, 0x33, 0x32, 0x32, 0xa1, 0xcc, 0xbb, 0xdd, 0xbc, 0xac, 0xba, 0xac, 0x08, 0x12, 0x30, 0x55,
+0x45, 0x45, 0x33, 0x23, 0x80, 0xb9, 0xbc, 0xbd, 0xbb, 0xac, 0xaa, 0x99, 0x99, 0x98, 0xaa, 0x89,
+0x98, 0x28, 0x57, 0x34, 0x34, 0x23, 0x23, 0x24, 0x12, 0x01, 0x90, 0x18, 0x23, 0xb9, 0xbc, 0xce,
+0xad, 0xac, 0xcc, 0xba, 0xaa, 0xa9, 0x08, 0x20, 0x53, 0x34, 0x43, 0x32, 0x22, 0x22, 0x00, 0x00,
+0x00, 0x18, 0x42, 0x01, 0x98, 0xdd, 0xab, 0xb9, 0xbc, 0x09, 0x81, 0x10, 0x13, 0xda, 0xbc, 0x89,
+0x01, 0x99, 0x73, 0x82, 0x89, 0x81, 0xcc, 0x09, 0xc0, 0xad, 0xab, 0xbc, 0xca, 0xbc, 0x0a, 0x53,
+0x54, 0x34, 0x34, 0x44, 0x24, 0x23, 0x11, 0x98, 0xcb, 0xbd, 0xbb, 0xcc, 0xbb, 0xac, 0x9b, 0x99,
+0x88, 0x21, 0x43, 0x44, 0x33, 0x34, 0x22, 0x22, 0x90, 0x09, 0x32, 0x44, 0x35, 0x02, 0x89, 0x80,
+0x89, 0xb8, 0xef, 0xaa, 0xda, 0xbb, 0xaa, 0xbb, 0xab, 0xa9, 0x8b, 0x31, 0x37, 0x34, 0x36, 0x43,
+0x22, 0x24, 0x22, 0x32, 0x81, 0xaa, 0xdb, 0xcc, 0xaa, 0xbb, 0x9b, 0xaa, 0xac, 0x98, 0xb9, 0xba,
+0xca, 0x8b, 0x52, 0x43, 0x12, 0xa8, 0x30, 0x25, 0x42, 0x26, 0x12, 0x55, 0x25, 0x23, 0x34, 0x01,
+0x89, 0xca, 0xbe, 0xbc, 0xcb, 0xab, 0xbb, 0x9a, 0x20, 0x33, 0x55, 0x33, 0x33, 0x33, 0x02, 0x88,
+0xcb, 0xbb, 0x89, 0x11, 0x81, 0xea, 0xcd, 0xab, 0x8a, 0x01, 0x98, 0x0b, 0x76, 0x44, 0x53, 0x23,
+0x01, 0x98, 0xba, 0xbc, 0xcb, 0xac, 0xaa, 0xaa, 0x88, 0x98, 0x10, 0x02, 0x98, 0xa8, 0xab, 0x18,
+0x32, 0x45, 0x12, 0xaa, 0xa9, 0x9b, 0x73, 0x77, 0x32, 0x46, 0x44, 0x33, 0x23, 0x81, 0xba, 0xcd,
+0xbd, 0xac, 0xbb, 0x9a, 0x89, 0x88, 0x18, 0x11, 0x11, 0x11, 0x43, 0x45, 0x43, 0x34, 0x33, 0x33,
+0x23, 0x81, 0xa8, 0xbb, 0xbd, 0x8a, 0x01, 0x01, 0x00, 0xa9, 0x8a, 0xfc, 0xef, 0xcb, 0xbb, 0xa9,
+0x89, 0x19, 0x30, 0x43, 0x34, 0x12, 0x18, 0x51, 0x44, 0x32, 0x34, 0x33, 0x34, 0x24, 0x00, 0xa8,
+0xec, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x99, 0x99, 0x88, 0x80, 0x31, 0x36, 0x34, 0x54, 0x23, 0x43,
+0x24, 0x12, 0x12, 0x81, 0xa9, 0xda, 0xcc, 0xab, 0xbb, 0xbd, 0x99, 0x89, 0x52, 0x24, 0x43, 0x43,
+0x22, 0x22, 0xb0, 0xce, 0xba, 0xbb, 0xab, 0xba, 0x8b, 0x21, 0x32, 0x36, 0x13, 0x11, 0x33, 0x52,
+0x43, 0x12, 0x21, 0x02, 0x11, 0x24, 0x12, 0x01, 0xfb, 0x8c, 0x10, 0xb8, 0xcd, 0xbd, 0xac, 0xa9,
+0xaa, 0xa9, 0xba, 0x0a, 0x02, 0xab, 0x60, 0x35, 0x36, 0x25, 0x33, 0x23, 0x22, 0x33, 0x92, 0xcc,
+0xcc, 0xac, 0x9a, 0x00, 0x12, 0x98, 0x40, 0x14, 0xb8, 0xab, 0xdb, 0xac, 0x09, 0xa9, 0xce, 0xac,
+0xaa, 0x99, 0x21, 0x33, 0x72, 0x45, 0x34, 0x33, 0x25, 0x11, 0x00, 0xa9, 0xbb, 0xbd, 0xcb, 0xcb,
+0xbb, 0x9a, 0x98, 0x99, 0x28, 0x22, 0x10, 0x44, 0x83, 0x99, 0x89, 0x28, 0x67, 0x12, 0x10, 0x01,
+0x88, 0x31, 0xa1, 0xcd, 0x9a, 0x42, 0x46, 0x34, 0x24, 0x01, 0x11, 0xb9, 0xce, 0xbb, 0xbb, 0xaa,
+0x89, 0x99, 0x08, 0x11, 0x98, 0x89, 0xfb, 0xae, 0x99, 0xa9, 0x18, 0x42, 0x31, 0x46, 0x24, 0x22,
+0x42, 0x64, 0x24, 0x23, 0x33, 0x13, 0xa8, 0xcd, 0xbd, 0xbc, 0xbc, 0xaa, 0xaa, 0x9a, 0x88, 0x08,
+0x30, 0x34, 0x34, 0x34, 0x22, 0x35, 0x24, 0x43, 0x43, 0x12, 0x00, 0x98, 0xab, 0xdb, 0xbc, 0xbb,
+0xbc, 0x89, 0x98, 0x19, 0x23, 0x99, 0x38, 0xb0, 0xae, 0xda, 0xad, 0x28, 0x33, 0x32, 0x23, 0x42,
+0x26, 0xa8, 0xca, 0xcc, 0x8b, 0x08, 0x28, 0x46, 0x33, 0x42, 0x23, 0x52, 0x25, 0x02, 0x88, 0xca,
+0xcb, 0xbb, 0xcc, 0xcb, 0xab, 0x8a, 0x99, 0x8a, 0x01, 0x80, 0x40, 0x25, 0x13, 0x32, 0x45, 0x23,
+0x43, 0x34, 0x11, 0x31, 0x43, 0x54, 0x22, 0x80, 0x98, 0xcd, 0xbb, 0xdb, 0xbc, 0xbb, 0xcc, 0x9b,
+0x99, 0x08, 0x11, 0x23, 0x44, 0x23, 0x34, 0x24, 0x24, 0x23, 0x12, 0x22, 0x23, 0x98, 0x08, 0x03,
+0xfa, 0xbb, 0xba, 0xcb, 0xba, 0xcb, 0xcb, 0xdc, 0xcc, 0xbb, 0x9a, 0xaa, 0x9a, 0xab, 0x48, 0x37,
+0x33, 0x44, 0x43, 0x32, 0x34, 0x22, 0x11, 0x80, 0x80, 0xc9, 0xbd, 0xcb, 0xcb, 0x0a, 0x01, 0xa9,
+0xba, 0xce, 0x9a, 0xa8, 0x9a, 0x00, 0xcb, 0x68, 0x23, 0x89, 0x11, 0x01, 0x56, 0x33, 0x63, 0x33,
+0x42, 0x34, 0x81, 0x98, 0xda, 0xbb, 0xda, 0xcc, 0xbb, 0xba, 0x9a, 0x9a, 0x09, 0x53, 0x32, 0x63,
+0x32, 0x53, 0x43, 0x21, 0x01, 0x98, 0x9a, 0x89, 0xdb, 0xad, 0xbb, 0xcc, 0xab, 0x8a, 0x10, 0x63,
+0x44, 0x22, 0x42, 0x12, 0x98, 0xa9, 0xca, 0x9a, 0xa8, 0xbc, 0x00, 0x80, 0x31, 0x02, 0x18, 0x34,
+0x42, 0x24, 0xc8, 0xcd, 0xcb, 0xaa, 0xca, 0xac, 0xa9, 0xaa, 0xb9, 0xdc, 0x8a, 0x41, 0x56, 0x53,
+0x32, 0x45, 0x33, 0x23, 0x80, 0xcb, 0xdb, 0xba, 0xbb, 0xbc, 0xab, 0xba, 0x9a, 0x99, 0xba, 0x98,
+0x99, 0x28, 0x36, 0x73, 0x44, 0x33, 0x33, 0x33, 0x32, 0x24, 0x22, 0x33, 0x33, 0x23, 0xa9, 0xaa,
+0xfe, 0xbd, 0xbc, 0xbc, 0xab, 0xcb, 0x9b, 0x89, 0x89, 0x10, 0x21, 0x63, 0x33, 0x11, 0x52, 0x53,
+0x43, 0x32, 0x33, 0x24, 0x22, 0x42, 0x23, 0x91, 0xba, 0xce, 0xbc, 0xbc, 0xac, 0xaa, 0xba, 0x9b,
+0xca, 0xac, 0x89, 0x10, 0x43, 0x34, 0x54, 0x34, 0x23, 0x23, 0x01, 0x08, 0x98, 0xab, 0xca, 0xbe,
+0x9b, 0xca, 0xac, 0x88, 0x08, 0x54, 0x43, 0x32, 0x34, 0x82, 0x99, 0xa8, 0xcd, 0xbb, 0xdb, 0xbb,
+0x9b, 0x9a, 0x28, 0x33, 0x44, 0x14, 0x22, 0x33, 0x33, 0x45, 0x01, 0x18, 0x22, 0x22, 0x34, 0x93,
+0xcd, 0xbc, 0x9a, 0xba, 0xdd, 0xaa, 0xaa, 0x89, 0xa9, 0x9b, 0x08, 0x21, 0x53, 0x11, 0x52, 0x36,
+0x53, 0x44, 0x13, 0x00, 0x18, 0x10, 0x08, 0x98, 0xdc, 0xaa, 0xa9, 0x09, 0xe9, 0xcd, 0xbb, 0xba,
+0x89, 0x98, 0x28, 0x36, 0x12, 0x80, 0x98, 0x01, 0x00, 0x74, 0x14, 0x11, 0x36, 0x24, 0x34, 0x15,
+0x02, 0x91, 0xbc, 0xbc, 0xcc, 0xbb, 0xaa, 0xab, 0x99, 0x20, 0x22, 0x81, 0x10, 0x01, 0x30, 0x45,
+0x21, 0x44, 0x24, 0x53, 0x43, 0x11, 0x98, 0x88, 0xa0, 0xec, 0x9a, 0x80, 0x08, 0x30, 0x53, 0x54,
+0x24, 0x02, 0xa9, 0xcd, 0xbb, 0xbb, 0xba, 0x8a, 0x99, 0x09, 0x22, 0x81, 0xc9, 0xdd, 0xbc, 0x9b,
+0x20, 0x63, 0x45, 0x24, 0x22, 0x44, 0x24, 0x32, 0x11, 0x90, 0xca, 0xbc, 0xbc, 0xbd, 0xcb, 0x9a,
+0x9a, 0xa9, 0x99, 0x00, 0x22, 0x53, 0x34, 0x34, 0x34, 0x33, 0x32, 0x22, 0x22, 0x33, 0x22, 0xb8,
+0xce, 0xcb, 0xcc, 0xbc, 0xba, 0xab, 0x8a, 0x80, 0x31, 0x45, 0x12, 0x01, 0x81, 0x10, 0x34, 0x14,
+0x11, 0x32, 0x34, 0x12, 0x00, 0xc9, 0xdf, 0xcb, 0xaa, 0xbb, 0xbc, 0x0b, 0x63, 0x33, 0x23, 0x21,
+0x32, 0x46, 0x12, 0x88, 0x98, 0xa9, 0xa9, 0xec, 0xbc, 0x99, 0xc9, 0x9b, 0x00, 0x32, 0x34, 0x33,
+0x54, 0x44, 0x32, 0x02, 0xa9, 0x88, 0xa9, 0xdb, 0xcc, 0xaa, 0x99, 0x99, 0xa9, 0xab, 0x10, 0xa9,
+0x19, 0x02, 0x39, 0x47, 0xa0, 0x09, 0xc8, 0x8b, 0x13, 0x9b, 0x67, 0x12, 0x62, 0x36, 0x34, 0x23,
+0x13, 0x21, 0x01, 0xca, 0xce, 0xbd, 0xab, 0xba, 0xbb, 0xba, 0x8a, 0x11, 0x90, 0x89, 0x20, 0x54,
+0x45, 0x23, 0x33, 0x45, 0x24, 0x11, 0x00, 0x08, 0x08, 0xca, 0xae, 0x9a, 0x99, 0x28, 0x54, 0x43,
+0x11, 0x98, 0x88, 0xba, 0xdc, 0xcc, 0xac, 0xa9, 0x98, 0x89, 0x10, 0x11, 0x11, 0x80, 0xca, 0x29,
+0x47, 0x43, 0x34, 0x33, 0x53, 0x24, 0x23, 0x12, 0x98, 0xba, 0xcd, 0xbc, 0xbc, 0xac, 0x9a, 0xa9,
+0xaa, 0x9a, 0x89, 0x18, 0x31, 0x23, 0x64, 0x44, 0x24, 0x32, 0x21, 0x10, 0x00, 0x10, 0x21, 0x80,
+0xa9, 0xca, 0xa9, 0xee, 0xac, 0x89, 0x89, 0x20, 0x02, 0x30, 0x14, 0x98, 0xba, 0xce, 0x9b, 0xa8,
+0x89, 0x98, 0x8b, 0x76, 0x22, 0x01, 0x90, 0x9b, 0x41, 0x23, 0x00, 0x43, 0xa1, 0xbe, 0x09, 0x10,
+0x52, 0x35, 0x12, 0x98, 0x99, 0xfb, 0xae, 0x9a, 0xb9, 0xad, 0x99, 0x10, 0x11, 0x00, 0x54, 0x23,
+0x62, 0x34, 0x33, 0x25, 0x02, 0x89, 0xa9, 0xab, 0xa8, 0xde, 0xab, 0xcb, 0xbb, 0xab, 0xba, 0x9a,
+0x30, 0x44, 0x43, 0x35, 0x01, 0x00, 0x91, 0xab, 0x51, 0x22, 0x43, 0x24, 0x11, 0x11, 0x80, 0x20,
+0x80, 0x73, 0x37, 0x80, 0x88, 0xda, 0xab, 0xea, 0xbc, 0x8a, 0x98, 0x09, 0x22, 0x08, 0x00, 0xdc,
+0xab, 0xb9, 0x9b, 0x18, 0x01, 0x90, 0xdc, 0x8b, 0x51, 0x56, 0x33, 0x42, 0x45, 0x54, 0x44, 0x22,
+0x00, 0x98, 0xb9, 0xcc, 0xcc, 0xac, 0x9a, 0x9a, 0x98, 0x88, 0x00, 0x01, 0x80, 0x99, 0x40, 0x55,
+0x44, 0x33, 0x32, 0x22, 0x23, 0x22, 0x02, 0xc9, 0xab, 0xbc, 0xbd, 0xac, 0xab, 0xbb, 0xac, 0xbb,
+0xbb, 0xac, 0xbc, 0xbb, 0x8a, 0x28, 0x64, 0x44, 0x42, 0x42, 0x22, 0x22, 0x23, 0x11, 0x10, 0x01,
+0x88, 0x21, 0x01, 0xb9, 0xde, 0xbc, 0xbc, 0xbb, 0xcd, 0xbb, 0xbb, 0xab, 0x9b, 0x99, 0x0a, 0x51,
+0x34, 0x24, 0x23, 0x23, 0x44, 0x24, 0x22, 0x32, 0x44, 0x53, 0x44, 0x43, 0x22, 0x23, 0x02, 0xa0,
+0xfc, 0xcc, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa, 0x88, 0x11, 0x11, 0x32, 0x55, 0x33, 0x35, 0x34, 0x43,
+0x43, 0x32, 0x22, 0x01, 0x99, 0xa9, 0xcc, 0xbb, 0xdb, 0xac, 0xbb, 0xac, 0xaa, 0xbb, 0x09, 0x80,
+0x88, 0x12, 0x99, 0x19, 0x32, 0x57, 0x43, 0x43, 0x44, 0x22, 0x22, 0x00, 0x08, 0x90, 0xaa, 0x20,
+0x02, 0x88, 0x21, 0x01, 0xfb, 0xbf, 0xbc, 0xac, 0xaa, 0x99, 0xb9, 0xdd, 0xbb, 0x99, 0x9a, 0x89,
+0x88, 0x73, 0x27, 0x34, 0x44, 0x23, 0x33, 0x81, 0x88, 0x98, 0xbc, 0xbe, 0xbb, 0xac, 0xba, 0xbb,
+0xdb, 0xab, 0x00, 0x42, 0x54, 0x34, 0x32, 0x21, 0x00, 0x00, 0x88, 0x99, 0xba, 0xbc, 0xdc, 0xbc,
+0xca, 0xbd, 0x9b, 0x08, 0x40, 0x45, 0x34, 0x45, 0x23, 0x02, 0x80, 0xbb, 0xdb, 0xcb, 0xab, 0xaa,
+0x8a, 0x08, 0x99, 0x9a, 0xaa, 0xca, 0xba, 0x18, 0x56, 0x44, 0x53, 0x12, 0x12, 0x02, 0x10, 0x11,
+0xa0, 0x09, 0x80, 0xaa, 0x9a, 0xcb, 0xbc, 0xcc, 0xbb, 0xbe, 0xcc, 0xca, 0xbb, 0xaa, 0x9a, 0x19,
+0x42, 0x44, 0x35, 0x23, 0x21, 0x23, 0x33, 0x34, 0x23, 0x43, 0x23, 0x90, 0x99, 0xdb, 0xcd, 0xcc,
+0xbb, 0x9b, 0xaa, 0x9a, 0x9a, 0x29, 0x23, 0x00, 0x42, 0x81, 0x40, 0x24, 0x55, 0x36, 0x02, 0x01,
+0x81, 0xa9, 0xcb, 0xcb, 0xab, 0x89, 0x08, 0x80, 0xfb, 0xac, 0x8a, 0x19, 0x74, 0x24, 0x22, 0x33,
+0x11, 0x00, 0x90, 0xaa, 0xdc, 0xac, 0xbb, 0xcd, 0xab, 0xaa, 0x08, 0x44, 0x22, 0x42, 0x12, 0x12,
+0x01, 0xba, 0xcb, 0xbc, 0x8a, 0x42, 0x34, 0x34, 0x43, 0x43, 0x22, 0x22, 0x00, 0xb8, 0xde, 0xcb,
+0xcc, 0xbb, 0xca, 0xbb, 0x9c, 0x89, 0xa8, 0x89, 0x63, 0x44, 0x56, 0x33, 0x33, 0x22, 0x01, 0x98,
+0xdb, 0xbc, 0xbc, 0xbb, 0x9b, 0xaa, 0x9a, 0x9a, 0x8a, 0x80, 0x09, 0x32, 0x12, 0x74, 0x43, 0x32,
+0x34, 0x34, 0x33, 0x12, 0x42, 0x23, 0x11, 0x22, 0xa9, 0x50, 0x24, 0x12, 0xb0, 0xef, 0xcb, 0xbb,
+0xbd, 0xdb, 0xaa, 0x9a, 0x8a, 0x20, 0x11, 0x42, 0x35, 0x22, 0x43, 0x43, 0x32, 0x33, 0x33, 0x33,
+0x33, 0x80, 0x89, 0x00, 0xd9, 0xcc, 0xba, 0xbc, 0xbd, 0xcc, 0xac, 0x9b, 0x99, 0xaa, 0x18, 0x02,
+0xa9, 0x20, 0x98, 0x40, 0x15, 0xa9, 0xca, 0xcd, 0xab, 0x88, 0x19, 0x77, 0x34, 0x24, 0x34, 0x34,
+0x22, 0x22, 0x02, 0xea, 0xbc, 0xbb, 0xbd, 0xbb, 0xac, 0xab, 0x99, 0x99, 0x10, 0x11, 0x41, 0x45,
+0x32, 0x23, 0x23, 0x12, 0x22, 0x44, 0x12, 0x41, 0x33, 0x23, 0x24, 0x12, 0x98, 0xa8, 0xfb, 0xdd,
+0xbc, 0xba, 0xbb, 0xaa, 0xbc, 0xac, 0x99, 0x00, 0x31, 0x34, 0x43, 0x54, 0x43, 0x23, 0x23, 0x22,
+0x01, 0x22, 0x81, 0xa9, 0xbb, 0xad, 0x09, 0x98, 0xde, 0xcc, 0xba, 0xbb, 0xbb, 0x99, 0xa9, 0x0a,
+0x23, 0xfa, 0x9b, 0x21, 0x44, 0x34, 0x24, 0x32, 0x45, 0x46, 0x24, 0x11, 0x00, 0xa9, 0x9a, 0xca,
+0xbc, 0xac, 0xaa, 0xba, 0xcb, 0xba, 0xaa, 0x19, 0x21, 0x21, 0x34, 0x12, 0x52, 0x24, 0x53, 0x34,
+0x34, 0x24, 0x01, 0x80, 0x88, 0x98, 0xbc, 0x9a, 0x00, 0x38, 0x67, 0x43, 0x33, 0x91, 0xcd, 0xcb,
+0xcb, 0xaa, 0xaa, 0xaa, 0xba, 0x88, 0x80, 0x28, 0x24, 0xb9, 0xbb, 0xad, 0x60, 0x36, 0x44, 0x34,
+0x23, 0x54, 0x33, 0x33, 0x11, 0xa8, 0xca, 0xcd, 0xbd, 0xbb, 0xac, 0x9b, 0x9a, 0x99, 0x08, 0x20,
+0x21, 0x43, 0x53, 0x44, 0x34, 0x23, 0x22, 0x11, 0x12, 0x81, 0x01, 0xa9, 0xac, 0xca, 0xce, 0xbc,
+0xaa, 0xbb, 0x8a, 0x31, 0x35, 0x44, 0x02, 0x80, 0x89, 0xa9, 0x9b, 0xaa, 0xbd, 0x19, 0x23, 0x32,
+0x54, 0x82, 0xb9, 0xba, 0xdb, 0xcc, 0x19, 0x36, 0x24, 0x42, 0x13, 0x00, 0x22, 0x92, 0xdb, 0xab,
+0xab, 0xbc, 0xbd, 0xbb, 0xac, 0x9a, 0xcd, 0x8b, 0x10, 0x31, 0x56, 0x22, 0x42, 0x24, 0x22, 0x11,
+0x98, 0x99, 0xda, 0x9b, 0xa9, 0xad, 0x99, 0xca, 0x19, 0x03, 0xc9, 0xbc, 0x9b, 0x32, 0x03, 0x08,
+0xc8, 0x8c, 0x42, 0xa1, 0xab, 0x99, 0x9a, 0x19, 0x65, 0x45, 0x45, 0x35, 0x44, 0x53, 0x22, 0x80,
+0xa9, 0xcd, 0xbb, 0xbc, 0xbb, 0x9b, 0x88, 0x88, 0x88, 0x98, 0x9a, 0x30, 0x45, 0x44, 0x44, 0x33,
+0x24, 0x13, 0x01, 0x80, 0x88, 0xb9, 0xdc, 0xbb, 0x89, 0x08, 0x63, 0x22, 0x10, 0x21, 0xc8, 0xcd,
+0xeb, 0xcb, 0x9a, 0x99, 0x88, 0x00, 0x22, 0x24, 0x22, 0x00, 0x89, 0x21, 0x00, 0x73, 0x57, 0x12,
+0x11, 0x12, 0x12, 0x22, 0x80, 0xba, 0xcd, 0xaa, 0xcb, 0xbc, 0xaa, 0xbb, 0x9a, 0xcb, 0xac, 0x9a,
+0x9a, 0x10, 0x11, 0x42, 0x35, 0x46, 0x12, 0x00, 0x43, 0x22, 0x43, 0x04, 0xa9, 0x18, 0x82, 0x88,
+0x01, 0xb9, 0x39, 0x26, 0xd8, 0xcc, 0x99, 0xa8, 0xcb, 0xaa, 0xbc, 0x9a, 0xa9, 0xad, 0x99, 0xb9,
+0x29, 0x34, 0xa0, 0x0a, 0x53, 0x33, 0x22, 0x21, 0x67, 0x44, 0x53, 0x34, 0x32, 0x53, 0x12, 0x98,
+0xa8, 0xcc, 0xbc, 0xcb, 0xad, 0xab, 0x9a, 0x89, 0x98, 0x88, 0x11, 0x31, 0x34, 0x22, 0x54, 0x34,
+0x35, 0x22, 0x32, 0x43, 0x01, 0x10, 0x01, 0xbc, 0xab, 0xeb, 0xbd, 0xab, 0x9a, 0xa9, 0xa9, 0xa9,
+0xcc, 0xab, 0x80, 0xfc, 0xab, 0x99, 0x18, 0x65, 0x33, 0x43, 0x34, 0x32, 0x44, 0x13, 0x08, 0x98,
+0xb9, 0xcb, 0xcc, 0xba, 0xaa, 0xbb, 0xcd, 0xac, 0x9b, 0x9a, 0x18, 0x43, 0x11, 0x32, 0x25, 0x11,
+0x10, 0x31, 0x46, 0x33, 0x22, 0x81, 0x08, 0x90, 0xdc, 0x19, 0x53, 0x44, 0x34, 0x22, 0x00, 0xba,
+0xce, 0xbc, 0xbb, 0xbb, 0xac, 0x98, 0x98, 0x89, 0x10, 0x88, 0x18, 0x10, 0x32, 0x36, 0x23, 0x53,
+0x45, 0x35, 0x23, 0x00, 0x10, 0x41, 0x56, 0x24, 0x23, 0x22, 0x13, 0xa8, 0xde, 0xbd, 0xbb, 0xbc,
+0xaa, 0xaa, 0x89, 0x00, 0x80, 0x00, 0x20, 0x52, 0x44, 0x43, 0x34, 0x43, 0x34, 0x33, 0x23, 0x12,
+0x98, 0xbb, 0xbb, 0xce, 0xcb, 0xab, 0xba, 0xac, 0xa9, 0xa9, 0x99, 0xb9, 0xac, 0x89, 0x9a, 0x72,
+0x13, 0x52, 0x44, 0x22, 0x32, 0x90, 0xaa, 0x90, 0xec, 0xbb, 0x18, 0x53, 0x34, 0x33, 0x31, 0x54,
+0x33, 0x13, 0xb0, 0xbd, 0xbc, 0xbd, 0xac, 0xab, 0x9a, 0x9a, 0x99, 0x99, 0x19, 0x53, 0x43, 0x24,
+0x01, 0x31, 0x13, 0x80, 0x31, 0x12, 0x52, 0x35, 0x43, 0x45, 0x44, 0x13, 0x21, 0x00, 0xda, 0x9b,
+0xdb, 0xcd, 0xa9, 0xcb, 0xaa, 0xa9, 0x9a, 0x00, 0x00, 0x32, 0x53, 0x45, 0x43, 0x42, 0x33, 0x11,
+0x10, 0x90, 0x89, 0x90, 0x99, 0x31, 0xb1, 0xce, 0xbc, 0xcd, 0xaa, 0xaa, 0xa9, 0xa9, 0x88, 0xa8,
+0x89, 0x08, 0xb9, 0x38, 0x57, 0x11, 0x73, 0x34, 0x34, 0x44, 0x22, 0x00, 0x00, 0x00, 0xa8, 0xbc,
+0xbd, 0xcb, 0xa9, 0xca, 0xbe, 0xbb, 0x89, 0x01, 0x01, 0x22, 0x22, 0x11, 0x81, 0xdd, 0x0b, 0x65,
+0x24, 0x11, 0x11, 0x81, 0x20, 0x02, 0xca, 0x8a, 0x73, 0x36, 0x12, 0x01, 0xa8, 0xcd, 0xab, 0xdb,
+0xab, 0x9a, 0x89, 0x00, 0x88, 0x80, 0x89, 0x44, 0x81, 0x89, 0x91, 0x89, 0x63, 0x90, 0x08, 0x21,
+0x55, 0x14, 0x88, 0x73, 0x55, 0x45, 0x43, 0x11, 0x90, 0xca, 0xca, 0xcb, 0xbb, 0xbb, 0x9a, 0x08,
+0x00, 0x00, 0x09, 0x88, 0xba, 0x19, 0x46, 0x44, 0x45, 0x22, 0x23, 0x33, 0x23, 0x11, 0x80, 0xa9,
+0xcb, 0xac, 0x98, 0xba, 0xcf, 0xbc, 0xab, 0xbb, 0x8a, 0xba, 0xbc, 0x8a, 0x89, 0x20, 0x35, 0x35,
+0x25, 0x02, 0x11, 0x43, 0x43, 0x53, 0x33, 0x53, 0x23, 0x22, 0x80, 0xca, 0xab, 0xbc, 0xcc, 0xbc,
+0xbc, 0xcb, 0xba, 0xa9, 0xa9, 0x99, 0x10, 0x43, 0x45, 0x33, 0x22, 0x43, 0x34, 0x22, 0x12, 0x11,
+0x88, 0x98, 0xdb, 0xcc, 0xcc, 0x9b, 0x08, 0x01, 0x63, 0x34, 0x24, 0x34, 0x01, 0xaa, 0xcc, 0xbc,
+0xbb, 0xbb, 0xbb, 0x8a, 0x00, 0x00, 0x32, 0x23, 0x99, 0x52, 0x14, 0x10, 0x53, 0x34, 0x47, 0x24,
+0x22, 0x33, 0x02, 0x31, 0x14, 0xa8, 0xcb, 0xcf, 0xab, 0xba, 0xbc, 0xca, 0xbb, 0x89, 0xa8, 0x09,
+0x12, 0x11, 0x47, 0x23, 0x42, 0x34, 0x33, 0x35, 0x81, 0x08, 0x00, 0xb9, 0xab, 0x88, 0xa9, 0x9a,
+0xeb, 0xcd, 0x9a, 0xa9, 0xca, 0xba, 0xaa, 0x08, 0xa8, 0xcc, 0xdb, 0xab, 0x0a, 0x73, 0x45, 0x32,
+0x43, 0x35, 0x24, 0x12, 0x80, 0xbb, 0xbc, 0xcb, 0xcc, 0xba, 0xaa, 0x89, 0x22, 0x81, 0x19, 0x35,
+0x23, 0x11, 0x90, 0x08, 0x81, 0xbd, 0x28, 0xa1, 0x8b, 0xb2, 0xff, 0x1b, 0x22, 0x08, 0x10, 0x73,
+0x36, 0x36, 0x35, 0x11, 0x80, 0xb9, 0xbe, 0xbb, 0xcc, 0x99, 0x98, 0x00, 0x10, 0x01, 0x00, 0x90,
+0xba, 0xbd, 0x09, 0x21, 0x45, 0x25, 0x12, 0x22, 0x32, 0x43, 0x14, 0x10, 0x44, 0x34, 0x35, 0x13,
+0x98, 0xbc, 0xbe, 0xbc, 0xcb, 0xac, 0x9a, 0x99, 0x88, 0x08, 0x81, 0x00, 0x11, 0x80, 0x38, 0x56,
+0x34, 0x35, 0x43, 0x24, 0x33, 0x33, 0x13, 0x00, 0x99, 0xcd, 0xbc, 0xbc, 0xbb, 0xbc, 0xcb, 0xbb,
+0xcb, 0x9a, 0x88, 0x08, 0x42, 0x43, 0x44, 0x43, 0x22, 0x22, 0x12, 0x11, 0x11, 0x00, 0x30, 0x23,
+0xe8, 0xbb, 0xcd, 0x9c, 0x30, 0x36, 0x21, 0x11, 0x88, 0xa9, 0xfb, 0xbe, 0xac, 0x9a, 0xaa, 0x89,
+0x08, 0x32, 0x34, 0x33, 0x33, 0x33, 0x35, 0x82, 0x9a, 0x62, 0x54, 0x34, 0x23, 0x81, 0x88, 0x31,
+0x12, 0xea, 0xbd, 0xbc, 0xac, 0xcb, 0xcb, 0xbb, 0xaa, 0x88, 0x00, 0x22, 0x44, 0x44, 0x33, 0x34,
+0x24, 0x23, 0x32, 0x23, 0x81, 0xba, 0xac, 0x99, 0x00, 0xd9, 0xbd, 0xcc, 0xcc, 0x9a, 0x98, 0xba,
+0x99, 0xba, 0x9b, 0x01, 0x08, 0x32, 0x01, 0x74, 0x47, 0x34, 0x23, 0x34, 0x33, 0x23, 0x33, 0xc1,
+0xbe, 0x9a, 0xcc, 0xbb, 0xcb, 0xac, 0xaa, 0x99, 0x88, 0x20, 0x34, 0x25, 0x22, 0x12, 0x10, 0x10,
+0x31, 0x43, 0x34, 0x23, 0x02, 0xb8, 0xcd, 0xca, 0xbc, 0x0b, 0x64, 0x22, 0x22, 0x53, 0x22, 0x80,
+0xdb, 0xdd, 0xab, 0x89, 0x99, 0x88, 0x00, 0x01, 0x22, 0x90, 0xa9, 0xbd, 0xbb, 0x98, 0x19, 0x74,
+0x43, 0x33, 0x13, 0x52, 0x45, 0x23, 0x53, 0x22, 0x32, 0x33, 0x92, 0xdd, 0xcc, 0xcb, 0xcb, 0xab,
+0xaa, 0x9a, 0x09, 0x01, 0x10, 0x22, 0x12, 0x52, 0x43, 0x33, 0x55, 0x33, 0x34, 0x24, 0x22, 0x11,
+0x11, 0x80, 0x98, 0xcb, 0xbd, 0x9a, 0xdb, 0xcc, 0xbc, 0xcb, 0xab, 0xaa, 0xa9, 0x89, 0x18, 0x63,
+0x43, 0x23, 0x43, 0x42, 0x23, 0x22, 0x02, 0xb8, 0x19, 0x35, 0x01, 0x99, 0x8a, 0x53, 0x35, 0x35,
+0x23, 0x18, 0x13, 0xfc, 0xaf, 0xcb, 0xcb, 0x9a, 0x99, 0x88, 0x11, 0x32, 0x43, 0x33, 0x02, 0x80,
+0x00, 0x22, 0x73, 0x36, 0x25, 0x22, 0x23, 0x23, 0x12, 0x81, 0xfb, 0xcc, 0xbb, 0xcb, 0xaa, 0xbb,
+0xcb, 0x9b, 0xaa, 0x99, 0x01, 0x21, 0x64, 0x34, 0x34, 0x34, 0x23, 0x33, 0x02, 0x00, 0x91, 0xa9,
+0x00, 0x81, 0xa8, 0xcc, 0xab, 0xcb, 0xac, 0xda, 0xbe, 0xab, 0xcb, 0xbd, 0xba, 0xbb, 0x88, 0x99,
+0x58, 0x35, 0x63, 0x44, 0x22, 0x33, 0x14, 0x01, 0x00, 0xba, 0xbb, 0xce, 0xac, 0x9a, 0xaa, 0x89,
+0x88, 0x22, 0x01, 0x89, 0x43, 0x74, 0x34, 0x13, 0x00, 0x81, 0x99, 0xa8, 0xcc, 0xbb, 0xca, 0x9a,
+0x99, 0x9b, 0x98, 0xec, 0xab, 0x10, 0x42, 0x44, 0x33, 0x32, 0x24, 0x22, 0x22, 0x43, 0x43, 0x33,
+0x02, 0x00, 0xc9, 0xcf, 0xca, 0xcc, 0xaa, 0xaa, 0xab, 0x99, 0xbc, 0x0a, 0xb9, 0x9b, 0x31, 0x53,
+0x67, 0x33, 0x44, 0x23, 0x32, 0x24, 0x81, 0x08, 0xa0, 0xcb, 0xaa, 0xdc, 0xac, 0xbb, 0xaa, 0xcb,
+0xaa, 0x99, 0xca, 0xba, 0xdc, 0xab, 0x19, 0x42, 0x44, 0x35, 0x24, 0x33, 0x34, 0x33, 0x43, 0x23,
+0x82, 0x90, 0xb9, 0xcd, 0xcc, 0xcc, 0xaa, 0x9a, 0x99, 0xaa, 0xbb, 0xbb, 0xa9, 0xaa, 0x99, 0x30,
+0x57, 0x34, 0x34, 0x34, 0x43, 0x43, 0x33, 0x12, 0x11, 0x01, 0xa9, 0xbc, 0xbd, 0xcc, 0xba, 0xaa,
+0xbc, 0xac, 0xab, 0xaa, 0xa9, 0x89, 0x11, 0x32, 0x45, 0x24, 0x34, 0x23, 0x20, 0x33, 0x43, 0x44,
+0x02, 0x08, 0x00, 0x10, 0x36, 0x12, 0x08, 0x08, 0x00, 0xfa, 0xbe, 0xbb, 0xbd, 0xbb, 0xbb, 0xac,
+0xa9, 0xbc, 0x89, 0x11, 0x54, 0x23, 0x32, 0x36, 0x24, 0x22, 0x12, 0x21, 0x23, 0x22, 0x54, 0x22,
+0x12, 0x90, 0xbd, 0xaa, 0xdd, 0xbd, 0xbc, 0xbb, 0xcb, 0xaa, 0x99, 0x00, 0x52, 0x33, 0x43, 0x43,
+0x33, 0x35, 0x43, 0x33, 0x12, 0x80, 0xa8, 0xa9, 0xdb, 0x9c, 0xba, 0xcc, 0x89, 0x91, 0xcb, 0xbd,
+0xbd, 0xaa, 0xa9, 0x9b, 0x30, 0x46, 0x23, 0x01, 0x80, 0x88, 0x32, 0x26, 0x53, 0x46, 0x24, 0x12,
+0x12, 0x90, 0xba, 0xcc, 0xcc, 0xac, 0xab, 0x9a, 0x88, 0x80, 0x08, 0x11, 0x31, 0x53, 0x43, 0x32,
+0x23, 0x13, 0x88, 0xa9, 0x8a, 0x41, 0x12, 0xda, 0xbc, 0xbc, 0xab, 0xab, 0x8b, 0x77, 0x37, 0x25,
+0x23, 0x80, 0xaa, 0xcc, 0xbb, 0xcb, 0xbb, 0x09, 0x01, 0x11, 0x01, 0xaa, 0x89, 0xa0, 0x9a, 0x89,
+0x72, 0x45, 0x34, 0x33, 0x90, 0x89, 0x21, 0x44, 0x45, 0x43, 0x22, 0x12, 0x00, 0xa8, 0xdc, 0xeb,
+0xac, 0xab, 0xab, 0xaa, 0xa9, 0x89, 0x18, 0x11, 0x80, 0x99, 0x31, 0x35, 0x54, 0x36, 0x34, 0x43,
+0x33, 0x43, 0x32, 0x22, 0x22, 0x91, 0xeb, 0xdb, 0xcb, 0xbb, 0xcc, 0xbb, 0xbb, 0xac, 0x9a, 0x99,
+0x08, 0x33, 0x43, 0x54, 0x24, 0x22, 0x12, 0x01, 0x20, 0x53, 0x34, 0x22, 0x22, 0x44, 0x23, 0x81,
+0xb8, 0xdc, 0xab, 0xcc, 0xbb, 0xcb, 0xbc, 0xbb, 0xcc, 0x9b, 0x09, 0x00, 0x32, 0x24, 0x53, 0x43,
+0x43, 0x22, 0x00, 0x18, 0x12, 0x21, 0x31, 0x46, 0x35, 0x43, 0x23, 0x80, 0x9a, 0xca, 0xcf, 0xbb,
+0xbc, 0xbc, 0x99, 0x99, 0x99, 0x08, 0x18, 0x42, 0x24, 0x32, 0x34, 0x45, 0x43, 0x22, 0x23, 0x02,
+0x80, 0xa8, 0xcb, 0xab, 0xaa, 0x08, 0xc8, 0xbc, 0xba, 0xcc, 0xa9, 0xed, 0xcb, 0x9a, 0x89, 0x21,
+0x22, 0x20, 0x53, 0x34, 0x44, 0x23, 0x22, 0x22, 0x33, 0x01, 0xca, 0xdc, 0xbc, 0xcc, 0xab, 0xaa,
+0xba, 0x89, 0x88, 0x80, 0x73, 0x47, 0x33, 0x22, 0x11, 0x12, 0x00, 0x80, 0xe9, 0xbc, 0xa9, 0xda,
+0xbb, 0xbc, 0x9b, 0x9a, 0x89, 0x31, 0x34, 0x34, 0x34, 0x32, 0x34, 0x11, 0x00, 0x80, 0x20, 0x34,
+0x54, 0x46, 0x12, 0x11, 0x11, 0xa0, 0xba, 0xdd, 0xbd, 0xbc, 0x9a, 0xba, 0xbc, 0xac, 0x9b, 0x89,
+0x89, 0x32, 0x35, 0x74, 0x44, 0x23, 0x43, 0x33, 0x02, 0x80, 0x98, 0xca, 0xbc, 0xbb, 0xcb, 0xbb,
+0xba, 0xbc, 0xcb, 0xbb, 0xbb, 0xaa, 0xab, 0x08, 0x01, 0x61, 0x55, 0x32, 0x42, 0x33, 0x24, 0x33,
+0x35, 0x34, 0x22, 0x33, 0x23, 0x44, 0x24, 0x91, 0xec, 0xdb, 0xbb, 0xbc, 0xab, 0xac, 0xaa, 0x08,
+0x08, 0x10, 0x00, 0x10, 0x10, 0x20, 0x64, 0x45, 0x34, 0x22, 0x63, 0x43, 0x32, 0x33, 0x01, 0x88,
+0xc9, 0xbd, 0xbc, 0xbd, 0xba, 0xcb, 0xab, 0xaa, 0x9a, 0x88, 0x00, 0x32, 0x24, 0x53, 0x34, 0x33,
+0x34, 0x35, 0x24, 0x22, 0x01, 0x01, 0x01, 0x18, 0x42, 0x14, 0x00, 0x90, 0xeb, 0xbc, 0xcd, 0xcd,
+0xbb, 0xbb, 0xab, 0x89, 0x08, 0x31, 0x53, 0x24, 0x32, 0x43, 0x23, 0x31, 0x53, 0x43, 0x34, 0x43,
+0x22, 0x13, 0x00, 0x81, 0xd9, 0xdb, 0xdc, 0xac, 0xbb, 0xbb, 0xab, 0xba, 0x8b, 0x00, 0x10, 0x44,
+0x23, 0x43, 0x35, 0x43, 0x44, 0x32, 0x32, 0x22, 0x00, 0x08, 0x88, 0xaa, 0x99, 0xba, 0xeb, 0xcc,
+0xbc, 0xbd, 0xbc, 0xba, 0xcc, 0x9a, 0x09, 0x18, 0x00, 0x11, 0x44, 0x53, 0x44, 0x22, 0x32, 0x45,
+0x33, 0x23, 0x81, 0xb9, 0xcc, 0xbc, 0xcb, 0xbc, 0x9a, 0xaa, 0x8a, 0x08, 0x08, 0x42, 0x12, 0x21,
+0x12, 0x32, 0x23, 0x43, 0x33, 0x30, 0x57, 0x12, 0x21, 0x02, 0xbb, 0x42, 0xa1, 0x0b, 0x63, 0x42,
+0x24, 0xb0, 0xbd, 0xdd, 0xbb, 0xab, 0xcb, 0x09, 0x11, 0x42, 0x43, 0x22, 0x34, 0x23, 0x11, 0x98,
+0xbd, 0xbc, 0xcc, 0x9b, 0xa8, 0xac, 0xba, 0xca, 0x09, 0x44, 0x54, 0x44, 0x35, 0x35, 0x24, 0x81,
+0xb8, 0xbc, 0xbc, 0xbc, 0xaa, 0x99, 0x88, 0x01, 0x80, 0x89, 0xaa, 0x89, 0x11, 0x73, 0x45, 0x33,
+0x32, 0x24, 0x21, 0x22, 0x80, 0x89, 0x00, 0x11, 0x81, 0xbc, 0xab, 0xdc, 0xdc, 0xeb, 0xbb, 0xba,
+0xaa, 0xaa, 0x9a, 0x20, 0x44, 0x34, 0x24, 0x21, 0x33, 0x03, 0xa9, 0x98, 0x41, 0x45, 0x24, 0x32,
+0x11, 0x52, 0x23, 0x00, 0x81, 0xed, 0xbb, 0xda, 0xbc, 0xbb, 0xbb, 0xab, 0x9b, 0x19, 0x21, 0x53,
+0x35, 0x33, 0x52, 0x43, 0x42, 0x53, 0x23, 0x23, 0x02, 0x98, 0x99, 0xb9, 0xed, 0xab, 0xcb, 0xbc,
+0xba, 0xcb, 0x9a, 0xa9, 0x8b, 0x12, 0x21, 0x46, 0x24, 0x22, 0x33, 0x31, 0x43, 0x13, 0x23, 0x81,
+0x48, 0x36, 0x21, 0x33, 0xa2, 0xdc, 0xbd, 0xba, 0xab, 0xac, 0xbb, 0xaf, 0x8a, 0x99, 0x9a, 0x88,
+0x41, 0x34, 0x33, 0x34, 0x24, 0x33, 0xa1, 0xbe, 0x9a, 0xca, 0xab, 0xba, 0x8b, 0xa8, 0xae, 0x48,
+0x44, 0x66, 0x34, 0x35, 0x33, 0x22, 0x80, 0xeb, 0xbc, 0xbc, 0xac, 0x9a, 0x8a, 0x89, 0x80, 0x88,
+0x01, 0x98, 0x19, 0x44, 0x44, 0x35, 0x33, 0x43, 0x12, 0x11, 0x10, 0x88, 0x99, 0xca, 0x9a, 0x98,
+0xab, 0x89, 0x80, 0x80, 0xf9, 0xcd, 0xdd, 0xbb, 0xcb, 0xbb, 0x8b, 0x18, 0x51, 0x34, 0x33, 0x24,
+0x22, 0x32, 0x02, 0x10, 0x22, 0x10, 0x64, 0x32, 0x21, 0x81, 0x19, 0x82, 0xec, 0xaa, 0xcd, 0xac,
+0xaa, 0xbc, 0xbb, 0xca, 0xbb, 0xba, 0x18, 0x63, 0x44, 0x35, 0x43, 0x32, 0x11, 0x00, 0xa0, 0xbb,
+0xcb, 0xbb, 0x8a, 0x11, 0x01, 0x88, 0xaa, 0xcb, 0x19, 0x25, 0xb0, 0xce, 0xaa, 0xcc, 0x9a, 0x89,
+0xda, 0xac, 0x99, 0x21, 0x37, 0x33, 0x45, 0x44, 0x33, 0x33, 0x14, 0xb8, 0xcb, 0xbc, 0xbd, 0xac,
+0x99, 0x99, 0x88, 0x00, 0x11, 0x11, 0x01, 0x10, 0x00, 0x10, 0x63, 0x43, 0x43, 0x22, 0x02, 0xd9,
+0xcd, 0xaa, 0x8a, 0x51, 0x44, 0x43, 0x45, 0x34, 0x24, 0x80, 0xba, 0xce, 0xab, 0xba, 0xaa, 0x89,
+0x08, 0x10, 0x02, 0xa9, 0x9b, 0x98, 0x31, 0x77, 0x33, 0x34, 0x32, 0x23, 0x23, 0x33, 0x81, 0x9a,
+0xca, 0xce, 0xbb, 0xaa, 0xbb, 0xcc, 0xab, 0xab, 0xaa, 0x88, 0xa9, 0x1a, 0x46, 0x32, 0x33, 0x32,
+0x63, 0x23, 0x98, 0x9a, 0x01, 0x21, 0x44, 0x22, 0x43, 0x35, 0x12, 0x12, 0xa9, 0xbb, 0xba, 0xcc,
+0xcc, 0xac, 0xcb, 0xac, 0xaa, 0xb9, 0x9b, 0x90, 0xbb, 0x28, 0x46, 0x34, 0x12, 0x01, 0xa8, 0x28,
+0x05, 0xea, 0x8a, 0x11, 0x65, 0x36, 0x33, 0x32, 0x12, 0xa8, 0xaa, 0xfb, 0xbc, 0xbc, 0xac, 0x9a,
+0xa9, 0x9a, 0x89, 0x10, 0x12, 0x51, 0x47, 0x33, 0x34, 0x22, 0x88, 0x88, 0x98, 0x00, 0xb8, 0xac,
+0xba, 0xbd, 0x89, 0xa9, 0x0a, 0xc8, 0x8b, 0xa1, 0xff, 0x9b, 0xb9, 0xab, 0x88, 0x28, 0x45, 0x02,
+0x31, 0x24, 0x31, 0x57, 0x33, 0x53, 0x53, 0x32, 0x12, 0xa9, 0xcd, 0xbd, 0xbb, 0xaa, 0xaa, 0x88,
+0x10, 0x01, 0x80, 0xca, 0xaa, 0x18, 0x32, 0x64, 0x34, 0x34, 0x44, 0x22, 0x10, 0x00, 0xa8, 0xab,
+0x09, 0x21, 0x55, 0x24, 0x34, 0x24, 0xa0, 0xdd, 0xbd, 0xac, 0xba, 0xa9, 0x08, 0x21, 0x34, 0x33,
+0x11, 0x81, 0xa8, 0xba, 0xab, 0x60, 0x45, 0x42, 0x43, 0x22, 0x33, 0x34, 0x23, 0x02, 0xc8, 0xdc,
+0xbc, 0xbc, 0xcb, 0xbb, 0xaa, 0xba, 0x9a, 0x88, 0x09, 0x54, 0x33, 0x45, 0x34, 0x33, 0x33, 0x22,
+0x12, 0x90, 0x9a, 0xba, 0xbb, 0xa9, 0xee, 0xbc, 0xbb, 0xac, 0x09, 0x21, 0x21, 0x34, 0x02, 0xa8,
+0xca, 0xbe, 0xab, 0xab, 0x28, 0x33, 0x45, 0x44, 0x33, 0x35, 0x22, 0x12, 0x81, 0xbb, 0xab, 0xbb,
+0xab, 0xdb, 0xac, 0x9a, 0xbc, 0x8b, 0xb9, 0xbf, 0xbc, 0xbd, 0x19, 0x01, 0x18, 0x33, 0x88, 0x61,
+0x14, 0x11, 0x31, 0x57, 0x45, 0x33, 0x24, 0x12, 0x80, 0xb8, 0xce, 0xbb, 0xbc, 0xbb, 0xa9, 0x9a,
+0x89, 0x08, 0x10, 0x11, 0x43, 0x34, 0x53, 0x24, 0x02, 0x31, 0x33, 0x33, 0x43, 0x12, 0xca, 0x9c,
+0x10, 0x21, 0x34, 0xb1, 0x9d, 0x64, 0x14, 0x80, 0xeb, 0xcc, 0xbb, 0x99, 0x99, 0x18, 0x31, 0x11,
+0x12, 0xa0, 0xbd, 0x09, 0x01, 0x88, 0x28, 0x55, 0x23, 0x52, 0x35, 0x24, 0x44, 0x44, 0x22, 0x12,
+0x01, 0xba, 0xbd, 0xcd, 0xcc, 0xaa, 0xa9, 0x99, 0x08, 0x00, 0x10, 0x43, 0x12, 0x11, 0x22, 0x00,
+0x61, 0x34, 0x53, 0x34, 0x02, 0x00, 0x21, 0x00, 0x99, 0xeb, 0xbb, 0xbb, 0x89, 0xe9, 0xbc, 0x89,
+0xa9, 0xab, 0xdc, 0xbb, 0x19, 0x00, 0x32, 0x36, 0x33, 0x55, 0x23, 0x02, 0x90, 0xca, 0xcb, 0xaa,
+0x98, 0xa9, 0x18, 0x45, 0x44, 0x45, 0x23, 0x12, 0x80, 0xa9, 0xbc, 0xeb, 0xbc, 0xab, 0xab, 0x99,
+0x89, 0x20, 0x22, 0x53, 0x34, 0x01, 0x31, 0x15, 0x01, 0x10, 0xb9, 0xac, 0xa9, 0x1b, 0x67, 0x13,
+0x32, 0x26, 0x22, 0x22, 0xa8, 0xcc, 0xdb, 0xad, 0xaa, 0xba, 0x9b, 0x80, 0x89, 0x30, 0x22, 0x32,
+0x25, 0x44, 0x43, 0x22, 0x33, 0x22, 0x23, 0x91, 0xca, 0xdb, 0xbb, 0x41, 0x13, 0x99, 0x98, 0xeb,
+0xab, 0xdb, 0xab, 0xa9, 0xce, 0x8a, 0x81, 0xa8, 0x9a, 0x88, 0xba, 0x61, 0x36, 0x34, 0x46, 0x33,
+0x32, 0x23, 0xa8, 0xca, 0xdc, 0xab, 0xbb, 0xac, 0x99, 0x99, 0x00, 0x22, 0x44, 0x12, 0x32, 0x02,
+0xcb, 0x89, 0xeb, 0x0b, 0x31, 0x42, 0x24, 0xb8, 0x1a, 0xa1, 0x9d, 0x00, 0xbc, 0x71, 0x37, 0x34,
+0x24, 0x81, 0x98, 0xda, 0xbc, 0xbc, 0x89, 0x18, 0x20, 0x22, 0x80, 0x10, 0xa0, 0xbc, 0xda, 0xce,
+0x8a, 0x98, 0x8b, 0x41, 0x82, 0x28, 0x45, 0x33, 0x54, 0x34, 0x44, 0x33, 0x22, 0x81, 0xb9, 0xcd,
+0xcc, 0xab, 0xab, 0xab, 0x9b, 0x9a, 0x9b, 0x88, 0x89, 0x38, 0x36, 0x54, 0x34, 0x12, 0x53, 0x33,
+0x22, 0x23, 0x90, 0x18, 0xa0, 0xbe, 0xbb, 0xbf, 0x9c, 0x08, 0x89, 0x00, 0x01, 0x23, 0x03, 0xa9,
+0xdc, 0xbc, 0x9a, 0x18, 0x32, 0x03, 0x89, 0x53, 0x91, 0xbb, 0xda, 0xce, 0x0a, 0x52, 0x53, 0x43,
+0x33, 0x33, 0x24, 0xa0, 0x89, 0x90, 0xdc, 0xbb, 0xcb, 0xcb, 0xaa, 0xba, 0xcc, 0x8a, 0x31, 0x01,
+0x28, 0x35, 0x22, 0x45, 0x03, 0x99, 0x08, 0x98, 0x08, 0x98, 0x48, 0x47, 0x63, 0x33, 0x01, 0x89,
+0xe9, 0xbc, 0x8a, 0xba, 0x8b, 0x88, 0xaa, 0x8a, 0xc9, 0xce, 0x8a, 0x21, 0x01, 0x73, 0x27, 0x22,
+0x34, 0x02, 0x98, 0x98, 0xbb, 0x9b, 0xba, 0x9b, 0xaa, 0xa9, 0xfa, 0xbd, 0x99, 0xaa, 0x8a, 0x81,
+0xba, 0x61, 0x13, 0x10, 0x25, 0xa8, 0x28, 0x04, 0x99, 0x55, 0x13, 0x08, 0x80, 0x10, 0x77, 0x37,
+0x33, 0x81, 0xa8, 0xba, 0xbd, 0xcb, 0xbb, 0xac, 0x89, 0x00, 0x88, 0xab, 0xbb, 0xa9, 0xcd, 0xab,
+0x10, 0x33, 0x45, 0x36, 0x35, 0x32, 0x34, 0x34, 0x23, 0x23, 0x80, 0x9a, 0xba, 0xdd, 0xcb, 0xbc,
+0xba, 0xcb, 0xbb, 0xba, 0xab, 0x88, 0x9a, 0x19, 0x22, 0x00, 0x11, 0x73, 0x57, 0x33, 0x34, 0x33,
+0x43, 0x34, 0x23, 0x22, 0x01, 0xba, 0xcc, 0xcb, 0xcb, 0xcb, 0xbc, 0xbc, 0xab, 0xaa, 0xba, 0x9a,
+0x09, 0x30, 0x35, 0x34, 0x34, 0x32, 0x32, 0x42, 0x54, 0x23, 0x32, 0x22, 0x33, 0x45, 0x23, 0x12,
+0x11, 0xd9, 0xdc, 0xdb, 0xbb, 0xaa, 0xcb, 0xab, 0x9a, 0xab, 0x88, 0xb9, 0x8a, 0x54, 0x33, 0x45,
+0x24, 0x11, 0x01, 0x80, 0x30, 0x33, 0x00, 0x12, 0x44, 0x65, 0x44, 0x33, 0x12, 0x90, 0xda, 0xdb,
+0xca, 0xcb, 0xbb, 0xbb, 0xaa, 0x09, 0x80, 0x18, 0x34, 0x13, 0x21, 0x22, 0x62, 0x44, 0x33, 0x12,
+0x21, 0x34, 0x54, 0x44, 0x22, 0x22, 0x22, 0x90, 0x99, 0xdc, 0xcd, 0xcb, 0xcb, 0xaa, 0xaa, 0xab,
+0x99, 0x09, 0x10, 0x63, 0x43, 0x22, 0x44, 0x23, 0x23, 0x33, 0x11, 0x08, 0x88, 0xbb, 0x29, 0x26,
+0x98, 0x08, 0x33, 0x91, 0xbb, 0xfc, 0xdc, 0xbc, 0xac, 0xbb, 0xab, 0x9a, 0x80, 0x80, 0x18, 0x54,
+0x34, 0x53, 0x34, 0x24, 0x21, 0x12, 0x01, 0xca, 0xbc, 0xab, 0xaa, 0x88, 0xb8, 0x9a, 0x01, 0xc8,
+0x29, 0x25, 0x08, 0x55, 0x34, 0x42, 0x33, 0x12, 0x98, 0xdc, 0xbb, 0xbb, 0xcc, 0xbc, 0xcb, 0x9a,
+0xba, 0xbb, 0xaa, 0x10, 0x43, 0x43, 0x43, 0x44, 0x46, 0x34, 0x34, 0x23, 0x22, 0x21, 0xa0, 0xbb,
+0xdc, 0xbc, 0xab, 0xcb, 0xbb, 0xbc, 0xbb, 0xba, 0xcc, 0x8a, 0x90, 0x19, 0x36, 0x34, 0x43, 0x43,
+0x32, 0x23, 0x22, 0x33, 0x21, 0x44, 0x23, 0x81, 0xd9, 0xcb, 0xbb, 0xbe, 0xbb, 0xbb, 0xbb, 0xec,
+0xbc, 0xaa, 0xca, 0x89, 0x22, 0x53, 0x44, 0x23, 0x42, 0x53, 0x22, 0x22, 0x81, 0xba, 0x99, 0xdb,
+0xab, 0x9a, 0xaa, 0x9a, 0x28, 0x33, 0xd0, 0xbd, 0xdc, 0xbd, 0x9a, 0x98, 0x09, 0x20, 0x88, 0x28,
+0x33, 0x31, 0x25, 0x02, 0x72, 0x63, 0x65, 0x45, 0x23, 0x23, 0x90, 0xda, 0xcb, 0xac, 0xab, 0xbb,
+0x89, 0x00, 0x80, 0x00, 0xca, 0x8b, 0x89, 0x28, 0x47, 0x43, 0x34, 0x33, 0x43, 0x23, 0x10, 0x01,
+0x98, 0x8a, 0xb8, 0xbb, 0xb9, 0xff, 0xbb, 0xbc, 0xbc, 0xcb, 0xaa, 0x89, 0x08, 0x52, 0x33, 0x53,
+0x34, 0x13, 0x01, 0x21, 0x11, 0x20, 0x22, 0x00, 0x41, 0x12, 0xaa, 0xba, 0xff, 0xbb, 0xa9, 0xa9,
+0x9a, 0x99, 0xcb, 0xbb, 0xbb, 0xcd, 0xbb, 0x99, 0x41, 0x55, 0x44, 0x24, 0x22, 0x32, 0x02, 0x88,
+0xa9, 0xcc, 0xaa, 0x88, 0xb9, 0xba, 0xca, 0xbc, 0xab, 0x18, 0x23, 0x64, 0x33, 0x80, 0x10, 0x80,
+0xeb, 0xdc, 0xcb, 0x9b, 0x09, 0x08, 0x98, 0x10, 0x23, 0x74, 0x47, 0x43, 0x33, 0x22, 0x81, 0x99,
+0xdb, 0xbd, 0xac, 0xaa, 0xa9, 0x80, 0x01, 0x11, 0x00, 0xba, 0xad, 0xab, 0xaa, 0x30, 0x44, 0x34,
+0x35, 0x13, 0x11, 0x81, 0xb9, 0x9a, 0x10, 0x56, 0x46, 0x34, 0x32, 0x33, 0x03, 0xb8, 0xed, 0xcc,
+0xaa, 0xab, 0x9a, 0x89, 0x98, 0x88, 0x80, 0xa8, 0xbb, 0x10, 0x21, 0x66, 0x44, 0x43, 0x33, 0x22,
+0x32, 0x23, 0x23, 0x23, 0x80, 0x98, 0xfb, 0xcd, 0xba, 0xbc, 0xac, 0xbb, 0xab, 0x89, 0x80, 0xba,
+0x8a, 0x99, 0x31, 0x37, 0x42, 0x43, 0x23, 0x33, 0x34, 0x42, 0x43, 0x22, 0x21, 0x22, 0x53, 0x53,
+0x33, 0x23, 0xc8, 0xce, 0xdb, 0xba, 0xac, 0xbb, 0xab, 0x89, 0x89, 0x18, 0x10, 0x52, 0x43, 0x22,
+0x53, 0x23, 0x24, 0x81, 0x19, 0x32, 0x12, 0x88, 0xca, 0xab, 0x50, 0x55, 0x12, 0x88, 0x18, 0x20,
+0x74, 0x22, 0x00, 0xa8, 0xde, 0xac, 0xab, 0xcb, 0xba, 0xaa, 0x88, 0x20, 0x12, 0x22, 0x35, 0x32,
+0x12, 0xa8, 0x71, 0x45, 0x53, 0x43, 0x22, 0x43, 0x23, 0x01, 0x90, 0xce, 0xab, 0xcb, 0xbc, 0xaa,
+0xab, 0x9a, 0xa9, 0x99, 0x99, 0x28, 0x54, 0x11, 0x32, 0x35, 0x33, 0x45, 0x14, 0x00, 0x10, 0x22,
+0x23, 0x53, 0x34, 0x81, 0x88, 0x90, 0xcd, 0xbb, 0xcc, 0xbc, 0xcb, 0xab, 0xab, 0xaa, 0xca, 0xbb,
+0x08, 0x43, 0x55, 0x35, 0x23, 0x33, 0x14, 0x88, 0x10, 0x80, 0xcb, 0xaa, 0x99, 0x8b, 0x63, 0x82,
+0x9a, 0x88, 0xc9, 0xcc, 0xcc, 0xba, 0xa9, 0x30, 0x35, 0x90, 0x8a, 0x88, 0x32, 0x26, 0x12, 0x34,
+0x22, 0x42, 0x43, 0x02, 0xd9, 0xbc, 0xcb, 0xcc, 0x89, 0xa8, 0xad, 0x08, 0x81, 0x51, 0x36, 0x23,
+0x34, 0x24, 0x00, 0xa8, 0xdc, 0xab, 0x9a, 0x99, 0xab, 0x99, 0xba, 0xcb, 0xca, 0xbb, 0x38, 0x57,
+0x53, 0x32, 0x32, 0x14, 0x01, 0x00, 0xb9, 0x9c, 0x80, 0x88, 0x08, 0xa8, 0xbd, 0x9a, 0xcc, 0xbc,
+0xcd, 0xcb, 0xba, 0xbb, 0x89, 0x00, 0x18, 0x35, 0x22, 0x55, 0x35, 0x34, 0x44, 0x33, 0x23, 0x23,
+0x01, 0xfb, 0xbb, 0xcc, 0xac, 0x9a, 0x99, 0x99, 0x00, 0x98, 0xab, 0xaa, 0xbb, 0x19, 0x44, 0x44,
+0x35, 0x25, 0x32, 0x32, 0x81, 0x9a, 0x00, 0x11, 0x53, 0x35, 0x34, 0x43, 0x01, 0xb9, 0xec, 0xcc,
+0xcb, 0xbb, 0xab, 0xaa, 0x09, 0x11, 0x32, 0x33, 0x01, 0x08, 0x31, 0x57, 0x34, 0x53, 0x43, 0x23,
+0x33, 0x24, 0x01, 0x90, 0xca, 0xbc, 0xbd, 0xac, 0xab, 0xcb, 0xaa, 0xba, 0xca, 0x9a, 0x9a, 0x89,
+0x18, 0x73, 0x44, 0x35, 0x24, 0x13, 0x11, 0x01, 0x00, 0x00, 0x88, 0x99, 0x99, 0xca, 0xbd, 0xcb,
+0xcc, 0xbb, 0xab, 0x89, 0x18, 0x12, 0x02, 0xa8, 0xbc, 0xcb, 0xab, 0x8a, 0x31, 0x66, 0x44, 0x43,
+0x43, 0x43, 0x32, 0x12, 0x90, 0xa9, 0xbb, 0xbc, 0xbb, 0xbd, 0xbd, 0xba, 0xaa, 0xaa, 0x99, 0xa9,
+0xad, 0x9a, 0xa8, 0xa9, 0x10, 0x80, 0x30, 0x47, 0x33, 0x45, 0x33, 0x46, 0x45, 0x43, 0x24, 0x23,
+0x01, 0xa8, 0xdb, 0xcd, 0xcb, 0x9b, 0x9a, 0x89, 0x00, 0x01, 0x10, 0x12, 0x88, 0x89, 0x08, 0x80,
+0x10, 0x65, 0x24, 0x32, 0x25, 0x13, 0x21, 0x22, 0x11, 0x00, 0x74, 0x35, 0x02, 0x00, 0xc8, 0xbd,
+0xbc, 0xbc, 0xac, 0xba, 0x99, 0x00, 0x18, 0x10, 0x20, 0x33, 0x01, 0x61, 0x14, 0x08, 0x33, 0x91,
+0x68, 0x35, 0x43, 0x35, 0x13, 0x52, 0x23, 0x81, 0x98, 0xec, 0xac, 0x9b, 0xba, 0xbb, 0x9a, 0xba,
+0xab, 0x99, 0xba, 0x0a, 0x43, 0x32, 0x57, 0x22, 0x00, 0x42, 0x33, 0x34, 0x34, 0x23, 0x43, 0x54,
+0x24, 0x01, 0x88, 0xb9, 0xbd, 0xdb, 0xdb, 0xba, 0xa9, 0x99, 0x9a, 0xba, 0x9a, 0x88, 0x00, 0x52,
+0x55, 0x33, 0x42, 0x33, 0x12, 0x11, 0x11, 0x10, 0x43, 0x12, 0x00, 0x22, 0xb0, 0xec, 0xdb, 0xcb,
+0xba, 0xcc, 0xac, 0x8a, 0xa9, 0x9a, 0x88, 0xca, 0x8b, 0x62, 0x44, 0x24, 0x33, 0x44, 0x34, 0x12,
+0x80, 0xb9, 0xbc, 0xbb, 0xba, 0xbc, 0x8b, 0x21, 0x80, 0x18, 0x90, 0x19, 0x26, 0xfb, 0xad, 0xb9,
+0xac, 0x08, 0x98, 0x08, 0xb9, 0x8c, 0x52, 0x42, 0x36, 0x23, 0x64, 0x35, 0x34, 0x24, 0x82, 0xb9,
+0xdb, 0xbc, 0xbc, 0xba, 0xa9, 0x09, 0x00, 0x80, 0x08, 0x90, 0x89, 0x41, 0x43, 0x31, 0x64, 0x34,
+0x12, 0x23, 0x81, 0xab, 0xaa, 0xba, 0x29, 0x65, 0x34, 0x34, 0x43, 0x24, 0x90, 0xda, 0xcd, 0xcb,
+0xaa, 0x9a, 0x8a, 0x08, 0x21, 0x22, 0x01, 0x80, 0x10, 0xa8, 0xac, 0x41, 0x47, 0x34, 0x34, 0x22,
+0x22, 0x23, 0x34, 0x13, 0xa8, 0xcb, 0xcc, 0xbc, 0xcb, 0xbc, 0xbd, 0xba, 0xaa, 0x9a, 0x89, 0x11,
+0x63, 0x34, 0x33, 0x34, 0x14, 0x22, 0x11, 0x00, 0x11, 0xa0, 0x9c, 0x10, 0xa0, 0x89, 0xfb, 0xae,
+0x09, 0x11, 0x88, 0x9a, 0x00, 0x01, 0x11, 0xb0, 0xbf, 0x9a, 0xca, 0xad, 0x09, 0x81, 0x08, 0x33,
+0x02, 0x08, 0xa8, 0xce, 0xaa, 0x72, 0x34, 0x52, 0x45, 0x13, 0x32, 0x27, 0x91, 0x98, 0xd9, 0xcc,
+0x9a, 0xa9, 0xba, 0x89, 0x99, 0x89, 0x31, 0x24, 0x33, 0x45, 0x24, 0x10, 0x43, 0x01, 0x08, 0x12,
+0xdb, 0x8a, 0x98, 0x0a, 0x13, 0x98, 0x41, 0xb0, 0xaf, 0xbc, 0xbb, 0xca, 0xbd, 0x89, 0xa9, 0x19,
+0x13, 0x89, 0x52, 0x80, 0x71, 0x77, 0x12, 0x22, 0x22, 0x22, 0xa8, 0xdc, 0xcb, 0xac, 0xaa, 0x99,
+0x88, 0x01, 0x31, 0x53, 0x12, 0x32, 0x23, 0xaa, 0x9b, 0xba, 0xbb, 0xca, 0x0a, 0x26, 0x90, 0xab,
+0xec, 0xcb, 0xaa, 0xab, 0x09, 0x73, 0x56, 0x35, 0x35, 0x32, 0x80, 0xba, 0xcc, 0xbc, 0xaa, 0x9a,
+0x08, 0x22, 0x01, 0x98, 0xaa, 0xcc, 0xdb, 0xac, 0x8a, 0x31, 0x47, 0x32, 0x22, 0x11, 0x21, 0x33,
+0x22, 0x22, 0x81, 0x80, 0x88, 0xcc, 0xce, 0xcc, 0xbb, 0xbb, 0xac, 0x9a, 0x98, 0x99, 0x20, 0x22,
+0x52, 0x35, 0x13, 0x22, 0x24, 0x32, 0x55, 0x23, 0x10, 0x11, 0x00, 0x21, 0x03, 0xfb, 0xae, 0xaa,
+0xab, 0x9b, 0xa9, 0xbb, 0xab, 0xda, 0xbb, 0xcc, 0xac, 0x08, 0x53, 0x65, 0x43, 0x32, 0x23, 0x12,
+0x89, 0xaa, 0xcc, 0xbb, 0xbb, 0xaa, 0xa9, 0x80, 0xb0, 0xbe, 0x09, 0x11, 0x22, 0x34, 0x81, 0x31,
+0x83, 0xce, 0xbb, 0xdc, 0x8b, 0x31, 0x24, 0x52, 0x45, 0x24, 0x12, 0x43, 0x12, 0x00, 0x11, 0xec,
+0xbb, 0xca, 0xcc, 0xaa, 0xb9, 0x9b, 0x10, 0x22, 0x43, 0x33, 0x43, 0x13, 0x21, 0x12, 0x89, 0x20,
+0x01, 0x28, 0xd1, 0xff, 0xa9, 0xa9, 0x1a, 0x12, 0x21, 0x67, 0x53, 0x54, 0x23, 0x81, 0xba, 0xcc,
+0xac, 0x9a, 0xaa, 0x9a, 0x08, 0x01, 0x81, 0xa8, 0xba, 0x8a, 0x20, 0x73, 0x47, 0x32, 0x32, 0x14,
+0x02, 0x11, 0x00, 0x80, 0xa8, 0xbb, 0xcc, 0xcb, 0xcb, 0xba, 0xbb, 0xcc, 0x8a, 0x88, 0xba, 0x0a,
+0xa0, 0xbe, 0x28, 0x44, 0x43, 0x35, 0x14, 0x12, 0x23, 0x01, 0x80, 0xa9, 0x9b, 0x88, 0x08, 0x13,
+0xda, 0xbb, 0xbe, 0x2a, 0xb2, 0xff, 0x89, 0xa9, 0x8b, 0x80, 0xba, 0x99, 0xa8, 0x58, 0x46, 0x43,
+0x44, 0x32, 0x33, 0x82, 0x90, 0xda, 0xbd, 0x9a, 0xaa, 0xac, 0x9a, 0x9a, 0x9a, 0x9a, 0x10, 0x52,
+0x35, 0x14, 0x11, 0x02, 0xa9, 0x89, 0x32, 0x33, 0x13, 0x43, 0x14, 0x19, 0x64, 0x91, 0x8b, 0x54,
+0x44, 0x44, 0x03, 0xb9, 0xcc, 0xdc, 0xbb, 0xaa, 0xa9, 0x89, 0x21, 0x24, 0x11, 0x43, 0x23, 0x01,
+0x11, 0x02, 0x10, 0x34, 0x33, 0x45, 0x02, 0xa9, 0xaa, 0xdb, 0x9a, 0x32, 0x43, 0x75, 0x43, 0x22,
+0x91, 0xea, 0xcb, 0xcb, 0xac, 0xa9, 0x99, 0x89, 0x88, 0x88, 0x11, 0x22, 0x44, 0x22, 0x53, 0x24,
+0x33, 0x45, 0x22, 0x11, 0x22, 0x33, 0x91, 0xda, 0xbc, 0xab, 0x99, 0xdb, 0xcd, 0xba, 0x8a, 0x30,
+0x14, 0x01, 0x98, 0xdb, 0xcc, 0xba, 0x99, 0x99, 0x10, 0x22, 0x08, 0x52, 0x46, 0x54, 0x22, 0x31,
+0x43, 0x23, 0x43, 0x03, 0xb9, 0xcc, 0xbc, 0xdb, 0xbb, 0xba, 0xbd, 0x9b, 0xa8, 0x09, 0x34, 0x23,
+0x55, 0x24, 0x11, 0x21, 0x81, 0x89, 0xa9, 0xaa, 0x88, 0x10, 0x90, 0xad, 0x31, 0xb1, 0xbc, 0xda,
+0xde, 0xab, 0x18, 0x22, 0x33, 0x26, 0x82, 0x10, 0x82, 0x09, 0x54, 0x13, 0x80, 0xb9, 0xad, 0x9a,
+0x18, 0xc0, 0xef, 0x9a, 0x08, 0x08, 0x33, 0x81, 0x19, 0x34, 0x81, 0x28, 0x43, 0x32, 0x65, 0x22,
+0xb9, 0xac, 0xaa, 0xbb, 0xca, 0xdc, 0xaa, 0xb9, 0x9a, 0xa8, 0xbf, 0x19, 0x34, 0x56, 0x45, 0x33,
+0x33, 0x01, 0xb8, 0xcd, 0xbb, 0xcb, 0x9a, 0x88, 0x80, 0x00, 0x80, 0x9a, 0xb9, 0xcd, 0x8a, 0x18,
+0x44, 0x22, 0x10, 0x43, 0x33, 0x35, 0x13, 0x00, 0x11, 0x34, 0x34, 0x53, 0x23, 0x90, 0xa9, 0xec,
+0xab, 0xca, 0xcc, 0x9a, 0xa9, 0xaa, 0x88, 0x98, 0x98, 0xdc, 0xbb, 0xb9, 0x0a, 0x34, 0xb1, 0x4a,
+0x35, 0x43, 0x56, 0x22, 0x31, 0x35, 0x33, 0x33, 0x13, 0x12, 0x91, 0xbd, 0xcb, 0xcd, 0xac, 0xa9,
+0xdb, 0xab, 0xbc, 0xac, 0x89, 0x08, 0x80, 0x11, 0x12, 0x10, 0x73, 0x34, 0x44, 0x34, 0x22, 0x42,
+0x32, 0x32, 0x34, 0x91, 0xbd, 0xaa, 0xcc, 0xba, 0xa9, 0xcc, 0xab, 0xaa, 0xa9, 0xaa, 0xcb, 0x8a,
+0x10, 0x11, 0x41, 0x45, 0x34, 0x43, 0x22, 0x12, 0x32, 0x34, 0x43, 0x24, 0x80, 0x20, 0x34, 0x81,
+0x98, 0xfb, 0xbd, 0xba, 0xbc, 0xcc, 0xba, 0x9a, 0x99, 0x08, 0x22, 0x80, 0x28, 0x12, 0x40, 0x47,
+0x24, 0x33, 0x24, 0x02, 0x32, 0x33, 0x90, 0x89, 0xd8, 0xac, 0x99, 0xfc, 0xbb, 0x9a, 0x9a, 0x99,
+0x99, 0x20, 0x43, 0x43, 0x02, 0xba, 0xaa, 0x72, 0x45, 0x12, 0x22, 0x83, 0x89, 0x24, 0xfa, 0xbd,
+0xaa, 0x8a, 0x20, 0x90, 0x10, 0x81, 0x08, 0x33, 0x20, 0x67, 0x24, 0x22, 0x24, 0x08, 0x20, 0x92,
+0xcb, 0xcd, 0xbd, 0xbc, 0xbb, 0xbb, 0xaa, 0x09, 0x43, 0x54, 0x35, 0x12, 0x42, 0x33, 0x12, 0x21,
+0x82, 0xba, 0x99, 0xaa, 0xdd, 0xbc, 0xac, 0xcb, 0x9a, 0x01, 0x98, 0x18, 0x80, 0xbb, 0xcb, 0xdd,
+0xcb, 0xba, 0x99, 0x10, 0x53, 0x45, 0x34, 0x43, 0x54, 0x43, 0x43, 0x22, 0x02, 0xa8, 0xcc, 0xbc,
+0xbc, 0xbb, 0x9b, 0x8a, 0x99, 0xaa, 0xbb, 0x9b, 0x18, 0x42, 0x46, 0x24, 0x33, 0x35, 0x33, 0x22,
+0x02, 0x98, 0x8a, 0x42, 0x33, 0x31, 0x35, 0x12, 0x31, 0x93, 0xef, 0xdb, 0xcb, 0xbc, 0xac, 0xaa,
+0x8a, 0x08, 0x21, 0x00, 0x31, 0x12, 0x41, 0x66, 0x22, 0x22, 0x33, 0x33, 0x42, 0x34, 0x80, 0x09,
+0x10, 0x08, 0xb9, 0xdf, 0xbc, 0xbc, 0xaa, 0xbb, 0xac, 0x99, 0x89, 0x20, 0x12, 0x08, 0x00, 0x28,
+0x57, 0x43, 0x33, 0x25, 0x23, 0x33, 0x33, 0x24, 0x11, 0x01, 0xa9, 0xdc, 0xcc, 0xaa, 0xdb, 0xcc,
+0x9a, 0xba, 0x9a, 0x88, 0x98, 0x89, 0x32, 0x35, 0x22, 0x12, 0x10, 0x75, 0x54, 0x34, 0x34, 0x11,
+0x01, 0x08, 0x99, 0xcc, 0xcb, 0xac, 0xab, 0xb9, 0xbb, 0x9a, 0xca, 0x8a, 0x80, 0x98, 0x41, 0x25,
+0x43, 0x33, 0x32, 0x34, 0x35, 0x44, 0x22, 0x21, 0x80, 0x99, 0x01, 0x21, 0x43, 0xa1, 0xaa, 0xca,
+0xdf, 0xbb, 0xcd, 0xbb, 0xcb, 0x9a, 0x99, 0x08, 0x11, 0x01, 0x08, 0x98, 0x38, 0x37, 0x54, 0x44,
+0x33, 0x44, 0x33, 0x33, 0x33, 0x81, 0xba, 0xdc, 0xbc, 0xad, 0xac, 0xab, 0xaa, 0x9a, 0x18, 0x10,
+0x21, 0x23, 0x01, 0x11, 0x22, 0x32, 0x25, 0x43, 0x34, 0x34, 0x12, 0xc8, 0xbb, 0x89, 0x30, 0x57,
+0x45, 0x53, 0x43, 0x12, 0x81, 0xca, 0xbd, 0xbc, 0xcb, 0xab, 0x99, 0x09, 0x20, 0x21, 0x22, 0x22,
+0x32, 0x22, 0x34, 0x23, 0x80, 0x21, 0x32, 0x77, 0x23, 0x01, 0x31, 0x44, 0x53, 0x13, 0x90, 0xcb,
+0xbb, 0xcc, 0xcc, 0xcb, 0xab, 0xaa, 0x99, 0x89, 0x80, 0x18, 0x64, 0x13, 0x41, 0x34, 0x22, 0x44,
+0x22, 0x80, 0x81, 0xa8, 0xab, 0xaa, 0xcb, 0xba, 0x9a, 0xba, 0xbe, 0x9a, 0xaa, 0x9b, 0x99, 0xdc,
+0x0a, 0x12, 0xb8, 0xbb, 0xcd, 0x0c, 0x65, 0x24, 0x32, 0x36, 0x23, 0x21, 0x01, 0xc8, 0xcb, 0xbc,
+0xac, 0xba, 0x9a, 0xa9, 0xaa, 0x8a, 0x08, 0x42, 0x34, 0x23, 0x33, 0x01, 0x42, 0x82, 0x9a, 0x00,
+0xda, 0x78, 0x37, 0x33, 0x33, 0x12, 0x42, 0x36, 0x23, 0x00, 0xfc, 0xbd, 0xab, 0xac, 0xaa, 0x99,
+0x09, 0x42, 0x43, 0x32, 0x12, 0x11, 0x33, 0x12, 0x81, 0xa8, 0x0a, 0x43, 0xd8, 0xbd, 0xcc, 0xbb,
+0x89, 0xcb, 0xab, 0x62, 0x66, 0x44, 0x24, 0x12, 0x90, 0xca, 0xbc, 0xbb, 0xbb, 0xaa, 0x08, 0x21,
+0x23, 0x90, 0xba, 0xcc, 0xbc, 0x09, 0x44, 0x35, 0x34, 0x24, 0x23, 0x21, 0x12, 0x88, 0x18, 0x12,
+0xd9, 0xbb, 0xdd, 0xbc, 0xab, 0xdb, 0x9b, 0x89, 0x98, 0x09, 0x43, 0x23, 0x11, 0x42, 0x23, 0x53,
+0x25, 0x02, 0x00, 0x32, 0x12, 0x10, 0x91, 0xaa, 0x80, 0xfb, 0xbb, 0xba, 0xac, 0x99, 0xdd, 0xad,
+0xab, 0xaa, 0x89, 0x31, 0x93, 0xbf, 0x71, 0x35, 0x31, 0x24, 0x82, 0x08, 0x11, 0xd9, 0xad, 0xaa,
+0xba, 0x9b, 0x00, 0xeb, 0x9a, 0x00, 0x18, 0x64, 0x23, 0x33, 0x25, 0x11, 0x10, 0x98, 0xac, 0x99,
+0xda, 0x9b, 0x99, 0xdc, 0xaa, 0xa9, 0x8b, 0x41, 0x22, 0x66, 0x24, 0x33, 0x13, 0xa0, 0xba, 0xac,
+0xab, 0xba, 0xcb, 0x19, 0x11, 0x88, 0xca, 0xcd, 0xac, 0x9a, 0xaa, 0x9b, 0x89, 0x99, 0x50, 0x24,
+0x98, 0x42, 0x35, 0x63, 0x54, 0x44, 0x53, 0x34, 0x22, 0x98, 0xba, 0xcd, 0xcb, 0xaa, 0xbb, 0x9a,
+0x98, 0x88, 0x88, 0xa9, 0x9a, 0x80, 0x42, 0x55, 0x43, 0x43, 0x33, 0x24, 0x22, 0x22, 0x13, 0x00,
+0x33, 0x02, 0x00, 0xd9, 0xbe, 0xba, 0xbc, 0xbd, 0xdc, 0xac, 0xaa, 0xa9, 0x99, 0x99, 0x18, 0x32,
+0x22, 0x44, 0x12, 0x32, 0x55, 0x34, 0x34, 0x22, 0x11, 0x32, 0x43, 0x44, 0x02, 0xa9, 0x99, 0xdc,
+0xbc, 0xac, 0xac, 0xbb, 0xaa, 0xaa, 0xaa, 0x89, 0x99, 0x20, 0x56, 0x43, 0x53, 0x23, 0x22, 0x01,
+0x00, 0x00, 0x98, 0x89, 0x21, 0xa1, 0xdb, 0xcb, 0xbe, 0x9a, 0x12, 0x22, 0x53, 0x01, 0x08, 0x81,
+0xfb, 0xab, 0xeb, 0xbc, 0x8a, 0xa9, 0x8a, 0x51, 0x33, 0x22, 0x22, 0x53, 0x53, 0x32, 0x22, 0x98,
+0x09, 0x01, 0x99, 0x41, 0x43, 0x53, 0xa2, 0xcf, 0xcb, 0xbc, 0xaa, 0xb9, 0xaa, 0x00, 0x10, 0x21,
+0x35, 0x24, 0x22, 0x44, 0x34, 0x34, 0x45, 0x12, 0x11, 0x98, 0xaa, 0xcc, 0xcb, 0xbb, 0xbc, 0x99,
+0x99, 0x9a, 0xa8, 0x99, 0x52, 0x23, 0x01, 0x21, 0x33, 0x23, 0x63, 0x02, 0xdc, 0x19, 0x45, 0x24,
+0x23, 0x02, 0xaa, 0x19, 0xc8, 0xad, 0x52, 0x82, 0x18, 0x33, 0x12, 0x53, 0x12, 0xfa, 0xbd, 0x9b,
+0xb9, 0xbb, 0x9b, 0xda, 0xaa, 0xb9, 0xcc, 0x9a, 0xba, 0xac, 0x19, 0x44, 0x44, 0x23, 0x44, 0x33,
+0x32, 0x63, 0x24, 0x45, 0x44, 0x33, 0x23, 0x91, 0xfb, 0xdb, 0xbb, 0xbb, 0xac, 0xa9, 0x89, 0x08,
+0x81, 0x88, 0xaa, 0xab, 0x41, 0x55, 0x35, 0x34, 0x43, 0x22, 0x22, 0x22, 0x02, 0x10, 0x80, 0xaa,
+0xaa, 0xdd, 0xcc, 0xbc, 0xcc, 0xaa, 0xab, 0xaa, 0xaa, 0x00, 0x11, 0x21, 0x44, 0x33, 0x45, 0x43,
+0x33, 0x23, 0x53, 0x43, 0x11, 0x01, 0xa0, 0xbc, 0xba, 0xbd, 0xbc, 0xbb, 0xcb, 0x99, 0x09, 0x01,
+0x98, 0x99, 0xfb, 0x9c, 0x08, 0x88, 0x41, 0x24, 0x53, 0x45, 0x33, 0x44, 0x22, 0x01, 0x98, 0xca,
+0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0x9a, 0x08, 0x88, 0x10, 0x22, 0x43, 0x45, 0x24, 0x81, 0x89, 0x63,
+0x23, 0x31, 0x24, 0xa8, 0xbc, 0xcb, 0xad, 0x8a, 0x01, 0x08, 0x72, 0x46, 0x34, 0x25, 0x82, 0xc9,
+0xbb, 0xcc, 0xab, 0xaa, 0x99, 0x18, 0x22, 0x11, 0x81, 0x98, 0xaa, 0x8a, 0x41, 0x47, 0x44, 0x24,
+0x33, 0x22, 0x11, 0x11, 0xa0, 0xac, 0xa9, 0xcd, 0xac, 0x9a, 0xbb, 0xbb, 0xbc, 0xbb, 0xab, 0x89,
+0xaa, 0x9a, 0x62, 0x44, 0x44, 0x33, 0x23, 0x21, 0x32, 0x45, 0x33, 0x42, 0x33, 0xa0, 0x19, 0x92,
+0xce, 0xab, 0xba, 0xbe, 0xbc, 0xcb, 0xac, 0x9a, 0x99, 0x18, 0x21, 0x32, 0x35, 0x23, 0x43, 0x33,
+0x81, 0x08, 0x21, 0x54, 0x22, 0x22, 0x65, 0x24, 0x33, 0x34, 0x83, 0xa9, 0x98, 0xed, 0xac, 0xcb,
+0xbb, 0xba, 0xbc, 0x9a, 0xa8, 0x09, 0x43, 0x32, 0x53, 0x33, 0x43, 0x23, 0x33, 0x25, 0x12, 0x42,
+0x33, 0x34, 0x36, 0x14, 0x12, 0x81, 0xeb, 0xac, 0xbb, 0xbe, 0x9c, 0xaa, 0xaa, 0x9a, 0xa8, 0x9a,
+0x38, 0x33, 0x43, 0x56, 0x43, 0x33, 0x33, 0x23, 0x32, 0x23, 0xc8, 0xac, 0x98, 0x89, 0x51, 0x82,
+0xbb, 0xba, 0xef, 0xbb, 0xcb, 0xbc, 0x8a, 0x88, 0x08, 0x10, 0x42, 0x44, 0x24, 0x22, 0x34, 0x25,
+0x12, 0x11, 0x01, 0xaa, 0x8a, 0xc9, 0xce, 0xaa, 0xca, 0xac, 0xaa, 0xaa, 0x9a, 0x98, 0xaa, 0x71,
+0x44, 0x53, 0x43, 0x22, 0x81, 0x80, 0x88, 0x99, 0x21, 0x80, 0x9a, 0x01, 0xec, 0xbc, 0xba, 0xcd,
+0xac, 0xab, 0x99, 0x10, 0x22, 0x21, 0x12, 0x21, 0x57, 0x43, 0x43, 0x23, 0x11, 0x12, 0x98, 0x9a,
+0xca, 0xbe, 0x9a, 0xba, 0xbd, 0xca, 0xdb, 0xab, 0x99, 0x21, 0x54, 0x54, 0x32, 0x22, 0x32, 0x01,
+0xaa, 0xcc, 0xbb, 0x9a, 0x09, 0x18, 0x22, 0x81, 0xfa, 0xcb, 0xcb, 0xcb, 0x8a, 0x00, 0x89, 0x28,
+0x34, 0x43, 0x35, 0x24, 0x00, 0x11, 0x11, 0x21, 0x45, 0x81, 0x88, 0x88, 0x30, 0x77, 0x33, 0x23,
+0x91, 0xdb, 0xcd, 0xbb, 0xcb, 0xbb, 0xaa, 0x89, 0x99, 0x99, 0xc9, 0xaa, 0x08, 0x31, 0x77, 0x34,
+0x33, 0x44, 0x23, 0x32, 0x14, 0x90, 0xa9, 0xba, 0xab, 0xdb, 0xbc, 0xcb, 0xcb, 0x9b, 0xca, 0xbb,
+0x99, 0x88, 0x21, 0x02, 0x20, 0x36, 0x12, 0x43, 0x24, 0x42, 0x33, 0x43, 0x23, 0x12, 0x53, 0x23,
+0x22, 0x13, 0x98, 0x41, 0x24, 0x10, 0xc0, 0xff, 0xab, 0xbc, 0xbc, 0xbb, 0xab, 0x8a, 0x00, 0x10,
+0x11, 0x11, 0x12, 0x32, 0x57, 0x34, 0x53, 0x44, 0x22, 0x22, 0x34, 0x22, 0x00, 0xa8, 0xcc, 0xbc,
+0xbb, 0xbd, 0xba, 0xbb, 0xbc, 0x8a, 0x08, 0x08, 0x80, 0xa9, 0x8a, 0x42, 0x54, 0x44, 0x32, 0x44,
+0x23, 0x22, 0x21, 0x33, 0x12, 0x89, 0x30, 0xc0, 0xab, 0xd8, 0xdf, 0xaa, 0xa9, 0xbc, 0x99, 0xb9,
+0x89, 0x89, 0x19, 0x33, 0x13, 0x12, 0x21, 0x75, 0x25, 0x13, 0x00, 0x10, 0x43, 0x02, 0x30, 0x27,
+0x90, 0x28, 0xa2, 0xbe, 0x99, 0xfb, 0xbc, 0xab, 0x99, 0x98, 0x28, 0x34, 0x11, 0x56, 0x14, 0x10,
+0x23, 0x81, 0x08, 0xa0, 0xcd, 0xaa, 0x98, 0xcb, 0xbd, 0xcb, 0xac, 0x09, 0x02, 0x00, 0x44, 0x23,
+0x42, 0x46, 0x33, 0x31, 0x22, 0x91, 0x9a, 0x99, 0xcd, 0xbb, 0xda, 0xbb, 0xac, 0xab, 0xbc, 0xad,
+0xaa, 0x99, 0x38, 0x46, 0x33, 0x35, 0x24, 0x13, 0x11, 0x00, 0x00, 0x98, 0x09, 0x02, 0xa9, 0xda,
+0xbd, 0xbc, 0xcc, 0xaa, 0xba, 0xbb, 0x08, 0x80, 0x08, 0xe8, 0xbe, 0xab, 0xaa, 0x38, 0x44, 0x53,
+0x25, 0x12, 0x42, 0x45, 0x53, 0x33, 0x23, 0x01, 0xaa, 0xba, 0xfb, 0xbc, 0xac, 0xac, 0xab, 0xaa,
+0xaa, 0x9a, 0x88, 0x20, 0x32, 0x43, 0x43, 0x54, 0x23, 0x22, 0x53, 0x24, 0x31, 0x24, 0x22, 0x31,
+0x35, 0x12, 0x22, 0x01, 0x88, 0xb8, 0xff, 0xcc, 0xbc, 0xbb, 0xbb, 0x9a, 0x9a, 0x09, 0x10, 0x31,
+0x22, 0x43, 0x45, 0x44, 0x34, 0x34, 0x32, 0x43, 0x22, 0x11, 0x11, 0x88, 0xdb, 0xcc, 0xba, 0xcb,
+0xaa, 0xbc, 0xad, 0xaa, 0xaa, 0x9a, 0x88, 0x18, 0x53, 0x34, 0x43, 0x43, 0x33, 0x23, 0x13, 0x02,
+0x80, 0x20, 0x12, 0xeb, 0x9b, 0x98, 0xba, 0x19, 0x23, 0xa0, 0xbc, 0x1a, 0xd8, 0xcf, 0x99, 0xda,
+0x9a, 0x08, 0x98, 0xca, 0xcd, 0x0a, 0x32, 0x81, 0x88, 0x21, 0x55, 0x22, 0x01, 0x80, 0x99, 0x48,
+0x77, 0x23, 0x13, 0x12, 0x22, 0x11, 0xa8, 0xde, 0xcc, 0xaa, 0xaa, 0xa9, 0xbb, 0xaa, 0x18, 0xa0,
+0x19, 0x54, 0x22, 0x55, 0x33, 0x32, 0x34, 0x21, 0x10, 0x80, 0x99, 0xba, 0x0b, 0x02, 0xcb, 0x09,
+0xfb, 0xbf, 0xa9, 0xcc, 0x9b, 0x88, 0x98, 0x99, 0xaa, 0xab, 0xcc, 0x29, 0x37, 0x33, 0x54, 0x35,
+0x33, 0x53, 0x23, 0x80, 0x99, 0xc9, 0xbd, 0x9c, 0x9a, 0xaa, 0x8a, 0x9a, 0x99, 0x99, 0xaa, 0xab,
+0x30, 0x14, 0xa9, 0x20, 0xa0, 0x6a, 0x57, 0x33, 0x33, 0x02, 0x10, 0x91, 0xab, 0x71, 0x83, 0x0b,
+0x67, 0x34, 0x33, 0x24, 0xb8, 0xbd, 0xcb, 0xba, 0xac, 0xa9, 0x88, 0x88, 0x98, 0xeb, 0xbc, 0xba,
+0xbb, 0x89, 0x21, 0x46, 0x35, 0x34, 0x35, 0x23, 0x34, 0x22, 0x22, 0x02, 0xca, 0xbc, 0xcc, 0xbc,
+0xbb, 0xac, 0x9b, 0x99, 0xa9, 0x89, 0x08, 0x22, 0x44, 0x34, 0x34, 0x43, 0x33, 0x33, 0x33, 0x22,
+0x21, 0x01, 0xa9, 0xbb, 0xfb, 0xce, 0xbb, 0xaa, 0xa9, 0x89, 0x10, 0x80, 0x10, 0x13, 0xec, 0xab,
+0x99, 0xaa, 0xaa, 0xcc, 0x48, 0x67, 0x33, 0x23, 0x23, 0x11, 0x81, 0xa8, 0xcb, 0xbd, 0xac, 0x89,
+0x9a, 0x9a, 0xa0, 0xcd, 0x8a, 0x81, 0x99, 0x30, 0x02, 0x31, 0x26, 0x90, 0x8a, 0x44, 0xc1, 0x9c,
+0x10, 0xea, 0x8a, 0x90, 0xab, 0x75, 0x44, 0x63, 0x34, 0x33, 0x12, 0x90, 0xdc, 0xbc, 0xbc, 0xba,
+0xaa, 0x09, 0x80, 0x80, 0x00, 0xa8, 0x89, 0x20, 0x43, 0x56, 0x35, 0x34, 0x22, 0x12, 0x01, 0x88,
+0xa9, 0xa9, 0xcb, 0xbb, 0xaa, 0xaa, 0x30, 0x03, 0x89, 0x80, 0xff, 0xbc, 0xcb, 0xbc, 0xac, 0x9a,
+0x09, 0x20, 0x44, 0x33, 0x33, 0x14, 0x01, 0x20, 0x44, 0x35, 0x33, 0x22, 0x11, 0x21, 0x12, 0x90,
+0xdc, 0xcd, 0xac, 0xaa, 0xcb, 0xac, 0x98, 0xa8, 0xab, 0x8a, 0x09, 0x42, 0x43, 0x33, 0x33, 0x45,
+0x53, 0x33, 0x33, 0x21, 0x21, 0x42, 0x13, 0xa8, 0xcb, 0xcb, 0xbd, 0xbb, 0xbd, 0xad, 0x9b, 0x08,
+0xd9, 0xab, 0x88, 0x99, 0x21, 0x23, 0x10, 0xe0, 0xbd, 0x08, 0x80, 0x71, 0x35, 0x45, 0x46, 0x43,
+0x22, 0x81, 0xb9, 0xcc, 0xbb, 0xbd, 0xab, 0x99, 0x88, 0x00, 0x01, 0x88, 0x98, 0x08, 0x22, 0x44,
+0x54, 0x34, 0x34, 0x33, 0x11, 0x11, 0x90, 0xba, 0xab, 0xbc, 0xab, 0x18, 0x11, 0x08, 0x20, 0xf9,
+0xbd, 0xcc, 0xcd, 0xbb, 0xab, 0xab, 0x89, 0x10, 0x44, 0x34, 0x34, 0x42, 0x21, 0x11, 0x01, 0x21,
+0x43, 0x33, 0x44, 0x13, 0x10, 0x12, 0xc9, 0xcc, 0xdd, 0xbb, 0xaa, 0xab, 0x99, 0xa8, 0x89, 0x81,
+0x90, 0xa8, 0x09, 0x45, 0x23, 0x74, 0x24, 0x11, 0x22, 0xa8, 0x8b, 0x32, 0x13, 0x42, 0x35, 0x12,
+0x10, 0x82, 0xfd, 0xbc, 0xaa, 0xbb, 0xcb, 0x9a, 0x89, 0x42, 0x34, 0x32, 0x36, 0x12, 0x43, 0x25,
+0x88, 0xa8, 0xbe, 0xab, 0xa9, 0xbb, 0x98, 0xba, 0x09, 0xc9, 0xcc, 0xbb, 0x0c, 0x54, 0x35, 0x46,
+0x22, 0x11, 0x22, 0x80, 0x98, 0xda, 0xbc, 0xac, 0xa9, 0xa9, 0xbb, 0xa9, 0xa9, 0x8a, 0x32, 0x23,
+0x46, 0x25, 0x13, 0x11, 0x32, 0x81, 0x28, 0x36, 0xa8, 0x1a, 0x14, 0x9a, 0x54, 0x03, 0x88, 0xa8,
+0xec, 0xbc, 0xbb, 0xca, 0xbc, 0x9a, 0xca, 0xad, 0x88, 0x88, 0x30, 0x24, 0x22, 0x45, 0x54, 0x45,
+0x43, 0x23, 0x12, 0x88, 0xa9, 0xcd, 0xcb, 0xba, 0x9c, 0x9a, 0x98, 0x88, 0x9a, 0xa9, 0x99, 0x19,
+0x31, 0x54, 0x35, 0x34, 0x33, 0x33, 0x12, 0x22, 0x11, 0x00, 0x00, 0x42, 0x53, 0x44, 0x22, 0x00,
+0x98, 0xfc, 0xcc, 0xcb, 0xbb, 0xbb, 0xba, 0xaa, 0x89, 0x00, 0x80, 0x42, 0x24, 0x02, 0x32, 0x45,
+0x43, 0x45, 0x33, 0x12, 0x32, 0x35, 0x35, 0x22, 0x00, 0xa8, 0xaa, 0xbc, 0xce, 0xcb, 0xac, 0xbb,
+0xba, 0xaa, 0xaa, 0x9a, 0x28, 0x12, 0x21, 0x35, 0x34, 0x44, 0x53, 0x33, 0x44, 0x33, 0x24, 0x22,
+0x11, 0x80, 0xa8, 0xba, 0xcc, 0xcb, 0xac, 0xac, 0xac, 0xba, 0xcc, 0xaa, 0xca, 0xab, 0x88, 0x21,
+0x54, 0x34, 0x43, 0x53, 0x12, 0x12, 0x00, 0x80, 0x99, 0xaa, 0xba, 0xae, 0x08, 0x01, 0x30, 0x14,
+0xda, 0xab, 0xda, 0xbd, 0xa9, 0xca, 0x9a, 0x99, 0x08, 0x10, 0x21, 0x24, 0x10, 0x73, 0x35, 0x55,
+0x34, 0x24, 0x23, 0x00, 0x89, 0xb9, 0xdd, 0xbb, 0xbb, 0xac, 0x9a, 0x99, 0xaa, 0x88, 0x88, 0x99,
+0x18, 0x32, 0x44, 0x44, 0x43, 0x32, 0x45, 0x33, 0x23, 0x22, 0x10, 0x22, 0x11, 0x42, 0x02, 0xdb,
+0xcb, 0xdc, 0xac, 0xba, 0xba, 0xbb, 0x9b, 0x9a, 0xca, 0xba, 0xdb, 0x8b, 0x00, 0x08, 0x74, 0x23,
+0x90, 0x99, 0x89, 0x62, 0x45, 0x24, 0x32, 0x53, 0x44, 0x43, 0x22, 0x00, 0xa9, 0xbc, 0xbd, 0xbc,
+0xbc, 0xab, 0x9a, 0x8a, 0x80, 0x98, 0x11, 0x12, 0x21, 0x35, 0x11, 0x08, 0x31, 0x56, 0x34, 0x32,
+0x42, 0x14, 0x21, 0x56, 0x22, 0x08, 0x00, 0xb9, 0xae, 0x99, 0xeb, 0xab, 0x9b, 0xab, 0xab, 0xaa,
+0x89, 0x28, 0x36, 0x23, 0x42, 0x34, 0x32, 0x12, 0x01, 0x42, 0x34, 0x32, 0x33, 0x12, 0x81, 0x10,
+0x24, 0xfb, 0x9b, 0xd9, 0xbf, 0xba, 0xbc, 0xab, 0xa8, 0xab, 0x08, 0xa8, 0x61, 0x35, 0x24, 0x43,
+0x33, 0x24, 0x11, 0x10, 0x80, 0x80, 0x80, 0xcb, 0x9c, 0xba, 0xac, 0x09, 0xd9, 0xdd, 0xab, 0xbc,
+0xac, 0x89, 0x88, 0x08, 0x42, 0x22, 0x12, 0x12, 0x21, 0x57, 0x44, 0x43, 0x44, 0x32, 0x21, 0x12,
+0xa0, 0xcb, 0xcd, 0xbc, 0xbb, 0xcb, 0x9a, 0x89, 0x99, 0x09, 0x21, 0x23, 0x52, 0x44, 0x22, 0x22,
+0x12, 0x00, 0x32, 0x02, 0x89, 0xca, 0xbd, 0xdc, 0xcc, 0x89, 0x98, 0x10, 0x55, 0x64, 0x44, 0x32,
+0x01, 0xa0, 0xcc, 0xbb, 0xbc, 0xaa, 0x8a, 0x09, 0x11, 0x82, 0xa8, 0xdb, 0xbc, 0x8a, 0x11, 0x72,
+0x45, 0x33, 0x23, 0x33, 0x02, 0xa9, 0x00, 0x91, 0xcb, 0x99, 0xfb, 0xab, 0xb9, 0xbd, 0xac, 0xab,
+0x09, 0x11, 0x11, 0x02, 0xa8, 0x89, 0x20, 0x55, 0x25, 0x43, 0x53, 0x32, 0x22, 0x81, 0xb9, 0xcd,
+0x9a, 0xa9, 0xab, 0xab, 0xad, 0x10, 0x80, 0x18, 0x44, 0x11, 0x32, 0x02, 0x51, 0x13, 0x08, 0x46,
+0x82, 0x19, 0x02, 0xfc, 0xaa, 0xa8, 0xac, 0x9a, 0xdb, 0xab, 0x88, 0x00, 0x11, 0x01, 0x31, 0x47,
+0x45, 0x43, 0x32, 0x33, 0x02, 0x00, 0xb9, 0xbe, 0xbc, 0xbc, 0xbc, 0xac, 0x9b, 0xaa, 0x8b, 0x00,
+0x00, 0x74, 0x27, 0x43, 0x22, 0x12, 0x01, 0x88, 0x98, 0xdc, 0xac, 0x9a, 0x9a, 0x8a, 0x88, 0x88,
+0x80, 0x10, 0x90, 0xbb, 0x0a, 0x81, 0xbb, 0x28, 0x92, 0xff, 0x1a, 0x33, 0x10, 0x75, 0x34, 0x34,
+0x34, 0x34, 0x23, 0x33, 0x13, 0xa8, 0xdd, 0xcd, 0xcb, 0xba, 0xab, 0xab, 0x8a, 0x08, 0x01, 0x20,
+0x22, 0x21, 0x44, 0x23, 0x32, 0x46, 0x43, 0x33, 0x44, 0x33, 0x11, 0x21, 0x91, 0x99, 0x00, 0xfa,
+0x9a, 0x10, 0x11, 0xb8, 0xec, 0xdd, 0xbd, 0xbb, 0xbb, 0xab, 0x08, 0x31, 0x54, 0x32, 0x12, 0x11,
+0x12, 0x43, 0x45, 0x34, 0x22, 0x31, 0x24, 0x23, 0x11, 0xa8, 0xcd, 0xcb, 0xdb, 0xca, 0xba, 0xaa,
+0xb9, 0xaa, 0x9a, 0x99, 0x28, 0x23, 0x34, 0x36, 0x33, 0x35, 0x43, 0x23, 0x12, 0x00, 0x00, 0x10,
+0x01, 0xaa, 0x9b, 0xca, 0x68, 0x57, 0x12, 0x00, 0x81, 0xda, 0xbb, 0xdb, 0xbd, 0xab, 0x98, 0xa9,
+0x89, 0x00, 0x08, 0x41, 0x13, 0x11, 0x73, 0x23, 0x53, 0x34, 0x13, 0x22, 0x12, 0x12, 0x23, 0x81,
+0x99, 0x88, 0xfb, 0xcf, 0x99, 0xa8, 0xaa, 0x98, 0xed, 0x9a, 0x98, 0xca, 0x8a, 0x80, 0x10, 0x32,
+0x45, 0x43, 0x43, 0x34, 0x23, 0x11, 0x11, 0x00, 0x80, 0x80, 0xeb, 0xbd, 0xab, 0xa9, 0xca, 0xaa,
+0xba, 0xcc, 0xab, 0xaa, 0xab, 0x29, 0x25, 0x12, 0x12, 0xb0, 0x9a, 0xa2, 0xdf, 0x8a, 0x30, 0x77,
+0x26, 0x33, 0x34, 0x33, 0x22, 0x90, 0xdc, 0xcb, 0xbb, 0xad, 0xab, 0x9a, 0x99, 0x98, 0x09, 0x88,
+0xba, 0x18, 0x22, 0x42, 0x57, 0x33, 0x33, 0x35, 0x12, 0x10, 0x88, 0x99, 0xba, 0x1b, 0x56, 0x24,
+0x34, 0x35, 0x24, 0x02, 0xda, 0xcc, 0xcb, 0xbb, 0xba, 0xba, 0x99, 0x18, 0x10, 0x88, 0x9a, 0x9a,
+0x62, 0x45, 0x43, 0x53, 0x43, 0x43, 0x33, 0x12, 0x01, 0x98, 0xba, 0xcb, 0xdd, 0xab, 0xaa, 0xca,
+0xab, 0xa9, 0xcb, 0x89, 0x00, 0xa9, 0x28, 0x63, 0x63, 0x43, 0x23, 0x24, 0x11, 0x11, 0x11, 0x88,
+0x88, 0xa9, 0xbd, 0xbc, 0xba, 0xbc, 0xca, 0xcc, 0x9b, 0x88, 0x21, 0x46, 0x33, 0x01, 0x11, 0x12,
+0x98, 0x9b, 0x99, 0xdb, 0xbc, 0x9a, 0x41, 0x35, 0x43, 0x81, 0xda, 0xac, 0xa9, 0x9a, 0x8a, 0x00,
+0x53, 0x43, 0x33, 0x24, 0x81, 0x99, 0x00, 0x21, 0x13, 0x11, 0x44, 0xd8, 0xbf, 0xcd, 0xac, 0xaa,
+0xcc, 0x9a, 0x08, 0x88, 0x63, 0x34, 0x45, 0x44, 0x23, 0x13, 0x80, 0xa9, 0xcc, 0xbc, 0xab, 0xbb,
+0x99, 0x08, 0x88, 0x80, 0x99, 0x9a, 0x98, 0xb9, 0xab, 0x39, 0x77, 0x33, 0x43, 0x22, 0x01, 0x42,
+0x44, 0x34, 0x43, 0x44, 0x22, 0x88, 0xb8, 0xec, 0xab, 0xcb, 0xcb, 0x9a, 0xa9, 0x88, 0x00, 0x80,
+0x00, 0x00, 0x11, 0x21, 0x63, 0x34, 0x23, 0x34, 0x82, 0x19, 0x34, 0x42, 0x45, 0x13, 0x41, 0x35,
+0x23, 0x33, 0xa2, 0xbd, 0xbd, 0xbd, 0xbb, 0xcb, 0xdb, 0x9a, 0xaa, 0xa9, 0x08, 0x21, 0x21, 0x53,
+0x12, 0x10, 0x32, 0x43, 0x56, 0x34, 0x22, 0x53, 0x24, 0x43, 0x23, 0x81, 0xba, 0xdc, 0xcb, 0xba,
+0xcc, 0xab, 0xab, 0x89, 0x08, 0x88, 0x00, 0x30, 0x34, 0x24, 0x33, 0x34, 0x44, 0x33, 0x32, 0x22,
+0x21, 0x22, 0x22, 0x12, 0x81, 0x51, 0xc2, 0xbd, 0xa9, 0xef, 0xab, 0xca, 0xbc, 0x9a, 0x99, 0x89,
+0x20, 0x12, 0x11, 0x74, 0x34, 0x21, 0x31, 0x34, 0x33, 0x24, 0x81, 0x99, 0xab, 0xab, 0xca, 0xeb,
+0xcb, 0x99, 0x98, 0xdb, 0xaa, 0xca, 0xbb, 0xa9, 0xaa, 0x18, 0x23, 0x54, 0x34, 0x81, 0x89, 0x61,
+0x24, 0x02, 0x42, 0x45, 0x42, 0x53, 0x23, 0x23, 0x13, 0x90, 0xde, 0xbc, 0xbc, 0xba, 0x9a, 0x99,
+0x89, 0x01, 0x80, 0x88, 0x01, 0x21, 0x33, 0x63, 0x35, 0x11, 0x73, 0x13, 0x10, 0x32, 0x13, 0x51,
+0x34, 0x23, 0x33, 0x24, 0x13, 0x91, 0xfc, 0xcc, 0xbc, 0xcb, 0xbb, 0xab, 0x9a, 0x9a, 0x18, 0x33,
+0x12, 0x32, 0x13, 0x80, 0x62, 0x57, 0x34, 0x23, 0x43, 0x22, 0x22, 0x42, 0x12, 0x90, 0xca, 0xcc,
+0xcb, 0xdb, 0xcb, 0xab, 0x9a, 0x99, 0x89, 0x08, 0x08, 0x52, 0x43, 0x12, 0x33, 0x24, 0x43, 0x13,
+0xa0, 0x88, 0x00, 0x40, 0x24, 0x80, 0x20, 0x01, 0x43, 0x22, 0x51, 0x93, 0xbf, 0x89, 0xd9, 0xbb,
+0xdb, 0xad, 0xaa, 0xbb, 0x09, 0x81, 0x0a, 0x42, 0x22, 0x45, 0x80, 0x0a, 0x11, 0x08, 0x80, 0x28,
+0x77, 0x43, 0x53, 0x33, 0x31, 0x24, 0x82, 0x98, 0xca, 0xbd, 0xcd, 0xbc, 0xaa, 0xba, 0x9b, 0x9a,
+0x0a, 0x31, 0x24, 0x45, 0x34, 0x33, 0x35, 0x43, 0x12, 0x01, 0x80, 0x99, 0xba, 0xaa, 0xea, 0xbd,
+0x9a, 0xa8, 0xab, 0x89, 0xdb, 0x9b, 0xa9, 0xad, 0x9b, 0x9a, 0x89, 0x18, 0x63, 0x13, 0x10, 0x67,
+0x33, 0x44, 0x43, 0x22, 0x33, 0x35, 0x33, 0x92, 0xeb, 0xdc, 0xba, 0xab, 0xbb, 0x9a, 0x98, 0x9a,
+0x08, 0xa8, 0x8b, 0x11, 0x08, 0x33, 0x63, 0x56, 0x33, 0x32, 0x33, 0x12, 0x32, 0x14, 0xb9, 0xbb,
+0x38, 0x77, 0x27, 0x23, 0x33, 0x03, 0xca, 0xcc, 0xcd, 0xba, 0xaa, 0xaa, 0x88, 0x80, 0x21, 0x81,
+0xaa, 0xa9, 0xaa, 0x40, 0x56, 0x53, 0x43, 0x43, 0x23, 0x22, 0x21, 0x22, 0x12, 0xb0, 0xce, 0xbc,
+0xcb, 0xab, 0xca, 0xac, 0xaa, 0x8a, 0x08, 0x01, 0x08, 0x52, 0x24, 0x42, 0x43, 0x32, 0x22, 0x12,
+0x22, 0x11, 0x21, 0x91, 0xbc, 0xbb, 0xdf, 0xbc, 0xba, 0xab, 0x21, 0x82, 0x38, 0x26, 0x81, 0x28,
+0x01, 0xb9, 0x9b, 0x73, 0x17, 0x00, 0x22, 0xa8, 0x0a, 0x83, 0xcd, 0x89, 0xfb, 0x9c, 0x08, 0xa9,
+0x08, 0x91, 0x9b, 0x30, 0x37, 0x53, 0x53, 0x33, 0x33, 0x24, 0x91, 0xcb, 0xcb, 0xcc, 0xbb, 0xba,
+0xbb, 0x8a, 0x98, 0x9b, 0x08, 0x31, 0x77, 0x24, 0x42, 0x23, 0x12, 0x21, 0x81, 0xca, 0xbb, 0xbc,
+0xac, 0x9a, 0x89, 0x88, 0x10, 0x02, 0xcc, 0x8a, 0xd8, 0xdc, 0xaa, 0xaa, 0xba, 0x99, 0xa9, 0xbd,
+0x39, 0x47, 0x22, 0x45, 0x34, 0x53, 0x34, 0x33, 0x24, 0x02, 0x98, 0xdc, 0xbc, 0xbc, 0xbb, 0xab,
+0x9a, 0x99, 0x00, 0x90, 0x89, 0x09, 0x20, 0x53, 0x53, 0x63, 0x43, 0x32, 0x43, 0x23, 0x01, 0x01,
+0x11, 0x11, 0x21, 0x55, 0x23, 0x90, 0x80, 0xfb, 0xae, 0xbb, 0xcd, 0xbb, 0xaa, 0x9b, 0x09, 0x00,
+0x10, 0x12, 0x22, 0x43, 0x53, 0x44, 0x34, 0x34, 0x33, 0x53, 0x22, 0x32, 0x24, 0xa1, 0x9a, 0xba,
+0xce, 0xbb, 0xcc, 0xcb, 0xab, 0x9a, 0x98, 0x9a, 0x08, 0x08, 0x41, 0x14, 0x00, 0x53, 0x34, 0x43,
+0x24, 0x00, 0x88, 0x10, 0x00, 0x08, 0x21, 0x22, 0x32, 0x67, 0x34, 0x12, 0x88, 0xc8, 0xcd, 0xbb,
+0xcc, 0xac, 0xaa, 0x99, 0x09, 0x08, 0x31, 0x33, 0x73, 0x43, 0x12, 0x53, 0x22, 0x01, 0x10, 0x90,
+0xcb, 0x8b, 0x80, 0x99, 0x50, 0x03, 0x00, 0x00, 0xfb, 0xbe, 0xab, 0xaa, 0xcb, 0x9b, 0x88, 0xba,
+0x29, 0x34, 0x21, 0x63, 0x33, 0x44, 0x36, 0x33, 0x34, 0x24, 0x02, 0x81, 0xc8, 0xcb, 0xbc, 0xad,
+0x9a, 0xaa, 0x99, 0x89, 0x08, 0x88, 0x21, 0x82, 0xab, 0x51, 0xa1, 0x89, 0x22, 0x32, 0xa2, 0x1b,
+0x37, 0xfc, 0x8b, 0x80, 0x2a, 0x67, 0x22, 0x44, 0x35, 0x34, 0x33, 0x81, 0x98, 0xdb, 0xbd, 0xbc,
+0xcb, 0xaa, 0xaa, 0x99, 0x98, 0x99, 0x88, 0x00, 0x22, 0x23, 0x43, 0x36, 0x43, 0x54, 0x24, 0x23,
+0x22, 0x32, 0x44, 0x43, 0x12, 0x11, 0x91, 0xca, 0xba, 0xed, 0xbc, 0xbc, 0xac, 0xab, 0x9a, 0x99,
+0x08, 0x20, 0x32, 0x23, 0x34, 0x43, 0x43, 0x32, 0x55, 0x43, 0x32, 0x43, 0x13, 0x11, 0x21, 0x11,
+0x90, 0xeb, 0xbb, 0xdd, 0xac, 0xaa, 0xcb, 0xaa, 0xaa, 0x9a, 0x9a, 0x88, 0x10, 0x22, 0x35, 0x35,
+0x34, 0x32, 0x22, 0x81, 0x30, 0x45, 0x02, 0x21, 0x53, 0x43, 0x54, 0x34, 0x02, 0x98, 0x98, 0xcb,
+0xcd, 0xcb, 0xcb, 0xbb, 0x9a, 0x9a, 0x9a, 0x08, 0x21, 0x52, 0x33, 0x43, 0x43, 0x44, 0x23, 0x81,
+0x00, 0x98, 0x19, 0x44, 0x24, 0x21, 0x32, 0x25, 0xa8, 0x9b, 0xe9, 0xce, 0x9a, 0xca, 0xba, 0x89,
+0x99, 0x99, 0x99, 0x00, 0x01, 0x74, 0x33, 0x32, 0x66, 0x13, 0x11, 0x22, 0x91, 0x99, 0x98, 0xfb,
+0xbb, 0x99, 0xa9, 0x09, 0x98, 0xa9, 0x09, 0xa8, 0xee, 0xcb, 0xaa, 0xaa, 0x20, 0x34, 0x22, 0x23,
+0x12, 0x80, 0xa8, 0x59, 0x77, 0x43, 0x53, 0x33, 0x44, 0x12, 0x90, 0xdb, 0xbd, 0xab, 0xaa, 0xab,
+0xa9, 0x88, 0x80, 0x00, 0x99, 0xaa, 0x29, 0x55, 0x43, 0x34, 0x33, 0x34, 0x02, 0x00, 0x00, 0xdc,
+0x89, 0x10, 0x28, 0x56, 0x33, 0x23, 0x24, 0x11, 0xa0, 0xdd, 0xcc, 0xcb, 0xaa, 0x99, 0x99, 0x08,
+0x80, 0x00, 0x80, 0xb9, 0xaa, 0x09, 0x61, 0x46, 0x34, 0x23, 0x53, 0x34, 0x33, 0x43, 0x02, 0x99,
+0x80, 0xc9, 0xcd, 0xca, 0xcb, 0x9b, 0xaa, 0xbb, 0xaa, 0xa9, 0x88, 0x11, 0x53, 0x43, 0x42, 0x35,
+0x12, 0x21, 0x33, 0x22, 0x22, 0x22, 0xa0, 0xcf, 0x8a, 0x80, 0x99, 0x62, 0x34, 0x23, 0x11, 0x11,
+0xd8, 0xbd, 0xac, 0xbc, 0xbb, 0xba, 0xaa, 0x9a, 0x9a, 0x98, 0x00, 0x21, 0x53, 0x45, 0x12, 0x32,
+0x34, 0x62, 0x55, 0x23, 0x11, 0x01, 0x31, 0x35, 0x02, 0x99, 0xdc, 0xcc, 0xaa, 0xcb, 0xab, 0xac,
+0x8a, 0x88, 0x88, 0x21, 0x22, 0x52, 0x34, 0x23, 0x35, 0x32, 0x63, 0x33, 0x13, 0x32, 0x02, 0xcb,
+0xbd, 0xbb, 0xcb, 0xbc, 0xba, 0xdb, 0xab, 0xba, 0x9b, 0xaa, 0x9c, 0x30, 0x23, 0x55, 0x82, 0x09,
+0x54, 0x22, 0x64, 0x23, 0x11, 0x45, 0x22, 0x33, 0x13, 0xb8, 0xdc, 0xcc, 0xbb, 0xcb, 0xbb, 0x9a,
+0x99, 0x08, 0x01, 0x88, 0x00, 0x31, 0x43, 0x33, 0x44, 0x45, 0x22, 0x12, 0x10, 0x22, 0x82, 0x99,
+0x00, 0x50, 0x77, 0x25, 0x11, 0x43, 0x13, 0x98, 0xeb, 0xcd, 0xab, 0xaa, 0x8a, 0x09, 0x08, 0x00,
+0x90, 0xba, 0xbd, 0xab, 0x19, 0x45, 0x35, 0x35, 0x34, 0x33, 0x22, 0x34, 0x13, 0x80, 0xa9, 0xeb,
+0xbc, 0xab, 0xcb, 0xbc, 0xac, 0xa9, 0x9a, 0x88, 0xa9, 0x09, 0x43, 0x35, 0x35, 0x23, 0x22, 0x22,
+0x23, 0x81, 0x89, 0x98, 0xac, 0x09, 0xd8, 0xbc, 0x88, 0xaa, 0x50, 0x26, 0x21, 0x53, 0x82, 0xaa,
+0xb9, 0xbc, 0x8a, 0xc8, 0xac, 0x89, 0xca, 0xac, 0x99, 0x98, 0x18, 0x90, 0x9a, 0x31, 0x82, 0x8b,
+0x67, 0x13, 0x10, 0x77, 0x43, 0x22, 0x32, 0x13, 0xa8, 0x9a, 0xb9, 0xdf, 0xbb, 0xcb, 0xac, 0x89,
+0xa9, 0x0a, 0x11, 0x99, 0x51, 0x36, 0x33, 0x35, 0x43, 0x22, 0x11, 0x81, 0xba, 0xac, 0xbb, 0xbe,
+0x9a, 0x99, 0x89, 0xa9, 0xbb, 0x89, 0x90, 0xba, 0xcd, 0xab, 0xa9, 0xbb, 0x29, 0x14, 0x88, 0x50,
+0x34, 0x63, 0x55, 0x53, 0x44, 0x12, 0x42, 0x54, 0x12, 0x01, 0xa0, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb,
+0xab, 0x08, 0x10, 0x00, 0x00, 0x80, 0x80, 0x10, 0x54, 0x44, 0x43, 0x34, 0x24, 0x11, 0x11, 0x00,
+0x10, 0x53, 0x44, 0x44, 0x33, 0x33, 0x03, 0xda, 0xce, 0xcc, 0xab, 0xbb, 0x9b, 0x09, 0x88, 0x20,
+0x23, 0x00, 0x08, 0x11, 0x51, 0x54, 0x35, 0x34, 0x23, 0x33, 0x34, 0x01, 0x10, 0x01, 0xca, 0x9b,
+0xcc, 0xac, 0xaa, 0xdc, 0xbc, 0xca, 0xaa, 0x89, 0x08, 0x80, 0x32, 0x44, 0x33, 0x22, 0x33, 0x23,
+0x42, 0x34, 0x02, 0x41, 0x24, 0xc9, 0x9b, 0xb9, 0xce, 0x89, 0x32, 0x12, 0x18, 0x23, 0xa0, 0x18,
+0xa2, 0xef, 0x9a, 0x88, 0x98, 0x88, 0x00, 0xfa, 0xaa, 0xa9, 0xad, 0x09, 0x10, 0x21, 0x11, 0x32,
+0x92, 0x1c, 0x67, 0x23, 0x43, 0x25, 0x22, 0x53, 0x13, 0x80, 0xb9, 0xbe, 0xac, 0xba, 0xbc, 0xbb,
+0x9a, 0x99, 0x89, 0x10, 0x98, 0x9b, 0x73, 0x14, 0x43, 0x35, 0x22, 0x44, 0x32, 0x01, 0x98, 0x9a,
+0xba, 0xac, 0x31, 0x81, 0x2a, 0x16, 0xfa, 0xad, 0xa9, 0xbc, 0x9a, 0x9a, 0x8b, 0x21, 0x01, 0x80,
+0xb9, 0x0b, 0x47, 0x23, 0x55, 0x45, 0x43, 0x43, 0x23, 0x01, 0xb9, 0xaa, 0xdc, 0xcb, 0xba, 0xbb,
+0xab, 0x9a, 0xa9, 0xab, 0x9a, 0x01, 0x20, 0x57, 0x02, 0x20, 0x35, 0x22, 0x53, 0x23, 0x11, 0x00,
+0x88, 0x98, 0x9b, 0x72, 0x14, 0x88, 0x42, 0x33, 0x45, 0x12, 0xb9, 0xcf, 0xcb, 0xba, 0xcb, 0xbb,
+0x9a, 0x09, 0x20, 0x11, 0x00, 0x11, 0x22, 0x44, 0x34, 0x44, 0x34, 0x22, 0x53, 0x32, 0x43, 0x35,
+0x24, 0x22, 0x01, 0x98, 0xb9, 0xdd, 0xdb, 0xbc, 0xbb, 0xbc, 0xac, 0x9a, 0xa9, 0x09, 0x00, 0x21,
+0x63, 0x34, 0x35, 0x33, 0x33, 0x53, 0x23, 0x02, 0x81, 0x98, 0x99, 0x88, 0xc9, 0xdc, 0xcb, 0x9b,
+0xa9, 0xdb, 0xcb, 0xcb, 0x9a, 0xa9, 0xba, 0x99, 0x20, 0x77, 0x33, 0x22, 0x33, 0x23, 0x42, 0x01,
+0x99, 0xba, 0xcb, 0xab, 0xbc, 0xbb, 0xcd, 0x9b, 0x88, 0xbc, 0x2a, 0x23, 0x20, 0x37, 0x02, 0x08,
+0x10, 0x98, 0xa8, 0xce, 0xbb, 0x0a, 0x63, 0x24, 0x34, 0x34, 0x11, 0x32, 0x35, 0x01, 0x81, 0xfa,
+0xbb, 0xaa, 0xdc, 0xaa, 0xa8, 0xaa, 0x08, 0x80, 0xba, 0xba, 0xcd, 0x8b, 0x21, 0x34, 0x24, 0x33,
+0x25, 0x01, 0x18, 0x90, 0x0c, 0x67, 0x34, 0x53, 0x24, 0x11, 0x22, 0x21, 0x80, 0xdc, 0xbd, 0xbc,
+0xcb, 0xaa, 0xaa, 0xaa, 0x89, 0x08, 0x88, 0x89, 0x31, 0x63, 0x54, 0x34, 0x32, 0x44, 0x32, 0x32,
+0x33, 0x22, 0x00, 0xa8, 0xcb, 0xbd, 0xad, 0xab, 0xba, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xdb, 0xab,
+0x88, 0x21, 0x44, 0x23, 0x44, 0x33, 0x22, 0x43, 0x02, 0x98, 0x00, 0x10, 0x63, 0x24, 0x63, 0x44,
+0x23, 0x12, 0x02, 0xcb, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xba, 0x9a, 0xb9, 0xaa, 0x18, 0x51,
+0x45, 0x24, 0x11, 0x53, 0x33, 0x33, 0x35, 0x23, 0x32, 0x34, 0x24, 0x10, 0x99, 0xdc, 0xbb, 0xbc,
+0xcd, 0xbb, 0xbb, 0xbb, 0x09, 0x98, 0x0a, 0x32, 0x24, 0x53, 0x12, 0x11, 0x44, 0x34, 0x43, 0x43,
+0x22, 0x81, 0x10, 0x24, 0x01, 0x88, 0xc9, 0x9a, 0x99, 0xca, 0xce, 0xbd, 0xac, 0xbb, 0xab, 0x8a,
+0x89, 0x11, 0x10, 0x73, 0x35, 0x33, 0x43, 0x23, 0x11, 0x10, 0x88, 0x98, 0x00, 0x80, 0x08, 0xa1,
+0xab, 0xc9, 0xdf, 0x09, 0x01, 0xca, 0xbc, 0xca, 0xbd, 0xad, 0xab, 0x9b, 0x29, 0x34, 0x43, 0x12,
+0x80, 0x30, 0x64, 0x53, 0x23, 0x21, 0x43, 0x22, 0x53, 0x23, 0xa8, 0xcc, 0xdb, 0xcb, 0xab, 0xbb,
+0x9a, 0x18, 0x22, 0x54, 0x23, 0xa8, 0xcb, 0xbb, 0xab, 0x28, 0xa2, 0xcc, 0x08, 0xd8, 0x9d, 0x00,
+0x90, 0xba, 0x89, 0x20, 0x75, 0x55, 0x45, 0x44, 0x23, 0x23, 0x00, 0xca, 0xcc, 0xcb, 0xaa, 0x9a,
+0x89, 0x08, 0x90, 0xca, 0xbb, 0xcc, 0xab, 0x19, 0x21, 0x45, 0x34, 0x44, 0x23, 0x33, 0x22, 0x12,
+0x43, 0x02, 0x00, 0x98, 0xeb, 0xbb, 0xcd, 0xcb, 0xbb, 0xac, 0x9a, 0x98, 0x88, 0x99, 0x88, 0x08,
+0x43, 0x35, 0x22, 0x44, 0x24, 0x33, 0x33, 0x13, 0x01, 0xb9, 0x09, 0x91, 0x9a, 0xa8, 0xbf, 0xab,
+0xc9, 0x8a, 0x44, 0x82, 0xcb, 0xab, 0xbb, 0x08, 0xa0, 0xbd, 0x89, 0xfa, 0xad, 0x88, 0x88, 0x21,
+0x33, 0x02, 0xa9, 0x0a, 0x44, 0x01, 0x52, 0x33, 0x65, 0x33, 0x32, 0x57, 0x12, 0x08, 0x12, 0xb8,
+0xad, 0xbb, 0xcc, 0xab, 0xba, 0xac, 0xab, 0xbc, 0xcb, 0xac, 0xaa, 0x30, 0x47, 0x34, 0x44, 0x24,
+0x12, 0x12, 0x82, 0x88, 0xa8, 0xcc, 0xbb, 0xcb, 0xbc, 0xaa, 0xbb, 0xbb, 0x9b, 0x01, 0xb8, 0x38,
+0x27, 0x01, 0x01, 0xb9, 0xac, 0xa9, 0x50, 0x46, 0x42, 0x35, 0x25, 0x32, 0x34, 0x22, 0x12, 0x00,
+0xb9, 0xbc, 0xcc, 0xbe, 0xbc, 0xba, 0xbc, 0x9a, 0x9a, 0xaa, 0x89, 0x20, 0x32, 0x44, 0x24, 0x12,
+0x43, 0x34, 0x43, 0x44, 0x11, 0x31, 0x53, 0x33, 0x34, 0x23, 0x10, 0x80, 0x99, 0x99, 0xef, 0xcc,
+0xcb, 0xcb, 0xab, 0xab, 0x99, 0x08, 0x11, 0x22, 0x32, 0x23, 0x32, 0x46, 0x44, 0x43, 0x43, 0x33,
+0x23, 0x32, 0x34, 0x13, 0x00, 0x99, 0xcd, 0xbd, 0xbc, 0xbc, 0xbc, 0xbb, 0xaa, 0xaa, 0x08, 0x88,
+0x18, 0x31, 0x42, 0x45, 0x24, 0x34, 0x33, 0x33, 0x22, 0x01, 0x22, 0x91, 0xaa, 0x62, 0x53, 0x54,
+0x22, 0x01, 0x80, 0xfb, 0xcb, 0xbc, 0xad, 0xba, 0xa9, 0x89, 0x88, 0x00, 0x11, 0x21, 0x22, 0x43,
+0x45, 0x44, 0x32, 0x32, 0x22, 0x12, 0x10, 0x21, 0x81, 0x98, 0x89, 0x88, 0xb8, 0xde, 0xcc, 0xcc,
+0xba, 0xcb, 0xcb, 0xaa, 0xa9, 0x99, 0x00, 0x80, 0x73, 0x25, 0x21, 0x52, 0x22, 0x21, 0x34, 0x02,
+0x80, 0x80, 0xba, 0xab, 0x00, 0xea, 0xab, 0x11, 0xd9, 0x8c, 0xb8, 0xdf, 0x9a, 0x88, 0xba, 0x8b,
+0x11, 0x81, 0x53, 0x04, 0x89, 0x61, 0x14, 0x10, 0x63, 0x24, 0x22, 0x25, 0x82, 0xa9, 0xdb, 0xcb,
+0xbb, 0xaa, 0x99, 0x8a, 0x99, 0x98, 0xa9, 0x89, 0x99, 0x39, 0x77, 0x24, 0x32, 0x34, 0x02, 0x98,
+0xaa, 0xaa, 0xda, 0xbc, 0xcb, 0xcc, 0x9a, 0x99, 0xaa, 0x08, 0x54, 0x65, 0x44, 0x33, 0x12, 0x01,
+0xa8, 0xdb, 0xba, 0xbc, 0xab, 0x9a, 0x88, 0x88, 0x98, 0xc8, 0xcd, 0xab, 0xcb, 0x9a, 0x20, 0x33,
+0x46, 0x34, 0x33, 0x43, 0x23, 0x23, 0x52, 0x34, 0x12, 0x11, 0x91, 0xce, 0xba, 0xdb, 0xac, 0xaa,
+0x9b, 0x8a, 0x08, 0x00, 0x99, 0xac, 0xa8, 0x9a, 0x51, 0x23, 0x31, 0x37, 0x12, 0x34, 0x13, 0x09,
+0x20, 0x20, 0x65, 0x45, 0x34, 0x24, 0x12, 0x01, 0xa9, 0xca, 0xdd, 0xcb, 0xaa, 0xba, 0xaa, 0x99,
+0xaa, 0x09, 0x00, 0x08, 0x11, 0x32, 0x55, 0x34, 0x35, 0x53, 0x33, 0x43, 0x22, 0x22, 0x33, 0x02,
+0x01, 0xa9, 0xbf, 0xac, 0xbc, 0xbd, 0xcb, 0xbb, 0xac, 0x9a, 0xaa, 0x8a, 0x08, 0x22, 0x53, 0x35,
+0x24, 0x43, 0x33, 0x12, 0x22, 0x24, 0x32, 0x33, 0x15, 0x02, 0x11, 0x00, 0x81, 0xfc, 0xaf, 0xbb,
+0xbc, 0xac, 0x9a, 0xa9, 0x09, 0x10, 0x01, 0x31, 0x35, 0x21, 0x55, 0x14, 0x21, 0x43, 0x13, 0x21,
+0x12, 0x90, 0xcb, 0xbc, 0xbc, 0x9b, 0x08, 0xb9, 0xac, 0xaa, 0xcf, 0x9b, 0x99, 0xbb, 0x19, 0x42,
+0x33, 0x35, 0x33, 0x21, 0x31, 0x45, 0x23, 0x42, 0x45, 0x23, 0x33, 0x12, 0xe9, 0xcc, 0xac, 0x9b,
+0xaa, 0x9a, 0x08, 0x88, 0xaa, 0xab, 0xca, 0x1a, 0x55, 0x34, 0x45, 0x23, 0x01, 0x10, 0x91, 0xcb,
+0xab, 0xa8, 0xcb, 0x8b, 0x98, 0xcd, 0xab, 0x08, 0x11, 0x53, 0x46, 0x34, 0x32, 0x22, 0x81, 0xcb,
+0xbc, 0xad, 0x9a, 0x89, 0x89, 0x31, 0x14, 0x11, 0x12, 0xc0, 0xcc, 0xac, 0xcb, 0xaa, 0xaa, 0xba,
+0xcb, 0x8a, 0x42, 0x02, 0x51, 0x44, 0x44, 0x46, 0x53, 0x33, 0x33, 0x11, 0x80, 0xcc, 0xcc, 0xcb,
+0xab, 0xaa, 0x99, 0x89, 0x88, 0x99, 0x9a, 0x99, 0xa9, 0x19, 0x56, 0x33, 0x63, 0x34, 0x33, 0x33,
+0x23, 0x12, 0x12, 0x31, 0x34, 0x12, 0xb8, 0xcc, 0xcb, 0xdd, 0xbc, 0xcb, 0xcb, 0x9b, 0x9a, 0xa9,
+0x88, 0x08, 0x30, 0x45, 0x22, 0x21, 0x43, 0x11, 0x30, 0x55, 0x23, 0x33, 0x22, 0x53, 0x43, 0x23,
+0x24, 0x91, 0xab, 0xeb, 0xcd, 0xbc, 0xbb, 0xbb, 0xab, 0xa9, 0x99, 0x08, 0x21, 0x43, 0x45, 0x34,
+0x24, 0x22, 0x33, 0x22, 0x00, 0xa8, 0xbd, 0x9a, 0xcb, 0x0a, 0x42, 0x43, 0x55, 0x23, 0x22, 0x11,
+0xa9, 0xde, 0xcb, 0xba, 0xbc, 0x9a, 0xa9, 0x9b, 0x11, 0x12, 0x44, 0x34, 0x22, 0x43, 0x35, 0x24,
+0x12, 0x10, 0x90, 0x9a, 0xb9, 0xdc, 0xaa, 0x9a, 0x09, 0x22, 0x90, 0xca, 0xcc, 0xcb, 0xba, 0xaa,
+0xbb, 0x9c, 0x11, 0xa8, 0x58, 0x25, 0x88, 0x40, 0x35, 0x24, 0x63, 0x35, 0x24, 0x23, 0x01, 0xa8,
+0xaa, 0xcc, 0xcc, 0xab, 0xbb, 0xcb, 0xab, 0x88, 0xa8, 0x19, 0x12, 0x80, 0x74, 0x13, 0x01, 0x23,
+0x01, 0x20, 0x23, 0x80, 0x80, 0x30, 0x46, 0x23, 0x42, 0x45, 0x34, 0x35, 0x24, 0x12, 0x11, 0xb8,
+0xcf, 0xcb, 0xcb, 0xcb, 0x9a, 0x99, 0x99, 0x18, 0x80, 0x88, 0x00, 0x01, 0x31, 0x44, 0x63, 0x53,
+0x22, 0x23, 0x23, 0x43, 0x44, 0x43, 0x33, 0x35, 0x23, 0x00, 0xa8, 0xdc, 0xdc, 0xca, 0xbb, 0xbb,
+0xac, 0xaa, 0x9a, 0x89, 0x11, 0x31, 0x53, 0x33, 0x35, 0x23, 0x32, 0x37, 0x12, 0x31, 0x35, 0x12,
+0x33, 0x22, 0x00, 0x81, 0xc9, 0xdc, 0xcc, 0xba, 0xbc, 0x9c, 0xaa, 0xbc, 0xaa, 0xb9, 0x99, 0x10,
+0x21, 0x43, 0x44, 0x53, 0x23, 0x11, 0x11, 0x32, 0x46, 0x43, 0x22, 0x81, 0x88, 0x52, 0x12, 0x20,
+0xb1, 0xdf, 0x9b, 0x99, 0xcb, 0xac, 0xba, 0xba, 0x09, 0x02, 0x98, 0x51, 0x34, 0x43, 0x34, 0x12,
+0x01, 0x10, 0x33, 0xd9, 0x9b, 0xa8, 0xcf, 0x89, 0xb0, 0xac, 0x19, 0x32, 0x54, 0x46, 0x23, 0x12,
+0x00, 0xa8, 0xbc, 0xab, 0xbc, 0x9b, 0x09, 0xa9, 0xba, 0xba, 0xcf, 0xaa, 0x08, 0x18, 0x42, 0x25,
+0x22, 0x34, 0x81, 0x20, 0x12, 0x28, 0x56, 0x23, 0x32, 0x12, 0xa9, 0x9a, 0xc8, 0xcf, 0xac, 0x89,
+0xa9, 0x9b, 0x98, 0xeb, 0xac, 0x89, 0x98, 0x18, 0x32, 0x35, 0x44, 0x54, 0x34, 0x11, 0x11, 0x11,
+0xa0, 0x9a, 0xa9, 0xbd, 0xba, 0x9a, 0x89, 0x99, 0x08, 0xe9, 0xce, 0xbb, 0xbb, 0xbc, 0xab, 0x89,
+0xb9, 0x9c, 0x00, 0xa9, 0x19, 0x63, 0x77, 0x43, 0x42, 0x54, 0x34, 0x33, 0x12, 0xa9, 0xcc, 0xbc,
+0xbc, 0xab, 0xba, 0x8a, 0x08, 0x00, 0x98, 0xa9, 0xa9, 0x29, 0x55, 0x32, 0x45, 0x33, 0x32, 0x33,
+0x01, 0x88, 0x99, 0x88, 0x22, 0x64, 0x45, 0x33, 0x24, 0x01, 0xca, 0xcc, 0xbd, 0xbc, 0xac, 0x9a,
+0x99, 0x88, 0x10, 0x31, 0x43, 0x12, 0x31, 0x13, 0x11, 0x35, 0x34, 0x44, 0x34, 0x22, 0x33, 0x23,
+0x11, 0x12, 0xb8, 0xdc, 0xbc, 0xcd, 0xbc, 0xac, 0xbb, 0xbb, 0x9a, 0x99, 0x09, 0x31, 0x54, 0x35,
+0x12, 0x42, 0x22, 0x11, 0x43, 0x01, 0x08, 0x10, 0x21, 0x91, 0xbb, 0xba, 0xde, 0xab, 0xaa, 0xab,
+0x20, 0x35, 0x32, 0x53, 0x03, 0xcc, 0xab, 0xea, 0xbb, 0x9a, 0xc9, 0xab, 0x1a, 0x32, 0x91, 0x61,
+0x25, 0x99, 0x38, 0x15, 0x00, 0x73, 0x23, 0x22, 0x43, 0x23, 0x22, 0x23, 0xc8, 0xce, 0xbb, 0xbc,
+0xbb, 0xab, 0xca, 0xac, 0x09, 0x98, 0x9a, 0xa8, 0x49, 0x56, 0x33, 0x36, 0x24, 0x10, 0x23, 0x81,
+0x9a, 0x98, 0xcd, 0xab, 0xaa, 0xaa, 0xba, 0x88, 0xb8, 0xad, 0xb9, 0xcf, 0x8a, 0x88, 0x08, 0x42,
+0x01, 0x52, 0x34, 0x23, 0x32, 0x54, 0x24, 0x21, 0x54, 0x12, 0x18, 0x43, 0xb0, 0xad, 0xcb, 0xbd,
+0xba, 0xbb, 0xad, 0xaa, 0x89, 0x00, 0x21, 0x34, 0x13, 0x52, 0x25, 0x01, 0x20, 0x02, 0x08, 0x10,
+0x80, 0x90, 0xdc, 0x9a, 0xdb, 0x2a, 0x67, 0x53, 0x44, 0x33, 0x12, 0x90, 0xdd, 0xbb, 0xbc, 0xab,
+0x99, 0x88, 0x10, 0x11, 0x88, 0xa9, 0xcb, 0x9a, 0x31, 0x47, 0x35, 0x34, 0x34, 0x12, 0x12, 0x12,
+0x88, 0x80, 0xd8, 0xcb, 0xca, 0xbd, 0xaa, 0xca, 0xac, 0x99, 0x99, 0x20, 0x01, 0x11, 0x22, 0x33,
+0x37, 0x24, 0x33, 0x43, 0x33, 0x24, 0x22, 0x81, 0xb8, 0xcc, 0xac, 0xaa, 0xcd, 0xaa, 0xba, 0xbb,
+0x9a, 0x10, 0x11, 0x53, 0x35, 0x02, 0x20, 0x12, 0x29, 0x37, 0x82, 0x29, 0x02, 0xbc, 0x89, 0xaa,
+0x60, 0x14, 0x08, 0x33, 0xe9, 0x0b, 0x81, 0xbe, 0x1a, 0xa1, 0xbc, 0x18, 0xc8, 0xac, 0x21, 0x82,
+0x1a, 0x47, 0x13, 0x10, 0x00, 0xc9, 0xbc, 0xaa, 0xeb, 0xbc, 0x9a, 0xba, 0x8a, 0x32, 0x65, 0x46,
+0x44, 0x34, 0x24, 0x12, 0x98, 0xda, 0xdb, 0xbb, 0xba, 0xbb, 0x89, 0x10, 0x11, 0x10, 0x98, 0xa9,
+0x9b, 0x21, 0x54, 0x55, 0x24, 0x32, 0x43, 0x12, 0x11, 0x23, 0x01, 0x11, 0x91, 0xda, 0xcc, 0xcc,
+0xaa, 0xcb, 0xbb, 0xab, 0xba, 0x8a, 0x10, 0x02, 0x80, 0x10, 0x81, 0x38, 0x67, 0x33, 0x43, 0x34,
+0x22, 0x01, 0x01, 0x80, 0x99, 0x20, 0x43, 0x32, 0x45, 0x12, 0x08, 0x11, 0x80, 0x11, 0xfd, 0xbe,
+0xdc, 0xbb, 0xcb, 0xbb, 0x8a, 0x10, 0x52, 0x44, 0x33, 0x22, 0x22, 0x11, 0x00, 0x01, 0x01, 0x20,
+0x32, 0x54, 0x83, 0xca, 0xda, 0xdd, 0xaa, 0xaa, 0xaa, 0x99, 0xac, 0x38, 0x04, 0x89, 0x01, 0x80,
+0x73, 0x33, 0x52, 0x33, 0x63, 0x44, 0x22, 0x00, 0xb9, 0xac, 0xba, 0xbc, 0xbc, 0xcb, 0x9a, 0x08,
+0x00, 0x98, 0x8a, 0x42, 0x13, 0x21, 0x46, 0x44, 0x43, 0x22, 0x88, 0x88, 0xb0, 0xbe, 0x8a, 0xc8,
+0xbd, 0x09, 0xda, 0xad, 0x89, 0x80, 0x18, 0x44, 0x46, 0x63, 0x33, 0x22, 0x91, 0xa9, 0xbc, 0xcc,
+0xbb, 0xba, 0x9b, 0x08, 0x11, 0x00, 0x80, 0xa9, 0xaa, 0xa9, 0xa9, 0x40, 0x44, 0x53, 0x43, 0x23,
+0x31, 0x12, 0x11, 0x63, 0x64, 0x45, 0x33, 0x34, 0x02, 0x90, 0xa8, 0xfb, 0xdb, 0xcb, 0xbb, 0xba,
+0x99, 0x99, 0x88, 0x08, 0x01, 0x22, 0x33, 0x33, 0x46, 0x33, 0x33, 0x45, 0x34, 0x33, 0x24, 0x12,
+0x22, 0x34, 0x33, 0x34, 0x90, 0xbc, 0xdb, 0xce, 0xcb, 0xbb, 0xad, 0xab, 0xa9, 0x98, 0x08, 0x21,
+0x22, 0x45, 0x24, 0x10, 0x22, 0x02, 0x31, 0x45, 0x33, 0x33, 0x12, 0x32, 0x24, 0x22, 0x34, 0xc0,
+0xbd, 0xaa, 0xeb, 0xcc, 0xbb, 0xbc, 0xac, 0x99, 0x99, 0x9b, 0x28, 0x23, 0x63, 0x34, 0x12, 0x52,
+0x24, 0x12, 0x22, 0x01, 0x88, 0x00, 0x80, 0x10, 0x10, 0x31, 0x35, 0x22, 0x25, 0xfa, 0xbe, 0xca,
+0xcc, 0xab, 0xba, 0xaa, 0x19, 0x11, 0x42, 0x34, 0x43, 0x34, 0x43, 0x34, 0x13, 0x10, 0x00, 0x99,
+0x98, 0xea, 0xcc, 0xbb, 0xaa, 0x99, 0x18, 0x33, 0x01, 0x41, 0x83, 0xbb, 0x88, 0xfc, 0xbb, 0xa9,
+0x8a, 0x52, 0x13, 0x80, 0x20, 0x81, 0x8a, 0x76, 0x33, 0x32, 0x47, 0x33, 0x11, 0x12, 0xb0, 0xbd,
+0xcb, 0xbc, 0xad, 0x9b, 0xaa, 0x89, 0x88, 0x00, 0x32, 0x44, 0x12, 0x99, 0x89, 0x09, 0x43, 0x81,
+0x29, 0x34, 0xa8, 0xca, 0xef, 0xaa, 0x08, 0x40, 0x46, 0x33, 0x65, 0x34, 0x23, 0x12, 0xa8, 0xdc,
+0xbb, 0xbc, 0xbc, 0xaa, 0x99, 0x88, 0x01, 0x88, 0x08, 0x80, 0x11, 0x24, 0x33, 0x64, 0x44, 0x32,
+0x33, 0x23, 0x18, 0x21, 0x21, 0x63, 0x23, 0x11, 0x43, 0x81, 0xaa, 0xdd, 0xbe, 0xbd, 0xcb, 0xab,
+0xab, 0x9b, 0x99, 0x09, 0x21, 0x53, 0x53, 0x43, 0x32, 0x23, 0x23, 0x01, 0x42, 0x35, 0x23, 0x21,
+0x13, 0x20, 0x55, 0x14, 0x98, 0xba, 0xcd, 0xab, 0xcb, 0xcd, 0xaa, 0xaa, 0xaa, 0x8a, 0x99, 0x08,
+0x63, 0x44, 0x32, 0x32, 0x23, 0x80, 0x10, 0x80, 0x8b, 0x21, 0x22, 0x66, 0x23, 0x01, 0x31, 0x33,
+0x03, 0xeb, 0xab, 0xcd, 0xcb, 0xcb, 0xcc, 0xaa, 0xa9, 0x99, 0x09, 0x20, 0x32, 0x45, 0x34, 0x32,
+0x45, 0x23, 0x01, 0x00, 0x98, 0xcb, 0xbd, 0xab, 0xba, 0x8b, 0x64, 0x23, 0x42, 0x33, 0xa8, 0xbb,
+0xdb, 0xbd, 0xbb, 0xbb, 0xba, 0xab, 0x88, 0xdc, 0x1a, 0x35, 0x80, 0x72, 0x27, 0x33, 0x35, 0x23,
+0x01, 0x88, 0xba, 0xdd, 0xbb, 0xba, 0xac, 0x9a, 0x99, 0x9a, 0x10, 0x80, 0xaa, 0x29, 0x22, 0x53,
+0x36, 0x13, 0x33, 0x46, 0x32, 0x32, 0x12, 0x21, 0x23, 0x01, 0x50, 0x13, 0xdb, 0x0a, 0xfa, 0xac,
+0x08, 0xd9, 0xab, 0x98, 0xcc, 0x9a, 0x99, 0xbb, 0xac, 0x18, 0x21, 0x42, 0x35, 0x12, 0x88, 0xa9,
+0x18, 0x35, 0x32, 0x55, 0x45, 0x24, 0x43, 0x53, 0x12, 0x81, 0x00, 0xca, 0xcd, 0xba, 0xbb, 0xbc,
+0x8a, 0xa9, 0x9b, 0x99, 0xa9, 0x09, 0x20, 0x22, 0x33, 0x56, 0x24, 0x33, 0x54, 0x23, 0x32, 0x34,
+0x43, 0x53, 0x43, 0x22, 0x90, 0xba, 0xeb, 0xcc, 0xac, 0xbb, 0xca, 0xa9, 0x98, 0x99, 0x09, 0x21,
+0x32, 0x53, 0x33, 0x22, 0x64, 0x24, 0x01, 0x21, 0x11, 0x11, 0x31, 0x23, 0x91, 0x89, 0xa8, 0xeb,
+0xba, 0xfc, 0xbc, 0x9a, 0xcb, 0xad, 0x89, 0x99, 0x89, 0x12, 0x98, 0x30, 0x45, 0x44, 0x24, 0x22,
+0x43, 0x33, 0x02, 0x88, 0x89, 0x98, 0xbb, 0x9b, 0xfa, 0xbf, 0x89, 0xb8, 0xcc, 0xa9, 0xb9, 0xac,
+0x08, 0x88, 0x8a, 0x62, 0x43, 0x21, 0x32, 0x82, 0xa9, 0x71, 0x25, 0x23, 0x34, 0x23, 0x42, 0x54,
+0x33, 0x23, 0x80, 0xfb, 0xbe, 0xbb, 0xbc, 0xab, 0xaa, 0x99, 0x18, 0x13, 0x01, 0x21, 0x32, 0x43,
+0x35, 0x34, 0x45, 0x23, 0x12, 0x11, 0x81, 0x08, 0x22, 0xa0, 0x8a, 0x42, 0x35, 0x43, 0x13, 0xa8,
+0xac, 0xeb, 0xcf, 0xac, 0xcb, 0xab, 0x99, 0x89, 0x00, 0x10, 0x42, 0x33, 0x10, 0x11, 0x81, 0x30,
+0x37, 0x44, 0x24, 0x33, 0x36, 0x22, 0x33, 0x35, 0x00, 0x99, 0xda, 0xbb, 0xbc, 0xcc, 0xbc, 0xca,
+0xaa, 0x89, 0x99, 0x09, 0x01, 0x11, 0x42, 0x22, 0x32, 0x32, 0x24, 0x02, 0x88, 0x64, 0x35, 0x44,
+0x33, 0x23, 0x53, 0x34, 0x32, 0x02, 0xb8, 0xcd, 0xdb, 0xcc, 0xaa, 0xaa, 0xbb, 0x89, 0x99, 0x9a,
+0x10, 0x12, 0x80, 0x52, 0x13, 0x53, 0x46, 0x12, 0x11, 0x22, 0x11, 0x42, 0x35, 0x23, 0x22, 0x21,
+0x11, 0x11, 0xfa, 0xbf, 0xac, 0xbc, 0xaa, 0x9a, 0xaa, 0x9a, 0x80, 0x88, 0x38, 0x46, 0x12, 0x51,
+0x35, 0x22, 0x53, 0x23, 0x88, 0x08, 0xa8, 0xbb, 0xab, 0xeb, 0xbc, 0x09, 0x12, 0x99, 0x18, 0xd8,
+0xbe, 0xba, 0xcc, 0x9b, 0x88, 0x40, 0x35, 0x22, 0x21, 0x91, 0xac, 0x99, 0x98, 0x51, 0x45, 0x44,
+0x44, 0x34, 0x22, 0x01, 0xa0, 0xcc, 0xbc, 0xcb, 0xcb, 0xab, 0x99, 0x98, 0x00, 0x00, 0x01, 0x21,
+0x01, 0x21, 0x36, 0x25, 0x43, 0x33, 0x11, 0x22, 0x02, 0x99, 0x90, 0xdd, 0x2a, 0x55, 0x12, 0x43,
+0x14, 0x11, 0x21, 0xb0, 0xde, 0xac, 0xbb, 0xcb, 0xaa, 0xaa, 0x99, 0x00, 0x80, 0x80, 0x80, 0x08,
+0x32, 0x34, 0x63, 0x54, 0x44, 0x44, 0x43, 0x32, 0x22, 0x22, 0x01, 0x99, 0xca, 0xcd, 0xad, 0xab,
+0xbb, 0xcb, 0x99, 0xa8, 0x89, 0x01, 0xa0, 0x8a, 0x42, 0x21, 0x42, 0x35, 0x33, 0x43, 0x54, 0x33,
+0x32, 0x23, 0x02, 0xa8, 0x9a, 0x88, 0xbb, 0x2a, 0x14, 0xbd, 0x29, 0x93, 0xae, 0x54, 0xa1, 0xcd,
+0xbb, 0xdd, 0xbb, 0xab, 0xaa, 0x9a, 0x20, 0x13, 0x20, 0x34, 0xa0, 0x59, 0x37, 0x43, 0x45, 0x34,
+0x33, 0x33, 0x23, 0x90, 0xbd, 0xbd, 0xdb, 0xaa, 0xaa, 0xab, 0x8a, 0x99, 0x88, 0x88, 0x99, 0x09,
+0x10, 0x53, 0x24, 0x43, 0x35, 0x34, 0x32, 0x32, 0x31, 0x21, 0x00, 0x38, 0x67, 0x02, 0x00, 0x90,
+0xcc, 0x8a, 0xea, 0xcb, 0xbb, 0xbd, 0x9a, 0x00, 0x80, 0x88, 0x31, 0x23, 0x31, 0x67, 0x13, 0x21,
+0x44, 0x23, 0x33, 0x14, 0x98, 0x8a, 0xb9, 0xbc, 0xbc, 0xcd, 0xac, 0xab, 0xba, 0xac, 0x8a, 0xa9,
+0x28, 0x45, 0x22, 0x44, 0x23, 0x21, 0x22, 0x11, 0x00, 0x10, 0x33, 0xa2, 0xab, 0xc8, 0xff, 0xab,
+0x9a, 0x8a, 0x41, 0x46, 0x22, 0x21, 0x22, 0x98, 0x99, 0xed, 0xac, 0x8a, 0x89, 0x08, 0x12, 0x01,
+0x10, 0x02, 0xe9, 0xcc, 0xab, 0xbb, 0xbb, 0x8a, 0xa8, 0x28, 0x57, 0x32, 0x63, 0x34, 0x44, 0x44,
+0x32, 0x23, 0x02, 0x98, 0xeb, 0xbc, 0xad, 0xbb, 0x9b, 0x8a, 0x99, 0x99, 0x99, 0x9a, 0xba, 0x9a,
+0x20, 0x55, 0x55, 0x33, 0x43, 0x43, 0x22, 0x11, 0x01, 0x01, 0x20, 0x11, 0x98, 0x99, 0xea, 0xbc,
+0xbb, 0xcd, 0xcb, 0xab, 0xbc, 0xab, 0xba, 0xbb, 0x9c, 0x00, 0x21, 0x42, 0x44, 0x43, 0x22, 0x22,
+0x42, 0x43, 0x34, 0x43, 0x43, 0x12, 0x21, 0x45, 0x01, 0x80, 0xa8, 0xcb, 0xbc, 0xbd, 0xad, 0xbc,
+0xba, 0xa9, 0xa9, 0x99, 0x88, 0x30, 0x45, 0x22, 0x32, 0x53, 0x23, 0x22, 0x14, 0x01, 0x08, 0x11,
+0x12, 0x11, 0x52, 0x24, 0x42, 0x46, 0x23, 0x81, 0xa8, 0xcd, 0xcc, 0xcb, 0x9b, 0xab, 0xab, 0x88,
+0xa9, 0x29, 0x34, 0x00, 0x63, 0x24, 0x10, 0x63, 0x22, 0x11, 0x43, 0x81, 0xa9, 0x89, 0xa9, 0x9b,
+0x51, 0x33, 0x21, 0x91, 0xaa, 0xba, 0xef, 0xab, 0xcc, 0xbd, 0x9a, 0x99, 0x8a, 0x90, 0x19, 0x44,
+0x13, 0x51, 0x44, 0x33, 0x53, 0x24, 0x21, 0x01, 0x10, 0x00, 0xd9, 0xbd, 0xab, 0xcb, 0x9c, 0x88,
+0xc9, 0x0a, 0x91, 0xcb, 0x9a, 0xa0, 0xbb, 0x29, 0x35, 0x23, 0x11, 0x11, 0x80, 0x09, 0x67, 0x43,
+0x44, 0x23, 0x42, 0x65, 0x43, 0x22, 0x13, 0x98, 0xcb, 0xdc, 0xdb, 0xba, 0xba, 0x9a, 0x09, 0x08,
+0x00, 0x01, 0x00, 0x08, 0x32, 0x45, 0x45, 0x13, 0x22, 0x22, 0x81, 0x89, 0x08, 0x98, 0x19, 0x35,
+0x44, 0x55, 0x24, 0x43, 0x34, 0x02, 0xda, 0xdb, 0xbc, 0xcb, 0xba, 0xaa, 0x9a, 0x08, 0x22, 0x12,
+0x80, 0x80, 0x20, 0x63, 0x43, 0x43, 0x44, 0x34, 0x34, 0x32, 0x32, 0x11, 0x01, 0x90, 0xb9, 0xdc,
+0xbd, 0xba, 0xcb, 0xbd, 0xbb, 0xbb, 0xaa, 0x98, 0xcb, 0x8b, 0x42, 0x23, 0x63, 0x34, 0x22, 0x22,
+0x13, 0x20, 0x43, 0x02, 0x18, 0x64, 0x53, 0x43, 0x44, 0x01, 0x98, 0x08, 0xba, 0xce, 0xac, 0xcb,
+0xaa, 0x8a, 0xa9, 0x99, 0x00, 0x32, 0x44, 0x23, 0x11, 0x11, 0x31, 0x33, 0x12, 0x02, 0xa9, 0x72,
+0x25, 0x42, 0x44, 0x32, 0x44, 0x12, 0x22, 0xc8, 0xce, 0xaa, 0xcb, 0xab, 0xaa, 0xaa, 0x9a, 0x08,
+0x10, 0x32, 0x35, 0x33, 0x63, 0x44, 0x22, 0x31, 0x13, 0x90, 0x88, 0xc9, 0x9d, 0x18, 0x91, 0x19,
+0x34, 0x13, 0x80, 0xcb, 0xbe, 0xce, 0xbb, 0xaa, 0xbb, 0x9b, 0x28, 0x33, 0x22, 0x32, 0x25, 0xba,
+0x69, 0x37, 0x44, 0x44, 0x24, 0x12, 0x12, 0x90, 0xb9, 0xcd, 0xbb, 0xba, 0xbb, 0xbb, 0xcc, 0xba,
+0xaa, 0x99, 0x19, 0x43, 0x33, 0x35, 0x34, 0x11, 0x11, 0x21, 0x53, 0x24, 0x02, 0x00, 0x80, 0x50,
+0x46, 0x33, 0x32, 0x23, 0x11, 0x90, 0xdd, 0xcc, 0xbb, 0xbb, 0xaa, 0xba, 0xb9, 0xce, 0xab, 0x88,
+0xa8, 0x88, 0x11, 0x80, 0x08, 0x00, 0xb8, 0xbd, 0x58, 0x77, 0x24, 0x31, 0x53, 0x44, 0x34, 0x23,
+0x81, 0xa8, 0xcc, 0xdb, 0xaa, 0xab, 0xac, 0x9a, 0x98, 0xa9, 0x9a, 0x99, 0x89, 0x00, 0x20, 0x54,
+0x43, 0x53, 0x34, 0x43, 0x23, 0x12, 0x42, 0x25, 0x12, 0x31, 0x01, 0x98, 0xa9, 0xcf, 0xad, 0xbb,
+0xba, 0xbb, 0xbc, 0xb9, 0xab, 0x19, 0x21, 0x22, 0x34, 0x63, 0x35, 0x22, 0x02, 0x90, 0xaa, 0x70,
+0x35, 0x13, 0x21, 0x34, 0x01, 0x52, 0x03, 0xec, 0xaa, 0xa9, 0xdb, 0x9a, 0xa9, 0xbb, 0x09, 0x01,
+0x08, 0x41, 0x03, 0x18, 0x75, 0x22, 0x12, 0x22, 0x01, 0x89, 0x81, 0xba, 0xab, 0xfa, 0xac, 0x9a,
+0xcb, 0x9b, 0x01, 0x10, 0x55, 0x34, 0x23, 0x23, 0x32, 0x22, 0xa8, 0x09, 0x90, 0xad, 0x08, 0xfa,
+0xbe, 0xcb, 0xbb, 0xcb, 0xdb, 0xaa, 0x10, 0x44, 0x22, 0x32, 0x23, 0x11, 0x34, 0x82, 0x29, 0x55,
+0x32, 0x45, 0x01, 0x99, 0xb9, 0xcd, 0xaa, 0xbb, 0x9b, 0x99, 0x99, 0xa8, 0xde, 0xcb, 0xba, 0xac,
+0x28, 0x44, 0x55, 0x43, 0x22, 0x32, 0x11, 0x00, 0x80, 0xda, 0x9a, 0xa9, 0xcc, 0xaa, 0xcc, 0xaa,
+0x9a, 0xaa, 0x98, 0xa9, 0x19, 0x82, 0x99, 0x00, 0x00, 0x76, 0x34, 0x23, 0x43, 0x22, 0x43, 0x34,
+0x43, 0x33, 0x32, 0x32, 0x34, 0x23, 0xa0, 0xdd, 0xbd, 0xbd, 0xcb, 0xbc, 0xcb, 0xaa, 0x9a, 0x89,
+0x00, 0x18, 0x12, 0x98, 0x0a, 0x52, 0x54, 0x44, 0x33, 0x45, 0x43, 0x43, 0x43, 0x12, 0x00, 0x98,
+0xbb, 0xcc, 0xcb, 0xbb, 0xbc, 0xab, 0xab, 0xcb, 0xac, 0xab, 0x9a, 0x10, 0x22, 0x55, 0x23, 0x43,
+0x33, 0x11, 0x42, 0x33, 0x41, 0x44, 0x23, 0x22, 0x44, 0x23, 0x11, 0xb9, 0xce, 0xbb, 0xbc, 0xcb,
+0xcb, 0xbb, 0xab, 0xab, 0x99, 0x88, 0x00, 0x32, 0x53, 0x45, 0x43, 0x43, 0x22, 0x21, 0x42, 0x12,
+0x31, 0x33, 0x02, 0x80, 0x21, 0x82, 0x99, 0xc9, 0xff, 0xab, 0xca, 0xcc, 0xab, 0xab, 0xaa, 0x9a,
+0x09, 0x21, 0x34, 0x24, 0x32, 0x36, 0x33, 0x45, 0x23, 0x11, 0x32, 0x22, 0x98, 0xb9, 0xeb, 0xbc,
+0x9b, 0x08, 0x08, 0x01, 0xb8, 0xce, 0xcc, 0xcb, 0xbb, 0xab, 0x99, 0x00, 0x21, 0x22, 0xa1, 0x9c,
+0x74, 0x24, 0x12, 0x53, 0x53, 0x46, 0x34, 0x23, 0x01, 0x98, 0xbb, 0xbd, 0xbd, 0xcc, 0xaa, 0x99,
+0x89, 0x89, 0x90, 0x98, 0x80, 0x10, 0x31, 0x26, 0x22, 0x63, 0x44, 0x33, 0x33, 0x23, 0x22, 0x80,
+0x08, 0x01, 0xcc, 0xbc, 0xba, 0xaa, 0x9a, 0x98, 0xfa, 0xbc, 0x08, 0xc9, 0xbd, 0x99, 0xbb, 0x9c,
+0x08, 0x08, 0x10, 0x43, 0x12, 0x22, 0x82, 0x8a, 0x24, 0x98, 0x72, 0x43, 0x67, 0x35, 0x22, 0x45,
+0x12, 0x80, 0x80, 0xda, 0xbc, 0xba, 0xbb, 0xac, 0xaa, 0x98, 0x99, 0x00, 0x88, 0x9a, 0x00, 0x20,
+0x46, 0x32, 0x44, 0x33, 0x32, 0x26, 0x01, 0x28, 0x44, 0x12, 0x43, 0x13, 0xa8, 0x0a, 0x14, 0xfc,
+0xcb, 0xa9, 0xcb, 0x9a, 0x90, 0xba, 0x8b, 0x00, 0x00, 0x41, 0x13, 0x98, 0x60, 0x23, 0x10, 0x64,
+0x01, 0x18, 0x25, 0x01, 0x63, 0x24, 0x11, 0x01, 0xa0, 0x99, 0xa9, 0xbe, 0xcd, 0xba, 0xba, 0xaa,
+0x9a, 0xcb, 0x9b, 0x00, 0x8a, 0x73, 0x27, 0x21, 0x34, 0x33, 0x23, 0x13, 0x80, 0xaa, 0xba, 0xcc,
+0xeb, 0xbb, 0xac, 0x9a, 0x89, 0x98, 0x99, 0x18, 0x24, 0x23, 0x22, 0x34, 0x81, 0x9b, 0x11, 0xa8,
+0xda, 0xcc, 0x8a, 0xfb, 0xaf, 0x18, 0x02, 0x10, 0x74, 0x54, 0x34, 0x33, 0x13, 0x80, 0xc9, 0xdb,
+0xbc, 0xcb, 0xbb, 0x9a, 0x10, 0x80, 0x08, 0x00, 0xbb, 0xbd, 0xca, 0x9a, 0x10, 0x54, 0x34, 0x34,
+0x33, 0x22, 0x52, 0x44, 0x34, 0x33, 0x24, 0x10, 0x98, 0xda, 0xbc, 0xcd, 0xbb, 0xab, 0xa9, 0x9a,
+0x00, 0x98, 0x00, 0x11, 0x90, 0x89, 0x52, 0x24, 0x21, 0x53, 0x12, 0x52, 0x26, 0x01, 0x20, 0x43,
+0x53, 0x44, 0x35, 0x12, 0x01, 0x80, 0xea, 0xbd, 0xbb, 0xbc, 0x9c, 0x99, 0x98, 0x80, 0x00, 0x09,
+0x08, 0x10, 0x20, 0x33, 0x55, 0x43, 0x32, 0x36, 0x34, 0x21, 0x22, 0x12, 0x22, 0x25, 0x12, 0x98,
+0xcb, 0xcc, 0xdc, 0xcb, 0xbc, 0xba, 0xaa, 0x99, 0x89, 0x10, 0x21, 0x35, 0x24, 0x32, 0x34, 0x32,
+0x53, 0x23, 0x10, 0x00, 0x00, 0x10, 0x02, 0xa9, 0x8a, 0x32, 0x63, 0x34, 0xb1, 0xbf, 0xcc, 0xcd,
+0xcb, 0xba, 0xbb, 0x89, 0x01, 0x31, 0x35, 0x34, 0x43, 0x33, 0x34, 0x23, 0x00, 0x88, 0xa8, 0x89,
+0x98, 0xeb, 0xdb, 0xaa, 0xaa, 0x99, 0x10, 0x14, 0x00, 0x34, 0x92, 0x8a, 0xa0, 0xff, 0x9e, 0x99,
+0xa9, 0x00, 0x12, 0x00, 0x32, 0x23, 0x30, 0x57, 0x33, 0x42, 0x53, 0x22, 0x00, 0x08, 0xb9, 0xbe,
+0xaa, 0xcb, 0xbc, 0x9a, 0x99, 0xba, 0x28, 0x13, 0xa9, 0x31, 0xc2, 0xae, 0x10, 0x01, 0x9a, 0x09,
+0xa0, 0x9c, 0x22, 0xfd, 0x8e, 0x10, 0x00, 0x75, 0x34, 0x32, 0x56, 0x23, 0x12, 0x00, 0xcb, 0xbd,
+0xbc, 0xba, 0xbb, 0xa9, 0x88, 0x00, 0x00, 0x88, 0x89, 0x01, 0x21, 0x54, 0x35, 0x35, 0x53, 0x22,
+0x11, 0x11, 0x80, 0x08, 0x10, 0x21, 0x35, 0x24, 0x11, 0xb0, 0xec, 0xeb, 0xbc, 0xbc, 0xba, 0xaa,
+0x9a, 0x88, 0x10, 0x11, 0x42, 0x35, 0x43, 0x43, 0x32, 0x12, 0x11, 0x11, 0x21, 0x32, 0x35, 0x02,
+0x08, 0x44, 0x23, 0x11, 0x80, 0xed, 0xcb, 0xcb, 0xcd, 0xac, 0x99, 0xaa, 0x89, 0x80, 0x80, 0x30,
+0x37, 0x24, 0x43, 0x33, 0x01, 0x00, 0x81, 0xca, 0xbb, 0xdb, 0xab, 0x19, 0x00, 0x53, 0x34, 0x34,
+0x24, 0x22, 0x82, 0xda, 0xcc, 0xdb, 0xbb, 0x9a, 0xaa, 0x9a, 0x08, 0x00, 0x11, 0x74, 0x43, 0x43,
+0x34, 0x23, 0x11, 0x01, 0xb9, 0xbe, 0xba, 0xbc, 0xab, 0x89, 0xaa, 0x40, 0x34, 0x22, 0x33, 0x82,
+0x99, 0xda, 0xcd, 0xbc, 0xac, 0x99, 0x98, 0x00, 0x13, 0x90, 0x30, 0x45, 0x22, 0x54, 0x23, 0x33,
+0x65, 0x35, 0x25, 0x23, 0x23, 0xa8, 0xcc, 0xdb, 0xcc, 0x9b, 0xaa, 0x9b, 0x08, 0x88, 0x08, 0x01,
+0x98, 0x09, 0x11, 0x73, 0x44, 0x34, 0x34, 0x22, 0x33, 0x12, 0x80, 0xa8, 0xa9, 0x28, 0x43, 0x23,
+0x90, 0x98, 0xfb, 0xaf, 0xbb, 0xcd, 0xbb, 0xbb, 0xcb, 0xbb, 0x9b, 0x88, 0x09, 0x73, 0x33, 0x32,
+0x44, 0x21, 0x32, 0x43, 0x24, 0x43, 0x43, 0x13, 0x31, 0x34, 0x81, 0x10, 0xc0, 0xcf, 0x9a, 0xca,
+0xbc, 0xaa, 0xcb, 0xaa, 0x80, 0xa8, 0x8a, 0x20, 0x35, 0x43, 0x44, 0x23, 0x23, 0x43, 0x12, 0x99,
+0x99, 0xaa, 0x9a, 0x89, 0x9a, 0xda, 0xdb, 0xaa, 0x88, 0x80, 0x30, 0x36, 0x34, 0x43, 0x43, 0x24,
+0x81, 0x18, 0x23, 0x99, 0x08, 0xfc, 0xaf, 0xb9, 0xcb, 0xab, 0xdb, 0xac, 0x89, 0x00, 0x10, 0x18,
+0x01, 0x10, 0x62, 0x36, 0x34, 0x45, 0x43, 0x33, 0x23, 0x12, 0x90, 0xcc, 0xac, 0xbb, 0xcc, 0xbb,
+0xba, 0xaa, 0x89, 0x99, 0x99, 0x80, 0x11, 0x64, 0x23, 0x00, 0x21, 0x34, 0x33, 0x35, 0x01, 0x00,
+0x63, 0x34, 0x43, 0x25, 0x02, 0xa8, 0x89, 0xc9, 0xdc, 0xba, 0xca, 0xbb, 0xbc, 0xaa, 0x98, 0xa9,
+0x89, 0x10, 0x42, 0x34, 0x53, 0x46, 0x33, 0x54, 0x43, 0x02, 0x80, 0x99, 0xca, 0xcb, 0xaa, 0xca,
+0xbb, 0x9b, 0xaa, 0xbc, 0xbb, 0x8b, 0x50, 0x46, 0x43, 0x32, 0x32, 0x21, 0x11, 0x80, 0x98, 0xba,
+0xbe, 0xbc, 0xbd, 0xab, 0x99, 0x89, 0x43, 0x34, 0x56, 0x44, 0x22, 0x00, 0xb9, 0xcb, 0xbb, 0xbc,
+0xbb, 0x89, 0x09, 0x41, 0x34, 0x12, 0x08, 0x01, 0xc9, 0xae, 0x89, 0x98, 0xa9, 0x9a, 0xda, 0xab,
+0x09, 0xa8, 0x1a, 0x77, 0x36, 0x53, 0x63, 0x43, 0x22, 0x01, 0xb8, 0xcd, 0xcb, 0xba, 0xaa, 0x9a,
+0x89, 0x00, 0x11, 0x98, 0xb9, 0xba, 0x8a, 0x41, 0x46, 0x35, 0x34, 0x32, 0x32, 0x13, 0x01, 0x18,
+0x11, 0x10, 0x21, 0xa0, 0xcc, 0xaa, 0xdc, 0xbc, 0xcb, 0xbe, 0xab, 0xb9, 0xdb, 0x9a, 0x99, 0x9b,
+0x31, 0x34, 0x32, 0x45, 0x24, 0x21, 0x32, 0x03, 0x09, 0x63, 0x34, 0x42, 0x32, 0x01, 0x11, 0x12,
+0xa9, 0xcb, 0xdd, 0xcc, 0xcb, 0xbb, 0x9a, 0xba, 0xaa, 0x08, 0x00, 0x42, 0x23, 0x62, 0x34, 0x22,
+0x32, 0x01, 0x89, 0x08, 0x10, 0x21, 0xa8, 0x3a, 0x47, 0xa0, 0xab, 0xea, 0x0a, 0x56, 0x33, 0x63,
+0x13, 0xb8, 0x8a, 0xc9, 0xad, 0x8a, 0xb9, 0xac, 0x88, 0xb9, 0xaa, 0xc9, 0xbc, 0x0b, 0x20, 0x32,
+0x43, 0x63, 0x33, 0x31, 0x45, 0x33, 0x32, 0x35, 0x33, 0x44, 0x24, 0x11, 0x10, 0xda, 0xbd, 0xaa,
+0xcd, 0xaa, 0xaa, 0xab, 0xaa, 0xa9, 0xaa, 0x9a, 0x41, 0x33, 0x64, 0x36, 0x24, 0x43, 0x33, 0x11,
+0x80, 0x88, 0xaa, 0xcc, 0xaa, 0xaa, 0x99, 0x08, 0xd9, 0xbc, 0x9a, 0xcb, 0xbb, 0xdb, 0xbb, 0x9a,
+0x89, 0x41, 0xa1, 0xbe, 0x9b, 0xcb, 0x39, 0x77, 0x24, 0x43, 0x34, 0x44, 0x34, 0x12, 0x98, 0xcb,
+0xbd, 0xcb, 0xba, 0xaa, 0x9a, 0x08, 0x00, 0x80, 0x98, 0xba, 0x08, 0x31, 0x54, 0x44, 0x43, 0x53,
+0x22, 0x11, 0x01, 0x98, 0x8a, 0x21, 0x52, 0x45, 0x34, 0x01, 0x00, 0x80, 0xfb, 0xbc, 0xdb, 0xdb,
+0x9a, 0x98, 0x99, 0x08, 0x00, 0x20, 0x32, 0x11, 0x31, 0x33, 0x43, 0x32, 0x35, 0x55, 0x34, 0x23,
+0x53, 0x23, 0x11, 0x22, 0xa0, 0xcb, 0xeb, 0xbd, 0xbb, 0xcc, 0xaa, 0x9a, 0x99, 0x99, 0x89, 0x11,
+0x11, 0x63, 0x24, 0x11, 0x42, 0x13, 0x11, 0x22, 0x24, 0x12, 0x42, 0x34, 0x01, 0x9a, 0x20, 0x80,
+0x09, 0x43, 0xc0, 0xbb, 0xca, 0xdd, 0xcc, 0xcc, 0x9a, 0x89, 0x98, 0x10, 0xa8, 0xab, 0x38, 0x92,
+0xac, 0x71, 0x13, 0x08, 0x65, 0x23, 0x10, 0x21, 0x02, 0x9a, 0x51, 0x35, 0x01, 0x42, 0x04, 0xdb,
+0x8a, 0xb9, 0xbc, 0xbb, 0xbb, 0xa9, 0xec, 0xab, 0x98, 0xeb, 0x9a, 0x52, 0x23, 0x43, 0x36, 0x14,
+0x32, 0x23, 0x91, 0x9a, 0xbc, 0xad, 0x9a, 0xbb, 0xbc, 0xaa, 0x8a, 0x09, 0x88, 0x00, 0x41, 0x34,
+0x80, 0x21, 0xa3, 0xdf, 0x0a, 0x91, 0xcc, 0x09, 0x24, 0x11, 0x41, 0x54, 0x34, 0x34, 0x54, 0x22,
+0x01, 0x00, 0xa8, 0xcd, 0xbc, 0xcb, 0xab, 0x99, 0x99, 0x08, 0x80, 0x88, 0xa9, 0xba, 0xbb, 0x9b,
+0x51, 0x23, 0x42, 0x65, 0x34, 0x24, 0x01, 0x41, 0x35, 0x44, 0x34, 0x14, 0x00, 0x08, 0xa9, 0xdc,
+0xbb, 0xbc, 0xac, 0x9b, 0xa9, 0x9a, 0x9a, 0xa8, 0x89, 0x09, 0x08, 0x61, 0x34, 0x43, 0x34, 0x34,
+0x24, 0x43, 0x34, 0x32, 0x33, 0x43, 0x32, 0x11, 0xa8, 0xdd, 0xcc, 0xcb, 0xab, 0xac, 0xaa, 0xaa,
+0x9a, 0x88, 0x80, 0x90, 0x08, 0x42, 0x34, 0x33, 0x34, 0x12, 0x32, 0x57, 0x34, 0x22, 0x00, 0x42,
+0x32, 0x44, 0x24, 0x81, 0x99, 0xb8, 0xcd, 0xac, 0xbc, 0xbd, 0x9a, 0x99, 0x99, 0x89, 0x00, 0x10,
+0x34, 0x24, 0x22, 0x21, 0x21, 0x32, 0x35, 0x33, 0x42, 0x33, 0x43, 0x53, 0x23, 0x20, 0x42, 0x13,
+0x00, 0x13, 0xfa, 0xbf, 0xcb, 0xbd, 0xbb, 0xaa, 0x9b, 0x99, 0x98, 0x20, 0x43, 0x44, 0x43, 0x22,
+0x32, 0x33, 0x34, 0x23, 0x21, 0x21, 0x80, 0x18, 0x22, 0x11, 0x18, 0x74, 0x83, 0xcd, 0xab, 0xeb,
+0xbe, 0xbb, 0xab, 0xbb, 0x89, 0x80, 0x99, 0x00, 0x08, 0x52, 0x03, 0x8a, 0x77, 0x35, 0x42, 0x53,
+0x23, 0x12, 0x12, 0x90, 0xca, 0xcb, 0xdb, 0xab, 0xba, 0xbb, 0xbb, 0xaa, 0xcb, 0xbc, 0xab, 0x99,
+0x18, 0x33, 0x14, 0x22, 0x34, 0x44, 0x44, 0x24, 0x32, 0x44, 0x23, 0x43, 0x45, 0x43, 0x32, 0x01,
+0xaa, 0xac, 0xbc, 0xad, 0xbb, 0xad, 0x8a, 0x10, 0x88, 0xaa, 0xcc, 0xcb, 0x99, 0x98, 0x8a, 0x10,
+0x11, 0x22, 0x33, 0x34, 0x45, 0x64, 0x33, 0x63, 0x54, 0x33, 0x33, 0x23, 0x81, 0xba, 0xcd, 0xbc,
+0xcc, 0xba, 0xaa, 0x9a, 0x89, 0xa8, 0x99, 0x89, 0x98, 0x09, 0x22, 0x43, 0x55, 0x33, 0x34, 0x33,
+0x35, 0x24, 0x22, 0x44, 0x33, 0x21, 0x53, 0x82, 0xa9, 0x98, 0xfc, 0xbc, 0xac, 0xba, 0xab, 0x99,
+0xa9, 0x9a, 0x10, 0x21, 0x23, 0x24, 0x33, 0x44, 0x24, 0x12, 0x22, 0x01, 0x51, 0x45, 0x22, 0x43,
+0x22, 0x11, 0x34, 0x14, 0x98, 0xb9, 0xdf, 0xaa, 0xba, 0xbd, 0xbb, 0xba, 0x9b, 0x18, 0x32, 0x43,
+0x34, 0x25, 0x43, 0x43, 0x12, 0x88, 0x80, 0xb9, 0x9b, 0x11, 0xc8, 0xac, 0x28, 0x33, 0x33, 0x63,
+0x22, 0x22, 0x03, 0xec, 0xcc, 0xbd, 0xac, 0x9a, 0x99, 0x88, 0x99, 0x09, 0x01, 0xca, 0x58, 0x35,
+0x32, 0x74, 0x44, 0x33, 0x44, 0x13, 0x80, 0xaa, 0xbc, 0xbd, 0xcb, 0xba, 0xab, 0x88, 0x88, 0x08,
+0x01, 0xb9, 0x8b, 0x43, 0x81, 0x38, 0x25, 0x31, 0x66, 0x24, 0x23, 0x23, 0x22, 0x11, 0x31, 0x34,
+0x11, 0x21, 0xe9, 0xad, 0xa9, 0xce, 0x9b, 0xba, 0xac, 0x89, 0x80, 0x18, 0x22, 0x82, 0xdc, 0x8a,
+0x00, 0x80, 0x52, 0x23, 0x81, 0x0a, 0x32, 0xf9, 0x9b, 0x52, 0x43, 0x53, 0x45, 0x34, 0x33, 0x34,
+0x13, 0xb9, 0xdb, 0xcc, 0xbc, 0xab, 0xba, 0xab, 0x98, 0x98, 0x08, 0x33, 0x82, 0x09, 0x53, 0x02,
+0x32, 0x24, 0x02, 0x40, 0x45, 0x54, 0x24, 0x12, 0x22, 0x24, 0x22, 0x33, 0xa0, 0xbb, 0xec, 0xcc,
+0xab, 0xcc, 0xab, 0xa9, 0xa9, 0xaa, 0x8a, 0x10, 0x42, 0x36, 0x33, 0x22, 0x35, 0x22, 0x20, 0x12,
+0xb8, 0x8b, 0x22, 0xa8, 0x38, 0x82, 0x58, 0x57, 0x01, 0x80, 0xb9, 0xbf, 0x9a, 0xcb, 0xcb, 0xaa,
+0xca, 0xab, 0x99, 0x09, 0x98, 0x28, 0x57, 0x34, 0x64, 0x43, 0x23, 0x22, 0x01, 0x99, 0xba, 0xcd,
+0xbc, 0xbb, 0xbb, 0xba, 0xa9, 0x99, 0x11, 0x02, 0x89, 0x52, 0x13, 0x18, 0x24, 0xd8, 0x8c, 0x62,
+0x23, 0x52, 0x33, 0x01, 0x53, 0x44, 0x22, 0x43, 0x33, 0x00, 0x99, 0xdb, 0xce, 0xba, 0xca, 0xcb,
+0x9a, 0x89, 0x98, 0x80, 0x88, 0xa9, 0x88, 0x20, 0x31, 0x12, 0x98, 0x20, 0x25, 0x64, 0x46, 0x22,
+0x43, 0x46, 0x33, 0x53, 0x24, 0x02, 0x88, 0xa9, 0xdd, 0xbb, 0xac, 0xac, 0x9a, 0x98, 0x88, 0x08,
+0x00, 0x89, 0x10, 0x12, 0x20, 0x54, 0x34, 0x33, 0x34, 0x24, 0x23, 0x02, 0x10, 0x63, 0x35, 0x32,
+0x53, 0x82, 0xaa, 0xba, 0xfd, 0xcb, 0xaa, 0xbb, 0x9b, 0x99, 0x08, 0x01, 0x21, 0x35, 0x12, 0x32,
+0x24, 0x00, 0x31, 0x22, 0x31, 0x04, 0x08, 0x55, 0x23, 0x63, 0x33, 0x10, 0x73, 0x13, 0x99, 0xa9,
+0xdd, 0xcc, 0xba, 0xab, 0xab, 0x99, 0x08, 0x10, 0x42, 0x34, 0x24, 0x34, 0x35, 0x12, 0x12, 0x02,
+0xaa, 0x09, 0x90, 0xbd, 0xcc, 0xbc, 0x9a, 0xba, 0x19, 0x25, 0x00, 0x42, 0x91, 0xbb, 0x09, 0x99,
+0x19, 0x43, 0x12, 0x30, 0x77, 0x17, 0x80, 0x00, 0xb8, 0xbc, 0x89, 0x08, 0x18, 0x34, 0x91, 0x08,
+0x00, 0x89, 0x81, 0xdf, 0x9b, 0x88, 0x18, 0x45, 0x02, 0x88, 0x18, 0x81, 0x98, 0x52, 0x23, 0xa8,
+0xcb, 0xde, 0xcc, 0xcb, 0xba, 0xcb, 0xaa, 0x28, 0x12, 0x72, 0x44, 0x21, 0x65, 0x35, 0x13, 0x02,
+0x90, 0xdb, 0xab, 0xdb, 0xab, 0xab, 0x99, 0x00, 0x81, 0x98, 0xba, 0xcb, 0x9a, 0x00, 0x53, 0x55,
+0x43, 0x33, 0x33, 0x23, 0x11, 0x00, 0x12, 0x81, 0x40, 0x14, 0xd9, 0x9a, 0xe9, 0xcd, 0x9a, 0x99,
+0x9b, 0x09, 0x81, 0xa8, 0x89, 0xb9, 0xae, 0x19, 0x02, 0x20, 0x45, 0x24, 0x33, 0x23, 0xb8, 0xbb,
+0x99, 0x18, 0x67, 0x43, 0x23, 0x43, 0x44, 0x12, 0x80, 0xb9, 0xce, 0xab, 0xba, 0xbb, 0xba, 0xac,
+0x8a, 0x11, 0x21, 0x22, 0x44, 0x23, 0x32, 0x26, 0x91, 0x9a, 0x80, 0x80, 0x11, 0x80, 0x88, 0x62,
+0x54, 0x02, 0xb8, 0xbc, 0x9c, 0x28, 0x23, 0xc9, 0xae, 0x30, 0x34, 0x64, 0x25, 0x81, 0x09, 0x12,
+0xba, 0xbb, 0xdd, 0xad, 0x9a, 0x99, 0xa8, 0xa9, 0x89, 0x00, 0x10, 0x80, 0xab, 0x71, 0x46, 0x53,
+0x23, 0x23, 0x44, 0x22, 0x10, 0x80, 0xcc, 0x9b, 0xa9, 0xbb, 0x99, 0xca, 0xcc, 0xbb, 0xbc, 0xbb,
+0x9a, 0x01, 0x00, 0x55, 0x33, 0x34, 0x35, 0x02, 0x10, 0x12, 0x00, 0x11, 0x82, 0x9a, 0x00, 0xa9,
+0xac, 0xbc, 0x19, 0xd1, 0xff, 0x99, 0xda, 0x9b, 0x08, 0x99, 0x8a, 0x88, 0xbb, 0x0b, 0x44, 0x23,
+0x65, 0x36, 0x34, 0x44, 0x34, 0x22, 0x90, 0xb9, 0xbe, 0xbd, 0xaa, 0xaa, 0x9a, 0x88, 0x80, 0x00,
+0x01, 0xba, 0x09, 0x33, 0x22, 0x75, 0x34, 0x22, 0x32, 0x24, 0x02, 0x80, 0x98, 0x08, 0x61, 0x45,
+0x32, 0x21, 0x22, 0x90, 0xdb, 0xdc, 0xcd, 0xbb, 0xac, 0x9a, 0x89, 0x08, 0x00, 0x31, 0x33, 0x23,
+0x10, 0x21, 0x42, 0x44, 0x32, 0x45, 0x34, 0x43, 0x34, 0x11, 0x08, 0x32, 0x02, 0x98, 0xca, 0xee,
+0xac, 0xaa, 0xbb, 0x9c, 0x99, 0xaa, 0x08, 0x21, 0x00, 0x52, 0x23, 0x21, 0x42, 0x23, 0x12, 0x23,
+0x13, 0x42, 0x35, 0x11, 0x42, 0x33, 0x41, 0x56, 0x23, 0x12, 0x12, 0xca, 0xad, 0xdb, 0xcc, 0xac,
+0x99, 0xa9, 0x0a, 0x11, 0x99, 0x30, 0x13, 0x80, 0x51, 0x35, 0x24, 0x33, 0x25, 0x80, 0x18, 0x90,
+0xbd, 0x18, 0x90, 0x58, 0x36, 0x02, 0x00, 0xa8, 0xdd, 0xbb, 0xaa, 0xbc, 0x9b, 0x09, 0x09, 0x41,
+0x03, 0x08, 0x22, 0xc0, 0x78, 0x37, 0x33, 0x63, 0x43, 0x11, 0x00, 0xa9, 0xdc, 0xca, 0xba, 0xaa,
+0x9b, 0x99, 0x89, 0x00, 0x11, 0x00, 0x32, 0x43, 0x33, 0x46, 0x23, 0x81, 0x10, 0x80, 0x38, 0x37,
+0x90, 0x08, 0xa0, 0x2a, 0x77, 0x24, 0x22, 0x81, 0xaa, 0x08, 0x90, 0xeb, 0xdc, 0xbc, 0x8a, 0x00,
+0x98, 0x89, 0xba, 0x9a, 0x10, 0x98, 0xbb, 0xac, 0x40, 0x13, 0xbb, 0x72, 0x07, 0x10, 0x55, 0x23,
+0x41, 0x45, 0x32, 0x23, 0x13, 0xa8, 0xcb, 0xcd, 0xbb, 0xcb, 0xab, 0xaa, 0xba, 0xaa, 0xcb, 0xbb,
+0x99, 0x18, 0x01, 0x41, 0x47, 0x12, 0x41, 0x34, 0x22, 0x42, 0x23, 0x43, 0x45, 0x33, 0x21, 0x12,
+0xb8, 0xdb, 0xcc, 0xcc, 0xcb, 0x9a, 0x99, 0x99, 0x08, 0x80, 0x08, 0x11, 0x98, 0x08, 0x11, 0x41,
+0x37, 0x12, 0x81, 0x90, 0x18, 0x55, 0x22, 0x43, 0x24, 0x32, 0x46, 0x24, 0x21, 0x80, 0xb9, 0xdc,
+0xbb, 0xcc, 0xbb, 0xab, 0x9a, 0x09, 0x88, 0x00, 0x43, 0x33, 0x44, 0x33, 0x80, 0x08, 0x12, 0x43,
+0x24, 0x91, 0xaa, 0x8a, 0x01, 0x28, 0x77, 0x23, 0x31, 0x46, 0x12, 0x90, 0xb9, 0xce, 0xac, 0x9a,
+0x9a, 0xab, 0x89, 0x80, 0x18, 0x53, 0x01, 0x20, 0x45, 0x12, 0x53, 0x43, 0x12, 0x08, 0x81, 0xb9,
+0x9d, 0x89, 0xcb, 0xad, 0x18, 0x12, 0x10, 0x35, 0xa1, 0xae, 0x99, 0xcc, 0xab, 0x98, 0x89, 0x18,
+0x11, 0x02, 0x99, 0x99, 0xeb, 0x0b, 0x65, 0x32, 0x65, 0x45, 0x34, 0x32, 0x12, 0xa9, 0xdb, 0xbc,
+0xbc, 0xbb, 0xbb, 0x9a, 0x11, 0x00, 0x00, 0x81, 0xb9, 0x0a, 0x31, 0x53, 0x65, 0x33, 0x24, 0x23,
+0x13, 0x11, 0x10, 0x88, 0x9a, 0x62, 0x45, 0x32, 0x22, 0x91, 0xcb, 0xdb, 0xeb, 0xcb, 0xbb, 0xab,
+0x99, 0x99, 0xaa, 0xa9, 0x88, 0x18, 0x01, 0x21, 0x33, 0x34, 0x45, 0x53, 0x54, 0x34, 0x34, 0x43,
+0x33, 0x34, 0x33, 0x23, 0x91, 0xdb, 0xcc, 0xcc, 0xcb, 0xbb, 0xab, 0x9a, 0x89, 0x88, 0x80, 0x22,
+0x34, 0x22, 0x23, 0x82, 0x40, 0x26, 0x91, 0x88, 0x90, 0x08, 0x23, 0x00, 0x32, 0x73, 0x77, 0x34,
+0x24, 0x13, 0x01, 0x98, 0xcb, 0xcc, 0xcc, 0xaa, 0x99, 0x99, 0x10, 0x90, 0x09, 0x11, 0x80, 0xa9,
+0xcb, 0x89, 0x08, 0x72, 0x36, 0x21, 0x21, 0x12, 0x20, 0x53, 0x12, 0x32, 0x36, 0x24, 0x02, 0x08,
+0xa0, 0xce, 0xbb, 0xbb, 0xbd, 0x9c, 0xaa, 0xcb, 0x9b, 0x88, 0x89, 0x20, 0x53, 0x45, 0x34, 0x43,
+0x33, 0x12, 0x11, 0xa0, 0xcb, 0xcb, 0xbb, 0x89, 0xa9, 0x9c, 0x10, 0xc9, 0x09, 0x82, 0xaa, 0xa9,
+0xde, 0x9a, 0x98, 0xab, 0x99, 0xdb, 0xaa, 0xcd, 0xbc, 0x9a, 0x58, 0x67, 0x23, 0x35, 0x44, 0x33,
+0x32, 0x90, 0xda, 0xcc, 0xdb, 0xaa, 0xa9, 0x99, 0x00, 0x11, 0x80, 0x08, 0x99, 0xbb, 0x38, 0x24,
+0x42, 0x46, 0x23, 0x32, 0x43, 0x13, 0x80, 0x88, 0x88, 0x18, 0x65, 0x43, 0x12, 0x01, 0x00, 0xb8,
+0xce, 0xdb, 0xcc, 0xab, 0xaa, 0xaa, 0x99, 0x88, 0x00, 0x21, 0x32, 0x33, 0x34, 0x24, 0x33, 0x55,
+0x24, 0x23, 0x33, 0x35, 0x43, 0x33, 0x25, 0x02, 0x08, 0xa8, 0xce, 0xbb, 0xce, 0xab, 0xa9, 0xb9,
+0x88, 0x01, 0x08, 0x30, 0x13, 0x11, 0x32, 0x12, 0x28, 0x46, 0x02, 0x18, 0x22, 0x11, 0x54, 0x13,
+0x98, 0x2a, 0x77, 0x34, 0x32, 0x33, 0x82, 0x99, 0xb8, 0xed, 0xbc, 0xac, 0x9a, 0xa9, 0x99, 0xa8,
+0xac, 0x19, 0x02, 0x89, 0x41, 0x01, 0x40, 0x47, 0x32, 0x31, 0x21, 0x01, 0x81, 0x20, 0x12, 0x30,
+0x37, 0x92, 0x18, 0x92, 0xaf, 0x89, 0xfb, 0xad, 0x99, 0xca, 0x8a, 0x08, 0xa9, 0xba, 0x88, 0x99,
+0x72, 0x47, 0x11, 0x22, 0x43, 0x22, 0x22, 0x01, 0xdb, 0x9c, 0x88, 0xca, 0xac, 0x89, 0xaa, 0xab,
+0x9a, 0x99, 0x09, 0x54, 0x13, 0x21, 0x23, 0xc9, 0xac, 0x99, 0xaa, 0x0a, 0xc8, 0xbe, 0x48, 0x45,
+0x53, 0x44, 0x32, 0x53, 0x43, 0x32, 0x00, 0xb8, 0xec, 0xbc, 0xbb, 0xcb, 0xaa, 0x88, 0x00, 0x00,
+0x01, 0x98, 0x9a, 0x89, 0x18, 0x44, 0x44, 0x42, 0x53, 0x22, 0x22, 0x12, 0x22, 0x81, 0x20, 0x67,
+0x43, 0x22, 0x22, 0x12, 0x98, 0xeb, 0xdd, 0xcb, 0xcb, 0xaa, 0x99, 0x89, 0x08, 0x10, 0x10, 0x11,
+0x01, 0x21, 0x63, 0x43, 0x53, 0x43, 0x23, 0x23, 0x34, 0x22, 0x20, 0x21, 0x80, 0x99, 0x08, 0xf9,
+0xbd, 0xbc, 0xcd, 0xaa, 0x9a, 0xab, 0x8a, 0xaa, 0x8b, 0x01, 0xb9, 0x39, 0x35, 0x33, 0x47, 0x13,
+0x11, 0x21, 0x43, 0x43, 0x35, 0x33, 0x42, 0x44, 0x12, 0x11, 0x82, 0xeb, 0xab, 0xdb, 0xcc, 0xbb,
+0xbb, 0x99, 0x88, 0x00, 0x22, 0x22, 0x32, 0x44, 0x12, 0x98, 0x10, 0x01, 0x30, 0x12, 0xdb, 0x9a,
+0xbb, 0xed, 0xcc, 0x89, 0x11, 0x72, 0x37, 0x34, 0x33, 0x24, 0x01, 0x99, 0xcb, 0xcc, 0xac, 0x9a,
+0xaa, 0x89, 0x99, 0xaa, 0x08, 0x98, 0x10, 0x01, 0x00, 0x73, 0x36, 0x12, 0x11, 0x11, 0x90, 0x18,
+0x22, 0x46, 0x34, 0x34, 0x35, 0x22, 0x98, 0xaa, 0xcd, 0xbb, 0xbc, 0xdb, 0xab, 0x99, 0xaa, 0x89,
+0xb9, 0xbc, 0x29, 0x44, 0x34, 0x63, 0x43, 0x43, 0x43, 0x22, 0x00, 0x80, 0xa8, 0xaa, 0xac, 0xcb,
+0xcc, 0x9a, 0x99, 0x99, 0x88, 0xdb, 0x89, 0xb9, 0xad, 0x00, 0xba, 0x0c, 0x02, 0xda, 0xab, 0x08,
+0x20, 0x65, 0x33, 0x44, 0x45, 0x44, 0x43, 0x24, 0x22, 0x11, 0x90, 0xcb, 0xbd, 0xbd, 0xbb, 0xbb,
+0xab, 0x8a, 0xa9, 0x9a, 0x8a, 0x98, 0x88, 0x31, 0x44, 0x52, 0x64, 0x43, 0x32, 0x43, 0x32, 0x33,
+0x35, 0x22, 0x22, 0x12, 0x88, 0x99, 0xed, 0xbc, 0xcc, 0xba, 0xac, 0xab, 0xb9, 0xba, 0x89, 0x80,
+0x08, 0x22, 0x43, 0x45, 0x23, 0x34, 0x24, 0x21, 0x34, 0x23, 0x22, 0x25, 0x24, 0x33, 0x21, 0x33,
+0x92, 0xba, 0xdc, 0xdf, 0xbb, 0xbb, 0xbb, 0xbb, 0xa9, 0xa9, 0x09, 0x11, 0x11, 0x21, 0x34, 0x34,
+0x54, 0x24, 0x22, 0x02, 0x00, 0x32, 0x24, 0x42, 0x24, 0x32, 0x65, 0x34, 0x43, 0x13, 0xa0, 0xdb,
+0xbc, 0xbb, 0xae, 0xbb, 0xba, 0x89, 0x08, 0x88, 0x00, 0x08, 0x31, 0x32, 0x21, 0x43, 0x55, 0x44,
+0x32, 0x22, 0x98, 0x08, 0x80, 0x10, 0x35, 0x34, 0x63, 0x33, 0x80, 0x09, 0xb8, 0xef, 0xaa, 0xba,
+0xbc, 0x99, 0x99, 0x89, 0xb9, 0xad, 0x19, 0x23, 0x63, 0x45, 0x43, 0x33, 0x24, 0x11, 0x91, 0xba,
+0xac, 0xaa, 0xac, 0x99, 0xbb, 0x9a, 0xa0, 0x9a, 0x81, 0xb9, 0x18, 0xfa, 0x9a, 0x81, 0xab, 0x81,
+0xff, 0x8b, 0x01, 0xce, 0x9b, 0x88, 0x08, 0x74, 0x35, 0x33, 0x44, 0x34, 0x24, 0x12, 0x91, 0xdb,
+0xcb, 0xcb, 0xcb, 0xa9, 0xaa, 0x09, 0x80, 0x99, 0x9a, 0x99, 0xaa, 0x40, 0x24, 0x11, 0x64, 0x23,
+0x32, 0x45, 0x12, 0x11, 0x34, 0x34, 0x53, 0x43, 0x13, 0x90, 0x98, 0xfb, 0xbc, 0xca, 0xcb, 0xba,
+0xaa, 0xa9, 0x89, 0x09, 0x98, 0x88, 0x10, 0x21, 0x22, 0x55, 0x44, 0x32, 0x54, 0x33, 0x23, 0x43,
+0x24, 0x22, 0x32, 0x23, 0x00, 0x98, 0xdd, 0xcd, 0xbb, 0xbc, 0xac, 0x9b, 0xaa, 0x99, 0x09, 0x88,
+0x10, 0x10, 0x41, 0x34, 0x22, 0x54, 0x43, 0x32, 0x33, 0x32, 0x11, 0x40, 0x36, 0x34, 0x42, 0x23,
+0x22, 0x82, 0xb9, 0xdd, 0xdd, 0xbb, 0xbb, 0xac, 0x9a, 0xa8, 0x89, 0x11, 0x22, 0x33, 0x24, 0x11,
+0x31, 0x42, 0x63, 0x33, 0x43, 0x33, 0x12, 0x21, 0x13, 0x01, 0x20, 0x55, 0x35, 0x82, 0x10, 0xd8,
+0xcf, 0x99, 0xca, 0xac, 0x9a, 0xaa, 0x09, 0x12, 0x01, 0x32, 0x24, 0x22, 0x43, 0x34, 0x23, 0x43,
+0x24, 0x01, 0x11, 0xa1, 0xdc, 0x89, 0xc9, 0x9c, 0x20, 0x03, 0x18, 0x25, 0xd8, 0xac, 0xa9, 0xeb,
+0x9a, 0x80, 0x99, 0x30, 0x13, 0xb9, 0x19, 0x14, 0xfb, 0x0b, 0x46, 0x22, 0x73, 0x34, 0x13, 0x11,
+0x80, 0x98, 0xca, 0xcc, 0xba, 0xaa, 0xad, 0x9b, 0x99, 0xaa, 0x88, 0xa8, 0x9b, 0x10, 0x80, 0x51,
+0x81, 0xab, 0x19, 0x62, 0x56, 0x33, 0x35, 0x43, 0x32, 0x44, 0x24, 0x24, 0x12, 0x80, 0xba, 0xad,
+0xba, 0xeb, 0xcb, 0x99, 0x99, 0x99, 0x99, 0xd9, 0xbc, 0xaa, 0xc9, 0x9a, 0x89, 0x99, 0x08, 0x98,
+0x40, 0x45, 0x43, 0x46, 0x43, 0x34, 0x44, 0x24, 0x23, 0x22, 0x88, 0xbb, 0xcd, 0xcb, 0xbb, 0xac,
+0xaa, 0x99, 0x99, 0x99, 0xaa, 0xcb, 0x9b, 0x89, 0x88, 0x41, 0x35, 0x43, 0x45, 0x24, 0x10, 0x21,
+0x43, 0x44, 0x44, 0x32, 0x12, 0x10, 0x82, 0xe9, 0xbc, 0xdb, 0xcb, 0xaa, 0xa9, 0xaa, 0x88, 0x89,
+0x08, 0x12, 0x01, 0x01, 0x42, 0x32, 0x53, 0x24, 0x22, 0x53, 0x34, 0x23, 0x22, 0x53, 0x35, 0x43,
+0x43, 0x13, 0xa8, 0x99, 0xfb, 0xcc, 0xcb, 0xbb, 0xab, 0x99, 0xa9, 0x00, 0x11, 0x11, 0x53, 0x23,
+0x33, 0x33, 0x22, 0x52, 0x45, 0x12, 0x00, 0x91, 0xbb, 0x60, 0x24, 0x00, 0x52, 0x02, 0x9a, 0x31,
+0xd1, 0xbd, 0xcb, 0xcc, 0xab, 0x99, 0xa9, 0xbb, 0x09, 0x12, 0x31, 0x67, 0x02, 0x31, 0x45, 0x11,
+0x31, 0x13, 0xa8, 0x99, 0xba, 0xae, 0xbb, 0xbc, 0x9c, 0x88, 0x01, 0x21, 0x33, 0x22, 0x24, 0xe9,
+0xbd, 0xab, 0x9a, 0x89, 0x00, 0x10, 0x90, 0xba, 0xcb, 0xcb, 0x09, 0x71, 0x56, 0x34, 0x34, 0x46,
+0x24, 0x13, 0x80, 0xc9, 0xbc, 0xad, 0x9b, 0xba, 0x8a, 0x18, 0x10, 0x11, 0x80, 0xca, 0xba, 0x8a,
+0x11, 0x73, 0x54, 0x32, 0x22, 0x23, 0x90, 0x89, 0x88, 0x10, 0x45, 0x43, 0x44, 0x33, 0x00, 0x98,
+0xeb, 0xbd, 0xcb, 0xcb, 0x9a, 0x99, 0x09, 0x80, 0x88, 0x18, 0x08, 0x10, 0x11, 0x20, 0x55, 0x33,
+0x23, 0x23, 0x34, 0x43, 0x54, 0x33, 0x22, 0x44, 0x35, 0x32, 0x81, 0x99, 0xcc, 0xcd, 0xab, 0xcb,
+0xbb, 0x9a, 0x99, 0x08, 0x00, 0x00, 0x41, 0x44, 0x13, 0x21, 0x33, 0x80, 0x99, 0xba, 0x9c, 0x88,
+0x08, 0x41, 0x45, 0x13, 0x00, 0x62, 0x24, 0x44, 0x46, 0x12, 0x90, 0x88, 0x99, 0xaa, 0xb9, 0xcd,
+0xbb, 0xbc, 0xba, 0xdb, 0xbb, 0x9a, 0xca, 0x89, 0x21, 0x52, 0x45, 0x23, 0x33, 0x22, 0x01, 0x81,
+0x89, 0x74, 0x33, 0x32, 0x36, 0x81, 0xa9, 0xa9, 0xcd, 0xcb, 0xba, 0xac, 0xba, 0xcc, 0xbb, 0x9a,
+0x99, 0x20, 0x34, 0x21, 0x76, 0x36, 0x24, 0x22, 0x12, 0x98, 0xab, 0xbb, 0xce, 0xbb, 0xa9, 0x99,
+0x09, 0x01, 0x98, 0x99, 0x00, 0xca, 0x0b, 0x22, 0x11, 0x74, 0x34, 0x21, 0x32, 0x13, 0x00, 0x28,
+0x14, 0x08, 0x73, 0x27, 0x22, 0x22, 0x12, 0x32, 0x02, 0xca, 0xed, 0xbc, 0xad, 0xba, 0xca, 0xaa,
+0x88, 0x98, 0x00, 0x80, 0xba, 0x18, 0x13, 0x99, 0x72, 0x47, 0x33, 0x45, 0x24, 0x31, 0x42, 0x13,
+0x02, 0xb8, 0xcd, 0xbb, 0xba, 0xac, 0xaa, 0xbc, 0xab, 0x89, 0x88, 0x99, 0xa9, 0x09, 0x52, 0x34,
+0x34, 0x23, 0x22, 0x12, 0x32, 0x35, 0x43, 0x44, 0x34, 0x12, 0x80, 0x21, 0x90, 0x89, 0xd9, 0xcf,
+0xab, 0xbb, 0x0a, 0x31, 0x32, 0x46, 0x33, 0x01, 0xca, 0xcd, 0xdb, 0xaa, 0x99, 0x89, 0x00, 0x10,
+0x20, 0x90, 0xcc, 0x8a, 0x33, 0x44, 0x56, 0x34, 0x32, 0x43, 0x14, 0x98, 0x88, 0xc8, 0xcb, 0x99,
+0xc9, 0xab, 0x18, 0xb8, 0xac, 0x09, 0xd9, 0x8b, 0x21, 0xa9, 0x0b, 0x11, 0xaa, 0x72, 0x15, 0x01,
+0x32, 0x02, 0x80, 0x31, 0x65, 0x44, 0x23, 0x34, 0x13, 0x81, 0x98, 0xda, 0xcd, 0xbb, 0xbb, 0xbb,
+0xbb, 0x99, 0x08, 0x00, 0x11, 0x33, 0x02, 0x74, 0x14, 0x89, 0x41, 0x12, 0x20, 0x35, 0x13, 0x90,
+0x99, 0x89, 0xb9, 0x70, 0x37, 0x80, 0x41, 0x03, 0xeb, 0xaa, 0xdb, 0xbd, 0xaa, 0x98, 0x00, 0x00,
+0x22, 0x83, 0x88, 0x63, 0x82, 0x1a, 0x54, 0x33, 0x65, 0x43, 0x12, 0x11, 0x88, 0x88, 0xb9, 0xaf,
+0xab, 0xdb, 0xbb, 0x99, 0xc9, 0x9a, 0x11, 0x80, 0x1a, 0x32, 0x91, 0x30, 0x25, 0x80, 0x61, 0x24,
+0x11, 0x43, 0x24, 0x98, 0x09, 0x80, 0x52, 0x34, 0x43, 0x47, 0x44, 0x63, 0x22, 0xa0, 0xca, 0xbc,
+0xbc, 0xab, 0xbb, 0xaa, 0x18, 0x01, 0x00, 0x98, 0xcd, 0x9b, 0x08, 0x10, 0x73, 0x36, 0x24, 0x43,
+0x32, 0x31, 0x33, 0x14, 0x81, 0x99, 0xca, 0xcc, 0xcb, 0xcb, 0xac, 0x9a, 0xa9, 0x89, 0x98, 0xa9,
+0x89, 0x90, 0x89, 0x52, 0x43, 0x54, 0x33, 0x23, 0x33, 0x35, 0x22, 0x32, 0x22, 0x88, 0x11, 0xc8,
+0xac, 0xca, 0xcc, 0xdb, 0xbb, 0x9b, 0x89, 0x28, 0x14, 0xa0, 0x89, 0x91, 0xea, 0xab, 0x8a, 0xa8,
+0x69, 0x57, 0x22, 0x32, 0x15, 0x90, 0x99, 0xdb, 0xbc, 0x9a, 0x88, 0x08, 0x32, 0x02, 0x08, 0x91,
+0xed, 0x9a, 0x00, 0x63, 0x54, 0x22, 0x32, 0x21, 0x10, 0xa8, 0xcd, 0xcb, 0xbd, 0x8a, 0x80, 0xaa,
+0x00, 0xb8, 0x9c, 0x44, 0x12, 0x73, 0x24, 0x00, 0x08, 0x90, 0xbb, 0x99, 0x98, 0x89, 0x20, 0x46,
+0x23, 0x21, 0x13, 0xb8, 0x9a, 0xfe, 0xad, 0xab, 0xaa, 0xab, 0xba, 0xcb, 0xaa, 0x28, 0x46, 0x44,
+0x33, 0x54, 0x43, 0x43, 0x33, 0x02, 0xa8, 0xcb, 0xcd, 0xbb, 0xba, 0xcb, 0x99, 0x88, 0x98, 0x98,
+0xa9, 0xaa, 0x08, 0x11, 0x31, 0x67, 0x34, 0x23, 0x43, 0x14, 0x00, 0x20, 0x23, 0x10, 0x42, 0x13,
+0x00, 0x23, 0xb8, 0xef, 0xbc, 0xcb, 0xcb, 0xbb, 0xaa, 0xbb, 0x09, 0x01, 0x11, 0x32, 0x22, 0x53,
+0x34, 0x54, 0x43, 0x12, 0x31, 0x44, 0x22, 0x21, 0x11, 0xa9, 0x29, 0x34, 0xa0, 0x88, 0xd9, 0xbf,
+0xaa, 0xcc, 0xcc, 0xaa, 0xab, 0xab, 0x89, 0x00, 0x20, 0x64, 0x33, 0x35, 0x33, 0x02, 0x00, 0xa9,
+0x88, 0x90, 0xbb, 0xab, 0xcb, 0x1a, 0x45, 0x21, 0x55, 0x34, 0x33, 0x23, 0x91, 0xea, 0xcc, 0xac,
+0xbb, 0xbb, 0xab, 0x9b, 0x08, 0x01, 0x51, 0x35, 0x33, 0x32, 0x45, 0x33, 0x12, 0x00, 0xb9, 0xbe,
+0xab, 0x9a, 0xaa, 0xaa, 0x19, 0x54, 0x45, 0x24, 0x33, 0x33, 0x91, 0xbc, 0xcc, 0xbd, 0xbc, 0xa9,
+0xa9, 0x89, 0xa8, 0xca, 0xbb, 0xba, 0x9a, 0x74, 0x36, 0x34, 0x36, 0x34, 0x22, 0x12, 0xa0, 0xcc,
+0xcb, 0xbb, 0xab, 0xab, 0x99, 0x08, 0x00, 0x88, 0xa9, 0xcb, 0xac, 0xaa, 0x10, 0x44, 0x64, 0x43,
+0x22, 0x32, 0x23, 0x11, 0x43, 0x14, 0x08, 0x20, 0x01, 0x01, 0xc8, 0xde, 0xbd, 0xab, 0xbb, 0xac,
+0x18, 0x00, 0x08, 0x21, 0x81, 0x98, 0xb9, 0xab, 0x51, 0x24, 0x54, 0x24, 0x81, 0x88, 0x10, 0x00,
+0x08, 0x63, 0x44, 0x43, 0x34, 0x34, 0x13, 0x98, 0x89, 0xec, 0xbc, 0xaa, 0xcc, 0xaa, 0x88, 0x00,
+0x11, 0x32, 0x14, 0x98, 0x99, 0xeb, 0xab, 0x00, 0xba, 0x8c, 0x21, 0x00, 0x51, 0x24, 0x10, 0x42,
+0x35, 0x46, 0x55, 0x23, 0x12, 0x11, 0x98, 0xab, 0xba, 0xce, 0xac, 0xaa, 0xbb, 0x99, 0xb9, 0xac,
+0x08, 0x89, 0x88, 0x88, 0x20, 0x21, 0x65, 0x34, 0x11, 0x41, 0x23, 0x41, 0x54, 0x23, 0x42, 0x45,
+0x22, 0x00, 0x81, 0xd9, 0xcb, 0xaa, 0xcc, 0xac, 0xa9, 0xa9, 0xaa, 0x99, 0xa9, 0x18, 0x44, 0x12,
+0x41, 0x43, 0x22, 0x53, 0x43, 0x01, 0x11, 0x12, 0x90, 0x20, 0x14, 0xa9, 0x51, 0x14, 0x98, 0xaa,
+0xdb, 0xde, 0xab, 0xba, 0xcc, 0x9a, 0x89, 0x08, 0x11, 0x01, 0x20, 0x02, 0xaa, 0x74, 0x47, 0x21,
+0x43, 0x33, 0x11, 0x12, 0x90, 0xcc, 0xcb, 0xbb, 0xab, 0xbb, 0xaa, 0xa9, 0xbb, 0xbc, 0xbb, 0x8a,
+0x98, 0x8a, 0x74, 0x02, 0x88, 0x53, 0x02, 0x28, 0x56, 0x22, 0x21, 0x31, 0x46, 0x33, 0x35, 0x24,
+0x90, 0x9a, 0xb9, 0xbc, 0xbc, 0xcd, 0xaa, 0xa9, 0x89, 0x99, 0xaa, 0xab, 0x9c, 0x88, 0x99, 0x38,
+0x23, 0x00, 0x21, 0x43, 0x57, 0x22, 0x64, 0x34, 0x32, 0x46, 0x33, 0x33, 0x24, 0x80, 0xba, 0xcc,
+0xcc, 0xcb, 0xaa, 0xab, 0x9a, 0x89, 0xa9, 0x89, 0xa9, 0xaa, 0x99, 0x28, 0x56, 0x33, 0x34, 0x45,
+0x22, 0x22, 0x21, 0x32, 0x53, 0x43, 0x35, 0x22, 0x21, 0x12, 0xfa, 0xbc, 0xcb, 0xbc, 0xbb, 0xaa,
+0xaa, 0x8a, 0x88, 0x99, 0x18, 0x88, 0x19, 0x45, 0x23, 0x43, 0x44, 0x23, 0x32, 0x34, 0x23, 0x42,
+0x45, 0x43, 0x44, 0x12, 0x11, 0x80, 0xba, 0xcd, 0xcc, 0xbb, 0xbc, 0x9b, 0x99, 0x89, 0x18, 0x00,
+0x20, 0x22, 0x33, 0x44, 0x22, 0x43, 0x33, 0x33, 0x33, 0x80, 0x00, 0x02, 0x30, 0x47, 0x33, 0x65,
+0x34, 0x23, 0x33, 0x81, 0xdc, 0xad, 0xcb, 0xcb, 0xab, 0xaa, 0xaa, 0x09, 0x01, 0x80, 0x11, 0x11,
+0x73, 0x43, 0x32, 0x35, 0x33, 0x32, 0x24, 0x98, 0x99, 0x99, 0xba, 0x89, 0x51, 0x44, 0x23, 0x23,
+0xb0, 0xdd, 0xcc, 0xbc, 0xbb, 0xcb, 0xaa, 0x8a, 0x08, 0xa9, 0xcc, 0xbb, 0x09, 0x63, 0x44, 0x54,
+0x34, 0x34, 0x44, 0x12, 0x00, 0x98, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0x9a, 0x88, 0x09, 0x98, 0xaa,
+0x0a, 0x10, 0x41, 0x35, 0x02, 0x42, 0x36, 0x13, 0x32, 0x23, 0x00, 0x41, 0x46, 0x44, 0x23, 0x23,
+0x02, 0xa8, 0xbc, 0xcf, 0xcb, 0xaa, 0xab, 0x8a, 0x10, 0x20, 0x22, 0x80, 0xa9, 0xdb, 0xab, 0x08,
+0x08, 0x10, 0x20, 0x21, 0x21, 0x46, 0x23, 0x42, 0x46, 0x55, 0x35, 0x34, 0x43, 0x12, 0x98, 0xa8,
+0xdd, 0xbb, 0xba, 0xcb, 0x9a, 0x88, 0x9a, 0x08, 0x01, 0xa9, 0x18, 0x22, 0x18, 0x65, 0x12, 0x08,
+0x32, 0x82, 0x31, 0x37, 0x21, 0x65, 0x43, 0x42, 0x33, 0x11, 0x88, 0xb8, 0xbe, 0xcc, 0xcb, 0xab,
+0x9a, 0x99, 0x99, 0x88, 0x00, 0x21, 0x22, 0x22, 0x22, 0x08, 0x62, 0x44, 0x33, 0x23, 0x23, 0x01,
+0x20, 0x46, 0x33, 0x34, 0x34, 0x33, 0x33, 0x23, 0xd8, 0xcf, 0xbb, 0xbd, 0xad, 0x9a, 0xba, 0x9a,
+0x99, 0x98, 0x18, 0x53, 0x54, 0x63, 0x43, 0x32, 0x21, 0x11, 0x80, 0xb9, 0xbb, 0xcd, 0xbb, 0x89,
+0xaa, 0xaa, 0x98, 0xa9, 0xab, 0xba, 0xcc, 0x19, 0x23, 0x10, 0x44, 0xb0, 0xbc, 0x08, 0x00, 0xd9,
+0xac, 0x72, 0x24, 0x64, 0x35, 0x43, 0x32, 0x23, 0x12, 0x91, 0xcc, 0xeb, 0xdb, 0xba, 0xba, 0xaa,
+0x88, 0x89, 0x09, 0x11, 0x01, 0x88, 0x00, 0x81, 0x28, 0x56, 0x24, 0x32, 0x45, 0x23, 0x32, 0x55,
+0x33, 0x33, 0x24, 0x12, 0x80, 0xba, 0xed, 0xdb, 0xbb, 0xac, 0xab, 0xaa, 0xa9, 0x88, 0x10, 0x21,
+0x22, 0x43, 0x21, 0x32, 0x36, 0x32, 0x53, 0x34, 0x22, 0x32, 0x02, 0x20, 0x47, 0x22, 0x51, 0x33,
+0x01, 0x08, 0xd9, 0xce, 0xbb, 0xcc, 0xab, 0x9a, 0x99, 0x89, 0x10, 0x22, 0x22, 0x32, 0x25, 0x12,
+0x22, 0x14, 0x01, 0x10, 0x41, 0x35, 0x03, 0x42, 0x35, 0x32, 0x46, 0x23, 0x32, 0x81, 0xca, 0xca,
+0xdd, 0xcb, 0xca, 0xba, 0x99, 0x80, 0x10, 0x00, 0x11, 0x32, 0x54, 0x33, 0x01, 0x20, 0x00, 0x31,
+0x14, 0x98, 0xa8, 0xcb, 0x9a, 0x41, 0x36, 0x23, 0x62, 0x35, 0x82, 0x80, 0xea, 0xbc, 0xab, 0xbc,
+0x9c, 0x99, 0x89, 0x08, 0x01, 0x21, 0x11, 0x61, 0x35, 0x25, 0x43, 0x34, 0x12, 0x10, 0x80, 0xda,
+0xac, 0xba, 0xbc, 0x9a, 0xaa, 0x89, 0x00, 0x80, 0x31, 0x81, 0xaa, 0x10, 0x54, 0x13, 0xaa, 0x99,
+0xef, 0xaa, 0xb9, 0xbf, 0x8a, 0x90, 0x20, 0x67, 0x43, 0x43, 0x34, 0x23, 0x12, 0x80, 0xcb, 0xbc,
+0xbc, 0xad, 0x9a, 0x9a, 0x89, 0x80, 0x98, 0x88, 0xb8, 0xcc, 0x9a, 0x9a, 0xba, 0x8a, 0x62, 0x33,
+0x54, 0x34, 0x43, 0x63, 0x44, 0x43, 0x23, 0x23, 0x11, 0x98, 0xda, 0xcc, 0xcb, 0xac, 0xab, 0xaa,
+0x99, 0x9a, 0x99, 0x88, 0x08, 0x80, 0x89, 0x32, 0x45, 0x44, 0x34, 0x33, 0x34, 0x43, 0x44, 0x32,
+0x43, 0x23, 0x01, 0x31, 0xa1, 0xcf, 0xbb, 0xcc, 0xcb, 0xaa, 0xaa, 0xaa, 0x09, 0x00, 0x08, 0x21,
+0x01, 0x42, 0x43, 0x33, 0x25, 0x02, 0x80, 0x11, 0x44, 0x53, 0x22, 0x33, 0x44, 0x44, 0x44, 0x22,
+0x81, 0xb9, 0xbc, 0xbd, 0xcc, 0xbb, 0xbb, 0xbb, 0x08, 0x01, 0x18, 0x52, 0x22, 0x43, 0x24, 0x01,
+0x88, 0x00, 0x20, 0x34, 0x12, 0x20, 0x44, 0xa1, 0x28, 0x27, 0x91, 0x48, 0x15, 0xa9, 0x28, 0xd8,
+0xbe, 0xa9, 0xda, 0xaa, 0x98, 0x99, 0x99, 0x98, 0x62, 0x34, 0x24, 0x24, 0x12, 0x31, 0x22, 0x08,
+0x90, 0xdc, 0xbb, 0xba, 0xab, 0xdb, 0xac, 0x18, 0x12, 0x43, 0x35, 0x22, 0x12, 0x98, 0xeb, 0xbc,
+0xbc, 0x9a, 0x88, 0x99, 0x89, 0xfc, 0xbc, 0x89, 0x99, 0x41, 0x46, 0x33, 0x45, 0x36, 0x34, 0x02,
+0x80, 0xca, 0xbd, 0xca, 0xba, 0x9a, 0x99, 0x08, 0x22, 0x01, 0x89, 0xa9, 0xa9, 0x18, 0x44, 0x35,
+0x35, 0x23, 0x32, 0x22, 0x00, 0x00, 0x88, 0x10, 0x32, 0x65, 0x35, 0x13, 0x80, 0xb9, 0xce, 0xbc,
+0xca, 0xbc, 0x9a, 0x9a, 0x8a, 0x88, 0x10, 0x21, 0x22, 0x42, 0x33, 0x42, 0x34, 0x13, 0x80, 0x31,
+0x37, 0x44, 0x53, 0x11, 0x30, 0x34, 0x01, 0x22, 0xa2, 0xbf, 0xdb, 0xdb, 0xba, 0xaa, 0xbb, 0x8a,
+0x10, 0x01, 0x52, 0x33, 0x12, 0x42, 0x24, 0x00, 0x89, 0x88, 0xa0, 0xba, 0xa9, 0xce, 0x9a, 0x08,
+0x80, 0x08, 0x72, 0x47, 0x44, 0x23, 0x13, 0x80, 0x98, 0xbc, 0x8b, 0xa0, 0xce, 0x8b, 0x80, 0xcb,
+0x8a, 0xba, 0x9d, 0x89, 0x99, 0x21, 0x23, 0x54, 0x43, 0x21, 0x12, 0x00, 0x42, 0x82, 0x8a, 0x43,
+0x63, 0x45, 0x12, 0x08, 0x80, 0xca, 0xcb, 0xbc, 0xad, 0xba, 0xcb, 0xba, 0xdb, 0x9b, 0x89, 0x08,
+0x32, 0x43, 0x76, 0x45, 0x34, 0x33, 0x12, 0x80, 0xc9, 0xcc, 0xbb, 0xbc, 0xbb, 0x89, 0x08, 0x00,
+0x08, 0x98, 0x99, 0x88, 0x00, 0x22, 0x56, 0x44, 0x33, 0x25, 0x23, 0x00, 0x88, 0xa9, 0x9a, 0x20,
+0x54, 0x24, 0x23, 0x32, 0x33, 0x91, 0xee, 0xbd, 0xcc, 0xba, 0xab, 0xa9, 0x88, 0x20, 0x22, 0x22,
+0x81, 0x88, 0x89, 0x51, 0x53, 0x43, 0x44, 0x35, 0x33, 0x24, 0x23, 0x21, 0x23, 0x82, 0x00, 0xd0,
+0xce, 0xab, 0xdb, 0xcb, 0xab, 0xac, 0xaa, 0x99, 0x09, 0x10, 0x20, 0x32, 0x32, 0x55, 0x33, 0x11,
+0x41, 0x13, 0x18, 0x54, 0x12, 0x08, 0x54, 0x43, 0x42, 0x24, 0x82, 0xa9, 0xa9, 0xda, 0xbd, 0xbc,
+0xcb, 0xab, 0x8a, 0x98, 0x98, 0x08, 0x10, 0x28, 0x53, 0x22, 0x42, 0x36, 0x23, 0x22, 0x23, 0x22,
+0x80, 0x40, 0x25, 0x80, 0x42, 0x81, 0x30, 0x25, 0xea, 0xbb, 0xcb, 0xcc, 0xab, 0xba, 0xbd, 0x9b,
+0x00, 0x98, 0x38, 0x24, 0x28, 0x66, 0x13, 0x11, 0x63, 0x23, 0x10, 0x21, 0x92, 0xba, 0x9b, 0xfb,
+0xcb, 0xba, 0xba, 0x9a, 0xaa, 0xcb, 0x99, 0x21, 0x92, 0x8a, 0x44, 0xa0, 0x50, 0x04, 0xdb, 0x09,
+0x91, 0x8a, 0x74, 0x32, 0x31, 0x46, 0x33, 0x22, 0x46, 0x34, 0x12, 0x02, 0xd8, 0xbd, 0xdb, 0xbb,
+0xac, 0x9a, 0x89, 0x10, 0x01, 0x01, 0x00, 0x08, 0x20, 0x33, 0x53, 0x44, 0x53, 0x33, 0x34, 0x24,
+0x81, 0x00, 0x98, 0xaa, 0x51, 0x24, 0x20, 0x53, 0x13, 0x98, 0xbb, 0xee, 0xbd, 0xbc, 0xaa, 0xbb,
+0x89, 0x88, 0x08, 0x31, 0x14, 0x32, 0x53, 0x23, 0x21, 0x63, 0x23, 0x42, 0x35, 0x13, 0x42, 0x34,
+0x81, 0x08, 0x80, 0xaa, 0xbb, 0xce, 0xcc, 0xac, 0xab, 0xb9, 0xaa, 0x88, 0x98, 0x09, 0x43, 0x81,
+0x89, 0x00, 0x80, 0x41, 0x25, 0x12, 0x21, 0x32, 0x34, 0x65, 0x44, 0x23, 0x52, 0x35, 0x32, 0x34,
+0x03, 0xb9, 0xbc, 0xcd, 0xbc, 0xbb, 0xbc, 0x9a, 0x09, 0x11, 0x11, 0x21, 0x12, 0x21, 0x23, 0xa0,
+0xbd, 0x09, 0x43, 0x23, 0x33, 0x32, 0x02, 0x89, 0x72, 0x77, 0x23, 0x31, 0x35, 0x23, 0x01, 0x00,
+0xea, 0xbe, 0xbb, 0xcb, 0xbb, 0x9a, 0x98, 0xa9, 0x20, 0x44, 0x12, 0x53, 0x34, 0x12, 0x44, 0x23,
+0x98, 0x88, 0xd9, 0xad, 0x89, 0xa9, 0xab, 0x89, 0x52, 0x43, 0x43, 0x34, 0x01, 0x08, 0xc9, 0xdb,
+0xba, 0xbd, 0xaa, 0x98, 0x98, 0x80, 0xd9, 0xbc, 0x9a, 0x99, 0x40, 0x55, 0x43, 0x54, 0x63, 0x34,
+0x23, 0x01, 0xa9, 0xcd, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x31, 0x01, 0xaa, 0xba, 0xed, 0x8a, 0x20,
+0x22, 0x73, 0x35, 0x12, 0x22, 0x23, 0x90, 0x88, 0x88, 0x88, 0x63, 0x43, 0x22, 0x11, 0xa0, 0xeb,
+0xdb, 0xcb, 0xbd, 0xbb, 0xaa, 0xaa, 0x9a, 0x98, 0x08, 0x32, 0x22, 0x41, 0x24, 0x22, 0x42, 0x54,
+0x35, 0x34, 0x31, 0x44, 0x33, 0x21, 0x53, 0x01, 0xba, 0xab, 0xcc, 0xcd, 0xba, 0xba, 0xbc, 0x09,
+0x88, 0x8a, 0x10, 0x01, 0x20, 0x44, 0x02, 0x08, 0x31, 0x34, 0x23, 0x12, 0x00, 0xa8, 0xcb, 0x1a,
+0x12, 0x51, 0x77, 0x24, 0x34, 0x36, 0x11, 0x00, 0xb8, 0xbc, 0xbc, 0xcb, 0xbb, 0xba, 0x8a, 0x80,
+0x89, 0x18, 0x98, 0x9a, 0xc8, 0xab, 0x31, 0x00, 0x74, 0x24, 0x12, 0x23, 0x21, 0x55, 0x33, 0x63,
+0x35, 0x23, 0x33, 0x13, 0xa8, 0xbd, 0xbb, 0xdd, 0xcc, 0xaa, 0xb9, 0x99, 0x08, 0x10, 0x21, 0x33,
+0x22, 0x80, 0x98, 0x51, 0x35, 0x12, 0x20, 0x13, 0x99, 0x28, 0x15, 0xa9, 0x19, 0x35, 0x56, 0x35,
+0x12, 0x88, 0xba, 0xbf, 0xbb, 0xac, 0xbb, 0x89, 0x00, 0x08, 0x01, 0x90, 0xba, 0xaa, 0x52, 0x36,
+0x64, 0x45, 0x23, 0x23, 0x23, 0x22, 0x80, 0xeb, 0xbc, 0xbc, 0xbd, 0xaa, 0xa9, 0xaa, 0x08, 0x21,
+0x01, 0x21, 0x10, 0x22, 0x12, 0x20, 0x74, 0x33, 0x13, 0x53, 0x33, 0xc9, 0xad, 0xca, 0xbd, 0x39,
+0x46, 0x44, 0x44, 0x32, 0x23, 0x01, 0xca, 0xcd, 0xac, 0xab, 0x9b, 0x99, 0x80, 0x00, 0x01, 0x88,
+0xba, 0xcc, 0x89, 0x01, 0x32, 0x57, 0x43, 0x33, 0x34, 0x24, 0x21, 0x22, 0x02, 0x88, 0xa9, 0xdd,
+0xcb, 0xaa, 0xca, 0xac, 0x9a, 0x99, 0x89, 0x80, 0x80, 0xb9, 0x9b, 0x28, 0x21, 0x44, 0x35, 0x54,
+0x33, 0x24, 0x22, 0x02, 0x90, 0xab, 0x89, 0x00, 0x18, 0x34, 0xb8, 0x59, 0x26, 0xa8, 0x9b, 0xfb,
+0xcc, 0xaa, 0x08, 0x21, 0x21, 0x63, 0x23, 0x01, 0x91, 0xed, 0xac, 0xa9, 0xab, 0x8a, 0x88, 0x18,
+0x02, 0x81, 0x98, 0x9b, 0x42, 0x54, 0x57, 0x34, 0x34, 0x24, 0x12, 0x81, 0x99, 0xba, 0xcc, 0xcb,
+0xba, 0xab, 0xa9, 0xaa, 0xaa, 0x9a, 0xcb, 0xba, 0x89, 0xb9, 0x39, 0x77, 0x12, 0x21, 0x22, 0x00,
+0x10, 0x01, 0x18, 0x66, 0x45, 0x33, 0x43, 0x02, 0xa8, 0xaa, 0xdb, 0xbd, 0xab, 0xb9, 0xbb, 0xaa,
+0xba, 0xcd, 0xaa, 0xaa, 0xba, 0x18, 0x74, 0x53, 0x44, 0x43, 0x22, 0x12, 0x01, 0x98, 0x99, 0xb9,
+0xcb, 0x9a, 0xba, 0xbd, 0xbb, 0xcc, 0xab, 0xbc, 0xbb, 0x9a, 0x18, 0x00, 0x11, 0x32, 0x12, 0x12,
+0x21, 0x67, 0x24, 0x32, 0x45, 0x53, 0x53, 0x44, 0x22, 0x12, 0x01, 0x98, 0xc9, 0xdb, 0xbc, 0xbc,
+0xba, 0xbb, 0xbb, 0xba, 0xcb, 0x9a, 0x99, 0x99, 0x21, 0x44, 0x35, 0x24, 0x33, 0x36, 0x23, 0x43,
+0x53, 0x32, 0x32, 0x54, 0x12, 0x00, 0x00, 0xb9, 0xbe, 0xcb, 0xcc, 0xba, 0xaa, 0xbb, 0xac, 0xaa,
+0xbc, 0x8a, 0x08, 0x00, 0x63, 0x43, 0x33, 0x43, 0x24, 0x22, 0x33, 0x23, 0x21, 0x47, 0x33, 0x33,
+0x33, 0x82, 0xa9, 0xbb, 0xfc, 0xcd, 0xbb, 0xbb, 0xbb, 0xab, 0xbb, 0xab, 0x89, 0x00, 0x10, 0x21,
+0x55, 0x53, 0x43, 0x22, 0x23, 0x22, 0x32, 0x43, 0x31, 0x64, 0x23, 0x33, 0x35, 0x23, 0x11, 0x80,
+0xfb, 0xcc, 0xbb, 0xbd, 0xba, 0xbb, 0xac, 0x89, 0x88, 0x88, 0x00, 0x00, 0x52, 0x35, 0x24, 0x23,
+0x33, 0x34, 0x23, 0x11, 0xb8, 0xab, 0x88, 0x42, 0x26, 0x12, 0x52, 0x22, 0x21, 0x91, 0xee, 0xcb,
+0xcb, 0xbb, 0xab, 0x9a, 0x88, 0xaa, 0x08, 0x90, 0x48, 0x37, 0x24, 0x33, 0x53, 0x43, 0x33, 0x23,
+0x90, 0x9a, 0x11, 0xca, 0xab, 0xfb, 0xbc, 0x8b, 0x00, 0x80, 0x89, 0x00, 0xfa, 0xab, 0x99, 0xdb,
+0xbb, 0xab, 0x8a, 0x08, 0x08, 0x98, 0xce, 0x9b, 0x31, 0x43, 0x64, 0x55, 0x63, 0x44, 0x34, 0x32,
+0x11, 0xa8, 0xca, 0xdb, 0xbc, 0xbb, 0xbb, 0xaa, 0x08, 0xa9, 0xaa, 0x9a, 0xbc, 0x8a, 0x10, 0x32,
+0x57, 0x35, 0x43, 0x32, 0x14, 0x02, 0x11, 0x21, 0x00, 0x21, 0x32, 0x01, 0x01, 0xc8, 0xdf, 0xac,
+0xbb, 0xbc, 0xaa, 0xbb, 0xbc, 0xba, 0xaa, 0x9a, 0xab, 0x18, 0x73, 0x35, 0x44, 0x33, 0x14, 0x01,
+0x00, 0x80, 0x89, 0x00, 0x10, 0x44, 0x22, 0x32, 0x54, 0x43, 0x12, 0x12, 0x81, 0xcd, 0x9c, 0xb9,
+0xbd, 0xba, 0xcd, 0xbb, 0xba, 0xcb, 0x9b, 0xa9, 0x89, 0x20, 0x44, 0x33, 0x11, 0x46, 0x24, 0x43,
+0x34, 0x32, 0x43, 0x34, 0x33, 0x02, 0x98, 0xa9, 0xcd, 0xbb, 0xcd, 0xcb, 0xba, 0xba, 0xaa, 0xaa,
+0xbb, 0x09, 0x10, 0x31, 0x33, 0x44, 0x44, 0x32, 0x33, 0x33, 0x21, 0x33, 0x32, 0x77, 0x24, 0x32,
+0x43, 0x12, 0x41, 0x12, 0xca, 0xbb, 0xdd, 0xac, 0xab, 0xba, 0xbb, 0x9a, 0x99, 0x98, 0x18, 0x22,
+0x53, 0x46, 0x33, 0x44, 0x33, 0x12, 0x01, 0x98, 0xbb, 0x99, 0xba, 0xcd, 0x89, 0x99, 0x0a, 0x22,
+0xe9, 0xab, 0x90, 0xab, 0x18, 0x92, 0x8d, 0x56, 0x04, 0x00, 0x21, 0xb9, 0x0a, 0x43, 0xc8, 0xbc,
+0xcb, 0x9a, 0x9a, 0x30, 0x37, 0x23, 0x64, 0x33, 0x12, 0x11, 0xb8, 0xbd, 0xac, 0xa9, 0xa9, 0x89,
+0x99, 0xab, 0x89, 0xca, 0x9c, 0x80, 0xa9, 0x1a, 0x83, 0xff, 0xab, 0xda, 0xbd, 0x9a, 0x81, 0x89,
+0x18, 0x44, 0x47, 0x45, 0x36, 0x24, 0x12, 0x01, 0xa0, 0xcc, 0xbb, 0xbd, 0xbb, 0xaa, 0x89, 0x00,
+0x80, 0x88, 0x98, 0x9a, 0x89, 0x99, 0x72, 0x47, 0x23, 0x33, 0x34, 0x12, 0x01, 0x11, 0x98, 0x09,
+0x22, 0x00, 0x00, 0xe9, 0xcd, 0xbb, 0xbd, 0xcc, 0xaa, 0x9b, 0x8a, 0x88, 0xa8, 0x09, 0x21, 0x80,
+0x41, 0x36, 0x34, 0x44, 0x43, 0x12, 0x12, 0x00, 0x88, 0x10, 0x43, 0x12, 0x20, 0x13, 0xec, 0x0a,
+0x92, 0xcf, 0x9b, 0xda, 0xad, 0x88, 0xa0, 0x89, 0x33, 0x23, 0x53, 0x35, 0x13, 0x90, 0x00, 0xea,
+0xbc, 0x89, 0xba, 0x0a, 0x22, 0x82, 0x20, 0x02, 0xaa, 0x19, 0x73, 0x47, 0x45, 0x22, 0x12, 0x11,
+0xb8, 0xbb, 0xdb, 0xcd, 0xab, 0x98, 0x88, 0x00, 0x12, 0x90, 0x9a, 0x21, 0xa8, 0xab, 0xda, 0xbd,
+0x19, 0x43, 0x12, 0x20, 0x35, 0x22, 0x62, 0x35, 0x22, 0x73, 0x34, 0x22, 0x11, 0x91, 0xcb, 0xbc,
+0xbd, 0xab, 0xcb, 0xac, 0x9a, 0xba, 0xac, 0x99, 0x99, 0xaa, 0x18, 0x64, 0x46, 0x34, 0x43, 0x32,
+0x12, 0x00, 0x80, 0xa8, 0xbc, 0xbb, 0xca, 0xcb, 0x9a, 0xba, 0xbd, 0xac, 0xaa, 0xab, 0x0a, 0x88,
+0x88, 0x43, 0x90, 0x8a, 0x53, 0x91, 0x1a, 0x67, 0x23, 0x52, 0x45, 0x34, 0x34, 0x24, 0x11, 0x80,
+0xa9, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0xa9, 0x99, 0x99, 0x88, 0x80, 0x09, 0x10, 0x12, 0x52, 0x46,
+0x32, 0x53, 0x34, 0x13, 0x22, 0x34, 0x53, 0x44, 0x34, 0x13, 0x22, 0x82, 0xdb, 0xdb, 0xcd, 0xac,
+0xab, 0xaa, 0xa9, 0x88, 0x08, 0x10, 0x22, 0x21, 0x22, 0x43, 0x33, 0x54, 0x34, 0x32, 0x34, 0x43,
+0x22, 0x21, 0x43, 0x34, 0x22, 0x32, 0x81, 0xcd, 0xca, 0xec, 0xbc, 0xbb, 0xbb, 0xab, 0x08, 0x80,
+0x28, 0x53, 0x22, 0x31, 0x43, 0x21, 0x52, 0x23, 0x23, 0x43, 0x22, 0x80, 0x19, 0x43, 0xa8, 0x2a,
+0x15, 0x20, 0x77, 0x03, 0x88, 0xa0, 0xec, 0xbb, 0xba, 0xbe, 0xaa, 0x99, 0x08, 0x21, 0x34, 0x33,
+0x43, 0x35, 0x13, 0x12, 0x12, 0xa8, 0x9c, 0x80, 0xa9, 0x9a, 0x98, 0xbc, 0x9a, 0x18, 0x10, 0x64,
+0x43, 0x32, 0x33, 0xa2, 0xde, 0xcc, 0xbc, 0x9b, 0x99, 0x98, 0x08, 0x11, 0x11, 0x10, 0x11, 0x01,
+0x73, 0x77, 0x33, 0x33, 0x34, 0x01, 0x00, 0xc9, 0xcc, 0xab, 0xbb, 0x9c, 0x89, 0x90, 0x89, 0x99,
+0xa9, 0xcb, 0xbb, 0x0a, 0x30, 0x34, 0x24, 0x80, 0xba, 0xcb, 0x48, 0x57, 0x32, 0x44, 0x25, 0x11,
+0x53, 0x24, 0x01, 0x10, 0xc9, 0xbb, 0xcb, 0xbd, 0x9b, 0xba, 0x9c, 0x18, 0x01, 0x88, 0x98, 0xaa,
+0xab, 0xab, 0x18, 0x11, 0x32, 0x25, 0xc9, 0x8a, 0x21, 0x44, 0x43, 0x62, 0x77, 0x34, 0x44, 0x33,
+0x02, 0x80, 0x98, 0xcc, 0xbc, 0xbb, 0xbd, 0x9a, 0x89, 0x9a, 0x89, 0x98, 0xaa, 0x8a, 0x18, 0x00,
+0x42, 0x37, 0x32, 0x63, 0x34, 0x22, 0x33, 0x34, 0x42, 0x34, 0x24, 0x22, 0x01, 0xb9, 0xbc, 0xcc,
+0xcd, 0xac, 0xab, 0xaa, 0x8a, 0x99, 0x99, 0x89, 0x20, 0x22, 0x21, 0x45, 0x23, 0x53, 0x43, 0x13,
+0x20, 0x22, 0x11, 0x63, 0x33, 0x23, 0x65, 0x33, 0x12, 0x10, 0x90, 0xdd, 0xbc, 0xcb, 0xcb, 0xbc,
+0xa9, 0xa9, 0x88, 0x00, 0x21, 0x53, 0x32, 0x32, 0x35, 0x34, 0x22, 0x01, 0x01, 0xa9, 0x9a, 0x81,
+0xcc, 0x19, 0x91, 0xbc, 0x40, 0x13, 0x30, 0x57, 0x24, 0x80, 0x88, 0xa8, 0xdd, 0xbb, 0xcb, 0xcb,
+0xab, 0x88, 0x98, 0x08, 0x00, 0x18, 0x75, 0x43, 0x32, 0x35, 0x24, 0x21, 0x11, 0x90, 0xba, 0xcc,
+0xaa, 0xca, 0xab, 0x88, 0x80, 0x09, 0x20, 0xb8, 0xbe, 0x8a, 0xc9, 0xbe, 0x9a, 0xa8, 0xa9, 0x18,
+0x22, 0x90, 0x0a, 0x98, 0x3b, 0x77, 0x17, 0x31, 0x36, 0x44, 0x53, 0x23, 0x12, 0x00, 0xc9, 0xcc,
+0xcb, 0xcb, 0xaa, 0xaa, 0x89, 0x88, 0x88, 0x98, 0x99, 0x9a, 0x88, 0x38, 0x65, 0x34, 0x34, 0x25,
+0x33, 0x12, 0x02, 0x12, 0x32, 0x53, 0x23, 0x22, 0x01, 0xb8, 0xed, 0xdc, 0xbb, 0xbc, 0xbb, 0xbb,
+0xab, 0xaa, 0xaa, 0x00, 0x00, 0x41, 0x44, 0x42, 0x44, 0x33, 0x32, 0x33, 0x22, 0x33, 0x33, 0x52,
+0x45, 0x23, 0x31, 0x45, 0x01, 0x88, 0x90, 0xed, 0xac, 0xba, 0xbc, 0xab, 0xaa, 0xab, 0x9a, 0x00,
+0x98, 0x30, 0x35, 0x21, 0x74, 0x23, 0x20, 0x31, 0x02, 0x88, 0x63, 0x24, 0x12, 0x44, 0x43, 0x21,
+0x53, 0x12, 0xa8, 0xca, 0xcd, 0xbb, 0xbc, 0xcb, 0xbb, 0xab, 0x09, 0x98, 0x20, 0x32, 0x41, 0x55,
+0x33, 0x12, 0x22, 0x22, 0x12, 0x22, 0x82, 0x99, 0x99, 0x18, 0x64, 0x43, 0x33, 0x24, 0x11, 0x11,
+0xc0, 0xdf, 0xdb, 0xcb, 0xbb, 0xba, 0x8a, 0x00, 0x80, 0x20, 0x24, 0x02, 0x53, 0x45, 0x22, 0x22,
+0x54, 0x22, 0x11, 0x22, 0xa1, 0xbb, 0xa9, 0xcc, 0xbb, 0xab, 0xbb, 0xbd, 0xaa, 0xc9, 0xcd, 0x9b,
+0x8a, 0x99, 0x08, 0x01, 0x90, 0x39, 0x47, 0xa0, 0x9a, 0xa8, 0xcc, 0x40, 0x36, 0x34, 0x54, 0x43,
+0x32, 0x35, 0x24, 0x11, 0x98, 0xcb, 0xbd, 0xad, 0xbb, 0xbb, 0x9b, 0x89, 0x00, 0x81, 0xa8, 0x88,
+0x80, 0x89, 0x42, 0x44, 0x34, 0x35, 0x43, 0x23, 0x22, 0x13, 0x22, 0x64, 0x43, 0x53, 0x34, 0x14,
+0x11, 0x01, 0xea, 0xbc, 0xbc, 0xcc, 0xba, 0xaa, 0xa9, 0x88, 0x00, 0x81, 0x11, 0x33, 0x43, 0x53,
+0x24, 0x12, 0x43, 0x34, 0x12, 0x33, 0x24, 0x21, 0x44, 0x22, 0x10, 0x12, 0x08, 0x98, 0xfd, 0xcc,
+0xbc, 0xbb, 0xab, 0xcb, 0x89, 0x88, 0x09, 0x32, 0x14, 0x00, 0x32, 0x33, 0x53, 0x44, 0x23, 0x21,
+0x32, 0x13, 0x01, 0x52, 0x23, 0x42, 0x57, 0x43, 0x22, 0x12, 0xb9, 0xbe, 0xbc, 0xcc, 0xcb, 0xaa,
+0x9a, 0x09, 0x12, 0x11, 0x21, 0x12, 0x41, 0x44, 0x22, 0x10, 0x20, 0x41, 0x23, 0x02, 0x90, 0xdc,
+0xbb, 0x89, 0x21, 0x36, 0x44, 0x43, 0x33, 0x43, 0x92, 0xdc, 0xbb, 0xdd, 0xab, 0x9a, 0xa9, 0x99,
+0x00, 0x10, 0x23, 0x22, 0x64, 0x33, 0x42, 0x36, 0x14, 0x01, 0x11, 0x90, 0xac, 0x9a, 0xda, 0xab,
+0x8a, 0x98, 0x89, 0x32, 0x14, 0xba, 0x29, 0x83, 0xcf, 0x9b, 0xca, 0xad, 0x88, 0x98, 0x0a, 0x01,
+0xc9, 0x9b, 0x38, 0x56, 0x32, 0x63, 0x44, 0x33, 0x45, 0x43, 0x32, 0x22, 0x90, 0xcb, 0xbd, 0xbe,
+0xba, 0xba, 0xaa, 0x9a, 0x80, 0x88, 0x88, 0x98, 0xbb, 0x1a, 0x53, 0x33, 0x65, 0x34, 0x33, 0x44,
+0x33, 0x21, 0x42, 0x24, 0x24, 0x11, 0x00, 0x98, 0xbc, 0xdb, 0xcd, 0xcb, 0xab, 0xbb, 0x9b, 0x9a,
+0xaa, 0x08, 0x81, 0x88, 0x63, 0x23, 0x44, 0x35, 0x33, 0x33, 0x34, 0x12, 0x10, 0x12, 0xa8, 0x09,
+0x81, 0xad, 0x48, 0x23, 0x08, 0x22, 0xc8, 0x9b, 0xa0, 0xff, 0x9a, 0xca, 0xcd, 0xaa, 0xca, 0xab,
+0x99, 0x98, 0x08, 0x21, 0x53, 0x23, 0x32, 0x32, 0x43, 0x47, 0x34, 0x43, 0x33, 0x34, 0x53, 0x22,
+0x80, 0xa9, 0xeb, 0xcb, 0xba, 0xdb, 0xbb, 0xba, 0xaa, 0x89, 0x98, 0x89, 0x21, 0x23, 0x22, 0x12,
+0x10, 0x62, 0x34, 0x33, 0x33, 0x24, 0x31, 0x56, 0x34, 0x11, 0x54, 0x34, 0x33, 0x53, 0x23, 0x90,
+0xcb, 0xcc, 0xeb, 0xcb, 0xba, 0xba, 0x9b, 0x09, 0x00, 0x31, 0x34, 0x22, 0x45, 0x34, 0x21, 0x21,
+0x01, 0x99, 0x89, 0x99, 0xbc, 0xaa, 0xa9, 0x19, 0x43, 0x32, 0x77, 0x24, 0x80, 0x32, 0x02, 0xcb,
+0x9a, 0xdd, 0xbd, 0x9a, 0x99, 0x9a, 0x88, 0x90, 0x18, 0x44, 0x32, 0x42, 0x34, 0x33, 0x44, 0x34,
+0x11, 0x98, 0x99, 0xcb, 0xbb, 0xcb, 0xcb, 0x9a, 0x31, 0x44, 0x34, 0x22, 0xa1, 0xdd, 0xbb, 0xcb,
+0xbd, 0xa9, 0x98, 0x08, 0x21, 0x22, 0x01, 0xaa, 0x00, 0x01, 0x74, 0x57, 0x32, 0x42, 0x45, 0x34,
+0x12, 0x80, 0xc9, 0xbd, 0xbb, 0xcb, 0xbb, 0x9a, 0x89, 0x10, 0x11, 0x88, 0xa9, 0xaa, 0x19, 0x43,
+0x55, 0x63, 0x33, 0x24, 0x22, 0x23, 0x00, 0x08, 0x88, 0x80, 0x10, 0x11, 0x00, 0xba, 0xde, 0xbd,
+0xac, 0xbc, 0xac, 0xab, 0xbb, 0x9a, 0xba, 0x9b, 0x20, 0x12, 0x56, 0x34, 0x33, 0x33, 0x23, 0x01,
+0x80, 0x00, 0x52, 0x64, 0x43, 0x33, 0x32, 0x36, 0x92, 0x88, 0xa1, 0xdf, 0xab, 0xba, 0xad, 0xaa,
+0xa9, 0x9a, 0x00, 0x21, 0x43, 0x33, 0x44, 0x43, 0x12, 0x10, 0x00, 0xa9, 0x89, 0x21, 0x81, 0x08,
+0x51, 0x12, 0x18, 0x24, 0xf9, 0x0a, 0x90, 0xbd, 0x30, 0x84, 0xdb, 0x19, 0x12, 0xda, 0x0b, 0x44,
+0xa0, 0x8c, 0x22, 0xf8, 0xbb, 0x00, 0x99, 0x09, 0x12, 0xa9, 0x58, 0x36, 0x24, 0x23, 0x01, 0x88,
+0x08, 0x01, 0x10, 0x01, 0x9a, 0x74, 0x16, 0x88, 0xb9, 0xcd, 0xba, 0xbd, 0x9c, 0xa9, 0xab, 0x08,
+0x98, 0x20, 0xf8, 0xbd, 0x19, 0x88, 0x38, 0x77, 0x45, 0x34, 0x23, 0x22, 0x98, 0xbc, 0xcb, 0xcc,
+0xab, 0xa9, 0x09, 0x00, 0x81, 0x98, 0xa8, 0xcc, 0xaa, 0x88, 0x31, 0x55, 0x44, 0x22, 0x23, 0x12,
+0x00, 0x01, 0x00, 0x10, 0x32, 0x44, 0x33, 0x23, 0xc0, 0xcf, 0xac, 0xbb, 0xbd, 0xba, 0x9a, 0x8a,
+0x99, 0x89, 0x10, 0x01, 0x08, 0x54, 0x34, 0x32, 0x55, 0x23, 0x11, 0x22, 0x12, 0x22, 0x23, 0x22,
+0x31, 0x45, 0x24, 0x02, 0x90, 0xec, 0xcd, 0xbb, 0xdb, 0xcb, 0x9b, 0x9a, 0x8a, 0x30, 0x33, 0x34,
+0x45, 0x23, 0x12, 0x21, 0x11, 0x10, 0x11, 0x88, 0xaa, 0xaa, 0x09, 0x43, 0x24, 0x81, 0x11, 0xb0,
+0xff, 0xab, 0xa9, 0xba, 0xbc, 0xcb, 0xbc, 0x09, 0x32, 0x34, 0x34, 0x24, 0x33, 0x22, 0x08, 0xc8,
+0xad, 0x31, 0x92, 0xab, 0x80, 0xed, 0x0a, 0x43, 0x23, 0x11, 0x41, 0x35, 0x13, 0x01, 0xa8, 0xcf,
+0xac, 0x99, 0xbb, 0x09, 0x82, 0xaa, 0x41, 0xb0, 0xbf, 0xbb, 0xdc, 0xdb, 0x9a, 0x10, 0x21, 0x12,
+0x34, 0x24, 0x74, 0x67, 0x23, 0x11, 0x11, 0x98, 0xbb, 0xdb, 0xcc, 0xba, 0xaa, 0x09, 0x00, 0x98,
+0x99, 0xaa, 0xac, 0x89, 0x00, 0x42, 0x46, 0x34, 0x34, 0x33, 0x12, 0x00, 0x22, 0x23, 0x31, 0x53,
+0x01, 0xa8, 0xb9, 0xed, 0xbd, 0xbc, 0xac, 0xab, 0x89, 0x08, 0x80, 0x98, 0x10, 0x80, 0xaa, 0x28,
+0x32, 0x65, 0x35, 0x24, 0x23, 0x23, 0x01, 0x31, 0x33, 0x12, 0x12, 0x12, 0x10, 0x32, 0x56, 0x83,
+0xde, 0xbb, 0xdc, 0xbc, 0xab, 0xba, 0x9c, 0x18, 0x23, 0x34, 0x45, 0x23, 0x01, 0x11, 0x98, 0xab,
+0x0a, 0xc9, 0x9b, 0x01, 0xc8, 0x9b, 0xa9, 0xbb, 0x0b, 0x72, 0x77, 0x34, 0x23, 0x12, 0x81, 0xc8,
+0xbc, 0xac, 0xcb, 0xbb, 0x89, 0x88, 0x09, 0x01, 0x88, 0x20, 0x35, 0x32, 0x43, 0x35, 0x13, 0x10,
+0x82, 0xeb, 0x9b, 0x88, 0x9a, 0x20, 0x26, 0x43, 0x54, 0x34, 0x12, 0x01, 0xb8, 0xbe, 0xcc, 0xcb,
+0xab, 0xab, 0xa9, 0x99, 0x18, 0x90, 0x9c, 0x40, 0x82, 0x19, 0x66, 0x33, 0x54, 0x46, 0x24, 0x11,
+0x81, 0xa8, 0xcb, 0xbb, 0xdb, 0xab, 0x9a, 0x8a, 0x88, 0x90, 0xca, 0xaa, 0xa9, 0x9a, 0x31, 0x56,
+0x34, 0x24, 0x12, 0x23, 0x01, 0x08, 0x00, 0xa9, 0x28, 0x47, 0x53, 0x24, 0x13, 0x00, 0x80, 0xda,
+0xcc, 0xbc, 0xad, 0xaa, 0x9a, 0x8a, 0x99, 0x88, 0x08, 0x08, 0x11, 0x12, 0x54, 0x44, 0x32, 0x63,
+0x43, 0x33, 0x32, 0x12, 0x01, 0x01, 0x90, 0xa9, 0xb9, 0xec, 0xbb, 0xcb, 0xdc, 0xdb, 0xba, 0xaa,
+0xbb, 0x99, 0x98, 0x21, 0x35, 0x34, 0x23, 0x32, 0x43, 0x23, 0x43, 0x12, 0x10, 0x42, 0x33, 0x34,
+0x33, 0x02, 0xaa, 0x0a, 0x12, 0xfa, 0xcd, 0xcc, 0xab, 0xac, 0xac, 0xaa, 0x9a, 0xaa, 0x1a, 0x42,
+0x90, 0x0b, 0x45, 0x32, 0x55, 0x34, 0x33, 0x23, 0x33, 0x01, 0x99, 0xc9, 0xec, 0xab, 0x9a, 0xa9,
+0x8a, 0x32, 0x22, 0x53, 0x04, 0xc9, 0xcc, 0xdb, 0xcb, 0x9a, 0x9a, 0x89, 0x18, 0x10, 0x90, 0x99,
+0x72, 0x24, 0x42, 0x44, 0x34, 0x54, 0x43, 0x13, 0x11, 0x80, 0x89, 0xa9, 0xeb, 0xcc, 0xcb, 0xaa,
+0x9a, 0xa9, 0xba, 0xaa, 0x89, 0x99, 0xc9, 0x9a, 0x20, 0x21, 0x64, 0x35, 0x43, 0x34, 0x33, 0x53,
+0x33, 0x44, 0x24, 0x12, 0x21, 0x01, 0xa9, 0xeb, 0xcc, 0xac, 0xab, 0xcb, 0xaa, 0x9a, 0xab, 0xaa,
+0x89, 0x89, 0x88, 0x99, 0x30, 0x44, 0x43, 0x45, 0x44, 0x43, 0x33, 0x33, 0x53, 0x43, 0x33, 0x11,
+0x00, 0x80, 0xaa, 0xca, 0xdd, 0xbc, 0xbc, 0xab, 0xcb, 0xac, 0x99, 0xaa, 0x89, 0x12, 0x01, 0x22,
+0x42, 0x63, 0x33, 0x32, 0x32, 0x22, 0x32, 0x45, 0x43, 0x24, 0x21, 0x42, 0x35, 0x33, 0x22, 0x91,
+0xdb, 0xbc, 0xca, 0xbe, 0xad, 0xa9, 0x9a, 0x8a, 0x88, 0xab, 0x08, 0x00, 0x99, 0x18, 0x32, 0x44,
+0x64, 0x34, 0x23, 0x32, 0x33, 0x80, 0x21, 0x36, 0x11, 0x53, 0x25, 0x00, 0x10, 0xa1, 0xdc, 0xcb,
+0xcc, 0xbb, 0xaa, 0xba, 0x9a, 0x09, 0x11, 0x10, 0x41, 0x02, 0x89, 0x64, 0x13, 0x43, 0x36, 0x12,
+0x18, 0x31, 0xa0, 0xac, 0x11, 0xb9, 0x69, 0x35, 0x80, 0x41, 0x03, 0xca, 0xaa, 0xfb, 0xae, 0x9b,
+0x98, 0x99, 0x99, 0x89, 0xca, 0xbb, 0x89, 0x00, 0x20, 0x46, 0x44, 0x46, 0x35, 0x24, 0x22, 0x01,
+0x90, 0xaa, 0xdb, 0xbb, 0xbc, 0xbb, 0x99, 0xa9, 0x9a, 0xdb, 0xbd, 0xaa, 0xa9, 0x99, 0x09, 0x21,
+0x34, 0x64, 0x44, 0x23, 0x22, 0x34, 0x32, 0x42, 0x43, 0x32, 0x21, 0x00, 0xb9, 0xbd, 0xba, 0xdb,
+0xbd, 0xaa, 0xbc, 0xad, 0xba, 0xcc, 0xab, 0x99, 0x88, 0x10, 0x22, 0x23, 0x43, 0x25, 0x81, 0x38,
+0x44, 0x32, 0x55, 0x44, 0x33, 0x35, 0x43, 0x01, 0x98, 0xa8, 0xdb, 0xbc, 0xbb, 0xbc, 0xbb, 0x99,
+0xaa, 0xbb, 0x9b, 0xb9, 0xbc, 0x0a, 0x00, 0x40, 0x47, 0x24, 0x32, 0x42, 0x22, 0x31, 0x34, 0x34,
+0x43, 0x34, 0x22, 0x02, 0x90, 0xba, 0xdb, 0xcd, 0xcc, 0xab, 0xcb, 0xaa, 0x8a, 0x9a, 0x9a, 0x10,
+0x11, 0x31, 0x36, 0x23, 0x21, 0x44, 0x23, 0x21, 0x32, 0x81, 0x38, 0x45, 0x22, 0x52, 0x34, 0x11,
+0x32, 0x02, 0xa9, 0xdc, 0xdb, 0xcc, 0xbc, 0xab, 0xbb, 0xab, 0x09, 0x88, 0x00, 0x10, 0x73, 0x35,
+0x33, 0x35, 0x33, 0x22, 0x22, 0x91, 0xdb, 0xab, 0xcb, 0xab, 0x88, 0xcb, 0x8b, 0x21, 0xc9, 0x2a,
+0x45, 0x22, 0x22, 0x82, 0xcc, 0xac, 0xb9, 0xdd, 0xaa, 0x99, 0xcc, 0x09, 0x01, 0xa9, 0x72, 0x24,
+0x10, 0x63, 0x33, 0x44, 0x44, 0x12, 0x88, 0x88, 0xb9, 0xbe, 0x9a, 0xbb, 0xad, 0x08, 0x00, 0x98,
+0x89, 0xc9, 0xcd, 0x9a, 0xa9, 0xcb, 0x09, 0x20, 0x32, 0x25, 0x22, 0x33, 0x33, 0x56, 0x55, 0x54,
+0x33, 0x22, 0x11, 0x90, 0xba, 0xcc, 0xcc, 0xcb, 0xaa, 0x99, 0x88, 0x88, 0xa9, 0xba, 0xaa, 0xb9,
+0x8a, 0x52, 0x34, 0x53, 0x35, 0x12, 0x21, 0x12, 0x12, 0x33, 0x35, 0x44, 0x34, 0x43, 0x33, 0x81,
+0x9a, 0xca, 0xdc, 0xbc, 0xbc, 0xaa, 0xaa, 0x88, 0x98, 0xbb, 0x9b, 0xca, 0xbc, 0xaa, 0x9a, 0x30,
+0x54, 0x53, 0x33, 0x32, 0x24, 0x12, 0x62, 0x35, 0x34, 0x44, 0x34, 0x12, 0x11, 0x01, 0xdb, 0xbc,
+0xdb, 0xbc, 0xaa, 0xaa, 0x9a, 0x89, 0x99, 0x18, 0x00, 0x88, 0x89, 0x00, 0x31, 0x47, 0x33, 0x42,
+0x43, 0x23, 0x53, 0x32, 0x32, 0x45, 0x44, 0x32, 0x33, 0x12, 0xa0, 0xdb, 0xcc, 0xcd, 0xbb, 0xba,
+0xbb, 0x9a, 0x99, 0x89, 0x20, 0x22, 0x42, 0x44, 0x32, 0x42, 0x33, 0x23, 0x33, 0x35, 0x23, 0x88,
+0x19, 0x00, 0x89, 0x74, 0x15, 0x00, 0x00, 0x80, 0x99, 0xda, 0xcf, 0xbb, 0xbb, 0xbc, 0x9b, 0x09,
+0x89, 0x31, 0x24, 0x42, 0x45, 0x13, 0x21, 0x32, 0x12, 0x33, 0x35, 0x13, 0xa0, 0x9a, 0xba, 0xce,
+0xaa, 0x9a, 0xca, 0x8a, 0x45, 0x03, 0x08, 0xa1, 0xef, 0x8a, 0xb9, 0xbd, 0x89, 0x98, 0x09, 0x11,
+0x02, 0xcb, 0x0b, 0x33, 0x21, 0x77, 0x34, 0x44, 0x64, 0x23, 0x12, 0x00, 0xba, 0xcc, 0xac, 0xbb,
+0xbb, 0x9a, 0x09, 0x11, 0x80, 0x99, 0xba, 0xbd, 0xab, 0x9a, 0x61, 0x45, 0x24, 0x43, 0x23, 0x22,
+0x22, 0x01, 0x80, 0x00, 0x10, 0x01, 0x30, 0x14, 0xec, 0xbc, 0xcc, 0xbc, 0x9b, 0x9a, 0x9a, 0x80,
+0x98, 0x0a, 0x90, 0xba, 0x9b, 0x20, 0x56, 0x43, 0x34, 0x13, 0x98, 0x88, 0xa9, 0x51, 0x13, 0x40,
+0x77, 0x23, 0x43, 0x24, 0x01, 0xa9, 0xa9, 0xdc, 0xcb, 0xaa, 0xaa, 0xaa, 0x08, 0x88, 0x89, 0x10,
+0x81, 0x89, 0x11, 0xb9, 0x8b, 0x45, 0x12, 0x43, 0x03, 0x08, 0x63, 0xa1, 0x2a, 0x67, 0x44, 0x44,
+0x24, 0x22, 0x10, 0x88, 0xca, 0xcb, 0xcc, 0xcb, 0x9a, 0x99, 0x99, 0x88, 0x88, 0x08, 0x22, 0x12,
+0x88, 0x09, 0x40, 0x46, 0x33, 0x22, 0x12, 0x80, 0x41, 0x35, 0x23, 0x53, 0x35, 0x34, 0x42, 0x22,
+0xc9, 0xcb, 0xdb, 0xbc, 0xbb, 0xbb, 0xcb, 0x9a, 0x08, 0x99, 0x09, 0x43, 0x23, 0x54, 0x25, 0x22,
+0x42, 0x24, 0x00, 0x18, 0x81, 0xa9, 0x88, 0x90, 0xa9, 0x28, 0x25, 0xc9, 0x0a, 0xb0, 0xff, 0x8a,
+0xa9, 0xbd, 0xaa, 0x99, 0xba, 0x18, 0x15, 0xa8, 0x08, 0x91, 0xbd, 0x40, 0x46, 0x34, 0x44, 0x34,
+0x36, 0x32, 0x02, 0xa8, 0xcc, 0xbc, 0xcb, 0xbb, 0xaa, 0x8a, 0x00, 0x11, 0x81, 0xa8, 0xaa, 0xba,
+0xaa, 0x40, 0x47, 0x43, 0x44, 0x33, 0x22, 0x11, 0x01, 0x81, 0x88, 0x21, 0x33, 0x43, 0x25, 0x81,
+0xcd, 0xcc, 0xcc, 0xbb, 0xbb, 0xbb, 0x9b, 0x99, 0x08, 0x32, 0x33, 0x43, 0x43, 0x42, 0x24, 0x34,
+0x33, 0x01, 0x62, 0x24, 0x11, 0x33, 0x81, 0x10, 0x44, 0x23, 0x12, 0xc8, 0xdd, 0xcb, 0xcb, 0xbc,
+0xbb, 0xab, 0x99, 0x20, 0x33, 0x11, 0x32, 0x44, 0x12, 0x33, 0x12, 0x08, 0x55, 0x23, 0x21, 0x11,
+0xea, 0xac, 0x99, 0xcc, 0x1a, 0x32, 0x22, 0x67, 0x24, 0x12, 0x11, 0x88, 0xbb, 0xbd, 0xba, 0xbb,
+0x9b, 0x9a, 0xab, 0xab, 0xbc, 0xab, 0xbc, 0xbc, 0x88, 0x42, 0x46, 0x44, 0x23, 0x22, 0x23, 0x00,
+0x18, 0x81, 0xbd, 0x18, 0x44, 0x44, 0x33, 0x02, 0x98, 0xdb, 0xcc, 0xdb, 0xbb, 0xbb, 0xaa, 0xac,
+0xbb, 0xbb, 0xbc, 0x09, 0x12, 0x52, 0x56, 0x54, 0x53, 0x33, 0x33, 0x22, 0x88, 0xca, 0xdb, 0xbc,
+0xbb, 0xbb, 0x9a, 0x98, 0x98, 0x89, 0xba, 0xbb, 0xac, 0x09, 0x32, 0x73, 0x54, 0x33, 0x44, 0x22,
+0x11, 0x21, 0x81, 0x20, 0x34, 0x23, 0x62, 0x43, 0x81, 0xaa, 0xcd, 0xcc, 0xab, 0xbb, 0xcb, 0xaa,
+0x99, 0x88, 0x09, 0x08, 0x99, 0x19, 0x22, 0x42, 0x44, 0x12, 0x42, 0x43, 0x34, 0x43, 0x44, 0x43,
+0x24, 0x43, 0x44, 0x33, 0x24, 0x11, 0xa8, 0xcd, 0xbc, 0xbc, 0xcb, 0xbb, 0xab, 0x9a, 0x89, 0x18,
+0x22, 0x23, 0x43, 0x33, 0x32, 0x44, 0x23, 0x21, 0x54, 0x34, 0x42, 0x32, 0x24, 0x32, 0x32, 0x34,
+0x23, 0x91, 0xb9, 0xcf, 0xcc, 0xbb, 0xcc, 0xcb, 0xab, 0xa9, 0xa9, 0x89, 0x11, 0x10, 0x53, 0x25,
+0x33, 0x53, 0x43, 0x22, 0x21, 0x12, 0x80, 0x88, 0xa8, 0xab, 0x28, 0x03, 0x18, 0x67, 0x82, 0xbc,
+0xbb, 0xeb, 0xbc, 0xbb, 0xbc, 0xbb, 0x89, 0x80, 0x80, 0x08, 0x30, 0x47, 0x43, 0x53, 0x34, 0x53,
+0x43, 0x33, 0x01, 0x98, 0xa9, 0xcd, 0xac, 0xaa, 0xbb, 0xab, 0x9b, 0xaa, 0xba, 0x9b, 0x89, 0x08,
+0x32, 0x24, 0x82, 0x38, 0x67, 0x33, 0x53, 0x33, 0x41, 0x45, 0x11, 0x41, 0x33, 0x00, 0x22, 0x91,
+0x9a, 0xb9, 0xef, 0xab, 0xbc, 0xbb, 0xbb, 0xaa, 0x9a, 0xab, 0x09, 0x01, 0x99, 0x52, 0x23, 0x01,
+0x98, 0xdc, 0x09, 0x42, 0x57, 0x14, 0x31, 0x54, 0x33, 0x54, 0x24, 0x01, 0x88, 0xa8, 0xbc, 0xdb,
+0xbc, 0xab, 0xab, 0x9a, 0x98, 0x88, 0x88, 0x08, 0x10, 0x22, 0x32, 0x53, 0x63, 0x53, 0x32, 0x22,
+0x43, 0x01, 0x31, 0x16, 0x80, 0x72, 0x13, 0x21, 0x22, 0xa8, 0xab, 0xea, 0xbd, 0xcc, 0xcb, 0xaa,
+0x99, 0x99, 0x89, 0x08, 0x20, 0x53, 0x32, 0x31, 0x33, 0x22, 0x33, 0x04, 0x80, 0x21, 0x23, 0x75,
+0x45, 0x12, 0x10, 0x32, 0x91, 0xab, 0x81, 0xde, 0x9a, 0xa9, 0xbd, 0x9b, 0xa8, 0xbc, 0x9c, 0xaa,
+0xcb, 0x48, 0x45, 0x21, 0x53, 0x14, 0x81, 0x21, 0x91, 0xbb, 0x8a, 0xca, 0x9b, 0x00, 0xca, 0xac,
+0x98, 0x99, 0x9b, 0x61, 0x15, 0x10, 0x54, 0x03, 0xa9, 0x28, 0xb1, 0xcf, 0x9a, 0x98, 0xcb, 0xab,
+0xaa, 0xca, 0x19, 0x35, 0x22, 0x76, 0x44, 0x32, 0x24, 0x11, 0x89, 0xba, 0xbd, 0xbc, 0xbb, 0xbb,
+0x09, 0x20, 0x22, 0x00, 0xa8, 0xdd, 0xbb, 0xba, 0xac, 0x18, 0x32, 0x44, 0x45, 0x23, 0x32, 0x54,
+0x33, 0x42, 0x34, 0x12, 0x08, 0xb8, 0xdc, 0xac, 0xbc, 0xcb, 0x9a, 0x99, 0x08, 0x01, 0x88, 0x00,
+0x01, 0x80, 0x10, 0x01, 0x72, 0x34, 0x24, 0x22, 0x00, 0xa9, 0x9b, 0x18, 0x81, 0x61, 0x45, 0x21,
+0x45, 0x23, 0x21, 0x34, 0x91, 0xaa, 0xbc, 0xdc, 0xab, 0xab, 0xdb, 0xac, 0x9a, 0xca, 0xaa, 0x9a,
+0xba, 0x9a, 0x09, 0x90, 0x50, 0x57, 0x33, 0x44, 0x34, 0x12, 0x43, 0x33, 0x01, 0x10, 0x90, 0xbd,
+0xab, 0xda, 0xcc, 0x9a, 0xba, 0x9c, 0x89, 0xa9, 0x9b, 0x00, 0xa8, 0x0a, 0x11, 0xca, 0x39, 0x37,
+0x01, 0x10, 0x33, 0x22, 0x55, 0x53, 0x43, 0x45, 0x43, 0x23, 0x23, 0x82, 0xa8, 0xcc, 0xbc, 0xbc,
+0xbc, 0xbb, 0xaa, 0x9b, 0x99, 0x98, 0x00, 0x90, 0x40, 0x45, 0x32, 0x35, 0x23, 0x01, 0x20, 0x03,
+0xb9, 0xcb, 0xcb, 0xaa, 0x28, 0x63, 0x44, 0x43, 0x34, 0x42, 0x32, 0x12, 0xc9, 0xbb, 0xed, 0xac,
+0x9b, 0xab, 0xab, 0x88, 0x98, 0x89, 0x22, 0x43, 0x34, 0x34, 0x24, 0x53, 0x35, 0x12, 0x20, 0x13,
+0xb8, 0x9b, 0xa8, 0xcf, 0x9b, 0x00, 0x10, 0x52, 0x43, 0x11, 0x90, 0xdb, 0xcd, 0xcb, 0xbb, 0xac,
+0x9b, 0x08, 0x80, 0x99, 0x08, 0x10, 0x62, 0x54, 0x35, 0x43, 0x63, 0x35, 0x24, 0x12, 0x80, 0xda,
+0xbb, 0xbc, 0xbc, 0xaa, 0x99, 0x08, 0x11, 0x81, 0x99, 0xb9, 0xac, 0x0a, 0x10, 0x74, 0x44, 0x23,
+0x22, 0x33, 0x01, 0x89, 0x88, 0x98, 0x09, 0x11, 0x53, 0x34, 0x11, 0xa8, 0xce, 0xab, 0xcb, 0xbb,
+0xbc, 0xbc, 0xbb, 0xac, 0x99, 0xc9, 0x9b, 0x42, 0x22, 0x31, 0x44, 0x01, 0x00, 0x11, 0x43, 0x46,
+0x34, 0x34, 0x21, 0x43, 0x25, 0x01, 0x12, 0xb0, 0xbe, 0xab, 0xeb, 0xab, 0xaa, 0xdb, 0x8a, 0x88,
+0x88, 0x08, 0x12, 0x11, 0x51, 0x34, 0x82, 0x08, 0x01, 0x88, 0x10, 0xa8, 0xac, 0x08, 0x40, 0x57,
+0x22, 0x11, 0x45, 0x35, 0x33, 0x33, 0x82, 0xbc, 0xac, 0xbc, 0x9c, 0xaa, 0xcc, 0x9a, 0xa9, 0xdb,
+0xba, 0xa9, 0xa9, 0x18, 0x35, 0x43, 0x54, 0x33, 0x21, 0x33, 0x81, 0x9a, 0x80, 0xd9, 0x0a, 0x63,
+0x53, 0x43, 0x23, 0x88, 0xba, 0xdb, 0xcc, 0xcb, 0xba, 0xb9, 0x9a, 0x9a, 0xcb, 0xbb, 0xbb, 0x8a,
+0x52, 0x54, 0x55, 0x44, 0x32, 0x34, 0x11, 0x00, 0xa9, 0xcb, 0xcc, 0xba, 0xab, 0xa9, 0x99, 0x08,
+0x90, 0x99, 0x99, 0x9a, 0x09, 0xb9, 0x0a, 0x34, 0x42, 0x67, 0x23, 0x21, 0x44, 0x12, 0x00, 0x52,
+0x34, 0x14, 0x33, 0x33, 0x90, 0x00, 0xfb, 0xbf, 0xba, 0xbc, 0xba, 0x89, 0x98, 0x98, 0x10, 0x90,
+0x99, 0x80, 0xc9, 0xab, 0x89, 0x41, 0x45, 0x45, 0x34, 0x32, 0x34, 0x34, 0x53, 0x25, 0x13, 0x11,
+0x81, 0xb8, 0xcc, 0xcc, 0xcb, 0xba, 0xbb, 0xab, 0xbb, 0x9b, 0x88, 0x88, 0x31, 0x34, 0x43, 0x35,
+0x12, 0x00, 0x12, 0x10, 0x73, 0x25, 0x22, 0x44, 0x32, 0x44, 0x33, 0x12, 0x22, 0xa1, 0xac, 0xeb,
+0xcc, 0xbc, 0xcb, 0xaa, 0xa9, 0x99, 0x99, 0x18, 0x21, 0x12, 0x35, 0x23, 0x28, 0x43, 0x22, 0x44,
+0x23, 0x11, 0x12, 0x10, 0x54, 0x23, 0x21, 0x45, 0x34, 0x22, 0x22, 0xa1, 0xde, 0xcb, 0xcb, 0xbc,
+0xaa, 0xba, 0x9b, 0x09, 0x00, 0x42, 0x35, 0x23, 0x32, 0x35, 0x12, 0x12, 0x11, 0x80, 0x09, 0x21,
+0xa0, 0x9b, 0x08, 0x91, 0xbc, 0x71, 0x67, 0x80, 0x10, 0x91, 0xbd, 0xaa, 0xea, 0xbc, 0xab, 0xaa,
+0x9a, 0x09, 0xb8, 0xcd, 0x89, 0x00, 0x08, 0x66, 0x24, 0x42, 0x66, 0x43, 0x22, 0x01, 0xa8, 0xcb,
+0xcb, 0xcb, 0xbb, 0x9b, 0x99, 0x11, 0x01, 0x00, 0xa0, 0xcb, 0xaa, 0x88, 0x28, 0x67, 0x43, 0x32,
+0x33, 0x32, 0x02, 0x00, 0x90, 0xca, 0xaa, 0x88, 0x08, 0x21, 0xa0, 0xdd, 0xcb, 0xcb, 0xbc, 0xaa,
+0xaa, 0xba, 0x9a, 0x18, 0x01, 0xa9, 0x18, 0x22, 0x66, 0x34, 0x23, 0x81, 0xaa, 0xdb, 0xbc, 0x99,
+0xb9, 0x1b, 0x77, 0x23, 0x64, 0x43, 0x22, 0x21, 0x01, 0xba, 0xad, 0xdb, 0xbb, 0xab, 0xaa, 0x9a,
+0x0a, 0x08, 0x89, 0x18, 0x90, 0x9b, 0x61, 0x13, 0x11, 0x35, 0x91, 0xac, 0x09, 0x01, 0x52, 0x56,
+0x44, 0x42, 0x34, 0x33, 0x12, 0x22, 0xc8, 0xbc, 0xbb, 0xbe, 0xcb, 0xba, 0xab, 0xab, 0xaa, 0x9a,
+0x9a, 0x28, 0x53, 0x22, 0x52, 0x43, 0x21, 0x44, 0x14, 0x81, 0x20, 0x12, 0x33, 0x44, 0x24, 0x34,
+0x12, 0x12, 0x90, 0xdb, 0xcd, 0xcb, 0xbb, 0xdb, 0xbb, 0xab, 0xbb, 0xa9, 0x89, 0xaa, 0x0a, 0x74,
+0x35, 0x44, 0x44, 0x22, 0x21, 0x12, 0x80, 0x99, 0xa9, 0xcd, 0xab, 0x99, 0xba, 0x9a, 0xb9, 0xcc,
+0x9a, 0xa9, 0xbb, 0x09, 0xa0, 0x09, 0x23, 0xe8, 0x8a, 0x11, 0x80, 0x31, 0x77, 0x34, 0x34, 0x65,
+0x43, 0x23, 0x32, 0x13, 0x99, 0xca, 0xcd, 0xbc, 0xba, 0xbb, 0x9b, 0x99, 0x98, 0x88, 0x88, 0xa8,
+0xaa, 0xa9, 0xbc, 0x28, 0x22, 0x73, 0x57, 0x23, 0x32, 0x44, 0x22, 0x63, 0x34, 0x23, 0x11, 0x02,
+0xc9, 0xcb, 0xcc, 0xbd, 0xba, 0xba, 0xba, 0x99, 0x08, 0x98, 0x08, 0x21, 0x21, 0x54, 0x33, 0x22,
+0x44, 0x33, 0x22, 0x44, 0x02, 0x11, 0x43, 0x44, 0x34, 0x23, 0x22, 0x12, 0xa9, 0xcc, 0xde, 0xcb,
+0xba, 0xbb, 0xaa, 0x99, 0xaa, 0x19, 0x31, 0x33, 0x33, 0x44, 0x43, 0x32, 0x42, 0x12, 0x01, 0x21,
+0x02, 0x41, 0x47, 0x33, 0x22, 0x54, 0x33, 0x12, 0x20, 0xc0, 0xcf, 0xab, 0xca, 0xcb, 0x9a, 0xaa,
+0xab, 0x08, 0x11, 0x32, 0x46, 0x33, 0x43, 0x34, 0x81, 0x08, 0x90, 0xbc, 0x9a, 0xbb, 0xad, 0x08,
+0x11, 0x18, 0x74, 0x24, 0x31, 0x44, 0x01, 0x98, 0xa9, 0xeb, 0xcb, 0xba, 0xba, 0xaa, 0x98, 0xb8,
+0xdb, 0xbc, 0xaa, 0x19, 0x73, 0x45, 0x23, 0x35, 0x45, 0x22, 0x12, 0x80, 0xba, 0xbd, 0xcb, 0xba,
+0xbb, 0xaa, 0x89, 0x18, 0x88, 0x9a, 0xba, 0xbe, 0x8a, 0x10, 0x32, 0x57, 0x43, 0x22, 0x33, 0x53,
+0x22, 0x11, 0x11, 0x08, 0x80, 0x89, 0xaa, 0xdd, 0xcc, 0x9a, 0xba, 0xcb, 0x8a, 0xa9, 0xab, 0x28,
+0x02, 0x80, 0x31, 0x02, 0xaa, 0x73, 0x37, 0x12, 0x31, 0xa1, 0xac, 0x8a, 0xdc, 0xbc, 0xba, 0x8a,
+0x40, 0x55, 0x44, 0x34, 0x44, 0x12, 0x11, 0x81, 0xdb, 0xab, 0xdb, 0xcb, 0x99, 0x98, 0x9a, 0x08,
+0x01, 0x98, 0x10, 0x91, 0xbb, 0x58, 0x24, 0x00, 0x20, 0x13, 0xdb, 0x69, 0x35, 0x21, 0x54, 0x33,
+0x32, 0x44, 0x23, 0x90, 0xa9, 0xbc, 0xce, 0xab, 0xca, 0xbb, 0xab, 0xba, 0xab, 0x30, 0x32, 0x55,
+0x24, 0x23, 0x33, 0x21, 0x01, 0xb8, 0xab, 0x99, 0xcc, 0x19, 0x34, 0x12, 0x42, 0x44, 0x33, 0x24,
+0x21, 0x11, 0xa0, 0xcd, 0xcd, 0xcb, 0xbb, 0xbc, 0xcb, 0xaa, 0xba, 0xab, 0x08, 0x11, 0x42, 0x45,
+0x33, 0x54, 0x53, 0x45, 0x34, 0x33, 0x23, 0xa0, 0xbb, 0xcd, 0xcc, 0xaa, 0xba, 0x9a, 0x80, 0x88,
+0x80, 0xb8, 0xbd, 0x89, 0x89, 0x38, 0x37, 0x33, 0x35, 0x25, 0x11, 0x12, 0x02, 0x80, 0x20, 0x34,
+0x53, 0x53, 0x22, 0x01, 0xca, 0xcd, 0xcb, 0xdb, 0xab, 0xab, 0xaa, 0x89, 0x00, 0x81, 0x08, 0x21,
+0x32, 0x45, 0x24, 0x32, 0x44, 0x44, 0x22, 0x21, 0x12, 0x81, 0x09, 0x11, 0xa9, 0x18, 0xb0, 0xaf,
+0x20, 0xa0, 0xdb, 0xdd, 0xac, 0x99, 0xca, 0xab, 0xa8, 0xab, 0x0a, 0x81, 0x10, 0x22, 0x43, 0x55,
+0x34, 0x22, 0x31, 0x34, 0x23, 0x43, 0x24, 0x00, 0x52, 0x24, 0x91, 0x09, 0x80, 0xdc, 0x9b, 0xb8,
+0xdf, 0xab, 0x99, 0x9a, 0x89, 0x22, 0x23, 0x23, 0x33, 0x12, 0x90, 0x99, 0xa9, 0xdf, 0x9b, 0x11,
+0xa8, 0x30, 0x15, 0xaa, 0x73, 0x57, 0x12, 0x21, 0x32, 0x12, 0x80, 0xba, 0xdd, 0xbc, 0x9b, 0xa9,
+0xbb, 0xca, 0xbb, 0x9a, 0xa8, 0x0a, 0x35, 0x23, 0x65, 0x36, 0x24, 0x23, 0x22, 0x00, 0xb9, 0xbc,
+0xcb, 0xbc, 0x9c, 0x89, 0x99, 0x88, 0x01, 0x90, 0x18, 0x11, 0x09, 0x54, 0x82, 0xbb, 0x20, 0xd0,
+0xad, 0x10, 0xd8, 0xad, 0x08, 0xb9, 0x9c, 0x63, 0x53, 0x54, 0x44, 0x43, 0x24, 0x01, 0x99, 0xca,
+0xbc, 0xbc, 0xbb, 0xab, 0x89, 0x18, 0x23, 0x01, 0xa8, 0xbb, 0xcc, 0xab, 0x0a, 0x72, 0x44, 0x34,
+0x35, 0x32, 0x32, 0x33, 0x12, 0x80, 0xeb, 0xbc, 0xba, 0xac, 0x9b, 0xca, 0xaa, 0x89, 0x99, 0x08,
+0xa8, 0xac, 0x89, 0x98, 0x31, 0x46, 0x34, 0x53, 0x33, 0x12, 0x11, 0x80, 0xa9, 0x29, 0x45, 0x23,
+0x80, 0xa9, 0xbb, 0x19, 0xf0, 0xcd, 0xaa, 0xdc, 0x9a, 0x20, 0x81, 0x08, 0x73, 0x33, 0x23, 0x34,
+0x03, 0x80, 0x01, 0xdd, 0xbc, 0xca, 0xbc, 0x99, 0x98, 0x9b, 0x00, 0xb8, 0x8a, 0x42, 0x22, 0x75,
+0x45, 0x23, 0x43, 0x23, 0x81, 0x98, 0xa9, 0xcd, 0xab, 0xaa, 0xbb, 0x9a, 0x88, 0xc9, 0xac, 0x29,
+0x33, 0x21, 0x62, 0x23, 0xa9, 0x8a, 0x90, 0xdd, 0x9b, 0x08, 0x10, 0x41, 0x44, 0x44, 0x35, 0x34,
+0x22, 0x23, 0x81, 0xca, 0xcc, 0xbc, 0xcb, 0xbc, 0xaa, 0x99, 0xca, 0xaa, 0x89, 0x80, 0x11, 0x63,
+0x34, 0x34, 0x54, 0x54, 0x33, 0x23, 0x12, 0x90, 0xbc, 0xbc, 0xcc, 0xab, 0x9a, 0xaa, 0x08, 0x91,
+0xaa, 0x9a, 0xea, 0x9b, 0x80, 0x99, 0x62, 0x35, 0x33, 0x34, 0x22, 0x01, 0x00, 0x10, 0x01, 0x63,
+0x46, 0x33, 0x42, 0x23, 0x90, 0xba, 0xdd, 0xcd, 0xaa, 0xab, 0xab, 0x99, 0x88, 0x08, 0x22, 0x11,
+0x31, 0x22, 0x10, 0x81, 0x52, 0x36, 0x44, 0x45, 0x23, 0x21, 0x43, 0x12, 0x32, 0x03, 0xb9, 0xcd,
+0xcb, 0xcb, 0xbb, 0xcc, 0xbb, 0x9a, 0x99, 0x9a, 0x09, 0x88, 0x21, 0x45, 0x43, 0x43, 0x34, 0x12,
+0x01, 0x01, 0x98, 0xab, 0xba, 0xad, 0x30, 0x56, 0x43, 0x32, 0x43, 0x12, 0x80, 0xb9, 0xcf, 0xcb,
+0xac, 0x9a, 0x9a, 0x8a, 0x88, 0x80, 0x00, 0x22, 0x42, 0x45, 0x44, 0x34, 0x23, 0x12, 0x01, 0xa8,
+0xab, 0xcb, 0xbd, 0xac, 0xaa, 0x9b, 0x08, 0x88, 0x38, 0x35, 0x21, 0x22, 0x01, 0xb9, 0xdd, 0xcb,
+0xaa, 0xba, 0x9a, 0xa9, 0xcd, 0x89, 0x11, 0x31, 0x56, 0x34, 0x45, 0x44, 0x24, 0x13, 0x02, 0x90,
+0xb9, 0xda, 0xcc, 0xac, 0xba, 0xba, 0x89, 0x88, 0x99, 0x20, 0x82, 0xb9, 0xab, 0xba, 0x89, 0x18,
+0x77, 0x25, 0x11, 0x43, 0x34, 0x31, 0x44, 0x23, 0x22, 0x22, 0x23, 0xa8, 0xbd, 0xec, 0xbc, 0xbb,
+0xca, 0xac, 0x9b, 0x9a, 0x9a, 0x10, 0x12, 0x22, 0x33, 0x25, 0x22, 0x11, 0x20, 0x54, 0x43, 0x53,
+0x44, 0x34, 0x32, 0x53, 0x12, 0x88, 0x80, 0xda, 0xad, 0xbb, 0xcc, 0xba, 0x9a, 0xaa, 0x99, 0x98,
+0x88, 0x21, 0x34, 0x32, 0x46, 0x33, 0x22, 0x22, 0x01, 0xb9, 0xcc, 0xcb, 0xbb, 0x18, 0x12, 0x73,
+0x45, 0x42, 0x43, 0x23, 0x81, 0x88, 0xc9, 0xbd, 0xbb, 0xbc, 0xbc, 0x99, 0x99, 0x08, 0x31, 0x32,
+0x32, 0x44, 0x12, 0xa8, 0xa9, 0xbc, 0x0a, 0x82, 0xaa, 0x20, 0xa1, 0x2a, 0x77, 0x15, 0x31, 0x55,
+0x23, 0x21, 0x33, 0xa1, 0xcc, 0xaa, 0xcc, 0xcc, 0x9a, 0xb9, 0xab, 0x08, 0xb8, 0x8b, 0x11, 0x8a,
+0x76, 0x34, 0x24, 0x32, 0x33, 0x12, 0x81, 0xb9, 0xbd, 0xac, 0xbb, 0x9a, 0x98, 0xaa, 0xaa, 0x99,
+0xca, 0x9d, 0x18, 0xa9, 0x9a, 0x81, 0xb9, 0xed, 0xcc, 0x9a, 0x99, 0x28, 0x35, 0x32, 0x46, 0x34,
+0x45, 0x35, 0x32, 0x21, 0x01, 0xa8, 0xcb, 0xdb, 0xbc, 0xac, 0xa9, 0xa9, 0xab, 0x98, 0xc9, 0x8a,
+0x81, 0xba, 0x8a, 0x10, 0xa9, 0x28, 0x56, 0x32, 0x53, 0x22, 0x53, 0x57, 0x33, 0x34, 0x25, 0x11,
+0x10, 0x90, 0xdb, 0xdb, 0xbb, 0xcb, 0xab, 0xa9, 0xa9, 0x89, 0x88, 0xaa, 0x88, 0x80, 0x00, 0x63,
+0x24, 0x42, 0x44, 0x23, 0x22, 0x42, 0x43, 0x53, 0x24, 0x22, 0x22, 0x12, 0x01, 0xa9, 0xcf, 0xcb,
+0xbc, 0xcb, 0xaa, 0xba, 0xab, 0x89, 0x89, 0x10, 0x24, 0x33, 0x44, 0x43, 0x22, 0x32, 0x24, 0x90,
+0x89, 0x22, 0x88, 0x20, 0x33, 0x53, 0x25, 0x44, 0x44, 0x11, 0x32, 0xa1, 0xcd, 0xba, 0xcd, 0xac,
+0xaa, 0xbb, 0x8a, 0x08, 0x30, 0x35, 0x32, 0x43, 0x25, 0x13, 0x11, 0xa8, 0xcc, 0xab, 0x99, 0xba,
+0xaa, 0x98, 0xaa, 0x70, 0x45, 0x23, 0x34, 0x26, 0x12, 0x00, 0x81, 0xb8, 0xdb, 0xcb, 0xcb, 0xaa,
+0xbc, 0xac, 0xaa, 0xcb, 0xac, 0x09, 0x20, 0x63, 0x55, 0x33, 0x24, 0x42, 0x22, 0x88, 0x88, 0xda,
+0xcb, 0xa9, 0xba, 0x9b, 0x89, 0x98, 0xbb, 0x9a, 0xb9, 0xad, 0x20, 0x82, 0x9a, 0x43, 0x13, 0x40,
+0x46, 0x22, 0x62, 0x24, 0x11, 0x44, 0x24, 0x20, 0x43, 0x83, 0x99, 0x88, 0xfb, 0xbe, 0xaa, 0xba,
+0xac, 0x08, 0x00, 0x20, 0x22, 0x82, 0xaa, 0x08, 0x98, 0x0a, 0x44, 0x03, 0x80, 0xb9, 0xad, 0x88,
+0xda, 0x9b, 0x60, 0x55, 0x55, 0x34, 0x24, 0x22, 0x22, 0x98, 0xba, 0xce, 0xcb, 0xba, 0xba, 0xa9,
+0x89, 0x98, 0x98, 0x08, 0x90, 0x9a, 0x40, 0x15, 0x31, 0x55, 0x23, 0x01, 0x32, 0x13, 0x21, 0x36,
+0x23, 0x42, 0x34, 0x33, 0x22, 0xa0, 0xdd, 0xcb, 0xbb, 0xbd, 0xac, 0xba, 0xcb, 0x9b, 0x99, 0x89,
+0x20, 0x34, 0x33, 0x45, 0x14, 0x11, 0x22, 0x00, 0x28, 0x13, 0x08, 0x32, 0x02, 0x51, 0x26, 0x32,
+0x45, 0x12, 0x00, 0x91, 0xfd, 0xbb, 0xaa, 0xcc, 0xab, 0xaa, 0xab, 0x8a, 0xba, 0x9d, 0x20, 0x34,
+0x63, 0x45, 0x43, 0x53, 0x43, 0x23, 0x00, 0x99, 0xca, 0xcc, 0xbb, 0xcb, 0xaa, 0x89, 0x18, 0x00,
+0x91, 0x88, 0x10, 0xa9, 0x99, 0x00, 0x63, 0x34, 0x63, 0x34, 0x21, 0x41, 0x02, 0x88, 0x40, 0x33,
+0x35, 0x34, 0x13, 0x90, 0xba, 0xde, 0xcc, 0xab, 0xaa, 0xbb, 0x99, 0x21, 0x02, 0x98, 0x98, 0xb8,
+0xab, 0x30, 0x35, 0x22, 0x08, 0x00, 0xc9, 0x1a, 0x25, 0x89, 0x76, 0x47, 0x32, 0x44, 0x34, 0x23,
+0x12, 0x80, 0xea, 0xcc, 0xba, 0xac, 0xbb, 0xa9, 0x98, 0x09, 0x10, 0x12, 0x12, 0x10, 0x33, 0x12,
+0x40, 0x46, 0x22, 0x42, 0x24, 0x11, 0x22, 0x01, 0x31, 0x35, 0x43, 0x23, 0x00, 0x88, 0xcc, 0xbc,
+0xcc, 0xbd, 0xdb, 0xbb, 0xaa, 0xab, 0x9a, 0x10, 0x33, 0x37, 0x33, 0x35, 0x23, 0x22, 0x02, 0xa9,
+0x99, 0xb9, 0x0b, 0x43, 0x13, 0x22, 0x22, 0x53, 0x54, 0x03, 0xda, 0xcb, 0xdb, 0xbc, 0x9b, 0xa8,
+0xca, 0xba, 0xb9, 0xec, 0xbc, 0x0a, 0x11, 0x53, 0x54, 0x43, 0x43, 0x35, 0x25, 0x13, 0x90, 0xa9,
+0xbc, 0xbd, 0xcb, 0xbb, 0xaa, 0x88, 0x08, 0x00, 0x00, 0x80, 0x99, 0x18, 0x22, 0x32, 0x67, 0x44,
+0x32, 0x32, 0x43, 0x12, 0x00, 0x98, 0x99, 0x8a, 0x09, 0x01, 0xfb, 0xad, 0x98, 0xca, 0xbb, 0xbc,
+0xbc, 0xba, 0x8a, 0x10, 0xda, 0x9b, 0x32, 0x32, 0x57, 0x33, 0x22, 0x23, 0xa0, 0xdb, 0xbc, 0xab,
+0x88, 0x28, 0x57, 0x23, 0x63, 0x35, 0x12, 0x00, 0x91, 0xeb, 0xbb, 0xbb, 0xbc, 0xab, 0x89, 0x99,
+0x0a, 0x88, 0x08, 0x63, 0x23, 0x20, 0x34, 0x02, 0x31, 0x35, 0xb0, 0xbc, 0x10, 0x01, 0x72, 0x34,
+0x24, 0x43, 0x33, 0x13, 0x91, 0xcc, 0xbc, 0xad, 0xaa, 0xcb, 0xcb, 0xaa, 0xba, 0x9b, 0x80, 0x18,
+0x54, 0x44, 0x44, 0x33, 0x22, 0x02, 0xa8, 0xbb, 0xca, 0xbb, 0x9b, 0x19, 0x21, 0x21, 0x34, 0x91,
+0x9a, 0xd9, 0xbe, 0x89, 0xca, 0x09, 0xb0, 0x9f, 0x20, 0xb0, 0xbd, 0xda, 0xbc, 0x9a, 0x08, 0x31,
+0x56, 0x43, 0x43, 0x56, 0x34, 0x23, 0x11, 0xb0, 0xbd, 0xcb, 0xcc, 0xab, 0xa9, 0x99, 0x18, 0x11,
+0x88, 0x00, 0x88, 0x89, 0x18, 0x54, 0x44, 0x54, 0x33, 0x22, 0x31, 0x23, 0xa9, 0x99, 0xd8, 0xbc,
+0x89, 0xa9, 0x9a, 0xa8, 0xcd, 0xab, 0xba, 0xad, 0xab, 0x89, 0x89, 0x9a, 0x51, 0x33, 0x35, 0x35,
+0x32, 0x53, 0x33, 0x32, 0x12, 0xb9, 0xbd, 0xcb, 0xcc, 0xaa, 0x98, 0x99, 0x89, 0xb9, 0x2a, 0x77,
+0x13, 0x32, 0x24, 0x91, 0x18, 0x12, 0xd9, 0xab, 0xb9, 0xcd, 0x89, 0xa9, 0xbb, 0xaa, 0xc9, 0xab,
+0x0a, 0x12, 0xda, 0x38, 0x27, 0x01, 0x53, 0x12, 0x30, 0x35, 0x12, 0x62, 0x24, 0x23, 0x32, 0x12,
+0xb0, 0xbe, 0xcc, 0xcc, 0xbb, 0xba, 0xaa, 0x09, 0x80, 0x99, 0x30, 0x35, 0x42, 0x45, 0x22, 0x20,
+0x33, 0x13, 0x11, 0x01, 0xec, 0x9a, 0x80, 0xc9, 0x8a, 0x20, 0x20, 0x42, 0x13, 0xc8, 0xbd, 0xcc,
+0xcc, 0xaa, 0x99, 0xba, 0x09, 0xb8, 0xbd, 0x08, 0x81, 0x19, 0x67, 0x33, 0x42, 0x46, 0x33, 0x44,
+0x32, 0x23, 0x81, 0xca, 0xcc, 0xbd, 0xab, 0xac, 0x9b, 0x09, 0x98, 0x08, 0x22, 0x90, 0x9a, 0x08,
+0xa9, 0x19, 0x35, 0x62, 0x46, 0x23, 0x21, 0x34, 0x12, 0x61, 0x44, 0x22, 0x21, 0x32, 0x91, 0xdb,
+0xdc, 0xbc, 0xbc, 0xab, 0xbb, 0x99, 0x00, 0x00, 0x21, 0x23, 0x03, 0x21, 0x53, 0x12, 0x52, 0x35,
+0x23, 0x53, 0x32, 0x01, 0x31, 0x44, 0x12, 0x43, 0x43, 0x02, 0x98, 0xc9, 0xce, 0xbc, 0xdb, 0xbb,
+0xab, 0xaa, 0x99, 0x08, 0x10, 0x31, 0x45, 0x23, 0x43, 0x33, 0x43, 0x32, 0x01, 0x90, 0x9a, 0x8b,
+0x28, 0x52, 0x44, 0x02, 0x41, 0x37, 0x11, 0x00, 0xa1, 0xec, 0xbb, 0xbb, 0xbd, 0xbb, 0xab, 0xba,
+0x28, 0x34, 0x23, 0x63, 0x34, 0x12, 0x31, 0x03, 0xbb, 0x9a, 0xca, 0x8a, 0x90, 0xb9, 0xca, 0x0a,
+0x45, 0x21, 0x66, 0x14, 0x10, 0x43, 0x01, 0xaa, 0xba, 0xbd, 0xbc, 0xab, 0xa9, 0xbc, 0x9b, 0xb9,
+0xbb, 0xcb, 0x2a, 0x57, 0x44, 0x53, 0x23, 0x12, 0x21, 0x01, 0xb9, 0xdb, 0xcb, 0xbb, 0xaa, 0xa9,
+0xaa, 0xac, 0x9a, 0xab, 0x0a, 0x88, 0x18, 0x73, 0x24, 0x11, 0x81, 0xb8, 0x89, 0x80, 0xcd, 0x09,
+0x22, 0x52, 0x36, 0x34, 0x57, 0x43, 0x33, 0x23, 0x11, 0x01, 0xc9, 0xcd, 0xdb, 0xbb, 0xab, 0xab,
+0x9a, 0x99, 0x08, 0x32, 0x80, 0x00, 0xeb, 0xac, 0x98, 0xcc, 0x0a, 0x10, 0x18, 0x56, 0x53, 0x42,
+0x43, 0x35, 0x34, 0x32, 0x32, 0x01, 0xa8, 0xdb, 0xcd, 0xcb, 0xbb, 0xac, 0xaa, 0xa9, 0x99, 0x88,
+0x89, 0x18, 0x12, 0x21, 0x54, 0x43, 0x43, 0x43, 0x33, 0x33, 0x22, 0x34, 0x43, 0x33, 0x43, 0x34,
+0x03, 0x08, 0x80, 0xee, 0xcb, 0xcb, 0xbc, 0xab, 0xab, 0xba, 0x9a, 0x18, 0x11, 0x52, 0x34, 0x22,
+0x34, 0x34, 0x12, 0x02, 0x80, 0x9a, 0x18, 0x11, 0x43, 0x02, 0x51, 0x34, 0x63, 0x45, 0x23, 0x11,
+0x91, 0xdb, 0xcb, 0xeb, 0xbb, 0xad, 0x9b, 0x9a, 0x09, 0x11, 0x11, 0x41, 0x33, 0x44, 0x24, 0x22,
+0x80, 0x18, 0x11, 0x00, 0x80, 0xca, 0xbd, 0xbb, 0x19, 0x24, 0x21, 0x56, 0x24, 0x42, 0x22, 0xa0,
+0xcc, 0xdb, 0xac, 0xbb, 0x99, 0xa9, 0x8a, 0x11, 0xca, 0x9b, 0x10, 0x20, 0x74, 0x37, 0x34, 0x33,
+0x35, 0x24, 0x80, 0x98, 0xca, 0xcc, 0xba, 0xbb, 0xba, 0x8a, 0x88, 0x00, 0x10, 0x80, 0x99, 0x9b,
+0xa9, 0xdc, 0x0a, 0x32, 0x52, 0x56, 0x33, 0x22, 0x35, 0x22, 0x32, 0x35, 0x34, 0x33, 0x02, 0x90,
+0xdc, 0xcd, 0xcb, 0xbb, 0xab, 0xab, 0x99, 0x11, 0x23, 0x12, 0x80, 0x08, 0x80, 0x18, 0x57, 0x23,
+0x00, 0x11, 0x80, 0xa9, 0xdd, 0x9b, 0x08, 0x18, 0x75, 0x37, 0x33, 0x34, 0x24, 0x80, 0xb9, 0xdb,
+0xbd, 0xab, 0xba, 0xaa, 0x89, 0x00, 0x00, 0x20, 0x22, 0x98, 0x18, 0x23, 0x43, 0x45, 0x12, 0x01,
+0x80, 0xa8, 0x9b, 0x73, 0x26, 0x42, 0x37, 0x33, 0x33, 0x13, 0x88, 0xcb, 0xbe, 0xbc, 0xdb, 0xba,
+0x9a, 0xaa, 0x8a, 0x80, 0x18, 0x42, 0x34, 0x33, 0x34, 0x24, 0x02, 0x90, 0x18, 0x90, 0xbc, 0x09,
+0x80, 0x28, 0x44, 0x44, 0x36, 0x33, 0x43, 0x14, 0xa9, 0xac, 0xbc, 0xbe, 0xaa, 0xa9, 0xcb, 0x9a,
+0x98, 0xbb, 0x9c, 0x20, 0x22, 0x41, 0x57, 0x44, 0x42, 0x34, 0x23, 0x80, 0x88, 0xcb, 0xbd, 0xbb,
+0xbc, 0x99, 0x88, 0x08, 0x11, 0x81, 0x98, 0x98, 0xeb, 0xac, 0x8a, 0x80, 0x31, 0x47, 0x33, 0x33,
+0x34, 0x24, 0x10, 0x20, 0x43, 0x33, 0x43, 0x14, 0xb9, 0xae, 0xcb, 0xbd, 0xcb, 0xaa, 0xaa, 0x99,
+0x20, 0x11, 0x98, 0x10, 0x81, 0x29, 0x45, 0x23, 0x34, 0x02, 0x08, 0xa8, 0xbb, 0xdc, 0x9c, 0x51,
+0x44, 0x45, 0x25, 0x43, 0x32, 0x02, 0xa9, 0xda, 0xbd, 0xbc, 0xaa, 0xaa, 0x9a, 0x08, 0x00, 0x20,
+0x21, 0x12, 0x18, 0x11, 0x23, 0x62, 0x35, 0x13, 0x10, 0x10, 0x00, 0x18, 0x64, 0x34, 0x42, 0x45,
+0x33, 0x11, 0x11, 0xc9, 0xbe, 0xac, 0xba, 0xdb, 0xab, 0xba, 0xba, 0x0a, 0x41, 0x33, 0x44, 0x34,
+0x24, 0x21, 0x21, 0x90, 0xcb, 0x9a, 0x9a, 0x8a, 0x80, 0xa9, 0x18, 0x64, 0x35, 0x24, 0x22, 0x22,
+0x91, 0xeb, 0xba, 0xcb, 0xcc, 0xab, 0x99, 0xb9, 0xab, 0xdc, 0xbd, 0x8b, 0x08, 0x42, 0x24, 0x33,
+0x66, 0x45, 0x34, 0x12, 0x80, 0xa9, 0xbc, 0xcb, 0xcb, 0xba, 0x9b, 0x08, 0x12, 0x01, 0x10, 0xb9,
+0xbc, 0x99, 0xbb, 0x1a, 0x67, 0x33, 0x44, 0x32, 0x12, 0x32, 0x01, 0xa9, 0x09, 0x88, 0x99, 0x9a,
+0x88, 0xdc, 0xcc, 0xba, 0xdc, 0xbc, 0x8b, 0x89, 0x9a, 0x08, 0x01, 0x21, 0x44, 0x32, 0x43, 0x43,
+0x33, 0x44, 0x23, 0xa1, 0xab, 0xdb, 0xbf, 0xab, 0x88, 0xa9, 0x1a, 0x45, 0x44, 0x44, 0x32, 0x02,
+0x01, 0x88, 0xb9, 0xbd, 0xbd, 0xbb, 0x8a, 0xa8, 0xca, 0x99, 0x98, 0x99, 0x99, 0x98, 0x08, 0x73,
+0x27, 0x23, 0x33, 0x02, 0x88, 0xa0, 0xbd, 0x09, 0x11, 0x73, 0x37, 0x13, 0x11, 0x34, 0x81, 0xbc,
+0xba, 0xed, 0xbb, 0x99, 0xbb, 0x8b, 0x00, 0xaa, 0x19, 0x32, 0x22, 0x66, 0x35, 0x33, 0x32, 0x25,
+0x01, 0x81, 0xa8, 0xbd, 0xbb, 0xbc, 0x9a, 0x88, 0x99, 0x20, 0x22, 0x00, 0x23, 0xd8, 0xcc, 0x89,
+0x98, 0xcc, 0xad, 0xab, 0xbb, 0x9a, 0x11, 0xa9, 0x2a, 0x77, 0x32, 0x73, 0x46, 0x22, 0x22, 0x12,
+0x90, 0x99, 0xb9, 0xcf, 0xbb, 0xba, 0xbb, 0x88, 0x88, 0xaa, 0x18, 0x91, 0xdb, 0xab, 0x99, 0x08,
+0x53, 0x35, 0x35, 0x24, 0x21, 0x31, 0x53, 0x42, 0x45, 0x24, 0x12, 0x32, 0x13, 0xc9, 0xbc, 0xec,
+0xcb, 0xaa, 0xb9, 0x9a, 0x08, 0x00, 0x00, 0x10, 0x80, 0x99, 0x89, 0x20, 0x32, 0x46, 0x35, 0x43,
+0x33, 0x33, 0x32, 0x22, 0x64, 0x34, 0x24, 0x33, 0x24, 0xa8, 0xaa, 0xfb, 0xcc, 0xcb, 0xbb, 0xbb,
+0x9a, 0x09, 0x08, 0x10, 0x22, 0x22, 0x43, 0x23, 0x32, 0x45, 0x23, 0x31, 0x25, 0x01, 0x28, 0x33,
+0x01, 0x52, 0x24, 0x33, 0x45, 0x53, 0x33, 0xa0, 0xcb, 0xdd, 0xac, 0xaa, 0xcb, 0xab, 0x99, 0x08,
+0x22, 0x34, 0x22, 0x12, 0x32, 0x13, 0xb9, 0x8c, 0x80, 0x9a, 0x73, 0x04, 0x00, 0x08, 0x88, 0x41,
+0x44, 0x34, 0x54, 0x53, 0x22, 0x02, 0xa0, 0xdc, 0xbb, 0xbc, 0xbc, 0xba, 0xab, 0x98, 0xba, 0x9a,
+0xbb, 0x1c, 0x53, 0x42, 0x67, 0x24, 0x31, 0x33, 0x03, 0x80, 0x98, 0xeb, 0xbb, 0xac, 0xa9, 0x9a,
+0x09, 0xb9, 0xac, 0x89, 0xd9, 0xab, 0x11, 0xa0, 0x28, 0x25, 0x98, 0x40, 0x22, 0x11, 0x92, 0x8a,
+0x76, 0x34, 0x45, 0x33, 0x34, 0x33, 0x12, 0x88, 0xdc, 0xcb, 0xbb, 0xbb, 0xaa, 0x9b, 0x08, 0xb8,
+0xab, 0xda, 0xbd, 0x9a, 0xa9, 0x8a, 0x81, 0xbb, 0x9b, 0xdb, 0x9b, 0x42, 0x24, 0x73, 0x57, 0x43,
+0x54, 0x24, 0x12, 0x11, 0x00, 0xca, 0xbb, 0xbc, 0xbd, 0xba, 0xa9, 0x89, 0x09, 0x08, 0x99, 0x8a,
+0x89, 0xbb, 0x19, 0x44, 0x43, 0x53, 0x33, 0x43, 0x32, 0x34, 0x23, 0x31, 0x65, 0x43, 0x43, 0x23,
+0x02, 0x88, 0x98, 0xdd, 0xcc, 0xba, 0xbc, 0x9b, 0x89, 0xb9, 0x89, 0x21, 0x01, 0x22, 0x34, 0x02,
+0x20, 0x35, 0x03, 0x30, 0x27, 0x98, 0x09, 0x22, 0x18, 0x74, 0x33, 0x22, 0x55, 0x23, 0x11, 0x21,
+0xb0, 0xdf, 0xaa, 0xb9, 0xad, 0x8a, 0xa9, 0x9b, 0x11, 0x12, 0x00, 0x53, 0x23, 0x01, 0x62, 0x13,
+0xa9, 0x21, 0xa1, 0x9d, 0x00, 0x90, 0xca, 0x29, 0x47, 0x12, 0x53, 0x24, 0x01, 0x11, 0xa0, 0xbc,
+0xcb, 0xcc, 0xac, 0xa9, 0xba, 0x9a, 0x90, 0xfb, 0xbb, 0xbb, 0x8a, 0x41, 0x54, 0x34, 0x45, 0x54,
+0x33, 0x13, 0x01, 0x99, 0xcc, 0xbb, 0xbc, 0xbb, 0x9a, 0x89, 0x18, 0x01, 0x99, 0xbb, 0xcd, 0xbb,
+0xb9, 0x09, 0x55, 0x43, 0x42, 0x33, 0x24, 0x32, 0x22, 0x22, 0x11, 0x33, 0x34, 0x11, 0x80, 0xfa,
+0xdc, 0xcb, 0xbc, 0xab, 0xab, 0x8a, 0x00, 0x10, 0x33, 0x92, 0xa9, 0x98, 0xbc, 0x51, 0x25, 0x43,
+0x44, 0x12, 0x01, 0xa9, 0xdd, 0x9a, 0x98, 0x99, 0x20, 0x37, 0x44, 0x34, 0x25, 0x12, 0x00, 0x98,
+0xeb, 0xbb, 0xba, 0xbb, 0x9a, 0x90, 0xbb, 0x9c, 0x99, 0xcc, 0xab, 0x99, 0x89, 0x73, 0x43, 0x22,
+0x24, 0x12, 0x20, 0x22, 0x21, 0x64, 0x34, 0x43, 0x34, 0x12, 0x10, 0x88, 0xca, 0xce, 0xbb, 0xcb,
+0xcb, 0x9a, 0x99, 0xab, 0x89, 0x10, 0x88, 0x40, 0x44, 0x12, 0x54, 0x23, 0x11, 0x21, 0x00, 0x08,
+0x10, 0x22, 0x81, 0x51, 0x34, 0x31, 0x54, 0x91, 0xcb, 0xaa, 0xdc, 0xbc, 0xab, 0xcb, 0xbb, 0x9a,
+0xa0, 0xca, 0xba, 0xeb, 0x9b, 0x40, 0x34, 0x43, 0x34, 0x42, 0x57, 0x25, 0x13, 0x02, 0x98, 0xaa,
+0xcb, 0xbc, 0xad, 0xaa, 0x9a, 0x08, 0x81, 0x98, 0x98, 0xca, 0xba, 0x9a, 0x19, 0x64, 0x34, 0x35,
+0x32, 0x43, 0x22, 0x11, 0x00, 0x80, 0x89, 0x20, 0x33, 0x21, 0x01, 0xfb, 0xcf, 0xbb, 0xcb, 0xbb,
+0xbb, 0x99, 0x99, 0x28, 0x33, 0x80, 0x28, 0x82, 0x29, 0x67, 0x22, 0x31, 0x33, 0x13, 0x80, 0xdb,
+0xbc, 0x8a, 0x00, 0x31, 0x74, 0x45, 0x44, 0x43, 0x22, 0x11, 0x88, 0xda, 0xbc, 0xac, 0xbc, 0x9b,
+0x99, 0xa9, 0x8a, 0x10, 0x88, 0x11, 0x23, 0x22, 0x43, 0x32, 0x46, 0x23, 0x12, 0x11, 0xa8, 0x0a,
+0x45, 0x53, 0x55, 0x33, 0x43, 0x24, 0x12, 0x88, 0xdb, 0xcc, 0xba, 0xbd, 0xaa, 0xaa, 0xab, 0x9a,
+0x89, 0x08, 0x00, 0x41, 0x36, 0x34, 0x44, 0x34, 0x13, 0x02, 0x01, 0x80, 0xb9, 0xab, 0xba, 0xab,
+0x30, 0x14, 0x99, 0x20, 0xf0, 0xbd, 0x99, 0xfb, 0xbb, 0x9a, 0xaa, 0xbd, 0xab, 0xaa, 0xcc, 0xab,
+0x98, 0x38, 0x37, 0x43, 0x45, 0x33, 0x35, 0x35, 0x34, 0x32, 0x21, 0x01, 0xc8, 0xdc, 0xbb, 0xbd,
+0xac, 0xa9, 0x99, 0x99, 0x80, 0x88, 0x89, 0xa9, 0x8a, 0x20, 0x43, 0x54, 0x34, 0x53, 0x34, 0x33,
+0x34, 0x24, 0x33, 0x24, 0x01, 0x80, 0xb9, 0xcd, 0xbb, 0xbd, 0xbd, 0xba, 0xba, 0xaa, 0x89, 0x80,
+0x88, 0x88, 0x90, 0x89, 0x42, 0x35, 0x52, 0x45, 0x24, 0x22, 0x43, 0x12, 0x80, 0x00, 0x99, 0xab,
+0x09, 0xb8, 0xae, 0x30, 0x81, 0x2a, 0x57, 0x81, 0x9a, 0xa8, 0xcf, 0xaa, 0xa8, 0xcb, 0x8a, 0x08,
+0x80, 0x08, 0x11, 0x88, 0x8a, 0x30, 0x56, 0x34, 0x43, 0x24, 0x13, 0x22, 0x03, 0x88, 0x18, 0x21,
+0x55, 0x23, 0x01, 0x90, 0xcd, 0xbc, 0xcd, 0xac, 0xab, 0xab, 0x99, 0x00, 0x08, 0x08, 0x99, 0x09,
+0x81, 0x39, 0x77, 0x27, 0x41, 0x33, 0x11, 0x12, 0x01, 0x99, 0xa9, 0xdb, 0xbb, 0x9a, 0x99, 0xcc,
+0x8b, 0xc9, 0xbe, 0xa9, 0xda, 0x9b, 0x98, 0x99, 0x09, 0x01, 0xba, 0x2a, 0x37, 0x12, 0x74, 0x35,
+0x34, 0x34, 0x35, 0x22, 0x00, 0x80, 0xbb, 0xbd, 0xcc, 0xbb, 0xbb, 0xaa, 0x99, 0x00, 0xa9, 0xa9,
+0xaa, 0xa9, 0xbb, 0x8a, 0x32, 0x45, 0x34, 0x24, 0x43, 0x11, 0x11, 0xa9, 0x71, 0x47, 0x53, 0x35,
+0x24, 0x21, 0x11, 0xa8, 0xba, 0xcc, 0xbd, 0xbb, 0xbb, 0xaa, 0x99, 0x09, 0x99, 0x99, 0xa8, 0xac,
+0x0a, 0x99, 0x40, 0x45, 0x43, 0x43, 0x35, 0x23, 0x01, 0x43, 0x34, 0x63, 0x43, 0x13, 0x12, 0x82,
+0xb8, 0xdc, 0xbc, 0xcc, 0xbb, 0xbb, 0xaa, 0x99, 0xa8, 0x89, 0x10, 0x21, 0x32, 0x33, 0x32, 0x54,
+0x35, 0x32, 0x33, 0x24, 0x11, 0x22, 0x23, 0x33, 0x55, 0x54, 0x33, 0x53, 0x23, 0x02, 0x81, 0xfa,
+0xbd, 0xba, 0xbd, 0xab, 0xaa, 0xbb, 0x89, 0x11, 0x11, 0x42, 0x33, 0x02, 0x51, 0x25, 0x80, 0x20,
+0x34, 0x21, 0x32, 0x25, 0x82, 0x89, 0x52, 0x22, 0x63, 0x24, 0x11, 0x42, 0x91, 0xbd, 0xca, 0xdd,
+0xac, 0x9a, 0xb9, 0xaa, 0x88, 0xa8, 0x9a, 0x00, 0x80, 0x71, 0x27, 0x23, 0x35, 0x25, 0x23, 0x32,
+0x01, 0x89, 0xaa, 0xdb, 0xbb, 0xbd, 0xbb, 0xaa, 0xaa, 0xca, 0xbb, 0xbb, 0xcc, 0x8a, 0x10, 0x98,
+0x41, 0x23, 0x99, 0x51, 0x81, 0x8a, 0x65, 0x33, 0x53, 0x45, 0x25, 0x33, 0x35, 0x23, 0x80, 0xb9,
+0xbd, 0xcc, 0xbb, 0xbb, 0xbb, 0x8a, 0x20, 0x81, 0x08, 0xb9, 0xbd, 0x9b, 0xa9, 0x9b, 0x20, 0x24,
+0x44, 0x24, 0x01, 0x20, 0x23, 0x11, 0x74, 0x47, 0x44, 0x44, 0x24, 0x01, 0x00, 0xa8, 0xcb, 0xcc,
+0xbb, 0xac, 0x9a, 0x89, 0x88, 0x80, 0x00, 0x88, 0x89, 0x89, 0x08, 0x32, 0x55, 0x43, 0x43, 0x32,
+0x34, 0x32, 0x11, 0x21, 0x42, 0x46, 0x24, 0x22, 0x01, 0x90, 0xca, 0xcc, 0xcd, 0xbb, 0xbb, 0xab,
+0x8a, 0x89, 0x80, 0x18, 0x32, 0x12, 0x53, 0x24, 0x00, 0x62, 0x33, 0x22, 0x34, 0x12, 0x88, 0x10,
+0x20, 0x53, 0x34, 0x34, 0x25, 0x13, 0x01, 0x11, 0xe9, 0xcf, 0xba, 0xbb, 0xbc, 0xbb, 0x9a, 0xaa,
+0x19, 0x53, 0x32, 0x42, 0x54, 0x23, 0x23, 0x32, 0x02, 0x88, 0x28, 0x91, 0xcc, 0x09, 0xba, 0x8b,
+0x81, 0xdb, 0x8a, 0x11, 0x23, 0xf9, 0x8b, 0xa0, 0xdf, 0x8b, 0x98, 0xca, 0x09, 0x11, 0x00, 0x08,
+0xa8, 0xaa, 0xbb, 0x8b, 0x73, 0x73, 0x54, 0x34, 0x35, 0x34, 0x32, 0x11, 0x80, 0xc9, 0xbc, 0xca,
+0xbc, 0xac, 0xaa, 0xaa, 0x08, 0x90, 0x89, 0x12, 0xb8, 0x8a, 0xb0, 0xcf, 0x8a, 0xa8, 0xba, 0x18,
+0x21, 0x31, 0x74, 0x24, 0x33, 0x77, 0x53, 0x53, 0x33, 0x12, 0x00, 0xa8, 0xeb, 0xcb, 0xcb, 0xcb,
+0x9a, 0x89, 0x88, 0x08, 0x00, 0x89, 0x89, 0x08, 0x08, 0x41, 0x45, 0x33, 0x34, 0x24, 0x12, 0x01,
+0x00, 0x98, 0x48, 0x56, 0x43, 0x34, 0x22, 0x80, 0x99, 0xdb, 0xcc, 0xbc, 0xbb, 0xaa, 0xa9, 0x89,
+0xa9, 0xba, 0x09, 0xa0, 0x9a, 0x53, 0x24, 0x63, 0x35, 0x23, 0x22, 0x12, 0x80, 0x20, 0x34, 0x33,
+0x46, 0x24, 0x31, 0x44, 0x01, 0x88, 0xa9, 0xbf, 0xbc, 0xbb, 0xad, 0xab, 0xab, 0x99, 0xaa, 0x00,
+0x11, 0x11, 0x54, 0x24, 0x43, 0x33, 0x33, 0x11, 0x32, 0x22, 0x98, 0x8a, 0x21, 0x21, 0x66, 0x44,
+0x22, 0x33, 0x82, 0xa9, 0xcb, 0xcd, 0xbd, 0xbc, 0xbc, 0xab, 0xbb, 0x9a, 0x8a, 0x08, 0x10, 0x44,
+0x35, 0x35, 0x25, 0x23, 0x42, 0x33, 0x02, 0x80, 0xa9, 0xbd, 0xba, 0xca, 0xbb, 0xab, 0x9b, 0x00,
+0xa8, 0x1a, 0x13, 0xfb, 0xab, 0x00, 0xaa, 0x1a, 0x82, 0xed, 0x9a, 0xa9, 0x9a, 0xcb, 0xcd, 0x9a,
+0x28, 0x55, 0x24, 0x22, 0x34, 0x53, 0x55, 0x45, 0x22, 0x11, 0x00, 0xa8, 0xcc, 0xbc, 0xcc, 0xab,
+0x9a, 0x88, 0x08, 0x01, 0x00, 0x88, 0xa8, 0xbb, 0x09, 0x41, 0x55, 0x54, 0x23, 0x33, 0x33, 0x12,
+0x21, 0x33, 0x13, 0x00, 0x08, 0x11, 0xfa, 0xcc, 0xeb, 0xbd, 0xab, 0x99, 0x9a, 0x89, 0x88, 0x9a,
+0x08, 0x01, 0xbb, 0x0b, 0x53, 0x54, 0x44, 0x23, 0x12, 0x01, 0x81, 0xaa, 0x18, 0x33, 0x32, 0x77,
+0x25, 0x33, 0x53, 0x12, 0x98, 0x99, 0xdb, 0xbc, 0xac, 0xcb, 0xbb, 0x9a, 0xa9, 0x8a, 0x00, 0x00,
+0x20, 0x44, 0x12, 0x00, 0x42, 0x02, 0x8a, 0x63, 0x82, 0x20, 0x34, 0x80, 0x61, 0x55, 0x43, 0x32,
+0x52, 0x23, 0x11, 0x11, 0xd9, 0xcc, 0xcb, 0xbc, 0xab, 0xbb, 0xba, 0x9a, 0x18, 0x12, 0x32, 0x45,
+0x12, 0x42, 0x33, 0x81, 0x88, 0x11, 0x01, 0x18, 0x43, 0x02, 0x88, 0x28, 0x76, 0x44, 0x22, 0x32,
+0x22, 0x42, 0x25, 0xb8, 0xbd, 0xdc, 0xcb, 0xaa, 0xba, 0xca, 0xba, 0x09, 0x12, 0x21, 0x63, 0x22,
+0x43, 0x34, 0x13, 0x33, 0x23, 0x21, 0x32, 0x82, 0xbd, 0x8b, 0xca, 0xae, 0x09, 0x98, 0x99, 0x18,
+0x52, 0x82, 0xa9, 0xec, 0xbe, 0x9c, 0xaa, 0xaa, 0x99, 0x99, 0x99, 0x10, 0x03, 0xd9, 0x9b, 0x00,
+0x71, 0x57, 0x33, 0x43, 0x54, 0x54, 0x32, 0x12, 0x00, 0xba, 0xdb, 0xdb, 0xcb, 0xbb, 0xab, 0x89,
+0x88, 0x88, 0x80, 0x99, 0x09, 0x99, 0x89, 0x64, 0x35, 0x33, 0x45, 0x33, 0x33, 0x43, 0x11, 0x10,
+0x11, 0x11, 0x12, 0xb8, 0xcc, 0xcc, 0xcc, 0xcb, 0xdb, 0xcb, 0x9a, 0x89, 0x00, 0x01, 0x18, 0x53,
+0x22, 0x22, 0x11, 0x01, 0x32, 0x44, 0x34, 0x32, 0x23, 0x90, 0xab, 0xea, 0xcd, 0xa9, 0xba, 0xab,
+0x89, 0x18, 0x45, 0x36, 0x44, 0x12, 0x21, 0x80, 0x99, 0xaa, 0xbb, 0xbc, 0xbd, 0x8a, 0xa9, 0xbd,
+0xab, 0xcc, 0xbb, 0xba, 0x9c, 0x28, 0x52, 0x34, 0x34, 0x34, 0x12, 0x12, 0x33, 0x34, 0x32, 0x42,
+0x44, 0x32, 0x32, 0x91, 0xcd, 0xcc, 0xbc, 0xaa, 0xcb, 0xbb, 0x9a, 0x89, 0x89, 0x88, 0x98, 0x28,
+0x45, 0x45, 0x33, 0x22, 0x01, 0x22, 0x12, 0x80, 0x41, 0x03, 0x88, 0x73, 0x25, 0x23, 0x12, 0xa0,
+0xdd, 0xac, 0xb9, 0xdd, 0xaa, 0xa9, 0x9a, 0x18, 0x81, 0x18, 0x22, 0x00, 0x89, 0xeb, 0xab, 0x58,
+0x46, 0x22, 0x44, 0x22, 0x31, 0x46, 0x34, 0x23, 0x02, 0xa8, 0xca, 0xbd, 0xbd, 0xcb, 0xbb, 0xab,
+0x88, 0x88, 0x00, 0x10, 0x00, 0x11, 0x21, 0x00, 0x10, 0x44, 0x43, 0x53, 0x23, 0x21, 0x45, 0x11,
+0x73, 0x35, 0x33, 0x46, 0x22, 0x11, 0x00, 0xa9, 0xbc, 0xcd, 0xcc, 0xba, 0xab, 0x9b, 0x89, 0x99,
+0x08, 0x10, 0x11, 0x32, 0x44, 0x23, 0x43, 0x35, 0x22, 0x33, 0x36, 0x22, 0x42, 0x24, 0x12, 0x52,
+0x33, 0x91, 0x88, 0xc8, 0xdd, 0xba, 0xcc, 0xbc, 0xaa, 0xaa, 0xaa, 0x99, 0x98, 0x18, 0x53, 0x33,
+0x43, 0x53, 0x22, 0x32, 0x35, 0x03, 0x10, 0x88, 0xbb, 0x8a, 0x91, 0x08, 0x42, 0x44, 0x56, 0x34,
+0x12, 0x10, 0xa0, 0xdd, 0xac, 0xa9, 0xcc, 0xaa, 0x88, 0x09, 0x10, 0x12, 0x88, 0x41, 0x23, 0x10,
+0x43, 0x91, 0x9a, 0x42, 0x13, 0x88, 0x31, 0xa1, 0xab, 0x40, 0x67, 0x44, 0x22, 0x53, 0x22, 0x80,
+0x00, 0xda, 0xcd, 0xbb, 0xbc, 0xaa, 0xa9, 0xaa, 0x08, 0x10, 0x31, 0x36, 0x32, 0x45, 0x23, 0x21,
+0x33, 0x13, 0x81, 0xb9, 0x8a, 0xd8, 0xae, 0x19, 0xb9, 0x9c, 0x20, 0x81, 0x28, 0x43, 0x91, 0xaa,
+0x90, 0xdf, 0xab, 0xba, 0xaf, 0x8a, 0x98, 0xba, 0xab, 0xca, 0xbf, 0x8b, 0x80, 0x9a, 0x74, 0x43,
+0x31, 0x55, 0x54, 0x53, 0x22, 0x01, 0x80, 0xc9, 0xbb, 0xcc, 0xcb, 0xaa, 0x99, 0x09, 0x08, 0x88,
+0x98, 0xaa, 0xac, 0x9a, 0x08, 0x52, 0x45, 0x34, 0x33, 0x24, 0x02, 0x21, 0x32, 0x43, 0x46, 0x23,
+0x11, 0x10, 0x98, 0xdb, 0xce, 0xac, 0xbb, 0xac, 0x89, 0x88, 0x80, 0x11, 0x12, 0x01, 0x11, 0x80,
+0x09, 0x44, 0x44, 0x43, 0x33, 0x33, 0x11, 0x00, 0xb9, 0xbe, 0x9a, 0x89, 0x20, 0x11, 0x71, 0x45,
+0x22, 0x22, 0x91, 0xba, 0xea, 0xbc, 0xac, 0xcb, 0x9a, 0x98, 0x88, 0x08, 0xa9, 0x9b, 0x08, 0xb8,
+0xcd, 0x0b, 0x63, 0x34, 0x44, 0x33, 0x23, 0x13, 0x01, 0x32, 0x82, 0x40, 0x46, 0x12, 0x31, 0x03,
+0xda, 0xcd, 0xbb, 0xcb, 0xcb, 0x9a, 0xda, 0x9c, 0x19, 0x80, 0x18, 0x33, 0x12, 0x53, 0x35, 0x14,
+0x01, 0x21, 0x91, 0x99, 0xa9, 0x09, 0x32, 0x98, 0x71, 0x24, 0x20, 0x12, 0xda, 0x9a, 0xdb, 0xbd,
+0xab, 0xdc, 0x9b, 0x09, 0x90, 0x89, 0x42, 0x03, 0x20, 0x44, 0x91, 0xdc, 0x0a, 0x31, 0x33, 0x45,
+0x02, 0x11, 0x74, 0x44, 0x34, 0x12, 0x90, 0x99, 0xba, 0xce, 0xcb, 0xbb, 0xba, 0x89, 0x80, 0x10,
+0x80, 0x89, 0x08, 0xb9, 0xbb, 0x29, 0x43, 0x35, 0x36, 0x33, 0x32, 0x55, 0x22, 0x42, 0x45, 0x33,
+0x44, 0x24, 0x02, 0x88, 0xb8, 0xdc, 0xab, 0xba, 0xbd, 0xba, 0xba, 0xbb, 0xaa, 0xba, 0xba, 0xac,
+0x8a, 0x18, 0x64, 0x43, 0x23, 0x33, 0x33, 0x44, 0x23, 0x53, 0x45, 0x43, 0x43, 0x33, 0x23, 0x02,
+0xa8, 0xdb, 0xbd, 0xbd, 0xbc, 0xcb, 0xaa, 0x9a, 0x88, 0x88, 0x09, 0x30, 0x42, 0x22, 0x12, 0x22,
+0x42, 0x44, 0x33, 0x22, 0x34, 0x01, 0x99, 0xaa, 0x8a, 0x21, 0x45, 0x35, 0x63, 0x46, 0x23, 0x12,
+0x81, 0xcc, 0xbb, 0xbc, 0xbc, 0xcb, 0xaa, 0x99, 0x00, 0x01, 0x80, 0x00, 0x11, 0x21, 0x01, 0xaa,
+0x3a, 0x67, 0x33, 0x33, 0x12, 0x80, 0x80, 0x10, 0x73, 0x44, 0x35, 0x34, 0x22, 0x33, 0x01, 0xbb,
+0xcd, 0xdd, 0xac, 0xaa, 0xaa, 0x9a, 0x88, 0x01, 0x31, 0x43, 0x34, 0x02, 0x10, 0x23, 0x01, 0x54,
+0x92, 0xab, 0x21, 0xb8, 0x8a, 0x80, 0xbb, 0xbc, 0x59, 0x47, 0x11, 0x41, 0x33, 0x12, 0x10, 0x90,
+0xfc, 0xad, 0xaa, 0xdb, 0x8a, 0x99, 0x9a, 0x00, 0xa8, 0x19, 0x13, 0xa9, 0x9a, 0x71, 0x45, 0x53,
+0x34, 0x34, 0x34, 0x36, 0x13, 0x80, 0x98, 0xc9, 0xbc, 0xba, 0xcd, 0xac, 0x89, 0xa9, 0x89, 0x89,
+0x9a, 0x99, 0x88, 0x99, 0x10, 0x11, 0x41, 0x47, 0x43, 0x53, 0x53, 0x33, 0x33, 0x24, 0x23, 0x32,
+0x33, 0xc0, 0xbc, 0xeb, 0xcc, 0xba, 0xbc, 0xac, 0x99, 0x08, 0x20, 0x33, 0x12, 0x00, 0x01, 0xa8,
+0x9a, 0x00, 0x88, 0x71, 0x34, 0x02, 0xa8, 0x99, 0xd9, 0xbd, 0x19, 0x23, 0x52, 0x57, 0x53, 0x53,
+0x23, 0x02, 0x80, 0xca, 0xcb, 0xbc, 0xcb, 0xab, 0x9a, 0x89, 0x88, 0x01, 0x08, 0x10, 0x22, 0x10,
+0x11, 0x32, 0x25, 0x12, 0x44, 0x11, 0x11, 0x23, 0x31, 0x43, 0x62, 0x57, 0x33, 0x44, 0x24, 0x11,
+0x11, 0x90, 0xcb, 0xcd, 0xbc, 0xbc, 0xab, 0x9b, 0xaa, 0x89, 0x00, 0x31, 0x35, 0x44, 0x33, 0x12,
+0x21, 0x81, 0x99, 0x08, 0x89, 0x31, 0x34, 0x45, 0x33, 0x33, 0x14, 0x81, 0x80, 0xb9, 0x88, 0xe9,
+0xbc, 0xa9, 0xcd, 0xbc, 0xbd, 0xac, 0xbb, 0xac, 0xa9, 0x08, 0x33, 0x12, 0x42, 0x53, 0x34, 0x24,
+0x43, 0x35, 0x24, 0x24, 0x02, 0x11, 0x12, 0x98, 0xb9, 0xde, 0xcb, 0xba, 0xcb, 0xab, 0xbb, 0xab,
+0x89, 0x88, 0x00, 0x98, 0x41, 0x16, 0x00, 0x42, 0xa1, 0x9c, 0x52, 0x23, 0x52, 0x45, 0x33, 0x33,
+0x46, 0x23, 0x22, 0x13, 0xb8, 0xbd, 0xcc, 0xac, 0xbb, 0xbc, 0xbb, 0x9b, 0x10, 0x11, 0x32, 0x14,
+0x98, 0x18, 0x90, 0x9a, 0x08, 0x32, 0x43, 0x33, 0x12, 0x9a, 0x52, 0x25, 0x33, 0x24, 0x53, 0x77,
+0x37, 0x32, 0x22, 0x13, 0xa8, 0x99, 0xd9, 0xce, 0xbb, 0xbb, 0xab, 0x89, 0x98, 0x98, 0x31, 0x24,
+0x11, 0x00, 0xb8, 0xab, 0x1a, 0x33, 0x12, 0x73, 0x33, 0x55, 0x36, 0x22, 0x31, 0x24, 0x32, 0x46,
+0x24, 0x11, 0x01, 0x98, 0xdb, 0xdb, 0xdb, 0xdb, 0xab, 0x9a, 0x99, 0x88, 0x01, 0x21, 0x33, 0x35,
+0x22, 0x12, 0x10, 0x11, 0x11, 0x21, 0x21, 0x43, 0x45, 0x12, 0x21, 0x21, 0x90, 0x19, 0x24, 0x80,
+0x73, 0x27, 0x13, 0x32, 0x82, 0xed, 0xbc, 0xdb, 0xbb, 0xab, 0xa9, 0x9a, 0x18, 0x42, 0x44, 0x34,
+0x23, 0x02, 0x11, 0x00, 0xa9, 0xcb, 0xbb, 0xaa, 0x08, 0x80, 0x99, 0x74, 0x03, 0x88, 0x08, 0x00,
+0x63, 0x63, 0x45, 0x22, 0x11, 0x34, 0xa0, 0xbc, 0xcd, 0xbc, 0xac, 0xab, 0x9b, 0x8a, 0x31, 0x34,
+0x33, 0x44, 0x23, 0x32, 0x34, 0x12, 0x11, 0x21, 0x11, 0x80, 0x88, 0xd9, 0xbd, 0xbc, 0xcc, 0xab,
+0x10, 0xb9, 0x49, 0x14, 0xca, 0x0a, 0x80, 0xdc, 0xba, 0xca, 0xbb, 0x0a, 0x42, 0x24, 0x10, 0x42,
+0x15, 0x98, 0x10, 0xa0, 0x9b, 0x22, 0x53, 0x46, 0x34, 0x64, 0x44, 0x23, 0x22, 0x80, 0xa9, 0x8a,
+0x80, 0xfd, 0xdb, 0xba, 0xbb, 0x9a, 0xba, 0xab, 0x8a, 0x18, 0x20, 0x53, 0x34, 0x43, 0x33, 0x33,
+0x44, 0x23, 0x32, 0x44, 0x23, 0x31, 0x65, 0x43, 0x33, 0x22, 0x82, 0xb9, 0xcd, 0xbc, 0xbe, 0xcb,
+0xba, 0xbb, 0x9a, 0x98, 0x89, 0x20, 0x33, 0x23, 0x45, 0x24, 0x42, 0x34, 0x34, 0x42, 0x12, 0x01,
+0x81, 0xb9, 0xab, 0xdb, 0xbb, 0x99, 0x08, 0x43, 0x34, 0x33, 0xb2, 0xcf, 0xbc, 0xac, 0xbb, 0xca,
+0xab, 0x8a, 0x10, 0x33, 0x34, 0x35, 0x24, 0x43, 0x23, 0x23, 0x22, 0x32, 0x22, 0xa8, 0xbc, 0xcd,
+0xbc, 0xaa, 0xbb, 0x9b, 0x80, 0xb9, 0x1a, 0x56, 0x32, 0x21, 0x42, 0x43, 0x23, 0x91, 0xda, 0xce,
+0xbc, 0xab, 0xab, 0x99, 0x20, 0x63, 0x42, 0x42, 0x33, 0x22, 0x02, 0x80, 0x88, 0xb9, 0xab, 0x00,
+0x88, 0x01, 0xfa, 0xbb, 0xfb, 0xac, 0x08, 0x98, 0x20, 0x45, 0x24, 0x90, 0x9a, 0xb0, 0xef, 0x99,
+0x98, 0x9a, 0x21, 0x01, 0x31, 0x02, 0x08, 0x91, 0xbc, 0x19, 0xe8, 0xac, 0x40, 0x45, 0x34, 0x22,
+0x11, 0x73, 0x57, 0x12, 0x12, 0x02, 0x99, 0xb9, 0xdd, 0xdb, 0xbb, 0xbb, 0x9a, 0x99, 0x80, 0x00,
+0x20, 0x23, 0x81, 0x19, 0x65, 0x23, 0x44, 0x44, 0x12, 0x22, 0x21, 0x21, 0x22, 0x21, 0x22, 0x90,
+0x9b, 0xa9, 0xdf, 0xbc, 0xcd, 0xcb, 0xca, 0xaa, 0x9a, 0x99, 0x19, 0x53, 0x22, 0x32, 0x24, 0x12,
+0x12, 0x12, 0x32, 0x44, 0x35, 0x33, 0x01, 0x00, 0xb9, 0xdc, 0xbc, 0xbc, 0xac, 0x9b, 0xa9, 0x8a,
+0x72, 0x34, 0x34, 0x22, 0x01, 0x80, 0xaa, 0xbc, 0xcc, 0xbc, 0x9b, 0x09, 0x20, 0x21, 0x02, 0x32,
+0x46, 0x81, 0x88, 0x00, 0x08, 0x43, 0xb1, 0xac, 0xc9, 0xbb, 0x80, 0xcc, 0x29, 0x03, 0x49, 0x47,
+0x12, 0x32, 0x34, 0x43, 0x12, 0x01, 0xd9, 0xbd, 0xbb, 0xbe, 0xac, 0xa9, 0xaa, 0x09, 0x88, 0x10,
+0x52, 0x24, 0x43, 0x43, 0x33, 0x32, 0x35, 0x11, 0x10, 0x82, 0xcb, 0x9b, 0x80, 0xdc, 0x8c, 0x80,
+0xca, 0x09, 0xa1, 0xbc, 0x9a, 0xcb, 0x9c, 0xaa, 0x0a, 0x32, 0xea, 0x8b, 0x80, 0x09, 0x43, 0x81,
+0x40, 0x13, 0x08, 0x66, 0x23, 0x12, 0x32, 0x32, 0x24, 0x31, 0x77, 0x77, 0x03, 0x80, 0x98, 0xaa,
+0x09, 0xa0, 0xcf, 0xba, 0x9a, 0x89, 0x01, 0x00, 0x08, 0x18, 0x44, 0x82, 0xba, 0x18, 0x12, 0x41,
+0x25, 0x01, 0x41, 0x33, 0x81, 0x20, 0x34, 0x74, 0x45, 0x23, 0x22, 0x01, 0xb9, 0xcd, 0xcc, 0xcb,
+0xbb, 0xaa, 0xa9, 0x09, 0x31, 0x33, 0x22, 0x44, 0x14, 0x00, 0x11, 0x81, 0x18, 0x42, 0x33, 0x34,
+0x01, 0xaa, 0x8a, 0xc9, 0x9d, 0x20, 0x81, 0x29, 0x77, 0x24, 0x12, 0x00, 0xb9, 0xce, 0xba, 0xaa,
+0xad, 0x9a, 0x99, 0x09, 0x42, 0x32, 0x32, 0x35, 0x34, 0x22, 0x12, 0x00, 0x99, 0xa9, 0xcb, 0xac,
+0xbb, 0xbc, 0x9b, 0x9a, 0xdb, 0xbc, 0x19, 0x22, 0x88, 0x61, 0x45, 0x53, 0x45, 0x23, 0x11, 0x88,
+0x89, 0x89, 0xdb, 0xcc, 0xdb, 0x9a, 0x08, 0x80, 0x18, 0x22, 0x80, 0x21, 0x24, 0x80, 0xba, 0xbd,
+0xac, 0x99, 0x9a, 0x40, 0x23, 0xba, 0x38, 0x05, 0x19, 0x65, 0x02, 0x08, 0x42, 0x35, 0x45, 0x34,
+0x34, 0x81, 0x9a, 0xb8, 0xdd, 0xbb, 0xca, 0xbb, 0x9b, 0x88, 0x11, 0x10, 0x53, 0x35, 0x21, 0x21,
+0x02, 0x99, 0x99, 0xda, 0xab, 0x9a, 0x00, 0x80, 0xcb, 0x09, 0x01, 0xbc, 0x9b, 0x01, 0x10, 0x77,
+0x47, 0x22, 0x22, 0x23, 0xa8, 0x99, 0xc9, 0xbc, 0xbc, 0xcb, 0x9b, 0x09, 0x22, 0x02, 0xca, 0x9a,
+0x08, 0x73, 0x26, 0x02, 0x10, 0x12, 0xca, 0xba, 0xdc, 0x9d, 0x89, 0x00, 0x10, 0x12, 0x32, 0x35,
+0x12, 0x21, 0x13, 0xca, 0x29, 0x27, 0x12, 0x53, 0xa1, 0xcd, 0x9a, 0xaa, 0xbb, 0xcb, 0x9b, 0xa9,
+0x9a, 0x10, 0x98, 0x18, 0x91, 0x1a, 0x77, 0x14, 0x08, 0x40, 0x73, 0x34, 0x25, 0x01, 0x00, 0x33,
+0x36, 0x02, 0xeb, 0xcc, 0xba, 0x9a, 0xa9, 0xba, 0x9b, 0x18, 0x22, 0x12, 0xa9, 0xac, 0x9a, 0x20,
+0x44, 0x33, 0x64, 0x44, 0x12, 0x20, 0x53, 0x11, 0x53, 0x25, 0x11, 0x21, 0x01, 0xa8, 0xbd, 0xcd,
+0xcc, 0xab, 0xaa, 0xab, 0x8a, 0x18, 0x22, 0x44, 0x43, 0x23, 0x21, 0x10, 0x10, 0x01, 0x98, 0x20,
+0x02, 0x18, 0x33, 0xda, 0xac, 0xb9, 0xbb, 0xbc, 0x2a, 0x16, 0x19, 0x77, 0x17, 0x80, 0x90, 0xa9,
+0xab, 0x99, 0xca, 0xbc, 0xab, 0x08, 0x43, 0x34, 0x43, 0x33, 0x34, 0x24, 0x91, 0x98, 0xc9, 0xbd,
+0xac, 0xab, 0xaa, 0xaa, 0x9b, 0x99, 0xaa, 0x18, 0x22, 0x46, 0x33, 0x44, 0x55, 0x42, 0x53, 0x23,
+0x01, 0x80, 0xa9, 0xbc, 0xca, 0xdb, 0xbc, 0xaa, 0x88, 0x10, 0x10, 0x32, 0x12, 0x41, 0x34, 0x90,
+0xa9, 0xcb, 0xcb, 0xcb, 0x89, 0x00, 0x00, 0x53, 0x01, 0x08, 0x90, 0xac, 0x08, 0x80, 0x62, 0x33,
+0x73, 0x77, 0x32, 0x23, 0x02, 0xa8, 0xba, 0xba, 0xdd, 0xcc, 0xaa, 0x99, 0x18, 0x20, 0x01, 0x20,
+0x42, 0x33, 0x34, 0x91, 0xba, 0xaa, 0xcb, 0xab, 0x9a, 0x89, 0xa9, 0xac, 0x10, 0x81, 0x99, 0x22,
+0xf0, 0x9c, 0x73, 0x26, 0x32, 0x36, 0x43, 0x33, 0x22, 0x90, 0xcb, 0xbc, 0xcb, 0xbb, 0xbc, 0xba,
+0x9a, 0x20, 0x01, 0x28, 0x53, 0x12, 0x52, 0x02, 0xda, 0xdb, 0xbc, 0xab, 0xbb, 0xac, 0x11, 0x22,
+0x52, 0x34, 0x43, 0x45, 0x43, 0x22, 0x33, 0x43, 0x02, 0x80, 0x90, 0xcc, 0xcc, 0xac, 0xbb, 0xcc,
+0xaa, 0x99, 0x99, 0x80, 0x80, 0x21, 0x01, 0x09, 0x80, 0x38, 0x45, 0x41, 0x35, 0x82, 0x51, 0x44,
+0x62, 0x54, 0x22, 0x33, 0x12, 0x08, 0x88, 0xfb, 0xbc, 0xcc, 0xba, 0xaa, 0xaa, 0x99, 0x98, 0x18,
+0x11, 0x80, 0x10, 0x02, 0x08, 0x65, 0x34, 0x32, 0x53, 0x23, 0x11, 0x21, 0x33, 0x43, 0x46, 0x24,
+0x44, 0x23, 0x81, 0xb9, 0xce, 0xbb, 0xcc, 0xbb, 0xbb, 0x9b, 0x89, 0x10, 0x52, 0x23, 0x33, 0x34,
+0x23, 0x01, 0x11, 0x12, 0x08, 0x20, 0x02, 0x10, 0x24, 0x90, 0x19, 0x81, 0x89, 0xfb, 0x9f, 0x28,
+0x44, 0x33, 0x14, 0xca, 0xbd, 0xb9, 0xce, 0xbb, 0xba, 0xab, 0x18, 0x34, 0x35, 0x34, 0x53, 0x33,
+0x33, 0x34, 0x22, 0x00, 0xa8, 0xdd, 0xac, 0xbb, 0xcb, 0xcb, 0x9a, 0x09, 0x01, 0x80, 0x31, 0x24,
+0x88, 0x08, 0xd0, 0xac, 0x28, 0x81, 0x60, 0x46, 0x43, 0x53, 0x22, 0x11, 0x81, 0x98, 0x00, 0xca,
+0xbe, 0xba, 0xbb, 0x9c, 0xa9, 0xac, 0x99, 0x99, 0x0a, 0x21, 0x22, 0x22, 0x42, 0x45, 0x01, 0x30,
+0x25, 0x11, 0x22, 0x23, 0x42, 0x23, 0x90, 0x18, 0x53, 0x34, 0x24, 0x12, 0x99, 0x20, 0xf8, 0xaf,
+0xbb, 0xcd, 0xab, 0xba, 0xba, 0x9b, 0x09, 0x80, 0x20, 0x54, 0x11, 0x62, 0x35, 0x22, 0x11, 0x11,
+0x63, 0x43, 0x24, 0x14, 0x81, 0x00, 0x98, 0xa9, 0xba, 0xcf, 0xbc, 0xac, 0xab, 0x9a, 0x8a, 0x9a,
+0x09, 0x08, 0x28, 0x43, 0x32, 0x43, 0x33, 0x53, 0x32, 0x74, 0x33, 0x00, 0x80, 0xa9, 0x8a, 0xa0,
+0xac, 0x08, 0x10, 0x77, 0x24, 0x43, 0x11, 0xa0, 0xaa, 0xbb, 0x09, 0xb0, 0xcf, 0x8a, 0x11, 0x22,
+0x12, 0xfa, 0xbc, 0x9a, 0x88, 0x10, 0xc9, 0x9c, 0x10, 0xa0, 0x8c, 0x80, 0xca, 0x19, 0x92, 0xbc,
+0x30, 0x34, 0x55, 0x23, 0x12, 0x42, 0x57, 0x44, 0x22, 0x23, 0x00, 0x99, 0xb9, 0xbd, 0xbc, 0xcd,
+0xba, 0x9a, 0x99, 0x00, 0x10, 0x32, 0x44, 0x43, 0x22, 0x11, 0x01, 0xa9, 0xbd, 0xab, 0xb9, 0xad,
+0x18, 0x90, 0x40, 0x26, 0x81, 0x98, 0xdb, 0xab, 0x99, 0xca, 0xcc, 0x09, 0x53, 0x45, 0x34, 0x24,
+0x22, 0x11, 0x88, 0xa9, 0xdb, 0xbc, 0xbb, 0x9a, 0x80, 0x00, 0x88, 0x31, 0x47, 0x12, 0x00, 0x99,
+0xa9, 0xca, 0xdc, 0xcb, 0xbb, 0xab, 0x99, 0x08, 0x88, 0x32, 0x24, 0x43, 0xa2, 0xad, 0x41, 0x92,
+0x8b, 0x56, 0x34, 0x45, 0x44, 0x33, 0x12, 0x11, 0x98, 0xbc, 0xdb, 0xbc, 0xad, 0xab, 0x8a, 0x89,
+0x00, 0x33, 0x23, 0x32, 0x23, 0x02, 0xa9, 0xaa, 0x90, 0xfb, 0x9b, 0x18, 0x90, 0x1a, 0x57, 0x82,
+0x00, 0x23, 0xa9, 0x40, 0x23, 0x89, 0x00, 0xfc, 0x9b, 0x08, 0x71, 0x46, 0x12, 0x21, 0x82, 0xaa,
+0x09, 0xe9, 0xbd, 0xcb, 0xbb, 0x1a, 0x11, 0x10, 0x42, 0x24, 0x32, 0x24, 0x91, 0x8a, 0x22, 0x91,
+0x08, 0x81, 0xfa, 0x9c, 0x08, 0xda, 0x9d, 0x11, 0xa8, 0x8b, 0x91, 0xdb, 0xaa, 0xcb, 0xba, 0xbc,
+0x38, 0x56, 0x46, 0x34, 0x23, 0x23, 0x80, 0x98, 0xba, 0xcf, 0xbc, 0xac, 0x89, 0x00, 0x11, 0x21,
+0x41, 0x34, 0x22, 0x22, 0x90, 0x8a, 0x21, 0xb8, 0xbb, 0xfb, 0xcc, 0x89, 0x80, 0xba, 0xbc, 0x99,
+0xab, 0xab, 0x09, 0x82, 0xdc, 0x89, 0x01, 0x09, 0x77, 0x37, 0x32, 0x33, 0x14, 0x80, 0x08, 0xb8,
+0xbe, 0xcc, 0xcb, 0x99, 0x80, 0x00, 0x22, 0x22, 0x53, 0x23, 0x23, 0x81, 0xaa, 0x19, 0xb8, 0xac,
+0xca, 0xcf, 0xaa, 0x98, 0x99, 0x08, 0x00, 0x88, 0x08, 0x42, 0x02, 0xc9, 0xbd, 0x89, 0xb0, 0x8d,
+0x53, 0x54, 0x55, 0x34, 0x21, 0x11, 0x81, 0x98, 0xa9, 0xce, 0xbc, 0x9a, 0x99, 0x00, 0x01, 0x80,
+0x20, 0x54, 0x14, 0x90, 0x88, 0x88, 0x9a, 0x00, 0xea, 0xbb, 0xac, 0x19, 0x91, 0xbb, 0x41, 0x82,
+0x08, 0xb8, 0xae, 0x21, 0xb8, 0x48, 0x15, 0x80, 0x65, 0x45, 0x34, 0x23, 0x21, 0x12, 0xc9, 0x9c,
+0xa8, 0xdd, 0xab, 0xbb, 0x9a, 0x08, 0x88, 0x21, 0x11, 0x73, 0x17, 0x81, 0x18, 0x10, 0x10, 0x90,
+0x99, 0x08, 0xb9, 0x0a, 0x01, 0x89, 0x10, 0xc8, 0xde, 0xcc, 0xab, 0x99, 0xaa, 0xab, 0x09, 0x80,
+0x40, 0x47, 0x23, 0x55, 0x35, 0x12, 0x00, 0x11, 0x90, 0x99, 0xc9, 0xcf, 0xaa, 0x89, 0x08, 0x01,
+0x08, 0x31, 0x25, 0x32, 0x12, 0xba, 0xaa, 0xcb, 0x1a, 0xc1, 0xae, 0x00, 0xc9, 0xac, 0xaa, 0x8a,
+0x98, 0x9c, 0x32, 0x01, 0x52, 0xb1, 0x8e, 0x10, 0x98, 0x10, 0x80, 0x74, 0x37, 0x45, 0x23, 0x00,
+0x00, 0x98, 0xa9, 0xdc, 0xac, 0xbb, 0x9b, 0x18, 0x11, 0x22, 0x21, 0x75, 0x12, 0x90, 0x89, 0xaa,
+0x18, 0x02, 0x00, 0xb8, 0x0c, 0x32, 0x01, 0xa0, 0xef, 0xaa, 0xca, 0xab, 0xc9, 0x9c, 0x00, 0xe9,
+0x09, 0x12, 0x09, 0x44, 0x24, 0x52, 0x34, 0x34, 0x33, 0x81, 0x80, 0x90, 0xb9, 0xbd, 0xcd, 0xab,
+0x09, 0x81, 0x09, 0x01, 0xba, 0x2a, 0x24, 0xa8, 0x20, 0x45, 0x13, 0x81, 0x88, 0xe9, 0xcd, 0xbc,
+0xa9, 0xca, 0x9b, 0x10, 0xa0, 0x28, 0x34, 0x88, 0x18, 0xfa, 0xac, 0x20, 0x33, 0x54, 0x34, 0x43,
+0x45, 0x43, 0x22, 0x88, 0x80, 0x98, 0xaa, 0xd9, 0xcc, 0xab, 0xaa, 0x88, 0x90, 0xba, 0x9b, 0x19,
+0x63, 0x23, 0x81, 0x98, 0x52, 0x34, 0x12, 0xa9, 0xbe, 0xaa, 0xdb, 0x9b, 0x80, 0xca, 0xbc, 0x0a,
+0x43, 0x02, 0x08, 0x99, 0x71, 0x03, 0x28, 0x25, 0xea, 0x40, 0x34, 0x32, 0x36, 0x80, 0x20, 0x21,
+0x32, 0xa3, 0xcf, 0xba, 0xab, 0x19, 0xb8, 0xaf, 0x9a, 0x08, 0x44, 0x12, 0x12, 0x22, 0x32, 0x33,
+0xb0, 0xdb, 0xdd, 0xbd, 0x9a, 0xa9, 0xac, 0x08, 0xa8, 0x0a, 0x24, 0x98, 0x18, 0xa1, 0xad, 0x89,
+0x52, 0x34, 0x80, 0x51, 0x37, 0x44, 0x43, 0x12, 0x01, 0x32, 0x23, 0x81, 0xa9, 0xdd, 0xbc, 0xaa,
+0xba, 0xcb, 0xad, 0x9a, 0x00, 0x90, 0x18, 0x31, 0x32, 0x34, 0x81, 0x00, 0xc9, 0x9d, 0x20, 0xb8,
+0xcc, 0xca, 0xab, 0x09, 0x81, 0x90, 0x10, 0x98, 0x70, 0x27, 0x12, 0x53, 0x01, 0x28, 0x36, 0x12,
+0x46, 0x12, 0x18, 0x23, 0x80, 0x10, 0xd8, 0xbd, 0xba, 0xbc, 0xcd, 0x9a, 0x99, 0xa9, 0x20, 0x23,
+0x21, 0x54, 0x33, 0x01, 0x08, 0x34, 0xb0, 0x8c, 0x88, 0xdd, 0xbc, 0xaa, 0x00, 0xd9, 0x9b, 0x00,
+0x00, 0x52, 0x22, 0x32, 0x81, 0x89, 0x00, 0x62, 0x14, 0xaa, 0x72, 0x35, 0x42, 0x35, 0x02, 0x80,
+0x21, 0x00, 0xba, 0xeb, 0xbc, 0x9a, 0xba, 0xcd, 0x9a, 0xa9, 0x9a, 0x00, 0x08, 0x08, 0x51, 0x55,
+0x12, 0x81, 0x80, 0x08, 0x08, 0xa0, 0xdc, 0xaa, 0xca, 0x9c, 0x08, 0x88, 0x10, 0xda, 0x9b, 0x11,
+0xa8, 0x50, 0x35, 0x33, 0x34, 0x47, 0x23, 0x43, 0x43, 0x81, 0x10, 0x03, 0xa8, 0x21, 0xd8, 0xcd,
+0xcb, 0xba, 0xcb, 0xbb, 0xdb, 0xaa, 0x10, 0x12, 0x44, 0x23, 0x32, 0x35, 0x21, 0x22, 0xc9, 0xbb,
+0xba, 0xbc, 0xbb, 0xcc, 0xaa, 0xbc, 0x9b, 0x00, 0x80, 0x90, 0x18, 0x37, 0x44, 0x33, 0x00, 0x41,
+0x13, 0x10, 0x55, 0x42, 0x44, 0x11, 0x21, 0x33, 0x90, 0x08, 0x81, 0xca, 0xcc, 0xeb, 0xbc, 0xcb,
+0xab, 0xaa, 0xb9, 0xab, 0x50, 0x24, 0x88, 0x21, 0x25, 0x22, 0x53, 0x01, 0xcb, 0x9b, 0x18, 0xa1,
+0xbc, 0x89, 0x08, 0x63, 0x22, 0x88, 0xb9, 0xce, 0xac, 0xaa, 0x08, 0x00, 0x71, 0x33, 0x80, 0x41,
+0x34, 0x32, 0x34, 0x33, 0x44, 0x13, 0x88, 0x00, 0x90, 0x00, 0xf8, 0xcf, 0x9a, 0xba, 0xac, 0xaa,
+0x99, 0x08, 0x00, 0x53, 0x43, 0x32, 0x42, 0x45, 0x23, 0x81, 0x98, 0xbc, 0xaa, 0xdb, 0xae, 0x8a,
+0xaa, 0xaa, 0x09, 0x41, 0x03, 0xa9, 0x61, 0x03, 0x19, 0x55, 0x01, 0x18, 0x23, 0x00, 0x90, 0x09,
+0x45, 0x01, 0x31, 0x05, 0x10, 0x35, 0x98, 0x19, 0x81, 0x89, 0x12, 0xdf, 0xab, 0xcb, 0xbb, 0xcb,
+0xdb, 0x9a, 0x00, 0x80, 0x80, 0x08, 0x64, 0x24, 0x22, 0x25, 0x01, 0x08, 0xc0, 0x9c, 0x00, 0xfb,
+0x8a, 0x88, 0x08, 0x81, 0x8a, 0x45, 0xa0, 0x9c, 0x11, 0x98, 0x28, 0xb0, 0xbf, 0x29, 0x25, 0x80,
+0x51, 0x33, 0x42, 0x43, 0x22, 0x34, 0x03, 0x00, 0x98, 0x28, 0xb2, 0xff, 0x9c, 0xba, 0xac, 0x18,
+0xa8, 0xab, 0x41, 0x02, 0x20, 0x14, 0x10, 0x43, 0x01, 0x53, 0xb1, 0x9e, 0x21, 0xd8, 0x8b, 0x91,
+0xcc, 0x9b, 0x08, 0x00, 0x09, 0x63, 0x24, 0x43, 0x02, 0x88, 0xa8, 0xbd, 0x38, 0xb1, 0xaf, 0x18,
+0x88, 0x08, 0x42, 0x66, 0x23, 0x88, 0x31, 0x35, 0x02, 0x98, 0x10, 0xa1, 0xcf, 0xa9, 0xbb, 0xac,
+0xca, 0xcb, 0x99, 0xa9, 0x28, 0x34, 0x22, 0x53, 0x13, 0x00, 0x32, 0x13, 0x48, 0x26, 0xd9, 0x0a,
+0x24, 0xa8, 0x9b, 0x89, 0x01, 0x90, 0x19, 0x83, 0xdf, 0x89, 0xb8, 0xac, 0x18, 0x91, 0x09, 0x11,
+0xa9, 0x21, 0xb1, 0x0d, 0x67, 0x02, 0x20, 0x45, 0x22, 0x42, 0x23, 0xa0, 0x10, 0xa1, 0xbd, 0xbd,
+0xbc, 0x09, 0xb8, 0x9d, 0x10, 0x98, 0x10, 0xa0, 0x18, 0xa2, 0x2c, 0x57, 0x82, 0x88, 0x80, 0x10,
+0xe9, 0xac, 0x10, 0x90, 0x08, 0x00, 0x09, 0x80, 0x90, 0x92, 0x90, 0x02, 0x9b, 0x43, 0xf9, 0x50,
+0xe1, 0xaf, 0x88, 0xca, 0x8b, 0x02, 0x99, 0x60, 0x46, 0x43, 0x11, 0x31, 0x36, 0x01, 0x00, 0x80,
+0xba, 0x88, 0xfa, 0xad, 0x89, 0xaa, 0xaa, 0xba, 0xbc, 0x9b, 0x0a, 0x01, 0x99, 0x64, 0x24, 0x32,
+0x43, 0x32, 0x44, 0x12, 0x90, 0xbc, 0x19, 0x92, 0xae, 0x08, 0xda, 0x0a, 0xb0, 0xad, 0x21, 0xc8,
+0xab, 0x80, 0x00, 0x90, 0x19, 0x56, 0x02, 0x89, 0x00, 0x30, 0x57, 0x03, 0x88, 0x44, 0x12, 0x42,
+0x23, 0x08, 0x43, 0xc1, 0x9b, 0x81, 0xdf, 0xaa, 0xa9, 0x9a, 0xca, 0xaa, 0x80, 0xca, 0x89, 0x00,
+0x31, 0x27, 0x33, 0x13, 0x28, 0x44, 0x90, 0x08, 0x00, 0x88, 0xfb, 0x9c, 0x53, 0x82, 0x88, 0x00,
+0x09, 0x81, 0x09, 0x57, 0x91, 0xbb, 0x09, 0x08, 0x10, 0xeb, 0xcc, 0xba, 0xab, 0x10, 0x98, 0x18,
+0x47, 0x23, 0x43, 0x33, 0x43, 0x53, 0x11, 0x89, 0x10, 0xa8, 0xdd, 0x9b, 0x80, 0xda, 0xbb, 0xba,
+0xbe, 0x08, 0xb8, 0x9c, 0x30, 0x34, 0x34, 0x42, 0x24, 0x88, 0x51, 0x14, 0x00, 0x00, 0x89, 0x11,
+0xe9, 0x8b, 0xa0, 0xbc, 0x08, 0xfb, 0x1a, 0x82, 0xdb, 0x89, 0x00, 0x08, 0x88, 0x10, 0xd8, 0xbd,
+0x08, 0x01, 0x99, 0x10, 0x64, 0x35, 0x33, 0x42, 0x25, 0x11, 0x28, 0x33, 0x81, 0x8a, 0x11, 0xb1,
+0xed, 0xdb, 0xbb, 0x89, 0xb9, 0x9d, 0x88, 0xbd, 0x39, 0x25, 0x80, 0x19, 0x53, 0x02, 0x0a, 0x10,
+0x99, 0x30, 0xf8, 0x9e, 0x00, 0x08, 0x88, 0x08, 0x45, 0x02, 0x0a, 0x00, 0x88, 0xb0, 0xff, 0x8a,
+0x90, 0xab, 0x19, 0x81, 0xdc, 0x0a, 0x43, 0x01, 0x20, 0x36, 0x22, 0x43, 0x43, 0x22, 0x34, 0x23,
+0x81, 0x52, 0x03, 0xdb, 0xab, 0xbc, 0xbb, 0xcc, 0xba, 0xcb, 0xbb, 0x18, 0x80, 0x08, 0x80, 0x08,
+0xa8, 0x73, 0x27, 0xa8, 0x30, 0x25, 0x90, 0xbc, 0x1a, 0x82, 0xec, 0x09, 0x00, 0x89, 0x41, 0x24,
+0xa8, 0x38, 0x36, 0xa0, 0x18, 0xa2, 0xcd, 0x89, 0x00, 0x80, 0x89, 0x22, 0xf9, 0x9d, 0x88, 0x28,
+0x44, 0x00, 0x41, 0x25, 0x33, 0x02, 0x28, 0x27, 0xb9, 0x8b, 0x90, 0xbd, 0xcb, 0xbb, 0x88, 0xd9,
+0x9b, 0x22, 0xea, 0xab, 0x51, 0x12, 0x18, 0x53, 0x91, 0x1a, 0x54, 0x81, 0x1a, 0x01, 0xeb, 0x19,
+0x24, 0x98, 0x08, 0x91, 0x08, 0x00, 0x98, 0x81, 0x91, 0x09, 0x23, 0xff, 0xad, 0x11, 0xb0, 0xae,
+0x18, 0xa1, 0xbc, 0x0a, 0x02, 0x9b, 0x74, 0x02, 0x18, 0x36, 0x12, 0x53, 0x12, 0x08, 0x80, 0x19,
+0x82, 0xce, 0x88, 0xb8, 0x8d, 0x90, 0xbc, 0x20, 0xb0, 0xbd, 0x08, 0x81, 0x89, 0x64, 0x03, 0x9a,
+0x62, 0x02, 0x80, 0x88, 0x28, 0xc1, 0x9f, 0x31, 0x83, 0x99, 0x01, 0x88, 0x18, 0x28, 0xf9, 0x9f,
+0x18, 0x90, 0x18, 0x91, 0xbe, 0x0a, 0x00, 0x90, 0x80, 0x01, 0x99, 0x41, 0xd9, 0x79, 0x24, 0x00,
+0x53, 0x81, 0x51, 0x12, 0x99, 0x81, 0x30, 0x37, 0xa8, 0x28, 0xb2, 0xaf, 0x88, 0x08, 0x01, 0xdc,
+0x89, 0xb8, 0x9d, 0x90, 0xbc, 0x18, 0x92, 0x89, 0x11, 0x64, 0x03, 0xa9, 0x21, 0xa8, 0x39, 0x91,
+0x0b, 0x14, 0xac, 0x42, 0xc8, 0x4a, 0x37, 0x03, 0x98, 0x18, 0x92, 0x9b, 0x44, 0xf9, 0x9c, 0x98,
+0xbc, 0x89, 0x01, 0x88, 0x19, 0x82, 0xbb, 0x75, 0x14, 0x28, 0x34, 0x80, 0x73, 0x92, 0x0a, 0x34,
+0x81, 0x00, 0x89, 0x21, 0xf9, 0x9c, 0x90, 0xbc, 0x08, 0xf9, 0x9c, 0x08, 0x80, 0x18, 0x98, 0x00,
+0x90, 0x58, 0x35, 0xa0, 0x29, 0x36, 0x80, 0x08, 0x80, 0x08, 0x00, 0x89, 0x30, 0xfa, 0xaf, 0x19,
+0x81, 0x09, 0x00, 0x98, 0x20, 0xa8, 0x39, 0x81, 0x0d, 0x13, 0xdb, 0x62, 0xe0, 0xad, 0x88, 0x08,
+0x44, 0x12, 0x99, 0x60, 0x44, 0x01, 0x28, 0x33, 0x88, 0x19, 0x80, 0x80, 0xfc, 0x8c, 0x03, 0xdb,
+0x09, 0xc8, 0x8b, 0x98, 0xbc, 0x19, 0x81, 0x09, 0x80, 0x80, 0x98, 0x74, 0x17, 0x99, 0x30, 0x14,
+0x80, 0x88, 0x18, 0x36, 0x81, 0x80, 0xdb, 0xab, 0x11, 0x80, 0xd9, 0xad, 0x19, 0x92, 0x89, 0x21,
+0xa9, 0x28, 0xb4, 0x8b, 0x27, 0xed, 0x1a, 0x24, 0x98, 0x00, 0x80, 0x08, 0x09, 0x75, 0x82, 0x8a,
+0x53, 0x01, 0x20, 0x24, 0x88, 0x98, 0x11, 0xc1, 0xae, 0x98, 0xda, 0x89, 0xb9, 0x9d, 0x90, 0xbd,
+0x20, 0x90, 0x19, 0x92, 0x1c, 0x37, 0x81, 0x08, 0x90, 0x61, 0x24, 0x9a, 0x58, 0x23, 0x88, 0x08,
+0x80, 0x08, 0x81, 0xde, 0x9b, 0x22, 0xfa, 0x9b, 0x11, 0xc0, 0x9c, 0x88, 0x00, 0x80, 0xdc, 0x0b,
+0x53, 0x02, 0x99, 0x61, 0x12, 0x08, 0x54, 0x03, 0x08, 0x43, 0x81, 0x09, 0x81, 0x98, 0x21, 0xaa,
+0x51, 0xf8, 0x9c, 0x90, 0xbc, 0x19, 0xf8, 0xac, 0x00, 0xb9, 0x0a, 0x88, 0x40, 0x24, 0x19, 0x54,
+0xa0, 0x29, 0x34, 0x80, 0x80, 0x98, 0x73, 0x12, 0x88, 0x08, 0x18, 0xb0, 0xcf, 0x19, 0x92, 0xbd,
+0x1a, 0x01, 0xeb, 0x9a, 0x01, 0x90, 0x00, 0x90, 0x18, 0x91, 0x2c, 0x77, 0x81, 0x89, 0x42, 0x12,
+0x99, 0x41, 0x24, 0x98, 0x00, 0x90, 0x18, 0x90, 0x08, 0x01, 0x8b, 0x24, 0xfd, 0x9f, 0x01, 0xa0,
+0xbc, 0x28, 0xa1, 0xbd, 0x09, 0x00, 0x08, 0x89, 0x72, 0x15, 0xa8, 0x30, 0x25, 0x90, 0x19, 0x45,
+0x91, 0x09, 0x82, 0xeb, 0x0a, 0x08, 0x18, 0xd8, 0xac, 0x18, 0x00, 0xa0, 0xcd, 0x8a, 0x02, 0x89,
+0x00, 0x80, 0x19, 0x00, 0xa9, 0x78, 0x57, 0x91, 0x1a, 0x25, 0x81, 0x41, 0x03, 0x89, 0x10, 0x98,
+0x18, 0x91, 0x09, 0x11, 0x8a, 0x48, 0xa8, 0x2b, 0x17, 0xef, 0x9a, 0xa0, 0xbd, 0x28, 0xc2, 0xad,
+0x18, 0x90, 0x08, 0x81, 0x8a, 0x74, 0x12, 0x98, 0x48, 0x25, 0xa8, 0x38, 0x25, 0x00, 0x88, 0x08,
+0x01, 0xec, 0x8b, 0x00, 0x00, 0xb8, 0xbf, 0x29, 0xa1, 0x19, 0x93, 0xcf, 0x0a, 0x81, 0x08, 0x08,
+0x08, 0x90, 0x69, 0x36, 0xa1, 0x19, 0x36, 0x81, 0x89, 0x53, 0x13, 0xa9, 0x61, 0x04, 0x08, 0x90,
+0xdc, 0x18, 0x91, 0xbc, 0x08, 0x88, 0x01, 0xf9, 0x9b, 0x01, 0x88, 0xa1, 0xbf, 0x29, 0x91, 0x1b,
+0x36, 0x82, 0x80, 0x98, 0x71, 0x23, 0x98, 0x00, 0x90, 0x80, 0x08, 0x67, 0x82, 0x0a, 0x12, 0xdc,
+0x8a, 0x81, 0x18, 0xb0, 0xbf, 0x10, 0xa1, 0xbc, 0x0a, 0x01, 0x89, 0x10, 0xa9, 0x71, 0x27, 0xa8,
+0x20, 0x25, 0x08, 0x09, 0x80, 0x80, 0x08, 0x81, 0x99, 0x23, 0xfa, 0x70, 0x05, 0xbb, 0x19, 0x81,
+0x09, 0x81, 0x89, 0x12, 0x9b, 0x52, 0xfa, 0x9f, 0x00, 0x80, 0x08, 0x80, 0x80, 0x08, 0x81, 0x9a,
+0x75, 0x14, 0x89, 0x18, 0x90, 0x18, 0x90, 0x08, 0x81, 0x09, 0x21, 0x8e, 0x33, 0xfe, 0x9c, 0x10,
+0x88, 0x18, 0x88, 0x08, 0x00, 0x09, 0x81, 0x09, 0x00, 0x98, 0xa3, 0xb1, 0x13, 0xb9, 0x32, 0xb2,
+0x4f, 0x08, 0x1d, 0x13, 0xaf, 0x67, 0x13, 0x89, 0x18, 0x88, 0x08, 0x91, 0x80, 0x91, 0x08, 0x00,
+0x89, 0x92, 0xa0, 0x83, 0xe1, 0x31, 0x99, 0x6b, 0xe2, 0x08, 0x87, 0xef, 0x0a, 0x00, 0x88, 0x00,
+0x88, 0x10, 0x98, 0x28, 0xc1, 0x3a, 0x77, 0x83, 0x09, 0x00, 0x98, 0x00, 0x80, 0x88, 0x82, 0xa8,
+0x40, 0xe2, 0xdf, 0x89, 0x01, 0x88, 0x18, 0x88, 0x08, 0x81, 0x89, 0x11, 0xb9, 0x40, 0xd2, 0x2b,
+0x77, 0x04, 0x98, 0x11, 0xd9, 0xac, 0x40, 0x23, 0x88, 0x08, 0x80, 0x08, 0x80, 0x19, 0x81, 0x0b,
+0x62, 0xfb, 0x9f, 0x18, 0x80, 0x88, 0x00, 0x88, 0x18, 0x80, 0x8a, 0x76, 0x13, 0x89, 0x18, 0x90,
+0x08, 0x00, 0x09, 0x81, 0x98, 0x11, 0x99, 0x12, 0xea, 0x53, 0xf9, 0xdf, 0x00, 0x80, 0x08, 0x80,
+0x88, 0x82, 0x9a, 0x75, 0x03, 0x89, 0x10, 0x98, 0x28, 0xc1, 0xbf, 0x19, 0x91, 0x89, 0x55, 0x02,
+0x99, 0x02, 0x99, 0x30, 0xf0, 0xbc, 0x00, 0x80, 0x08, 0x91, 0x08, 0x81, 0x99, 0x23, 0xcc, 0x73,
+0x27, 0x88, 0x08, 0x80, 0x08, 0x00, 0x98, 0x00, 0x80, 0x09, 0x02, 0xba, 0x72, 0xf8, 0xbf, 0x18,
+0x80, 0x08, 0x80, 0x88, 0x81, 0x88, 0x10, 0x98, 0x01, 0xa0, 0x59, 0x98, 0x4b, 0xa3, 0x8f, 0x77,
+0x03, 0x89, 0x81, 0x88, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x92, 0x1b, 0x94, 0x8c, 0x26, 0xfe, 0x9b,
+0x10, 0x88, 0x18, 0x88, 0x08, 0x80, 0x08, 0x80, 0x88, 0x01, 0x1a, 0x01, 0x9a, 0x33, 0xfb, 0x40,
+0xf2, 0x5b, 0x67, 0x00, 0x09, 0x00, 0x88, 0x80, 0x80, 0x90, 0x01, 0xb0, 0x40, 0xb1, 0xff, 0x0c,
+0x81, 0x88, 0x01, 0x89, 0x10, 0x98, 0x20, 0xb8, 0x7b, 0x47, 0x80, 0x09, 0x81, 0x88, 0x00, 0x88,
+0x00, 0x88, 0x00, 0x08, 0x19, 0x29, 0x1a, 0x90, 0x81, 0x00, 0x09, 0xb1, 0x19, 0x33, 0x9e, 0x32,
+0xf8, 0x58, 0xf3, 0xcf, 0x0a, 0x01, 0x98, 0x10, 0x88, 0x08, 0x81, 0x0a, 0x02, 0xb9, 0x32, 0xd0,
+0x4a, 0x93, 0x9f, 0x67, 0x02, 0x08, 0xa8, 0xaf, 0x20, 0x24, 0x88, 0x08, 0x80, 0x08, 0x80, 0x08,
+0x08, 0x08, 0x08, 0x08, 0x88, 0x18, 0xb1, 0x5a, 0xb6, 0xff, 0x0d, 0x81, 0x98, 0x51, 0x13, 0x89,
+0x00, 0x90, 0x18, 0xb2, 0xef, 0x09, 0x01, 0x99, 0x53, 0x03, 0x89, 0x10, 0x98, 0x10, 0x88, 0x19,
+0x80, 0x19, 0x81, 0x8a, 0x23, 0x9f, 0x72, 0xfa, 0x9e, 0x10, 0x88, 0x08, 0x80, 0x08, 0x00, 0x0a,
+0x02, 0xca, 0x75, 0x14, 0x98, 0x00, 0x80, 0x08, 0x80, 0x88, 0x00, 0x88, 0x00, 0x90, 0x18, 0x90,
+0x88, 0x93, 0xa9, 0x05, 0xb8, 0x21, 0xd5, 0x00, 0x93, 0x9b, 0x06, 0xdb, 0x34, 0xf0, 0xff, 0x08,
+0x80, 0x08, 0x91, 0x09, 0x64, 0x82, 0x09, 0x00, 0x88, 0x08, 0x80, 0x08, 0x80, 0x19, 0x81, 0x1a,
+0x21, 0x8e, 0x43, 0xfd, 0x9f, 0x01, 0x98, 0x20, 0x25, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x80,
+0x90, 0x00, 0x08, 0x19, 0x29, 0x99, 0xb3, 0xb5, 0xa1, 0x93, 0xb8, 0x95, 0xf0, 0x33, 0xf0, 0xff,
+0x3b, 0x24, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x90, 0x00, 0x01, 0x1b,
+0x38, 0x9b, 0x39, 0xb9, 0x3a, 0xb7, 0xc2, 0x94, 0x99, 0x33, 0xda, 0x78, 0xa0, 0x3c, 0x85, 0xef,
+0x8a, 0x80, 0x40, 0x24, 0x98, 0x18, 0x80, 0x09, 0x10, 0x0a, 0x10, 0xa8, 0x01, 0xa1, 0x90, 0xa4,
+0x90, 0x21, 0x9b, 0x21, 0xc1, 0x29, 0xa3, 0x2b, 0x11, 0x9a, 0x69, 0x0b, 0x80, 0xa3, 0x5b, 0x3b,
+0x9a, 0xa5, 0x91, 0x92, 0xb9, 0x32, 0x0c, 0x79, 0xa9, 0x78, 0xf2, 0xdf, 0x19, 0x91, 0x88, 0x82,
+0x9a, 0x74, 0x02, 0x88, 0x00, 0x88, 0x10, 0xa8, 0x38, 0xb2, 0xff, 0x0a, 0x00, 0x88, 0x80, 0x00,
+0x09, 0x10, 0xb8, 0x79, 0x37, 0x80, 0x09, 0x00, 0x88, 0x00, 0x88, 0x00, 0x98, 0x02, 0xa9, 0x31,
+0xe0, 0x49, 0xb4, 0xff, 0x0b, 0x00, 0x08, 0x08, 0x80, 0xb0, 0x71, 0x35, 0x88, 0x19, 0x80, 0x88,
+0x81, 0x88, 0x10, 0x89, 0x39, 0x98, 0x3a, 0xa1, 0x3b, 0x03, 0x1f, 0x05, 0xff, 0x8f, 0x01, 0x89,
+0x01, 0xa8, 0x50, 0x14, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x88, 0x01, 0xa9, 0x52, 0xf9, 0xcf,
+0x00, 0x80, 0x08, 0x91, 0x1a, 0x46, 0x02, 0x89, 0x00, 0x88, 0x00, 0x08, 0x08, 0x90, 0x10, 0x88,
+0x2a, 0x10, 0x1c, 0x20, 0x0b, 0x21, 0xbb, 0x70, 0xa8, 0x6a, 0xa0, 0x3c, 0x97, 0xff, 0x0a, 0x01,
+0x89, 0x01, 0x89, 0x10, 0xb0, 0x79, 0x35, 0x90, 0x08, 0x00, 0x88, 0x00, 0x08, 0x09, 0x81, 0x89,
+0x21, 0xba, 0x79, 0xe3, 0xef, 0x88, 0x81, 0x88, 0x01, 0x89, 0x10, 0x98, 0x10, 0xb0, 0x7a, 0x47,
+0x80, 0x09, 0x00, 0x09, 0x00, 0x88, 0x18, 0x08, 0x19, 0xa1, 0x90, 0x93, 0xc0, 0x13, 0x0a, 0x5b,
+0x98, 0x09, 0x94, 0x9a, 0x52, 0x8c, 0x59, 0xb8, 0x38, 0xb4, 0x1d, 0x07, 0xff, 0x0a, 0x00, 0x88,
+0x00, 0xa0, 0x11, 0xb0, 0x5a, 0x37, 0x81, 0x09, 0x00, 0x08, 0x08, 0x80, 0x98, 0x31, 0xf8, 0xdf,
+0x08, 0x80, 0x08, 0x00, 0x89, 0x11, 0xaa, 0x73, 0x17, 0x88, 0x18, 0x88, 0x18, 0x90, 0x80, 0x00,
+0x98, 0x11, 0x89, 0x28, 0x98, 0x19, 0xa3, 0xb0, 0x97, 0x98, 0x30, 0xb9, 0x79, 0x08, 0x2d, 0x11,
+0xac, 0x35, 0xfa, 0xdf, 0x08, 0x00, 0x09, 0x00, 0x88, 0x18, 0x80, 0x9a, 0x75, 0x14, 0x90, 0x08,
+0x81, 0x89, 0x01, 0x89, 0x20, 0xa8, 0x39, 0xb2, 0x8b, 0x17, 0xbb, 0x73, 0xf0, 0x9e, 0x19, 0x08,
+0x88, 0x00, 0x00, 0x8b, 0x74, 0x14, 0x89, 0x00, 0x90, 0x00, 0x90, 0x18, 0x90, 0x08, 0x92, 0x0b,
+0x14, 0xbc, 0x45, 0xf9, 0x9f, 0x08, 0x18, 0x53, 0x91, 0x08, 0x00, 0x89, 0x01, 0x89, 0x20, 0x99,
+0x20, 0xb8, 0x59, 0xb1, 0x3c, 0x96, 0xef, 0x89, 0x80, 0x41, 0x23, 0x99, 0x10, 0xa0, 0x00, 0x81,
+0x09, 0x81, 0x1a, 0x82, 0xaa, 0x15, 0xcb, 0x73, 0xf9, 0x9f, 0x08, 0x00, 0x88, 0x00, 0x08, 0x0a,
+0x65, 0x03, 0x89, 0x00, 0x90, 0x18, 0x80, 0x09, 0x81, 0x88, 0x10, 0x99, 0x11, 0xb0, 0x11, 0x81,
+0x3d, 0x19, 0x3b, 0x49, 0x2e, 0x00, 0x1c, 0x25, 0xff, 0xaf, 0x32, 0x03, 0x88, 0x00, 0x08, 0x09,
+0x00, 0x98, 0x01, 0xa1, 0x39, 0x91, 0x9c, 0x27, 0xfc, 0x9e, 0x00, 0x80, 0x88, 0x10, 0x98, 0x2a,
+0x47, 0x03, 0x99, 0x10, 0x90, 0x08, 0x91, 0x08, 0x10, 0x0a, 0x00, 0xa0, 0x92, 0x91, 0xa1, 0x92,
+0x90, 0xa0, 0x23, 0xbb, 0x32, 0xf3, 0x18, 0xb4, 0x0b, 0x37, 0xff, 0x8e, 0x01, 0x98, 0x00, 0x90,
+0x00, 0x80, 0x19, 0x81, 0x0c, 0x67, 0x82, 0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x08,
+0x93, 0xff, 0x9f, 0x32, 0x02, 0x88, 0x00, 0x08, 0x88, 0x00, 0x80, 0x09, 0x94, 0xff, 0x8a, 0x82,
+0x99, 0x62, 0x03, 0x88, 0x00, 0x88, 0x80, 0x00, 0x09, 0x00, 0x88, 0x90, 0xa2, 0x00, 0x39, 0x0b,
+0x01, 0xc1, 0x7b, 0x98, 0x3b, 0x87, 0xff, 0x0e, 0x00, 0x09, 0x00, 0x98, 0x68, 0x33, 0x98, 0x18,
+0x88, 0x80, 0x00, 0x09, 0x91, 0x80, 0x01, 0x0a, 0x11, 0xba, 0x53, 0xd8, 0x7b, 0xa2, 0xff, 0x0b,
+0x10, 0x89, 0x00, 0x80, 0x09, 0x10, 0x99, 0x30, 0xc0, 0x3c, 0x77, 0x83, 0x88, 0x00, 0x98, 0x81,
+0x80, 0x08, 0x00, 0x09, 0x00, 0x08, 0x08, 0x89, 0x10, 0x19, 0x39, 0xab, 0x33, 0xca, 0x50, 0xd1,
+0x7b, 0xc3, 0xff, 0x0a, 0x81, 0x88, 0x01, 0xa9, 0x72, 0x14, 0x88, 0x08, 0x80, 0x08, 0x00, 0x98,
+0x10, 0x90, 0x09, 0x83, 0xca, 0x73, 0xf9, 0xae, 0x18, 0x90, 0x08, 0x81, 0x88, 0x81, 0x89, 0x21,
+0xca, 0x71, 0x47, 0x88, 0x08, 0x80, 0x08, 0x00, 0x89, 0x01, 0x99, 0x21, 0xc8, 0x50, 0xf0, 0xaf,
+0x10, 0xa0, 0x39, 0x35, 0x00, 0x08, 0xfb, 0x99, 0x00, 0x30, 0x25, 0x98, 0x18, 0x80, 0x09, 0x82,
+0x99, 0x11, 0x98, 0x38, 0xa8, 0x3a, 0x01, 0x8c, 0x04, 0xba, 0x33, 0xf9, 0x21, 0xb1, 0x3b, 0x93,
+0x8d, 0x14, 0xcb, 0x24, 0xf0, 0x20, 0xb1, 0x4d, 0xa3, 0xff, 0x0b, 0x80, 0x51, 0x13, 0xa9, 0x12,
+0xb8, 0x40, 0xe1, 0x9d, 0x42, 0x81, 0x89, 0x01, 0x98, 0x01, 0x88, 0x08, 0x00, 0x09, 0x10, 0xb8,
+0x38, 0xa7, 0xff, 0x0b, 0x10, 0x99, 0x11, 0xb8, 0x70, 0x15, 0x90, 0x00, 0x80, 0x08, 0x80, 0x19,
+0x08, 0x98, 0x01, 0xa0, 0x20, 0xa8, 0x01, 0xc3, 0x18, 0x01, 0x0c, 0x96, 0xab, 0x37, 0xfe, 0x9e,
+0x01, 0x90, 0x18, 0x90, 0x29, 0x37, 0x81, 0x88, 0x81, 0x88, 0x00, 0x90, 0x81, 0x90, 0x10, 0x88,
+0x19, 0x81, 0xa9, 0x85, 0x99, 0x30, 0xb9, 0x11, 0xb5, 0x08, 0xa4, 0x8a, 0x15, 0xca, 0x33, 0xc8,
+0x59, 0xc2, 0x0a, 0x87, 0x9b, 0x53, 0xcb, 0x70, 0xf1, 0x9d, 0x42, 0x81, 0x09, 0x00, 0x88, 0x18,
+0x90, 0x18, 0x90, 0x88, 0x92, 0xa0, 0x93, 0xc1, 0x02, 0xa1, 0x29, 0x10, 0x1c, 0x10, 0xaa, 0x12,
+0x99, 0x39, 0xb1, 0x19, 0x31, 0x2d, 0x19, 0xa8, 0x12, 0x3b, 0x5c, 0x1b, 0x19, 0x19, 0x3b, 0x19,
+0x09, 0x30, 0x2e, 0x39, 0x0b, 0x20, 0xf2, 0x10, 0x01, 0x1c, 0x02, 0xc9, 0x13, 0xc8, 0x21, 0xd4,
+0x08, 0x93, 0x0d, 0x33, 0xae, 0x43, 0xf8, 0x38, 0xc5, 0xcf, 0x88, 0x80, 0x51, 0x13, 0x99, 0x10,
+0x90, 0x08, 0x81, 0x89, 0x01, 0x98, 0x10, 0xb1, 0x10, 0x91, 0x99, 0x84, 0x8a, 0x30, 0xa9, 0x5a,
+0x19, 0x1b, 0x02, 0x9a, 0x12, 0x9a, 0x11, 0xb3, 0xb1, 0xa3, 0x19, 0x13, 0x1b, 0x6b, 0x0a, 0x3a,
+0x00, 0x0d, 0x21, 0x1c, 0x79, 0xaa, 0x7a, 0xe2, 0xef, 0x19, 0x81, 0x0a, 0x63, 0x01, 0x88, 0x00,
+0x88, 0x00, 0x08, 0x19, 0x08, 0x88, 0x00, 0x08, 0x18, 0x09, 0x29, 0x2a, 0x2a, 0xb9, 0x92, 0x20,
+0x9b, 0xb3, 0x93, 0x3a, 0x2b, 0x19, 0xa9, 0x31, 0x19, 0x3b, 0x3a, 0x3c, 0x19, 0xb0, 0xb4, 0xd4,
+0x93, 0xa1, 0x28, 0x28, 0x2d, 0x29, 0x2b, 0x39, 0x9a, 0x10, 0xd3, 0x91, 0xa5, 0x99, 0x95, 0xc0,
+0x13, 0xf8, 0x41, 0xf1, 0xef, 0x18, 0x23, 0x81, 0x09, 0x00, 0x88, 0x00, 0x90, 0x08, 0x81, 0x99,
+0x13, 0xba, 0x51, 0xd1, 0x2a, 0x87, 0xdf, 0x89, 0x88, 0x41, 0x24, 0x98, 0x08, 0x91, 0x08, 0x00,
+0x98, 0x01, 0x98, 0x00, 0xb2, 0x80, 0x93, 0x99, 0x11, 0xc0, 0xb3, 0xa5, 0x91, 0x30, 0xa9, 0x19,
+0x13, 0x9d, 0x43, 0xdb, 0x78, 0xf1, 0xcf, 0x19, 0x91, 0x08, 0x81, 0x8a, 0x73, 0x05, 0x88, 0x00,
+0x88, 0x00, 0x08, 0x09, 0x00, 0x98, 0x01, 0x88, 0x28, 0xa0, 0x3a, 0x12, 0x0f, 0x41, 0xbb, 0x79,
+0xc2, 0xff, 0x09, 0x00, 0x98, 0x51, 0x14, 0xca, 0x1a, 0x24, 0x90, 0x19, 0x80, 0x88, 0x01, 0x89,
+0x00, 0x90, 0x18, 0x00, 0x8a, 0x93, 0xb0, 0x22, 0x99, 0x4a, 0xb2, 0x99, 0xa6, 0xb0, 0x13, 0xb9,
+0x30, 0xc3, 0xa0, 0x97, 0x98, 0x12, 0xd0, 0x02, 0xb2, 0x3a, 0x93, 0xac, 0x86, 0xc8, 0x03, 0xb1,
+0x29, 0xb3, 0x1f, 0x11, 0xba, 0x14, 0xb9, 0x69, 0xc1, 0x39, 0x02, 0x0f, 0x22, 0xbb, 0x43, 0xf1,
+0x29, 0xb4, 0x2c, 0x04, 0xad, 0x35, 0xfa, 0x0d, 0x13, 0xca, 0x09, 0x00, 0x52, 0xb1, 0x9e, 0x42,
+0x01, 0x88, 0x81, 0x88, 0x00, 0x88, 0x18, 0x88, 0x18, 0x90, 0x08, 0x92, 0x1a, 0x10, 0xb8, 0x31,
+0xa9, 0x02, 0xc4, 0x01, 0x81, 0x1b, 0x01, 0xb1, 0x93, 0xb1, 0x93, 0x91, 0x00, 0xa9, 0x95, 0xe2,
+0x01, 0x91, 0x3b, 0x93, 0x0e, 0x32, 0xad, 0x71, 0xb9, 0x7a, 0xd4, 0xaf, 0x41, 0x82, 0x0a, 0x02,
+0x9a, 0x32, 0xfa, 0x0d, 0x14, 0xdb, 0x28, 0x04, 0xaa, 0x40, 0x82, 0x0a, 0x11, 0xdb, 0x8a, 0x80,
+0x28, 0x27, 0xa0, 0xbb, 0x1a, 0x35, 0x82, 0x09, 0x00, 0x88, 0x00, 0x98, 0x11, 0xc0, 0x48, 0xd2,
+0xdf, 0x19, 0x80, 0x08, 0x00, 0x89, 0x00, 0x80, 0x08, 0x80, 0x88, 0x01, 0x89, 0x38, 0x89, 0x09,
+0x92, 0x9a, 0xa3, 0xb5, 0x01, 0x29, 0x2b, 0x19, 0x0a, 0xb3, 0xc3, 0x83, 0xb1, 0x91, 0xa5, 0x98,
+0x51, 0x2c, 0x5b, 0x09, 0x3a, 0x90, 0x0b, 0x43, 0x9c, 0x22, 0xf0, 0x10, 0xb2, 0x2a, 0xa5, 0xba,
+0x17, 0xba, 0x70, 0xb0, 0x2a, 0x97, 0x9c, 0x76, 0x91, 0xab, 0x18, 0x91, 0x09, 0x11, 0xa9, 0x30,
+0xb2, 0x0f, 0x56, 0xa0, 0x1b, 0x44, 0xb8, 0xac, 0x20, 0x33, 0x92, 0x09, 0x10, 0xa8, 0x01, 0xa1,
+0x08, 0x82, 0x1b, 0x30, 0x0c, 0x5a, 0x89, 0x29, 0x00, 0x3d, 0x18, 0x8a, 0x31, 0x8b, 0x5b, 0x99,
+0x19, 0x13, 0x1b, 0x59, 0x0b, 0x29, 0xe3, 0x91, 0x92, 0xb1, 0xa7, 0xa2, 0x91, 0xb2, 0xb3, 0xc2,
+0xa3, 0xb3, 0x00, 0x31, 0x0b, 0x5a, 0x3a, 0x2c, 0x98, 0xb1, 0xa3, 0x11, 0x19, 0xb1, 0xa3, 0x93,
+0x90, 0x29, 0x3b, 0x3b, 0x90, 0x90, 0x3a, 0x2a, 0xb1, 0xa3, 0x01, 0x90, 0xb2, 0x92, 0x91, 0x90,
+0x11, 0x3a, 0x3b, 0x2a, 0x99, 0xa1, 0xb3, 0x01, 0x01, 0x90, 0x10, 0x01, 0x10, 0x3b, 0x1a, 0x00,
+0x90, 0x91, 0xb3, 0x01, 0x3a, 0x00, 0x19, 0x5b, 0x0a, 0xa0, 0x03, 0x90, 0x11, 0x19, 0x4b, 0x2b,
+0x1b, 0x11, 0x19, 0x29, 0x1b, 0x09, 0x11, 0x90, 0x3a, 0x4b, 0x2b, 0x99, 0x10, 0x4b, 0x2b, 0x0b,
+0x92, 0xb2, 0x11, 0x3a, 0x3b, 0x3c, 0x3a, 0xa0, 0xa3, 0x01, 0x10, 0x11, 0x1b, 0x3a, 0x19, 0x2a,
+0x3b, 0x19, 0x19, 0x3b, 0x4b, 0x1a, 0x2b, 0x29, 0xa9, 0xb2, 0x92, 0x10, 0x1a, 0x10, 0x91, 0xa1,
+0x11, 0x91, 0x09, 0x20, 0xb9, 0xb3, 0xb4, 0x11, 0x19, 0x09, 0x00, 0x19, 0x00, 0x19, 0x19, 0xb0,
+0xa5, 0x92, 0x19, 0x10, 0x01, 0x09, 0x19, 0x19, 0xa1, 0xc3, 0x93, 0x91, 0x19, 0x11, 0x90, 0xa1,
+0x01, 0x30, 0x3b, 0x2c, 0xb0, 0xb3, 0x49, 0x1a, 0x9a, 0xb3, 0xb3, 0x11, 0x10, 0x19, 0x90, 0xa1,
+0x11, 0x19, 0x01, 0xa1, 0x91, 0x02, 0x99, 0x3a, 0x3a, 0x9a, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x19,
+0x2b, 0x19, 0x90, 0xb1, 0xb5, 0xa2, 0x00, 0x01, 0x91, 0x09, 0x31, 0x0b, 0x90, 0x92, 0x1b, 0xa2,
+0xb4, 0xb2, 0x10, 0x91, 0xb2, 0xb2, 0xb3, 0xb3, 0x11, 0x10, 0x3b, 0x29, 0x0b, 0x91, 0x91, 0x39,
+0x3b, 0x9a, 0xc5, 0x93, 0x18, 0x09, 0xc3, 0xb3, 0x12, 0x4b, 0x1b, 0xb1, 0xb5, 0x92, 0x90, 0xa1,
+0x01, 0x11, 0x19, 0x09, 0xb1, 0x93, 0x10, 0x19, 0x19, 0x19, 0x1a, 0xa2, 0xc3, 0xa3, 0xb3, 0x91,
+0x93, 0x90, 0x10, 0x1a, 0x19, 0x91, 0x02, 0x99, 0x2a, 0x91, 0xc2, 0x93, 0x90, 0x09, 0x93, 0xa1,
+0x29, 0x3a, 0x3b, 0x5d, 0x3b, 0x0a, 0x91, 0xa2, 0x92, 0x90, 0x00, 0x01, 0x90, 0x91, 0x00, 0x91,
+0xa1, 0x11, 0x00, 0x10, 0x29, 0x9b, 0xa3, 0xb3, 0x10, 0x30, 0x3d, 0x4c, 0x2b, 0x2a, 0x90, 0x90,
+0x39, 0x2b, 0x19, 0x00, 0x99, 0x91, 0x92, 0x90, 0x19, 0x20, 0x0a, 0xb1, 0xa3, 0x30, 0x4c, 0x1b,
+0xb1, 0xa5, 0x91, 0x91, 0x19, 0x39, 0x1a, 0x19, 0x4b, 0x4b, 0x3c, 0x3b, 0x1b, 0x99, 0x01, 0x19,
+0x90, 0xb2, 0x02, 0x3b, 0x3b, 0x19, 0x1a, 0x91, 0xb3, 0x01, 0x91, 0xb2, 0x10, 0x30, 0x0b, 0x19,
+0x20, 0x3d, 0x4b, 0x0a, 0x29, 0x3b, 0x1a, 0x39, 0x3d, 0x4b, 0x1b, 0x88, 0x11, 0x5b, 0x3b, 0x2b,
+0x2b, 0xb1, 0xb3, 0x21, 0x1a, 0x91, 0x00, 0x3a, 0x3a, 0xb0, 0xb2, 0x93, 0xb2, 0xa2, 0x01, 0x19,
+0x10, 0x99, 0x01, 0xa1, 0x91, 0xa3, 0xa2, 0x91, 0xb2, 0x92, 0xa1, 0x92, 0x01, 0xb1, 0xa2, 0x11,
+0x91, 0xd2, 0xb3, 0x03, 0x2b, 0x1b, 0x01, 0x19, 0x3b, 0x10, 0x09, 0x39, 0x3b, 0x1b, 0x09, 0x90,
+0xa3, 0x01, 0x19, 0xb1, 0x02, 0x91, 0x19, 0x20, 0x1b, 0x3a, 0x19, 0x3b, 0x3a, 0x1a, 0x39, 0x1b,
+0x19, 0x90, 0x91, 0x11, 0x19, 0x3b, 0x3a, 0x1b, 0x91, 0x11, 0x09, 0x00, 0x91, 0xb1, 0xb4, 0xc4,
+0xb3, 0xd3, 0xb4, 0x92, 0x81, 0x18, 0x3a, 0x90, 0xb0, 0xa3, 0xa4, 0xa1, 0x01, 0x4a, 0x4b, 0x1b,
+0x19, 0x11, 0x3b, 0x3b, 0x09, 0x19, 0x19, 0x19, 0x91, 0x01, 0x09, 0x29, 0x3a, 0x3c, 0x5b, 0x1a,
+0x3a, 0x2a, 0x1b, 0x3a, 0x1a, 0x91, 0x02, 0x19, 0x3b, 0x5d, 0x3b, 0x1a, 0x09, 0x08, 0x5a, 0x2b,
+0x3b, 0x2a, 0x1b, 0x2a, 0x91, 0x00, 0x01, 0x91, 0x09, 0x99, 0xb3, 0x93, 0x10, 0x99, 0xa1, 0x01,
+0x30, 0x0a, 0x99, 0x21, 0x09, 0xb1, 0xc4, 0xa3, 0xa2, 0x93, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xa3,
+0xa2, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0xa2, 0x01, 0x99, 0xb3, 0xa3,
+0xa1, 0xb3, 0xb4, 0xd3, 0x02, 0x5b, 0x1b, 0xa0, 0xc3, 0xa3, 0xb3, 0xb3, 0x93, 0x29, 0x3b, 0x1b,
+0x19, 0x19, 0x10, 0x3a, 0x2b, 0x09, 0xb2, 0xa0, 0x03, 0x01, 0x2a, 0xa0, 0xb3, 0x02, 0x29, 0x3c,
+0x4c, 0x1a, 0x09, 0xa1, 0xb3, 0xa2, 0x10, 0x09, 0x11, 0x90, 0x19, 0x01, 0xa9, 0x11, 0xa2, 0x01,
+0x10, 0xb1, 0xb3, 0x93, 0x3b, 0x3b, 0x1a, 0x00, 0x91, 0xb3, 0xb3, 0x01, 0x39, 0x3b, 0x1b, 0x29,
+0x19, 0x09, 0x90, 0x19, 0x90, 0xb3, 0x20, 0x4b, 0x1b, 0x09, 0xa1, 0x11, 0x01, 0x99, 0x91, 0xc3,
+0xb3, 0x95, 0x29, 0x4b, 0x89, 0x91, 0x11, 0x4b, 0x3c, 0x3a, 0x2a, 0x3a, 0x3b, 0x29, 0x2d, 0x3a,
+0x99, 0x91, 0xa3, 0xa0, 0x21, 0x00, 0x09, 0x19, 0x3a, 0x3a, 0x0b, 0xb3, 0xc5, 0x92, 0x82, 0x09,
+0x19, 0xa1, 0x02, 0x39, 0x1d, 0x10, 0x29, 0x1b, 0x99, 0x01, 0x91, 0x92, 0x19, 0x4b, 0x1b, 0x91,
+0x11, 0x1b, 0x91, 0xb3, 0x91, 0x11, 0x19, 0x19, 0xa0, 0xb3, 0xa2, 0x31, 0x2b, 0x1b, 0x91, 0xb2,
+0x92, 0x91, 0xb1, 0x93, 0x39, 0x1b, 0x90, 0x39, 0x19, 0x19, 0x3b, 0x3c, 0x6b, 0x3b, 0x1b, 0x88,
+0x92, 0x91, 0xa1, 0x11, 0x10, 0x09, 0x19, 0x00, 0xa1, 0x01, 0x11, 0x3b, 0x19, 0x91, 0x29, 0x3c,
+0x3a, 0x2b, 0x5b, 0x3b, 0x1b, 0x09, 0x11, 0x1a, 0x99, 0xb3, 0x13, 0x3b, 0x3c, 0x3a, 0x1a, 0x19,
+0x01, 0x99, 0x91, 0x92, 0x3a, 0x4b, 0x3d, 0x3a, 0x2a, 0x3c, 0x2a, 0x1a, 0x01, 0x19, 0x4b, 0x0a,
+0x2a, 0x39, 0x1b, 0x3b, 0x39, 0x2b, 0x99, 0x90, 0x91, 0x01, 0x19, 0x91, 0xb2, 0x91, 0x19, 0x92,
+0x99, 0x39, 0x1a, 0x3b, 0x29, 0xb9, 0x93, 0x92, 0x2a, 0x2b, 0x3a, 0x19, 0x1a, 0x3a, 0x3b, 0x3b,
+0x90, 0xa0, 0x03, 0xa1, 0x90, 0x31, 0x3b, 0x1b, 0x10, 0x3b, 0x1a, 0x11, 0x3a, 0x2a, 0x9a, 0x91,
+0x11, 0x10, 0xb1, 0xb2, 0x93, 0xa1, 0x92, 0x20, 0x3b, 0x3e, 0x3a, 0x0a, 0xa0, 0xb4, 0xd4, 0xa3,
+0xa2, 0xa2, 0x91, 0x1a, 0xa2, 0xb3, 0x91, 0x11, 0x19, 0x19, 0x90, 0x19, 0x3a, 0x5b, 0x2b, 0x2b,
+0xb1, 0xb3, 0x93, 0x00, 0xa0, 0x01, 0x11, 0xa0, 0x91, 0x92, 0x01, 0xa1, 0xb2, 0x21, 0x3b, 0x3b,
+0x3b, 0x99, 0x19, 0x91, 0xb1, 0x93, 0x90, 0x91, 0x92, 0x90, 0x10, 0x5b, 0x2b, 0x1a, 0x19, 0x3b,
+0x2a, 0xb1, 0xb3, 0x03, 0xb0, 0xa2, 0xb3, 0x91, 0xb4, 0xb2, 0x30, 0x1a, 0x09, 0x90, 0x90, 0x11,
+0x01, 0x5b, 0x3b, 0x3c, 0x2a, 0x3b, 0x11, 0x90, 0x3a, 0x00, 0xa9, 0x02, 0x10, 0x3a, 0x99, 0xa1,
+0x31, 0x4c, 0x3c, 0x2a, 0x2b, 0x18, 0x91, 0x19, 0x29, 0x99, 0x00, 0x20, 0x1b, 0x99, 0xb3, 0xb3,
+0x92, 0x19, 0xa1, 0xb3, 0xa3, 0x01, 0x39, 0x1b, 0xa1, 0xa3, 0x39, 0x3b, 0x3b, 0x1a, 0x99, 0x01,
+0xa2, 0x91, 0x01, 0x00, 0x91, 0x91, 0x29, 0x99, 0xa1, 0xa3, 0x91, 0x91, 0xa2, 0x00, 0x21, 0x2a,
+0x3c, 0x4b, 0x2a, 0x1b, 0x91, 0x91, 0x91, 0xe3, 0xa3, 0xa3, 0x00, 0x29, 0x2b, 0x1b, 0x20, 0x19,
+0x3b, 0x1a, 0x00, 0x10, 0x2a, 0x3b, 0x19, 0x00, 0x09, 0xa1, 0xa3, 0xa2, 0xb2, 0x92, 0x01, 0xa9,
+0x93, 0x91, 0xb1, 0xb5, 0x92, 0x49, 0x3b, 0x0b, 0x99, 0x92, 0xb1, 0xb3, 0x93, 0x39, 0x3c, 0x2a,
+0x19, 0x2a, 0x09, 0xb1, 0xb3, 0xb5, 0x81, 0x00, 0xb2, 0x91, 0x92, 0x90, 0x00, 0x00, 0x00, 0x09,
+0x10, 0x00, 0x19, 0x29, 0x1b, 0x01, 0xa1, 0x01, 0x01, 0x91, 0x19, 0x3a, 0x19, 0x09, 0x90, 0xb2,
+0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0xb2, 0x91, 0x30, 0x3b, 0x2b, 0x3b, 0x0a, 0xc3, 0xc4, 0xa3,
+0x92, 0x90, 0x92, 0x09, 0x30, 0x2b, 0x3b, 0x3b, 0x1b, 0x91, 0x91, 0x21, 0x1a, 0x1b, 0x02, 0x90,
+0x19, 0x29, 0x3b, 0x3b, 0x1a, 0x01, 0x91, 0x1a, 0x19, 0x11, 0x19, 0xa9, 0xb3, 0xb5, 0xa2, 0x00,
+0xa3, 0xb2, 0xb3, 0x91, 0x91, 0xa2, 0xb3, 0x91, 0x91, 0x01, 0x19, 0x19, 0x91, 0x39, 0x3d, 0x3b,
+0x08, 0x00, 0x99, 0x91, 0x11, 0x3a, 0x4c, 0x2b, 0x3b, 0x0b, 0x90, 0x92, 0xb1, 0xb3, 0xa4, 0x30,
+0x3d, 0x4d, 0x2a, 0x99, 0xa1, 0xa3, 0xa1, 0x39, 0x3b, 0x3b, 0xa9, 0xa3, 0xc3, 0xa2, 0x33, 0x1b,
+0x1a, 0x11, 0x3a, 0x3c, 0x29, 0x09, 0x99, 0xc3, 0xb3, 0x31, 0x90, 0x91, 0x29, 0x3b, 0x09, 0x99,
+0x91, 0xc3, 0xa3, 0x92, 0x09, 0x92, 0xb1, 0xa2, 0xa3, 0x20, 0x3b, 0x3b, 0x99, 0xb1, 0x93, 0x10,
+0x19, 0x09, 0x19, 0x19, 0x01, 0x99, 0x91, 0x91, 0x91, 0xa1, 0x93, 0x11, 0x2a, 0xb9, 0xb3, 0xb4,
+0xa2, 0x01, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x2b, 0x1b, 0x91, 0x91, 0x92, 0x19, 0x3a, 0x09, 0x90,
+0xb1, 0xb3, 0xa4, 0x91, 0x3b, 0x19, 0x09, 0x10, 0xa9, 0xa3, 0x93, 0x10, 0x3b, 0x3b, 0xb9, 0xb3,
+0x93, 0x19, 0x30, 0x3d, 0x3b, 0xb0, 0x00, 0x3a, 0x09, 0x3a, 0x3b, 0x19, 0xa0, 0xa2, 0x21, 0x2b,
+0x99, 0xb3, 0xa2, 0x20, 0x3b, 0x99, 0xa1, 0x92, 0x91, 0xa1, 0x91, 0x92, 0x00, 0x00, 0x00, 0x29,
+0x3b, 0x1b, 0x91, 0x11, 0x2a, 0x09, 0x10, 0x29, 0x1b, 0x99, 0x92, 0xa1, 0xb3, 0xb2, 0x11, 0x11,
+0x19, 0x19, 0x99, 0x01, 0x10, 0x19, 0x1a, 0xa1, 0x93, 0x91, 0x00, 0x01, 0x99, 0x91, 0x91, 0xb3,
+0xb3, 0xa1, 0xb3, 0xb5, 0x81, 0x91, 0x09, 0x39, 0x3b, 0x1b, 0x19, 0x11, 0x3b, 0x3c, 0x98, 0x90,
+0x91, 0xb3, 0xc5, 0xa2, 0x93, 0x00, 0x1b, 0x01, 0x39, 0x3d, 0x1a, 0xb1, 0xb3, 0xb2, 0xb3, 0xb3,
+0x11, 0x91, 0xa1, 0x93, 0x3b, 0x5b, 0x2b
+};
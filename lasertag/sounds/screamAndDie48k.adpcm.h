@@ -0,0 +1,5 @@
+// This file was generated by executing this statement: wav2adpcm screamAndDie48k.wav.c
+#include <stdint.h>
+extern const uint8_t screamAndDie48k_adpcm[];
+#define SCREAMANDDIE48K_ADPCM_SAMPLE_RATE 48000
+#define SCREAMANDDIE48K_ADPCM_NUMBER_OF_SAMPLES 86158
@@ -0,0 +1,180 @@
+
+#include "stageProfiler.h"
+#include <stdio.h>
+
+// Histogram buckets are log-linear: values below 4 get their own bucket, and
+// every power of two above that is split into 4 equal sub-buckets. That keeps
+// the p99 error under 25% over the full 32-bit range in 124 buckets.
+#define SUB_BUCKET_BITS 2
+#define SUB_BUCKET_COUNT (1 << SUB_BUCKET_BITS)
+#define BUCKET_COUNT ((32 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT)
+#define PERCENTILE_99 0.99
+#define RESET 0
+
+// PMU control values for the Cortex-A9.
+#define PMU_PMCR_ENABLE_AND_RESET_CYCLES 0x5 // E (enable) and C (reset cycles).
+#define PMU_PMCNTENSET_CYCLE_COUNTER 0x80000000 // Enable the cycle counter.
+
+typedef struct {
+  uint32_t count;
+  stageProfiler_cycles_t min;
+  stageProfiler_cycles_t max;
+  uint64_t sum;
+  uint32_t buckets[BUCKET_COUNT];
+} stageStats_t;
+
+static stageStats_t stageStats[stageProfiler_stageCount_e];
+
+static const char *stageNames[stageProfiler_stageCount_e] = {
+    "adcDequeue", "fir",        "iirBank",        "power",
+    "decision",   "soundPump",  "isrTotal",       "isrAdc",
+    "isrLockout", "isrTrigger", "isrTransmitter", "isrHitLed",
+    "isrSound"};
+
+// Returns the bucket for a cycle count.
+static uint16_t bucketIndex(stageProfiler_cycles_t cycles) {
+  if (cycles < SUB_BUCKET_COUNT)
+    return cycles;
+  uint16_t msb = 31 - __builtin_clz(cycles);
+  uint16_t subBucket =
+      (cycles >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1);
+  return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT + subBucket;
+}
+
+// Returns the largest cycle count that falls into a bucket.
+static stageProfiler_cycles_t bucketUpperBound(uint16_t index) {
+  if (index < SUB_BUCKET_COUNT)
+    return index;
+  uint16_t msb = index / SUB_BUCKET_COUNT + SUB_BUCKET_BITS - 1;
+  uint16_t subBucket = index % SUB_BUCKET_COUNT;
+  uint64_t lower = (uint64_t)(SUB_BUCKET_COUNT + subBucket)
+                   << (msb - SUB_BUCKET_BITS);
+  return lower + ((uint64_t)1 << (msb - SUB_BUCKET_BITS)) - 1;
+}
+
+// Enables the cycle counter and clears all statistics.
+void stageProfiler_init() {
+#if defined(__arm__)
+  __asm__ volatile("mcr p15, 0, %0, c9, c12, 0" ::"r"(
+      PMU_PMCR_ENABLE_AND_RESET_CYCLES));
+  __asm__ volatile("mcr p15, 0, %0, c9, c12, 1" ::"r"(
+      PMU_PMCNTENSET_CYCLE_COUNTER));
+#endif
+  stageProfiler_reset();
+}
+
+// Clears all statistics. Must not run while isr_function() can record.
+void stageProfiler_reset() {
+  for (uint16_t i = 0; i < stageProfiler_stageCount_e; i++) {
+    stageStats[i].count = RESET;
+    stageStats[i].min = UINT32_MAX;
+    stageStats[i].max = RESET;
+    stageStats[i].sum = RESET;
+    for (uint16_t j = 0; j < BUCKET_COUNT; j++)
+      stageStats[i].buckets[j] = RESET;
+  }
+}
+
+// Records one measurement for a stage.
+void stageProfiler_record(stageProfiler_stage_t stage,
+                          stageProfiler_cycles_t cycles) {
+  stageStats_t *stats = &stageStats[stage];
+  stats->count++;
+  stats->sum += cycles;
+  if (cycles < stats->min)
+    stats->min = cycles;
+  if (cycles > stats->max)
+    stats->max = cycles;
+  stats->buckets[bucketIndex(cycles)]++;
+}
+
+// Computes the summary for a stage.
+void stageProfiler_getSummary(stageProfiler_stage_t stage,
+                              stageProfiler_summary_t *summary) {
+  const stageStats_t *stats = &stageStats[stage];
+  summary->count = stats->count;
+  if (stats->count == 0) { // Nothing recorded, report all zeros.
+    summary->min = RESET;
+    summary->max = RESET;
+    summary->mean = RESET;
+    summary->p99 = RESET;
+    return;
+  }
+  summary->min = stats->min;
+  summary->max = stats->max;
+  summary->mean = (double)stats->sum / stats->count;
+  // Walk the histogram until 99% of the samples are accounted for.
+  uint32_t target = (uint32_t)(stats->count * PERCENTILE_99);
+  uint32_t cumulative = 0;
+  summary->p99 = stats->max;
+  for (uint16_t i = 0; i < BUCKET_COUNT; i++) {
+    cumulative += stats->buckets[i];
+    if (cumulative > target || cumulative == stats->count) {
+      stageProfiler_cycles_t upper = bucketUpperBound(i);
+      summary->p99 = (upper < stats->max) ? upper : stats->max;
+      break;
+    }
+  }
+}
+
+// Returns a short printable name for a stage.
+const char *stageProfiler_getStageName(stageProfiler_stage_t stage) {
+  return stageNames[stage];
+}
+
+// Prints count/min/mean/max/p99 for every stage that has recorded something.
+void stageProfiler_printReport() {
+  printf("Stage profile (cycles):\n");
+  printf("%-15s %10s %8s %10s %8s %8s\n", "stage", "count", "min", "mean",
+         "max", "p99");
+  for (uint16_t i = 0; i < stageProfiler_stageCount_e; i++) {
+    stageProfiler_summary_t summary;
+    stageProfiler_getSummary(i, &summary);
+    if (summary.count == 0) // Skip stages that were never instrumented.
+      continue;
+    printf("%-15s %10lu %8lu %10.1f %8lu %8lu\n", stageNames[i],
+           (unsigned long)summary.count, (unsigned long)summary.min,
+           summary.mean, (unsigned long)summary.max,
+           (unsigned long)summary.p99);
+  }
+}
+
+// Checks the statistics with known values. Returns true if it passes.
+#define TEST_SAMPLE_COUNT 1000
+#define TEST_OUTLIER_CYCLES 100000
+bool stageProfiler_runTest() {
+  bool success = true;
+  printf("****************** stageProfiler_runTest() ******************\n");
+  stageProfiler_reset();
+  // 1..1000 cycles plus a single outlier.
+  for (uint32_t i = 1; i <= TEST_SAMPLE_COUNT; i++)
+    stageProfiler_record(stageProfiler_fir_e, i);
+  stageProfiler_record(stageProfiler_fir_e, TEST_OUTLIER_CYCLES);
+  stageProfiler_summary_t summary;
+  stageProfiler_getSummary(stageProfiler_fir_e, &summary);
+  if (summary.count != TEST_SAMPLE_COUNT + 1 || summary.min != 1 ||
+      summary.max != TEST_OUTLIER_CYCLES) {
+    printf("stageProfiler_runTest(): wrong count/min/max.\n");
+    success = false;
+  }
+  // The exact 99th percentile is 991; the histogram may overestimate by 25%.
+  if (summary.p99 < 991 || summary.p99 > 991 * 5 / 4) {
+    printf("stageProfiler_runTest(): p99 (%lu) out of range.\n",
+           (unsigned long)summary.p99);
+    success = false;
+  }
+  // Every bucket must contain the values that map to it.
+  for (stageProfiler_cycles_t cycles = 1; cycles < TEST_OUTLIER_CYCLES;
+       cycles = cycles * 3 + 1) {
+    if (bucketUpperBound(bucketIndex(cycles)) < cycles) {
+      printf("stageProfiler_runTest(): bucket bound wrong for %lu.\n",
+             (unsigned long)cycles);
+      success = false;
+    }
+  }
+  stageProfiler_printReport();
+  stageProfiler_reset();
+  printf(success ? "stageProfiler_runTest() passed.\n"
+                 : "stageProfiler_runTest() failed.\n");
+  return success;
+}
@@ -0,0 +1,110 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef STAGEPROFILER_H_
+#define STAGEPROFILER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The stage profiler records the cycle count of each stage of the detector
+// and of each task called from isr_function(). Each stage keeps a count,
+// min, max, sum and a log-linear histogram so that mean and 99th percentile
+// can be reported alongside the coarse interval-timer statistics.
+
+// Uncomment to compile the STAGE_PROFILER_BEGIN/END markers into the detector
+// and the ISR. When commented out, the markers compile to nothing and cost
+// nothing. Can also be set from the build with -DSTAGE_PROFILER_ENABLED.
+// #define STAGE_PROFILER_ENABLED
+
+// Stages that are measured.
+typedef enum {
+  stageProfiler_adcDequeue_e,      // Pop and scale ADC buffer values.
+  stageProfiler_fir_e,             // Decimating FIR filter.
+  stageProfiler_iirBank_e,         // All IIR filters.
+  stageProfiler_power_e,           // All power computations.
+  stageProfiler_decision_e,        // Sort and hit decision.
+  stageProfiler_soundPump_e,       // sound_pump() FIFO refill (main loop).
+  stageProfiler_isrTotal_e,        // Entire isr_function().
+  stageProfiler_isrAdc_e,          // ADC read and buffer write.
+  stageProfiler_isrLockoutTimer_e, // lockoutTimer_tick().
+  stageProfiler_isrTrigger_e,      // trigger_tick().
+  stageProfiler_isrTransmitter_e,  // transmitter_tick().
+  stageProfiler_isrHitLedTimer_e,  // hitLedTimer_tick().
+  stageProfiler_isrSound_e,        // sound_tick().
+  stageProfiler_stageCount_e       // Number of stages, keep this last.
+} stageProfiler_stage_t;
+
+typedef uint32_t stageProfiler_cycles_t;
+
+// Summary of a single stage.
+typedef struct {
+  uint32_t count;             // Number of recorded samples.
+  stageProfiler_cycles_t min; // Fewest cycles seen.
+  stageProfiler_cycles_t max; // Most cycles seen.
+  double mean;                // Mean cycles.
+  stageProfiler_cycles_t p99; // 99% of samples took at most this many cycles.
+} stageProfiler_summary_t;
+
+// Reads the free-running cycle counter. On the ZYBO this is the Cortex-A9
+// PMU cycle counter (CPU clock). On host builds it is the time-stamp counter.
+static inline stageProfiler_cycles_t stageProfiler_readCycleCounter() {
+#if defined(__arm__)
+  uint32_t cycles;
+  __asm__ volatile("mrc p15, 0, %0, c9, c13, 0" : "=r"(cycles));
+  return cycles;
+#elif defined(__x86_64__) || defined(__i386__)
+  uint32_t low, high;
+  __asm__ volatile("rdtsc" : "=a"(low), "=d"(high));
+  return low;
+#else
+  return 0;
+#endif
+}
+
+#ifdef STAGE_PROFILER_ENABLED
+// Marks the start of a stage. Must be paired with STAGE_PROFILER_END() in the
+// same scope.
+#define STAGE_PROFILER_BEGIN(stage)                                            \
+  stageProfiler_cycles_t stage##_begin = stageProfiler_readCycleCounter()
+// Marks the end of a stage and records the elapsed cycles.
+#define STAGE_PROFILER_END(stage)                                              \
+  stageProfiler_record(stage, stageProfiler_readCycleCounter() - stage##_begin)
+#else
+#define STAGE_PROFILER_BEGIN(stage)
+#define STAGE_PROFILER_END(stage)
+#endif
+
+// Enables the cycle counter and clears all statistics. Call it with
+// interrupts disabled, as for stageProfiler_reset().
+void stageProfiler_init();
+
+// Clears all statistics. isr_function() records into the same statistics, so
+// call it with interrupts disabled, e.g. before interrupts_enableArmInts().
+void stageProfiler_reset();
+
+// Records one measurement for a stage. Each stage must only be recorded from
+// one context (either the ISR or the main loop).
+void stageProfiler_record(stageProfiler_stage_t stage,
+                          stageProfiler_cycles_t cycles);
+
+// Computes the summary for a stage.
+void stageProfiler_getSummary(stageProfiler_stage_t stage,
+                              stageProfiler_summary_t *summary);
+
+// Returns a short printable name for a stage.
+const char *stageProfiler_getStageName(stageProfiler_stage_t stage);
+
+// Prints count/min/mean/max/p99 for every stage that has recorded something.
+void stageProfiler_printReport();
+
+// Checks the statistics with known values. Returns true if it passes.
+bool stageProfiler_runTest();
+
+#endif /* STAGEPROFILER_H_ */
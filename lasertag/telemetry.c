@@ -0,0 +1,476 @@
+
+#include "telemetry.h"
+#include "bluetooth/bluetooth.h"
+#include "isr.h"
+#include "overload.h"
+#include "trigger.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define RESET 0
+#define TELEMETRY_HEADER_SIZE 2 // Type and sequence.
+#define TELEMETRY_CRC_SIZE 2
+#define TELEMETRY_CRC_INITIAL 0xFFFF
+#define TELEMETRY_CRC_POLYNOMIAL 0x1021 // CRC-16/CCITT.
+#define TELEMETRY_FRAME_DELIMITER 0x00
+#define TELEMETRY_COBS_MAX_RUN 0xFF // Code for 254 data bytes and no zero.
+#define TELEMETRY_VARINT_MORE 0x80
+#define TELEMETRY_VARINT_BITS 7
+#define TELEMETRY_VARINT_MASK 0x7F
+#define TELEMETRY_POWER_STEPS_PER_OCTAVE 256.0
+
+// Sender state.
+static uint8_t sequence;
+static uint8_t lives;
+static uint32_t droppedFrameCount;
+static uint32_t powerSnapshotCount; // Snapshots sent, for keyframe spacing.
+static int32_t powerBase[FILTER_FREQUENCY_COUNT]; // Last powers sent.
+
+// While telemetry_runTest() runs, frames are captured here instead of being
+// queued for the UART.
+static uint8_t *testCapture;
+static uint16_t testCaptureLength;
+static uint16_t testCaptureSize;
+
+/*********************** Encoding helpers ****************************/
+
+// Updates a CRC-16/CCITT with a block of bytes.
+static uint16_t telemetry_crc16(const uint8_t data[], uint16_t length) {
+  uint16_t crc = TELEMETRY_CRC_INITIAL;
+  for (uint16_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ TELEMETRY_CRC_POLYNOMIAL : crc << 1;
+  }
+  return crc;
+}
+
+// Appends an unsigned LEB128 varint. Returns the new length.
+static uint16_t telemetry_putVarint(uint8_t payload[], uint16_t length,
+                                    uint64_t value) {
+  while (value > TELEMETRY_VARINT_MASK) {
+    payload[length++] = (value & TELEMETRY_VARINT_MASK) | TELEMETRY_VARINT_MORE;
+    value >>= TELEMETRY_VARINT_BITS;
+  }
+  payload[length++] = value;
+  return length;
+}
+
+// Reads an unsigned LEB128 varint. Returns false if it runs off the end.
+static bool telemetry_getVarint(const uint8_t payload[], uint16_t length,
+                                uint16_t *index, uint64_t *value) {
+  *value = 0;
+  for (uint8_t shift = 0; *index < length && shift < 64;
+       shift += TELEMETRY_VARINT_BITS) {
+    uint8_t byte = payload[(*index)++];
+    *value |= (uint64_t)(byte & TELEMETRY_VARINT_MASK) << shift;
+    if (!(byte & TELEMETRY_VARINT_MORE))
+      return true;
+  }
+  return false;
+}
+
+// Zigzag maps small signed values to small unsigned values.
+static uint32_t telemetry_zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t telemetry_unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Power as log2(1 + power) in 1/256 octave steps.
+static int32_t telemetry_quantizePower(double power) {
+  if (!(power > 0.0)) // Also catches NaN.
+    return 0;
+  return lround(log2(1.0 + power) * TELEMETRY_POWER_STEPS_PER_OCTAVE);
+}
+
+static double telemetry_dequantizePower(int32_t quantized) {
+  return exp2(quantized / TELEMETRY_POWER_STEPS_PER_OCTAVE) - 1.0;
+}
+
+// COBS-encodes length bytes and appends the delimiter. Returns the encoded
+// length.
+static uint16_t telemetry_cobsEncode(const uint8_t data[], uint16_t length,
+                                     uint8_t frame[]) {
+  uint16_t codeIndex = 0, out = 1;
+  uint8_t code = 1;
+  for (uint16_t i = 0; i < length; i++) {
+    if (data[i] == TELEMETRY_FRAME_DELIMITER) {
+      frame[codeIndex] = code;
+      codeIndex = out++;
+      code = 1;
+      continue;
+    }
+    frame[out++] = data[i];
+    if (++code == TELEMETRY_COBS_MAX_RUN) {
+      frame[codeIndex] = code;
+      codeIndex = out++;
+      code = 1;
+    }
+  }
+  frame[codeIndex] = code;
+  frame[out++] = TELEMETRY_FRAME_DELIMITER;
+  return out;
+}
+
+// Decodes a COBS frame without its delimiter, in place. Returns the decoded
+// length, or -1 if the frame is malformed.
+static int32_t telemetry_cobsDecode(uint8_t frame[], uint16_t length) {
+  uint16_t in = 0, out = 0;
+  while (in < length) {
+    uint8_t code = frame[in++];
+    if (code == TELEMETRY_FRAME_DELIMITER || in + code - 1 > length)
+      return -1;
+    for (uint8_t i = 1; i < code; i++)
+      frame[out++] = frame[in++];
+    if (code != TELEMETRY_COBS_MAX_RUN && in < length)
+      frame[out++] = TELEMETRY_FRAME_DELIMITER;
+  }
+  return out;
+}
+
+/*********************** Sender **************************************/
+
+// Clears the sender state.
+void telemetry_init() {
+  sequence = RESET;
+  lives = RESET;
+  droppedFrameCount = RESET;
+  powerSnapshotCount = RESET;
+}
+
+// Sets the lives reported in status records.
+void telemetry_setLives(uint8_t count) { lives = count; }
+
+// Starts a payload with the record type and the current sequence number.
+static uint16_t telemetry_startPayload(uint8_t payload[],
+                                       telemetry_recordType_t type) {
+  payload[0] = type;
+  payload[1] = sequence;
+  return TELEMETRY_HEADER_SIZE;
+}
+
+// Adds the CRC, frames the payload and queues the whole frame. Nothing is
+// queued unless the whole frame fits.
+static bool telemetry_sendFrame(uint8_t payload[], uint16_t length) {
+  uint16_t crc = telemetry_crc16(payload, length);
+  payload[length++] = crc & 0xFF;
+  payload[length++] = crc >> 8;
+  uint8_t frame[TELEMETRY_MAX_FRAME_SIZE];
+  uint16_t frameLength = telemetry_cobsEncode(payload, length, frame);
+  if (testCapture) {
+    if (testCaptureLength + frameLength > testCaptureSize) {
+      droppedFrameCount++;
+      return false;
+    }
+    memcpy(&testCapture[testCaptureLength], frame, frameLength);
+    testCaptureLength += frameLength;
+  } else {
+    if (bluetooth_transmitQueueFreeCount() < frameLength) {
+      droppedFrameCount++;
+      return false;
+    }
+    bluetooth_transmitQueueWrite(frame, frameLength);
+  }
+  sequence++;
+  return true;
+}
+
+// Queues a hit event. The sample index is sent in full rather than as a
+// delta, so a lost frame does not shift the following hits.
+bool telemetry_sendHitEvent(const detector_hitEvent_t *event) {
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD_SIZE];
+  uint16_t length = telemetry_startPayload(payload, telemetry_hit_e);
+  length = telemetry_putVarint(payload, length, event->sampleIndex);
+  length = telemetry_putVarint(payload, length, event->frequencyNumber);
+  length = telemetry_putVarint(payload, length,
+                               telemetry_quantizePower(event->peakPower));
+  length = telemetry_putVarint(payload, length,
+                               telemetry_quantizePower(event->medianPower));
+  length = telemetry_putVarint(payload, length,
+                               telemetry_quantizePower(event->margin));
+  return telemetry_sendFrame(payload, length);
+}
+
+// Queues a power snapshot, as a keyframe or as deltas from the last one.
+bool telemetry_sendPowerSnapshot(const double powerValues[]) {
+  bool keyframe = powerSnapshotCount % TELEMETRY_POWER_KEYFRAME_INTERVAL == 0;
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD_SIZE];
+  uint16_t length = telemetry_startPayload(
+      payload, keyframe ? telemetry_powerKey_e : telemetry_powerDelta_e);
+  int32_t quantized[FILTER_FREQUENCY_COUNT];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    quantized[i] = telemetry_quantizePower(powerValues[i]);
+    length = telemetry_putVarint(
+        payload, length,
+        keyframe ? (uint32_t)quantized[i]
+                 : telemetry_zigzag(quantized[i] - powerBase[i]));
+  }
+  if (!telemetry_sendFrame(payload, length))
+    return false; // The base stays on what the receiver has.
+  memcpy(powerBase, quantized, sizeof(powerBase));
+  powerSnapshotCount++;
+  return true;
+}
+
+// Queues a status record.
+bool telemetry_sendStatus(const telemetry_status_t *status) {
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD_SIZE];
+  uint16_t length = telemetry_startPayload(payload, telemetry_status_e);
+  length = telemetry_putVarint(payload, length, status->remainingShots);
+  length = telemetry_putVarint(payload, length, status->lives);
+  length = telemetry_putVarint(payload, length, status->droppedSamples);
+  length = telemetry_putVarint(payload, length, status->overloadEpisodes);
+  length = telemetry_putVarint(payload, length, status->isrOverruns);
+  length = telemetry_putVarint(payload, length, status->droppedHitEvents);
+  length = telemetry_putVarint(payload, length, status->droppedFrames);
+  return telemetry_sendFrame(payload, length);
+}
+
+// Scheduler task: sends the current filter powers.
+void telemetry_powerTask() {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  filter_getCurrentPowerValues(powerValues);
+  telemetry_sendPowerSnapshot(powerValues);
+}
+
+// Scheduler task: sends ammo, lives and the health counters.
+void telemetry_statusTask() {
+  telemetry_status_t status;
+  status.remainingShots = trigger_getRemainingShotCount();
+  status.lives = lives;
+  status.droppedSamples = isr_getDroppedSampleCount();
+  status.overloadEpisodes = overload_getEpisodeCount();
+  status.isrOverruns = isr_getBudgetOverrunCount();
+  status.droppedHitEvents = detector_getDroppedHitEventCount();
+  status.droppedFrames = droppedFrameCount;
+  telemetry_sendStatus(&status);
+}
+
+// Returns the number of frames that did not fit in the transmit queue.
+uint32_t telemetry_getDroppedFrameCount() { return droppedFrameCount; }
+
+/*********************** Receiver ************************************/
+
+// Clears the receiver state.
+void telemetry_initDecoder(telemetry_decoder_t *decoder) {
+  memset(decoder, 0, sizeof(*decoder));
+}
+
+// Reads varint fields into values[]. Returns false if the payload is short.
+static bool telemetry_getFields(const uint8_t payload[], uint16_t length,
+                                uint16_t *index, uint64_t values[],
+                                uint16_t count) {
+  for (uint16_t i = 0; i < count; i++)
+    if (!telemetry_getVarint(payload, length, index, &values[i]))
+      return false;
+  return true;
+}
+
+// Parses a payload that passed its CRC. Returns true if it produced a record.
+static bool telemetry_parsePayload(telemetry_decoder_t *decoder,
+                                   const uint8_t payload[], uint16_t length,
+                                   telemetry_record_t *record) {
+  uint16_t index = TELEMETRY_HEADER_SIZE;
+  uint64_t values[FILTER_FREQUENCY_COUNT];
+  record->type = payload[0];
+  record->sequence = payload[1];
+  switch (record->type) {
+  case telemetry_hit_e:
+    if (!telemetry_getFields(payload, length, &index, values, 5))
+      return false;
+    record->data.hit.sampleIndex = values[0];
+    record->data.hit.frequencyNumber = values[1];
+    record->data.hit.peakPower = telemetry_dequantizePower(values[2]);
+    record->data.hit.medianPower = telemetry_dequantizePower(values[3]);
+    record->data.hit.margin = telemetry_dequantizePower(values[4]);
+    return true;
+  case telemetry_powerKey_e:
+  case telemetry_powerDelta_e:
+    if (!telemetry_getFields(payload, length, &index, values,
+                             FILTER_FREQUENCY_COUNT))
+      return false;
+    if (record->type == telemetry_powerDelta_e && !decoder->powerBaseValid)
+      return false; // Wait for the next keyframe.
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      decoder->powerBase[i] = (record->type == telemetry_powerKey_e)
+                                  ? (int32_t)values[i]
+                                  : decoder->powerBase[i] +
+                                        telemetry_unzigzag(values[i]);
+      record->data.powerValues[i] =
+          telemetry_dequantizePower(decoder->powerBase[i]);
+    }
+    decoder->powerBaseValid = true;
+    return true;
+  case telemetry_status_e:
+    if (!telemetry_getFields(payload, length, &index, values, 7))
+      return false;
+    record->data.status.remainingShots = values[0];
+    record->data.status.lives = values[1];
+    record->data.status.droppedSamples = values[2];
+    record->data.status.overloadEpisodes = values[3];
+    record->data.status.isrOverruns = values[4];
+    record->data.status.droppedHitEvents = values[5];
+    record->data.status.droppedFrames = values[6];
+    return true;
+  default:
+    return false; // Unknown record, perhaps from a newer sender.
+  }
+}
+
+// Checks a complete frame and parses it.
+static bool telemetry_endFrame(telemetry_decoder_t *decoder,
+                               telemetry_record_t *record) {
+  int32_t length = telemetry_cobsDecode(decoder->frame, decoder->frameLength);
+  if (length < TELEMETRY_HEADER_SIZE + TELEMETRY_CRC_SIZE ||
+      telemetry_crc16(decoder->frame, length - TELEMETRY_CRC_SIZE) !=
+          (decoder->frame[length - 2] | decoder->frame[length - 1] << 8)) {
+    decoder->crcErrorCount++;
+    decoder->powerBaseValid = false; // A delta frame may have been lost.
+    return false;
+  }
+  decoder->frameCount++;
+  uint8_t frameSequence = decoder->frame[1];
+  if (decoder->sequenceValid && frameSequence != decoder->expectedSequence) {
+    decoder->lostFrameCount +=
+        (uint8_t)(frameSequence - decoder->expectedSequence);
+    decoder->powerBaseValid = false;
+  }
+  decoder->sequenceValid = true;
+  decoder->expectedSequence = frameSequence + 1;
+  return telemetry_parsePayload(decoder, decoder->frame,
+                                length - TELEMETRY_CRC_SIZE, record);
+}
+
+// Feeds one received byte to the decoder.
+bool telemetry_decodeByte(telemetry_decoder_t *decoder, uint8_t byte,
+                          telemetry_record_t *record) {
+  if (byte == TELEMETRY_FRAME_DELIMITER) {
+    bool complete = false;
+    if (decoder->frameOverflow)
+      decoder->crcErrorCount++;
+    else if (decoder->frameLength)
+      complete = telemetry_endFrame(decoder, record);
+    decoder->frameLength = 0;
+    decoder->frameOverflow = false;
+    return complete;
+  }
+  if (decoder->frameLength == TELEMETRY_MAX_FRAME_SIZE)
+    decoder->frameOverflow = true;
+  else
+    decoder->frame[decoder->frameLength++] = byte;
+  return false;
+}
+
+/*********************** Test ****************************************/
+
+#define TELEMETRY_TEST_CAPTURE_SIZE 2048
+#define TELEMETRY_TEST_SNAPSHOT_COUNT 25
+#define TELEMETRY_TEST_CORRUPT_SNAPSHOT 12 // Not a keyframe.
+#define TELEMETRY_TEST_BASE_POWER 1000.0
+#define TELEMETRY_TEST_MAX_POWER_ERROR 0.003 // Half a step is 0.14%.
+#define TELEMETRY_TEST_SAMPLE_INDEX 123456789012ULL
+
+// Returns true if a decoded power is within rounding of the original.
+static bool telemetry_testPowerMatches(double decoded, double original) {
+  return fabs(decoded - original) <=
+         TELEMETRY_TEST_MAX_POWER_ERROR * (1.0 + original);
+}
+
+// Power of channel i in snapshot n of the test.
+static double telemetry_testPower(uint16_t n, uint16_t i) {
+  return TELEMETRY_TEST_BASE_POWER * (i + 1) * (1.0 + 0.1 * n);
+}
+
+// Encodes a hit, a status record and a run of snapshots, corrupts one delta
+// snapshot, and checks that the decoder reports the rest and recovers at the
+// next keyframe.
+bool telemetry_runTest() {
+  printf("****************** telemetry_runTest() ******************\n");
+  static uint8_t capture[TELEMETRY_TEST_CAPTURE_SIZE];
+  testCapture = capture;
+  testCaptureLength = RESET;
+  testCaptureSize = sizeof(capture);
+  telemetry_init();
+  bool success = true;
+  detector_hitEvent_t hit = {.sampleIndex = TELEMETRY_TEST_SAMPLE_INDEX,
+                             .frequencyNumber = 7,
+                             .peakPower = 5.0e5,
+                             .medianPower = 0.25,
+                             .margin = 12.5};
+  telemetry_sendHitEvent(&hit);
+  telemetry_status_t status = {.remainingShots = 9,
+                               .lives = 2,
+                               .droppedSamples = 300,
+                               .overloadEpisodes = 4,
+                               .isrOverruns = 0,
+                               .droppedHitEvents = 1,
+                               .droppedFrames = 0};
+  telemetry_sendStatus(&status);
+  uint16_t corruptOffset = RESET;
+  for (uint16_t n = 0; n < TELEMETRY_TEST_SNAPSHOT_COUNT; n++) {
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      powerValues[i] = telemetry_testPower(n, i);
+    if (n == TELEMETRY_TEST_CORRUPT_SNAPSHOT)
+      corruptOffset = testCaptureLength + TELEMETRY_HEADER_SIZE + 1;
+    telemetry_sendPowerSnapshot(powerValues);
+  }
+  testCapture = NULL;
+  uint16_t frameBytes = testCaptureLength;
+  capture[corruptOffset] ^= 0x40; // A single bit error on the link.
+
+  telemetry_decoder_t decoder;
+  telemetry_initDecoder(&decoder);
+  telemetry_record_t record;
+  uint16_t snapshotsDecoded = 0;
+  for (uint16_t i = 0; i < frameBytes; i++) {
+    if (!telemetry_decodeByte(&decoder, capture[i], &record))
+      continue;
+    if (record.type == telemetry_hit_e) {
+      success &= record.data.hit.sampleIndex == hit.sampleIndex &&
+                 record.data.hit.frequencyNumber == hit.frequencyNumber &&
+                 telemetry_testPowerMatches(record.data.hit.peakPower,
+                                            hit.peakPower) &&
+                 telemetry_testPowerMatches(record.data.hit.margin,
+                                            hit.margin);
+    } else if (record.type == telemetry_status_e) {
+      telemetry_status_t *decoded = &record.data.status;
+      success &= decoded->remainingShots == status.remainingShots &&
+                 decoded->lives == status.lives &&
+                 decoded->droppedSamples == status.droppedSamples &&
+                 decoded->overloadEpisodes == status.overloadEpisodes &&
+                 decoded->isrOverruns == status.isrOverruns &&
+                 decoded->droppedHitEvents == status.droppedHitEvents &&
+                 decoded->droppedFrames == status.droppedFrames;
+    } else {
+      // Snapshot n was sent with sequence n + 2.
+      uint16_t n = record.sequence - 2;
+      for (uint16_t c = 0; c < FILTER_FREQUENCY_COUNT; c++)
+        success &= telemetry_testPowerMatches(record.data.powerValues[c],
+                                              telemetry_testPower(n, c));
+      // Deltas after the corrupt frame must wait for the next keyframe.
+      success &= n < TELEMETRY_TEST_CORRUPT_SNAPSHOT ||
+                 n >= TELEMETRY_TEST_CORRUPT_SNAPSHOT /
+                              TELEMETRY_POWER_KEYFRAME_INTERVAL *
+                              TELEMETRY_POWER_KEYFRAME_INTERVAL +
+                          TELEMETRY_POWER_KEYFRAME_INTERVAL;
+      snapshotsDecoded++;
+    }
+  }
+  uint16_t expectedSnapshots =
+      TELEMETRY_TEST_SNAPSHOT_COUNT -
+      (TELEMETRY_POWER_KEYFRAME_INTERVAL -
+       TELEMETRY_TEST_CORRUPT_SNAPSHOT % TELEMETRY_POWER_KEYFRAME_INTERVAL);
+  success &= snapshotsDecoded == expectedSnapshots &&
+             decoder.crcErrorCount == 1 && decoder.lostFrameCount == 1;
+  printf("telemetry_runTest(): %u records in %u bytes, %u snapshots decoded "
+         "(expected %u), %lu CRC errors, %lu lost frames. %s\n",
+         TELEMETRY_TEST_SNAPSHOT_COUNT + 2, frameBytes, snapshotsDecoded,
+         expectedSnapshots, (unsigned long)decoder.crcErrorCount,
+         (unsigned long)decoder.lostFrameCount, success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,125 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include "detector.h"
+#include "filter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary telemetry over the bluetooth transmit queue, compact enough for the
+// 9600 baud link.
+//
+// Each frame carries one record:
+//   type (1 byte), sequence (1 byte), fields..., CRC-16/CCITT (2 bytes, LSB
+//   first, over type through fields)
+// and is COBS-encoded and terminated by a 0x00 byte, so a receiver can always
+// find the start of the next frame after a corrupt one.
+//
+// Fields are unsigned LEB128 varints. Powers are sent as log2(1 + power) in
+// 1/256 octave steps. Power snapshots send zigzag varint deltas from the
+// previous snapshot, with a keyframe of absolute values every
+// TELEMETRY_POWER_KEYFRAME_INTERVAL snapshots so that a receiver recovers
+// from a lost frame.
+
+// Uncomment to start bluetooth and stream telemetry in the two-team game.
+// Can also be set from the build with -DTELEMETRY_ENABLED.
+// #define TELEMETRY_ENABLED
+
+#define TELEMETRY_POWER_KEYFRAME_INTERVAL 10
+#define TELEMETRY_MAX_PAYLOAD_SIZE 64
+// COBS adds one byte per 254, plus the leading code and the 0x00 delimiter.
+#define TELEMETRY_MAX_FRAME_SIZE                                               \
+  (TELEMETRY_MAX_PAYLOAD_SIZE + TELEMETRY_MAX_PAYLOAD_SIZE / 254 + 2)
+
+typedef enum {
+  telemetry_hit_e = 1,      // One detector hit event.
+  telemetry_powerKey_e = 2, // All channel powers, absolute.
+  telemetry_powerDelta_e = 3, // All channel powers, change since the last.
+  telemetry_status_e = 4    // Game state and detector health counters.
+} telemetry_recordType_t;
+
+// Game state and health counters sent in a status record.
+typedef struct {
+  uint16_t remainingShots;   // trigger_getRemainingShotCount().
+  uint8_t lives;             // As set with telemetry_setLives().
+  uint32_t droppedSamples;   // isr_getDroppedSampleCount().
+  uint32_t overloadEpisodes; // overload_getEpisodeCount().
+  uint32_t isrOverruns;      // isr_getBudgetOverrunCount().
+  uint32_t droppedHitEvents; // detector_getDroppedHitEventCount().
+  uint32_t droppedFrames;    // Frames that did not fit in the transmit queue.
+} telemetry_status_t;
+
+// A decoded record.
+typedef struct {
+  telemetry_recordType_t type;
+  uint8_t sequence;
+  union {
+    detector_hitEvent_t hit; // Powers and margin to 1/256 octave.
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    telemetry_status_t status;
+  } data;
+} telemetry_record_t;
+
+// Receiver state, one per stream.
+typedef struct {
+  uint8_t frame[TELEMETRY_MAX_FRAME_SIZE]; // Encoded bytes of this frame.
+  uint16_t frameLength;
+  bool frameOverflow;          // Too long, discard up to the next 0x00.
+  bool sequenceValid;          // A frame has been received.
+  uint8_t expectedSequence;    // Sequence of the next frame.
+  bool powerBaseValid;         // Deltas can be applied.
+  int32_t powerBase[FILTER_FREQUENCY_COUNT]; // Last powers, quantized.
+  uint32_t frameCount;         // Good frames.
+  uint32_t crcErrorCount;      // Frames that failed the CRC or COBS decode.
+  uint32_t lostFrameCount;     // Frames missing from the sequence.
+} telemetry_decoder_t;
+
+// Clears the sender state. bluetooth_init() must have been called.
+void telemetry_init();
+
+// Sets the lives reported in status records.
+void telemetry_setLives(uint8_t lives);
+
+// Queues a hit event. Each of the send functions returns false, and counts a
+// dropped frame, if the frame does not fit in the transmit queue.
+bool telemetry_sendHitEvent(const detector_hitEvent_t *event);
+
+// Queues a power snapshot, as a keyframe or as deltas.
+bool telemetry_sendPowerSnapshot(const double powerValues[]);
+
+// Queues a status record.
+bool telemetry_sendStatus(const telemetry_status_t *status);
+
+// Scheduler task: sends the current filter powers.
+void telemetry_powerTask();
+
+// Scheduler task: sends ammo, lives and the health counters.
+void telemetry_statusTask();
+
+// Returns the number of frames that did not fit in the transmit queue.
+uint32_t telemetry_getDroppedFrameCount();
+
+// Clears the receiver state.
+void telemetry_initDecoder(telemetry_decoder_t *decoder);
+
+// Feeds one received byte to the decoder. Returns true, with the record filled
+// in, when the byte completes a good frame. Delta snapshots that arrive
+// before a keyframe, or after a lost frame, are skipped.
+bool telemetry_decodeByte(telemetry_decoder_t *decoder, uint8_t byte,
+                          telemetry_record_t *record);
+
+// Sends records through a byte-level copy of the link into a decoder,
+// including a corrupted frame, and checks what comes out. Returns true if it
+// passes.
+bool telemetry_runTest();
+
+#endif /* TELEMETRY_H_ */
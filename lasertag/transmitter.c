@@ -12,7 +12,7 @@
 
 // START DEFINE STATEMENTS
 // 200 ms worth of data
-#define TRANSMITTER_WAVEFORM_LENGTH 20000
+#define TRANSMITTER_WAVEFORM_LENGTH TRANSMITTER_PULSE_WIDTH
 // general initializer for various counters and other values
 #define TRANSMITTER_INITIALIZER 0
 // used to show that we want to run a transmission
@@ -23,8 +23,10 @@
 #define TRANSMITTER_HIGH 1
 // when our transmitted signal is a zero/low
 #define TRANSMITTER_LOW 0
-// we store the duty cycle value of our transmission
-#define TRANSMITTER_DUTY_CYCLE 0.5
+// we split each period into a high and a low half. At 50 kHz some periods are
+// an odd number of ticks, so the low half gets the extra tick.
+#define TRANSMITTER_HIGH_TICKS(period) ((period) / 2)
+#define TRANSMITTER_LOW_TICKS(period) ((period)-TRANSMITTER_HIGH_TICKS(period))
 // the pin that we write to using mio
 #define TRANSMITTER_OUTPUT_PIN 13
 // used to suppress debug statements in mio
@@ -192,9 +194,10 @@ void transmitter_tick() {
                    TRANSMITTER_LOW); // make sure our output pin is set to low
     } // also check to see if we've transmitted high enough
     else if (transmit_low_high_counter >=
-             (filter_frequencyTickTable[acting_frequency] *
-              TRANSMITTER_DUTY_CYCLE)) { // if it has transmitted half the duty
-                                         // cycle, switch to transmit low
+             TRANSMITTER_HIGH_TICKS(
+                 filter_frequencyTickTable[acting_frequency])) { // if it has
+                                         // transmitted the high half, switch to
+                                         // transmit low
       transmitter_currentState = transmit_low_st; // transition to transmit low
       mio_writePin(TRANSMITTER_OUTPUT_PIN,
                    TRANSMITTER_LOW); // set transmitter value to low
@@ -217,9 +220,10 @@ void transmitter_tick() {
       mio_writePin(TRANSMITTER_OUTPUT_PIN,
                    TRANSMITTER_LOW); // reset the pin to low
     } else if (transmit_low_high_counter >=
-               (filter_frequencyTickTable[acting_frequency] *
-                TRANSMITTER_DUTY_CYCLE)) { // if we have transmitted half the
-                                           // duty cycle, switch to transmit low
+               TRANSMITTER_LOW_TICKS(
+                   filter_frequencyTickTable[acting_frequency])) { // if we have
+                                           // transmitted the low half, switch
+                                           // to transmit high
       transmitter_currentState =
           transmit_high_st; // transition back to transmit high
       mio_writePin(TRANSMITTER_OUTPUT_PIN, TRANSMITTER_HIGH);
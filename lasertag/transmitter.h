@@ -10,8 +10,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #ifndef TRANSMITTER_H_
 #define TRANSMITTER_H_
 
-#define TRANSMITTER_OUTPUT_PIN 13     // JF1 (pg. 25 of ZYBO reference manual).
-#define TRANSMITTER_PULSE_WIDTH 20000 // Based on a system tick-rate of 100 kHz.
+#include "isr.h"
+
+#define TRANSMITTER_OUTPUT_PIN 13 // JF1 (pg. 25 of ZYBO reference manual).
+#define TRANSMITTER_PULSE_WIDTH (200 * ISR_TICKS_PER_MS) // 200 ms.
 #include <stdbool.h>
 #include <stdint.h>
 